@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef FACEBOOK_APPLICATION_OCEAN_TEST_CV_TESTCV_TESTCALIBRATION_TEST_CV_CALIBRATION_H
+#define FACEBOOK_APPLICATION_OCEAN_TEST_CV_TESTCV_TESTCALIBRATION_TEST_CV_CALIBRATION_H
+
+#include "application/ocean/test/cv/ApplicationTestCV.h"
+
+/**
+ * @ingroup applicationtestcv
+ * @defgroup applicationtestcvtestcvcalibration Computer Vision Calibration Test
+ * @{
+ * The test application validates the accuracy and measures the performance of the Computer Vision Calibration library.<br>
+ * This application is almost platform independent and is available on desktop platforms like e.g., Windows or OS X.<br>
+ * @}
+ */
+
+#endif // FACEBOOK_APPLICATION_OCEAN_TEST_CV_TESTCV_TESTCALIBRATION_TEST_CV_CALIBRATION_H
@@ -10,11 +10,22 @@
 
 #include "ocean/base/Base.h"
 #include "ocean/base/DataType.h"
-#include "ocean/base/Median.h"
 #include "ocean/base/Utilities.h"
+#include "ocean/base/Worker.h"
 
+#include <algorithm>
 #include <limits>
 
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+	#include <emmintrin.h>
+#endif
+
+#if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+	#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+		#include <arm_neon.h>
+	#endif
+#endif
+
 namespace Ocean
 {
 
@@ -22,84 +33,41 @@ namespace Ocean
  * This class implements a k-d tree.
  * In general, k-d trees should be applied for problems with small dimensions only as the performance benefit decreases with increasing dimension significantly.<br>
  * That means for the number of nodes (n) and the dimension (k) the following should hold: n >> 2^k.
+ *
+ * The tree is built at once (bulk loading) and is stored implicitly in arrays, there are no individual node objects.<br>
+ * Each inner node splits its values at the median of the dimension with the largest extent, the children of inner node i are the nodes 2i + 1 and 2i + 2.<br>
+ * All leaf nodes are located at the same depth and hold a small bucket of values.<br>
+ * The values are copied into the tree so that the values of one leaf are stored consecutively (dimension-major within each leaf), and distances to all values of a leaf can be determined with SIMD instructions.<br>
+ * All search functions return pointers to the values which have been provided when building the tree, so that the given values must exist as long as the tree is used.
  * @tparam T The data type of one element for all dimensions.
  * @ingroup base
  */
 template <typename T>
 class KdTree
 {
-	protected:
+	public:
 
 		/**
-		 * This class defines a node of the k-d tree.
+		 * Definition of the data type of square distances.
 		 */
-		class Node
-		{
-			public:
-
-				/**
-				 * Creates an empty node.
-				 */
-				Node() = default;
-
-				/**
-				 * Destructs a node.
-				 */
-				~Node() = default;
-
-				/**
-				 * Creates a new node with given value.
-				 * @param value Node value
-				 */
-				explicit inline Node(const T* value);
-
-				/**
-				 * Returns the left child of this node.
-				 * @return Left child
-				 */
-				inline Node* left();
-
-				/**
-				 * Returns the right child of this node.
-				 * @return Right child
-				 */
-				inline Node* right();
-
-				/**
-				 * Returns value of this node.
-				 * @return Node value
-				 */
-				inline const T* value();
-
-				/**
-				 * Sets the left child of this node.
-				 * @param left The left child
-				 */
-				inline void setLeft(std::unique_ptr<Node>&& left);
-
-				/**
-				 * Sets the right child of this node.
-				 * @param right The right child
-				 */
-				inline void setRight(std::unique_ptr<Node>&& right);
-
-				/**
-				 * Returns whether this node holds a valid value.
-				 * @return True, if so
-				 */
-				explicit inline operator bool() const;
-
-			protected:
-
-				/// Node value.
-				const T* value_ = nullptr;
-
-				/// Left node.
-				std::unique_ptr<Node> left_ = nullptr;
-
-				/// Right node.
-				std::unique_ptr<Node> right_ = nullptr;
-		};
+		using SquareType = typename SquareValueTyper<T>::Type;
+
+		/**
+		 * Definition of a vector holding single pointers.
+		 */
+		using Pointers = std::vector<const T*>;
+
+		/**
+		 * Definition of a vector holding groups of pointers.
+		 */
+		using PointersGroups = std::vector<Pointers>;
+
+		/**
+		 * The maximal number of values a leaf node can hold.
+		 */
+		static constexpr unsigned int maximalLeafSizeLimit_ = 64u;
+
+	protected:
 
 		/**
 		 * Definition of a vector holding single elements.
@@ -107,17 +75,23 @@ class KdTree
 		using Elements = std::vector<T>;
 
 		/**
-		 * Definition of a vector holding single pointers.
+		 * Definition of a pair combining a square distance and the index of a value within the tree.
 		 */
-		using Pointers = std::vector<const T*>;
+		using DistancePair = std::pair<SquareType, Index32>;
+
+		/**
+		 * Definition of a vector holding distance pairs.
+		 */
+		using DistancePairs = std::vector<DistancePair>;
 
 	public:
 
 		/**
 		 * Creates a new k-d tree.
 		 * @param dimension Number of dimensions the tree will have, with range [1, infinity)
+		 * @param maximalLeafSize The maximal number of values each leaf node can hold, with range [1, maximalLeafSizeLimit_]
 		 */
-		explicit inline KdTree(const unsigned int dimension);
+		explicit inline KdTree(const unsigned int dimension, const unsigned int maximalLeafSize = 16u);
 
 		/**
 		 * Destructs a k-d tree.
@@ -127,30 +101,71 @@ class KdTree
 		/**
 		 * Inserts a set of values to this empty tree.
 		 * Beware: Adding elements to an already existing tree with nodes is not supported.
-		 * @param values The values to be added
+		 * @param values The values to be added, each value must provide dimension() elements and must exist as long as the tree is used
 		 * @param number The number of elements to be added, with range [0, infinity)
 		 * @return True, if succeeded
 		 */
 		bool insert(const T** values, const size_t number);
 
+		/**
+		 * Inserts a set of values which are stored consecutively in memory to this empty tree.
+		 * Beware: Adding elements to an already existing tree with nodes is not supported.
+		 * @param values The values to be added, number * dimension() elements, must exist as long as the tree is used
+		 * @param number The number of values to be added, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool insert(const T* values, const size_t number);
+
 		/**
 		 * Applies a nearest neighbor search for a given value.
 		 * @param value The value to be searched
-		 * @param distance Resulting minimal distance
-		 * @return Resulting nearest neighbor
+		 * @param distance Resulting minimal (square) distance
+		 * @return Resulting nearest neighbor, nullptr if the tree is empty
+		 */
+		const T* nearestNeighbor(const T* value, SquareType& distance) const;
+
+		/**
+		 * Applies a k-nearest neighbors search for a given value.
+		 * @param value The value to be searched
+		 * @param k The number of nearest neighbors to determine, with range [1, infinity)
+		 * @param neighbors The resulting nearest neighbors sorted by ascending distance, must provide k elements
+		 * @param sqrDistances Optional resulting square distances of the nearest neighbors, must provide k elements if defined
+		 * @return The number of resulting nearest neighbors, with range [0, min(k, size())]
 		 */
-		const T* nearestNeighbor(const T* value, typename SquareValueTyper<T>::Type& distance) const;
+		size_t nearestNeighbors(const T* value, const size_t k, const T** neighbors, SquareType* sqrDistances = nullptr) const;
+
+		/**
+		 * Applies a k-nearest neighbors search for several values at once.
+		 * Neighbors which could not be determined (in case the tree holds less than k values) are set to nullptr with maximal square distance.
+		 * @param values The values to be searched, stored consecutively in memory, numberValues * dimension() elements
+		 * @param numberValues The number of values to be searched, with range [0, infinity)
+		 * @param k The number of nearest neighbors to determine for each value, with range [1, infinity)
+		 * @param neighbors The resulting nearest neighbors, k consecutive neighbors sorted by ascending distance for each value, must provide numberValues * k elements
+		 * @param sqrDistances Optional resulting square distances of the nearest neighbors, must provide numberValues * k elements if defined
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void nearestNeighbors(const T* values, const size_t numberValues, const size_t k, const T** neighbors, SquareType* sqrDistances, Worker* worker = nullptr) const;
 
 		/**
 		 * Applies a radius search for neighbors of a given value.
 		 * Beware: Function offers performance boost over brute force search only if radius is so small that relatively few values are returned.
 		 * @param value The value to be searched
-		 * @param radius The neighborhood radius, with range [0, infinity)
+		 * @param radius The neighborhood radius, as square distance, with range [0, infinity)
 		 * @param values Found values within radius distance from a given value
 		 * @param maxValues Limit number of returned values
 		 * @return Number of returned values
 		 */
-		size_t radiusSearch(const T* value, const typename SquareValueTyper<T>::Type radius, const T** values, const size_t maxValues) const;
+		size_t radiusSearch(const T* value, const SquareType radius, const T** values, const size_t maxValues) const;
+
+		/**
+		 * Applies a radius search for several values at once.
+		 * @param values The values to be searched, stored consecutively in memory, numberValues * dimension() elements
+		 * @param numberValues The number of values to be searched, with range [0, infinity)
+		 * @param radius The neighborhood radius, as square distance, with range [0, infinity)
+		 * @param neighborsGroups The resulting neighbors, one group for each value
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void radiusSearch(const T* values, const size_t numberValues, const SquareType radius, PointersGroups& neighborsGroups, Worker* worker = nullptr) const;
 
 		/**
 		 * Returns the dimension of the tree's values.
@@ -159,7 +174,7 @@ class KdTree
 		inline unsigned int dimension() const;
 
 		/**
-		 * Returns the number of tree nodes.
+		 * Returns the number of values stored in this tree.
 		 * @return Tree size
 		 */
 		inline size_t size() const;
@@ -167,135 +182,119 @@ class KdTree
 	protected:
 
 		/**
-		 * Inserts a set of values to a given parent as left children.
-		 * @param parent The parent node
-		 * @param values The values to be added
-		 * @param number The number of elements to be added
-		 * @param depth Current depth of the new nodes
+		 * Builds the subtree of a given node.
+		 * @param nodeIndex The index of the node, with range [0, infinity)
+		 * @param level The level of the node, with range [0, depth_]
+		 * @param indices The indices of all values to be inserted, will be re-ordered
+		 * @param begin The index of the first value of the node within indices
+		 * @param end The index of the first value not belonging to the node within indices, with range [begin, infinity)
 		 */
-		void insertLeft(Node& parent, const T** values, const size_t number, const unsigned int depth);
+		void build(const size_t nodeIndex, const unsigned int level, Index32* indices, const size_t begin, const size_t end);
 
 		/**
-		 * Inserts a set of values to a given parent as right children.
-		 * @param parent The parent node
-		 * @param values The values to be added
-		 * @param number The number of elements to be added
-		 * @param depth Current depth of the new nodes
+		 * Applies a nearest neighbor search for a given node and value.
+		 * @param nodeIndex The index of the node
+		 * @param level The level of the node, with range [0, depth_]
+		 * @param begin The index of the first value of the node
+		 * @param end The index of the first value not belonging to the node, with range [begin, size_]
+		 * @param value The value to be searched
+		 * @param nearestIndex Resulting index of the nearest value
+		 * @param distance Resulting minimal distance
 		 */
-		void insertRight(Node& parent, const T** values, const size_t number, const unsigned int depth);
+		void nearestNeighbor(const size_t nodeIndex, const unsigned int level, const size_t begin, const size_t end, const T* value, Index32& nearestIndex, SquareType& distance) const;
 
 		/**
-		 * Applies a nearest neighbor search for a given node and value.
-		 * @param node Reference node
+		 * Applies a k-nearest neighbors search for a given node and value.
+		 * @param nodeIndex The index of the node
+		 * @param level The level of the node, with range [0, depth_]
+		 * @param begin The index of the first value of the node
+		 * @param end The index of the first value not belonging to the node, with range [begin, size_]
 		 * @param value The value to be searched
-		 * @param nearest Resulting nearest value
-		 * @param distance Resulting minimal distance
-		 * @param index The index of the dimension for the recent search, with range [0, dimension())
+		 * @param k The number of nearest neighbors to determine, with range [1, infinity)
+		 * @param heap The max-heap holding the current nearest neighbors, with at most k elements
 		 */
-		void nearestNeighbor(Node& node, const T* value, const T*& nearest, typename SquareValueTyper<T>::Type& distance, const unsigned int index) const;
+		void nearestNeighbors(const size_t nodeIndex, const unsigned int level, const size_t begin, const size_t end, const T* value, const size_t k, DistancePairs& heap) const;
 
 		/**
 		 * Applies a radius search for neighbors of a given value.
-		 * @param node Reference node
+		 * @param nodeIndex The index of the node
+		 * @param level The level of the node, with range [0, depth_]
+		 * @param begin The index of the first value of the node
+		 * @param end The index of the first value not belonging to the node, with range [begin, size_]
 		 * @param value The value to be searched
 		 * @param radius The neighborhood radius, with range [0, infinity)
 		 * @param values Found values within radius distance from a given value
-		 * @param maxValues Limit number of returned values
-		 * @param index The index of the dimension for the recent search, with range [0, dimension())
-		 * @return Number of returned values
+		 * @param maxValues Limit number of returned values, with range [1, infinity)
+		 * @param foundValues The number of values found so far, with range [0, maxValues]
 		 */
-		size_t radiusSearch(Node& node, const T* value, const typename SquareValueTyper<T>::Type radius, const T** values, const size_t maxValues, const unsigned int index) const;
+		void radiusSearch(const size_t nodeIndex, const unsigned int level, const size_t begin, const size_t end, const T* value, const SquareType radius, const T** values, const size_t maxValues, size_t& foundValues) const;
 
 		/**
-		 * Returns the median for a given set of values.
-		 * @param values The values to return the median for
-		 * @param number The number of values
-		 * @param index Dimension index
-		 * @return Resulting median
+		 * Applies a k-nearest neighbors search for a subset of several values.
+		 * @param values The values to be searched
+		 * @param k The number of nearest neighbors to determine for each value, with range [1, infinity)
+		 * @param neighbors The resulting nearest neighbors
+		 * @param sqrDistances Optional resulting square distances of the nearest neighbors
+		 * @param firstValue The first value to be handled
+		 * @param numberValues The number of values to be handled
 		 */
-		static T median(const T** values, const size_t number, const unsigned int index);
+		void nearestNeighborsSubset(const T* values, const size_t k, const T** neighbors, SquareType* sqrDistances, const unsigned int firstValue, const unsigned int numberValues) const;
 
 		/**
-		 * Distributes a given set of values into two subset according to the median.
-		 * @param values The values to distribute
-		 * @param number The number of values
-		 * @param index Dimension index to be used for distribution
-		 * @param medianValue Resulting median value
-		 * @param leftValues Resulting left values
-		 * @param rightValues Resulting right values
+		 * Applies a radius search for a subset of several values.
+		 * @param values The values to be searched
+		 * @param radius The neighborhood radius, with range [0, infinity)
+		 * @param neighborsGroups The resulting neighbors
+		 * @param firstValue The first value to be handled
+		 * @param numberValues The number of values to be handled
 		 */
-		static void distribute(const T** values, const size_t number, const unsigned int index, const T*& medianValue, Pointers& leftValues, Pointers& rightValues);
+		void radiusSearchSubset(const T* values, const SquareType radius, Pointers* neighborsGroups, const unsigned int firstValue, const unsigned int numberValues) const;
 
 		/**
-		 * Determines the square distance between two values.
-		 * @param first The first value
-		 * @param second The second value
-		 * @return Square distance
+		 * Determines the square distances between a given value and all values of a leaf node.
+		 * The leaf values are stored dimension-major, the square distances are accumulated dimension by dimension.
+		 * @param value The value for which the distances will be determined
+		 * @param leafValues The first element of the values of the leaf
+		 * @param leafSize The number of values the leaf holds, with range [1, maximalLeafSizeLimit_]
+		 * @param dimension The dimension of the values, with range [1, infinity)
+		 * @param sqrDistances The resulting square distances, must provide leafSize elements
 		 */
-		inline typename SquareValueTyper<T>::Type determineSquareDistance(const T* first, const T* second) const;
+		static inline void determineSquareDistances(const T* value, const T* leafValues, const size_t leafSize, const unsigned int dimension, SquareType* sqrDistances);
 
 	protected:
 
-		/// Root node of this tree.
-		std::unique_ptr<Node> root_;
-
-		/// Number of nodes.
-		size_t size_ = 0;
-
-		/// Number of dimensions.
-		const unsigned int dimension_ = 0u;
-};
+		/// The values of the tree, stored leaf by leaf and dimension-major within each leaf.
+		Elements values_;
 
-template <typename T>
-inline KdTree<T>::Node::Node(const T* value) :
-	value_(value)
-{
-	// nothing to do here
-}
+		/// The pointers to the original values, one for each value of the tree in the same order as values_.
+		Pointers pointers_;
 
-template <typename T>
-inline typename KdTree<T>::Node* KdTree<T>::Node::left()
-{
-	return left_.get();
-}
+		/// The split dimensions of all inner nodes.
+		Indices32 splitDimensions_;
 
-template <typename T>
-inline typename KdTree<T>::Node* KdTree<T>::Node::right()
-{
-	return right_.get();
-}
+		/// The split values of all inner nodes.
+		Elements splitValues_;
 
-template <typename T>
-inline const T* KdTree<T>::Node::value()
-{
-	return value_;
-}
+		/// The number of levels with inner nodes, all leaf nodes are located at this level.
+		unsigned int depth_ = 0u;
 
-template <typename T>
-inline void KdTree<T>::Node::setLeft(std::unique_ptr<Node>&& left)
-{
-	ocean_assert(!left_);
-	left_ = std::move(left);
-}
+		/// Number of values.
+		size_t size_ = 0;
 
-template <typename T>
-inline void KdTree<T>::Node::setRight(std::unique_ptr<Node>&& right)
-{
-	ocean_assert(!right_);
-	right_ = std::move(right);
-}
+		/// Number of dimensions.
+		const unsigned int dimension_ = 0u;
 
-template <typename T>
-inline KdTree<T>::Node::operator bool() const
-{
-	return value_ != nullptr;
-}
+		/// The maximal number of values a leaf node can hold.
+		const unsigned int maximalLeafSize_ = 0u;
+};
 
 template <typename T>
-inline KdTree<T>::KdTree(const unsigned int dimension) :
-	dimension_(dimension)
+inline KdTree<T>::KdTree(const unsigned int dimension, const unsigned int maximalLeafSize) :
+	dimension_(dimension),
+	maximalLeafSize_(minmax(1u, maximalLeafSize, maximalLeafSizeLimit_))
 {
 	ocean_assert(dimension >= 1u);
+	ocean_assert(maximalLeafSize >= 1u && maximalLeafSize <= maximalLeafSizeLimit_);
 }
 
 template <typename T>
@@ -306,71 +305,221 @@ bool KdTree<T>::insert(const T** values, const size_t number)
 		return true;
 	}
 
-	if (root_)
+	if (size_ != 0)
 	{
 		return false;
 	}
 
 	ocean_assert(values);
 
-	const T* median = nullptr;
-	Pointers left, right;
+	if (number >= size_t(std::numeric_limits<Index32>::max()))
+	{
+		return false;
+	}
+
+	// the depth is chosen so that no leaf holds more than maximalLeafSize_ values, each split creates halves differing by one value at most
+
+	depth_ = 0u;
+
+	for (size_t maximalNodeSize = number; maximalNodeSize > size_t(maximalLeafSize_); maximalNodeSize = (maximalNodeSize + 1) / 2)
+	{
+		++depth_;
+	}
+
+	const size_t numberInnerNodes = (size_t(1) << depth_) - 1;
+
+	splitDimensions_.resize(numberInnerNodes);
+	splitValues_.resize(numberInnerNodes);
 
-	distribute(values, number, 0u, median, left, right);
+	pointers_.assign(values, values + number);
 
-	root_ = std::make_unique<Node>(median);
+	Indices32 indices(number);
 
-	if (!left.empty())
+	for (size_t n = 0; n < number; ++n)
 	{
-		insertLeft(*root_, left.data(), left.size(), 1u);
+		indices[n] = Index32(n);
 	}
 
-	if (!right.empty())
+	build(0, 0u, indices.data(), 0, number);
+
+	// now we store the values leaf by leaf, as the leaf ranges are implicitly given by the order of the indices
+
+	Pointers orderedPointers(number);
+	values_.resize(number * size_t(dimension_));
+
+	for (size_t leafIndex = 0; leafIndex < (size_t(1) << depth_); ++leafIndex)
 	{
-		insertRight(*root_, right.data(), right.size(), 1u);
+		size_t begin = 0;
+		size_t end = number;
+
+		for (unsigned int level = 0u; level < depth_; ++level)
+		{
+			const size_t middle = begin + (end - begin) / 2;
+
+			if (leafIndex & (size_t(1) << (depth_ - level - 1u)))
+			{
+				begin = middle;
+			}
+			else
+			{
+				end = middle;
+			}
+		}
+
+		ocean_assert(end - begin <= size_t(maximalLeafSize_));
+
+		const size_t leafSize = end - begin;
+		T* const leafValues = values_.data() + begin * size_t(dimension_);
+
+		for (size_t n = 0; n < leafSize; ++n)
+		{
+			const T* value = pointers_[indices[begin + n]];
+
+			orderedPointers[begin + n] = value;
+
+			for (unsigned int d = 0u; d < dimension_; ++d)
+			{
+				leafValues[d * leafSize + n] = value[d];
+			}
+		}
 	}
 
+	pointers_ = std::move(orderedPointers);
+
 	size_ = number;
 
 	return true;
 }
 
 template <typename T>
-const T* KdTree<T>::nearestNeighbor(const T* value, typename SquareValueTyper<T>::Type& distance) const
+bool KdTree<T>::insert(const T* values, const size_t number)
+{
+	ocean_assert(values != nullptr || number == 0);
+
+	Pointers pointers(number);
+
+	for (size_t n = 0; n < number; ++n)
+	{
+		pointers[n] = values + n * size_t(dimension_);
+	}
+
+	return insert(pointers.data(), pointers.size());
+}
+
+template <typename T>
+const T* KdTree<T>::nearestNeighbor(const T* value, SquareType& distance) const
 {
 	ocean_assert(value);
 
-	distance = std::numeric_limits<typename SquareValueTyper<T>::Type>::max();
+	distance = std::numeric_limits<SquareType>::max();
 
-	if (!root_)
+	if (size_ == 0)
 	{
 		return nullptr;
 	}
 
-	const T* nearest = nullptr;
+	Index32 nearestIndex = Index32(-1);
+
+	nearestNeighbor(0, 0u, 0, size_, value, nearestIndex, distance);
 
-	nearestNeighbor(*root_, value, nearest, distance, 0u);
-	return nearest;
+	ocean_assert(nearestIndex < size_);
+	return pointers_[nearestIndex];
 }
 
 template <typename T>
-size_t KdTree<T>::radiusSearch(const T* value, const typename SquareValueTyper<T>::Type radius, const T** values, const size_t maxValues) const
+size_t KdTree<T>::nearestNeighbors(const T* value, const size_t k, const T** neighbors, SquareType* sqrDistances) const
+{
+	ocean_assert(value && neighbors);
+	ocean_assert(k >= 1);
+
+	if (size_ == 0 || k == 0)
+	{
+		return 0;
+	}
+
+	DistancePairs heap;
+	heap.reserve(std::min(k, size_) + 1);
+
+	nearestNeighbors(0, 0u, 0, size_, value, k, heap);
+
+	std::sort_heap(heap.begin(), heap.end());
+
+	for (size_t n = 0; n < heap.size(); ++n)
+	{
+		neighbors[n] = pointers_[heap[n].second];
+
+		if (sqrDistances != nullptr)
+		{
+			sqrDistances[n] = heap[n].first;
+		}
+	}
+
+	return heap.size();
+}
+
+template <typename T>
+void KdTree<T>::nearestNeighbors(const T* values, const size_t numberValues, const size_t k, const T** neighbors, SquareType* sqrDistances, Worker* worker) const
+{
+	ocean_assert(values != nullptr || numberValues == 0);
+	ocean_assert(neighbors != nullptr || numberValues == 0);
+	ocean_assert(k >= 1);
+
+	if (numberValues == 0 || k == 0)
+	{
+		return;
+	}
+
+	if (worker != nullptr && numberValues >= 100)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &KdTree<T>::nearestNeighborsSubset, values, k, neighbors, sqrDistances, 0u, 0u), 0u, (unsigned int)(numberValues), 4u, 5u, 20u);
+	}
+	else
+	{
+		nearestNeighborsSubset(values, k, neighbors, sqrDistances, 0u, (unsigned int)(numberValues));
+	}
+}
+
+template <typename T>
+size_t KdTree<T>::radiusSearch(const T* value, const SquareType radius, const T** values, const size_t maxValues) const
 {
 	ocean_assert(value);
 	ocean_assert(values);
 
-	if (!root_ || maxValues == 0)
+	if (size_ == 0 || maxValues == 0)
 	{
 		return 0;
 	}
 
-	size_t found = radiusSearch(*root_, value, radius, values, maxValues, 0u);
+	size_t found = 0;
+	radiusSearch(0, 0u, 0, size_, value, radius, values, maxValues, found);
 
 	ocean_assert(found <= maxValues);
 
 	return found;
 }
 
+template <typename T>
+void KdTree<T>::radiusSearch(const T* values, const size_t numberValues, const SquareType radius, PointersGroups& neighborsGroups, Worker* worker) const
+{
+	ocean_assert(values != nullptr || numberValues == 0);
+
+	neighborsGroups.resize(numberValues);
+
+	if (numberValues == 0)
+	{
+		return;
+	}
+
+	if (worker != nullptr && numberValues >= 100)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &KdTree<T>::radiusSearchSubset, values, radius, neighborsGroups.data(), 0u, 0u), 0u, (unsigned int)(numberValues), 3u, 4u, 20u);
+	}
+	else
+	{
+		radiusSearchSubset(values, radius, neighborsGroups.data(), 0u, (unsigned int)(numberValues));
+	}
+}
+
 template <typename T>
 inline unsigned int KdTree<T>::dimension() const
 {
@@ -384,257 +533,447 @@ inline size_t KdTree<T>::size() const
 }
 
 template <typename T>
-void KdTree<T>::insertLeft(Node& parent, const T** values, const size_t number, const unsigned int depth)
+void KdTree<T>::build(const size_t nodeIndex, const unsigned int level, Index32* indices, const size_t begin, const size_t end)
 {
-#ifdef OCEAN_DEBUG
-	ocean_assert(parent);
-	ocean_assert(values && number > 0);
+	ocean_assert(indices != nullptr);
+	ocean_assert(begin <= end);
 
-	for (size_t n = 0; n < number; ++n)
+	if (level == depth_)
 	{
-		ocean_assert(values[n][(depth - 1) % dimension_] <= parent.value()[(depth - 1) % dimension_]);
+		return;
 	}
-#endif
 
-	ocean_assert(!parent.left());
+	ocean_assert(nodeIndex < splitDimensions_.size());
 
-	const unsigned int index = depth % dimension_;
+	const size_t middle = begin + (end - begin) / 2;
 
-	const T* median = nullptr;
-	Pointers left, right;
+	unsigned int splitDimension = 0u;
 
-	distribute(values, number, index, median, left, right);
+	if (end - begin >= 2)
+	{
+		// we split the dimension with the largest extent
 
-	parent.setLeft(std::make_unique<Node>(median));
+		T largestExtent = T(0);
 
-	if (!left.empty())
-	{
-		insertLeft(*parent.left(), left.data(), left.size(), depth + 1);
-	}
+		for (unsigned int d = 0u; d < dimension_; ++d)
+		{
+			T minValue = pointers_[indices[begin]][d];
+			T maxValue = minValue;
 
-	if (!right.empty())
-	{
-		insertRight(*parent.left(), right.data(), right.size(), depth + 1);
+			for (size_t n = begin + 1; n < end; ++n)
+			{
+				const T& value = pointers_[indices[n]][d];
+
+				if (value < minValue)
+				{
+					minValue = value;
+				}
+				else if (value > maxValue)
+				{
+					maxValue = value;
+				}
+			}
+
+			if (d == 0u || maxValue - minValue > largestExtent)
+			{
+				largestExtent = maxValue - minValue;
+				splitDimension = d;
+			}
+		}
+
+		const Pointers& pointers = pointers_;
+
+		std::nth_element(indices + begin, indices + middle, indices + end, [&pointers, splitDimension](const Index32 first, const Index32 second)
+		{
+			return pointers[first][splitDimension] < pointers[second][splitDimension];
+		});
 	}
+
+	// all values in the left child are less or equal to the split value, all values in the right child are greater or equal
+
+	splitDimensions_[nodeIndex] = splitDimension;
+	splitValues_[nodeIndex] = middle < end ? pointers_[indices[middle]][splitDimension] : T(0);
+
+	build(nodeIndex * 2 + 1, level + 1u, indices, begin, middle);
+	build(nodeIndex * 2 + 2, level + 1u, indices, middle, end);
 }
 
 template <typename T>
-void KdTree<T>::insertRight(Node& parent, const T** values, const size_t number, const unsigned int depth)
+void KdTree<T>::nearestNeighbor(const size_t nodeIndex, const unsigned int level, const size_t begin, const size_t end, const T* value, Index32& nearestIndex, SquareType& distance) const
 {
-#ifdef OCEAN_DEBUG
-	ocean_assert(parent);
-	ocean_assert(values && number > 0);
+	ocean_assert(value != nullptr);
+	ocean_assert(begin <= end && end <= size_);
 
-	for (size_t n = 0; n < number; ++n)
+	if (level == depth_)
 	{
-		ocean_assert(parent.value()[(depth - 1) % dimension_] < values[n][(depth - 1) % dimension_]);
-	}
-#endif
+		const size_t leafSize = end - begin;
+
+		if (leafSize == 0)
+		{
+			return;
+		}
 
-	ocean_assert(!parent.right());
+		SquareType sqrDistances[maximalLeafSizeLimit_];
+		determineSquareDistances(value, values_.data() + begin * size_t(dimension_), leafSize, dimension_, sqrDistances);
 
-	const unsigned int index = depth % dimension_;
+		for (size_t n = 0; n < leafSize; ++n)
+		{
+			if (sqrDistances[n] < distance)
+			{
+				distance = sqrDistances[n];
+				nearestIndex = Index32(begin + n);
+			}
+		}
 
-	const T* median = nullptr;
-	Pointers left, right;
+		return;
+	}
 
-	distribute(values, number, index, median, left, right);
+	const size_t middle = begin + (end - begin) / 2;
 
-	parent.setRight(std::make_unique<Node>(median));
+	const unsigned int splitDimension = splitDimensions_[nodeIndex];
+	const T& splitValue = splitValues_[nodeIndex];
 
-	if (!left.empty())
+	// depth-first-search
+	if (value[splitDimension] < splitValue)
 	{
-		insertLeft(*parent.right(), left.data(), left.size(), depth + 1);
-	}
+		nearestNeighbor(nodeIndex * 2 + 1, level + 1u, begin, middle, value, nearestIndex, distance);
 
-	if (!right.empty())
+		// check the neighboring branch not covered by the depth-first-search
+		if (sqr(value[splitDimension] - splitValue) < distance)
+		{
+			nearestNeighbor(nodeIndex * 2 + 2, level + 1u, middle, end, value, nearestIndex, distance);
+		}
+	}
+	else
 	{
-		insertRight(*parent.right(), right.data(), right.size(), depth + 1);
+		nearestNeighbor(nodeIndex * 2 + 2, level + 1u, middle, end, value, nearestIndex, distance);
+
+		// check the neighboring branch not covered by the depth-first-search
+		if (sqr(value[splitDimension] - splitValue) < distance)
+		{
+			nearestNeighbor(nodeIndex * 2 + 1, level + 1u, begin, middle, value, nearestIndex, distance);
+		}
 	}
 }
 
 template <typename T>
-void KdTree<T>::nearestNeighbor(Node& node, const T* value, const T*& nearest, typename SquareValueTyper<T>::Type& distance, const unsigned int index) const
+void KdTree<T>::nearestNeighbors(const size_t nodeIndex, const unsigned int level, const size_t begin, const size_t end, const T* value, const size_t k, DistancePairs& heap) const
 {
-	ocean_assert(node && value);
-	ocean_assert(index < dimension_);
+	ocean_assert(value != nullptr);
+	ocean_assert(begin <= end && end <= size_);
+	ocean_assert(k >= 1 && heap.size() <= k);
 
-	const typename SquareValueTyper<T>::Type localDistance = determineSquareDistance(value, node.value());
-	if (localDistance < distance)
+	if (level == depth_)
 	{
-		distance = localDistance;
-		nearest = node.value();
-	}
+		const size_t leafSize = end - begin;
 
-	const unsigned int nextIndex = (index + 1u) % dimension_;
-
-	// depth-first-search
-	if (value[index] <= node.value()[index])
-	{
-		if (node.left())
+		if (leafSize == 0)
 		{
-			nearestNeighbor(*node.left(), value, nearest, distance, nextIndex);
+			return;
 		}
 
-		// check the neighboring branch not covered by the depth-first-search
-		if (node.right() && sqr(value[index] - node.value()[index]) < distance)
+		SquareType sqrDistances[maximalLeafSizeLimit_];
+		determineSquareDistances(value, values_.data() + begin * size_t(dimension_), leafSize, dimension_, sqrDistances);
+
+		for (size_t n = 0; n < leafSize; ++n)
 		{
-			nearestNeighbor(*node.right(), value, nearest, distance, nextIndex);
+			if (heap.size() < k)
+			{
+				heap.emplace_back(sqrDistances[n], Index32(begin + n));
+				std::push_heap(heap.begin(), heap.end());
+			}
+			else if (sqrDistances[n] < heap.front().first)
+			{
+				std::pop_heap(heap.begin(), heap.end());
+				heap.back() = DistancePair(sqrDistances[n], Index32(begin + n));
+				std::push_heap(heap.begin(), heap.end());
+			}
 		}
+
+		return;
+	}
+
+	const size_t middle = begin + (end - begin) / 2;
+
+	const unsigned int splitDimension = splitDimensions_[nodeIndex];
+	const T& splitValue = splitValues_[nodeIndex];
+
+	const bool leftFirst = value[splitDimension] < splitValue;
+
+	// depth-first-search
+	if (leftFirst)
+	{
+		nearestNeighbors(nodeIndex * 2 + 1, level + 1u, begin, middle, value, k, heap);
 	}
 	else
 	{
-		ocean_assert(value[index] > node.value()[index]);
+		nearestNeighbors(nodeIndex * 2 + 2, level + 1u, middle, end, value, k, heap);
+	}
 
-		if (node.right())
+	// check the neighboring branch not covered by the depth-first-search, as long as we do not have k neighbors, we have to check it in any case
+	if (heap.size() < k || sqr(value[splitDimension] - splitValue) < heap.front().first)
+	{
+		if (leftFirst)
 		{
-			nearestNeighbor(*node.right(), value, nearest, distance, nextIndex);
+			nearestNeighbors(nodeIndex * 2 + 2, level + 1u, middle, end, value, k, heap);
 		}
-
-		// check the neighboring branch not covered by the depth-first-search
-		if (node.left() && sqr(value[index] - node.value()[index]) < distance)
+		else
 		{
-			nearestNeighbor(*node.left(), value, nearest, distance, nextIndex);
+			nearestNeighbors(nodeIndex * 2 + 1, level + 1u, begin, middle, value, k, heap);
 		}
 	}
 }
 
 template <typename T>
-size_t KdTree<T>::radiusSearch(Node& node, const T* value, const typename SquareValueTyper<T>::Type radius, const T** values, const size_t maxValues, const unsigned int index) const
+void KdTree<T>::radiusSearch(const size_t nodeIndex, const unsigned int level, const size_t begin, const size_t end, const T* value, const SquareType radius, const T** values, const size_t maxValues, size_t& foundValues) const
 {
-	ocean_assert(node && value && values);
-	ocean_assert(index < dimension_);
+	ocean_assert(value != nullptr && values != nullptr);
+	ocean_assert(begin <= end && end <= size_);
+	ocean_assert(foundValues < maxValues);
 
-	if (maxValues == 0)
+	if (level == depth_)
 	{
-		return 0;
-	}
+		const size_t leafSize = end - begin;
 
-	T const ** current = values;
-	T const ** const end = values + maxValues;
+		if (leafSize == 0)
+		{
+			return;
+		}
 
-	const typename SquareValueTyper<T>::Type localDistance = determineSquareDistance(value, node.value());
-	if (localDistance <= radius)
-	{
-		*current++ = node.value();
+		SquareType sqrDistances[maximalLeafSizeLimit_];
+		determineSquareDistances(value, values_.data() + begin * size_t(dimension_), leafSize, dimension_, sqrDistances);
 
-		if (current == end)
+		for (size_t n = 0; n < leafSize; ++n)
 		{
-			return maxValues;
+			if (sqrDistances[n] <= radius)
+			{
+				values[foundValues++] = pointers_[begin + n];
+
+				if (foundValues == maxValues)
+				{
+					return;
+				}
+			}
 		}
+
+		return;
 	}
 
-	const unsigned int nextIndex = (index + 1u) % dimension_;
+	const size_t middle = begin + (end - begin) / 2;
+
+	const unsigned int splitDimension = splitDimensions_[nodeIndex];
+	const T& splitValue = splitValues_[nodeIndex];
+
+	const bool checkNeighborBranch = sqr(value[splitDimension] - splitValue) <= radius;
 
 	// depth-first-search
-	if (value[index] <= node.value()[index])
+	if (value[splitDimension] < splitValue)
 	{
-		if (node.left())
+		radiusSearch(nodeIndex * 2 + 1, level + 1u, begin, middle, value, radius, values, maxValues, foundValues);
+
+		// check the neighboring branch not covered by the depth-first-search
+		if (foundValues < maxValues && checkNeighborBranch)
 		{
-			current += radiusSearch(*node.left(), value, radius, current, end - current, nextIndex);
-			if (current == end)
-			{
-				return maxValues;
-			}
+			radiusSearch(nodeIndex * 2 + 2, level + 1u, middle, end, value, radius, values, maxValues, foundValues);
 		}
+	}
+	else
+	{
+		radiusSearch(nodeIndex * 2 + 2, level + 1u, middle, end, value, radius, values, maxValues, foundValues);
 
 		// check the neighboring branch not covered by the depth-first-search
-		if (node.right() && sqr(value[index] - node.value()[index]) <= radius)
+		if (foundValues < maxValues && checkNeighborBranch)
 		{
-			current += radiusSearch(*node.right(), value, radius, current, end - current, nextIndex);
+			radiusSearch(nodeIndex * 2 + 1, level + 1u, begin, middle, value, radius, values, maxValues, foundValues);
 		}
 	}
-	else
+}
+
+template <typename T>
+void KdTree<T>::nearestNeighborsSubset(const T* values, const size_t k, const T** neighbors, SquareType* sqrDistances, const unsigned int firstValue, const unsigned int numberValues) const
+{
+	ocean_assert(values != nullptr && neighbors != nullptr);
+	ocean_assert(k >= 1);
+
+	for (size_t n = size_t(firstValue); n < size_t(firstValue + numberValues); ++n)
 	{
-		ocean_assert(value[index] > node.value()[index]);
+		const T** valueNeighbors = neighbors + n * k;
+		SquareType* valueSqrDistances = sqrDistances != nullptr ? sqrDistances + n * k : nullptr;
+
+		const size_t found = nearestNeighbors(values + n * size_t(dimension_), k, valueNeighbors, valueSqrDistances);
 
-		if (node.right())
+		for (size_t i = found; i < k; ++i)
 		{
-			current += radiusSearch(*node.right(), value, radius, current, end - current, nextIndex);
-			if (current == end)
+			valueNeighbors[i] = nullptr;
+
+			if (valueSqrDistances != nullptr)
 			{
-				return maxValues;
+				valueSqrDistances[i] = std::numeric_limits<SquareType>::max();
 			}
 		}
+	}
+}
 
-		// check the neighboring branch not covered by the depth-first-search
-		if (node.left() && sqr(value[index] - node.value()[index]) <= radius)
+template <typename T>
+void KdTree<T>::radiusSearchSubset(const T* values, const SquareType radius, Pointers* neighborsGroups, const unsigned int firstValue, const unsigned int numberValues) const
+{
+	ocean_assert(values != nullptr && neighborsGroups != nullptr);
+
+	if (size_ == 0)
+	{
+		for (unsigned int n = firstValue; n < firstValue + numberValues; ++n)
 		{
-			current += radiusSearch(*node.left(), value, radius, current, end - current, nextIndex);
+			neighborsGroups[n].clear();
 		}
+
+		return;
 	}
 
-	ocean_assert(current <= end);
+	Pointers neighbors(size_);
+
+	for (unsigned int n = firstValue; n < firstValue + numberValues; ++n)
+	{
+		size_t found = 0;
+		radiusSearch(0, 0u, 0, size_, values + size_t(n) * size_t(dimension_), radius, neighbors.data(), neighbors.size(), found);
 
-	return current - values;
+		neighborsGroups[n].assign(neighbors.cbegin(), neighbors.cbegin() + found);
+	}
 }
 
 template <typename T>
-T KdTree<T>::median(const T** values, const size_t number, const unsigned int index)
+inline void KdTree<T>::determineSquareDistances(const T* value, const T* leafValues, const size_t leafSize, const unsigned int dimension, SquareType* sqrDistances)
 {
-	ocean_assert(values && number > 0);
+	ocean_assert(value != nullptr && leafValues != nullptr && sqrDistances != nullptr);
+	ocean_assert(leafSize >= 1 && leafSize <= size_t(maximalLeafSizeLimit_));
 
-	Elements elements(number);
-	for (size_t n = 0; n < number; ++n)
+	for (size_t n = 0; n < leafSize; ++n)
 	{
-		elements[n] = values[n][index];
+		sqrDistances[n] = SquareType(0);
 	}
 
-	return Median::median<T>((T*)elements.data(), elements.size());
+	for (unsigned int d = 0u; d < dimension; ++d)
+	{
+		const T* dimensionValues = leafValues + d * leafSize;
+
+		for (size_t n = 0; n < leafSize; ++n)
+		{
+			sqrDistances[n] += sqr(value[d] - dimensionValues[n]);
+		}
+	}
 }
 
-template <typename T>
-void KdTree<T>::distribute(const T** values, const size_t number, const unsigned int index, const T*& medianValue, Pointers& leftValues, Pointers& rightValues)
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 20
+
+template <>
+inline void KdTree<float>::determineSquareDistances(const float* value, const float* leafValues, const size_t leafSize, const unsigned int dimension, float* sqrDistances)
 {
-	ocean_assert(values && number > 0);
+	ocean_assert(value != nullptr && leafValues != nullptr && sqrDistances != nullptr);
+	ocean_assert(leafSize >= 1 && leafSize <= size_t(maximalLeafSizeLimit_));
 
-	const T middle = median(values, number, index);
+	// we determine the distances for four leaf values at once, the distances are accumulated dimension by dimension like in the scalar implementation
 
-	leftValues.reserve(number / 2);
-	rightValues.reserve(number / 2);
+	size_t n = 0;
 
-	ocean_assert(leftValues.empty() && rightValues.empty());
+	for (; n + 4 <= leafSize; n += 4)
+	{
+		__m128 sqrDistances_f_32x4 = _mm_setzero_ps();
 
-	bool medianFound = false;
+		for (unsigned int d = 0u; d < dimension; ++d)
+		{
+			const __m128 difference_f_32x4 = _mm_sub_ps(_mm_set1_ps(value[d]), _mm_loadu_ps(leafValues + d * leafSize + n));
+			sqrDistances_f_32x4 = _mm_add_ps(sqrDistances_f_32x4, _mm_mul_ps(difference_f_32x4, difference_f_32x4));
+		}
 
-	for (size_t n = 0; n < number; ++n)
+		_mm_storeu_ps(sqrDistances + n, sqrDistances_f_32x4);
+	}
+
+	for (; n < leafSize; ++n)
 	{
-		if (values[n][index] < middle || (values[n][index] == middle && medianFound))
+		float sqrDistance = 0.0f;
+
+		for (unsigned int d = 0u; d < dimension; ++d)
 		{
-			leftValues.push_back(values[n]);
+			sqrDistance += sqr(value[d] - leafValues[d * leafSize + n]);
 		}
-		else if (middle < values[n][index])
+
+		sqrDistances[n] = sqrDistance;
+	}
+}
+
+template <>
+inline void KdTree<double>::determineSquareDistances(const double* value, const double* leafValues, const size_t leafSize, const unsigned int dimension, double* sqrDistances)
+{
+	ocean_assert(value != nullptr && leafValues != nullptr && sqrDistances != nullptr);
+	ocean_assert(leafSize >= 1 && leafSize <= size_t(maximalLeafSizeLimit_));
+
+	size_t n = 0;
+
+	for (; n + 2 <= leafSize; n += 2)
+	{
+		__m128d sqrDistances_d_64x2 = _mm_setzero_pd();
+
+		for (unsigned int d = 0u; d < dimension; ++d)
 		{
-			rightValues.push_back(values[n]);
+			const __m128d difference_d_64x2 = _mm_sub_pd(_mm_set1_pd(value[d]), _mm_loadu_pd(leafValues + d * leafSize + n));
+			sqrDistances_d_64x2 = _mm_add_pd(sqrDistances_d_64x2, _mm_mul_pd(difference_d_64x2, difference_d_64x2));
 		}
-		else
-		{
-			ocean_assert(values[n][index] == middle);
-			ocean_assert(!medianFound);
 
-			medianValue = values[n];
-			medianFound = true;
-		}
+		_mm_storeu_pd(sqrDistances + n, sqrDistances_d_64x2);
 	}
 
-	ocean_assert(medianFound);
+	for (; n < leafSize; ++n)
+	{
+		double sqrDistance = 0.0;
+
+		for (unsigned int d = 0u; d < dimension; ++d)
+		{
+			sqrDistance += sqr(value[d] - leafValues[d * leafSize + n]);
+		}
+
+		sqrDistances[n] = sqrDistance;
+	}
 }
 
-template <typename T>
-inline typename SquareValueTyper<T>::Type KdTree<T>::determineSquareDistance(const T* first, const T* second) const
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+template <>
+inline void KdTree<float>::determineSquareDistances(const float* value, const float* leafValues, const size_t leafSize, const unsigned int dimension, float* sqrDistances)
 {
-	ocean_assert(first && second);
+	ocean_assert(value != nullptr && leafValues != nullptr && sqrDistances != nullptr);
+	ocean_assert(leafSize >= 1 && leafSize <= size_t(maximalLeafSizeLimit_));
+
+	// we determine the distances for four leaf values at once, we avoid fused multiply-add instructions to get the same results as the scalar implementation
 
-	typename SquareValueTyper<T>::Type ssd = 0;
+	size_t n = 0;
 
-	for (size_t n = 0; n < dimension_; ++n)
+	for (; n + 4 <= leafSize; n += 4)
 	{
-		ssd += sqr(first[n] - second[n]);
+		float32x4_t sqrDistances_f_32x4 = vdupq_n_f32(0.0f);
+
+		for (unsigned int d = 0u; d < dimension; ++d)
+		{
+			const float32x4_t difference_f_32x4 = vsubq_f32(vdupq_n_f32(value[d]), vld1q_f32(leafValues + d * leafSize + n));
+			sqrDistances_f_32x4 = vaddq_f32(sqrDistances_f_32x4, vmulq_f32(difference_f_32x4, difference_f_32x4));
+		}
+
+		vst1q_f32(sqrDistances + n, sqrDistances_f_32x4);
 	}
 
-	return ssd;
+	for (; n < leafSize; ++n)
+	{
+		float sqrDistance = 0.0f;
+
+		for (unsigned int d = 0u; d < dimension; ++d)
+		{
+			sqrDistance += sqr(value[d] - leafValues[d * leafSize + n]);
+		}
+
+		sqrDistances[n] = sqrDistance;
+	}
 }
 
+#endif // OCEAN_HARDWARE_SSE_VERSION >= 20, OCEAN_HARDWARE_NEON_VERSION >= 10
+
 }
 
 #endif // META_OCEAN_BASE_KD_TREE_H
@@ -113,6 +113,10 @@ CameraCalibrator::ImageResult CameraCalibrator::handleImage(const size_t imageId
 		return IR_BOARD_WAS_NOT_DETECTED;
 	}
 
+	// the random generator is seeded with the image id, so that the result for an image does not depend on the images which have been handled before
+
+	randomGenerator_ = RandomGenerator((unsigned int)(imageId));
+
 	HomogenousMatrix4 board_T_initialCamera(false);
 	Indices32 usedInitialMarkerCandidateIndices;
 
@@ -343,7 +347,162 @@ CameraCalibrator::ImageResult CameraCalibrator::handleImage(const size_t imageId
 	return IR_BOARD_WAS_DETECTED;
 }
 
-bool CameraCalibrator::finalize(bool& needAdditionalIteration)
+size_t CameraCalibrator::handleImages(const Frame* frames, const size_t* imageIds, const size_t numberImages, ImageResult* imageResults, Worker* worker)
+{
+	ocean_assert(frames != nullptr && imageIds != nullptr);
+	ocean_assert(numberImages >= 1);
+
+	ocean_assert(calibrationStage_ != CS_UNKNOWN);
+	if (calibrationStage_ == CS_UNKNOWN || numberImages == 0)
+	{
+		return 0;
+	}
+
+	std::vector<ImageResult> localImageResults(numberImages, IR_ERROR);
+	CalibrationBoardObservations imageObservations(numberImages);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &CameraCalibrator::handleImagesSubset, frames, imageIds, localImageResults.data(), imageObservations.data(), 0u, 0u), 0u, (unsigned int)(numberImages), 4u, 5u, 1u);
+	}
+	else
+	{
+		handleImagesSubset(frames, imageIds, localImageResults.data(), imageObservations.data(), 0u, (unsigned int)(numberImages));
+	}
+
+	size_t detectedImages = 0;
+
+	for (size_t nImage = 0; nImage < numberImages; ++nImage)
+	{
+		if (localImageResults[nImage] == IR_BOARD_WAS_DETECTED)
+		{
+			CalibrationBoardObservation& observation = imageObservations[nImage];
+
+			for (const CalibrationBoardObservation& existingObservation : observations_)
+			{
+				if (existingObservation.imageId() == observation.imageId())
+				{
+					ocean_assert(false && "This should never happen!");
+					localImageResults[nImage] = IR_ERROR;
+					break;
+				}
+			}
+
+			if (localImageResults[nImage] == IR_BOARD_WAS_DETECTED)
+			{
+				observations_.emplace_back(std::move(observation));
+				++detectedImages;
+			}
+		}
+
+		if (imageResults != nullptr)
+		{
+			imageResults[nImage] = localImageResults[nImage];
+		}
+	}
+
+	return detectedImages;
+}
+
+size_t CameraCalibrator::removeRedundantObservations(const unsigned int expectedCoverage)
+{
+	ocean_assert(expectedCoverage >= 1u);
+
+	if (observations_.size() <= 1)
+	{
+		return 0;
+	}
+
+	Indices32 coveredBins;
+
+	for (const CalibrationBoardObservation& observation : observations_)
+	{
+		const Geometry::SpatialDistribution::OccupancyArray& occupancyArray = observation.occupancyArray();
+
+		if (coveredBins.empty())
+		{
+			coveredBins.resize(occupancyArray.bins(), 0u);
+		}
+
+		if (occupancyArray.bins() != coveredBins.size())
+		{
+			ocean_assert(false && "All observations must be based on the same camera resolution!");
+			return 0;
+		}
+	}
+
+	std::vector<uint8_t> selectedObservations(observations_.size(), 0u);
+
+	while (true)
+	{
+		// we select the observation which covers most of the bins which are not yet covered often enough
+
+		size_t bestObservationIndex = size_t(-1);
+		unsigned int bestAdditionalBins = 0u;
+
+		for (size_t nObservation = 0; nObservation < observations_.size(); ++nObservation)
+		{
+			if (selectedObservations[nObservation] != 0u)
+			{
+				continue;
+			}
+
+			const Geometry::SpatialDistribution::OccupancyArray& occupancyArray = observations_[nObservation].occupancyArray();
+
+			unsigned int additionalBins = 0u;
+
+			for (unsigned int nBin = 0u; nBin < occupancyArray.bins(); ++nBin)
+			{
+				if (occupancyArray[nBin] && coveredBins[nBin] < expectedCoverage)
+				{
+					++additionalBins;
+				}
+			}
+
+			if (additionalBins > bestAdditionalBins)
+			{
+				bestAdditionalBins = additionalBins;
+				bestObservationIndex = nObservation;
+			}
+		}
+
+		if (bestAdditionalBins == 0u)
+		{
+			break;
+		}
+
+		selectedObservations[bestObservationIndex] = 1u;
+
+		const Geometry::SpatialDistribution::OccupancyArray& occupancyArray = observations_[bestObservationIndex].occupancyArray();
+
+		for (unsigned int nBin = 0u; nBin < occupancyArray.bins(); ++nBin)
+		{
+			if (occupancyArray[nBin])
+			{
+				++coveredBins[nBin];
+			}
+		}
+	}
+
+	CalibrationBoardObservations remainingObservations;
+	remainingObservations.reserve(observations_.size());
+
+	for (size_t nObservation = 0; nObservation < observations_.size(); ++nObservation)
+	{
+		if (selectedObservations[nObservation] != 0u)
+		{
+			remainingObservations.emplace_back(std::move(observations_[nObservation]));
+		}
+	}
+
+	const size_t removedObservations = observations_.size() - remainingObservations.size();
+
+	observations_ = std::move(remainingObservations);
+
+	return removedObservations;
+}
+
+bool CameraCalibrator::finalize(bool& needAdditionalIteration, Worker* worker)
 {
 	needAdditionalIteration = false;
 
@@ -369,7 +528,7 @@ bool CameraCalibrator::finalize(bool& needAdditionalIteration)
 		Scalar initialError = Numeric::maxValue();
 		Scalar finalError = Numeric::maxValue();
 
-		camera_ = CameraCalibrator::determinePreciseCamera(observations_.data(), observations_.size(), optimizationStrategy, &board_T_optimizedCameras, Geometry::Estimator::ET_SQUARE, startWithFocalLength, distortionRestrictionFactor, &initialError, &finalError);
+		camera_ = CameraCalibrator::determinePreciseCamera(observations_.data(), observations_.size(), optimizationStrategy, &board_T_optimizedCameras, Geometry::Estimator::ET_SQUARE, startWithFocalLength, distortionRestrictionFactor, &initialError, &finalError, worker);
 
 		if (!camera_)
 		{
@@ -434,6 +593,30 @@ size_t CameraCalibrator::numberCorrespondences() const
 	return result;
 }
 
+void CameraCalibrator::handleImagesSubset(const Frame* frames, const size_t* imageIds, ImageResult* imageResults, CalibrationBoardObservation* imageObservations, const unsigned int firstImage, const unsigned int numberImages) const
+{
+	ocean_assert(frames != nullptr && imageIds != nullptr && imageResults != nullptr && imageObservations != nullptr);
+
+	// the calibrator holds intermediate data for the image which is currently handled, so that each subset needs an own copy
+
+	CameraCalibrator calibrator(metricCalibrationBoard_, initialCameraProperties_);
+	calibrator.calibrationStage_ = calibrationStage_;
+	calibrator.camera_ = camera_;
+
+	for (unsigned int nImage = firstImage; nImage < firstImage + numberImages; ++nImage)
+	{
+		imageResults[nImage] = calibrator.handleImage(imageIds[nImage], frames[nImage]);
+
+		if (imageResults[nImage] == IR_BOARD_WAS_DETECTED)
+		{
+			ocean_assert(!calibrator.observations_.empty());
+
+			imageObservations[nImage] = std::move(calibrator.observations_.back());
+			calibrator.observations_.pop_back();
+		}
+	}
+}
+
 bool CameraCalibrator::determineInitialPoseWithValidMarkerCandidates(const AnyCamera& camera, const Points& points, HomogenousMatrix4& board_T_camera, Indices32& usedMarkerCandidateIndices) const
 {
 	ocean_assert(camera.isValid());
@@ -914,7 +1097,7 @@ SharedAnyCamera CameraCalibrator::determineInitialCameraFieldOfView(const unsign
 	return nullptr;
 }
 
-SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const Geometry::NonLinearOptimizationCamera::OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras, const Geometry::Estimator::EstimatorType estimatorType, const bool startWithFocalLength, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError)
+SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const Geometry::NonLinearOptimizationCamera::OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras, const Geometry::Estimator::EstimatorType estimatorType, const bool startWithFocalLength, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError, Worker* worker)
 {
 	ocean_assert(observations != nullptr && numberObservations >= 1);
 	ocean_assert(optimizationStrategy != Geometry::NonLinearOptimizationCamera::OS_INVALID);
@@ -922,7 +1105,43 @@ SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardO
 	RandomGenerator randomGenerator;
 
 	SharedAnyCamera camera;
-	HomogenousMatrices4 world_T_cameras;
+
+	const CalibrationBoardObservation& firstObservation = observations[0];
+
+	if (startWithFocalLength)
+	{
+		if (firstObservation.camera()->name() == AnyCameraFisheye::WrappedCamera::name())
+		{
+			const AnyCameraFisheye& anyCameraFisheye = (const AnyCameraFisheye&)(*firstObservation.camera());
+			const FisheyeCamera& fisheyeCamera = anyCameraFisheye.actualCamera();
+
+			camera = std::make_shared<AnyCameraFisheye>(FisheyeCamera(fisheyeCamera.width(), fisheyeCamera.height(), fisheyeCamera.fovX()));
+		}
+		else
+		{
+			ocean_assert(firstObservation.camera()->name() == AnyCameraPinhole::WrappedCamera::name());
+
+			const AnyCameraPinhole& anyCameraPinhole = (const AnyCameraPinhole&)(*firstObservation.camera());
+			const PinholeCamera& pinholeCamera = anyCameraPinhole.actualCamera();
+
+			camera = std::make_shared<AnyCameraPinhole>(PinholeCamera(pinholeCamera.width(), pinholeCamera.height(), pinholeCamera.fovX()));
+		}
+	}
+	else
+	{
+		camera = firstObservation.camera();
+	}
+
+	HomogenousMatrices4 world_T_cameras(numberObservations);
+
+	if (worker != nullptr && numberObservations > 1)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&CameraCalibrator::determineInitialCameraPosesSubset, (const AnyCamera*)(camera.get()), observations, &randomGenerator, world_T_cameras.data(), 0u, 0u), 0u, (unsigned int)(numberObservations), 4u, 5u, 1u);
+	}
+	else
+	{
+		determineInitialCameraPosesSubset(camera.get(), observations, &randomGenerator, world_T_cameras.data(), 0u, (unsigned int)(numberObservations));
+	}
 
 	std::vector<Vectors3> objectPointGroups;
 	std::vector<Vectors2> imagePointGroups;
@@ -934,44 +1153,6 @@ SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardO
 	{
 		const CalibrationBoardObservation& observation = observations[nObservation];
 
-		if (!camera)
-		{
-			if (startWithFocalLength)
-			{
-				if (observation.camera()->name() == AnyCameraFisheye::WrappedCamera::name())
-				{
-					const AnyCameraFisheye& anyCameraFisheye = (const AnyCameraFisheye&)(*observation.camera());
-					const FisheyeCamera& fisheyeCamera = anyCameraFisheye.actualCamera();
-
-					camera = std::make_shared<AnyCameraFisheye>(FisheyeCamera(fisheyeCamera.width(), fisheyeCamera.height(), fisheyeCamera.fovX()));
-				}
-				else
-				{
-					ocean_assert(observation.camera()->name() == AnyCameraPinhole::WrappedCamera::name());
-
-					const AnyCameraPinhole& anyCameraPinhole = (const AnyCameraPinhole&)(*observation.camera());
-					const PinholeCamera& pinholeCamera = anyCameraPinhole.actualCamera();
-
-					camera = std::make_shared<AnyCameraPinhole>(PinholeCamera(pinholeCamera.width(), pinholeCamera.height(), pinholeCamera.fovX()));
-				}
-			}
-			else
-			{
-				camera = observation.camera();
-			}
-		}
-
-		HomogenousMatrix4 world_T_camera;
-		if (Geometry::RANSAC::p3p(*camera, ConstArrayAccessor<Vector3>(observation.objectPoints()), ConstArrayAccessor<Vector2>(observation.imagePoints()), randomGenerator, world_T_camera))
-		{
-			world_T_cameras.push_back(world_T_camera);
-		}
-		else
-		{
-			ocean_assert(false && "This should never happen!");
-			world_T_cameras.push_back(observation.board_T_camera());
-		}
-
 		objectPointGroups.push_back(observation.objectPoints());
 		imagePointGroups.push_back(observation.imagePoints());
 	}
@@ -984,7 +1165,7 @@ SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardO
 	constexpr unsigned int iterations = 100u;
 
 	Scalars debugIntermediateErrors;
-	if (!Geometry::NonLinearOptimizationCamera::optimizeCameraPoses(*camera, ConstArrayAccessor<HomogenousMatrix4>(world_T_cameras), ConstArrayAccessor<Vectors3>(objectPointGroups), ConstArrayAccessor<Vectors2>(imagePointGroups), optimizedCamera, &optimizedPoses, iterations, optimizationStrategy, estimatorType, Scalar(0.001), Scalar(5), true, distortionRestrictionFactor, initialError, finalError, &debugIntermediateErrors))
+	if (!Geometry::NonLinearOptimizationCamera::optimizeCameraPoses(*camera, ConstArrayAccessor<HomogenousMatrix4>(world_T_cameras), ConstArrayAccessor<Vectors3>(objectPointGroups), ConstArrayAccessor<Vectors2>(imagePointGroups), optimizedCamera, &optimizedPoses, iterations, optimizationStrategy, estimatorType, Scalar(0.001), Scalar(5), true, distortionRestrictionFactor, initialError, finalError, &debugIntermediateErrors, worker))
 	{
 		return nullptr;
 	}
@@ -1000,6 +1181,27 @@ SharedAnyCamera CameraCalibrator::determinePreciseCamera(const CalibrationBoardO
 	return optimizedCamera;
 }
 
+void CameraCalibrator::determineInitialCameraPosesSubset(const AnyCamera* camera, const CalibrationBoardObservation* observations, RandomGenerator* randomGenerator, HomogenousMatrix4* world_T_cameras, const unsigned int firstObservation, const unsigned int numberObservations)
+{
+	ocean_assert(camera != nullptr && camera->isValid());
+	ocean_assert(observations != nullptr && randomGenerator != nullptr && world_T_cameras != nullptr);
+
+	RandomGenerator localRandomGenerator(*randomGenerator);
+
+	for (unsigned int nObservation = firstObservation; nObservation < firstObservation + numberObservations; ++nObservation)
+	{
+		const CalibrationBoardObservation& observation = observations[nObservation];
+
+		HomogenousMatrix4& world_T_camera = world_T_cameras[nObservation];
+
+		if (!Geometry::RANSAC::p3p(*camera, ConstArrayAccessor<Vector3>(observation.objectPoints()), ConstArrayAccessor<Vector2>(observation.imagePoints()), localRandomGenerator, world_T_camera))
+		{
+			ocean_assert(false && "This should never happen!");
+			world_T_camera = observation.board_T_camera();
+		}
+	}
+}
+
 }
 
 }
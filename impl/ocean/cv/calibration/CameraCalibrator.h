@@ -141,6 +141,7 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 
 		/**
 		 * Handles a new image.
+		 * The result for an image depends on the image and its id only, but not on the images which have been handled before.
 		 * @param imageId The unique id of the image, must be valid
 		 * @param frame The frame to handle, must be valid
 		 * @param worker Optional worker object to distribute the computation
@@ -148,14 +149,37 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 		 */
 		ImageResult handleImage(const size_t imageId, const Frame& frame, Worker* worker = nullptr);
 
+		/**
+		 * Handles a batch of new images.
+		 * The calibration board is detected in the individual images in parallel, the resulting observations are added in the order of the provided images.<br>
+		 * The result is identical to calling handleImage() for each image individually, e.g., when calibrating with hundreds of offline images.
+		 * @param frames The frames to handle, must be valid
+		 * @param imageIds The unique ids of the images, one for each frame, must be valid
+		 * @param numberImages The number of images to handle, with range [1, infinity)
+		 * @param imageResults Optional resulting results of the image handling, one for each frame, nullptr if not of interest
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The number of images in which the calibration board was detected, with range [0, numberImages]
+		 */
+		size_t handleImages(const Frame* frames, const size_t* imageIds, const size_t numberImages, ImageResult* imageResults = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Removes redundant observations which do not improve the image coverage of all observations.
+		 * The observations are selected greedily, starting with the observation covering most image bins which are not yet covered by the expected number of observations.<br>
+		 * Observations which do not cover any additional image bin are removed; the order of the remaining observations is not changed.
+		 * @param expectedCoverage The number of observations which is expected to cover each image bin, with range [1, infinity)
+		 * @return The number of observations which have been removed
+		 */
+		size_t removeRedundantObservations(const unsigned int expectedCoverage = 10u);
+
 		/**
 		 * Finalizes the calibration and determines the precise camera profile.
 		 * This function should be called after all images have been handled.
 		 * If the calibration stage transitions from CS_DETERMINE_INITIAL_CAMERA_FOV to CS_CALIBRATE_CAMERA, the observations will be cleared and an additional iteration is required.
 		 * @param needAdditionalIteration True, if the calibration requires an additional iteration (all images need to be processed again); False, if the calibration is complete
+		 * @param worker Optional worker object to distribute the computation
 		 * @return True, if succeeded
 		 */
-		bool finalize(bool& needAdditionalIteration);
+		bool finalize(bool& needAdditionalIteration, Worker* worker = nullptr);
 
 		/**
 		 * Returns the current calibration stage.
@@ -202,6 +226,18 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 
 	protected:
 
+		/**
+		 * Handles a subset of a batch of new images.
+		 * Each subset uses an individual copy of this calibrator so that the subsets can be handled concurrently.
+		 * @param frames The frames to handle, must be valid
+		 * @param imageIds The unique ids of the images, one for each frame, must be valid
+		 * @param imageResults The resulting results of the image handling, one for each frame, must be valid
+		 * @param imageObservations The resulting observations, one for each frame, must be valid
+		 * @param firstImage The first image to be handled
+		 * @param numberImages The number of images to be handled
+		 */
+		void handleImagesSubset(const Frame* frames, const size_t* imageIds, ImageResult* imageResults, CalibrationBoardObservation* imageObservations, const unsigned int firstImage, const unsigned int numberImages) const;
+
 		/**
 		 * Determines the initial camera pose based on marker candidates with known marker coordinate.
 		 * @param camera The camera profile defining the projection, must be valid
@@ -280,9 +316,21 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 		 * @param distortionRestrictionFactor The factor used to constrain higher-order distortion parameters based on lower-order ones during optimization, with range [0, infinity); 0 to disable restriction
 		 * @param initialError Optional resulting initial projection error, with range [0, infinity)
 		 * @param finalError Optional resulting final projection error, with range [0, infinity)
+		 * @param worker Optional worker object to distribute the computation
 		 * @return The resulting precise camera profile, nullptr if the camera profile could not be determined
 		 */
-		static SharedAnyCamera determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras = nullptr, const Geometry::Estimator::EstimatorType estimatorType = Geometry::Estimator::ET_SQUARE, const bool startWithFocalLength = true, const Scalar distortionRestrictionFactor = Scalar(2), Scalar* initialError = nullptr, Scalar* finalError = nullptr);
+		static SharedAnyCamera determinePreciseCamera(const CalibrationBoardObservation* observations, const size_t numberObservations, const OptimizationStrategy optimizationStrategy, HomogenousMatrices4* board_T_optimizedCameras = nullptr, const Geometry::Estimator::EstimatorType estimatorType = Geometry::Estimator::ET_SQUARE, const bool startWithFocalLength = true, const Scalar distortionRestrictionFactor = Scalar(2), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Determines the initial camera poses for a subset of observations.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param observations The observations of the calibration board, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_cameras The resulting camera poses, one for each observation, must be valid
+		 * @param firstObservation The first observation to be handled
+		 * @param numberObservations The number of observations to be handled
+		 */
+		static void determineInitialCameraPosesSubset(const AnyCamera* camera, const CalibrationBoardObservation* observations, RandomGenerator* randomGenerator, HomogenousMatrix4* world_T_cameras, const unsigned int firstObservation, const unsigned int numberObservations);
 
 	protected:
 
@@ -304,7 +352,7 @@ class OCEAN_CV_CALIBRATION_EXPORT CameraCalibrator
 		/// The marker candidates which have been detected in the current image.
 		MarkerCandidates markerCandidates_;
 
-		/// The random generator to be used.
+		/// The random generator to be used, seeded with the id of the image which is currently handled.
 		mutable RandomGenerator randomGenerator_;
 
 		/// Reusable frame object to avoid memory re-allocations.
@@ -743,8 +743,21 @@ void PointDetector::detectPointCandidatesSubset(const Frame* yFrame, NonMaximumS
 	constexpr unsigned int simdBlockSize = 8u;
 	ocean_assert_and_suppress_unused(yFrame->width() >= filterSize_2 + simdBlockSize + filterSize_2, simdBlockSize);
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+	// the AVX2 implementation processes 16 pixels per iteration, narrow frames fall back to the SSE implementation
+	const bool useAVX2 = yFrame->width() >= filterSize_2 + simdBlockSize * 2u + filterSize_2;
+#endif
+
 	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
 	{
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+		if (useAVX2)
+		{
+			determinePointCandidatesRowAVX2Dual(y, yFrame->constrow<uint8_t>(y), nonMaximumSuppression, borderOffsets, numberBorderOffsets, filterSize, minimalDifference, maximalDifference);
+			continue;
+		}
+#endif
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
 		determinePointCandidatesRowSSEDual(y, yFrame->constrow<uint8_t>(y), nonMaximumSuppression, borderOffsets, numberBorderOffsets, filterSize, minimalDifference, maximalDifference);
 #elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
@@ -793,6 +806,11 @@ void PointDetector::createFilterResponseFrameSubset(const Frame* yFrame, Frame*
 	constexpr unsigned int simdBlockSize = 8u;
 	ocean_assert_and_suppress_unused(yFrame->width() >= filterSize_2 + simdBlockSize + filterSize_2, simdBlockSize);
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+	// the AVX2 implementation processes 16 pixels per iteration, narrow frames fall back to the SSE implementation
+	const bool useAVX2 = yFrame->width() >= filterSize_2 + simdBlockSize * 2u + filterSize_2;
+#endif
+
 	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
 	{
 		if (y < filterSize_2 || y >= yFrame->height() - filterSize_2)
@@ -803,6 +821,14 @@ void PointDetector::createFilterResponseFrameSubset(const Frame* yFrame, Frame*
 			continue;
 		}
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+		if (useAVX2)
+		{
+			createFilterResponseRowAVX2Dual(yFrame->constrow<uint8_t>(y), responseFrame->row<int32_t>(y), yFrame->width(), borderOffsets, numberBorderOffsets, filterSize, minimalDifference, maximalDifference);
+			continue;
+		}
+#endif
+
 #if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
 		createFilterResponseRowSSEDual(yFrame->constrow<uint8_t>(y), responseFrame->row<int32_t>(y), yFrame->width(), borderOffsets, numberBorderOffsets, filterSize, minimalDifference, maximalDifference);
 #elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
@@ -1581,6 +1607,224 @@ void PointDetector::determinePointCandidatesRowSSEDual(const unsigned int y, con
 	}
 }
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+void PointDetector::createFilterResponseRowAVX2Dual(const uint8_t* yRow, int32_t* responseRow, const unsigned int width, const uint32_t* borderOffsets, const size_t numberBorderOffsets, const unsigned int filterSize, const int32_t minimalDifference, const int32_t maximalDifference)
+{
+	ocean_assert(yRow != nullptr);
+	ocean_assert(responseRow != nullptr);
+	ocean_assert(borderOffsets != nullptr);
+	ocean_assert(numberBorderOffsets >= 1);
+	ocean_assert(maximalDifference >= 0);
+
+	constexpr unsigned int blockSize = 16u;
+
+	const unsigned int filterSize_2 = filterSize / 2u;
+	ocean_assert(width >= filterSize_2 + blockSize + filterSize_2);
+
+	// the squared difference of two 8-bit values is at most 255^2 and thus fits into an unsigned 16-bit value
+	const int32_t maxSqrDifference = std::min(maximalDifference, 255) * std::min(maximalDifference, 255);
+
+	// response pixels close to the left image border
+	memset(responseRow, 0x00, filterSize_2 * sizeof(int32_t));
+
+	const uint8_t* yRowCenter = yRow + filterSize_2;
+	int32_t* responseRowCenter = responseRow + filterSize_2;
+
+	const unsigned int coreWidth = width - filterSize_2 * 2u;
+
+	const __m256i minDiffMinus1_s_16x16 = _mm256_set1_epi16(int16_t(minimalDifference - 1));
+	const __m256i negMinDiff_s_16x16 = _mm256_set1_epi16(int16_t(-minimalDifference));
+	const __m256i maxSqrDiff_u_16x16 = _mm256_set1_epi16(int16_t(uint16_t(maxSqrDifference)));
+
+	for (unsigned int x = 0u; x < coreWidth; x += blockSize)
+	{
+		if (x + blockSize > coreWidth)
+		{
+			ocean_assert(x >= blockSize && coreWidth > blockSize);
+			const unsigned int newX = coreWidth - blockSize;
+
+			ocean_assert(x > newX);
+			const unsigned int offset = x - newX;
+
+			yRowCenter -= offset;
+			responseRowCenter -= offset;
+
+			ocean_assert(!(x + blockSize < coreWidth));
+		}
+
+		const __m256i center_s_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)yRowCenter));
+
+		// track validity for black dots (positive diff) and white dots (negative diff), both share the same sum of squared differences
+		__m256i validDark_s_16x16 = _mm256_set1_epi16(-1);
+		__m256i validBright_s_16x16 = _mm256_set1_epi16(-1);
+		__m256i sumSqrLow_s_32x8 = _mm256_setzero_si256();
+		__m256i sumSqrHigh_s_32x8 = _mm256_setzero_si256();
+
+		const uint8_t* yBorderData = yRowCenter - borderOffsets[0];
+
+		for (size_t nOffset = 0; nOffset < numberBorderOffsets; ++nOffset)
+		{
+			if (nOffset != 0)
+			{
+				yBorderData += borderOffsets[nOffset];
+			}
+
+			const __m256i border_s_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)yBorderData));
+			const __m256i diff_s_16x16 = _mm256_sub_epi16(border_s_16x16, center_s_16x16);
+
+			// dark dots: diff >= minimalDifference, bright dots: diff <= -minimalDifference
+			validDark_s_16x16 = _mm256_and_si256(validDark_s_16x16, _mm256_cmpgt_epi16(diff_s_16x16, minDiffMinus1_s_16x16));
+			validBright_s_16x16 = _mm256_and_si256(validBright_s_16x16, _mm256_cmpgt_epi16(negMinDiff_s_16x16, diff_s_16x16));
+
+			// early exit if all 16 pixels have failed both threshold checks
+			const __m256i anyValid_s_16x16 = _mm256_or_si256(validDark_s_16x16, validBright_s_16x16);
+			if (_mm256_testz_si256(anyValid_s_16x16, anyValid_s_16x16))
+			{
+				break;
+			}
+
+			// square the differences in 16 bit and clamp to maxSqrDifference
+			const __m256i sqr_u_16x16 = _mm256_min_epu16(_mm256_mullo_epi16(diff_s_16x16, diff_s_16x16), maxSqrDiff_u_16x16);
+
+			sumSqrLow_s_32x8 = _mm256_add_epi32(sumSqrLow_s_32x8, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(sqr_u_16x16)));
+			sumSqrHigh_s_32x8 = _mm256_add_epi32(sumSqrHigh_s_32x8, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(sqr_u_16x16, 1)));
+		}
+
+		// expand valid masks from 16-bit to 32-bit
+		const __m256i validDarkLow_s_32x8 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(validDark_s_16x16));
+		const __m256i validDarkHigh_s_32x8 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(validDark_s_16x16, 1));
+		const __m256i validBrightLow_s_32x8 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(validBright_s_16x16));
+		const __m256i validBrightHigh_s_32x8 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(validBright_s_16x16, 1));
+
+		// response = (validDark ? sumSqr : 0) - (validBright ? sumSqr : 0), each pixel can only be one or the other (or neither)
+		_mm256_storeu_si256((__m256i*)(responseRowCenter + 0), _mm256_sub_epi32(_mm256_and_si256(sumSqrLow_s_32x8, validDarkLow_s_32x8), _mm256_and_si256(sumSqrLow_s_32x8, validBrightLow_s_32x8)));
+		_mm256_storeu_si256((__m256i*)(responseRowCenter + 8), _mm256_sub_epi32(_mm256_and_si256(sumSqrHigh_s_32x8, validDarkHigh_s_32x8), _mm256_and_si256(sumSqrHigh_s_32x8, validBrightHigh_s_32x8)));
+
+		yRowCenter += blockSize;
+		responseRowCenter += blockSize;
+	}
+
+	// response pixels close to the right image border
+	memset(responseRowCenter, 0x00, filterSize_2 * sizeof(int32_t));
+}
+
+void PointDetector::determinePointCandidatesRowAVX2Dual(const unsigned int y, const uint8_t* yRow, NonMaximumSuppressionVote* nonMaximumSuppression, const uint32_t* borderOffsets, const size_t numberBorderOffsets, const unsigned int filterSize, const int32_t minimalDifference, const int32_t maximalDifference)
+{
+	ocean_assert(yRow != nullptr);
+	ocean_assert(nonMaximumSuppression != nullptr);
+	ocean_assert(borderOffsets != nullptr);
+	ocean_assert(numberBorderOffsets >= 1);
+	ocean_assert(maximalDifference >= 0);
+
+	constexpr unsigned int blockSize = 16u;
+
+	const unsigned int filterSize_2 = filterSize / 2u;
+	ocean_assert(nonMaximumSuppression->width() >= filterSize_2 + blockSize + filterSize_2);
+
+	// the squared difference of two 8-bit values is at most 255^2 and thus fits into an unsigned 16-bit value
+	const int32_t maxSqrDifference = std::min(maximalDifference, 255) * std::min(maximalDifference, 255);
+
+	const uint8_t* yRowCenter = yRow + filterSize_2;
+
+	const unsigned int coreWidth = nonMaximumSuppression->width() - filterSize_2 * 2u;
+
+	const __m256i minDiffMinus1_s_16x16 = _mm256_set1_epi16(int16_t(minimalDifference - 1));
+	const __m256i negMinDiff_s_16x16 = _mm256_set1_epi16(int16_t(-minimalDifference));
+	const __m256i maxSqrDiff_u_16x16 = _mm256_set1_epi16(int16_t(uint16_t(maxSqrDifference)));
+
+	int32_t responseBlock[blockSize];
+
+	for (unsigned int x = 0u; x < coreWidth; x += blockSize)
+	{
+		if (x + blockSize > coreWidth)
+		{
+			// the last iteration will not fit into the output frame,
+			// so we simply shift x left by some pixels (at most 15) and we will calculate some pixels again
+
+			ocean_assert(x >= blockSize && coreWidth > blockSize);
+			const unsigned int newX = coreWidth - blockSize;
+
+			ocean_assert(x > newX);
+			const unsigned int offset = x - newX;
+
+			yRowCenter -= offset;
+			x = newX;
+
+			nonMaximumSuppression->removeCandidatesRightFrom(filterSize_2 + x, y);
+
+			// the for loop will stop after this iteration
+			ocean_assert(!(x + blockSize < coreWidth));
+		}
+
+		const __m256i center_s_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)yRowCenter));
+
+		// track validity for black dots (positive diff) and white dots (negative diff), both share the same sum of squared differences
+		__m256i validDark_s_16x16 = _mm256_set1_epi16(-1);
+		__m256i validBright_s_16x16 = _mm256_set1_epi16(-1);
+		__m256i sumSqrLow_s_32x8 = _mm256_setzero_si256();
+		__m256i sumSqrHigh_s_32x8 = _mm256_setzero_si256();
+
+		const uint8_t* yBorderData = yRowCenter - borderOffsets[0];
+
+		bool anyValid = true;
+
+		for (size_t nOffset = 0; nOffset < numberBorderOffsets; ++nOffset)
+		{
+			if (nOffset != 0)
+			{
+				yBorderData += borderOffsets[nOffset];
+			}
+
+			const __m256i border_s_16x16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)yBorderData));
+			const __m256i diff_s_16x16 = _mm256_sub_epi16(border_s_16x16, center_s_16x16);
+
+			// dark dots: diff >= minimalDifference, bright dots: diff <= -minimalDifference
+			validDark_s_16x16 = _mm256_and_si256(validDark_s_16x16, _mm256_cmpgt_epi16(diff_s_16x16, minDiffMinus1_s_16x16));
+			validBright_s_16x16 = _mm256_and_si256(validBright_s_16x16, _mm256_cmpgt_epi16(negMinDiff_s_16x16, diff_s_16x16));
+
+			// early exit if all 16 pixels have failed both threshold checks
+			const __m256i anyValid_s_16x16 = _mm256_or_si256(validDark_s_16x16, validBright_s_16x16);
+			if (_mm256_testz_si256(anyValid_s_16x16, anyValid_s_16x16))
+			{
+				anyValid = false;
+				break;
+			}
+
+			// square the differences in 16 bit and clamp to maxSqrDifference
+			const __m256i sqr_u_16x16 = _mm256_min_epu16(_mm256_mullo_epi16(diff_s_16x16, diff_s_16x16), maxSqrDiff_u_16x16);
+
+			sumSqrLow_s_32x8 = _mm256_add_epi32(sumSqrLow_s_32x8, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(sqr_u_16x16)));
+			sumSqrHigh_s_32x8 = _mm256_add_epi32(sumSqrHigh_s_32x8, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(sqr_u_16x16, 1)));
+		}
+
+		if (anyValid)
+		{
+			// expand valid masks from 16-bit to 32-bit
+			const __m256i validDarkLow_s_32x8 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(validDark_s_16x16));
+			const __m256i validDarkHigh_s_32x8 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(validDark_s_16x16, 1));
+			const __m256i validBrightLow_s_32x8 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(validBright_s_16x16));
+			const __m256i validBrightHigh_s_32x8 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(validBright_s_16x16, 1));
+
+			// response = (validDark ? sumSqr : 0) - (validBright ? sumSqr : 0), each pixel can only be one or the other (or neither)
+			_mm256_storeu_si256((__m256i*)(responseBlock + 0), _mm256_sub_epi32(_mm256_and_si256(sumSqrLow_s_32x8, validDarkLow_s_32x8), _mm256_and_si256(sumSqrLow_s_32x8, validBrightLow_s_32x8)));
+			_mm256_storeu_si256((__m256i*)(responseBlock + 8), _mm256_sub_epi32(_mm256_and_si256(sumSqrHigh_s_32x8, validDarkHigh_s_32x8), _mm256_and_si256(sumSqrHigh_s_32x8, validBrightHigh_s_32x8)));
+
+			for (unsigned int n = 0u; n < blockSize; ++n)
+			{
+				if (responseBlock[n] != 0)
+				{
+					nonMaximumSuppression->addCandidate(filterSize_2 + x + n, y, responseBlock[n]);
+				}
+			}
+		}
+
+		yRowCenter += blockSize;
+	}
+}
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
 
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
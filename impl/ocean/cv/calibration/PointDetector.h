@@ -23,6 +23,9 @@
 namespace Ocean
 {
 
+// Forward declaration for test library.
+namespace Test { namespace TestCV { namespace TestCalibration { class TestPointDetector; } } }
+
 namespace CV
 {
 
@@ -40,6 +43,7 @@ namespace Calibration
 class OCEAN_CV_CALIBRATION_EXPORT PointDetector
 {
 	friend class CalibrationDebugElements;
+	friend class Test::TestCV::TestCalibration::TestPointDetector;
 
 	public:
 
@@ -438,6 +442,38 @@ class OCEAN_CV_CALIBRATION_EXPORT PointDetector
 
 #endif // OCEAN_HARDWARE_SSE_VERSION >= 41
 
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+		/**
+		 * Creates a filter response row using AVX2 SIMD instructions (dual-sign: both dark and bright points).
+		 * This is an optimized implementation that processes 16 pixels per iteration, the results are identical to createFilterResponseRowSSEDual().
+		 * @param yRow Pointer to the beginning of the row in the grayscale frame, must be valid
+		 * @param responseRow The resulting response row, must be valid
+		 * @param width The width of the row, in pixels, with range [filterSize / 2 + 16 + filterSize / 2, infinity)
+		 * @param borderOffsets The pre-computed 1D border offsets, must be valid
+		 * @param numberBorderOffsets The number of border offsets, with range [1, infinity)
+		 * @param filterSize The size of the detection filter, in pixels, must be odd, with range [3, infinity)
+		 * @param minimalDifference The minimal intensity difference between the center pixel and each border pixel, with range [1, infinity)
+		 * @param maximalDifference The maximal intensity difference used for clamping the squared differences, with range [minimalDifference, infinity)
+		 */
+		static void createFilterResponseRowAVX2Dual(const uint8_t* yRow, int32_t* responseRow, const unsigned int width, const uint32_t* borderOffsets, const size_t numberBorderOffsets, const unsigned int filterSize, const int32_t minimalDifference, const int32_t maximalDifference);
+
+		/**
+		 * Determines point candidates for a single row using AVX2 SIMD instructions (dual-sign: both dark and bright points).
+		 * This is an optimized implementation that processes 16 pixels per iteration, the results are identical to determinePointCandidatesRowSSEDual().
+		 * @param y The row index, with range [filterSize / 2, height - filterSize / 2)
+		 * @param yRow Pointer to the beginning of the row in the grayscale frame, must be valid
+		 * @param nonMaximumSuppression The non-maximum suppression object to which detected candidates will be added, with width [filterSize / 2 + 16 + filterSize / 2, infinity), must be valid
+		 * @param borderOffsets The pre-computed 1D border offsets, must be valid
+		 * @param numberBorderOffsets The number of border offsets, with range [1, infinity)
+		 * @param filterSize The size of the detection filter, in pixels, must be odd, with range [3, infinity)
+		 * @param minimalDifference The minimal intensity difference between the center pixel and each border pixel, with range [1, infinity)
+		 * @param maximalDifference The maximal intensity difference used for clamping the squared differences, with range [minimalDifference, infinity)
+		 */
+		static void determinePointCandidatesRowAVX2Dual(const unsigned int y, const uint8_t* yRow, NonMaximumSuppressionVote* nonMaximumSuppression, const uint32_t* borderOffsets, const size_t numberBorderOffsets, const unsigned int filterSize, const int32_t minimalDifference, const int32_t maximalDifference);
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+
 #if defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
 
 		/**
@@ -89,13 +89,20 @@ void FinderPatternDetector::detectFinderPatternsSubset(const uint8_t* const yFra
 
 	FinderPatterns localFinderPatterns;
 
+	Memory toBlackCandidates = Memory::create<uint8_t>(width);
+	Memory toWhiteCandidates = Memory::create<uint8_t>(width);
+
 	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
 	{
-		detectFinderPatternInRow(yFrame, width, height, y, localFinderPatterns, paddingElements);
+		detectFinderPatternInRow(yFrame, width, height, y, localFinderPatterns, paddingElements, toBlackCandidates.data<uint8_t>(), toWhiteCandidates.data<uint8_t>());
 	}
 
 	if (localFinderPatterns.empty() == false)
 	{
+		// the patterns are sorted once for all rows, as the refined locations of the patterns do not need to follow the order of the rows
+
+		std::sort(localFinderPatterns.begin(), localFinderPatterns.end(), FinderPattern::comesBefore);
+
 		const OptionalScopedLock scopedLock(multiThreadLock);
 
 		ocean_assert(std::is_sorted(localFinderPatterns.begin(), localFinderPatterns.end(), FinderPattern::comesBefore));
@@ -107,16 +114,21 @@ void FinderPatternDetector::detectFinderPatternsSubset(const uint8_t* const yFra
 	}
 }
 
-void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int y, FinderPatterns& finderPatterns, const unsigned int paddingElements)
+void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int y, FinderPatterns& finderPatterns, const unsigned int paddingElements, uint8_t* const toBlackCandidates, uint8_t* const toWhiteCandidates)
 {
 	ocean_assert(yFrame != nullptr);
 	ocean_assert(width >= 15u && height >= 15u);
 	ocean_assert(y >= 7u && y < height - 7u);
+	ocean_assert(toBlackCandidates != nullptr && toWhiteCandidates != nullptr);
 
 	const unsigned int yFrameStrideElements = width + paddingElements;
 
 	const uint8_t* const yRow = yFrame + yFrameStrideElements * y;
 
+	// all transitions of the row are determined in one pass, the search for the individual segments skips pixels without transition
+
+	determineTransitionCandidates(yRow, width, toBlackCandidates, toWhiteCandidates);
+
 	// Scanning for the following 1D pattern: white, black, white, black, white, black, white
 	// Ratios:                                 >=1 :   1  :   1  :   3  :   1  :  1   :  >=1
 	// Segments:                                       1      2      3      4     5      6
@@ -130,11 +142,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 
 	// Start segment 1: find the first pixel of the first black segment
 
-	TransitionHistory history;
-	while (x < width && isTransitionToBlack(yRow + x, history) == false)
-	{
-		++x;
-	}
+	x = findTransition(toBlackCandidates, width, x);
 
 	if (x >= width)
 	{
@@ -149,11 +157,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		// Start segment 2: find the first pixel of the first white segment
 		if (segment_2_start_white == invalidSegmentStart)
 		{
-			history.reset();
-			while (x < width && isTransitionToWhite(yRow + x, history) == false)
-			{
-				++x;
-			}
+			x = findTransition(toWhiteCandidates, width, x);
 
 			if (x >= width)
 			{
@@ -172,11 +176,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 
 		// Start segment 3: find the first pixel of the second black segment (the big black square in the middle)
 
-		history.reset();
-		while (x < width && isTransitionToBlack(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition(toBlackCandidates, width, x);
 
 		if (x >= width)
 		{
@@ -211,11 +211,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 
 		// Start segment 4: find the first pixel of the second white segment
 
-		history.reset();
-		while (x < width && isTransitionToWhite(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition(toWhiteCandidates, width, x);
 
 		if (x >= width)
 		{
@@ -253,11 +249,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 
 		// Start segment 5: find the first pixel of the third black segment
 
-		history.reset();
-		while (x < width && isTransitionToBlack(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition(toBlackCandidates, width, x);
 
 		if (x == width)
 		{
@@ -303,11 +295,7 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 
 		// Start "segment 6": find the beginning of next white segment
 
-		history.reset();
-		while (x < width && isTransitionToWhite(yRow + x, history) == false)
-		{
-			++x;
-		}
+		x = findTransition(toWhiteCandidates, width, x);
 
 		if (x == width)
 		{
@@ -367,9 +355,125 @@ void FinderPatternDetector::detectFinderPatternInRow(const uint8_t* const yFrame
 		// Reset x as well
 		x = segment_2_start_white;
 	}
+}
+
+void FinderPatternDetector::determineTransitionCandidates(const uint8_t* const yRow, const unsigned int width, uint8_t* const toBlackCandidates, uint8_t* const toWhiteCandidates)
+{
+	ocean_assert(yRow != nullptr && width >= 1u);
+	ocean_assert(toBlackCandidates != nullptr && toWhiteCandidates != nullptr);
+
+	static_assert(numberTransitionWindows == 6u, "Invalid number of windows!");
+
+	// the intensity thresholds for the individual window sizes, identical to isTransitionToBlack() and isTransitionToWhite()
+	constexpr uint8_t thresholds[numberTransitionWindows] = {uint8_t(deltaThreshold), uint8_t(deltaThreshold), uint8_t(deltaThreshold * 5 / 4), uint8_t(deltaThreshold * 6 / 4), uint8_t(deltaThreshold * 7 / 4), uint8_t(deltaThreshold * 8 / 4)};
+
+	toBlackCandidates[0] = 0u;
+	toWhiteCandidates[0] = 0u;
+
+	unsigned int x = 1u;
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	// the first pixels have less left neighbors than windows
+	x = std::min(width, numberTransitionWindows);
+	determineTransitionCandidates(yRow, 1u, x, toBlackCandidates, toWhiteCandidates, thresholds);
+
+	const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+	while (x + 16u <= width)
+	{
+		const __m128i pixels_u_8x16 = _mm_loadu_si128((const __m128i*)(yRow + x));
+
+		__m128i toBlack_u_8x16 = _mm_setzero_si128();
+		__m128i toWhite_u_8x16 = _mm_setzero_si128();
+
+		for (unsigned int window = 0u; window < numberTransitionWindows; ++window)
+		{
+			const __m128i neighbors_u_8x16 = _mm_loadu_si128((const __m128i*)(yRow + x - 1u - window));
+
+			const __m128i threshold_u_8x16 = _mm_set1_epi8(char(thresholds[window]));
+			const __m128i bit_u_8x16 = _mm_set1_epi8(char(1u << window));
+
+			// the saturated differences are larger than the threshold if the remaining difference is not zero
+			const __m128i darker_u_8x16 = _mm_subs_epu8(_mm_subs_epu8(neighbors_u_8x16, pixels_u_8x16), threshold_u_8x16);
+			const __m128i brighter_u_8x16 = _mm_subs_epu8(_mm_subs_epu8(pixels_u_8x16, neighbors_u_8x16), threshold_u_8x16);
+
+			toBlack_u_8x16 = _mm_or_si128(toBlack_u_8x16, _mm_andnot_si128(_mm_cmpeq_epi8(darker_u_8x16, zero_u_8x16), bit_u_8x16));
+			toWhite_u_8x16 = _mm_or_si128(toWhite_u_8x16, _mm_andnot_si128(_mm_cmpeq_epi8(brighter_u_8x16, zero_u_8x16), bit_u_8x16));
+		}
+
+		_mm_storeu_si128((__m128i*)(toBlackCandidates + x), toBlack_u_8x16);
+		_mm_storeu_si128((__m128i*)(toWhiteCandidates + x), toWhite_u_8x16);
+
+		x += 16u;
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	// the first pixels have less left neighbors than windows
+	x = std::min(width, numberTransitionWindows);
+	determineTransitionCandidates(yRow, 1u, x, toBlackCandidates, toWhiteCandidates, thresholds);
+
+	while (x + 16u <= width)
+	{
+		const uint8x16_t pixels_u_8x16 = vld1q_u8(yRow + x);
+
+		uint8x16_t toBlack_u_8x16 = vdupq_n_u8(0u);
+		uint8x16_t toWhite_u_8x16 = vdupq_n_u8(0u);
+
+		for (unsigned int window = 0u; window < numberTransitionWindows; ++window)
+		{
+			const uint8x16_t neighbors_u_8x16 = vld1q_u8(yRow + x - 1u - window);
+
+			const uint8x16_t threshold_u_8x16 = vdupq_n_u8(thresholds[window]);
+			const uint8x16_t bit_u_8x16 = vdupq_n_u8(uint8_t(1u << window));
+
+			toBlack_u_8x16 = vorrq_u8(toBlack_u_8x16, vandq_u8(vcgtq_u8(vqsubq_u8(neighbors_u_8x16, pixels_u_8x16), threshold_u_8x16), bit_u_8x16));
+			toWhite_u_8x16 = vorrq_u8(toWhite_u_8x16, vandq_u8(vcgtq_u8(vqsubq_u8(pixels_u_8x16, neighbors_u_8x16), threshold_u_8x16), bit_u_8x16));
+		}
+
+		vst1q_u8(toBlackCandidates + x, toBlack_u_8x16);
+		vst1q_u8(toWhiteCandidates + x, toWhite_u_8x16);
+
+		x += 16u;
+	}
+
+#endif
+
+	determineTransitionCandidates(yRow, x, width, toBlackCandidates, toWhiteCandidates, thresholds);
+}
+
+void FinderPatternDetector::determineTransitionCandidates(const uint8_t* const yRow, const unsigned int firstPixel, const unsigned int endPixel, uint8_t* const toBlackCandidates, uint8_t* const toWhiteCandidates, const uint8_t* const thresholds)
+{
+	ocean_assert(yRow != nullptr && thresholds != nullptr);
+	ocean_assert(firstPixel >= 1u && firstPixel <= endPixel);
+
+	for (unsigned int x = firstPixel; x < endPixel; ++x)
+	{
+		const int pixel = int(yRow[x]);
+
+		uint8_t toBlack = 0u;
+		uint8_t toWhite = 0u;
+
+		const unsigned int windows = std::min(x, numberTransitionWindows);
 
-	// TODO Enough to assert std::is_sorted(...)? Should be.
-	std::sort(finderPatterns.begin(), finderPatterns.end(), FinderPattern::comesBefore);
+		for (unsigned int window = 0u; window < windows; ++window)
+		{
+			const int delta = pixel - int(yRow[x - 1u - window]);
+
+			if (delta < -int(thresholds[window]))
+			{
+				toBlack |= uint8_t(1u << window);
+			}
+			else if (delta > int(thresholds[window]))
+			{
+				toWhite |= uint8_t(1u << window);
+			}
+		}
+
+		toBlackCandidates[x] = toBlack;
+		toWhiteCandidates[x] = toWhite;
+	}
 }
 
 IndexTriplets FinderPatternDetector::extractIndexTriplets(const FinderPatterns& finderPatterns, const Scalar distanceScaleTolerance, const Scalar moduleSizeScaleTolerance, const Scalar angleTolerance)
@@ -16,6 +16,8 @@
 #include "ocean/base/Memory.h"
 
 #include "ocean/cv/Bresenham.h"
+#include "ocean/cv/NEON.h"
+#include "ocean/cv/SSE.h"
 
 #include "ocean/geometry/Homography.h"
 
@@ -268,6 +270,12 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT FinderPatternDetector
 				int deltas_[5] = { 0, 0, 0, 0, 0 };
 		};
 
+		/**
+		 * Definition of the number of window sizes which are used to identify a transition, the window sizes 1 to 6 pixels are used.
+		 * @see isTransitionToBlack(), isTransitionToWhite().
+		 */
+		static constexpr unsigned int numberTransitionWindows = 6u;
+
 	public:
 
 		/**
@@ -313,10 +321,46 @@ class OCEAN_CV_DETECTOR_QRCODES_EXPORT FinderPatternDetector
 		 * @param width The width of the given grayscale frame in pixel, with range [15, infinity)
 		 * @param height The height of the given grayscale frame in pixel, with range [15, infinity)
 		 * @param y The index of the row in which the finder patterns will be detected, with range [7, height - 8]
-		 * @param finderPatterns The resulting detected finder patterns, will be added to the end of the vector
+		 * @param finderPatterns The resulting detected finder patterns, will be added to the end of the vector (without sorting the vector)
 		 * @param paddingElements Optional number of padding elements at the end of each image row, in elements, with range [0, infinity)
+		 * @param toBlackCandidates Memory for the transition candidates to black of the row, must be valid and must have at least `width` elements
+		 * @param toWhiteCandidates Memory for the transition candidates to white of the row, must be valid and must have at least `width` elements
+		 */
+		static void detectFinderPatternInRow(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int y, FinderPatterns& finderPatterns, const unsigned int paddingElements, uint8_t* const toBlackCandidates, uint8_t* const toWhiteCandidates);
+
+		/**
+		 * Determines the transition candidates of an entire image row in one pass (with SSE or NEON if available).
+		 * For each pixel, bit k of the candidate mask is set if the intensity change between the pixel and its (k + 1)-th left neighbor exceeds the threshold of the corresponding window size.<br>
+		 * The candidates provide the identical transitions as isTransitionToBlack() and isTransitionToWhite() for any start location of the search, see findTransition().
+		 * @param yRow The row of the 8 bit grayscale frame, must be valid
+		 * @param width The width of the row in pixel, with range [1, infinity)
+		 * @param toBlackCandidates The resulting candidate masks for transitions from bright to dark pixels, the first element will be zero, must be valid and must have at least `width` elements
+		 * @param toWhiteCandidates The resulting candidate masks for transitions from dark to bright pixels, the first element will be zero, must be valid and must have at least `width` elements
+		 */
+		static void determineTransitionCandidates(const uint8_t* const yRow, const unsigned int width, uint8_t* const toBlackCandidates, uint8_t* const toWhiteCandidates);
+
+		/**
+		 * Determines the transition candidates of a subset of an image row without SIMD instructions.
+		 * @param yRow The row of the 8 bit grayscale frame, must be valid
+		 * @param firstPixel The first pixel for which the candidates will be determined, with range [1, endPixel]
+		 * @param endPixel The pixel after the last pixel for which the candidates will be determined, with range [firstPixel, width]
+		 * @param toBlackCandidates The resulting candidate masks for transitions from bright to dark pixels, must be valid
+		 * @param toWhiteCandidates The resulting candidate masks for transitions from dark to bright pixels, must be valid
+		 * @param thresholds The intensity thresholds for the individual window sizes, must be valid and must have `numberTransitionWindows` elements
+		 * @see determineTransitionCandidates().
+		 */
+		static void determineTransitionCandidates(const uint8_t* const yRow, const unsigned int firstPixel, const unsigned int endPixel, uint8_t* const toBlackCandidates, uint8_t* const toWhiteCandidates, const uint8_t* const thresholds);
+
+		/**
+		 * Returns the location of the next transition in a row based on precomputed transition candidates.
+		 * The result is identical to the location found by a pixel-wise search with isTransitionToBlack() or isTransitionToWhite() starting with a reset history at `start`.<br>
+		 * Long runs without any candidate are skipped with SSE or NEON if available.
+		 * @param candidates The transition candidates of the row, as determined by determineTransitionCandidates(), must be valid
+		 * @param width The width of the row in pixel, with range [1, infinity)
+		 * @param start The location at which the search starts, with range [1, infinity)
+		 * @return The location of the next transition, with range [start, width - 1], `width` if no transition exists
 		 */
-		static void detectFinderPatternInRow(const uint8_t* const yFrame, const unsigned int width, const unsigned int height, const unsigned int y, FinderPatterns& finderPatterns, const unsigned int paddingElements);
+		static inline unsigned int findTransition(const uint8_t* const candidates, const unsigned int width, const unsigned int start);
 
 		/**
 		 * Estimates the locations of the corners of finder pattern and computes the dominant orientation of the finder pattern from those corners
@@ -652,6 +696,63 @@ inline bool FinderPatternDetector::isTransitionToWhite(const uint8_t* pixel, Tra
 	return result;
 }
 
+inline unsigned int FinderPatternDetector::findTransition(const uint8_t* const candidates, const unsigned int width, const unsigned int start)
+{
+	ocean_assert(candidates != nullptr);
+	ocean_assert(start >= 1u);
+
+	unsigned int x = start;
+
+	// the first pixels after the start location can only use windows not exceeding the start location (as the history has been reset)
+
+	for (unsigned int windows = 1u; windows < numberTransitionWindows && x < width; ++windows)
+	{
+		if ((candidates[x] & ((1u << windows) - 1u)) != 0u)
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+#if defined(OCEAN_HARDWARE_SSE_VERSION) && OCEAN_HARDWARE_SSE_VERSION >= 41
+
+	const __m128i zero_u_8x16 = _mm_setzero_si128();
+
+	while (x + 16u <= width && _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(candidates + x)), zero_u_8x16)) == 0xFFFF)
+	{
+		x += 16u;
+	}
+
+#elif defined(OCEAN_HARDWARE_NEON_VERSION) && OCEAN_HARDWARE_NEON_VERSION >= 10
+
+	while (x + 16u <= width)
+	{
+		const uint8x16_t candidates_u_8x16 = vld1q_u8(candidates + x);
+
+		if (vget_lane_u64(vreinterpret_u64_u8(vorr_u8(vget_low_u8(candidates_u_8x16), vget_high_u8(candidates_u_8x16))), 0) != 0ull)
+		{
+			break;
+		}
+
+		x += 16u;
+	}
+
+#endif
+
+	while (x < width)
+	{
+		if (candidates[x] != 0u)
+		{
+			return x;
+		}
+
+		++x;
+	}
+
+	return width;
+}
+
 inline unsigned int FinderPatternDetector::determineThreshold(const uint8_t* yPosition, const unsigned int segmentSize1, const unsigned int segmentSize2, const unsigned int segmentSize3, const unsigned int segmentSize4, const unsigned int segmentSize5)
 {
 	unsigned int sumBlack = 0u;
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/cv/synthesis/InitializerHomographyMappingAdaptionI1.h"
+
+#include "ocean/base/RandomI.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Synthesis
+{
+
+void InitializerHomographyMappingAdaptionI1::initializeSubset(const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int firstRow, const unsigned int numberRows) const
+{
+	const unsigned int width = layerI_.width();
+	const unsigned int height = layerI_.height();
+
+	const unsigned int previousWidth = previousLayer_.width();
+	const unsigned int previousHeight = previousLayer_.height();
+
+	ocean_assert(firstColumn + numberColumns <= width);
+	ocean_assert(firstRow + numberRows <= height);
+
+	const SquareMatrix3 current_H_previous(previous_H_current_.inverted());
+
+	MappingI& mapping = layerI_.mapping();
+	const MappingI& previousMapping = previousLayer_.mapping();
+
+	RandomGenerator randomGenerator(randomGenerator_);
+
+	const uint8_t* const mask = layerI_.mask().constdata<uint8_t>();
+	const uint8_t* const previousMask = previousLayer_.mask().constdata<uint8_t>();
+
+	const unsigned int maskStrideElements = layerI_.mask().strideElements();
+	const unsigned int previousMaskStrideElements = previousLayer_.mask().strideElements();
+
+	for (unsigned int y = firstRow; y < firstRow + numberRows; ++y)
+	{
+		const uint8_t* maskRow = mask + y * maskStrideElements;
+		PixelPosition* positionRow = mapping.row(y);
+
+		for (unsigned int x = firstColumn; x < firstColumn + numberColumns; ++x)
+		{
+			if (maskRow[x] == 0xFFu)
+			{
+				continue;
+			}
+
+			const Vector2 previousPoint(previous_H_current_ * Vector2(Scalar(x), Scalar(y)));
+
+			const int previousX = Numeric::round32(previousPoint.x());
+			const int previousY = Numeric::round32(previousPoint.y());
+
+			// only pixels which have been synthesized in the previous frame provide a valid mapping
+			if (previousX >= 0 && previousY >= 0 && previousX < int(previousWidth) && previousY < int(previousHeight) && previousMask[previousY * previousMaskStrideElements + previousX] != 0xFFu)
+			{
+				const PixelPosition& previousPosition = previousMapping.position((unsigned int)(previousX), (unsigned int)(previousY));
+				ocean_assert(previousPosition.x() < previousWidth && previousPosition.y() < previousHeight);
+
+				// we keep the sub-pixel offset of the transformed point so that neighboring mask pixels receive coherent source positions
+				const Vector2 previousSourcePoint(Scalar(previousPosition.x()) + previousPoint.x() - Scalar(previousX), Scalar(previousPosition.y()) + previousPoint.y() - Scalar(previousY));
+				const Vector2 currentSourcePoint(current_H_previous * previousSourcePoint);
+
+				const int candidateX = Numeric::round32(currentSourcePoint.x());
+				const int candidateY = Numeric::round32(currentSourcePoint.y());
+
+				if (candidateX >= 0 && candidateY >= 0 && candidateX < int(width) && candidateY < int(height) && mask[candidateY * maskStrideElements + candidateX] == 0xFFu)
+				{
+					positionRow[x] = PixelPosition((unsigned int)(candidateX), (unsigned int)(candidateY));
+					continue;
+				}
+			}
+
+			if (coarserLayer_ != nullptr)
+			{
+				const unsigned int coarserWidth = coarserLayer_->width();
+				const unsigned int coarserHeight = coarserLayer_->height();
+
+				const unsigned int xCoarser = min(x / 2u, coarserWidth - 1u);
+				const unsigned int yCoarser = min(y / 2u, coarserHeight - 1u);
+
+				if (coarserLayer_->mask().constpixel<uint8_t>(xCoarser, yCoarser)[0] != 0xFFu)
+				{
+					const PixelPosition& coarserPosition = coarserLayer_->mapping().position(xCoarser, yCoarser);
+					ocean_assert(coarserPosition.x() < coarserWidth && coarserPosition.y() < coarserHeight);
+
+					const int candidateX = int(x) + (int(coarserPosition.x()) - int(xCoarser)) * 2;
+					const int candidateY = int(y) + (int(coarserPosition.y()) - int(yCoarser)) * 2;
+
+					if (candidateX >= 0 && candidateY >= 0 && candidateX < int(width) && candidateY < int(height) && mask[candidateY * maskStrideElements + candidateX] == 0xFFu)
+					{
+						positionRow[x] = PixelPosition((unsigned int)(candidateX), (unsigned int)(candidateY));
+						continue;
+					}
+				}
+			}
+
+			unsigned int candidateX, candidateY;
+			do
+			{
+				candidateX = RandomI::random(randomGenerator, width - 1u);
+				candidateY = RandomI::random(randomGenerator, height - 1u);
+			}
+			while (mask[candidateY * maskStrideElements + candidateX] != 0xFFu);
+
+			positionRow[x] = PixelPosition(candidateX, candidateY);
+		}
+	}
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_SYNTHESIS_INITIALIZER_HOMOGRAPHY_MAPPING_ADAPTION_I_1_H
+#define META_OCEAN_CV_SYNTHESIS_INITIALIZER_HOMOGRAPHY_MAPPING_ADAPTION_I_1_H
+
+#include "ocean/cv/synthesis/Synthesis.h"
+#include "ocean/cv/synthesis/InitializerI.h"
+#include "ocean/cv/synthesis/InitializerRandomized.h"
+#include "ocean/cv/synthesis/InitializerSubset.h"
+#include "ocean/cv/synthesis/Initializer1.h"
+#include "ocean/cv/synthesis/LayerI1.h"
+
+#include "ocean/math/SquareMatrix3.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Synthesis
+{
+
+/**
+ * This initializer creates an initial mapping by the adaption of the mapping of a previous video frame with corresponding homography.<br>
+ * The initializer supports mappings with integer accuracy and is intended for the temporal inpainting of video sequences.<br>
+ * Each mask pixel is transformed into the previous frame, the previous source position is transformed back into the current frame and is used if it lies outside the current synthesis mask.<br>
+ * Mask pixels without valid adapted position (e.g., pixels which have not been part of the previous synthesis mask) receive the upsampled mapping of a coarser layer (if provided) or a random position.
+ * @see InitializerHomographyMappingAdaptionF1, InitializerCoarserMappingAdaptionI1.
+ * @ingroup cvsynthesis
+ */
+class OCEAN_CV_SYNTHESIS_EXPORT InitializerHomographyMappingAdaptionI1 :
+	virtual public InitializerI,
+	virtual public InitializerRandomized,
+	virtual public InitializerSubset,
+	virtual public Initializer1
+{
+	public:
+
+		/**
+		 * Creates a new initializer object.
+		 * @param layer The layer for that the initial mapping has to be provided
+		 * @param randomGenerator Random number generator
+		 * @param previousLayer The synthesis layer of the previous frame with final mapping, with same dimension as the layer
+		 * @param previous_H_current The homography transforming a point defined in the current layer into a point defined in the previous layer: previousPoint = previous_H_current * currentPoint, must be valid
+		 * @param coarserLayer Optional coarser synthesis layer of the current frame with half dimension, used for mask pixels which cannot be adapted, nullptr to use random positions instead
+		 */
+		inline InitializerHomographyMappingAdaptionI1(LayerI1& layer, RandomGenerator& randomGenerator, const LayerI1& previousLayer, const SquareMatrix3& previous_H_current, const LayerI1* coarserLayer = nullptr);
+
+	private:
+
+		/**
+		 * Initializes a subset of the entire mapping area.
+		 * @see InitializerSubset::initializeSubset().
+		 */
+		void initializeSubset(const unsigned int firstColumn, const unsigned int numberColumns, const unsigned int firstRow, const unsigned int numberRows) const override;
+
+	private:
+
+		/// The synthesis layer of the previous frame from which the mapping will be adapted.
+		const LayerI1& previousLayer_;
+
+		/// The homography transforming a point defined in the current layer into a point defined in the previous layer.
+		const SquareMatrix3 previous_H_current_;
+
+		/// Optional coarser synthesis layer of the current frame, nullptr if not defined.
+		const LayerI1* coarserLayer_;
+};
+
+inline InitializerHomographyMappingAdaptionI1::InitializerHomographyMappingAdaptionI1(LayerI1& layer, RandomGenerator& randomGenerator, const LayerI1& previousLayer, const SquareMatrix3& previous_H_current, const LayerI1* coarserLayer) :
+	Initializer(layer),
+	InitializerI(layer),
+	InitializerRandomized(layer, randomGenerator),
+	InitializerSubset(layer),
+	Initializer1(layer),
+	previousLayer_(previousLayer),
+	previous_H_current_(previous_H_current),
+	coarserLayer_(coarserLayer)
+{
+	ocean_assert(!previous_H_current_.isSingular());
+	ocean_assert(coarserLayer_ == nullptr || (coarserLayer_->width() == layer.width() / 2u && coarserLayer_->height() == layer.height() / 2u));
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_SYNTHESIS_INITIALIZER_HOMOGRAPHY_MAPPING_ADAPTION_I_1_H
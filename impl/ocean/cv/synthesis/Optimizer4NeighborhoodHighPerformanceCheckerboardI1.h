@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_CV_SYNTHESIS_OPTIMIZER_4_NEIGHBORHOOD_HIGH_PERFORMANCE_CHECKERBOARD_I_1_H
+#define META_OCEAN_CV_SYNTHESIS_OPTIMIZER_4_NEIGHBORHOOD_HIGH_PERFORMANCE_CHECKERBOARD_I_1_H
+
+#include "ocean/cv/synthesis/Synthesis.h"
+#include "ocean/cv/synthesis/LayerI1.h"
+#include "ocean/cv/synthesis/OptimizerI.h"
+#include "ocean/cv/synthesis/Optimizer1.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+
+#include "ocean/cv/CVUtilities.h"
+
+namespace Ocean
+{
+
+namespace CV
+{
+
+namespace Synthesis
+{
+
+/**
+ * This class implements a high performance mapping optimizer for integer mappings that use one single frame and which scales with the number of CPU cores.
+ * In contrast to Optimizer4NeighborhoodHighPerformanceI1, which optimizes large subsets (stripes of rows) in parallel, this optimizer separates the synthesis area into square tiles arranged in a checkerboard pattern with four colors.<br>
+ * Each optimization pass is composed of four phases, in each phase all tiles of one color are optimized concurrently.<br>
+ * Tiles with the same color are separated by at least one full tile, so that they do not share any target neighborhood (neither the 5x5 appearance patch nor the 4-neighborhood of the spatial cost).<br>
+ * Thus, the mapping and the synthesis pixels of a tile are not modified by any other thread while the tile is optimized; only source patches close to the inpainting mask may cover pixels of concurrent tiles (as for all other parallel optimizers).<br>
+ * Inside a tile, mappings are propagated in scanline order (alternating between top-left to bottom-right and bottom-right to top-left), the tile grid is shifted randomly with each pass so that mappings are propagated across tile borders.<br>
+ * The optimizer can replace Optimizer4NeighborhoodHighPerformanceI1 whenever a worker with several threads is available.
+ * @tparam tWeightFactor Spatial weight impact, with range [0, infinity)
+ * @tparam tBorderFactor Weight factor of border pixels, with range [1, infinity)
+ * @tparam tUpdateFrame True, to update the frame pixel whenever a new mapping has been found
+ * @ingroup cvsynthesis
+ */
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+class Optimizer4NeighborhoodHighPerformanceCheckerboardI1 :
+	virtual public OptimizerI,
+	virtual public Optimizer1
+{
+	public:
+
+		/**
+		 * Creates a new optimizer object.
+		 * @param layer The layer to be optimized
+		 * @param randomGenerator Random number generator
+		 * @param tileSize The size of the square tiles, in pixel, with range [8, infinity)
+		 */
+		inline Optimizer4NeighborhoodHighPerformanceCheckerboardI1(LayerI1& layer, RandomGenerator& randomGenerator, const unsigned int tileSize = 32u);
+
+		/**
+		 * Invokes the operator.
+		 * The optimizer applies 2 * iterations passes, each pass composed of four checkerboard phases.
+		 * @see Optimizer::invoke().
+		 */
+		bool invoke(const unsigned int radii, const unsigned int iterations = 5u, const unsigned int maxSpatialCost = 0xFFFFFFFFu, Worker* worker = nullptr, const bool applyInitialMapping = true) const override;
+
+	private:
+
+		/**
+		 * Applies all optimization passes for a frame with specific number of channels.
+		 * @param radii Number of improvement radii during one optimization iteration for each mapping position
+		 * @param iterations Number of optimization iterations that will be applied
+		 * @param maxSpatialCost Maximal spatial cost
+		 * @param worker Optional worker object to distribute the computation
+		 * @tparam tChannels Number of data channels of the frame
+		 */
+		template <unsigned int tChannels>
+		void invokeChannels(const unsigned int radii, const unsigned int iterations, const unsigned int maxSpatialCost, Worker* worker) const;
+
+		/**
+		 * Optimizes a subset of all tiles with the same checkerboard color.
+		 * @param radii Number of improvement radii during one optimization iteration for each mapping position
+		 * @param maxSpatialCost Maximal spatial cost
+		 * @param down True, to propagate the mappings from top-left to bottom-right; False, to propagate from bottom-right to top-left
+		 * @param color The checkerboard color of the tiles to be optimized, with range [0, 3]
+		 * @param randomSeed The seed for the random generators of the individual tiles
+		 * @param offsetX The horizontal offset of the tile grid, with range [0, tileSize_)
+		 * @param offsetY The vertical offset of the tile grid, with range [0, tileSize_)
+		 * @param tilesX The number of horizontal tiles of the entire grid, with range [1, infinity)
+		 * @param tilesY The number of vertical tiles of the entire grid, with range [1, infinity)
+		 * @param firstTile The first tile (of all tiles with the specified color) to be handled
+		 * @param numberTiles The number of tiles to be handled
+		 * @tparam tChannels Number of data channels of the frame
+		 */
+		template <unsigned int tChannels>
+		void optimizeTilesSubset(const unsigned int radii, const unsigned int maxSpatialCost, const bool down, const unsigned int color, const unsigned int randomSeed, const unsigned int offsetX, const unsigned int offsetY, const unsigned int tilesX, const unsigned int tilesY, const unsigned int firstTile, const unsigned int numberTiles) const;
+
+		/**
+		 * Optimizes all mask pixels of one tile.
+		 * @param radii Number of improvement radii during one optimization iteration for each mapping position
+		 * @param maxSpatialCost Maximal spatial cost
+		 * @param down True, to propagate the mappings from top-left to bottom-right; False, to propagate from bottom-right to top-left
+		 * @param randomGenerator The random generator of the tile
+		 * @param xStart The first column of the tile, with range [0, layerWidth)
+		 * @param xEnd The column after the last column of the tile, with range (xStart, layerWidth]
+		 * @param yStart The first row of the tile, with range [0, layerHeight)
+		 * @param yEnd The row after the last row of the tile, with range (yStart, layerHeight]
+		 * @tparam tChannels Number of data channels of the frame
+		 */
+		template <unsigned int tChannels>
+		void optimizeTile(const unsigned int radii, const unsigned int maxSpatialCost, const bool down, RandomGenerator& randomGenerator, const unsigned int xStart, const unsigned int xEnd, const unsigned int yStart, const unsigned int yEnd) const;
+
+		/**
+		 * Tests whether a candidate mapping is better than the current best mapping.
+		 * @param x Horizontal target position, with range [0, layerWidth)
+		 * @param y Vertical target position, with range [0, layerHeight)
+		 * @param candidateX Horizontal candidate source position, positions outside the frame are rejected
+		 * @param candidateY Vertical candidate source position, positions outside the frame are rejected
+		 * @param hasZeroSpatialCost True, if the candidate is a shifted direct neighbor mapping so that the spatial cost is known to be zero
+		 * @param layerFrameData The data of the layer frame, must be valid
+		 * @param layerMaskData The data of the layer mask, must be valid
+		 * @param layerFramePaddingElements The number of padding elements at the end of each frame row, in elements, with range [0, infinity)
+		 * @param layerMaskPaddingElements The number of padding elements at the end of each mask row, in elements, with range [0, infinity)
+		 * @param maxSpatialCost Maximal spatial cost
+		 * @param bestX The horizontal source position of the best mapping, will be updated if the candidate is better
+		 * @param bestY The vertical source position of the best mapping, will be updated if the candidate is better
+		 * @param bestCost The cost of the best mapping, will be updated if the candidate is better
+		 * @return True, if the candidate is better
+		 * @tparam tChannels Number of data channels of the frame
+		 */
+		template <unsigned int tChannels>
+		inline bool testCandidate(const unsigned int x, const unsigned int y, const unsigned int candidateX, const unsigned int candidateY, const bool hasZeroSpatialCost, const uint8_t* layerFrameData, const uint8_t* layerMaskData, const unsigned int layerFramePaddingElements, const unsigned int layerMaskPaddingElements, const unsigned int maxSpatialCost, unsigned int& bestX, unsigned int& bestY, uint64_t& bestCost) const;
+
+	protected:
+
+		/// Specialized layer reference.
+		LayerI1& layerI1_;
+
+		/// Random number generator of this optimizer.
+		RandomGenerator& randomGenerator_;
+
+		/// The size of the square tiles, in pixel.
+		const unsigned int tileSize_;
+};
+
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+inline Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::Optimizer4NeighborhoodHighPerformanceCheckerboardI1(LayerI1& layer, RandomGenerator& randomGenerator, const unsigned int tileSize) :
+	Optimizer(layer),
+	OptimizerI(layer),
+	Optimizer1(layer),
+	layerI1_(layer),
+	randomGenerator_(randomGenerator),
+	tileSize_(max(8u, tileSize))
+{
+	ocean_assert(tileSize >= 8u);
+}
+
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+bool Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::invoke(const unsigned int radii, const unsigned int iterations, const unsigned int maxSpatialCost, Worker* worker, const bool applyInitialMapping) const
+{
+	if (layerI1_.frame().numberPlanes() != 1u)
+	{
+		return false;
+	}
+
+	if (applyInitialMapping)
+	{
+		const unsigned int firstColumn = layerI1_.boundingBox() ? layerI1_.boundingBox().left() : 0u;
+		const unsigned int numberColumns = layerI1_.boundingBox() ? layerI1_.boundingBox().width() : layerI1_.width();
+
+		const unsigned int firstRow = layerI1_.boundingBox() ? layerI1_.boundingBox().top() : 0u;
+		const unsigned int numberRows = layerI1_.boundingBox() ? layerI1_.boundingBox().height() : layerI1_.height();
+
+		layerI1_.mapping().applyMapping(layerI1_.frame(), layerI1_.mask(), firstColumn, numberColumns, firstRow, numberRows, worker);
+	}
+
+	switch (layerI1_.frame().channels())
+	{
+		case 1u:
+			invokeChannels<1u>(radii, iterations, maxSpatialCost, worker);
+			return true;
+
+		case 2u:
+			invokeChannels<2u>(radii, iterations, maxSpatialCost, worker);
+			return true;
+
+		case 3u:
+			invokeChannels<3u>(radii, iterations, maxSpatialCost, worker);
+			return true;
+
+		case 4u:
+			invokeChannels<4u>(radii, iterations, maxSpatialCost, worker);
+			return true;
+
+		default:
+			break;
+	}
+
+	ocean_assert(false && "Invalid frame type.");
+	return false;
+}
+
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+template <unsigned int tChannels>
+void Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::invokeChannels(const unsigned int radii, const unsigned int iterations, const unsigned int maxSpatialCost, Worker* worker) const
+{
+	const unsigned int numberColumns = layerI1_.boundingBox() ? layerI1_.boundingBox().width() : layerI1_.width();
+	const unsigned int numberRows = layerI1_.boundingBox() ? layerI1_.boundingBox().height() : layerI1_.height();
+
+	bool down = true;
+
+	for (unsigned int pass = 0u; pass < 2u * iterations; ++pass)
+	{
+		// the tile grid is shifted with each pass so that the tile borders change
+
+		const unsigned int offsetX = RandomI::random(randomGenerator_, tileSize_ - 1u);
+		const unsigned int offsetY = RandomI::random(randomGenerator_, tileSize_ - 1u);
+
+		const unsigned int tilesX = (numberColumns + offsetX + tileSize_ - 1u) / tileSize_;
+		const unsigned int tilesY = (numberRows + offsetY + tileSize_ - 1u) / tileSize_;
+
+		// the tiles have four colors, tiles with the same color are separated by at least one tile with another color
+
+		for (unsigned int color = 0u; color < 4u; ++color)
+		{
+			const unsigned int colorTilesX = (tilesX + 1u - (color & 1u)) / 2u;
+			const unsigned int colorTilesY = (tilesY + 1u - (color >> 1u)) / 2u;
+
+			const unsigned int colorTiles = colorTilesX * colorTilesY;
+
+			// each phase receives an own seed from which the individual tiles derive their random generators
+
+			const unsigned int randomSeed = RandomI::random32(randomGenerator_);
+
+			if (colorTiles == 0u)
+			{
+				continue;
+			}
+
+			if (worker)
+			{
+				worker->executeFunction(Worker::Function::create(*this, &Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::template optimizeTilesSubset<tChannels>, radii, maxSpatialCost, down, color, randomSeed, offsetX, offsetY, tilesX, tilesY, 0u, 0u), 0u, colorTiles, 9u, 10u, 1u);
+			}
+			else
+			{
+				optimizeTilesSubset<tChannels>(radii, maxSpatialCost, down, color, randomSeed, offsetX, offsetY, tilesX, tilesY, 0u, colorTiles);
+			}
+		}
+
+		down = !down;
+	}
+}
+
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+template <unsigned int tChannels>
+void Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::optimizeTilesSubset(const unsigned int radii, const unsigned int maxSpatialCost, const bool down, const unsigned int color, const unsigned int randomSeed, const unsigned int offsetX, const unsigned int offsetY, const unsigned int tilesX, const unsigned int tilesY, const unsigned int firstTile, const unsigned int numberTiles) const
+{
+	ocean_assert(color < 4u);
+	ocean_assert(offsetX < tileSize_ && offsetY < tileSize_);
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(tilesY);
+
+	const unsigned int firstColumn = layerI1_.boundingBox() ? layerI1_.boundingBox().left() : 0u;
+	const unsigned int numberColumns = layerI1_.boundingBox() ? layerI1_.boundingBox().width() : layerI1_.width();
+
+	const unsigned int firstRow = layerI1_.boundingBox() ? layerI1_.boundingBox().top() : 0u;
+	const unsigned int numberRows = layerI1_.boundingBox() ? layerI1_.boundingBox().height() : layerI1_.height();
+
+	const unsigned int colorTilesX = (tilesX + 1u - (color & 1u)) / 2u;
+	ocean_assert(colorTilesX != 0u);
+
+	for (unsigned int colorTile = firstTile; colorTile < firstTile + numberTiles; ++colorTile)
+	{
+		const unsigned int tileX = (colorTile % colorTilesX) * 2u + (color & 1u);
+		const unsigned int tileY = (colorTile / colorTilesX) * 2u + (color >> 1u);
+
+		ocean_assert(tileX < tilesX && tileY < tilesY);
+
+		// the first tile in each direction is cropped by the offset of the grid, the last tile is cropped by the synthesis area
+
+		const unsigned int tileLeft = max(0, int(tileX * tileSize_) - int(offsetX));
+		const unsigned int tileTop = max(0, int(tileY * tileSize_) - int(offsetY));
+
+		const unsigned int tileRightEnd = min((tileX + 1u) * tileSize_ - offsetX, numberColumns);
+		const unsigned int tileBottomEnd = min((tileY + 1u) * tileSize_ - offsetY, numberRows);
+
+		ocean_assert(tileLeft < tileRightEnd && tileTop < tileBottomEnd);
+
+		// each tile has an own random generator, independent of the thread which optimizes the tile
+		RandomGenerator generator(randomSeed + tileY * tilesX + tileX);
+
+		optimizeTile<tChannels>(radii, maxSpatialCost, down, generator, firstColumn + tileLeft, firstColumn + tileRightEnd, firstRow + tileTop, firstRow + tileBottomEnd);
+	}
+}
+
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+template <unsigned int tChannels>
+void Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::optimizeTile(const unsigned int radii, const unsigned int maxSpatialCost, const bool down, RandomGenerator& randomGenerator, const unsigned int xStart, const unsigned int xEnd, const unsigned int yStart, const unsigned int yEnd) const
+{
+	const unsigned int layerWidth = layerI1_.width();
+	const unsigned int layerHeight = layerI1_.height();
+	ocean_assert(layerWidth != 0 && layerHeight != 0);
+
+	ocean_assert(xStart < xEnd && xEnd <= layerWidth);
+	ocean_assert(yStart < yEnd && yEnd <= layerHeight);
+
+	const std::vector<int> searchRadii(calculateSearchRadii(radii, layerWidth, layerHeight));
+
+	Frame& layerFrame = layerI1_.frame();
+	const Frame& layerMask = layerI1_.mask();
+	MappingI1& layerMapping = layerI1_.mapping();
+
+	ocean_assert(FrameType::formatIsGeneric(layerFrame.pixelFormat(), FrameType::DT_UNSIGNED_INTEGER_8, tChannels));
+	ocean_assert(layerFrame.pixelOrigin() == layerMask.pixelOrigin());
+
+	uint8_t* const layerFrameData = layerFrame.data<uint8_t>();
+	const uint8_t* const layerMaskData = layerMask.constdata<uint8_t>();
+
+	const unsigned int layerFramePaddingElements = layerFrame.paddingElements();
+	const unsigned int layerMaskPaddingElements = layerMask.paddingElements();
+
+	// the direction of the propagation, neighbors are located at x - step and y - step (and are already optimized in this pass if they belong to the tile)
+
+	const int step = down ? 1 : -1;
+
+	const unsigned int rows = yEnd - yStart;
+	const unsigned int columns = xEnd - xStart;
+
+	for (unsigned int yy = 0u; yy < rows; ++yy)
+	{
+		const unsigned int y = down ? yStart + yy : yEnd - yy - 1u;
+
+		const uint8_t* const maskRow = layerMask.constrow<uint8_t>(y);
+		PixelPosition* const positionRow = layerMapping.row(y);
+
+		// (unsigned) underflows and overflows are caught by the range check
+		const unsigned int yNeighbor = (unsigned int)(int(y) - step);
+		const bool validNeighborRow = yNeighbor < layerHeight;
+
+		const uint8_t* const neighborMaskRow = validNeighborRow ? layerMask.constrow<uint8_t>(yNeighbor) : nullptr;
+		const PixelPosition* const neighborPositionRow = validNeighborRow ? layerMapping.row(yNeighbor) : nullptr;
+
+		for (unsigned int xx = 0u; xx < columns; ++xx)
+		{
+			const unsigned int x = down ? xStart + xx : xEnd - xx - 1u;
+
+			if (maskRow[x] == 0xFF)
+			{
+				continue;
+			}
+
+			unsigned int bestX = positionRow[x].x();
+			unsigned int bestY = positionRow[x].y();
+
+			const uint64_t oldSpatialCost = layerMapping.spatialCost4Neighborhood<tChannels>(x, y, bestX, bestY, layerMaskData, layerMaskPaddingElements, maxSpatialCost);
+			const uint64_t oldColorCost = layerMapping.appearanceCost5x5<tChannels, tBorderFactor>(x, y, bestX, bestY, layerFrameData, layerMaskData, layerFramePaddingElements, layerMaskPaddingElements);
+			uint64_t bestCost = uint64_t(tWeightFactor) * oldSpatialCost + oldColorCost;
+
+			bool foundBetter = false;
+
+			// first propagation along the row
+			const unsigned int xNeighbor = (unsigned int)(int(x) - step);
+
+			if (xNeighbor < layerWidth && maskRow[xNeighbor] != 0xFF)
+			{
+				const PixelPosition& neighbor = positionRow[xNeighbor];
+				foundBetter = testCandidate<tChannels>(x, y, (unsigned int)(int(neighbor.x()) + step), neighbor.y(), true, layerFrameData, layerMaskData, layerFramePaddingElements, layerMaskPaddingElements, maxSpatialCost, bestX, bestY, bestCost) || foundBetter;
+			}
+
+			// second propagation along the column, a candidate identical to the current best mapping is skipped
+			if (validNeighborRow && neighborMaskRow[x] != 0xFF)
+			{
+				const PixelPosition& neighbor = neighborPositionRow[x];
+				foundBetter = testCandidate<tChannels>(x, y, neighbor.x(), (unsigned int)(int(neighbor.y()) + step), true, layerFrameData, layerMaskData, layerFramePaddingElements, layerMaskPaddingElements, maxSpatialCost, bestX, bestY, bestCost) || foundBetter;
+			}
+
+			// find a better position of the current mask pixel
+			for (unsigned int n = 0u; n < radii; ++n)
+			{
+				ocean_assert(bestX != (unsigned int)(-1) && bestY != (unsigned int)(-1));
+
+				const unsigned int testPositionX = bestX + RandomI::random(randomGenerator, -searchRadii[n], searchRadii[n]);
+				const unsigned int testPositionY = bestY + RandomI::random(randomGenerator, -searchRadii[n], searchRadii[n]);
+
+				foundBetter = testCandidate<tChannels>(x, y, testPositionX, testPositionY, false, layerFrameData, layerMaskData, layerFramePaddingElements, layerMaskPaddingElements, maxSpatialCost, bestX, bestY, bestCost) || foundBetter;
+			}
+
+			if (tUpdateFrame && foundBetter)
+			{
+				ocean_assert(layerMask.constpixel<uint8_t>(bestX, bestY)[0] == 0xFF);
+
+				positionRow[x].setPosition(bestX, bestY);
+
+				CV::CVUtilities::copyPixel<tChannels>(layerFrameData, layerFrameData, x, y, bestX, bestY, layerWidth, layerWidth, layerFramePaddingElements, layerFramePaddingElements);
+			}
+		}
+	}
+}
+
+template <unsigned int tWeightFactor, unsigned int tBorderFactor, bool tUpdateFrame>
+template <unsigned int tChannels>
+inline bool Optimizer4NeighborhoodHighPerformanceCheckerboardI1<tWeightFactor, tBorderFactor, tUpdateFrame>::testCandidate(const unsigned int x, const unsigned int y, const unsigned int candidateX, const unsigned int candidateY, const bool hasZeroSpatialCost, const uint8_t* layerFrameData, const uint8_t* layerMaskData, const unsigned int layerFramePaddingElements, const unsigned int layerMaskPaddingElements, const unsigned int maxSpatialCost, unsigned int& bestX, unsigned int& bestY, uint64_t& bestCost) const
+{
+	const MappingI1& layerMapping = layerI1_.mapping();
+
+	const unsigned int layerWidth = layerMapping.width();
+	const unsigned int layerHeight = layerMapping.height();
+
+	// the candidate must lie inside the frame and outside the inpainting mask
+
+	if ((candidateX == bestX && candidateY == bestY) || candidateX >= layerWidth || candidateY >= layerHeight
+			|| layerMaskData[candidateY * (layerWidth + layerMaskPaddingElements) + candidateX] != 0xFF)
+	{
+		return false;
+	}
+
+	uint64_t candidateCost = 0ull;
+
+	if (hasZeroSpatialCost)
+	{
+		// the structure cost is 0 due to the neighbor condition
+		ocean_assert_accuracy(layerMapping.spatialCost4Neighborhood<tChannels>(x, y, candidateX, candidateY, layerMaskData, layerMaskPaddingElements, maxSpatialCost) == 0u);
+	}
+	else
+	{
+		candidateCost = uint64_t(tWeightFactor) * uint64_t(layerMapping.spatialCost4Neighborhood<tChannels>(x, y, candidateX, candidateY, layerMaskData, layerMaskPaddingElements, maxSpatialCost));
+
+		if (candidateCost >= bestCost)
+		{
+			return false;
+		}
+	}
+
+	candidateCost += layerMapping.appearanceCost5x5<tChannels, tBorderFactor>(x, y, candidateX, candidateY, layerFrameData, layerMaskData, layerFramePaddingElements, layerMaskPaddingElements);
+
+	if (candidateCost < bestCost)
+	{
+		bestX = candidateX;
+		bestY = candidateY;
+		bestCost = candidateCost;
+
+		return true;
+	}
+
+	return false;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_CV_SYNTHESIS_OPTIMIZER_4_NEIGHBORHOOD_HIGH_PERFORMANCE_CHECKERBOARD_I_1_H
@@ -15,12 +15,14 @@
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionSpatialCostMaskI1.h"
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionI1.h"
 #include "ocean/cv/synthesis/InitializerContourMappingI1.h"
+#include "ocean/cv/synthesis/InitializerHomographyMappingAdaptionI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingAreaConstrainedI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingI1.h"
 #include "ocean/cv/synthesis/InitializerShrinkingErosionI1.h"
 #include "ocean/cv/synthesis/InitializerShrinkingErosionRandomizedI1.h"
 #include "ocean/cv/synthesis/InitializerShrinkingPatchMatchingI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodAreaConstrainedI1.h"
+#include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceCheckerboardI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceSkippingI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceSkippingByCostMaskI1.h"
@@ -195,6 +197,10 @@ bool SynthesisPyramidI1::applyInpainting(const InitializationTechnique initializ
 			{
 				Optimizer4NeighborhoodAreaConstrainedI1<5u, 25u, true>(layer, randomGenerator, filter).invoke(5u, 4u, maxSpatialCostLayer, worker, true);
 			}
+			else if (optimizationTechnique_ == OT_CHECKERBOARD)
+			{
+				Optimizer4NeighborhoodHighPerformanceCheckerboardI1<5u, 25u, true>(layer, randomGenerator).invoke(5u, 4u, maxSpatialCostLayer, worker, true);
+			}
 			else
 			{
 				Optimizer4NeighborhoodHighPerformanceI1<5u, 25u, true>(layer, randomGenerator).invoke(5u, 4u, maxSpatialCostLayer, worker, true);
@@ -238,6 +244,10 @@ bool SynthesisPyramidI1::applyInpainting(const InitializationTechnique initializ
 			{
 				Optimizer4NeighborhoodAreaConstrainedI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator, filter).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
 			}
+			else if (optimizationTechnique_ == OT_CHECKERBOARD)
+			{
+				Optimizer4NeighborhoodHighPerformanceCheckerboardI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
+			}
 			else
 			{
 				if (layerIndex < skippingLayers)
@@ -341,7 +351,14 @@ bool SynthesisPyramidI1::applyInpainting(const Constraints& constraints, RandomG
 
 			if (layerIndex < skippingConstraintLayers)
 			{
-				Optimizer4NeighborhoodHighPerformanceI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
+				if (optimizationTechnique_ == OT_CHECKERBOARD)
+				{
+					Optimizer4NeighborhoodHighPerformanceCheckerboardI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
+				}
+				else
+				{
+					Optimizer4NeighborhoodHighPerformanceI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
+				}
 			}
 			else
 			{
@@ -354,6 +371,96 @@ bool SynthesisPyramidI1::applyInpainting(const Constraints& constraints, RandomG
 	return true;
 }
 
+bool SynthesisPyramidI1::applyInpainting(const SynthesisPyramidI1& previousPyramid, const SquareMatrix3& previous_H_current, RandomGenerator& randomGenerator, const unsigned int weightFactor, const unsigned int borderFactor, const unsigned int maxSpatialCost, const unsigned int optimizationIterations, Worker* worker)
+{
+#ifdef OCEAN_DEBUG
+	ocean_assert(synthesisHasBeenArranged_);
+#endif
+
+	ocean_assert(&previousPyramid != this);
+	ocean_assert(!previous_H_current.isSingular());
+
+	ocean_assert(synthesisFramePyramid_.layers() == synthesisMaskPyramid_.layers());
+	ocean_assert(synthesisBoundingBoxes_.size() >= synthesisFramePyramid_.layers());
+
+	if (&previousPyramid == this || previous_H_current.isSingular() || synthesisFilterPyramid_.isValid())
+	{
+		return false;
+	}
+
+	const unsigned int layers = (unsigned int)synthesisFramePyramid_.layers();
+	ocean_assert(layers >= 1u);
+
+	if (previousPyramid.layers() != size_t(layers))
+	{
+		return false;
+	}
+
+	for (unsigned int layerIndex = 0u; layerIndex < layers; ++layerIndex)
+	{
+		const LayerI1& previousLayer = previousPyramid.layersReversedOrder_[layers - layerIndex - 1u];
+
+		if (previousLayer.width() != synthesisFramePyramid_[layerIndex].width() || previousLayer.height() != synthesisFramePyramid_[layerIndex].height())
+		{
+			return false;
+		}
+	}
+
+	layersReversedOrder_.clear();
+	layersReversedOrder_.reserve(synthesisFramePyramid_.layers());
+
+	ocean_assert(optimizationIterations >= 1u);
+
+	ocean_assert(weightFactor == 5u && borderFactor == 25u && "Currently we do not support other parameters as we need those parameters as template parameters, a solution can be a template and non-template implementation");
+	OCEAN_SUPPRESS_UNUSED_WARNING(weightFactor);
+	OCEAN_SUPPRESS_UNUSED_WARNING(borderFactor);
+
+	for (unsigned int layerIndex = layers - 1u; layerIndex != (unsigned int)(-1); --layerIndex)
+	{
+		const unsigned int iterationIndex = layers - layerIndex - 1u;
+		ocean_assert(iterationIndex < layers);
+
+		const unsigned int maxSpatialCostLayer = maxSpatialCost == (unsigned int)(-1) ? (unsigned int)(-1) : max(1u, maxSpatialCost >> (layerIndex * 2u));
+
+		Frame& frame = synthesisFramePyramid_[layerIndex];
+		const Frame& mask = synthesisMaskPyramid_[layerIndex];
+
+		ocean_assert(frame.isValid() && mask.isValid() && FrameType(frame, mask.pixelFormat()) == mask.frameType());
+
+		const PixelBoundingBox& boundingBox = synthesisBoundingBoxes_[layerIndex];
+
+		layersReversedOrder_.emplace_back(frame, mask, boundingBox);
+
+		/**
+		 * the homography of the finest layer is adjusted to the resolution of the synthesis layer
+		 * layer_H = S^-1 * H * S, with S = diag(2^layerIndex, 2^layerIndex, 1)
+		 */
+		const Scalar layerFactor = Scalar(1u << layerIndex);
+
+		SquareMatrix3 previous_H_currentLayer(previous_H_current);
+		previous_H_currentLayer(0, 2) /= layerFactor;
+		previous_H_currentLayer(1, 2) /= layerFactor;
+		previous_H_currentLayer(2, 0) *= layerFactor;
+		previous_H_currentLayer(2, 1) *= layerFactor;
+
+		const LayerI1& previousLayer = previousPyramid.layersReversedOrder_[iterationIndex];
+		const LayerI1* coarserLayer = iterationIndex == 0u ? nullptr : &layersReversedOrder_[layersReversedOrder_.size() - 2];
+
+		InitializerHomographyMappingAdaptionI1(layersReversedOrder_.back(), randomGenerator, previousLayer, previous_H_currentLayer, coarserLayer).invoke(worker);
+
+		if (optimizationTechnique_ == OT_CHECKERBOARD)
+		{
+			Optimizer4NeighborhoodHighPerformanceCheckerboardI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
+		}
+		else
+		{
+			Optimizer4NeighborhoodHighPerformanceI1<5u, 25u, true>(layersReversedOrder_.back(), randomGenerator).invoke(5u, optimizationIterations, maxSpatialCostLayer, worker, true);
+		}
+	}
+
+	return true;
+}
+
 bool SynthesisPyramidI1::createInpaintingResult(Frame& frame, Worker* worker) const
 {
 	ocean_assert(!layersReversedOrder_.empty());
@@ -15,6 +15,8 @@
 
 #include "ocean/base/RandomGenerator.h"
 
+#include "ocean/math/SquareMatrix3.h"
+
 namespace Ocean
 {
 
@@ -35,6 +37,17 @@ class OCEAN_CV_SYNTHESIS_EXPORT SynthesisPyramidI1 : public SynthesisPyramid
 		// We want to use all implementations in this class.
 		using SynthesisPyramid::applyInpainting;
 
+		/**
+		 * Definition of individual optimization techniques for mappings without filter.
+		 */
+		enum OptimizationTechnique : uint32_t
+		{
+			/// The mapping is propagated in scanline order within individual subsets, the default technique.
+			OT_SCANLINE = 0u,
+			/// The mapping is optimized in tiles arranged in a checkerboard pattern, scales better with the number of threads.
+			OT_CHECKERBOARD
+		};
+
 	public:
 
 		/**
@@ -64,6 +77,19 @@ class OCEAN_CV_SYNTHESIS_EXPORT SynthesisPyramidI1 : public SynthesisPyramid
 		 */
 		inline size_t layers() const;
 
+		/**
+		 * Returns the optimization technique which is applied on all layers without filter.
+		 * @return The optimization technique
+		 */
+		inline OptimizationTechnique optimizationTechnique() const;
+
+		/**
+		 * Sets the optimization technique which is applied on all layers without filter.
+		 * The checkerboard technique does not apply skipping layers.
+		 * @param optimizationTechnique The optimization technique to be applied
+		 */
+		inline void setOptimizationTechnique(const OptimizationTechnique optimizationTechnique);
+
 		/**
 		 * Applies the inpainting on an initialized synthesis pyramid while a specific initialization technique is used on the coarsest pyramid layer.
 		 * @see SynthesisPyramid::applyInpainting().
@@ -84,6 +110,23 @@ class OCEAN_CV_SYNTHESIS_EXPORT SynthesisPyramidI1 : public SynthesisPyramid
 		 */
 		bool applyInpainting(const Constraints& constraints, RandomGenerator& randomGenerator, const unsigned int weightFactor = 5u, const unsigned int borderFactor = 26u, const unsigned int maxSpatialCost = (unsigned int)(-1), const unsigned int optimizationIterations = 4u, const unsigned int skippingConstraintLayers = 2u, Worker* worker = nullptr);
 
+		/**
+		 * Applies the inpainting on an initialized synthesis pyramid while the mappings of the pyramid of the previous video frame are used for initialization.
+		 * The mapping of each layer is adapted from the corresponding layer of the previous pyramid by application of the homography between both frames, e.g., determined by a homography tracker.<br>
+		 * As the adapted mappings are almost converged, a reduced number of optimization iterations is sufficient which allows real-time video inpainting with high temporal stability.<br>
+		 * The previous pyramid must have been arranged with the same frame dimension, synthesis mask filters are not supported.
+		 * @param previousPyramid The synthesis pyramid of the previous frame with final mappings, with same number of layers and layer dimensions as this pyramid, must not be this pyramid
+		 * @param previous_H_current The homography transforming a point defined in the current (finest) frame into a point defined in the previous (finest) frame: previousPoint = previous_H_current * currentPoint, must be valid
+		 * @param randomGenerator The random number generator to be used
+		 * @param weightFactor Spatial weight impact, with range [0, infinity)
+		 * @param borderFactor Weight factor of border pixels, with range [1, infinity)
+		 * @param maxSpatialCost Maximal spatial cost, with range [0, 0xFFFFFFFF]
+		 * @param optimizationIterations The number of optimization iterations on each pyramid layer, with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded; False, if the previous pyramid does not match with this pyramid so that a default inpainting must be applied
+		 */
+		bool applyInpainting(const SynthesisPyramidI1& previousPyramid, const SquareMatrix3& previous_H_current, RandomGenerator& randomGenerator, const unsigned int weightFactor = 5u, const unsigned int borderFactor = 26u, const unsigned int maxSpatialCost = (unsigned int)(-1), const unsigned int optimizationIterations = 1u, Worker* worker = nullptr);
+
 		/**
 		 * Creates the final inpainting result for the finest pyramid layer.
 		 * @see SynthesisPyramid::createInpaintingResult().
@@ -100,6 +143,9 @@ class OCEAN_CV_SYNTHESIS_EXPORT SynthesisPyramidI1 : public SynthesisPyramid
 
 		/// The individual synthesis layers for individual frame resolutions with reversed layer order.
 		LayersI1 layersReversedOrder_;
+
+		/// The optimization technique which is applied on all layers without filter.
+		OptimizationTechnique optimizationTechnique_ = OT_SCANLINE;
 };
 
 inline SynthesisPyramidI1::SynthesisPyramidI1() :
@@ -125,6 +171,16 @@ inline size_t SynthesisPyramidI1::layers() const
 	return layersReversedOrder_.size();
 }
 
+inline SynthesisPyramidI1::OptimizationTechnique SynthesisPyramidI1::optimizationTechnique() const
+{
+	return optimizationTechnique_;
+}
+
+inline void SynthesisPyramidI1::setOptimizationTechnique(const OptimizationTechnique optimizationTechnique)
+{
+	optimizationTechnique_ = optimizationTechnique;
+}
+
 inline SynthesisPyramidI1::operator bool() const
 {
 	return !layersReversedOrder_.empty();
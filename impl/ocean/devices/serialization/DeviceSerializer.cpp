@@ -7,6 +7,8 @@
 
 #include "ocean/devices/serialization/DeviceSerializer.h"
 
+#include "ocean/io/Compression.h"
+
 namespace Ocean
 {
 
@@ -865,6 +867,814 @@ IO::Serialization::UniqueDataSample DeviceSerializer::DataSampleGPSTracker::crea
 	return std::make_unique<DataSampleGPSTracker>();
 }
 
+DeviceSerializer::DataSampleSensorChunk::DataSampleSensorChunk(UniqueDataSamples&& samples, const Timestamps& sampleCreationTimestamps) :
+	DataSample(samples.empty() ? IO::Serialization::DataTimestamp() : samples.front()->dataTimestamp(), sampleCreationTimestamps.empty() ? Timestamp(true) : sampleCreationTimestamps.back()),
+	samples_(std::move(samples)),
+	sampleCreationTimestamps_(sampleCreationTimestamps)
+{
+	ocean_assert(!samples_.empty());
+	ocean_assert(samples_.size() == sampleCreationTimestamps_.size());
+
+	chunkCreationTimestamp_ = sampleCreationTimestamps_.empty() ? Timestamp(false) : sampleCreationTimestamps_.back();
+}
+
+bool DeviceSerializer::DataSampleSensorChunk::readSample(IO::InputBitstream& inputBitstream)
+{
+	samples_.clear();
+	sampleCreationTimestamps_.clear();
+
+	if (!DataSample::readSample(inputBitstream))
+	{
+		return false;
+	}
+
+	uint32_t version = uint32_t(-1);
+	if (!inputBitstream.read<uint32_t>(version) || version != 0u)
+	{
+		return false;
+	}
+
+	uint32_t rawSize = 0u;
+	uint32_t compressedSize = 0u;
+	if (!inputBitstream.read<uint32_t>(rawSize) || !inputBitstream.read<uint32_t>(compressedSize))
+	{
+		return false;
+	}
+
+	if (compressedSize == 0u || uint64_t(compressedSize) > inputBitstream.size() - inputBitstream.position())
+	{
+		return false;
+	}
+
+	Buffer compressedBuffer(compressedSize);
+	if (!inputBitstream.read(compressedBuffer.data(), compressedBuffer.size()))
+	{
+		return false;
+	}
+
+	Buffer buffer;
+	if (!IO::Compression::gzipDecompress(compressedBuffer.data(), compressedBuffer.size(), buffer) || buffer.size() != size_t(rawSize))
+	{
+		return false;
+	}
+
+	if (!decodeColumns(buffer.data(), buffer.size()))
+	{
+		samples_.clear();
+		return false;
+	}
+
+	return true;
+}
+
+bool DeviceSerializer::DataSampleSensorChunk::writeSample(IO::OutputBitstream& outputBitstream) const
+{
+	ocean_assert(isValid());
+
+	Buffer buffer;
+	if (!encodeColumns(buffer))
+	{
+		return false;
+	}
+
+	Buffer compressedBuffer;
+	if (!IO::Compression::gzipCompress(buffer.data(), buffer.size(), compressedBuffer))
+	{
+		return false;
+	}
+
+	if (buffer.size() > size_t(NumericT<uint32_t>::maxValue()) || compressedBuffer.size() > size_t(NumericT<uint32_t>::maxValue()))
+	{
+		return false;
+	}
+
+	if (!DataSample::writeSample(outputBitstream))
+	{
+		return false;
+	}
+
+	constexpr uint32_t version = 0u;
+
+	if (!outputBitstream.write<uint32_t>(version) || !outputBitstream.write<uint32_t>(uint32_t(buffer.size())) || !outputBitstream.write<uint32_t>(uint32_t(compressedBuffer.size())))
+	{
+		return false;
+	}
+
+	return outputBitstream.write(compressedBuffer.data(), compressedBuffer.size());
+}
+
+bool DeviceSerializer::DataSampleSensorChunk::isSupportedSampleType(const std::string& sampleType)
+{
+	return translateSampleType(sampleType) != CST_INVALID;
+}
+
+IO::Serialization::UniqueDataSample DeviceSerializer::DataSampleSensorChunk::createSample(const std::string& /*sampleType*/)
+{
+	return std::make_unique<DataSampleSensorChunk>();
+}
+
+bool DeviceSerializer::DataSampleSensorChunk::encodeColumns(Buffer& buffer) const
+{
+	ocean_assert(buffer.empty());
+
+	if (samples_.empty() || samples_.size() > maximalMeasurements_ || samples_.size() != sampleCreationTimestamps_.size())
+	{
+		return false;
+	}
+
+	const ChunkSampleType chunkSampleType = translateSampleType(samples_.front()->type());
+
+	if (chunkSampleType == CST_INVALID)
+	{
+		return false;
+	}
+
+	const unsigned int components = measurementComponents(chunkSampleType);
+
+	const size_t numberSamples = samples_.size();
+
+	std::vector<uint8_t> timestampTypes;
+	std::vector<uint64_t> dataTimestamps;
+	std::vector<uint64_t> playbackTimestamps;
+	std::vector<uint32_t> numberMeasurements;
+	std::vector<int8_t> referenceSystems;
+
+	timestampTypes.reserve(numberSamples);
+	dataTimestamps.reserve(numberSamples);
+	playbackTimestamps.reserve(numberSamples);
+	numberMeasurements.reserve(numberSamples);
+	referenceSystems.reserve(numberSamples);
+
+	Indices32 objectIds;
+	std::vector<float> values;
+
+	Indices32 previousObjectIds;
+	Indices32 sampleObjectIds;
+
+	uint64_t previousDataTimestamp = 0ull;
+	uint64_t previousPlaybackTimestamp = 0ull;
+	uint32_t previousNumberMeasurements = 0u;
+
+	for (size_t nSample = 0; nSample < numberSamples; ++nSample)
+	{
+		const IO::Serialization::DataSample& sample = *samples_[nSample];
+
+		if (sample.type() != samples_.front()->type())
+		{
+			ocean_assert(false && "All samples of a chunk must have the same type!");
+			return false;
+		}
+
+		// data timestamps: XOR of the bit representation for floating point values, delta for integer values
+
+		const IO::Serialization::DataTimestamp& dataTimestamp = sample.dataTimestamp();
+
+		uint64_t dataTimestampBits = 0ull;
+
+		if (dataTimestamp.isDouble())
+		{
+			const double value = dataTimestamp.asDouble();
+			memcpy(&dataTimestampBits, &value, sizeof(value));
+
+			timestampTypes.emplace_back(uint8_t(0u));
+			dataTimestamps.emplace_back(dataTimestampBits ^ previousDataTimestamp);
+		}
+		else if (dataTimestamp.isInt())
+		{
+			const int64_t value = dataTimestamp.asInt();
+			memcpy(&dataTimestampBits, &value, sizeof(value));
+
+			timestampTypes.emplace_back(uint8_t(1u));
+			dataTimestamps.emplace_back(dataTimestampBits - previousDataTimestamp);
+		}
+		else
+		{
+			return false;
+		}
+
+		previousDataTimestamp = dataTimestampBits;
+
+		// the playback timestamps of the individual samples are derived from the chunk's playback timestamp and the creation timestamps
+
+		const double playbackTimestamp = std::max(0.0, playbackTimestamp_ + double(sampleCreationTimestamps_[nSample] - chunkCreationTimestamp_));
+
+		uint64_t playbackTimestampBits = 0ull;
+		memcpy(&playbackTimestampBits, &playbackTimestamp, sizeof(playbackTimestamp));
+
+		playbackTimestamps.emplace_back(playbackTimestampBits ^ previousPlaybackTimestamp);
+		previousPlaybackTimestamp = playbackTimestampBits;
+
+		const size_t objectIdsBefore = objectIds.size();
+
+		int8_t referenceSystem = -1;
+		if (!extractSample(chunkSampleType, sample, objectIds, referenceSystem, values))
+		{
+			return false;
+		}
+
+		const uint32_t sampleMeasurements = uint32_t(objectIds.size() - objectIdsBefore);
+
+		numberMeasurements.emplace_back(sampleMeasurements - previousNumberMeasurements);
+		previousNumberMeasurements = sampleMeasurements;
+
+		referenceSystems.emplace_back(referenceSystem);
+
+		// object ids are XOR-ed with the object id at the same location in the previous sample, object ids rarely change
+
+		sampleObjectIds.assign(objectIds.cbegin() + objectIdsBefore, objectIds.cend());
+
+		for (size_t n = 0; n < sampleObjectIds.size() && n < previousObjectIds.size(); ++n)
+		{
+			objectIds[objectIdsBefore + n] ^= previousObjectIds[n];
+		}
+
+		std::swap(previousObjectIds, sampleObjectIds);
+	}
+
+	ocean_assert(values.size() == objectIds.size() * size_t(components));
+	const size_t totalMeasurements = objectIds.size();
+
+	buffer.reserve(16 + numberSamples * 32 + totalMeasurements * (1 + components) * 4);
+
+	const uint32_t numberSamples32 = uint32_t(numberSamples);
+	appendBytePlanes(&numberSamples32, 1, buffer);
+	buffer.emplace_back(uint8_t(chunkSampleType));
+
+	appendBytePlanes(timestampTypes.data(), timestampTypes.size(), buffer);
+	appendBytePlanes(dataTimestamps.data(), dataTimestamps.size(), buffer);
+	appendBytePlanes(playbackTimestamps.data(), playbackTimestamps.size(), buffer);
+	appendBytePlanes(numberMeasurements.data(), numberMeasurements.size(), buffer);
+	appendBytePlanes(referenceSystems.data(), referenceSystems.size(), buffer);
+	appendBytePlanes(objectIds.data(), objectIds.size(), buffer);
+
+	// each component of the measurements is stored in an own column, the bits of each value are XOR-ed with the previous value of the same column
+
+	Indices32 column(totalMeasurements);
+
+	for (unsigned int nComponent = 0u; nComponent < components; ++nComponent)
+	{
+		uint32_t previousValue = 0u;
+
+		for (size_t n = 0; n < totalMeasurements; ++n)
+		{
+			static_assert(sizeof(float) == sizeof(uint32_t), "Invalid data type!");
+
+			uint32_t value = 0u;
+			memcpy(&value, &values[n * components + nComponent], sizeof(value));
+
+			column[n] = value ^ previousValue;
+			previousValue = value;
+		}
+
+		appendBytePlanes(column.data(), column.size(), buffer);
+	}
+
+	return true;
+}
+
+bool DeviceSerializer::DataSampleSensorChunk::decodeColumns(const uint8_t* buffer, const size_t size)
+{
+	ocean_assert(buffer != nullptr);
+	ocean_assert(samples_.empty());
+
+	size_t remainingSize = size;
+
+	uint32_t numberSamples = 0u;
+	if (!readBytePlanes(buffer, remainingSize, &numberSamples, 1) || numberSamples == 0u || numberSamples > maximalMeasurements_)
+	{
+		return false;
+	}
+
+	if (remainingSize < 1)
+	{
+		return false;
+	}
+
+	const ChunkSampleType chunkSampleType = ChunkSampleType(*buffer);
+	++buffer;
+	--remainingSize;
+
+	if (chunkSampleType <= CST_INVALID || chunkSampleType >= CST_END)
+	{
+		return false;
+	}
+
+	const unsigned int components = measurementComponents(chunkSampleType);
+
+	// each sample needs at least 22 bytes, so that we can detect a corrupted number of samples before allocating memory
+
+	if (size_t(numberSamples) > remainingSize / 22)
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> timestampTypes(numberSamples);
+	std::vector<uint64_t> dataTimestamps(numberSamples);
+	std::vector<uint64_t> playbackTimestamps(numberSamples);
+	std::vector<uint32_t> numberMeasurements(numberSamples);
+	std::vector<int8_t> referenceSystems(numberSamples);
+
+	if (!readBytePlanes(buffer, remainingSize, timestampTypes.data(), timestampTypes.size())
+			|| !readBytePlanes(buffer, remainingSize, dataTimestamps.data(), dataTimestamps.size())
+			|| !readBytePlanes(buffer, remainingSize, playbackTimestamps.data(), playbackTimestamps.size())
+			|| !readBytePlanes(buffer, remainingSize, numberMeasurements.data(), numberMeasurements.size())
+			|| !readBytePlanes(buffer, remainingSize, referenceSystems.data(), referenceSystems.size()))
+	{
+		return false;
+	}
+
+	uint64_t totalMeasurements = 0ull;
+	uint32_t previousNumberMeasurements = 0u;
+
+	for (uint32_t& sampleMeasurements : numberMeasurements)
+	{
+		sampleMeasurements += previousNumberMeasurements;
+		previousNumberMeasurements = sampleMeasurements;
+
+		if (sampleMeasurements > maximalMeasurements_)
+		{
+			return false;
+		}
+
+		totalMeasurements += uint64_t(sampleMeasurements);
+	}
+
+	if (totalMeasurements * uint64_t(1u + components) * 4ull != uint64_t(remainingSize))
+	{
+		return false;
+	}
+
+	const size_t measurements = size_t(totalMeasurements);
+
+	Indices32 objectIds(measurements);
+	if (!readBytePlanes(buffer, remainingSize, objectIds.data(), objectIds.size()))
+	{
+		return false;
+	}
+
+	std::vector<float> values(measurements * components);
+	Indices32 column(measurements);
+
+	for (unsigned int nComponent = 0u; nComponent < components; ++nComponent)
+	{
+		if (!readBytePlanes(buffer, remainingSize, column.data(), column.size()))
+		{
+			return false;
+		}
+
+		uint32_t previousValue = 0u;
+
+		for (size_t n = 0; n < column.size(); ++n)
+		{
+			const uint32_t value = column[n] ^ previousValue;
+			previousValue = value;
+
+			memcpy(&values[n * components + nComponent], &value, sizeof(value));
+		}
+	}
+
+	ocean_assert(remainingSize == 0);
+
+	samples_.reserve(numberSamples);
+
+	uint64_t previousDataTimestamp = 0ull;
+	uint64_t previousPlaybackTimestamp = 0ull;
+
+	size_t measurementOffset = 0;
+	size_t previousMeasurementOffset = 0;
+	size_t previousSampleMeasurements = 0;
+
+	for (size_t nSample = 0; nSample < size_t(numberSamples); ++nSample)
+	{
+		IO::Serialization::DataTimestamp dataTimestamp;
+
+		uint64_t dataTimestampBits = 0ull;
+
+		if (timestampTypes[nSample] == 0u)
+		{
+			dataTimestampBits = dataTimestamps[nSample] ^ previousDataTimestamp;
+
+			double value = 0.0;
+			memcpy(&value, &dataTimestampBits, sizeof(value));
+
+			dataTimestamp = IO::Serialization::DataTimestamp(value);
+		}
+		else if (timestampTypes[nSample] == 1u)
+		{
+			dataTimestampBits = dataTimestamps[nSample] + previousDataTimestamp;
+
+			int64_t value = 0ll;
+			memcpy(&value, &dataTimestampBits, sizeof(value));
+
+			dataTimestamp = IO::Serialization::DataTimestamp(value);
+		}
+		else
+		{
+			return false;
+		}
+
+		previousDataTimestamp = dataTimestampBits;
+
+		const uint64_t playbackTimestampBits = playbackTimestamps[nSample] ^ previousPlaybackTimestamp;
+		previousPlaybackTimestamp = playbackTimestampBits;
+
+		double playbackTimestamp = 0.0;
+		memcpy(&playbackTimestamp, &playbackTimestampBits, sizeof(playbackTimestamp));
+
+		const size_t sampleMeasurements = size_t(numberMeasurements[nSample]);
+
+		for (size_t n = 0; n < sampleMeasurements && n < previousSampleMeasurements; ++n)
+		{
+			objectIds[measurementOffset + n] ^= objectIds[previousMeasurementOffset + n];
+		}
+
+		IO::Serialization::UniqueDataSample sample = createChunkSample(chunkSampleType, playbackTimestamp, dataTimestamp, objectIds.data() + measurementOffset, referenceSystems[nSample], values.data() + measurementOffset * components, sampleMeasurements);
+
+		if (!sample)
+		{
+			return false;
+		}
+
+		samples_.emplace_back(std::move(sample));
+
+		previousMeasurementOffset = measurementOffset;
+		previousSampleMeasurements = sampleMeasurements;
+
+		measurementOffset += sampleMeasurements;
+	}
+
+	return true;
+}
+
+DeviceSerializer::DataSampleSensorChunk::ChunkSampleType DeviceSerializer::DataSampleSensorChunk::translateSampleType(const std::string& sampleType)
+{
+	if (sampleType == DataSampleOrientationTracker3DOF::sampleType())
+	{
+		return CST_ORIENTATION_TRACKER_3DOF;
+	}
+
+	if (sampleType == DataSampleAccelerationSensor3DOF::sampleType())
+	{
+		return CST_ACCELERATION_SENSOR_3DOF;
+	}
+
+	if (sampleType == DataSampleGyroSensor3DOF::sampleType())
+	{
+		return CST_GYRO_SENSOR_3DOF;
+	}
+
+	if (sampleType == DataSampleGravityTracker3DOF::sampleType())
+	{
+		return CST_GRAVITY_TRACKER_3DOF;
+	}
+
+	if (sampleType == DataSamplePositionTracker3DOF::sampleType())
+	{
+		return CST_POSITION_TRACKER_3DOF;
+	}
+
+	if (sampleType == DataSampleTracker6DOF::sampleType())
+	{
+		return CST_TRACKER_6DOF;
+	}
+
+	return CST_INVALID;
+}
+
+unsigned int DeviceSerializer::DataSampleSensorChunk::measurementComponents(const ChunkSampleType chunkSampleType)
+{
+	switch (chunkSampleType)
+	{
+		case CST_ORIENTATION_TRACKER_3DOF:
+			return 4u;
+
+		case CST_ACCELERATION_SENSOR_3DOF:
+		case CST_GYRO_SENSOR_3DOF:
+		case CST_GRAVITY_TRACKER_3DOF:
+		case CST_POSITION_TRACKER_3DOF:
+			return 3u;
+
+		case CST_TRACKER_6DOF:
+			return 7u;
+
+		case CST_INVALID:
+		case CST_END:
+			break;
+	}
+
+	ocean_assert(false && "Invalid sample type!");
+	return 0u;
+}
+
+bool DeviceSerializer::DataSampleSensorChunk::extractSample(const ChunkSampleType chunkSampleType, const IO::Serialization::DataSample& sample, Indices32& objectIds, int8_t& referenceSystem, std::vector<float>& values)
+{
+	ocean_assert(translateSampleType(sample.type()) == chunkSampleType);
+
+	const auto appendVectors = [&values](const VectorsF3& vectors)
+	{
+		for (const VectorF3& vector : vectors)
+		{
+			values.insert(values.end(), {vector.x(), vector.y(), vector.z()});
+		}
+	};
+
+	switch (chunkSampleType)
+	{
+		case CST_ORIENTATION_TRACKER_3DOF:
+		{
+			const DataSampleOrientationTracker3DOF& trackerSample = static_cast<const DataSampleOrientationTracker3DOF&>(sample);
+
+			if (trackerSample.objectIds_.size() != trackerSample.orientations_.size())
+			{
+				return false;
+			}
+
+			objectIds.insert(objectIds.end(), trackerSample.objectIds_.cbegin(), trackerSample.objectIds_.cend());
+			referenceSystem = trackerSample.referenceSystem_;
+
+			for (const QuaternionF& orientation : trackerSample.orientations_)
+			{
+				values.insert(values.end(), {orientation.w(), orientation.x(), orientation.y(), orientation.z()});
+			}
+
+			return true;
+		}
+
+		case CST_ACCELERATION_SENSOR_3DOF:
+		{
+			const DataSampleAccelerationSensor3DOF& sensorSample = static_cast<const DataSampleAccelerationSensor3DOF&>(sample);
+
+			if (sensorSample.objectIds_.size() != sensorSample.measurements_.size())
+			{
+				return false;
+			}
+
+			objectIds.insert(objectIds.end(), sensorSample.objectIds_.cbegin(), sensorSample.objectIds_.cend());
+			referenceSystem = -1;
+
+			appendVectors(sensorSample.measurements_);
+
+			return true;
+		}
+
+		case CST_GYRO_SENSOR_3DOF:
+		{
+			const DataSampleGyroSensor3DOF& sensorSample = static_cast<const DataSampleGyroSensor3DOF&>(sample);
+
+			if (sensorSample.objectIds_.size() != sensorSample.measurements_.size())
+			{
+				return false;
+			}
+
+			objectIds.insert(objectIds.end(), sensorSample.objectIds_.cbegin(), sensorSample.objectIds_.cend());
+			referenceSystem = -1;
+
+			appendVectors(sensorSample.measurements_);
+
+			return true;
+		}
+
+		case CST_GRAVITY_TRACKER_3DOF:
+		{
+			const DataSampleGravityTracker3DOF& trackerSample = static_cast<const DataSampleGravityTracker3DOF&>(sample);
+
+			if (trackerSample.objectIds_.size() != trackerSample.gravities_.size())
+			{
+				return false;
+			}
+
+			objectIds.insert(objectIds.end(), trackerSample.objectIds_.cbegin(), trackerSample.objectIds_.cend());
+			referenceSystem = trackerSample.referenceSystem_;
+
+			appendVectors(trackerSample.gravities_);
+
+			return true;
+		}
+
+		case CST_POSITION_TRACKER_3DOF:
+		{
+			const DataSamplePositionTracker3DOF& trackerSample = static_cast<const DataSamplePositionTracker3DOF&>(sample);
+
+			if (trackerSample.objectIds_.size() != trackerSample.positions_.size())
+			{
+				return false;
+			}
+
+			objectIds.insert(objectIds.end(), trackerSample.objectIds_.cbegin(), trackerSample.objectIds_.cend());
+			referenceSystem = trackerSample.referenceSystem_;
+
+			appendVectors(trackerSample.positions_);
+
+			return true;
+		}
+
+		case CST_TRACKER_6DOF:
+		{
+			const DataSampleTracker6DOF& trackerSample = static_cast<const DataSampleTracker6DOF&>(sample);
+
+			if (trackerSample.objectIds_.size() != trackerSample.orientations_.size() || trackerSample.objectIds_.size() != trackerSample.positions_.size())
+			{
+				return false;
+			}
+
+			objectIds.insert(objectIds.end(), trackerSample.objectIds_.cbegin(), trackerSample.objectIds_.cend());
+			referenceSystem = trackerSample.referenceSystem_;
+
+			for (size_t n = 0; n < trackerSample.objectIds_.size(); ++n)
+			{
+				const QuaternionF& orientation = trackerSample.orientations_[n];
+				const VectorF3& position = trackerSample.positions_[n];
+
+				values.insert(values.end(), {orientation.w(), orientation.x(), orientation.y(), orientation.z(), position.x(), position.y(), position.z()});
+			}
+
+			return true;
+		}
+
+		case CST_INVALID:
+		case CST_END:
+			break;
+	}
+
+	ocean_assert(false && "Invalid sample type!");
+	return false;
+}
+
+IO::Serialization::UniqueDataSample DeviceSerializer::DataSampleSensorChunk::createChunkSample(const ChunkSampleType chunkSampleType, const double playbackTimestamp, const IO::Serialization::DataTimestamp& dataTimestamp, const Index32* objectIds, const int8_t referenceSystem, const float* values, const size_t numberMeasurements)
+{
+	ocean_assert(numberMeasurements == 0 || (objectIds != nullptr && values != nullptr));
+
+	const auto assignVectors = [values, numberMeasurements](VectorsF3& vectors)
+	{
+		vectors.reserve(numberMeasurements);
+
+		for (size_t n = 0; n < numberMeasurements; ++n)
+		{
+			vectors.emplace_back(values[n * 3 + 0], values[n * 3 + 1], values[n * 3 + 2]);
+		}
+	};
+
+	switch (chunkSampleType)
+	{
+		case CST_ORIENTATION_TRACKER_3DOF:
+		{
+			std::unique_ptr<DataSampleOrientationTracker3DOF> sample = std::make_unique<DataSampleOrientationTracker3DOF>();
+
+			sample->playbackTimestamp_ = playbackTimestamp;
+			sample->dataTimestamp_ = dataTimestamp;
+			sample->objectIds_.assign(objectIds, objectIds + numberMeasurements);
+			sample->referenceSystem_ = referenceSystem;
+
+			sample->orientations_.reserve(numberMeasurements);
+			for (size_t n = 0; n < numberMeasurements; ++n)
+			{
+				sample->orientations_.emplace_back(values[n * 4 + 0], values[n * 4 + 1], values[n * 4 + 2], values[n * 4 + 3]);
+			}
+
+			return sample;
+		}
+
+		case CST_ACCELERATION_SENSOR_3DOF:
+		{
+			std::unique_ptr<DataSampleAccelerationSensor3DOF> sample = std::make_unique<DataSampleAccelerationSensor3DOF>();
+
+			sample->playbackTimestamp_ = playbackTimestamp;
+			sample->dataTimestamp_ = dataTimestamp;
+			sample->objectIds_.assign(objectIds, objectIds + numberMeasurements);
+
+			assignVectors(sample->measurements_);
+
+			return sample;
+		}
+
+		case CST_GYRO_SENSOR_3DOF:
+		{
+			std::unique_ptr<DataSampleGyroSensor3DOF> sample = std::make_unique<DataSampleGyroSensor3DOF>();
+
+			sample->playbackTimestamp_ = playbackTimestamp;
+			sample->dataTimestamp_ = dataTimestamp;
+			sample->objectIds_.assign(objectIds, objectIds + numberMeasurements);
+
+			assignVectors(sample->measurements_);
+
+			return sample;
+		}
+
+		case CST_GRAVITY_TRACKER_3DOF:
+		{
+			std::unique_ptr<DataSampleGravityTracker3DOF> sample = std::make_unique<DataSampleGravityTracker3DOF>();
+
+			sample->playbackTimestamp_ = playbackTimestamp;
+			sample->dataTimestamp_ = dataTimestamp;
+			sample->objectIds_.assign(objectIds, objectIds + numberMeasurements);
+			sample->referenceSystem_ = referenceSystem;
+
+			assignVectors(sample->gravities_);
+
+			return sample;
+		}
+
+		case CST_POSITION_TRACKER_3DOF:
+		{
+			std::unique_ptr<DataSamplePositionTracker3DOF> sample = std::make_unique<DataSamplePositionTracker3DOF>();
+
+			sample->playbackTimestamp_ = playbackTimestamp;
+			sample->dataTimestamp_ = dataTimestamp;
+			sample->objectIds_.assign(objectIds, objectIds + numberMeasurements);
+			sample->referenceSystem_ = referenceSystem;
+
+			assignVectors(sample->positions_);
+
+			return sample;
+		}
+
+		case CST_TRACKER_6DOF:
+		{
+			std::unique_ptr<DataSampleTracker6DOF> sample = std::make_unique<DataSampleTracker6DOF>();
+
+			sample->playbackTimestamp_ = playbackTimestamp;
+			sample->dataTimestamp_ = dataTimestamp;
+			sample->objectIds_.assign(objectIds, objectIds + numberMeasurements);
+			sample->referenceSystem_ = referenceSystem;
+
+			sample->orientations_.reserve(numberMeasurements);
+			sample->positions_.reserve(numberMeasurements);
+			for (size_t n = 0; n < numberMeasurements; ++n)
+			{
+				const float* value = values + n * 7;
+
+				sample->orientations_.emplace_back(value[0], value[1], value[2], value[3]);
+				sample->positions_.emplace_back(value[4], value[5], value[6]);
+			}
+
+			return sample;
+		}
+
+		case CST_INVALID:
+		case CST_END:
+			break;
+	}
+
+	ocean_assert(false && "Invalid sample type!");
+	return nullptr;
+}
+
+template <typename T>
+void DeviceSerializer::DataSampleSensorChunk::appendBytePlanes(const T* values, const size_t size, Buffer& buffer)
+{
+	static_assert(std::is_integral<T>::value, "Invalid data type!");
+
+	ocean_assert(values != nullptr || size == 0);
+
+	const size_t offset = buffer.size();
+	buffer.resize(offset + size * sizeof(T));
+
+	uint8_t* const planes = buffer.data() + offset;
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		const typename std::make_unsigned<T>::type value = typename std::make_unsigned<T>::type(values[n]);
+
+		for (size_t nByte = 0; nByte < sizeof(T); ++nByte)
+		{
+			planes[nByte * size + n] = uint8_t(value >> (nByte * 8));
+		}
+	}
+}
+
+template <typename T>
+bool DeviceSerializer::DataSampleSensorChunk::readBytePlanes(const uint8_t*& buffer, size_t& remainingSize, T* values, const size_t size)
+{
+	static_assert(std::is_integral<T>::value, "Invalid data type!");
+
+	ocean_assert(buffer != nullptr);
+	ocean_assert(values != nullptr || size == 0);
+
+	if (size > remainingSize / sizeof(T))
+	{
+		return false;
+	}
+
+	using UnsignedT = typename std::make_unsigned<T>::type;
+
+	for (size_t n = 0; n < size; ++n)
+	{
+		UnsignedT value = UnsignedT(0);
+
+		for (size_t nByte = 0; nByte < sizeof(T); ++nByte)
+		{
+			value = UnsignedT(value | (UnsignedT(buffer[nByte * size + n]) << (nByte * 8)));
+		}
+
+		values[n] = T(value);
+	}
+
+	buffer += size * sizeof(T);
+	remainingSize -= size * sizeof(T);
+
+	return true;
+}
+
 }
 
 }
@@ -99,6 +99,9 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 
 	public:
 
+		// Forward declaration.
+		class DataSampleSensorChunk;
+
 		/**
 		 * This class implements a data sample for 3DOF orientation tracker measurements.
 		 */
@@ -106,6 +109,8 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 			public IO::Serialization::DataSample,
 			public SampleTracker
 		{
+			friend class DataSampleSensorChunk;
+
 			public:
 
 				/**
@@ -188,6 +193,8 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 			public IO::Serialization::DataSample,
 			public SampleMeasurement
 		{
+			friend class DataSampleSensorChunk;
+
 			public:
 
 				/**
@@ -264,6 +271,8 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 			public IO::Serialization::DataSample,
 			public SampleMeasurement
 		{
+			friend class DataSampleSensorChunk;
+
 			public:
 
 				/**
@@ -340,6 +349,8 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 			public IO::Serialization::DataSample,
 			public SampleTracker
 		{
+			friend class DataSampleSensorChunk;
+
 			public:
 
 				/**
@@ -422,6 +433,8 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 			public IO::Serialization::DataSample,
 			public SampleTracker
 		{
+			friend class DataSampleSensorChunk;
+
 			public:
 
 				/**
@@ -504,6 +517,8 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 			public IO::Serialization::DataSample,
 			public SampleTracker
 		{
+			friend class DataSampleSensorChunk;
+
 			public:
 
 				/**
@@ -738,6 +753,219 @@ class OCEAN_DEVICES_EXPORT DeviceSerializer
 				/// The GPS locations.
 				Locations locations_;
 		};
+
+		/**
+		 * This class implements a data sample combining consecutive sensor or tracker samples of one channel in one chunk.
+		 * The chunk stores the samples column-wise, each column is encoded with XOR (floating point values) or delta (integer values) to the previous value in the column and is split into byte planes.<br>
+		 * The resulting buffer is compressed with gzip, so that chunks of high-frequency sensor data are several times smaller than the individual samples.<br>
+		 * Supported are 3DOF orientation tracker, 3DOF acceleration sensor, 3DOF gyro sensor, 3DOF gravity tracker, 3DOF position tracker, and 6DOF tracker samples.<br>
+		 * The data timestamp of the chunk is the data timestamp of the first sample in the chunk, the individual samples keep their own data and playback timestamps.
+		 * @see SerializerDeviceRecorder::setSensorChunking().
+		 */
+		class DataSampleSensorChunk : public IO::Serialization::DataSample
+		{
+			public:
+
+				/**
+				 * Definition of a vector holding unique data samples.
+				 */
+				using UniqueDataSamples = std::vector<IO::Serialization::UniqueDataSample>;
+
+			protected:
+
+				/**
+				 * Definition of individual sample types which can be stored in a chunk.
+				 */
+				enum ChunkSampleType : uint8_t
+				{
+					/// Invalid sample type.
+					CST_INVALID = 0u,
+					/// 3DOF orientation tracker samples.
+					CST_ORIENTATION_TRACKER_3DOF,
+					/// 3DOF acceleration sensor samples.
+					CST_ACCELERATION_SENSOR_3DOF,
+					/// 3DOF gyro sensor samples.
+					CST_GYRO_SENSOR_3DOF,
+					/// 3DOF gravity tracker samples.
+					CST_GRAVITY_TRACKER_3DOF,
+					/// 3DOF position tracker samples.
+					CST_POSITION_TRACKER_3DOF,
+					/// 6DOF tracker samples.
+					CST_TRACKER_6DOF,
+					/// The end of the sample types.
+					CST_END
+				};
+
+				/**
+				 * Definition of a vector holding bytes.
+				 */
+				using Buffer = std::vector<uint8_t>;
+
+			public:
+
+				/**
+				 * Creates a new empty chunk.
+				 */
+				DataSampleSensorChunk() = default;
+
+				/**
+				 * Creates a new chunk from consecutive samples of one channel.
+				 * @param samples The samples to be combined, all with the same supported sample type, in chronological order, at least one
+				 * @param sampleCreationTimestamps The timestamps when the individual samples were created, one for each sample, used to determine the playback timestamps of the samples
+				 */
+				DataSampleSensorChunk(UniqueDataSamples&& samples, const Timestamps& sampleCreationTimestamps);
+
+				/**
+				 * Reads the sample from an input bitstream.
+				 * @param inputBitstream The input bitstream from which the sample will be read
+				 * @return True, if succeeded
+				 * @see writeSample().
+				 */
+				bool readSample(IO::InputBitstream& inputBitstream) override;
+
+				/**
+				 * Writes the sample to an output bitstream.
+				 * @param outputBitstream The output bitstream to which the sample will be written
+				 * @return True, if succeeded
+				 * @see readSample().
+				 */
+				bool writeSample(IO::OutputBitstream& outputBitstream) const override;
+
+				/**
+				 * Returns the type of the sample.
+				 * @return The sample type
+				 * @see sampleType().
+				 */
+				inline const std::string& type() const override;
+
+				/**
+				 * Returns the samples of this chunk.
+				 * @return The chunk's samples, in chronological order
+				 */
+				inline const UniqueDataSamples& samples() const;
+
+				/**
+				 * Moves the samples out of this chunk.
+				 * @return The chunk's samples, in chronological order
+				 */
+				inline UniqueDataSamples extractSamples();
+
+				/**
+				 * Returns whether this chunk holds at least one sample.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+				/**
+				 * Returns whether samples of a given sample type can be stored in a chunk.
+				 * @param sampleType The sample type to check
+				 * @return True, if so
+				 */
+				static bool isSupportedSampleType(const std::string& sampleType);
+
+				/**
+				 * Returns the static sample type.
+				 * @return The sample type
+				 */
+				static inline const std::string& sampleType();
+
+				/**
+				 * Factory function for creating a DataSampleSensorChunk.
+				 * This function can be used with InputDataSerializer::registerFactoryFunction().
+				 * @param sampleType The sample type (unused, but required by the factory function signature)
+				 * @return A new DataSampleSensorChunk instance
+				 */
+				static IO::Serialization::UniqueDataSample createSample(const std::string& sampleType);
+
+			protected:
+
+				/**
+				 * Encodes the samples of this chunk into a column-wise buffer.
+				 * @param buffer The resulting buffer
+				 * @return True, if succeeded
+				 */
+				bool encodeColumns(Buffer& buffer) const;
+
+				/**
+				 * Decodes the samples of this chunk from a column-wise buffer.
+				 * @param buffer The buffer holding the columns, must be valid
+				 * @param size The size of the buffer, in bytes
+				 * @return True, if succeeded
+				 */
+				bool decodeColumns(const uint8_t* buffer, const size_t size);
+
+				/**
+				 * Translates a sample type to the corresponding chunk sample type.
+				 * @param sampleType The sample type to translate
+				 * @return The chunk sample type, CST_INVALID if the sample type is not supported
+				 */
+				static ChunkSampleType translateSampleType(const std::string& sampleType);
+
+				/**
+				 * Returns the number of float values of one measurement of a given chunk sample type.
+				 * @param chunkSampleType The chunk sample type, must be valid
+				 * @return The number of float values, with range [3, 7]
+				 */
+				static unsigned int measurementComponents(const ChunkSampleType chunkSampleType);
+
+				/**
+				 * Extracts the object ids, the reference system, and the measurement values of a sample.
+				 * @param chunkSampleType The chunk sample type of the sample, must be valid
+				 * @param sample The sample from which the values will be extracted
+				 * @param objectIds The object ids to which the sample's object ids will be appended
+				 * @param referenceSystem The resulting reference system of the sample, -1 for samples without reference system
+				 * @param values The values to which the sample's measurement values will be appended, measurementComponents() values for each measurement
+				 * @return True, if succeeded
+				 */
+				static bool extractSample(const ChunkSampleType chunkSampleType, const IO::Serialization::DataSample& sample, Indices32& objectIds, int8_t& referenceSystem, std::vector<float>& values);
+
+				/**
+				 * Creates a sample from object ids, a reference system, and measurement values.
+				 * @param chunkSampleType The chunk sample type of the sample, must be valid
+				 * @param playbackTimestamp The playback timestamp of the sample
+				 * @param dataTimestamp The data timestamp of the sample
+				 * @param objectIds The object ids of the sample, must be valid if numberMeasurements >= 1
+				 * @param referenceSystem The reference system of the sample
+				 * @param values The measurement values of the sample, measurementComponents() values for each measurement, must be valid if numberMeasurements >= 1
+				 * @param numberMeasurements The number of measurements of the sample, with range [0, maximalMeasurements_]
+				 * @return The new sample
+				 */
+				static IO::Serialization::UniqueDataSample createChunkSample(const ChunkSampleType chunkSampleType, const double playbackTimestamp, const IO::Serialization::DataTimestamp& dataTimestamp, const Index32* objectIds, const int8_t referenceSystem, const float* values, const size_t numberMeasurements);
+
+				/**
+				 * Appends values to a buffer as individual byte planes, first the lowest byte of all values, then the second byte of all values, and so on.
+				 * Byte planes of values encoded with XOR or delta hold long sequences of zeros which can be compressed well.
+				 * @param values The values to append, must be valid if size >= 1
+				 * @param size The number of values
+				 * @param buffer The buffer to which the byte planes will be appended
+				 * @tparam T The data type of the values
+				 */
+				template <typename T>
+				static void appendBytePlanes(const T* values, const size_t size, Buffer& buffer);
+
+				/**
+				 * Reads values from individual byte planes.
+				 * @param buffer The buffer from which the values will be read, will be moved to the end of the byte planes, must be valid
+				 * @param remainingSize The remaining size of the buffer, in bytes, will be reduced accordingly
+				 * @param values The resulting values, must be valid if size >= 1
+				 * @param size The number of values to read
+				 * @return True, if succeeded
+				 * @tparam T The data type of the values
+				 */
+				template <typename T>
+				static bool readBytePlanes(const uint8_t*& buffer, size_t& remainingSize, T* values, const size_t size);
+
+			protected:
+
+				/// The samples of this chunk, in chronological order.
+				UniqueDataSamples samples_;
+
+				/// The timestamps when the individual samples were created, empty for chunks which have been read.
+				Timestamps sampleCreationTimestamps_;
+
+				/// The timestamp when the chunk was created, which is the creation timestamp of the last sample.
+				Timestamp chunkCreationTimestamp_;
+		};
 };
 
 inline const std::string& DeviceSerializer::DataSampleOrientationTracker3DOF::type() const
@@ -917,6 +1145,32 @@ inline const std::string& DeviceSerializer::DataSampleGPSTracker::sampleType()
 	return typeName;
 }
 
+inline const std::string& DeviceSerializer::DataSampleSensorChunk::type() const
+{
+	return sampleType();
+}
+
+inline const DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples& DeviceSerializer::DataSampleSensorChunk::samples() const
+{
+	return samples_;
+}
+
+inline DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples DeviceSerializer::DataSampleSensorChunk::extractSamples()
+{
+	return std::move(samples_);
+}
+
+inline bool DeviceSerializer::DataSampleSensorChunk::isValid() const
+{
+	return !samples_.empty();
+}
+
+inline const std::string& DeviceSerializer::DataSampleSensorChunk::sampleType()
+{
+	static const std::string typeName = "ocean/devices/datasamplesensorchunk";
+	return typeName;
+}
+
 
 
 }
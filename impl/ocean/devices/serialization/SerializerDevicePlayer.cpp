@@ -15,6 +15,7 @@
 #include "ocean/devices/serialization/SerializationPositionTracker3DOF.h"
 #include "ocean/devices/serialization/SerializationTracker6DOF.h"
 
+#include "ocean/base/Processor.h"
 #include "ocean/base/Timestamp.h"
 
 #include "ocean/devices/AccelerationSensor3DOF.h"
@@ -82,7 +83,7 @@ bool SerializerDevicePlayer::initialize(const std::string& filename)
 
 	inputSerializer_ = std::make_unique<IO::Serialization::FileInputDataSerializer>();
 
-	if (!inputSerializer_->setFilename(filename))
+	if (!inputSerializer_->setFilename(filename) || !inputSerializer_->setUseMemoryMapping(useMemoryMapping_))
 	{
 		inputSerializer_ = nullptr;
 		UsageManager::get().unregisterUsage();
@@ -223,7 +224,7 @@ Timestamp SerializerDevicePlayer::playNextFrame()
 		}
 		else
 		{
-			samplePair.second = inputSerializer_->sample(samplePair.first, 0.0 /*speed*/);
+			samplePair.second = nextSample(samplePair.first, 0.0 /*speed*/, stopMotionChunkedSampleQueue_);
 		}
 
 		if (!samplePair.second)
@@ -266,6 +267,18 @@ Timestamp SerializerDevicePlayer::playNextFrame()
 
 			const double maxPlaybackTimestamp = samplePair.second->playbackTimestamp() + 0.5; // 0.5 seconds
 
+			if (decodeThreadPool_)
+			{
+				// the frame is decoded together with the upcoming frames while the lookahead samples are processed
+
+				const IO::Serialization::MediaSerializer::DataSampleFrame* frameSample = dynamic_cast<const IO::Serialization::MediaSerializer::DataSampleFrame*>(samplePair.second.get());
+
+				if (frameSample != nullptr && frameSample->isValid())
+				{
+					decodeFramesAhead(samplePair.first, *frameSample);
+				}
+			}
+
 			processLookaheadSamples(lookaheadDataTimestamp, maxPlaybackTimestamp);
 
 			processSample(samplePair.first, std::move(samplePair.second));
@@ -281,6 +294,92 @@ Timestamp SerializerDevicePlayer::playNextFrame()
 	return Timestamp(false);
 }
 
+bool SerializerDevicePlayer::seek(const Timestamp& timestamp)
+{
+	ocean_assert(timestamp.isValid());
+
+	const ScopedLock scopedLock(lock_);
+
+	if (!inputSerializer_ || !ensureIndex())
+	{
+		return false;
+	}
+
+	const IO::Serialization::SampleIndex& sampleIndex = inputSerializer_->index();
+
+	// we determine the earliest playback timestamp of all samples with data timestamp equal to or later than the given timestamp
+
+	double playbackTimestamp = NumericD::maxValue();
+
+	for (const IO::Serialization::DataSerializer::ChannelId channelId : sampleIndex.channelIds())
+	{
+		const size_t sampleIndexInChannel = sampleIndex.findSampleByDataTimestamp(channelId, double(timestamp));
+
+		const IO::Serialization::SampleIndex::Entry* entry = sampleIndex.entry(channelId, sampleIndexInChannel);
+
+		if (entry != nullptr)
+		{
+			playbackTimestamp = std::min(playbackTimestamp, entry->playbackTimestamp_);
+		}
+	}
+
+	if (playbackTimestamp == NumericD::maxValue())
+	{
+		return false;
+	}
+
+	if (!inputSerializer_->seek(std::max(0.0, playbackTimestamp)))
+	{
+		return false;
+	}
+
+	releaseDecodedFrames();
+	stopMotionSampleQueue_.clear();
+	stopMotionChunkedSampleQueue_.clear();
+
+	return true;
+}
+
+double SerializerDevicePlayer::duration() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (!inputSerializer_ || !ensureIndex())
+	{
+		// the recording cannot be indexed, e.g., because the recording is corrupted
+		return -1.0;
+	}
+
+	return std::max(0.0, inputSerializer_->index().lastPlaybackTimestamp());
+}
+
+bool SerializerDevicePlayer::ensureIndex() const
+{
+	ocean_assert(inputSerializer_);
+
+	if (indexFailed_)
+	{
+		return false;
+	}
+
+	if (inputSerializer_->hasIndex())
+	{
+		return true;
+	}
+
+	// the index is read from the end of the recording (or reconstructed with one scan of the recording) when needed for the first time
+
+	if (!inputSerializer_->createIndex(true /*allowStreamScan*/))
+	{
+		Log::warning() << "SerializerDevicePlayer: The recording '" << filename_ << "' cannot be indexed, seeking is not supported";
+
+		indexFailed_ = true;
+		return false;
+	}
+
+	return true;
+}
+
 DevicePlayer::TransformationResult SerializerDevicePlayer::transformation(const std::string& /*name*/, const Timestamp& /*timestamp*/, HomogenousMatrixD4& /*matrix*/)
 {
 	const ScopedLock scopedLock(lock_);
@@ -312,6 +411,42 @@ bool SerializerDevicePlayer::setStopMotionTolerance(const IO::Serialization::Dat
 	return true;
 }
 
+bool SerializerDevicePlayer::setParallelDecoding(const unsigned int decodeAheadFrames, const unsigned int maximalDecodingThreads, const bool useMemoryMapping)
+{
+	ocean_assert(decodeAheadFrames == 0u || decodeAheadFrames >= 2u);
+	ocean_assert(maximalDecodingThreads >= 1u);
+
+	if (decodeAheadFrames == 1u || maximalDecodingThreads == 0u)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (inputSerializer_)
+	{
+		ocean_assert(false && "The player has been initialized already!");
+		return false;
+	}
+
+	decodeAheadFrames_ = decodeAheadFrames;
+	useMemoryMapping_ = decodeAheadFrames_ != 0u && useMemoryMapping;
+
+	if (decodeAheadFrames_ != 0u)
+	{
+		const unsigned int numberThreads = std::min(std::min(decodeAheadFrames_, maximalDecodingThreads), std::max(1u, Processor::get().cores()));
+
+		decodeThreadPool_ = std::make_unique<ThreadPool>();
+		decodeThreadPool_->setCapacity(size_t(numberThreads));
+	}
+	else
+	{
+		decodeThreadPool_ = nullptr;
+	}
+
+	return true;
+}
+
 bool SerializerDevicePlayer::isPlaying() const
 {
 	return isStarted_;
@@ -357,10 +492,15 @@ void SerializerDevicePlayer::release()
 
 		channelFrameMediumDataMap_.clear();
 
+		releaseDecodedFrames();
+		stopMotionSampleQueue_.clear();
+		stopMotionChunkedSampleQueue_.clear();
+
 		frameMediums_.clear();
 		channelProcessorMap_.clear();
 
 		inputSerializer_ = nullptr;
+		indexFailed_ = false;
 
 		UsageManager::get().unregisterUsage();
 	}
@@ -422,6 +562,11 @@ bool SerializerDevicePlayer::initializeDeviceFactories()
 		return false;
 	}
 
+	if (!inputSerializer_->registerSample<DeviceSerializer::DataSampleSensorChunk>())
+	{
+		return false;
+	}
+
 	sampleTypeMap_ =
 	{
 		{IO::Serialization::MediaSerializer::DataSampleFrame::sampleType(), &SerializerDevicePlayer::processDataSampleFrame},
@@ -437,6 +582,16 @@ bool SerializerDevicePlayer::initializeDeviceFactories()
 	return true;
 }
 
+void SerializerDevicePlayer::DecodedFrame::wait()
+{
+	if (!isDecoded_)
+	{
+		decodedSignal_.wait();
+
+		isDecoded_ = true;
+	}
+}
+
 bool SerializerDevicePlayer::FrameMediumData::update(const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample)
 {
 	ocean_assert(frameSample.isValid());
@@ -444,6 +599,11 @@ bool SerializerDevicePlayer::FrameMediumData::update(const IO::Serialization::Me
 	SharedAnyCamera camera = nullptr;
 	Frame frame = frameSample.frame(&camera);
 
+	return update(frameSample, std::move(frame), std::move(camera));
+}
+
+bool SerializerDevicePlayer::FrameMediumData::update(const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample, Frame&& frame, SharedAnyCamera&& camera)
+{
 	if (!frame.isValid())
 	{
 		return false;
@@ -482,6 +642,22 @@ void SerializerDevicePlayer::processDataSampleFrame(const IO::Serialization::Dat
 	IO::Serialization::MediaSerializer::DataSampleFrame* frameSample = dynamic_cast<IO::Serialization::MediaSerializer::DataSampleFrame*>(sample.get());
 	ocean_assert(frameSample);
 
+	SharedDecodedFrame decodedFrame;
+
+	if (!decodedFrameMap_.empty())
+	{
+		const DecodedFrameMap::iterator iDecodedFrame = decodedFrameMap_.find(DecodedFrameKey(channelId, sample->playbackTimestamp()));
+
+		if (iDecodedFrame != decodedFrameMap_.end())
+		{
+			decodedFrame = std::move(iDecodedFrame->second);
+			decodedFrameMap_.erase(iDecodedFrame);
+
+			// the sample must not be disposed before the decoding thread has finished
+			decodedFrame->wait();
+		}
+	}
+
 	if (frameSample && frameSample->isValid())
 	{
 		Media::PixelImageRef pixelImage;
@@ -491,7 +667,14 @@ void SerializerDevicePlayer::processDataSampleFrame(const IO::Serialization::Dat
 		ocean_assert(iFrameMedium != channelFrameMediumDataMap_.cend());
 		if (iFrameMedium != channelFrameMediumDataMap_.cend())
 		{
-			iFrameMedium->second.update(*frameSample);
+			if (decodedFrame)
+			{
+				iFrameMedium->second.update(*frameSample, std::move(decodedFrame->frame_), std::move(decodedFrame->camera_));
+			}
+			else
+			{
+				iFrameMedium->second.update(*frameSample);
+			}
 		}
 	}
 }
@@ -900,7 +1083,7 @@ void SerializerDevicePlayer::processLookaheadSamples(const IO::Serialization::Da
 	while (true)
 	{
 		SamplePair samplePair;
-		samplePair.second = inputSerializer_->sample(samplePair.first, 0.0 /*speed*/);
+		samplePair.second = nextSample(samplePair.first, 0.0 /*speed*/, stopMotionChunkedSampleQueue_);
 
 		if (!samplePair.second)
 		{
@@ -939,6 +1122,153 @@ void SerializerDevicePlayer::processLookaheadSamples(const IO::Serialization::Da
 	}
 }
 
+void SerializerDevicePlayer::decodeFramesAhead(const IO::Serialization::DataSerializer::ChannelId channelId, const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample)
+{
+	ocean_assert(frameSample.isValid());
+	ocean_assert(decodeThreadPool_ && decodeAheadFrames_ >= 2u);
+
+	// first, we make sure that the queue contains enough upcoming frame samples, the queue serves as reorder buffer so that samples are still played in order
+
+	size_t numberQueuedFrameSamples = 0;
+
+	for (const SamplePair& samplePair : stopMotionSampleQueue_)
+	{
+		if (samplePair.second != nullptr && channelFrameMediumDataMap_.contains(samplePair.first))
+		{
+			++numberQueuedFrameSamples;
+		}
+	}
+
+	while (numberQueuedFrameSamples + 1 < size_t(decodeAheadFrames_) && stopMotionSampleQueue_.size() < maxDecodeAheadQueueSize_)
+	{
+		SamplePair samplePair;
+		samplePair.second = nextSample(samplePair.first, 0.0 /*speed*/, stopMotionChunkedSampleQueue_);
+
+		if (!samplePair.second)
+		{
+			if (inputSerializer_->hasFinished())
+			{
+				break;
+			}
+
+			Thread::sleep(1u);
+			continue;
+		}
+
+		if (channelFrameMediumDataMap_.contains(samplePair.first))
+		{
+			++numberQueuedFrameSamples;
+		}
+
+		stopMotionSampleQueue_.emplace_back(std::move(samplePair));
+	}
+
+	// now, we start decoding the current frame and the upcoming frames, the decoding of upcoming frames continues while the current frame is processed
+
+	decodeFrameAsynchronously(channelId, frameSample);
+
+	size_t numberFrameSamples = 1;
+
+	for (const SamplePair& samplePair : stopMotionSampleQueue_)
+	{
+		if (numberFrameSamples >= size_t(decodeAheadFrames_))
+		{
+			break;
+		}
+
+		if (samplePair.second == nullptr || !channelFrameMediumDataMap_.contains(samplePair.first))
+		{
+			continue;
+		}
+
+		const IO::Serialization::MediaSerializer::DataSampleFrame* queuedFrameSample = dynamic_cast<const IO::Serialization::MediaSerializer::DataSampleFrame*>(samplePair.second.get());
+
+		if (queuedFrameSample != nullptr && queuedFrameSample->isValid())
+		{
+			decodeFrameAsynchronously(samplePair.first, *queuedFrameSample);
+
+			++numberFrameSamples;
+		}
+	}
+}
+
+void SerializerDevicePlayer::decodeFrameAsynchronously(const IO::Serialization::DataSerializer::ChannelId channelId, const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample)
+{
+	ocean_assert(decodeThreadPool_);
+
+	const DecodedFrameKey decodedFrameKey(channelId, frameSample.playbackTimestamp());
+
+	if (decodedFrameMap_.contains(decodedFrameKey))
+	{
+		// the frame is decoded already
+		return;
+	}
+
+	SharedDecodedFrame decodedFrame = std::make_shared<DecodedFrame>();
+
+	decodedFrameMap_.emplace(decodedFrameKey, decodedFrame);
+
+	decodeThreadPool_->invoke(std::bind(&SerializerDevicePlayer::decodeFrame, &frameSample, std::move(decodedFrame)));
+}
+
+void SerializerDevicePlayer::releaseDecodedFrames()
+{
+	for (DecodedFrameMap::value_type& decodedFramePair : decodedFrameMap_)
+	{
+		decodedFramePair.second->wait();
+	}
+
+	decodedFrameMap_.clear();
+}
+
+IO::Serialization::UniqueDataSample SerializerDevicePlayer::nextSample(IO::Serialization::DataSerializer::ChannelId& channelId, const double speed, SampleQueue& chunkedSampleQueue)
+{
+	ocean_assert(inputSerializer_);
+
+	if (chunkedSampleQueue.empty())
+	{
+		IO::Serialization::UniqueDataSample sample = inputSerializer_->sample(channelId, speed);
+
+		if (!sample || sample->type() != DeviceSerializer::DataSampleSensorChunk::sampleType())
+		{
+			return sample;
+		}
+
+		DeviceSerializer::DataSampleSensorChunk* chunkSample = dynamic_cast<DeviceSerializer::DataSampleSensorChunk*>(sample.get());
+		ocean_assert(chunkSample != nullptr);
+
+		if (chunkSample == nullptr)
+		{
+			return nullptr;
+		}
+
+		// the chunk's timestamps are the data timestamp of the first sample and the playback timestamp of the last sample,
+		// so the samples of the chunk are queued and played individually with their own timestamps, the chunk's channel is used for all samples
+
+		for (IO::Serialization::UniqueDataSample& chunkedSample : chunkSample->extractSamples())
+		{
+			ocean_assert(chunkedSample);
+
+			if (chunkedSample)
+			{
+				chunkedSampleQueue.emplace_back(channelId, std::move(chunkedSample));
+			}
+		}
+
+		if (chunkedSampleQueue.empty())
+		{
+			return nullptr;
+		}
+	}
+
+	SamplePair samplePair = std::move(chunkedSampleQueue.front());
+	chunkedSampleQueue.pop_front();
+
+	channelId = samplePair.first;
+
+	return std::move(samplePair.second);
+}
+
 SerializerDevicePlayer::DeviceRef SerializerDevicePlayer::ensureDevice(const IO::Serialization::DataSerializer::ChannelId channelId, const std::string& deviceName, const Device::DeviceType& deviceType)
 {
 	ocean_assert(!deviceName.empty());
@@ -1054,10 +1384,12 @@ void SerializerDevicePlayer::threadRun()
 
 	double lastPlaybackTimestamp = NumericD::minValue();
 
+	SampleQueue chunkedSampleQueue;
+
 	while (!shouldThreadStop())
 	{
 		IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
-		IO::Serialization::UniqueDataSample sample = inputSerializer_->sample(channelId, double(speed_));
+		IO::Serialization::UniqueDataSample sample = nextSample(channelId, double(speed_), chunkedSampleQueue);
 
 		if (!sample)
 		{
@@ -1085,6 +1417,15 @@ void SerializerDevicePlayer::threadRun()
 	isStarted_ = false;
 }
 
+void SerializerDevicePlayer::decodeFrame(const IO::Serialization::MediaSerializer::DataSampleFrame* frameSample, const SharedDecodedFrame& decodedFrame)
+{
+	ocean_assert(frameSample != nullptr && decodedFrame);
+
+	decodedFrame->frame_ = frameSample->frame(&decodedFrame->camera_);
+
+	decodedFrame->decodedSignal_.pulse();
+}
+
 Device* SerializerDevicePlayer::createOrientationTracker3DOF(const std::string& name, const Device::DeviceType& deviceType)
 {
 	ocean_assert_and_suppress_unused(deviceType == SerializationOrientationTracker3DOF::deviceTypeSerializationOrientationTracker3DOF(), deviceType);
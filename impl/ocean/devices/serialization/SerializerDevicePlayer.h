@@ -10,8 +10,10 @@
 
 #include "ocean/devices/serialization/Serialization.h"
 
+#include "ocean/base/Signal.h"
 #include "ocean/base/Singleton.h"
 #include "ocean/base/Thread.h"
+#include "ocean/base/ThreadPool.h"
 
 #include "ocean/devices/Device.h"
 #include "ocean/devices/DeviceRef.h"
@@ -23,6 +25,7 @@
 #include "ocean/media/PixelImage.h"
 
 #include <deque>
+#include <map>
 
 namespace Ocean
 {
@@ -133,6 +136,15 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 				 */
 				bool update(const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample);
 
+				/**
+				 * Updates the frame medium data with a new frame sample which has been decoded already.
+				 * @param frameSample The frame sample to update from
+				 * @param frame The decoded frame of the sample, invalid if decoding failed
+				 * @param camera The camera profile of the sample, nullptr if the sample does not contain a camera profile
+				 * @return True, if succeeded
+				 */
+				bool update(const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample, Frame&& frame, SharedAnyCamera&& camera);
+
 			public:
 
 				/// The pixel image object.
@@ -156,6 +168,43 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		/// Definition of a queue holding sample pairs.
 		using SampleQueue = std::deque<SamplePair>;
 
+		/**
+		 * This class holds a frame which is decoded ahead of time, asynchronously on the decoding threads of the player.
+		 */
+		class DecodedFrame
+		{
+			public:
+
+				/**
+				 * Waits until the frame has been decoded.
+				 * This function must be called by the player only, before the frame is accessed.
+				 */
+				void wait();
+
+			public:
+
+				/// The decoded frame, invalid if decoding failed.
+				Frame frame_;
+
+				/// The camera profile of the frame, nullptr if the sample does not contain a camera profile.
+				SharedAnyCamera camera_;
+
+				/// The signal which is pulsed by the decoding thread once the frame has been decoded.
+				Signal decodedSignal_;
+
+				/// True, if the player has waited for the decoded frame already.
+				bool isDecoded_ = false;
+		};
+
+		/// Definition of a shared pointer holding a decoded frame.
+		using SharedDecodedFrame = std::shared_ptr<DecodedFrame>;
+
+		/// Definition of a pair combining the channel id and the playback timestamp of a frame sample, identifying the sample within the recording.
+		using DecodedFrameKey = std::pair<IO::Serialization::DataSerializer::ChannelId, double>;
+
+		/// Definition of a map mapping frame samples to their decoded frames.
+		using DecodedFrameMap = std::map<DecodedFrameKey, SharedDecodedFrame>;
+
 	public:
 
 		/**
@@ -201,11 +250,23 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		Timestamp playNextFrame() override;
 
+		/**
+		 * Seeks the replay to a given timestamp.
+		 * The replay continues with the first samples having a data timestamp equal to or later than the given timestamp, samples which are still pending are discarded.<br>
+		 * The function can be called before the replay has been started or while the replay is running, e.g., to process a short window of a long recording.<br>
+		 * The index of the recording is created with the first seek, recordings which cannot be indexed (e.g., corrupted recordings) are not seekable.
+		 * @param timestamp The data timestamp to seek to, must be valid
+		 * @return True, if succeeded; False, if no sample exists at or after the given timestamp or if the recording is not seekable
+		 * @see start(), playNextFrame().
+		 */
+		bool seek(const Timestamp& timestamp);
+
 		/**
 		 * Returns the duration of the content when played with default speed.
-		 * @return The recording's default duration, in seconds, with range [0, infinity)
+		 * The index of the recording is created if it does not exist yet.
+		 * @return The recording's default duration, in seconds, with range [0, infinity), -1 if the recording cannot be indexed
 		 */
-		inline double duration() const override;
+		double duration() const override;
 
 		/**
 		 * Returns all media objects which have been created based on the recording.
@@ -240,6 +301,19 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		bool setStopMotionTolerance(const IO::Serialization::DataTimestamp& stopMotionTolerance);
 
+		/**
+		 * Configures the parallel decoding playback mode which is intended for the stop-motion mode.
+		 * In this mode, the recording is mapped into memory and frame samples are decoded ahead of time on a bounded pool of decoding threads.<br>
+		 * The decoding of upcoming frames runs in the background while the current frame is processed by the caller, the decoded frames are kept until the corresponding samples are played so that frames are still delivered in timestamp order.<br>
+		 * This function must be called before the player is initialized.
+		 * @param decodeAheadFrames The number of frames which are decoded concurrently ahead of time, with range [2, infinity), 0 to disable the parallel decoding
+		 * @param maximalDecodingThreads The maximal number of threads used for decoding, with range [1, infinity)
+		 * @param useMemoryMapping True, to map the recording into memory; False, to read the recording with file stream operations
+		 * @return True, if succeeded
+		 * @see initialize(), playNextFrame().
+		 */
+		bool setParallelDecoding(const unsigned int decodeAheadFrames, const unsigned int maximalDecodingThreads = 4u, const bool useMemoryMapping = true);
+
 		/**
 		 * Returns whether this player is currently playing.
 		 * @return True, if so
@@ -328,6 +402,23 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		void processDataSampleGPSTracker(const IO::Serialization::DataSerializer::ChannelId channelId, IO::Serialization::UniqueDataSample&& sample);
 
+		/**
+		 * Returns the next sample of the recording.
+		 * Chunks of sensor samples are unpacked, the individual samples of a chunk are queued and returned one by one so that each sample is played based on its own timestamps.
+		 * @param channelId The resulting channel id of the sample
+		 * @param speed The speed at which the recording is played, 0 for the stop-motion mode
+		 * @param chunkedSampleQueue The queue holding the pending samples of the most recent chunk
+		 * @return The next sample, nullptr if currently no sample is available
+		 */
+		IO::Serialization::UniqueDataSample nextSample(IO::Serialization::DataSerializer::ChannelId& channelId, const double speed, SampleQueue& chunkedSampleQueue);
+
+		/**
+		 * Ensures that the input serializer holds an index of the recording, the index is created with the first call.
+		 * The lock of the player must be acquired.
+		 * @return True, if the index exists; False, if the recording cannot be indexed
+		 */
+		bool ensureIndex() const;
+
 		/**
 		 * Processes samples within the lookahead window.
 		 * This function processes queued samples and reads new samples from the input serializer that fall within the specified playback timestamp.
@@ -336,6 +427,28 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		void processLookaheadSamples(const IO::Serialization::DataTimestamp& dataTimestamp, const double maxPlaybackTimestamp);
 
+		/**
+		 * Starts the asynchronous decoding of the current frame sample and of upcoming frame samples.
+		 * Upcoming samples are read from the input serializer and queued until enough frame samples are available, the function does not wait for the decoding.
+		 * @param channelId The channel id of the frame sample which is about to be played
+		 * @param frameSample The frame sample which is about to be played, must be valid
+		 */
+		void decodeFramesAhead(const IO::Serialization::DataSerializer::ChannelId channelId, const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample);
+
+		/**
+		 * Starts the asynchronous decoding of a frame sample, if the sample is not yet decoded.
+		 * The frame sample must not be disposed before the decoded frame has been waited for.
+		 * @param channelId The channel id of the frame sample
+		 * @param frameSample The frame sample to decode, must be valid
+		 */
+		void decodeFrameAsynchronously(const IO::Serialization::DataSerializer::ChannelId channelId, const IO::Serialization::MediaSerializer::DataSampleFrame& frameSample);
+
+		/**
+		 * Waits until all frames which are decoded ahead of time have been decoded and discards them.
+		 * This function must be called before pending frame samples are disposed.
+		 */
+		void releaseDecodedFrames();
+
 		/**
 		 * Creates or retrieves a device for a specific channel.
 		 * @param channelId The channel id
@@ -407,11 +520,21 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		 */
 		static Device* createGPSTracker(const std::string& name, const Device::DeviceType& deviceType);
 
+		/**
+		 * Decodes a frame sample, this function is executed on a decoding thread.
+		 * @param frameSample The frame sample to decode, must be valid
+		 * @param decodedFrame The decoded frame receiving the result, will be signaled once the frame has been decoded, must be valid
+		 */
+		static void decodeFrame(const IO::Serialization::MediaSerializer::DataSampleFrame* frameSample, const SharedDecodedFrame& decodedFrame);
+
 	protected:
 
 		/// The input data serializer for reading the content.
 		std::unique_ptr<IO::Serialization::FileInputDataSerializer> inputSerializer_;
 
+		/// True, if the index of the recording could not be created so that the recording is not seekable.
+		mutable bool indexFailed_ = false;
+
 		/// The id of the channel which is the first channel with media content.
 		IO::Serialization::DataSerializer::ChannelId firstMediaFrameChannelId_ = IO::Serialization::DataSerializer::invalidChannelId();
 
@@ -439,8 +562,26 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDevicePlayer :
 		/// The sample queue holding pending samples for the stop-motion mode.
 		SampleQueue stopMotionSampleQueue_;
 
+		/// The queue holding the pending samples of the most recent sensor chunk for the stop-motion mode.
+		SampleQueue stopMotionChunkedSampleQueue_;
+
 		/// The tolerance for stop-motion playback defining a time window beyond the current frame's timestamp for sample processing.
 		IO::Serialization::DataTimestamp stopMotionTolerance_;
+
+		/// The number of frames which are decoded concurrently ahead of time, 0 if the parallel decoding is disabled.
+		unsigned int decodeAheadFrames_ = 0u;
+
+		/// True, to map the recording into memory.
+		bool useMemoryMapping_ = false;
+
+		/// The bounded pool of threads decoding frames ahead of time, nullptr if the parallel decoding is disabled.
+		std::unique_ptr<ThreadPool> decodeThreadPool_;
+
+		/// The map holding frames which have been decoded ahead of time.
+		DecodedFrameMap decodedFrameMap_;
+
+		/// The maximal number of samples which are queued while reading ahead to find upcoming frame samples.
+		static constexpr size_t maxDecodeAheadQueueSize_ = 1000;
 };
 
 inline SerializerDevicePlayer::FrameMediumData::FrameMediumData(const Media::PixelImageRef& pixelImage) :
@@ -449,12 +590,6 @@ inline SerializerDevicePlayer::FrameMediumData::FrameMediumData(const Media::Pix
 	ocean_assert(pixelImage_);
 }
 
-inline double SerializerDevicePlayer::duration() const
-{
-	ocean_assert(false && "This function is not supported");
-	return -1.0;
-}
-
 inline Media::FrameMediumRefs SerializerDevicePlayer::frameMediums()
 {
 	const ScopedLock scopedLock(lock_);
@@ -237,6 +237,26 @@ bool SerializerDeviceRecorder::addExtraDataSample(const IO::Serialization::DataS
 	return true;
 }
 
+bool SerializerDeviceRecorder::setSensorChunking(const size_t maximalSamplesPerChunk, const double maximalChunkDuration)
+{
+	if (maximalSamplesPerChunk == 1 || maximalChunkDuration <= 0.0)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(recorderLock_);
+
+	if (recorderState_ != RS_IDLE)
+	{
+		return false;
+	}
+
+	maximalSamplesPerChunk_ = maximalSamplesPerChunk;
+	maximalChunkDuration_ = maximalChunkDuration;
+
+	return true;
+}
+
 void SerializerDeviceRecorder::release()
 {
 	if (callbackEventDeviceChangedRegistered_)
@@ -452,7 +472,7 @@ void SerializerDeviceRecorder::recordTracker6DOFSample(const Measurement* sender
 		const Device::DeviceType deviceType = sender->type();
 		const std::string contentType = Device::translateMajorType(deviceType.majorType()) + "," + Tracker::translateTrackerType(Tracker::TrackerType(deviceType.minorType()));
 
-		channelId = outputSerializer_->addChannel(DeviceSerializer::DataSampleTracker6DOF::sampleType(), channelName, contentType);
+		channelId = addDeviceChannel(DeviceSerializer::DataSampleTracker6DOF::sampleType(), channelName, contentType);
 		measurementChannelMap_.emplace(sender, channelId);
 
 		Log::info() << "Serialization recorder contains 6DOF tracker '" << channelName << "' with channel id: " << channelId << " (type: " << contentType << ")";
@@ -464,7 +484,7 @@ void SerializerDeviceRecorder::recordTracker6DOFSample(const Measurement* sender
 	{
 		std::unique_ptr<DeviceSerializer::DataSampleTracker6DOF> dataSample = std::make_unique<DeviceSerializer::DataSampleTracker6DOF>(*sample, sampleCreationTimestamp);
 
-		outputSerializer_->addSample(channelId, std::move(dataSample));
+		addDeviceSample(channelId, std::move(dataSample), sampleCreationTimestamp);
 	}
 }
 
@@ -526,7 +546,7 @@ void SerializerDeviceRecorder::recordAccelerationSensor3DOFSample(const Measurem
 		const Device::DeviceType deviceType = sender->type();
 		const std::string contentType = Device::translateMajorType(deviceType.majorType()) + "," + Sensor::translateSensorType(Sensor::SensorType(deviceType.minorType()));
 
-		channelId = outputSerializer_->addChannel(DeviceSerializer::DataSampleAccelerationSensor3DOF::sampleType(), channelName, contentType);
+		channelId = addDeviceChannel(DeviceSerializer::DataSampleAccelerationSensor3DOF::sampleType(), channelName, contentType);
 		measurementChannelMap_.emplace(sender, channelId);
 
 		Log::info() << "Serialization recorder contains 3DOF acceleration sensor '" << channelName << "' with channel id: " << channelId << " (type: " << contentType << ")";
@@ -536,7 +556,7 @@ void SerializerDeviceRecorder::recordAccelerationSensor3DOFSample(const Measurem
 
 	std::unique_ptr<DeviceSerializer::DataSampleAccelerationSensor3DOF> dataSample = std::make_unique<DeviceSerializer::DataSampleAccelerationSensor3DOF>(*sample, sampleCreationTimestamp);
 
-	outputSerializer_->addSample(channelId, std::move(dataSample));
+	addDeviceSample(channelId, std::move(dataSample), sampleCreationTimestamp);
 }
 
 void SerializerDeviceRecorder::recordGyroSensor3DOFSample(const Measurement* sender, const GyroSensor3DOF::Gyro3DOFSampleRef& sample, const Timestamp& sampleCreationTimestamp)
@@ -560,7 +580,7 @@ void SerializerDeviceRecorder::recordGyroSensor3DOFSample(const Measurement* sen
 		const Device::DeviceType deviceType = sender->type();
 		const std::string contentType = Device::translateMajorType(deviceType.majorType()) + "," + Sensor::translateSensorType(Sensor::SensorType(deviceType.minorType()));
 
-		channelId = outputSerializer_->addChannel(DeviceSerializer::DataSampleGyroSensor3DOF::sampleType(), channelName, contentType);
+		channelId = addDeviceChannel(DeviceSerializer::DataSampleGyroSensor3DOF::sampleType(), channelName, contentType);
 		measurementChannelMap_.emplace(sender, channelId);
 
 		Log::info() << "Serialization recorder contains 3DOF gyro sensor '" << channelName << "' with channel id: " << channelId << " (type: " << contentType << ")";
@@ -570,7 +590,7 @@ void SerializerDeviceRecorder::recordGyroSensor3DOFSample(const Measurement* sen
 
 	std::unique_ptr<DeviceSerializer::DataSampleGyroSensor3DOF> dataSample = std::make_unique<DeviceSerializer::DataSampleGyroSensor3DOF>(*sample, sampleCreationTimestamp);
 
-	outputSerializer_->addSample(channelId, std::move(dataSample));
+	addDeviceSample(channelId, std::move(dataSample), sampleCreationTimestamp);
 }
 
 void SerializerDeviceRecorder::recordOrientationTracker3DOFSample(const Measurement* sender, const OrientationTracker3DOF::OrientationTracker3DOFSampleRef& sample, const Timestamp& sampleCreationTimestamp)
@@ -594,7 +614,7 @@ void SerializerDeviceRecorder::recordOrientationTracker3DOFSample(const Measurem
 		const Device::DeviceType deviceType = sender->type();
 		const std::string contentType = Device::translateMajorType(deviceType.majorType()) + "," + Tracker::translateTrackerType(Tracker::TrackerType(deviceType.minorType()));
 
-		channelId = outputSerializer_->addChannel(DeviceSerializer::DataSampleOrientationTracker3DOF::sampleType(), channelName, contentType);
+		channelId = addDeviceChannel(DeviceSerializer::DataSampleOrientationTracker3DOF::sampleType(), channelName, contentType);
 		measurementChannelMap_.emplace(sender, channelId);
 
 		Log::info() << "Serialization recorder contains 3DOF orientation tracker '" << channelName << "' with channel id: " << channelId << " (type: " << contentType << ")";
@@ -604,7 +624,7 @@ void SerializerDeviceRecorder::recordOrientationTracker3DOFSample(const Measurem
 
 	std::unique_ptr<DeviceSerializer::DataSampleOrientationTracker3DOF> dataSample = std::make_unique<DeviceSerializer::DataSampleOrientationTracker3DOF>(*sample, sampleCreationTimestamp);
 
-	outputSerializer_->addSample(channelId, std::move(dataSample));
+	addDeviceSample(channelId, std::move(dataSample), sampleCreationTimestamp);
 }
 
 void SerializerDeviceRecorder::recordGravityTracker3DOFSample(const Measurement* sender, const GravityTracker3DOF::GravityTracker3DOFSampleRef& sample, const Timestamp& sampleCreationTimestamp)
@@ -628,7 +648,7 @@ void SerializerDeviceRecorder::recordGravityTracker3DOFSample(const Measurement*
 		const Device::DeviceType deviceType = sender->type();
 		const std::string contentType = Device::translateMajorType(deviceType.majorType()) + "," + Tracker::translateTrackerType(Tracker::TrackerType(deviceType.minorType()));
 
-		channelId = outputSerializer_->addChannel(DeviceSerializer::DataSampleGravityTracker3DOF::sampleType(), channelName, contentType);
+		channelId = addDeviceChannel(DeviceSerializer::DataSampleGravityTracker3DOF::sampleType(), channelName, contentType);
 		measurementChannelMap_.emplace(sender, channelId);
 
 		Log::info() << "Serialization recorder contains 3DOF gravity tracker '" << channelName << "' with channel id: " << channelId << " (type: " << contentType << ")";
@@ -638,7 +658,7 @@ void SerializerDeviceRecorder::recordGravityTracker3DOFSample(const Measurement*
 
 	std::unique_ptr<DeviceSerializer::DataSampleGravityTracker3DOF> dataSample = std::make_unique<DeviceSerializer::DataSampleGravityTracker3DOF>(*sample, sampleCreationTimestamp);
 
-	outputSerializer_->addSample(channelId, std::move(dataSample));
+	addDeviceSample(channelId, std::move(dataSample), sampleCreationTimestamp);
 }
 
 void SerializerDeviceRecorder::recordPositionTracker3DOFSample(const Measurement* sender, const PositionTracker3DOF::PositionTracker3DOFSampleRef& sample, const Timestamp& sampleCreationTimestamp)
@@ -662,7 +682,7 @@ void SerializerDeviceRecorder::recordPositionTracker3DOFSample(const Measurement
 		const Device::DeviceType deviceType = sender->type();
 		const std::string contentType = Device::translateMajorType(deviceType.majorType()) + "," + Tracker::translateTrackerType(Tracker::TrackerType(deviceType.minorType()));
 
-		channelId = outputSerializer_->addChannel(DeviceSerializer::DataSamplePositionTracker3DOF::sampleType(), channelName, contentType);
+		channelId = addDeviceChannel(DeviceSerializer::DataSamplePositionTracker3DOF::sampleType(), channelName, contentType);
 		measurementChannelMap_.emplace(sender, channelId);
 
 		Log::info() << "Serialization recorder contains 3DOF position tracker '" << channelName << "' with channel id: " << channelId << " (type: " << contentType << ")";
@@ -672,7 +692,82 @@ void SerializerDeviceRecorder::recordPositionTracker3DOFSample(const Measurement
 
 	std::unique_ptr<DeviceSerializer::DataSamplePositionTracker3DOF> dataSample = std::make_unique<DeviceSerializer::DataSamplePositionTracker3DOF>(*sample, sampleCreationTimestamp);
 
-	outputSerializer_->addSample(channelId, std::move(dataSample));
+	addDeviceSample(channelId, std::move(dataSample), sampleCreationTimestamp);
+}
+
+IO::Serialization::DataSerializer::ChannelId SerializerDeviceRecorder::addDeviceChannel(const std::string& sampleType, const std::string& channelName, const std::string& contentType)
+{
+	ocean_assert(outputSerializer_);
+
+	if (maximalSamplesPerChunk_ == 0 || !DeviceSerializer::DataSampleSensorChunk::isSupportedSampleType(sampleType))
+	{
+		return outputSerializer_->addChannel(sampleType, channelName, contentType);
+	}
+
+	const IO::Serialization::DataSerializer::ChannelId channelId = outputSerializer_->addChannel(DeviceSerializer::DataSampleSensorChunk::sampleType(), channelName, contentType);
+
+	if (channelId != IO::Serialization::DataSerializer::invalidChannelId())
+	{
+		pendingChunkMap_.emplace(channelId, PendingChunk());
+	}
+
+	return channelId;
+}
+
+void SerializerDeviceRecorder::addDeviceSample(const IO::Serialization::DataSerializer::ChannelId channelId, IO::Serialization::UniqueDataSample&& dataSample, const Timestamp& sampleCreationTimestamp)
+{
+	ocean_assert(outputSerializer_);
+	ocean_assert(dataSample);
+
+	const PendingChunkMap::iterator iPendingChunk = pendingChunkMap_.find(channelId);
+
+	if (iPendingChunk == pendingChunkMap_.end())
+	{
+		outputSerializer_->addSample(channelId, std::move(dataSample));
+		return;
+	}
+
+	PendingChunk& pendingChunk = iPendingChunk->second;
+
+	ocean_assert(pendingChunk.samples_.size() == pendingChunk.sampleCreationTimestamps_.size());
+
+	if (!pendingChunk.samples_.empty() && double(sampleCreationTimestamp - pendingChunk.sampleCreationTimestamps_.front()) > maximalChunkDuration_)
+	{
+		flushSensorChunk(channelId, pendingChunk);
+	}
+
+	pendingChunk.samples_.emplace_back(std::move(dataSample));
+	pendingChunk.sampleCreationTimestamps_.emplace_back(sampleCreationTimestamp);
+
+	if (pendingChunk.samples_.size() >= maximalSamplesPerChunk_)
+	{
+		flushSensorChunk(channelId, pendingChunk);
+	}
+}
+
+void SerializerDeviceRecorder::flushSensorChunk(const IO::Serialization::DataSerializer::ChannelId channelId, PendingChunk& pendingChunk)
+{
+	ocean_assert(outputSerializer_);
+
+	if (pendingChunk.samples_.empty())
+	{
+		return;
+	}
+
+	IO::Serialization::UniqueDataSample chunkSample = std::make_unique<DeviceSerializer::DataSampleSensorChunk>(std::move(pendingChunk.samples_), pendingChunk.sampleCreationTimestamps_);
+
+	outputSerializer_->addSample(channelId, std::move(chunkSample));
+
+	pendingChunk.samples_.clear();
+	pendingChunk.sampleCreationTimestamps_.clear();
+}
+
+void SerializerDeviceRecorder::flushSensorChunks()
+{
+	for (PendingChunkMap::value_type& pendingChunkPair : pendingChunkMap_)
+	{
+		flushSensorChunk(pendingChunkPair.first, pendingChunkPair.second);
+	}
 }
 
 bool SerializerDeviceRecorder::recordFrame(FrameMediumData& frameMediumData, const Frame& frame, const SharedAnyCamera& camera)
@@ -858,6 +953,10 @@ void SerializerDeviceRecorder::threadRun()
 
 	if (outputSerializer_)
 	{
+		TemporaryScopedLock chunkScopedLock(recorderLock_);
+			flushSensorChunks();
+		chunkScopedLock.release();
+
 		outputSerializer_->stop();
 
 		while (!outputSerializer_->hasFinished())
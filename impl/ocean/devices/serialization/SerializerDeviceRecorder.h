@@ -166,6 +166,25 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDeviceRecorder : protected Th
 		 */
 		using FrameMediumMap = std::unordered_map<const Media::FrameMedium*, FrameMediumData>;
 
+		/**
+		 * This class holds the sensor samples of one channel which are not yet written as chunk.
+		 */
+		class PendingChunk
+		{
+			public:
+
+				/// The samples of the chunk, in chronological order.
+				std::vector<IO::Serialization::UniqueDataSample> samples_;
+
+				/// The timestamps when the individual samples were received, one for each sample.
+				Timestamps sampleCreationTimestamps_;
+		};
+
+		/**
+		 * Definition of an unordered map mapping channel ids of chunked channels to pending chunks.
+		 */
+		using PendingChunkMap = std::unordered_map<IO::Serialization::DataSerializer::ChannelId, PendingChunk>;
+
 	public:
 
 		/**
@@ -239,6 +258,17 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDeviceRecorder : protected Th
 		 */
 		bool addExtraDataSample(const IO::Serialization::DataSerializer::ChannelId channelId, IO::Serialization::UniqueDataSample&& sample);
 
+		/**
+		 * Enables or disables chunked recording of sensor and tracker samples.
+		 * When enabled, consecutive samples of acceleration, gyro, orientation, gravity, position, and 6DOF channels are combined in one DeviceSerializer::DataSampleSensorChunk sample before they are written, reducing the size of high-frequency channels significantly.<br>
+		 * A chunk is written once it holds the maximal number of samples or once it spans the maximal duration, all pending chunks are written when the recording stops.<br>
+		 * Chunking must be configured before the recording is started.
+		 * @param maximalSamplesPerChunk The maximal number of samples in one chunk, with range [2, infinity), 0 to disable chunking
+		 * @param maximalChunkDuration The maximal time between the first and the last sample of one chunk, in seconds, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool setSensorChunking(const size_t maximalSamplesPerChunk, const double maximalChunkDuration = 0.1);
+
 		/**
 		 * Releases this device recorder explicitly before the recorder is disposed.
 		 */
@@ -354,6 +384,38 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDeviceRecorder : protected Th
 		 */
 		void recordPositionTracker3DOFSample(const Measurement* sender, const PositionTracker3DOF::PositionTracker3DOFSampleRef& sample, const Timestamp& sampleCreationTimestamp);
 
+		/**
+		 * Adds a new channel for sensor or tracker samples.
+		 * If chunking is enabled and the sample type can be chunked, the channel is added for DeviceSerializer::DataSampleSensorChunk samples instead.
+		 * @param sampleType The type of the samples of the channel, must be valid
+		 * @param channelName The name of the channel, must be valid
+		 * @param contentType The content type of the channel, must be valid
+		 * @return The id of the new channel
+		 * @see setSensorChunking().
+		 */
+		IO::Serialization::DataSerializer::ChannelId addDeviceChannel(const std::string& sampleType, const std::string& channelName, const std::string& contentType);
+
+		/**
+		 * Adds a sensor or tracker sample to a channel which has been added with addDeviceChannel().
+		 * Samples of chunked channels are buffered until the chunk is complete.
+		 * @param channelId The id of the channel, must be valid
+		 * @param dataSample The sample to add, must be valid
+		 * @param sampleCreationTimestamp The timestamp when the sample was received
+		 */
+		void addDeviceSample(const IO::Serialization::DataSerializer::ChannelId channelId, IO::Serialization::UniqueDataSample&& dataSample, const Timestamp& sampleCreationTimestamp);
+
+		/**
+		 * Writes the samples of a pending chunk as one chunk sample.
+		 * @param channelId The id of the channel to which the chunk belongs, must be valid
+		 * @param pendingChunk The pending chunk to write, will be empty afterwards
+		 */
+		void flushSensorChunk(const IO::Serialization::DataSerializer::ChannelId channelId, PendingChunk& pendingChunk);
+
+		/**
+		 * Writes all pending chunks.
+		 */
+		void flushSensorChunks();
+
 		/**
 		 * Records a new frame from a frame medium.
 		 * @param frameMediumData The data describing the frame medium
@@ -429,6 +491,15 @@ class OCEAN_DEVICES_SERIALIZATION_EXPORT SerializerDeviceRecorder : protected Th
 
 		/// The actual serialization output serializer.
 		std::unique_ptr<IO::Serialization::FileOutputDataSerializer> outputSerializer_;
+
+		/// The maximal number of samples in one chunk, 0 if chunking is disabled.
+		size_t maximalSamplesPerChunk_ = 0;
+
+		/// The maximal time between the first and the last sample of one chunk, in seconds.
+		double maximalChunkDuration_ = 0.1;
+
+		/// The pending chunks of all chunked channels.
+		PendingChunkMap pendingChunkMap_;
 };
 
 inline SerializerDeviceRecorder::FrameMediumData::FrameMediumData(const Media::FrameMediumRef& frameMedium) :
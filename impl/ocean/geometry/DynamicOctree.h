@@ -0,0 +1,1163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_GEOMETRY_DYNAMIC_OCTREE_H
+#define META_OCEAN_GEOMETRY_DYNAMIC_OCTREE_H
+
+#include "ocean/geometry/Geometry.h"
+
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/Box3.h"
+#include "ocean/math/Line3.h"
+#include "ocean/math/Numeric.h"
+#include "ocean/math/Vector3.h"
+
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace Geometry
+{
+
+/// Forward declaration.
+template <typename T>
+class DynamicOctreeT;
+
+/**
+ * Definition of a dynamic Octree using Scalar as data type.
+ * @see DynamicOctreeT
+ * @ingroup geometry
+ */
+using DynamicOctree = DynamicOctreeT<Scalar>;
+
+/**
+ * Definition of a dynamic Octree using double as data type.
+ * @see DynamicOctreeT
+ * @ingroup geometry
+ */
+using DynamicOctreeD = DynamicOctreeT<double>;
+
+/**
+ * Definition of a dynamic Octree using float as data type.
+ * @see DynamicOctreeT
+ * @ingroup geometry
+ */
+using DynamicOctreeF = DynamicOctreeT<float>;
+
+/**
+ * This class implements an Octree allowing to add, remove, and move 3D points without re-creating the tree.
+ * In contrast to OctreeT, the tree holds copies of the points, each point is identified by an id defined by the caller (e.g., the id of an object point).<br>
+ * All nodes are stored in one contiguous node arena, each node covers a cube which is bisected into eight child cubes.<br>
+ * A leaf node is split once it holds more than 'maximalPointsPerLeaf' points, while a subtree is merged into one leaf node once it holds at most half of this number of points.<br>
+ * The root cube grows automatically whenever a point outside of the current root cube is added.
+ * Pointers to the point ids of leaf nodes (e.g., provided by closestLeaves()) are invalidated whenever the tree is modified.
+ * @see OctreeT.
+ * @ingroup geometry
+ */
+template <typename T>
+class DynamicOctreeT
+{
+	public:
+
+		/// The data type of this octree.
+		using Type = T;
+
+		/**
+		 * This class stores construction parameters for a dynamic octree.
+		 */
+		class Parameters
+		{
+			public:
+
+				/**
+				 * Default constructor.
+				 */
+				Parameters() = default;
+
+				/**
+				 * Creates a new parameter object.
+				 * @param maximalPointsPerLeaf The maximal number of points each leaf node can have, with range [1, infinity)
+				 * @param initialHalfSize The half edge length of the root cube once the first point is added, with range (0, infinity)
+				 */
+				inline Parameters(const unsigned int maximalPointsPerLeaf, const T initialHalfSize);
+
+				/**
+				 * Returns whether this object holds valid parameters.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			public:
+
+				/// The maximal number of points each leaf node can have.
+				unsigned int maximalPointsPerLeaf_ = 40u;
+
+				/// The half edge length of the root cube once the first point is added.
+				T initialHalfSize_ = T(1);
+		};
+
+		/**
+		 * Definition of a class which holds reusable data for internal use.
+		 * This object can avoid reallocating memory when calling a query function several times in a row.
+		 * @see OctreeT::ReusableData.
+		 */
+		class ReusableData
+		{
+			friend class DynamicOctreeT<T>;
+
+			public:
+
+				/**
+				 * Creates a new object.
+				 */
+				ReusableData() = default;
+
+			protected:
+
+				/// The internal reusable data.
+				mutable Indices32 internalData_;
+		};
+
+	protected:
+
+		/**
+		 * This class implements one node of the octree.
+		 */
+		class Node
+		{
+			public:
+
+				/**
+				 * Returns whether this node is a leaf node.
+				 * @return True, if so
+				 */
+				inline bool isLeaf() const;
+
+				/**
+				 * Returns whether a given point is located inside the cube of this node.
+				 * @param point The point to check
+				 * @param epsilon The accuracy which is applied to the border of the cube, with range [0, infinity)
+				 * @return True, if so
+				 */
+				inline bool isInside(const VectorT3<T>& point, const T epsilon = T(0)) const;
+
+				/**
+				 * Returns the index of the child node to which a given point belongs.
+				 * @param point The point for which the child node will be determined
+				 * @return The index of the child node, with range [0, 7]
+				 */
+				inline unsigned int childIndex(const VectorT3<T>& point) const;
+
+				/**
+				 * Returns the square distance between a given point and the cube of this node.
+				 * @param point The point for which the distance will be determined
+				 * @return The square distance, 0 if the point is located inside the cube
+				 */
+				inline T sqrDistance(const VectorT3<T>& point) const;
+
+				/**
+				 * Returns the cube of this node.
+				 * @return The node's cube
+				 */
+				inline BoxT3<T> box() const;
+
+			public:
+
+				/// The center of the node's cube.
+				VectorT3<T> center_ = VectorT3<T>(0, 0, 0);
+
+				/// The half edge length of the node's cube.
+				T halfSize_ = T(0);
+
+				/// The index of the parent node, invalidIndex() for the root node.
+				Index32 parentNode_ = invalidIndex();
+
+				/// The index of the first of the eight consecutive child nodes, invalidIndex() for leaf nodes.
+				Index32 firstChildNode_ = invalidIndex();
+
+				/// The number of points in the entire subtree of this node.
+				size_t numberPoints_ = 0;
+
+				/// The ids of the points of this leaf node.
+				Indices32 pointIds_;
+
+				/// The points of this leaf node, one for each point id.
+				VectorsT3<T> points_;
+		};
+
+		/**
+		 * Definition of a vector holding nodes.
+		 */
+		using Nodes = std::vector<Node>;
+
+		/**
+		 * Definition of an unordered map mapping point ids to the indices of leaf nodes.
+		 */
+		using PointNodeMap = std::unordered_map<Index32, Index32>;
+
+	public:
+
+		/**
+		 * Creates a new empty octree with default parameters.
+		 */
+		DynamicOctreeT() = default;
+
+		/**
+		 * Creates a new empty octree.
+		 * @param parameters The parameters to be used, must be valid
+		 */
+		explicit DynamicOctreeT(const Parameters& parameters);
+
+		/**
+		 * Creates a new octree for a given set of 3D points, the ids of the points will be the indices of the points.
+		 * @param points The points to be added, can be nullptr if 'numberPoints == 0'
+		 * @param numberPoints The number of given points, with range [0, infinity)
+		 * @param parameters The parameters to be used, must be valid
+		 */
+		DynamicOctreeT(const VectorT3<T>* points, const size_t numberPoints, const Parameters& parameters = Parameters());
+
+		/**
+		 * Adds a new point to this octree.
+		 * @param pointId The id of the point, must not exist in this octree
+		 * @param point The point to be added
+		 * @return True, if succeeded
+		 */
+		bool insertPoint(const Index32 pointId, const VectorT3<T>& point);
+
+		/**
+		 * Removes a point from this octree.
+		 * @param pointId The id of the point to be removed
+		 * @return True, if succeeded; False, if the point does not exist
+		 */
+		bool removePoint(const Index32 pointId);
+
+		/**
+		 * Changes the location of a point in this octree.
+		 * @param pointId The id of the point to be moved
+		 * @param point The new location of the point
+		 * @return True, if succeeded; False, if the point does not exist
+		 */
+		bool movePoint(const Index32 pointId, const VectorT3<T>& point);
+
+		/**
+		 * Returns whether this octree holds a specific point.
+		 * @param pointId The id of the point to check
+		 * @return True, if so
+		 */
+		inline bool hasPoint(const Index32 pointId) const;
+
+		/**
+		 * Returns the number of points in this octree.
+		 * @return The octree's number of points, with range [0, infinity)
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns the number of nodes which are currently in use.
+		 * @return The number of nodes, with range [0, infinity)
+		 */
+		inline size_t numberNodes() const;
+
+		/**
+		 * Returns the cube of the root node of this octree.
+		 * @return The root cube, invalid if the octree is empty
+		 */
+		inline BoxT3<T> boundingBox() const;
+
+		/**
+		 * Removes all points from this octree.
+		 */
+		void clear();
+
+		/**
+		 * Returns the closest leaf nodes for a given query point.
+		 * @param queryPoint The query point for which the closest leaf nodes will be returned
+		 * @param maximalDistance The maximal distance between the query point and any potential point in a leaf node, with range [0, infinity)
+		 * @param leaves The resulting leaf nodes, mainly the ids of the points which are stored in the closest leaf nodes
+		 * @param reusableData An reusable object to speedup the search, should be located outside of the function call if several function calls are done after each other
+		 */
+		void closestLeaves(const VectorT3<T>& queryPoint, const T maximalDistance, std::vector<const Indices32*>& leaves, const ReusableData& reusableData = ReusableData()) const;
+
+		/**
+		 * Returns the intersecting leaf nodes for a given query ray.
+		 * @param queryRay The query ray for which the intersecting leaf nodes will be returned, the search treats the ray as an infinite ray in space, must be valid
+		 * @param leaves The resulting leaf nodes, mainly the ids of the points which are stored in the intersecting leaf nodes
+		 * @param reusableData An reusable object to speedup the search, should be located outside of the function call if several function calls are done after each other
+		 */
+		void intersectingLeaves(const LineT3<T>& queryRay, std::vector<const Indices32*>& leaves, const ReusableData& reusableData = ReusableData()) const;
+
+		/**
+		 * Returns the intersecting leaf nodes for a given approximated query cone expressed as a ray with a cone apex angle.
+		 * @param queryRay The query ray defining the apex and axis of the cone for which the intersecting leaf nodes will be returned, the search treats the ray as an infinite ray in space, must be valid
+		 * @param tanHalfAngle The tangent of the cone's half apex angle, e.g., Numeric::tan(Numeric::deg2rad(1)), with range [0, 1)
+		 * @param leaves The resulting leaf nodes, mainly the ids of the points which are stored in the intersecting leaf nodes
+		 * @param reusableData An reusable object to speedup the search, should be located outside of the function call if several function calls are done after each other
+		 */
+		void intersectingLeaves(const LineT3<T>& queryRay, const T tanHalfAngle, std::vector<const Indices32*>& leaves, const ReusableData& reusableData = ReusableData()) const;
+
+		/**
+		 * Returns the closest points for a given query point.
+		 * @param queryPoint The query point for which the closest points will be returned
+		 * @param maximalDistance The maximal distance between the query point and any resulting point, with range [0, infinity)
+		 * @param pointIds The resulting ids of the points which have a maximal distance of 'maximalDistance' to the query point
+		 * @param points Optional resulting points, one for each resulting id; nullptr if not of interest
+		 * @param reusableData An reusable object to speedup the search, should be located outside of the function call if several function calls are done after each other
+		 */
+		void closestPoints(const VectorT3<T>& queryPoint, const T maximalDistance, Indices32& pointIds, VectorsT3<T>* points = nullptr, const ReusableData& reusableData = ReusableData()) const;
+
+		/**
+		 * Returns the closest points for several query points at once.
+		 * @param queryPoints The query points for which the closest points will be returned, must be valid
+		 * @param numberQueryPoints The number of given query points, with range [1, infinity)
+		 * @param maximalDistance The maximal distance between a query point and any resulting point, with range [0, infinity)
+		 * @param pointIdsGroups The resulting ids of the closest points, one group for each query point
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		void closestPoints(const VectorT3<T>* queryPoints, const size_t numberQueryPoints, const T maximalDistance, std::vector<Indices32>& pointIdsGroups, Worker* worker = nullptr) const;
+
+		/**
+		 * Returns whether this octree holds at least one point.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Ensures that the root cube covers a given point, the root cube is doubled until the point is covered.
+		 * @param point The point to be covered
+		 * @return True, if succeeded
+		 */
+		bool growRoot(const VectorT3<T>& point);
+
+		/**
+		 * Splits a leaf node into eight child nodes, child nodes holding too many points are split recursively.
+		 * @param nodeIndex The index of the leaf node to split, must be valid
+		 */
+		void splitLeaf(const Index32 nodeIndex);
+
+		/**
+		 * Merges the entire subtree of a node into the node so that the node becomes a leaf node.
+		 * @param nodeIndex The index of the node to merge, must not be a leaf node
+		 */
+		void mergeSubtree(const Index32 nodeIndex);
+
+		/**
+		 * Gathers all points of the subtree of a node.
+		 * @param nodeIndex The index of the node, must be valid
+		 * @param pointIds The resulting point ids, will be extended
+		 * @param points The resulting points, one for each point id, will be extended
+		 */
+		void gatherPoints(const Index32 nodeIndex, Indices32& pointIds, VectorsT3<T>& points) const;
+
+		/**
+		 * Returns eight consecutive unused nodes from the node arena.
+		 * The node arena may be resized so that any reference to an existing node is invalidated.
+		 * @return The index of the first node
+		 */
+		Index32 allocateChildNodes();
+
+		/**
+		 * Returns eight consecutive child nodes (and their subtrees) to the node arena.
+		 * @param firstChildNode The index of the first child node, must be valid
+		 */
+		void releaseChildNodes(const Index32 firstChildNode);
+
+		/**
+		 * Returns the closest points for a subset of query points.
+		 * @param queryPoints The query points, must be valid
+		 * @param maximalDistance The maximal distance between a query point and any resulting point, with range [0, infinity)
+		 * @param pointIdsGroups The resulting ids of the closest points, one group for each query point, must be valid
+		 * @param firstQueryPoint The first query point to be handled
+		 * @param numberQueryPoints The number of query points to be handled
+		 */
+		void closestPointsSubset(const VectorT3<T>* queryPoints, const T maximalDistance, Indices32* pointIdsGroups, const unsigned int firstQueryPoint, const unsigned int numberQueryPoints) const;
+
+		/**
+		 * Returns an invalid node index.
+		 * @return The invalid node index
+		 */
+		static constexpr Index32 invalidIndex();
+
+	protected:
+
+		/// The parameters of this octree.
+		Parameters parameters_;
+
+		/// The node arena, the first node is the root node.
+		Nodes nodes_;
+
+		/// The indices of the first nodes of unused blocks of eight consecutive nodes within the arena.
+		Indices32 freeChildNodes_;
+
+		/// The map mapping point ids to the indices of the leaf nodes holding the points.
+		PointNodeMap pointNodeMap_;
+};
+
+template <typename T>
+inline DynamicOctreeT<T>::Parameters::Parameters(const unsigned int maximalPointsPerLeaf, const T initialHalfSize) :
+	maximalPointsPerLeaf_(maximalPointsPerLeaf),
+	initialHalfSize_(initialHalfSize)
+{
+	ocean_assert(isValid());
+}
+
+template <typename T>
+inline bool DynamicOctreeT<T>::Parameters::isValid() const
+{
+	return maximalPointsPerLeaf_ >= 1u && initialHalfSize_ > NumericT<T>::eps();
+}
+
+template <typename T>
+inline bool DynamicOctreeT<T>::Node::isLeaf() const
+{
+	return firstChildNode_ == invalidIndex();
+}
+
+template <typename T>
+inline bool DynamicOctreeT<T>::Node::isInside(const VectorT3<T>& point, const T epsilon) const
+{
+	ocean_assert(epsilon >= T(0));
+
+	const T extendedHalfSize = halfSize_ + epsilon;
+
+	return NumericT<T>::abs(point.x() - center_.x()) <= extendedHalfSize && NumericT<T>::abs(point.y() - center_.y()) <= extendedHalfSize && NumericT<T>::abs(point.z() - center_.z()) <= extendedHalfSize;
+}
+
+template <typename T>
+inline unsigned int DynamicOctreeT<T>::Node::childIndex(const VectorT3<T>& point) const
+{
+	// same order as in OctreeT: x is the most significant axis, z the least significant axis
+
+	return (point.x() >= center_.x() ? 4u : 0u) | (point.y() >= center_.y() ? 2u : 0u) | (point.z() >= center_.z() ? 1u : 0u);
+}
+
+template <typename T>
+inline T DynamicOctreeT<T>::Node::sqrDistance(const VectorT3<T>& point) const
+{
+	const T xDistance = std::max(T(0), NumericT<T>::abs(point.x() - center_.x()) - halfSize_);
+	const T yDistance = std::max(T(0), NumericT<T>::abs(point.y() - center_.y()) - halfSize_);
+	const T zDistance = std::max(T(0), NumericT<T>::abs(point.z() - center_.z()) - halfSize_);
+
+	return xDistance * xDistance + yDistance * yDistance + zDistance * zDistance;
+}
+
+template <typename T>
+inline BoxT3<T> DynamicOctreeT<T>::Node::box() const
+{
+	const VectorT3<T> offset(halfSize_, halfSize_, halfSize_);
+
+	return BoxT3<T>(center_ - offset, center_ + offset);
+}
+
+template <typename T>
+DynamicOctreeT<T>::DynamicOctreeT(const Parameters& parameters) :
+	parameters_(parameters)
+{
+	ocean_assert(parameters_.isValid());
+}
+
+template <typename T>
+DynamicOctreeT<T>::DynamicOctreeT(const VectorT3<T>* points, const size_t numberPoints, const Parameters& parameters) :
+	parameters_(parameters)
+{
+	ocean_assert(parameters_.isValid());
+	ocean_assert(points != nullptr || numberPoints == 0);
+
+	if (numberPoints == 0)
+	{
+		return;
+	}
+
+	BoxT3<T> boundingBox(points, numberPoints);
+
+	if (boundingBox.isValid())
+	{
+		// we start with a root cube covering all points to avoid growing the root cube several times
+
+		nodes_.emplace_back();
+		nodes_.front().center_ = boundingBox.center();
+		nodes_.front().halfSize_ = std::max(parameters_.initialHalfSize_, std::max(boundingBox.xDimension(), std::max(boundingBox.yDimension(), boundingBox.zDimension())) * T(0.5));
+	}
+
+	pointNodeMap_.reserve(numberPoints);
+
+	for (size_t n = 0; n < numberPoints; ++n)
+	{
+		const bool result = insertPoint(Index32(n), points[n]);
+		ocean_assert_and_suppress_unused(result, result);
+	}
+}
+
+template <typename T>
+bool DynamicOctreeT<T>::insertPoint(const Index32 pointId, const VectorT3<T>& point)
+{
+	ocean_assert(parameters_.isValid());
+
+	if (pointNodeMap_.find(pointId) != pointNodeMap_.cend())
+	{
+		return false;
+	}
+
+	if (nodes_.empty())
+	{
+		nodes_.emplace_back();
+		nodes_.front().center_ = point;
+		nodes_.front().halfSize_ = parameters_.initialHalfSize_;
+	}
+
+	if (!growRoot(point))
+	{
+		return false;
+	}
+
+	Index32 nodeIndex = 0u;
+
+	while (!nodes_[nodeIndex].isLeaf())
+	{
+		Node& node = nodes_[nodeIndex];
+		++node.numberPoints_;
+
+		nodeIndex = node.firstChildNode_ + node.childIndex(point);
+	}
+
+	Node& leafNode = nodes_[nodeIndex];
+	ocean_assert(leafNode.isInside(point, NumericT<T>::weakEps()));
+
+	++leafNode.numberPoints_;
+	leafNode.pointIds_.emplace_back(pointId);
+	leafNode.points_.emplace_back(point);
+
+	ocean_assert(leafNode.numberPoints_ == leafNode.pointIds_.size());
+
+	pointNodeMap_.emplace(pointId, nodeIndex);
+
+	if (leafNode.pointIds_.size() > size_t(parameters_.maximalPointsPerLeaf_))
+	{
+		splitLeaf(nodeIndex);
+	}
+
+	return true;
+}
+
+template <typename T>
+bool DynamicOctreeT<T>::removePoint(const Index32 pointId)
+{
+	const typename PointNodeMap::const_iterator iPoint = pointNodeMap_.find(pointId);
+
+	if (iPoint == pointNodeMap_.cend())
+	{
+		return false;
+	}
+
+	const Index32 leafNodeIndex = iPoint->second;
+	pointNodeMap_.erase(iPoint);
+
+	Node& leafNode = nodes_[leafNodeIndex];
+	ocean_assert(leafNode.isLeaf());
+
+	for (size_t n = 0; n < leafNode.pointIds_.size(); ++n)
+	{
+		if (leafNode.pointIds_[n] == pointId)
+		{
+			leafNode.pointIds_[n] = leafNode.pointIds_.back();
+			leafNode.points_[n] = leafNode.points_.back();
+
+			leafNode.pointIds_.pop_back();
+			leafNode.points_.pop_back();
+
+			break;
+		}
+	}
+
+	if (pointNodeMap_.empty())
+	{
+		clear();
+		return true;
+	}
+
+	for (Index32 nodeIndex = leafNodeIndex; nodeIndex != invalidIndex(); nodeIndex = nodes_[nodeIndex].parentNode_)
+	{
+		ocean_assert(nodes_[nodeIndex].numberPoints_ >= 1);
+		--nodes_[nodeIndex].numberPoints_;
+	}
+
+	// subtrees are not merged as soon as they could, but once they hold at most half of the points of a leaf node, to avoid alternating splits and merges
+
+	const size_t mergeThreshold = size_t(parameters_.maximalPointsPerLeaf_ / 2u);
+
+	Index32 mergeNodeIndex = invalidIndex();
+
+	for (Index32 nodeIndex = nodes_[leafNodeIndex].parentNode_; nodeIndex != invalidIndex() && nodes_[nodeIndex].numberPoints_ <= mergeThreshold; nodeIndex = nodes_[nodeIndex].parentNode_)
+	{
+		mergeNodeIndex = nodeIndex;
+	}
+
+	if (mergeNodeIndex != invalidIndex())
+	{
+		mergeSubtree(mergeNodeIndex);
+	}
+
+	return true;
+}
+
+template <typename T>
+bool DynamicOctreeT<T>::movePoint(const Index32 pointId, const VectorT3<T>& point)
+{
+	const typename PointNodeMap::const_iterator iPoint = pointNodeMap_.find(pointId);
+
+	if (iPoint == pointNodeMap_.cend())
+	{
+		return false;
+	}
+
+	Node& leafNode = nodes_[iPoint->second];
+	ocean_assert(leafNode.isLeaf());
+
+	if (leafNode.isInside(point))
+	{
+		// the point stays in the same leaf node, so that we simply update the location
+
+		for (size_t n = 0; n < leafNode.pointIds_.size(); ++n)
+		{
+			if (leafNode.pointIds_[n] == pointId)
+			{
+				leafNode.points_[n] = point;
+				return true;
+			}
+		}
+
+		ocean_assert(false && "This should never happen!");
+		return false;
+	}
+
+	return removePoint(pointId) && insertPoint(pointId, point);
+}
+
+template <typename T>
+inline bool DynamicOctreeT<T>::hasPoint(const Index32 pointId) const
+{
+	return pointNodeMap_.find(pointId) != pointNodeMap_.cend();
+}
+
+template <typename T>
+inline size_t DynamicOctreeT<T>::size() const
+{
+	return pointNodeMap_.size();
+}
+
+template <typename T>
+inline size_t DynamicOctreeT<T>::numberNodes() const
+{
+	ocean_assert(nodes_.size() >= freeChildNodes_.size() * 8);
+
+	return nodes_.size() - freeChildNodes_.size() * 8;
+}
+
+template <typename T>
+inline BoxT3<T> DynamicOctreeT<T>::boundingBox() const
+{
+	if (nodes_.empty())
+	{
+		return BoxT3<T>();
+	}
+
+	return nodes_.front().box();
+}
+
+template <typename T>
+void DynamicOctreeT<T>::clear()
+{
+	nodes_.clear();
+	freeChildNodes_.clear();
+	pointNodeMap_.clear();
+}
+
+template <typename T>
+void DynamicOctreeT<T>::closestLeaves(const VectorT3<T>& queryPoint, const T maximalDistance, std::vector<const Indices32*>& leaves, const ReusableData& reusableData) const
+{
+	ocean_assert(maximalDistance >= T(0));
+
+	if (!isValid())
+	{
+		return;
+	}
+
+	const T maximalSqrDistance = maximalDistance * maximalDistance;
+
+	if (nodes_.front().sqrDistance(queryPoint) > maximalSqrDistance)
+	{
+		return;
+	}
+
+	Indices32& nodeIndices = reusableData.internalData_;
+	nodeIndices.clear();
+	nodeIndices.emplace_back(0u);
+
+	while (!nodeIndices.empty())
+	{
+		const Node& node = nodes_[nodeIndices.back()];
+		nodeIndices.pop_back();
+
+		if (node.isLeaf())
+		{
+			if (!node.pointIds_.empty())
+			{
+				leaves.emplace_back(&node.pointIds_);
+			}
+
+			continue;
+		}
+
+		for (Index32 childNodeIndex = node.firstChildNode_; childNodeIndex < node.firstChildNode_ + 8u; ++childNodeIndex)
+		{
+			const Node& childNode = nodes_[childNodeIndex];
+
+			if (childNode.numberPoints_ != 0 && childNode.sqrDistance(queryPoint) <= maximalSqrDistance)
+			{
+				nodeIndices.emplace_back(childNodeIndex);
+			}
+		}
+	}
+}
+
+template <typename T>
+void DynamicOctreeT<T>::intersectingLeaves(const LineT3<T>& queryRay, std::vector<const Indices32*>& leaves, const ReusableData& reusableData) const
+{
+	ocean_assert(queryRay.isValid());
+	ocean_assert(leaves.empty());
+
+	if (!isValid() || !nodes_.front().box().hasIntersection(queryRay))
+	{
+		return;
+	}
+
+	Indices32& nodeIndices = reusableData.internalData_;
+	nodeIndices.clear();
+	nodeIndices.emplace_back(0u);
+
+	while (!nodeIndices.empty())
+	{
+		const Node& node = nodes_[nodeIndices.back()];
+		nodeIndices.pop_back();
+
+		if (node.isLeaf())
+		{
+			if (!node.pointIds_.empty())
+			{
+				leaves.emplace_back(&node.pointIds_);
+			}
+
+			continue;
+		}
+
+		for (Index32 childNodeIndex = node.firstChildNode_; childNodeIndex < node.firstChildNode_ + 8u; ++childNodeIndex)
+		{
+			const Node& childNode = nodes_[childNodeIndex];
+
+			if (childNode.numberPoints_ != 0 && childNode.box().hasIntersection(queryRay))
+			{
+				nodeIndices.emplace_back(childNodeIndex);
+			}
+		}
+	}
+}
+
+template <typename T>
+void DynamicOctreeT<T>::intersectingLeaves(const LineT3<T>& queryRay, const T tanHalfAngle, std::vector<const Indices32*>& leaves, const ReusableData& reusableData) const
+{
+	ocean_assert(queryRay.isValid());
+	ocean_assert(tanHalfAngle >= 0 && tanHalfAngle < 1);
+	ocean_assert(leaves.empty());
+
+	const T& epsPerDistance = tanHalfAngle;
+
+	if (!isValid() || !nodes_.front().box().hasIntersection(queryRay, epsPerDistance))
+	{
+		return;
+	}
+
+	Indices32& nodeIndices = reusableData.internalData_;
+	nodeIndices.clear();
+	nodeIndices.emplace_back(0u);
+
+	while (!nodeIndices.empty())
+	{
+		const Node& node = nodes_[nodeIndices.back()];
+		nodeIndices.pop_back();
+
+		if (node.isLeaf())
+		{
+			if (!node.pointIds_.empty())
+			{
+				leaves.emplace_back(&node.pointIds_);
+			}
+
+			continue;
+		}
+
+		for (Index32 childNodeIndex = node.firstChildNode_; childNodeIndex < node.firstChildNode_ + 8u; ++childNodeIndex)
+		{
+			const Node& childNode = nodes_[childNodeIndex];
+
+			if (childNode.numberPoints_ != 0 && childNode.box().hasIntersection(queryRay, epsPerDistance))
+			{
+				nodeIndices.emplace_back(childNodeIndex);
+			}
+		}
+	}
+}
+
+template <typename T>
+void DynamicOctreeT<T>::closestPoints(const VectorT3<T>& queryPoint, const T maximalDistance, Indices32& pointIds, VectorsT3<T>* points, const ReusableData& reusableData) const
+{
+	ocean_assert(maximalDistance >= T(0));
+
+	ocean_assert(pointIds.empty());
+	ocean_assert(points == nullptr || points->empty());
+
+	if (!isValid())
+	{
+		return;
+	}
+
+	const T maximalSqrDistance = maximalDistance * maximalDistance;
+
+	if (nodes_.front().sqrDistance(queryPoint) > maximalSqrDistance)
+	{
+		return;
+	}
+
+	Indices32& nodeIndices = reusableData.internalData_;
+	nodeIndices.clear();
+	nodeIndices.emplace_back(0u);
+
+	while (!nodeIndices.empty())
+	{
+		const Node& node = nodes_[nodeIndices.back()];
+		nodeIndices.pop_back();
+
+		if (node.isLeaf())
+		{
+			for (size_t n = 0; n < node.points_.size(); ++n)
+			{
+				const VectorT3<T>& point = node.points_[n];
+
+				if (point.sqrDistance(queryPoint) <= maximalSqrDistance)
+				{
+					pointIds.emplace_back(node.pointIds_[n]);
+
+					if (points != nullptr)
+					{
+						points->emplace_back(point);
+					}
+				}
+			}
+
+			continue;
+		}
+
+		for (Index32 childNodeIndex = node.firstChildNode_; childNodeIndex < node.firstChildNode_ + 8u; ++childNodeIndex)
+		{
+			const Node& childNode = nodes_[childNodeIndex];
+
+			if (childNode.numberPoints_ != 0 && childNode.sqrDistance(queryPoint) <= maximalSqrDistance)
+			{
+				nodeIndices.emplace_back(childNodeIndex);
+			}
+		}
+	}
+}
+
+template <typename T>
+void DynamicOctreeT<T>::closestPoints(const VectorT3<T>* queryPoints, const size_t numberQueryPoints, const T maximalDistance, std::vector<Indices32>& pointIdsGroups, Worker* worker) const
+{
+	ocean_assert(queryPoints != nullptr && numberQueryPoints >= 1);
+	ocean_assert(maximalDistance >= T(0));
+
+	pointIdsGroups.resize(numberQueryPoints);
+
+	if (worker != nullptr && numberQueryPoints >= 100)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &DynamicOctreeT<T>::closestPointsSubset, queryPoints, maximalDistance, pointIdsGroups.data(), 0u, 0u), 0u, (unsigned int)(numberQueryPoints), 3u, 4u, 20u);
+	}
+	else
+	{
+		closestPointsSubset(queryPoints, maximalDistance, pointIdsGroups.data(), 0u, (unsigned int)(numberQueryPoints));
+	}
+}
+
+template <typename T>
+inline bool DynamicOctreeT<T>::isValid() const
+{
+	return !nodes_.empty();
+}
+
+template <typename T>
+bool DynamicOctreeT<T>::growRoot(const VectorT3<T>& point)
+{
+	ocean_assert(!nodes_.empty());
+
+	unsigned int iterations = 0u;
+
+	while (!nodes_.front().isInside(point))
+	{
+		// each iteration doubles the root cube, so that we can stop for invalid points (e.g., NaN)
+
+		if (++iterations > 64u)
+		{
+			return false;
+		}
+
+		const VectorT3<T> oldCenter(nodes_.front().center_);
+		const T oldHalfSize = nodes_.front().halfSize_;
+
+		// the new root cube is extended towards the point, the old root cube becomes one of the new child cubes
+
+		const VectorT3<T> newCenter(oldCenter.x() + (point.x() < oldCenter.x() ? -oldHalfSize : oldHalfSize), oldCenter.y() + (point.y() < oldCenter.y() ? -oldHalfSize : oldHalfSize), oldCenter.z() + (point.z() < oldCenter.z() ? -oldHalfSize : oldHalfSize));
+
+		const Index32 firstChildNode = allocateChildNodes();
+
+		Node newRoot;
+		newRoot.center_ = newCenter;
+		newRoot.halfSize_ = oldHalfSize * T(2);
+		newRoot.firstChildNode_ = firstChildNode;
+		newRoot.numberPoints_ = nodes_.front().numberPoints_;
+
+		const unsigned int oldRootChildIndex = newRoot.childIndex(oldCenter);
+
+		for (unsigned int n = 0u; n < 8u; ++n)
+		{
+			Node& childNode = nodes_[firstChildNode + n];
+
+			childNode.center_ = newCenter + VectorT3<T>((n & 4u) ? oldHalfSize : -oldHalfSize, (n & 2u) ? oldHalfSize : -oldHalfSize, (n & 1u) ? oldHalfSize : -oldHalfSize);
+			childNode.halfSize_ = oldHalfSize;
+			childNode.parentNode_ = 0u;
+		}
+
+		const Index32 oldRootIndex = firstChildNode + oldRootChildIndex;
+
+		Node& oldRoot = nodes_[oldRootIndex];
+		oldRoot = std::move(nodes_.front());
+		oldRoot.parentNode_ = 0u;
+
+		if (oldRoot.isLeaf())
+		{
+			for (const Index32& pointId : oldRoot.pointIds_)
+			{
+				pointNodeMap_[pointId] = oldRootIndex;
+			}
+		}
+		else
+		{
+			for (Index32 childNodeIndex = oldRoot.firstChildNode_; childNodeIndex < oldRoot.firstChildNode_ + 8u; ++childNodeIndex)
+			{
+				nodes_[childNodeIndex].parentNode_ = oldRootIndex;
+			}
+		}
+
+		nodes_.front() = std::move(newRoot);
+	}
+
+	return true;
+}
+
+template <typename T>
+void DynamicOctreeT<T>::splitLeaf(const Index32 nodeIndex)
+{
+	ocean_assert(nodeIndex < nodes_.size());
+	ocean_assert(nodes_[nodeIndex].isLeaf());
+
+	{
+		const Node& node = nodes_[nodeIndex];
+
+		if (node.halfSize_ <= NumericT<T>::weakEps())
+		{
+			// the cube is too small to be split further
+			return;
+		}
+
+		// let's ensure that not all points are identical, in this case the node stays a leaf node
+
+		bool allPointsIdentical = true;
+
+		for (size_t n = 1; n < node.points_.size(); ++n)
+		{
+			if (node.points_[n] != node.points_[0])
+			{
+				allPointsIdentical = false;
+				break;
+			}
+		}
+
+		if (allPointsIdentical)
+		{
+			return;
+		}
+	}
+
+	const Index32 firstChildNode = allocateChildNodes();
+
+	// the arena may have been resized, we must not access any node reference from before
+
+	Node& node = nodes_[nodeIndex];
+
+	const T childHalfSize = node.halfSize_ * T(0.5);
+
+	for (unsigned int n = 0u; n < 8u; ++n)
+	{
+		Node& childNode = nodes_[firstChildNode + n];
+
+		childNode.center_ = node.center_ + VectorT3<T>((n & 4u) ? childHalfSize : -childHalfSize, (n & 2u) ? childHalfSize : -childHalfSize, (n & 1u) ? childHalfSize : -childHalfSize);
+		childNode.halfSize_ = childHalfSize;
+		childNode.parentNode_ = nodeIndex;
+	}
+
+	for (size_t n = 0; n < node.points_.size(); ++n)
+	{
+		const Index32 childNodeIndex = firstChildNode + node.childIndex(node.points_[n]);
+
+		Node& childNode = nodes_[childNodeIndex];
+
+		childNode.pointIds_.emplace_back(node.pointIds_[n]);
+		childNode.points_.emplace_back(node.points_[n]);
+		++childNode.numberPoints_;
+
+		pointNodeMap_[node.pointIds_[n]] = childNodeIndex;
+	}
+
+	node.pointIds_ = Indices32();
+	node.points_ = VectorsT3<T>();
+	node.firstChildNode_ = firstChildNode;
+
+	for (Index32 childNodeIndex = firstChildNode; childNodeIndex < firstChildNode + 8u; ++childNodeIndex)
+	{
+		if (nodes_[childNodeIndex].pointIds_.size() > size_t(parameters_.maximalPointsPerLeaf_))
+		{
+			splitLeaf(childNodeIndex);
+		}
+	}
+}
+
+template <typename T>
+void DynamicOctreeT<T>::mergeSubtree(const Index32 nodeIndex)
+{
+	ocean_assert(nodeIndex < nodes_.size());
+	ocean_assert(!nodes_[nodeIndex].isLeaf());
+
+	Indices32 pointIds;
+	VectorsT3<T> points;
+
+	pointIds.reserve(nodes_[nodeIndex].numberPoints_);
+	points.reserve(nodes_[nodeIndex].numberPoints_);
+
+	gatherPoints(nodeIndex, pointIds, points);
+
+	Node& node = nodes_[nodeIndex];
+	ocean_assert(node.numberPoints_ == pointIds.size());
+
+	releaseChildNodes(node.firstChildNode_);
+
+	node.firstChildNode_ = invalidIndex();
+
+	for (const Index32& pointId : pointIds)
+	{
+		pointNodeMap_[pointId] = nodeIndex;
+	}
+
+	node.pointIds_ = std::move(pointIds);
+	node.points_ = std::move(points);
+}
+
+template <typename T>
+void DynamicOctreeT<T>::gatherPoints(const Index32 nodeIndex, Indices32& pointIds, VectorsT3<T>& points) const
+{
+	const Node& node = nodes_[nodeIndex];
+
+	if (node.isLeaf())
+	{
+		pointIds.insert(pointIds.end(), node.pointIds_.cbegin(), node.pointIds_.cend());
+		points.insert(points.end(), node.points_.cbegin(), node.points_.cend());
+
+		return;
+	}
+
+	for (Index32 childNodeIndex = node.firstChildNode_; childNodeIndex < node.firstChildNode_ + 8u; ++childNodeIndex)
+	{
+		if (nodes_[childNodeIndex].numberPoints_ != 0)
+		{
+			gatherPoints(childNodeIndex, pointIds, points);
+		}
+	}
+}
+
+template <typename T>
+Index32 DynamicOctreeT<T>::allocateChildNodes()
+{
+	if (!freeChildNodes_.empty())
+	{
+		const Index32 firstChildNode = freeChildNodes_.back();
+		freeChildNodes_.pop_back();
+
+		return firstChildNode;
+	}
+
+	const Index32 firstChildNode = Index32(nodes_.size());
+
+	nodes_.resize(nodes_.size() + 8);
+
+	return firstChildNode;
+}
+
+template <typename T>
+void DynamicOctreeT<T>::releaseChildNodes(const Index32 firstChildNode)
+{
+	ocean_assert(firstChildNode + 8u <= nodes_.size());
+
+	for (Index32 childNodeIndex = firstChildNode; childNodeIndex < firstChildNode + 8u; ++childNodeIndex)
+	{
+		Node& childNode = nodes_[childNodeIndex];
+
+		if (!childNode.isLeaf())
+		{
+			releaseChildNodes(childNode.firstChildNode_);
+		}
+
+		childNode = Node();
+	}
+
+	freeChildNodes_.emplace_back(firstChildNode);
+}
+
+template <typename T>
+void DynamicOctreeT<T>::closestPointsSubset(const VectorT3<T>* queryPoints, const T maximalDistance, Indices32* pointIdsGroups, const unsigned int firstQueryPoint, const unsigned int numberQueryPoints) const
+{
+	ocean_assert(queryPoints != nullptr && pointIdsGroups != nullptr);
+
+	const ReusableData reusableData;
+
+	for (unsigned int n = firstQueryPoint; n < firstQueryPoint + numberQueryPoints; ++n)
+	{
+		pointIdsGroups[n].clear();
+
+		closestPoints(queryPoints[n], maximalDistance, pointIdsGroups[n], nullptr, reusableData);
+	}
+}
+
+template <typename T>
+constexpr Index32 DynamicOctreeT<T>::invalidIndex()
+{
+	return Index32(-1);
+}
+
+}
+
+}
+
+#endif // META_OCEAN_GEOMETRY_DYNAMIC_OCTREE_H
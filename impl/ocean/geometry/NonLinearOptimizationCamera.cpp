@@ -10,12 +10,14 @@
 #include "ocean/geometry/NonLinearUniversalOptimizationSparse.h"
 
 #include "ocean/base/HashMap.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/geometry/Error.h"
 #include "ocean/geometry/Jacobian.h"
 
 #include "ocean/math/ExponentialMap.h"
 #include "ocean/math/Pose.h"
+#include "ocean/math/StaticMatrix.h"
 
 namespace Ocean
 {
@@ -1290,7 +1292,7 @@ class NonLinearOptimizationCamera::CameraPosesOptimizationProvider : public NonL
 		inline bool hasSolver() const
 		{
 			// **NOTE** we do not implement our own solver based on the Schur complement as the performance does not seem to be better (e.g., because of the overhead due to the creation for the sub-matrices)
-			// however, the performance should be improved further by application of AdvancedSparseOptimizationProvider instead of the default Provider
+			// however, CameraPosesSchurOptimizationProvider avoids the creation of the sub-matrices and distributes the computation if a worker is provided
 
 			return false;
 		}
@@ -1635,7 +1637,502 @@ class NonLinearOptimizationCamera::CameraPosesOptimizationProvider : public NonL
 		Scalar distortionRestrictionFactor_ = 0;
 };
 
-bool NonLinearOptimizationCamera::optimizeCameraPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, const unsigned int iterations, const OptimizationStrategy optimizationStrategy, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
+/**
+ * This class implements an advanced sparse optimization provider for a camera and several 6DOF poses.
+ * The provider determines the blocks of the normal equations for each camera pose individually (and in parallel), while the linear system is solved with the Schur complement of the camera poses.<br>
+ * Thus, only a small linear system for the camera parameters needs to be solved, the pose parameters are determined afterwards by back-substitution.<br>
+ * The provider supports the square estimator only.
+ */
+class NonLinearOptimizationCamera::CameraPosesSchurOptimizationProvider : public CameraPosesOptimizationProvider
+{
+	protected:
+
+		/**
+		 * Definition of a 6x6 matrix for the pose block of the normal equations.
+		 */
+		using PoseMatrix = StaticMatrix<Scalar, 6, 6>;
+
+		/**
+		 * Definition of a 6x1 vector for the pose parameters.
+		 */
+		using PoseVector = StaticMatrix<Scalar, 6, 1>;
+
+	public:
+
+		/**
+		 * Creates a new optimization provider object.
+		 * @param camera The camera object to be optimized
+		 * @param flippedCameras_T_world The inverted and flipped camera poses to be optimized
+		 * @param objectPointGroups Groups of 3D object points
+		 * @param imagePointGroups Groups of 2D observation image points
+		 * @param onlyFrontObjectPoints True, to allow only object points in front of the camera
+		 * @param numberActualCameraParameters The number of camera parameters which will be optimized
+		 * @param distortionRestrictionFactor Factor used to constrain higher-order distortion parameters, with range [0, infinity); 0 to disable restriction
+		 * @param worker Optional worker object to distribute the computation
+		 */
+		inline CameraPosesSchurOptimizationProvider(SharedAnyCamera& camera, NonconstTemplateArrayAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, const bool onlyFrontObjectPoints, const size_t numberActualCameraParameters, const Scalar distortionRestrictionFactor, Worker* worker) :
+			CameraPosesOptimizationProvider(camera, flippedCameras_T_world, objectPointGroups, imagePointGroups, onlyFrontObjectPoints, numberActualCameraParameters, distortionRestrictionFactor),
+			worker_(worker)
+		{
+			const size_t numberPoses = flippedCameras_T_world_.size();
+			const size_t numberCameraParameters = numberActualCameraParameters_;
+
+			poseSqrErrors_.resize(numberPoses);
+
+			poseHessians_.resize(numberPoses);
+			poseJacobianErrors_.resize(numberPoses);
+			cameraPoseHessians_.resize(numberPoses * numberCameraParameters * 6);
+			cameraHessians_.resize(numberPoses * numberCameraParameters * numberCameraParameters);
+			cameraJacobianErrors_.resize(numberPoses * numberCameraParameters);
+
+			intermediatePoseJacobianErrors_.resize(numberPoses);
+			intermediateCameraPoseMatrices_.resize(numberPoses * numberCameraParameters * 6);
+			poseSolved_.resize(numberPoses);
+		}
+
+		/**
+		 * Determines the error for the current model candidate (not the actual model).
+		 * @return The averaged square error, Numeric::maxValue() if the candidate is invalid
+		 */
+		Scalar determineError()
+		{
+			ocean_assert(observations_ != 0);
+
+			const unsigned int numberPoses = (unsigned int)(flippedCameras_T_world_.size());
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &CameraPosesSchurOptimizationProvider::determineErrorSubset, 0u, 0u), 0u, numberPoses);
+			}
+			else
+			{
+				determineErrorSubset(0u, numberPoses);
+			}
+
+			// the individual errors are accumulated in a fixed order so that the result does not depend on the number of threads
+
+			Scalar sqrError = 0;
+
+			for (const Scalar poseSqrError : poseSqrErrors_)
+			{
+				if (poseSqrError == Numeric::maxValue())
+				{
+					return Numeric::maxValue();
+				}
+
+				sqrError += poseSqrError;
+			}
+
+			return sqrError / Scalar(observations_);
+		}
+
+		/**
+		 * Determines the blocks of the normal equations for the current model.
+		 * @return True, if succeeded
+		 */
+		bool determineParameters()
+		{
+			const size_t numberCameraParameters = numberActualCameraParameters_;
+			const unsigned int numberPoses = (unsigned int)(flippedCameras_T_world_.size());
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &CameraPosesSchurOptimizationProvider::determineParametersSubset, 0u, 0u), 0u, numberPoses);
+			}
+			else
+			{
+				determineParametersSubset(0u, numberPoses);
+			}
+
+			cameraHessian_ = Matrix(numberCameraParameters, numberCameraParameters, false);
+			cameraJacobianError_ = Matrix(numberCameraParameters, 1, false);
+
+			for (size_t p = 0; p < numberPoses; ++p)
+			{
+				const Scalar* poseCameraHessian = cameraHessians_.data() + p * numberCameraParameters * numberCameraParameters;
+				const Scalar* poseCameraJacobianError = cameraJacobianErrors_.data() + p * numberCameraParameters;
+
+				for (size_t n = 0; n < numberCameraParameters * numberCameraParameters; ++n)
+				{
+					cameraHessian_.data()[n] += poseCameraHessian[n];
+				}
+
+				for (size_t n = 0; n < numberCameraParameters; ++n)
+				{
+					cameraJacobianError_(n, 0) += poseCameraJacobianError[n];
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 * Returns whether the optimization process should stop e.g., due to an external event.
+		 * @return False, as the optimization does not stop before convergence
+		 */
+		inline bool shouldStop()
+		{
+			return false;
+		}
+
+		/**
+		 * Solves the linear equation Hessian * deltas = -jacobianError based on the internal data.
+		 * The pose parameters are eliminated with the Schur complement, the reduced system for the camera parameters is solved and the pose parameters are determined by back-substitution.
+		 * @param deltas The resulting deltas, first the camera parameters followed by 6 parameters for each pose
+		 * @param lambda Optional Levenberg-Marquardt damping value, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		bool solve(Matrix& deltas, const Scalar lambda = Scalar(0))
+		{
+			ocean_assert(lambda >= 0);
+
+			const size_t numberCameraParameters = numberActualCameraParameters_;
+			const unsigned int numberPoses = (unsigned int)(flippedCameras_T_world_.size());
+
+			// first, we determine W_i * V_i^-1 and V_i^-1 * e_i for each pose
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &CameraPosesSchurOptimizationProvider::eliminatePosesSubset, lambda, 0u, 0u), 0u, numberPoses);
+			}
+			else
+			{
+				eliminatePosesSubset(lambda, 0u, numberPoses);
+			}
+
+			for (const uint8_t poseSolved : poseSolved_)
+			{
+				if (poseSolved == 0u)
+				{
+					return false;
+				}
+			}
+
+			deltas.resize(numberCameraParameters + size_t(numberPoses) * 6, 1);
+
+			Matrix cameraDeltas(numberCameraParameters, 1, false);
+
+			if (numberCameraParameters != 0)
+			{
+				// now, we determine the Schur complement: U - sum(W_i * V_i^-1 * W_i^T), and the corresponding right side: e_c - sum(W_i * V_i^-1 * e_i)
+
+				Matrix schurComplement(cameraHessian_);
+				Matrix schurJacobianError(cameraJacobianError_);
+
+				for (size_t n = 0; n < numberCameraParameters; ++n)
+				{
+					schurComplement(n, n) *= Scalar(1) + lambda;
+				}
+
+				for (size_t p = 0; p < numberPoses; ++p)
+				{
+					const Scalar* const intermediateCameraPoseMatrix = intermediateCameraPoseMatrices_.data() + p * numberCameraParameters * 6;
+					const Scalar* const cameraPoseHessian = cameraPoseHessians_.data() + p * numberCameraParameters * 6;
+					const PoseVector& poseJacobianError = poseJacobianErrors_[p];
+
+					for (size_t r = 0; r < numberCameraParameters; ++r)
+					{
+						const Scalar* const intermediateRow = intermediateCameraPoseMatrix + r * 6;
+
+						for (size_t c = 0; c < numberCameraParameters; ++c)
+						{
+							const Scalar* const cameraPoseRow = cameraPoseHessian + c * 6;
+
+							schurComplement(r, c) -= intermediateRow[0] * cameraPoseRow[0] + intermediateRow[1] * cameraPoseRow[1] + intermediateRow[2] * cameraPoseRow[2]
+														+ intermediateRow[3] * cameraPoseRow[3] + intermediateRow[4] * cameraPoseRow[4] + intermediateRow[5] * cameraPoseRow[5];
+						}
+
+						schurJacobianError(r, 0) -= intermediateRow[0] * poseJacobianError[0] + intermediateRow[1] * poseJacobianError[1] + intermediateRow[2] * poseJacobianError[2]
+														+ intermediateRow[3] * poseJacobianError[3] + intermediateRow[4] * poseJacobianError[4] + intermediateRow[5] * poseJacobianError[5];
+					}
+				}
+
+				if (!schurComplement.solve<Matrix::MP_SYMMETRIC>(schurJacobianError, cameraDeltas))
+				{
+					return false;
+				}
+
+				for (size_t n = 0; n < numberCameraParameters; ++n)
+				{
+					deltas(n, 0) = cameraDeltas(n, 0);
+				}
+			}
+
+			// finally, we determine the pose deltas by back-substitution: V_i^-1 * e_i - (W_i * V_i^-1)^T * camera deltas
+
+			if (worker_ != nullptr)
+			{
+				worker_->executeFunction(Worker::Function::create(*this, &CameraPosesSchurOptimizationProvider::determinePoseDeltasSubset, (const Scalar*)(cameraDeltas.data()), deltas.data(), 0u, 0u), 0u, numberPoses);
+			}
+			else
+			{
+				determinePoseDeltasSubset(cameraDeltas.data(), deltas.data(), 0u, numberPoses);
+			}
+
+			return true;
+		}
+
+	protected:
+
+		/**
+		 * Determines the square errors of a subset of the candidate poses.
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void determineErrorSubset(const unsigned int firstPose, const unsigned int numberPoses)
+		{
+			for (size_t p = size_t(firstPose); p < size_t(firstPose + numberPoses); ++p)
+			{
+				const HomogenousMatrix4& candidateFlippedCamera_T_world = candidateFlippedCameras_T_world_[p];
+				const Vectors3& objectPoints = objectPointGroups_[p];
+				const Vectors2& imagePoints = imagePointGroups_[p];
+
+				Scalar sqrError = 0;
+
+				for (size_t i = 0; i < objectPoints.size(); ++i)
+				{
+					const Vector3& objectPoint = objectPoints[i];
+
+					if (onlyFrontObjectPoints_ && !PinholeCamera::isObjectPointInFrontIF(candidateFlippedCamera_T_world, objectPoint))
+					{
+						sqrError = Numeric::maxValue();
+						break;
+					}
+
+					sqrError += Error::determinePoseErrorIF(candidateFlippedCamera_T_world, *candidateCamera_, objectPoint, imagePoints[i]).sqr();
+				}
+
+				poseSqrErrors_[p] = sqrError;
+			}
+		}
+
+		/**
+		 * Determines the blocks of the normal equations for a subset of the current poses.
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void determineParametersSubset(const unsigned int firstPose, const unsigned int numberPoses)
+		{
+			const size_t numberCameraParameters = numberActualCameraParameters_;
+
+			Scalars jacobianCameraX(numberMaximalCameraParameters_);
+			Scalars jacobianCameraY(numberMaximalCameraParameters_);
+
+			Scalar jacobianPoseX[6];
+			Scalar jacobianPoseY[6];
+
+			for (size_t p = size_t(firstPose); p < size_t(firstPose + numberPoses); ++p)
+			{
+				const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world_[p];
+				const Vectors3& objectPoints = objectPointGroups_[p];
+				const Vectors2& imagePoints = imagePointGroups_[p];
+
+				PoseMatrix& poseHessian = poseHessians_[p];
+				PoseVector& poseJacobianError = poseJacobianErrors_[p];
+
+				Scalar* const cameraPoseHessian = cameraPoseHessians_.data() + p * numberCameraParameters * 6;
+				Scalar* const cameraHessian = cameraHessians_.data() + p * numberCameraParameters * numberCameraParameters;
+				Scalar* const cameraJacobianError = cameraJacobianErrors_.data() + p * numberCameraParameters;
+
+				poseHessian = PoseMatrix(false);
+				poseJacobianError = PoseVector(false);
+
+				memset(cameraPoseHessian, 0, sizeof(Scalar) * numberCameraParameters * 6);
+				memset(cameraHessian, 0, sizeof(Scalar) * numberCameraParameters * numberCameraParameters);
+				memset(cameraJacobianError, 0, sizeof(Scalar) * numberCameraParameters);
+
+				const Pose flippedCamera_P_world(flippedCamera_T_world);
+
+				SquareMatrix3 Rwx, Rwy, Rwz;
+				Jacobian::calculateRotationRodriguesDerivative(ExponentialMap(Vector3(flippedCamera_P_world.rx(), flippedCamera_P_world.ry(), flippedCamera_P_world.rz())), Rwx, Rwy, Rwz);
+
+				for (size_t i = 0; i < objectPoints.size(); ++i)
+				{
+					if (isFisheyeCamera_)
+					{
+						ocean_assert(camera_->name() == AnyCameraFisheye::WrappedCamera::name());
+						const FisheyeCamera& fisheyeCamera = ((const AnyCameraFisheye&)(*camera_)).actualCamera();
+
+						Jacobian::calculateJacobianCameraPoseRodrigues2x18IF(fisheyeCamera, flippedCamera_T_world, objectPoints[i], Rwx, Rwy, Rwz, jacobianCameraX.data(), jacobianCameraY.data(), jacobianPoseX, jacobianPoseY);
+					}
+					else
+					{
+						ocean_assert(camera_->name() == AnyCameraPinhole::WrappedCamera::name());
+						const PinholeCamera& pinholeCamera = ((const AnyCameraPinhole&)(*camera_)).actualCamera();
+
+						Jacobian::calculateJacobianCameraPoseRodrigues2x14IF(pinholeCamera, flippedCamera_T_world, objectPoints[i], Rwx, Rwy, Rwz, jacobianCameraX.data(), jacobianCameraY.data(), jacobianPoseX, jacobianPoseY);
+					}
+
+					const Vector2 error = Error::determinePoseErrorIF(flippedCamera_T_world, *camera_, objectPoints[i], imagePoints[i]);
+
+					for (size_t r = 0; r < 6; ++r)
+					{
+						for (size_t c = r; c < 6; ++c)
+						{
+							poseHessian(r, c) += jacobianPoseX[r] * jacobianPoseX[c] + jacobianPoseY[r] * jacobianPoseY[c];
+						}
+
+						poseJacobianError[r] += jacobianPoseX[r] * error.x() + jacobianPoseY[r] * error.y();
+					}
+
+					for (size_t r = 0; r < numberCameraParameters; ++r)
+					{
+						for (size_t c = r; c < numberCameraParameters; ++c)
+						{
+							cameraHessian[r * numberCameraParameters + c] += jacobianCameraX[r] * jacobianCameraX[c] + jacobianCameraY[r] * jacobianCameraY[c];
+						}
+
+						for (size_t c = 0; c < 6; ++c)
+						{
+							cameraPoseHessian[r * 6 + c] += jacobianCameraX[r] * jacobianPoseX[c] + jacobianCameraY[r] * jacobianPoseY[c];
+						}
+
+						cameraJacobianError[r] += jacobianCameraX[r] * error.x() + jacobianCameraY[r] * error.y();
+					}
+				}
+
+				// we mirror the upper triangle of both symmetric blocks
+
+				for (size_t r = 1; r < 6; ++r)
+				{
+					for (size_t c = 0; c < r; ++c)
+					{
+						poseHessian(r, c) = poseHessian(c, r);
+					}
+				}
+
+				for (size_t r = 1; r < numberCameraParameters; ++r)
+				{
+					for (size_t c = 0; c < r; ++c)
+					{
+						cameraHessian[r * numberCameraParameters + c] = cameraHessian[c * numberCameraParameters + r];
+					}
+				}
+			}
+		}
+
+		/**
+		 * Eliminates a subset of poses from the damped normal equations.
+		 * For each pose, W_i * V_i^-1 and V_i^-1 * e_i are determined with W_i the camera/pose block and V_i the damped pose block of the normal equations.
+		 * @param lambda The Levenberg-Marquardt damping value, with range [0, infinity)
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void eliminatePosesSubset(const Scalar lambda, const unsigned int firstPose, const unsigned int numberPoses)
+		{
+			const size_t numberCameraParameters = numberActualCameraParameters_;
+
+			for (size_t p = size_t(firstPose); p < size_t(firstPose + numberPoses); ++p)
+			{
+				PoseMatrix dampedPoseHessian(poseHessians_[p]);
+
+				for (size_t n = 0; n < 6; ++n)
+				{
+					dampedPoseHessian(n, n) *= Scalar(1) + lambda;
+				}
+
+				poseSolved_[p] = 0u;
+
+				if (!dampedPoseHessian.solveCholesky(poseJacobianErrors_[p], intermediatePoseJacobianErrors_[p]))
+				{
+					continue;
+				}
+
+				const Scalar* const cameraPoseHessian = cameraPoseHessians_.data() + p * numberCameraParameters * 6;
+				Scalar* const intermediateCameraPoseMatrix = intermediateCameraPoseMatrices_.data() + p * numberCameraParameters * 6;
+
+				bool succeeded = true;
+
+				for (size_t r = 0; succeeded && r < numberCameraParameters; ++r)
+				{
+					// as V_i is symmetric, each row of W_i * V_i^-1 is the solution of V_i * x = (row of W_i)^T
+
+					const PoseVector cameraPoseRow(cameraPoseHessian + r * 6);
+					PoseVector intermediateRow;
+
+					succeeded = dampedPoseHessian.solveCholesky(cameraPoseRow, intermediateRow);
+
+					memcpy(intermediateCameraPoseMatrix + r * 6, intermediateRow.data(), sizeof(Scalar) * 6);
+				}
+
+				poseSolved_[p] = succeeded ? 1u : 0u;
+			}
+		}
+
+		/**
+		 * Determines the deltas of a subset of poses by back-substitution of the camera deltas.
+		 * @param cameraDeltas The deltas of the camera parameters, must be valid if at least one camera parameter is optimized
+		 * @param deltas The resulting deltas, first the camera parameters followed by 6 parameters for each pose, must be valid
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		void determinePoseDeltasSubset(const Scalar* cameraDeltas, Scalar* deltas, const unsigned int firstPose, const unsigned int numberPoses) const
+		{
+			ocean_assert(deltas != nullptr);
+
+			const size_t numberCameraParameters = numberActualCameraParameters_;
+
+			for (size_t p = size_t(firstPose); p < size_t(firstPose + numberPoses); ++p)
+			{
+				const Scalar* const intermediateCameraPoseMatrix = intermediateCameraPoseMatrices_.data() + p * numberCameraParameters * 6;
+				const PoseVector& intermediatePoseJacobianError = intermediatePoseJacobianErrors_[p];
+
+				Scalar* const poseDeltas = deltas + numberCameraParameters + p * 6;
+
+				for (size_t c = 0; c < 6; ++c)
+				{
+					Scalar value = intermediatePoseJacobianError[c];
+
+					for (size_t r = 0; r < numberCameraParameters; ++r)
+					{
+						value -= intermediateCameraPoseMatrix[r * 6 + c] * cameraDeltas[r];
+					}
+
+					poseDeltas[c] = value;
+				}
+			}
+		}
+
+	protected:
+
+		/// The optional worker object to distribute the computation.
+		Worker* worker_ = nullptr;
+
+		/// The square errors of the individual candidate poses, Numeric::maxValue() for invalid poses.
+		Scalars poseSqrErrors_;
+
+		/// The pose blocks V_i of the normal equations, one for each pose.
+		std::vector<PoseMatrix> poseHessians_;
+
+		/// The pose blocks of the jacobian errors, one for each pose.
+		std::vector<PoseVector> poseJacobianErrors_;
+
+		/// The row-major camera/pose blocks W_i of the normal equations, with size numberActualCameraParameters_ x 6 for each pose.
+		Scalars cameraPoseHessians_;
+
+		/// The row-major contributions of the individual poses to the camera block of the normal equations, with size numberActualCameraParameters_ x numberActualCameraParameters_ for each pose.
+		Scalars cameraHessians_;
+
+		/// The contributions of the individual poses to the camera block of the jacobian errors, numberActualCameraParameters_ for each pose.
+		Scalars cameraJacobianErrors_;
+
+		/// The accumulated camera block U of the normal equations.
+		Matrix cameraHessian_;
+
+		/// The accumulated camera block of the jacobian errors.
+		Matrix cameraJacobianError_;
+
+		/// The intermediate vectors V_i^-1 * e_i, one for each pose.
+		std::vector<PoseVector> intermediatePoseJacobianErrors_;
+
+		/// The intermediate row-major matrices W_i * V_i^-1, with size numberActualCameraParameters_ x 6 for each pose.
+		Scalars intermediateCameraPoseMatrices_;
+
+		/// The states whether the damped pose blocks could be solved, one for each pose.
+		std::vector<uint8_t> poseSolved_;
+};
+
+bool NonLinearOptimizationCamera::optimizeCameraPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, const unsigned int iterations, const OptimizationStrategy optimizationStrategy, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, Worker* worker)
 {
 	ocean_assert(camera.isValid());
 
@@ -1648,7 +2145,7 @@ bool NonLinearOptimizationCamera::optimizeCameraPoses(const AnyCamera& camera, c
 	HomogenousMatrices4 optimizedFlippedCameras_T_world;
 	NonconstArrayAccessor<HomogenousMatrix4> accessor_optimizedFlippedCameras_T_world(optimizedFlippedCameras_T_world, world_T_optimizedCameras != nullptr ? world_T_cameras.size() : 0);
 
-	if (!optimizeCameraPosesIF(camera, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), objectPointGroups, imagePointGroups, optimizedCamera, accessor_optimizedFlippedCameras_T_world.pointer(), iterations, optimizationStrategy, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, distortionRestrictionFactor, initialError, finalError, intermediateErrors))
+	if (!optimizeCameraPosesIF(camera, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), objectPointGroups, imagePointGroups, optimizedCamera, accessor_optimizedFlippedCameras_T_world.pointer(), iterations, optimizationStrategy, estimator, lambda, lambdaFactor, onlyFrontObjectPoints, distortionRestrictionFactor, initialError, finalError, intermediateErrors, worker))
 	{
 		return false;
 	}
@@ -1664,7 +2161,7 @@ bool NonLinearOptimizationCamera::optimizeCameraPoses(const AnyCamera& camera, c
 	return true;
 }
 
-bool NonLinearOptimizationCamera::optimizeCameraPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, const unsigned int iterations, const OptimizationStrategy optimizationStrategy, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors)
+bool NonLinearOptimizationCamera::optimizeCameraPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, const unsigned int iterations, const OptimizationStrategy optimizationStrategy, const Estimator::EstimatorType estimator, Scalar lambda, const Scalar lambdaFactor, const bool onlyFrontObjectPoints, const Scalar distortionRestrictionFactor, Scalar* initialError, Scalar* finalError, Scalars* intermediateErrors, Worker* worker)
 {
 	ocean_assert(camera.isValid());
 	ocean_assert(objectPointGroups.size() == imagePointGroups.size());
@@ -1705,10 +2202,21 @@ bool NonLinearOptimizationCamera::optimizeCameraPosesIF(const AnyCamera& camera,
 
 		iterationIntermedidateErrors.clear();
 
-		CameraPosesOptimizationProvider provider(optimizedCamera, accessor_flippedOptimizedCameras_T_world, objectPointGroups, imagePointGroups, onlyFrontObjectPoints, numberActualCameraParameters, distortionRestrictionFactor);
-		if (!sparseOptimization<CameraPosesOptimizationProvider>(provider, iterations, estimator, lambda, lambdaFactor, &iterationInitialError, &iterationFinalError, nullptr, &iterationIntermedidateErrors))
+		if (worker != nullptr && Estimator::isStandardEstimator(estimator))
 		{
-			return false;
+			CameraPosesSchurOptimizationProvider provider(optimizedCamera, accessor_flippedOptimizedCameras_T_world, objectPointGroups, imagePointGroups, onlyFrontObjectPoints, numberActualCameraParameters, distortionRestrictionFactor, worker);
+			if (!advancedSparseOptimization<CameraPosesSchurOptimizationProvider>(provider, iterations, lambda, lambdaFactor, &iterationInitialError, &iterationFinalError, &iterationIntermedidateErrors))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			CameraPosesOptimizationProvider provider(optimizedCamera, accessor_flippedOptimizedCameras_T_world, objectPointGroups, imagePointGroups, onlyFrontObjectPoints, numberActualCameraParameters, distortionRestrictionFactor);
+			if (!sparseOptimization<CameraPosesOptimizationProvider>(provider, iterations, estimator, lambda, lambdaFactor, &iterationInitialError, &iterationFinalError, nullptr, &iterationIntermedidateErrors))
+			{
+				return false;
+			}
 		}
 
 		if (nStage == 0 && initialError != nullptr)
@@ -87,6 +87,11 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationCamera : protected NonLinearOpt
 		 */
 		class CameraPosesOptimizationProvider;
 
+		/**
+		 * Forward declaration of an advanced sparse optimization provider allowing to optimize a camera profile and camera poses concurrently with a distributed Schur complement solver.
+		 */
+		class CameraPosesSchurOptimizationProvider;
+
 		/**
 		 * Forward declaration of the data class allowing to optimized the camera parameters for unconstrained (translational and rotational) camera motion.
 		 * @tparam tParameters The number of parameters to optimized
@@ -201,10 +206,11 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationCamera : protected NonLinearOpt
 		 * @param initialError Optional resulting averaged pixel error for the given initial parameters, in relation to the defined estimator
 		 * @param finalError Optional resulting averaged pixel error for the final optimized parameters, in relation to the defined estimator
 		 * @param intermediateErrors Optional resulting intermediate averaged pixel errors for the individual optimization steps, in relation to the defined estimator
+		 * @param worker Optional worker object to distribute the computation; if defined and if the square estimator is used, the normal equations are determined in parallel and solved with the Schur complement of the camera poses
 		 * @return True, if succeeded
 		 * @see optimizeCameraPoseIF().
 		 */
-		static bool optimizeCameraPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, const unsigned int iterations, const OptimizationStrategy optimizationStrategy = OS_ALL_PARAMETERS_AFTER_ANOTHER, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, const Scalar distortionRestrictionFactor = Scalar(0), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr);
+		static bool optimizeCameraPoses(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& world_T_cameras, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* world_T_optimizedCameras, const unsigned int iterations, const OptimizationStrategy optimizationStrategy = OS_ALL_PARAMETERS_AFTER_ANOTHER, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, const Scalar distortionRestrictionFactor = Scalar(0), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, Worker* worker = nullptr);
 
 		/**
 		 * Minimizes the projection error between the projections of static 3D object points and their corresponding image points in several 6DOF camera poses.
@@ -213,7 +219,7 @@ class OCEAN_GEOMETRY_EXPORT NonLinearOptimizationCamera : protected NonLinearOpt
 		 * @param distortionRestrictionFactor Factor used to constrain higher-order distortion parameters based on the magnitude of lower-order ones during optimization, with range [0, infinity); 0 to disable restriction
 		 * @see optimizeCameraPoses().
 		 */
-		static bool optimizeCameraPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, const unsigned int iterations, const OptimizationStrategy optimizationStrategy = OS_ALL_PARAMETERS_AFTER_ANOTHER, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, const Scalar distortionRestrictionFactor = Scalar(0), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr);
+		static bool optimizeCameraPosesIF(const AnyCamera& camera, const ConstIndexedAccessor<HomogenousMatrix4>& flippedCameras_T_world, const ConstIndexedAccessor<Vectors3>& objectPointGroups, const ConstIndexedAccessor<Vectors2>& imagePointGroups, SharedAnyCamera& optimizedCamera, NonconstIndexedAccessor<HomogenousMatrix4>* flippedOptimizedCameras_T_world, const unsigned int iterations, const OptimizationStrategy optimizationStrategy = OS_ALL_PARAMETERS_AFTER_ANOTHER, const Estimator::EstimatorType estimator = Estimator::ET_SQUARE, Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), const bool onlyFrontObjectPoints = true, const Scalar distortionRestrictionFactor = Scalar(0), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Scalars* intermediateErrors = nullptr, Worker* worker = nullptr);
 
 		/**
 		 * Deprecated.
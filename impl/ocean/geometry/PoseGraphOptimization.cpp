@@ -0,0 +1,607 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/geometry/PoseGraphOptimization.h"
+
+#include "ocean/math/ExponentialMap.h"
+#include "ocean/math/Matrix.h"
+#include "ocean/math/SparseMatrix.h"
+
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace Geometry
+{
+
+bool PoseGraphOptimization::optimizePoses(const HomogenousMatrices4& world_T_poses, const Edges& edges, HomogenousMatrices4& world_T_optimizedPoses, const Indices32& fixedPoseIndices, const unsigned int iterations, const Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Worker* worker)
+{
+	return optimize<false>(world_T_poses, nullptr, edges, world_T_optimizedPoses, nullptr, fixedPoseIndices, iterations, lambda, lambdaFactor, initialError, finalError, worker);
+}
+
+bool PoseGraphOptimization::optimizeSimilarityPoses(const HomogenousMatrices4& world_T_poses, const Scalars& scales, const Edges& edges, HomogenousMatrices4& world_T_optimizedPoses, Scalars& optimizedScales, const Indices32& fixedPoseIndices, const unsigned int iterations, const Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Worker* worker)
+{
+	ocean_assert(world_T_poses.size() == scales.size());
+	if (world_T_poses.size() != scales.size())
+	{
+		return false;
+	}
+
+	optimizedScales.resize(scales.size());
+
+	return optimize<true>(world_T_poses, scales.data(), edges, world_T_optimizedPoses, optimizedScales.data(), fixedPoseIndices, iterations, lambda, lambdaFactor, initialError, finalError, worker);
+}
+
+template <bool tSimilarity>
+bool PoseGraphOptimization::optimize(const HomogenousMatrices4& world_T_poses, const Scalar* scales, const Edges& edges, HomogenousMatrices4& world_T_optimizedPoses, Scalar* optimizedScales, const Indices32& fixedPoseIndices, const unsigned int iterations, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Worker* worker)
+{
+	ocean_assert(world_T_poses.size() >= 2 && !edges.empty() && !fixedPoseIndices.empty());
+	ocean_assert(iterations >= 1u);
+	ocean_assert(lambda >= Scalar(0) && lambdaFactor >= Scalar(1));
+	ocean_assert(!tSimilarity || (scales != nullptr && optimizedScales != nullptr));
+
+	if (world_T_poses.size() < 2 || edges.empty() || fixedPoseIndices.empty())
+	{
+		return false;
+	}
+
+	constexpr size_t tParameters = tSimilarity ? 7 : 6;
+	constexpr size_t edgeBlockSize = tParameters * tParameters * 3 + tParameters * 2;
+
+	const size_t numberPoses = world_T_poses.size();
+
+	// each pose which is not fixed receives a consecutive index of the block of its parameters
+
+	Indices32 parameterBlockIndices(numberPoses, Index32(0));
+
+	for (const Index32& fixedPoseIndex : fixedPoseIndices)
+	{
+		ocean_assert(fixedPoseIndex < numberPoses);
+		if (fixedPoseIndex >= numberPoses)
+		{
+			return false;
+		}
+
+		parameterBlockIndices[fixedPoseIndex] = Index32(-1);
+	}
+
+	Index32 numberParameterBlocks = 0u;
+
+	for (Index32& parameterBlockIndex : parameterBlockIndices)
+	{
+		if (parameterBlockIndex != Index32(-1))
+		{
+			parameterBlockIndex = numberParameterBlocks++;
+		}
+	}
+
+	for (const Edge& edge : edges)
+	{
+		ocean_assert(edge.isValid());
+		if (!edge.isValid() || edge.firstPoseIndex_ >= numberPoses || edge.secondPoseIndex_ >= numberPoses)
+		{
+			return false;
+		}
+	}
+
+	SquareMatrices3 rotations;
+	Vectors3 translations;
+	Scalars poseScales(numberPoses, Scalar(1));
+
+	rotations.reserve(numberPoses);
+	translations.reserve(numberPoses);
+
+	for (size_t n = 0; n < numberPoses; ++n)
+	{
+		ocean_assert(world_T_poses[n].isValid());
+
+		rotations.emplace_back(world_T_poses[n].orthonormalRotationMatrix());
+		translations.emplace_back(world_T_poses[n].translation());
+
+		if constexpr (tSimilarity)
+		{
+			ocean_assert(scales[n] > Numeric::eps());
+			poseScales[n] = scales[n];
+		}
+	}
+
+	Scalars edgeErrors(edges.size());
+
+	Scalar bestError = determineError<tSimilarity>(rotations, translations, poseScales, edges, edgeErrors, worker);
+
+	if (initialError != nullptr)
+	{
+		*initialError = bestError;
+	}
+
+	if (numberParameterBlocks != 0u)
+	{
+		const size_t numberParameters = size_t(numberParameterBlocks) * tParameters;
+
+		Scalars edgeBlocks(edges.size() * edgeBlockSize);
+
+		SquareMatrices3 candidateRotations(numberPoses);
+		Vectors3 candidateTranslations(numberPoses);
+		Scalars candidateScales(numberPoses);
+
+		for (unsigned int iteration = 0u; iteration < iterations && bestError > Numeric::eps(); ++iteration)
+		{
+			// the linearization of each edge is independent of all other edges
+
+			if (worker != nullptr)
+			{
+				worker->executeFunction(Worker::Function::createStatic(&PoseGraphOptimization::linearizeSubset<tSimilarity>, (const SquareMatrices3*)(&rotations), (const Vectors3*)(&translations), (const Scalars*)(&poseScales), &edges, edgeBlocks.data(), 0u, 0u), 0u, (unsigned int)(edges.size()));
+			}
+			else
+			{
+				linearizeSubset<tSimilarity>(&rotations, &translations, &poseScales, &edges, edgeBlocks.data(), 0u, (unsigned int)(edges.size()));
+			}
+
+			// now, we accumulate the blocks of all edges into the sparse normal equations, the (upper) blocks are identified by the row and column index of the parameter blocks
+
+			std::unordered_map<uint64_t, size_t> blockMap;
+			blockMap.reserve(edges.size() * 3);
+
+			Scalars blocks;
+			blocks.reserve(edges.size() * 3 * tParameters * tParameters);
+
+			Matrix jErrors(numberParameters, 1, false);
+
+			for (size_t nEdge = 0; nEdge < edges.size(); ++nEdge)
+			{
+				const Edge& edge = edges[nEdge];
+				const Scalar* edgeBlock = edgeBlocks.data() + nEdge * edgeBlockSize;
+
+				const Index32 firstBlockIndex = parameterBlockIndices[edge.firstPoseIndex_];
+				const Index32 secondBlockIndex = parameterBlockIndices[edge.secondPoseIndex_];
+
+				const Index32 blockIndices[2] = {firstBlockIndex, secondBlockIndex};
+
+				// H_11, H_12, H_22
+
+				const unsigned int blockPairs[3][2] = {{0u, 0u}, {0u, 1u}, {1u, 1u}};
+
+				for (unsigned int nPair = 0u; nPair < 3u; ++nPair)
+				{
+					Index32 rowBlockIndex = blockIndices[blockPairs[nPair][0]];
+					Index32 columnBlockIndex = blockIndices[blockPairs[nPair][1]];
+
+					if (rowBlockIndex == Index32(-1) || columnBlockIndex == Index32(-1))
+					{
+						continue;
+					}
+
+					const Scalar* sourceBlock = edgeBlock + nPair * tParameters * tParameters;
+
+					// we store upper blocks only, lower blocks need to be transposed
+
+					const bool transposeBlock = rowBlockIndex > columnBlockIndex;
+
+					if (transposeBlock)
+					{
+						std::swap(rowBlockIndex, columnBlockIndex);
+					}
+
+					const uint64_t blockKey = uint64_t(rowBlockIndex) << 32u | uint64_t(columnBlockIndex);
+
+					std::unordered_map<uint64_t, size_t>::const_iterator iBlock = blockMap.find(blockKey);
+
+					if (iBlock == blockMap.cend())
+					{
+						iBlock = blockMap.emplace(blockKey, blocks.size()).first;
+						blocks.resize(blocks.size() + tParameters * tParameters, Scalar(0));
+					}
+
+					Scalar* targetBlock = blocks.data() + iBlock->second;
+
+					for (size_t r = 0; r < tParameters; ++r)
+					{
+						for (size_t c = 0; c < tParameters; ++c)
+						{
+							targetBlock[r * tParameters + c] += transposeBlock ? sourceBlock[c * tParameters + r] : sourceBlock[r * tParameters + c];
+						}
+					}
+				}
+
+				// g_1, g_2
+
+				for (unsigned int nPose = 0u; nPose < 2u; ++nPose)
+				{
+					if (blockIndices[nPose] != Index32(-1))
+					{
+						const Scalar* gradient = edgeBlock + 3 * tParameters * tParameters + nPose * tParameters;
+
+						for (size_t n = 0; n < tParameters; ++n)
+						{
+							jErrors(blockIndices[nPose] * tParameters + n, 0) += gradient[n];
+						}
+					}
+				}
+			}
+
+			SparseMatrix::Entries entries;
+			entries.reserve(blocks.size() * 2);
+
+			Indices32 diagonalEntryIndices(numberParameters, Index32(-1));
+
+			for (const std::pair<const uint64_t, size_t>& blockPair : blockMap)
+			{
+				const size_t rowOffset = size_t(blockPair.first >> 32u) * tParameters;
+				const size_t columnOffset = size_t(blockPair.first & 0xFFFFFFFFull) * tParameters;
+
+				const Scalar* block = blocks.data() + blockPair.second;
+
+				for (size_t r = 0; r < tParameters; ++r)
+				{
+					for (size_t c = 0; c < tParameters; ++c)
+					{
+						const Scalar value = block[r * tParameters + c];
+
+						if (rowOffset == columnOffset)
+						{
+							if (r == c)
+							{
+								diagonalEntryIndices[rowOffset + r] = Index32(entries.size());
+							}
+
+							entries.emplace_back(rowOffset + r, columnOffset + c, value);
+						}
+						else
+						{
+							entries.emplace_back(rowOffset + r, columnOffset + c, value);
+							entries.emplace_back(columnOffset + c, rowOffset + r, value);
+						}
+					}
+				}
+			}
+
+			bool improved = false;
+
+			while (!improved)
+			{
+				// J^T * J + lambda * diag(J^T * J)
+
+				SparseMatrix::Entries dampedEntries(entries);
+
+				for (const Index32& diagonalEntryIndex : diagonalEntryIndices)
+				{
+					ocean_assert(diagonalEntryIndex != Index32(-1));
+
+					SparseMatrix::Entry& diagonalEntry = dampedEntries[diagonalEntryIndex];
+
+					// ensuring a non-zero diagonal even for parameters without any constraint
+					diagonalEntry = SparseMatrix::Entry(diagonalEntry.row(), diagonalEntry.column(), diagonalEntry.value() * (Scalar(1) + lambda) + Numeric::eps());
+				}
+
+				const SparseMatrix JTJ(numberParameters, numberParameters, dampedEntries);
+
+				// JTJ * deltas = J^T * error, so that the deltas need to be subtracted
+
+				Matrix deltas;
+				if (!JTJ.solve(jErrors, deltas, Matrix::MP_SYMMETRIC))
+				{
+					return false;
+				}
+
+				for (size_t nPose = 0; nPose < numberPoses; ++nPose)
+				{
+					const Index32 parameterBlockIndex = parameterBlockIndices[nPose];
+
+					if (parameterBlockIndex == Index32(-1))
+					{
+						candidateRotations[nPose] = rotations[nPose];
+						candidateTranslations[nPose] = translations[nPose];
+						candidateScales[nPose] = poseScales[nPose];
+
+						continue;
+					}
+
+					const Scalar* delta = deltas.data() + parameterBlockIndex * tParameters;
+
+					const ExponentialMap rotationDelta(-delta[0], -delta[1], -delta[2]);
+
+					candidateRotations[nPose] = SquareMatrix3(rotationDelta.quaternion()) * rotations[nPose];
+					candidateTranslations[nPose] = translations[nPose] - Vector3(delta[3], delta[4], delta[5]);
+
+					if constexpr (tSimilarity)
+					{
+						candidateScales[nPose] = poseScales[nPose] * Numeric::exp(-delta[6]);
+					}
+					else
+					{
+						candidateScales[nPose] = poseScales[nPose];
+					}
+				}
+
+				const Scalar candidateError = determineError<tSimilarity>(candidateRotations, candidateTranslations, candidateScales, edges, edgeErrors, worker);
+
+				if (candidateError < bestError)
+				{
+					const bool converged = Numeric::isEqual(deltas.norm() / Scalar(deltas.elements()), 0, Numeric::weakEps() * Scalar(0.01));
+
+					std::swap(rotations, candidateRotations);
+					std::swap(translations, candidateTranslations);
+					std::swap(poseScales, candidateScales);
+
+					bestError = candidateError;
+
+					lambda /= lambdaFactor;
+
+					improved = true;
+
+					if (converged)
+					{
+						iteration = iterations;
+					}
+				}
+				else
+				{
+					lambda = (lambda > Numeric::eps()) ? lambda * lambdaFactor : Numeric::weakEps();
+
+					if (lambda > Scalar(1e8))
+					{
+						// we cannot improve the poses anymore
+						iteration = iterations;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	world_T_optimizedPoses.resize(numberPoses);
+
+	for (size_t n = 0; n < numberPoses; ++n)
+	{
+		world_T_optimizedPoses[n] = HomogenousMatrix4(translations[n], rotations[n]);
+
+		if constexpr (tSimilarity)
+		{
+			optimizedScales[n] = poseScales[n];
+		}
+	}
+
+	if (finalError != nullptr)
+	{
+		*finalError = bestError;
+	}
+
+	return true;
+}
+
+template <bool tSimilarity>
+Scalar PoseGraphOptimization::determineError(const SquareMatrices3& rotations, const Vectors3& translations, const Scalars& scales, const Edges& edges, Scalars& edgeErrors, Worker* worker)
+{
+	ocean_assert(rotations.size() == translations.size() && rotations.size() == scales.size());
+	ocean_assert(edges.size() == edgeErrors.size());
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&PoseGraphOptimization::determineErrorSubset<tSimilarity>, &rotations, &translations, &scales, &edges, edgeErrors.data(), 0u, 0u), 0u, (unsigned int)(edges.size()));
+	}
+	else
+	{
+		determineErrorSubset<tSimilarity>(&rotations, &translations, &scales, &edges, edgeErrors.data(), 0u, (unsigned int)(edges.size()));
+	}
+
+	Scalar sumError = Scalar(0);
+
+	for (const Scalar& edgeError : edgeErrors)
+	{
+		sumError += edgeError;
+	}
+
+	return sumError / Scalar(edgeErrors.size());
+}
+
+template <bool tSimilarity>
+void PoseGraphOptimization::determineErrorSubset(const SquareMatrices3* rotations, const Vectors3* translations, const Scalars* scales, const Edges* edges, Scalar* edgeErrors, const unsigned int firstEdge, const unsigned int numberEdges)
+{
+	ocean_assert(rotations != nullptr && translations != nullptr && scales != nullptr && edges != nullptr && edgeErrors != nullptr);
+	ocean_assert(firstEdge + numberEdges <= edges->size());
+
+	constexpr size_t tParameters = tSimilarity ? 7 : 6;
+
+	Scalar residual[tParameters];
+
+	for (unsigned int nEdge = firstEdge; nEdge < firstEdge + numberEdges; ++nEdge)
+	{
+		const Edge& edge = (*edges)[nEdge];
+
+		const Index32 first = edge.firstPoseIndex_;
+		const Index32 second = edge.secondPoseIndex_;
+
+		determineResidual<tSimilarity>((*rotations)[first], (*translations)[first], (*scales)[first], (*rotations)[second], (*translations)[second], (*scales)[second], edge, residual);
+
+		Scalar sqrError = Scalar(0);
+
+		for (size_t n = 0; n < tParameters; ++n)
+		{
+			sqrError += Numeric::sqr(residual[n]);
+		}
+
+		edgeErrors[nEdge] = sqrError * edge.weight_;
+	}
+}
+
+template <bool tSimilarity>
+void PoseGraphOptimization::linearizeSubset(const SquareMatrices3* rotations, const Vectors3* translations, const Scalars* scales, const Edges* edges, Scalar* edgeBlocks, const unsigned int firstEdge, const unsigned int numberEdges)
+{
+	ocean_assert(rotations != nullptr && translations != nullptr && scales != nullptr && edges != nullptr && edgeBlocks != nullptr);
+	ocean_assert(firstEdge + numberEdges <= edges->size());
+
+	constexpr size_t tParameters = tSimilarity ? 7 : 6;
+	constexpr size_t edgeBlockSize = tParameters * tParameters * 3 + tParameters * 2;
+
+	/*
+	 * Each pose is updated by R' = Exp(w) * R, t' = t + v, s' = s * exp(sigma), with parameters [w, v, sigma].
+	 *
+	 * The residual of an edge between pose i and pose j with measurement (R_m, t_m, s_m) is:
+	 * r_t = 1/s_i * R_i^T * (t_j - t_i) - t_m
+	 * r_R = log(R_m^T * R_i^T * R_j)
+	 * r_s = log(s_j) - log(s_i) - log(s_m)
+	 */
+
+	Scalar residual[tParameters];
+
+	Scalar jacobianFirst[tParameters * tParameters];
+	Scalar jacobianSecond[tParameters * tParameters];
+
+	for (unsigned int nEdge = firstEdge; nEdge < firstEdge + numberEdges; ++nEdge)
+	{
+		const Edge& edge = (*edges)[nEdge];
+
+		const Index32 first = edge.firstPoseIndex_;
+		const Index32 second = edge.secondPoseIndex_;
+
+		const SquareMatrix3& world_R_first = (*rotations)[first];
+		const SquareMatrix3& world_R_second = (*rotations)[second];
+
+		const Scalar firstScale = (*scales)[first];
+		ocean_assert(firstScale > Numeric::eps());
+
+		determineResidual<tSimilarity>(world_R_first, (*translations)[first], firstScale, world_R_second, (*translations)[second], (*scales)[second], edge, residual);
+
+		const Vector3 translationDifference = (*translations)[second] - (*translations)[first];
+
+		const SquareMatrix3 first_R_world = world_R_first.transposed() * (Scalar(1) / firstScale);
+
+		const SquareMatrix3 dTranslation_dFirstRotation = first_R_world * SquareMatrix3::skewSymmetricMatrix(translationDifference);
+		const SquareMatrix3 dRotation_dSecondRotation = inverseRightJacobian(Vector3(residual[3], residual[4], residual[5])) * world_R_second.transposed();
+
+		memset(jacobianFirst, 0, sizeof(jacobianFirst));
+		memset(jacobianSecond, 0, sizeof(jacobianSecond));
+
+		for (unsigned int r = 0u; r < 3u; ++r)
+		{
+			for (unsigned int c = 0u; c < 3u; ++c)
+			{
+				// translational residual (rows 0 - 2)
+
+				jacobianFirst[r * tParameters + c] = dTranslation_dFirstRotation(r, c);
+				jacobianFirst[r * tParameters + 3u + c] = -first_R_world(r, c);
+
+				jacobianSecond[r * tParameters + 3u + c] = first_R_world(r, c);
+
+				// rotational residual (rows 3 - 5)
+
+				jacobianFirst[(r + 3u) * tParameters + c] = -dRotation_dSecondRotation(r, c);
+				jacobianSecond[(r + 3u) * tParameters + c] = dRotation_dSecondRotation(r, c);
+			}
+
+			if constexpr (tSimilarity)
+			{
+				jacobianFirst[r * tParameters + 6u] = -(residual[r] + edge.first_T_second_.translation()[r]);
+			}
+		}
+
+		if constexpr (tSimilarity)
+		{
+			// scale residual (row 6)
+
+			jacobianFirst[6u * tParameters + 6u] = Scalar(-1);
+			jacobianSecond[6u * tParameters + 6u] = Scalar(1);
+		}
+
+		// H_11 = J_1^T * J_1, H_12 = J_1^T * J_2, H_22 = J_2^T * J_2, g_1 = J_1^T * r, g_2 = J_2^T * r, all weighted
+
+		Scalar* const block11 = edgeBlocks + nEdge * edgeBlockSize;
+		Scalar* const block12 = block11 + tParameters * tParameters;
+		Scalar* const block22 = block12 + tParameters * tParameters;
+		Scalar* const gradient1 = block22 + tParameters * tParameters;
+		Scalar* const gradient2 = gradient1 + tParameters;
+
+		const Scalar weight = edge.weight_;
+
+		for (size_t r = 0; r < tParameters; ++r)
+		{
+			for (size_t c = 0; c < tParameters; ++c)
+			{
+				Scalar value11 = Scalar(0);
+				Scalar value12 = Scalar(0);
+				Scalar value22 = Scalar(0);
+
+				for (size_t n = 0; n < tParameters; ++n)
+				{
+					value11 += jacobianFirst[n * tParameters + r] * jacobianFirst[n * tParameters + c];
+					value12 += jacobianFirst[n * tParameters + r] * jacobianSecond[n * tParameters + c];
+					value22 += jacobianSecond[n * tParameters + r] * jacobianSecond[n * tParameters + c];
+				}
+
+				block11[r * tParameters + c] = value11 * weight;
+				block12[r * tParameters + c] = value12 * weight;
+				block22[r * tParameters + c] = value22 * weight;
+			}
+
+			Scalar value1 = Scalar(0);
+			Scalar value2 = Scalar(0);
+
+			for (size_t n = 0; n < tParameters; ++n)
+			{
+				value1 += jacobianFirst[n * tParameters + r] * residual[n];
+				value2 += jacobianSecond[n * tParameters + r] * residual[n];
+			}
+
+			gradient1[r] = value1 * weight;
+			gradient2[r] = value2 * weight;
+		}
+	}
+}
+
+template <bool tSimilarity>
+inline void PoseGraphOptimization::determineResidual(const SquareMatrix3& world_R_first, const Vector3& world_t_first, const Scalar firstScale, const SquareMatrix3& world_R_second, const Vector3& world_t_second, const Scalar secondScale, const Edge& edge, Scalar* residual)
+{
+	ocean_assert(firstScale > Numeric::eps() && secondScale > Numeric::eps());
+	ocean_assert(residual != nullptr);
+
+	const SquareMatrix3 first_R_world = world_R_first.transposed();
+
+	const Vector3 translationError = first_R_world * (world_t_second - world_t_first) / firstScale - edge.first_T_second_.translation();
+
+	const SquareMatrix3 measuredSecond_R_second = edge.first_T_second_.orthonormalRotationMatrix().transposed() * first_R_world * world_R_second;
+	const Vector3 rotationError = ExponentialMap(measuredSecond_R_second).axis();
+
+	residual[0] = translationError.x();
+	residual[1] = translationError.y();
+	residual[2] = translationError.z();
+
+	residual[3] = rotationError.x();
+	residual[4] = rotationError.y();
+	residual[5] = rotationError.z();
+
+	if constexpr (tSimilarity)
+	{
+		residual[6] = Numeric::log(secondScale) - Numeric::log(firstScale) - Numeric::log(edge.scale_);
+	}
+	else
+	{
+		OCEAN_SUPPRESS_UNUSED_WARNING(secondScale);
+	}
+}
+
+inline SquareMatrix3 PoseGraphOptimization::inverseRightJacobian(const Vector3& rotation)
+{
+	const SquareMatrix3 skew = SquareMatrix3::skewSymmetricMatrix(rotation);
+
+	const Scalar angle = rotation.length();
+
+	if (angle < Numeric::weakEps())
+	{
+		return SquareMatrix3(true) + skew * Scalar(0.5);
+	}
+
+	// Jr^-1 = I + 1/2 [w]x + (1/angle^2 - (1 + cos(angle)) / (2 angle sin(angle))) [w]x^2
+
+	const Scalar factor = Scalar(1) / Numeric::sqr(angle) - (Scalar(1) + Numeric::cos(angle)) / (Scalar(2) * angle * Numeric::sin(angle));
+
+	return SquareMatrix3(true) + skew * Scalar(0.5) + (skew * skew) * factor;
+}
+
+}
+
+}
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_GEOMETRY_POSE_GRAPH_OPTIMIZATION_H
+#define META_OCEAN_GEOMETRY_POSE_GRAPH_OPTIMIZATION_H
+
+#include "ocean/geometry/Geometry.h"
+
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/SquareMatrix3.h"
+#include "ocean/math/Vector3.h"
+
+namespace Ocean
+{
+
+namespace Geometry
+{
+
+/**
+ * This class implements a pose graph optimization for keyframe poses.
+ * The graph holds one node for each keyframe pose and one edge for each measured relative transformation between two keyframes e.g., from co-visibility or from a loop closure.<br>
+ * The optimization adjusts all poses so that the relative transformations between the poses fit to the measured edges in a least square sense.<br>
+ * Poses can be optimized with 6-DOF (rotation and translation) or with 7-DOF (similarity transformation with additional scale) to compensate the scale drift of monocular trackers.<br>
+ * The optimization does not involve any object points or image points and thus is significantly faster than a bundle adjustment, which makes it a suitable first pass to distribute a loop closure error before a bundle adjustment.
+ * @ingroup geometry
+ */
+class OCEAN_GEOMETRY_EXPORT PoseGraphOptimization
+{
+	public:
+
+		/**
+		 * This class implements an edge of the pose graph holding the measured relative transformation between two poses.
+		 */
+		class Edge
+		{
+			public:
+
+				/**
+				 * Creates an invalid edge.
+				 */
+				Edge() = default;
+
+				/**
+				 * Creates a new edge.
+				 * @param firstPoseIndex The index of the first pose, with range [0, infinity)
+				 * @param secondPoseIndex The index of the second pose, must be different from firstPoseIndex
+				 * @param first_T_second The measured transformation between the second pose and the first pose, transforming points defined in the coordinate system of the second pose to points defined in the coordinate system of the first pose, must be valid
+				 * @param weight The weight of the edge e.g., depending on the number of covisible object points, with range (0, infinity)
+				 * @param scale The measured scale of the second pose in relation to the first pose, only used for similarity optimizations, with range (0, infinity)
+				 */
+				inline Edge(const Index32 firstPoseIndex, const Index32 secondPoseIndex, const HomogenousMatrix4& first_T_second, const Scalar weight = Scalar(1), const Scalar scale = Scalar(1));
+
+				/**
+				 * Returns whether this edge is valid.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			public:
+
+				/// The index of the first pose.
+				Index32 firstPoseIndex_ = Index32(-1);
+
+				/// The index of the second pose.
+				Index32 secondPoseIndex_ = Index32(-1);
+
+				/// The measured transformation between the second and the first pose.
+				HomogenousMatrix4 first_T_second_ = HomogenousMatrix4(false);
+
+				/// The weight of the edge.
+				Scalar weight_ = Scalar(1);
+
+				/// The measured scale of the second pose in relation to the first pose.
+				Scalar scale_ = Scalar(1);
+		};
+
+		/**
+		 * Definition of a vector holding edges.
+		 */
+		using Edges = std::vector<Edge>;
+
+	public:
+
+		/**
+		 * Optimizes 6-DOF poses so that their relative transformations fit to the measured edges.
+		 * The poses defined in the set of fixed poses define the gauge of the optimization and are not modified.
+		 * @param world_T_poses The initial poses to be optimized, transforming points defined in the coordinate system of the poses to points defined in world, at least two
+		 * @param edges The edges between the poses, at least one
+		 * @param world_T_optimizedPoses The resulting optimized poses, one for each initial pose
+		 * @param fixedPoseIndices The indices of the poses which will not be modified, at least one
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged weighted squared error for the initial poses
+		 * @param finalError Optional resulting averaged weighted squared error for the optimized poses
+		 * @param worker Optional worker object to distribute the linearization
+		 * @return True, if succeeded
+		 */
+		static bool optimizePoses(const HomogenousMatrices4& world_T_poses, const Edges& edges, HomogenousMatrices4& world_T_optimizedPoses, const Indices32& fixedPoseIndices = Indices32(1, 0u), const unsigned int iterations = 20u, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Worker* worker = nullptr);
+
+		/**
+		 * Optimizes 7-DOF similarity poses so that their relative transformations fit to the measured edges.
+		 * Each pose is composed of a 6-DOF transformation and an individual scale so that world_S_pose = [scale * R | t].<br>
+		 * The poses defined in the set of fixed poses define the gauge of the optimization and are not modified.
+		 * @param world_T_poses The initial 6-DOF poses to be optimized, without scale, at least two
+		 * @param scales The initial scales of the poses, one for each pose, with range (0, infinity)
+		 * @param edges The edges between the poses, at least one
+		 * @param world_T_optimizedPoses The resulting optimized 6-DOF poses, one for each initial pose
+		 * @param optimizedScales The resulting optimized scales, one for each pose
+		 * @param fixedPoseIndices The indices of the poses which will not be modified, at least one
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param lambda Initial Levenberg-Marquardt damping value which may be changed after each iteration using the damping factor, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor to be applied to the damping value, with range [1, infinity)
+		 * @param initialError Optional resulting averaged weighted squared error for the initial poses
+		 * @param finalError Optional resulting averaged weighted squared error for the optimized poses
+		 * @param worker Optional worker object to distribute the linearization
+		 * @return True, if succeeded
+		 */
+		static bool optimizeSimilarityPoses(const HomogenousMatrices4& world_T_poses, const Scalars& scales, const Edges& edges, HomogenousMatrices4& world_T_optimizedPoses, Scalars& optimizedScales, const Indices32& fixedPoseIndices = Indices32(1, 0u), const unsigned int iterations = 20u, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr, Worker* worker = nullptr);
+
+	protected:
+
+		/**
+		 * Optimizes 6-DOF or 7-DOF poses.
+		 * @param world_T_poses The initial poses to be optimized, at least two
+		 * @param scales The initial scales of the poses, nullptr if tSimilarity is false
+		 * @param edges The edges between the poses, at least one
+		 * @param world_T_optimizedPoses The resulting optimized poses
+		 * @param optimizedScales The resulting optimized scales, nullptr if tSimilarity is false
+		 * @param fixedPoseIndices The indices of the poses which will not be modified, at least one
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param lambda Initial Levenberg-Marquardt damping value, with range [0, infinity)
+		 * @param lambdaFactor Levenberg-Marquardt damping factor, with range [1, infinity)
+		 * @param initialError Optional resulting averaged weighted squared error for the initial poses
+		 * @param finalError Optional resulting averaged weighted squared error for the optimized poses
+		 * @param worker Optional worker object to distribute the linearization
+		 * @return True, if succeeded
+		 * @tparam tSimilarity True, to optimize 7-DOF similarity poses; False, to optimize 6-DOF poses
+		 */
+		template <bool tSimilarity>
+		static bool optimize(const HomogenousMatrices4& world_T_poses, const Scalar* scales, const Edges& edges, HomogenousMatrices4& world_T_optimizedPoses, Scalar* optimizedScales, const Indices32& fixedPoseIndices, const unsigned int iterations, Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError, Worker* worker);
+
+		/**
+		 * Determines the averaged weighted squared error of all edges.
+		 * @param rotations The rotations of all poses
+		 * @param translations The translations of all poses, one for each rotation
+		 * @param scales The scales of all poses, one for each rotation
+		 * @param edges The edges for which the error will be determined
+		 * @param edgeErrors The intermediate buffer receiving the weighted squared error of each edge, one for each edge
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The averaged weighted squared error
+		 * @tparam tSimilarity True, to apply 7-DOF similarity poses; False, to apply 6-DOF poses
+		 */
+		template <bool tSimilarity>
+		static Scalar determineError(const SquareMatrices3& rotations, const Vectors3& translations, const Scalars& scales, const Edges& edges, Scalars& edgeErrors, Worker* worker);
+
+		/**
+		 * Determines the weighted squared errors of a subset of edges.
+		 * @param rotations The rotations of all poses
+		 * @param translations The translations of all poses, one for each rotation
+		 * @param scales The scales of all poses, one for each rotation
+		 * @param edges The edges for which the errors will be determined
+		 * @param edgeErrors The resulting weighted squared errors, one for each edge
+		 * @param firstEdge The first edge to be handled
+		 * @param numberEdges The number of edges to be handled
+		 * @tparam tSimilarity True, to apply 7-DOF similarity poses; False, to apply 6-DOF poses
+		 */
+		template <bool tSimilarity>
+		static void determineErrorSubset(const SquareMatrices3* rotations, const Vectors3* translations, const Scalars* scales, const Edges* edges, Scalar* edgeErrors, const unsigned int firstEdge, const unsigned int numberEdges);
+
+		/**
+		 * Linearizes a subset of edges and determines the individual blocks of the normal equations.
+		 * For each edge, the blocks H_11, H_12, H_22 (each with tSimilarity ? 7x7 : 6x6 elements) and the gradients g_1, g_2 are stored (in this order).
+		 * @param rotations The rotations of all poses
+		 * @param translations The translations of all poses, one for each rotation
+		 * @param scales The scales of all poses, one for each rotation
+		 * @param edges The edges to be linearized
+		 * @param edgeBlocks The resulting blocks of the normal equations, one set of blocks for each edge
+		 * @param firstEdge The first edge to be handled
+		 * @param numberEdges The number of edges to be handled
+		 * @tparam tSimilarity True, to apply 7-DOF similarity poses; False, to apply 6-DOF poses
+		 */
+		template <bool tSimilarity>
+		static void linearizeSubset(const SquareMatrices3* rotations, const Vectors3* translations, const Scalars* scales, const Edges* edges, Scalar* edgeBlocks, const unsigned int firstEdge, const unsigned int numberEdges);
+
+		/**
+		 * Determines the residual of one edge.
+		 * The residual is composed of the translational error (3 elements), the rotational error as exponential map (3 elements), and for similarity poses the logarithmic scale error (1 element).
+		 * @param world_R_first The rotation of the first pose
+		 * @param world_t_first The translation of the first pose
+		 * @param firstScale The scale of the first pose
+		 * @param world_R_second The rotation of the second pose
+		 * @param world_t_second The translation of the second pose
+		 * @param secondScale The scale of the second pose
+		 * @param edge The edge for which the residual will be determined
+		 * @param residual The resulting residual, with tSimilarity ? 7 : 6 elements
+		 * @tparam tSimilarity True, to apply 7-DOF similarity poses; False, to apply 6-DOF poses
+		 */
+		template <bool tSimilarity>
+		static inline void determineResidual(const SquareMatrix3& world_R_first, const Vector3& world_t_first, const Scalar firstScale, const SquareMatrix3& world_R_second, const Vector3& world_t_second, const Scalar secondScale, const Edge& edge, Scalar* residual);
+
+		/**
+		 * Returns the inverse of the right Jacobian of SO(3) for a given rotation vector.
+		 * @param rotation The rotation vector (exponential map)
+		 * @return The inverse right Jacobian
+		 */
+		static inline SquareMatrix3 inverseRightJacobian(const Vector3& rotation);
+};
+
+inline PoseGraphOptimization::Edge::Edge(const Index32 firstPoseIndex, const Index32 secondPoseIndex, const HomogenousMatrix4& first_T_second, const Scalar weight, const Scalar scale) :
+	firstPoseIndex_(firstPoseIndex),
+	secondPoseIndex_(secondPoseIndex),
+	first_T_second_(first_T_second),
+	weight_(weight),
+	scale_(scale)
+{
+	ocean_assert(isValid());
+}
+
+inline bool PoseGraphOptimization::Edge::isValid() const
+{
+	return firstPoseIndex_ != Index32(-1) && secondPoseIndex_ != Index32(-1) && firstPoseIndex_ != secondPoseIndex_ && first_T_second_.isValid() && weight_ > Scalar(0) && scale_ > Scalar(0);
+}
+
+}
+
+}
+
+#endif // META_OCEAN_GEOMETRY_POSE_GRAPH_OPTIMIZATION_H
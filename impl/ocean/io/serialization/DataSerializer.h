@@ -342,6 +342,19 @@ class OCEAN_IO_SERIALIZATION_EXPORT DataSerializer : protected Thread
 		 */
 		[[nodiscard]] static constexpr ChannelId extractChannelId(const uint32_t channelValue);
 
+		/**
+		 * Returns the channel value of the record holding the stream's index.
+		 * The value is a regular (non-configuration) channel value which is never assigned to a channel, so that readers without index support simply skip the record.
+		 * @return The channel value of the index record
+		 */
+		[[nodiscard]] static constexpr uint32_t indexChannelValue();
+
+		/**
+		 * Returns the tag which is written at the end of the index record, directly before the end-of-stream indication.
+		 * @return The index tag, with 8 characters
+		 */
+		[[nodiscard]] static constexpr const char* indexTag();
+
 	protected:
 
 		/// The timestamp when the serializer was started.
@@ -458,6 +471,16 @@ constexpr DataSerializer::ChannelId DataSerializer::extractChannelId(const uint3
 	return ChannelId(channelValue & ~highestBit);
 }
 
+constexpr uint32_t DataSerializer::indexChannelValue()
+{
+	return 0x7FFFFFFEu;
+}
+
+constexpr const char* DataSerializer::indexTag()
+{
+	return "OCEANIDX";
+}
+
 inline DataSerializer::DataSampleChannelConfiguration::DataSampleChannelConfiguration(const DataSample& sample, const ChannelConfiguration& channelConfiguration) :
 	DataSample(sample),
 	ChannelConfiguration(channelConfiguration)
@@ -185,6 +185,14 @@ bool InputDataSerializer::initialize(Channels* preparsedChannels, bool* isStream
 	return true;
 }
 
+InputDataSerializer::~InputDataSerializer()
+{
+	stopThreadExplicitly();
+
+	// a thread which has been started but which is not yet running must not be executed after this object has been destructed
+	joinThread();
+}
+
 bool InputDataSerializer::start()
 {
 	const ScopedLock scopedLock(lock_);
@@ -221,6 +229,9 @@ bool InputDataSerializer::stop()
 
 	if (state_ >= S_STOPPING)
 	{
+		// a serializer which is stopped explicitly will not be started again with a seek
+		hasReachedEndOfStream_ = false;
+
 		return true;
 	}
 
@@ -318,7 +329,7 @@ UniqueDataSample InputDataSerializer::sample(ChannelId& channelId, const double
 		ocean_assert(startTimestamp_.isValid());
 		const double playbackTimestamp = double(currentTimestamp - startTimestamp_);
 
-		const double samplePlaybackTimestamp = sampleQueue_.top().second->playbackTimestamp();
+		const double samplePlaybackTimestamp = sampleQueue_.top().second->playbackTimestamp() - seekPlaybackTimestamp_;
 
 		if (samplePlaybackTimestamp > playbackTimestamp * speed)
 		{
@@ -332,6 +343,288 @@ UniqueDataSample InputDataSerializer::sample(ChannelId& channelId, const double
 	return std::move(samplePair.second);
 }
 
+bool InputDataSerializer::createIndex(const bool allowStreamScan)
+{
+	TemporaryScopedLock temporaryScopedLock(lock_);
+
+		if (state_ < S_INITIALIZED)
+		{
+			ocean_assert(false && "The serializer must be initialized!");
+			return false;
+		}
+
+		if (!sampleIndex_.isEmpty())
+		{
+			return true;
+		}
+
+	temporaryScopedLock.release();
+
+	// the index is created with an individual stream so that the playback thread is not affected
+
+	const UniqueStream indexStream = createStream();
+
+	if (!indexStream)
+	{
+		return false;
+	}
+
+	InputBitstream& inputBitstream = indexStream->inputBitstream();
+
+	if (!readHeader(inputBitstream))
+	{
+		return false;
+	}
+
+	const uint64_t startPosition = inputBitstream.position();
+
+	if (startPosition == uint64_t(-1))
+	{
+		return false;
+	}
+
+	SampleIndex sampleIndex;
+
+	bool indexAvailable = readIndex(inputBitstream, sampleIndex);
+
+	if (!indexAvailable && allowStreamScan)
+	{
+		// the stream does not contain an index (e.g., because the stream has been recorded without index), so we reconstruct the index with one scan
+
+		Log::debug() << "InputDataSerializer: The input does not contain an index, scanning the entire input";
+
+		if (inputBitstream.reset() && inputBitstream.setPosition(startPosition))
+		{
+			indexAvailable = scanIndex(inputBitstream, sampleIndex);
+		}
+	}
+
+	if (!indexAvailable)
+	{
+		return false;
+	}
+
+	const std::vector<ChannelId> channelIds = sampleIndex.channelIds();
+
+	Channels channels;
+	channels.reserve(channelIds.size());
+
+	for (const ChannelId channelId : channelIds)
+	{
+		const SampleIndex::ChannelIndex* channelIndex = sampleIndex.channelIndex(channelId);
+		ocean_assert(channelIndex != nullptr);
+
+		uint32_t channelValue = 0u;
+		uint32_t payloadSize = 0u;
+
+		DataSampleChannelConfiguration dataSampleChannelConfiguration;
+
+		if (!inputBitstream.reset()
+				|| !readRecordHeader(inputBitstream, channelIndex->configurationPosition_, channelValue, payloadSize)
+				|| channelValue != makeConfigurationChannelId(channelId)
+				|| !dataSampleChannelConfiguration.readSample(inputBitstream)
+				|| !dataSampleChannelConfiguration.isValid())
+		{
+			return false;
+		}
+
+		channels.emplace_back(dataSampleChannelConfiguration, channelId);
+	}
+
+	Channels newChannels;
+	ChannelEventFunction channelEventFunction;
+
+	temporaryScopedLock.relock(lock_);
+
+		if (!sampleIndex_.isEmpty())
+		{
+			// the index has been created concurrently
+			return true;
+		}
+
+		// channels which have already been parsed by the playback thread are registered already
+
+		for (Channel& channel : channels)
+		{
+			if (parsedChannelIds_.emplace(channel.channelId()).second)
+			{
+				registerChannel(channel);
+
+				newChannels.emplace_back(std::move(channel));
+			}
+		}
+
+		sampleIndex_ = std::move(sampleIndex);
+
+		channelEventFunction = channelEventFunction_;
+
+	temporaryScopedLock.release();
+
+	if (channelEventFunction)
+	{
+		for (const Channel& channel : newChannels)
+		{
+			channelEventFunction(channel);
+		}
+	}
+
+	return true;
+}
+
+bool InputDataSerializer::hasIndex() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return !sampleIndex_.isEmpty();
+}
+
+const SampleIndex& InputDataSerializer::index() const
+{
+	return sampleIndex_;
+}
+
+bool InputDataSerializer::seek(const double playbackTimestamp)
+{
+	ocean_assert(playbackTimestamp >= 0.0);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (sampleIndex_.isEmpty())
+	{
+		ocean_assert(false && "The serializer does not hold an index!");
+		return false;
+	}
+
+	const bool restartAtEndOfStream = state_ == S_STOPPED && hasReachedEndOfStream_;
+
+	if (state_ != S_INITIALIZED && state_ != S_STARTED && !restartAtEndOfStream)
+	{
+		return false;
+	}
+
+	const uint64_t position = sampleIndex_.seekPosition(playbackTimestamp);
+
+	if (position == uint64_t(-1))
+	{
+		return false;
+	}
+
+	if (state_ == S_INITIALIZED)
+	{
+		ocean_assert(stream_);
+
+		if (!stream_->inputBitstream().setPosition(position))
+		{
+			return false;
+		}
+	}
+	else if (state_ == S_STARTED)
+	{
+		// the thread will apply the new position before reading the next record
+
+		pendingSeekPosition_ = position;
+
+		startTimestamp_.toNow();
+	}
+	else
+	{
+		// the thread has stopped at the end of the stream, so we restart the thread with a new stream at the new position
+		// the thread has released the lock already, so that waiting for the thread cannot dead-lock
+
+		ocean_assert(!stream_);
+
+		joinThread();
+
+		stream_ = createStream();
+
+		if (!stream_ || !stream_->inputBitstream().setPosition(position))
+		{
+			stream_ = nullptr;
+			return false;
+		}
+
+		hasReachedEndOfStream_ = false;
+
+		state_ = S_STARTED;
+
+		startTimestamp_.toNow();
+
+		if (!startThread())
+		{
+			stream_ = nullptr;
+			state_ = S_STOPPED;
+			return false;
+		}
+	}
+
+	++seekIteration_;
+	seekPlaybackTimestamp_ = playbackTimestamp;
+
+	sampleQueue_ = SampleQueue();
+
+	return true;
+}
+
+UniqueDataSample InputDataSerializer::randomSample(const ChannelId channelId, const size_t sampleIndex)
+{
+	TemporaryScopedLock temporaryScopedLock(lock_);
+
+		const SampleIndex::Entry* entry = sampleIndex_.entry(channelId, sampleIndex);
+
+		if (entry == nullptr)
+		{
+			return nullptr;
+		}
+
+		const uint64_t position = entry->position_;
+
+		const ExtendedChannelMap::const_iterator iChannel = extendedChannelMap_.find(channelId);
+
+		if (iChannel == extendedChannelMap_.cend())
+		{
+			// no factory function has been registered for the channel's sample type
+			return nullptr;
+		}
+
+		const ExtendedChannel channel = iChannel->second;
+
+	temporaryScopedLock.release();
+
+	const ScopedLock scopedLock(randomAccessLock_);
+
+	if (!randomAccessStream_)
+	{
+		randomAccessStream_ = createStream();
+
+		if (!randomAccessStream_)
+		{
+			return nullptr;
+		}
+	}
+
+	InputBitstream& inputBitstream = randomAccessStream_->inputBitstream();
+
+	uint32_t channelValue = 0u;
+	uint32_t payloadSize = 0u;
+
+	if (!readRecordHeader(inputBitstream, position, channelValue, payloadSize) || channelValue != channelId)
+	{
+		randomAccessStream_ = nullptr;
+		return nullptr;
+	}
+
+	ocean_assert(channel.factoryFunction_);
+	UniqueDataSample sample = channel.factoryFunction_(channel.sampleType());
+
+	if (!sample || !sample->readSample(inputBitstream))
+	{
+		randomAccessStream_ = nullptr;
+		return nullptr;
+	}
+
+	return sample;
+}
+
 DataSerializer::ChannelConfiguration InputDataSerializer::channelConfiguration(const ChannelId channelId) const
 {
 	const ScopedLock scopedLock(lock_);
@@ -395,6 +688,165 @@ bool InputDataSerializer::readHeader(InputBitstream& inputBitstream)
 	return true;
 }
 
+bool InputDataSerializer::registerChannel(const Channel& channel)
+{
+	ocean_assert(channel.isValid());
+
+	const FactoryFunctionMap::const_iterator iFactoryFunction = factoryFunctionMap_.find(channel.sampleType());
+
+	if (iFactoryFunction == factoryFunctionMap_.cend())
+	{
+		Log::debug() << "InputDataSerializer: The sample type '" << channel.sampleType() << "' is not registered, skipping";
+		return false;
+	}
+
+	extendedChannelMap_.emplace(channel.channelId(), ExtendedChannel(channel, iFactoryFunction->second));
+
+	return true;
+}
+
+bool InputDataSerializer::readIndex(InputBitstream& inputBitstream, SampleIndex& sampleIndex)
+{
+	// the stream ends with the position of the index record, the index tag, and the end-of-stream indication
+
+	constexpr uint64_t footerSize = sizeof(uint64_t) + 8 + sizeof(uint32_t);
+
+	const uint64_t streamSize = inputBitstream.size();
+
+	if (streamSize == uint64_t(-1) || streamSize < footerSize || !inputBitstream.setPosition(streamSize - footerSize))
+	{
+		return false;
+	}
+
+	uint64_t recordPosition = uint64_t(-1);
+	std::array<char, 8> tag = {};
+	uint32_t endOfStreamValue = 0u;
+
+	if (!inputBitstream.read<uint64_t>(recordPosition) || !inputBitstream.read(tag.data(), tag.size()) || !inputBitstream.read<uint32_t>(endOfStreamValue))
+	{
+		return false;
+	}
+
+	if (memcmp(tag.data(), indexTag(), tag.size()) != 0 || endOfStreamValue != invalidChannelId() || recordPosition >= streamSize - footerSize)
+	{
+		return false;
+	}
+
+	uint32_t channelValue = 0u;
+	uint32_t payloadSize = 0u;
+
+	if (!readRecordHeader(inputBitstream, recordPosition, channelValue, payloadSize) || channelValue != indexChannelValue())
+	{
+		return false;
+	}
+
+	if (recordPosition + sizeof(uint32_t) * 2 + uint64_t(payloadSize) + sizeof(uint32_t) != streamSize)
+	{
+		return false;
+	}
+
+	return sampleIndex.read(inputBitstream);
+}
+
+bool InputDataSerializer::scanIndex(InputBitstream& inputBitstream, SampleIndex& sampleIndex)
+{
+	sampleIndex.clear();
+
+	while (true)
+	{
+		const uint64_t position = inputBitstream.position();
+
+		uint32_t channelValue = 0u;
+		uint32_t payloadSize = 0u;
+
+		if (!inputBitstream.read<uint32_t>(channelValue))
+		{
+			if (inputBitstream.isEndOfFile())
+			{
+				Log::debug() << "InputDataSerializer: The input seems to be corrupted, end of stream indication is missing";
+				return true;
+			}
+
+			return false;
+		}
+
+		if (channelValue == invalidChannelId())
+		{
+			return true;
+		}
+
+		if (!inputBitstream.read<uint32_t>(payloadSize))
+		{
+			return inputBitstream.isEndOfFile();
+		}
+
+		if (isConfigurationChannelId(channelValue))
+		{
+			if (!sampleIndex.addConfiguration(extractChannelId(channelValue), position))
+			{
+				return false;
+			}
+
+			if (!inputBitstream.skip(uint64_t(payloadSize)))
+			{
+				return false;
+			}
+		}
+		else if (channelValue == indexChannelValue())
+		{
+			if (!inputBitstream.skip(uint64_t(payloadSize)))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			const ChannelId channelId = extractChannelId(channelValue);
+
+			if (sampleIndex.channelIndex(channelId) == nullptr)
+			{
+				// the sample's channel configuration is missing
+				return false;
+			}
+
+			// each sample starts with the playback timestamp and the data timestamp, see DataSample::writeSample()
+
+			double playbackTimestamp = NumericD::minValue();
+			DataTimestamp dataTimestamp;
+
+			if (!inputBitstream.read<double>(playbackTimestamp) || !DataTimestamp::read(inputBitstream, dataTimestamp))
+			{
+				return inputBitstream.isEndOfFile();
+			}
+
+			const uint64_t payloadStartPosition = position + sizeof(uint32_t) * 2;
+			const uint64_t bytesRead = inputBitstream.position() - payloadStartPosition;
+
+			if (bytesRead > uint64_t(payloadSize))
+			{
+				return false;
+			}
+
+			if (!inputBitstream.skip(uint64_t(payloadSize) - bytesRead))
+			{
+				// the last sample is incomplete
+				Log::debug() << "InputDataSerializer: The input seems to be corrupted, the last sample is incomplete";
+				return true;
+			}
+
+			if (!sampleIndex.addEntry(channelId, SampleIndex::Entry(position, playbackTimestamp, dataTimestamp)))
+			{
+				return false;
+			}
+		}
+	}
+}
+
+bool InputDataSerializer::readRecordHeader(InputBitstream& inputBitstream, const uint64_t position, uint32_t& channelValue, uint32_t& payloadSize)
+{
+	return inputBitstream.setPosition(position) && inputBitstream.read<uint32_t>(channelValue) && inputBitstream.read<uint32_t>(payloadSize);
+}
+
 void InputDataSerializer::threadRun()
 {
 	ocean_assert(stream_);
@@ -402,6 +854,8 @@ void InputDataSerializer::threadRun()
 	ExtendedChannelMap extendedChannelMap; // local channel map for performance (no lock needed), will be synchronized with member extendedChannelMap_ under lock (whenever updated)
 	extendedChannelMap.reserve(32);
 
+	bool reachedEndOfStream = false;
+
 	InputBitstream& inputBitstream = stream_->inputBitstream();
 
 	while (!shouldThreadStop())
@@ -413,6 +867,26 @@ void InputDataSerializer::threadRun()
 				break;
 			}
 
+			if (pendingSeekPosition_ != uint64_t(-1))
+			{
+				if (!inputBitstream.reset() || !inputBitstream.setPosition(pendingSeekPosition_))
+				{
+					succeeded_ = false;
+					break;
+				}
+
+				pendingSeekPosition_ = uint64_t(-1);
+			}
+
+			if (extendedChannelMap.size() != extendedChannelMap_.size())
+			{
+				// channels have been registered while creating the index
+
+				extendedChannelMap = extendedChannelMap_;
+			}
+
+			const unsigned int seekIteration = seekIteration_;
+
 			if (sampleQueue_.size() > maxPendingSampleQueueSize_)
 			{
 				scopedTemporaryLock.release();
@@ -429,6 +903,8 @@ void InputDataSerializer::threadRun()
 			if (inputBitstream.isEndOfFile())
 			{
 				Log::debug() << "InputDataSerializer: The input seems to be corrupted, end of stream indication is missing";
+
+				reachedEndOfStream = true;
 				break;
 			}
 
@@ -446,6 +922,10 @@ void InputDataSerializer::threadRun()
 				Log::debug() << "InputDataSerializer: The input seems to be corrupted, we read and end of stream indication without being at the end of the stream";
 				succeeded_ = false;
 			}
+			else
+			{
+				reachedEndOfStream = true;
+			}
 
 			break;
 		}
@@ -461,8 +941,28 @@ void InputDataSerializer::threadRun()
 		{
 			const ChannelId channelId = extractChannelId(channelValue);
 
-			if (extendedChannelMap.contains(channelId))
+			TemporaryScopedLock scopedTemporaryChannelLock(lock_);
+
+				const bool isNewChannel = parsedChannelIds_.emplace(channelId).second;
+				const bool hasIndex = !sampleIndex_.isEmpty();
+
+			scopedTemporaryChannelLock.release();
+
+			if (!isNewChannel)
 			{
+				if (hasIndex)
+				{
+					// the channel has been registered while creating the index, or we read the configuration again after seeking
+
+					if (!inputBitstream.skip(uint64_t(payloadSize)))
+					{
+						succeeded_ = false;
+						break;
+					}
+
+					continue;
+				}
+
 				ocean_assert(false && "The channel has already been registered!");
 
 				succeeded_ = false;
@@ -497,20 +997,9 @@ void InputDataSerializer::threadRun()
 
 			TemporaryScopedLock temporaryScopedLock(lock_);
 
-				FactoryFunctionMap::const_iterator iFactoryFunction = factoryFunctionMap_.find(dataSampleChannelConfiguration.sampleType());
-
-				if (iFactoryFunction != factoryFunctionMap_.cend())
-				{
-					const ExtendedChannel extendedChannel(channel, iFactoryFunction->second);
-
-					extendedChannelMap.emplace(channelId, extendedChannel); // local channel map for lock-free lookup
-
-					extendedChannelMap_.emplace(channelId, extendedChannel); // global channel map for lock-based lookup
-
-				}
-				else
+				if (registerChannel(channel)) // global channel map for lock-based lookup
 				{
-					Log::debug() << "FileInputDataSerializer: The sample type '" << dataSampleChannelConfiguration.sampleType() << "' is not registered, skipping";
+					extendedChannelMap.emplace(channelId, extendedChannelMap_.at(channelId)); // local channel map for lock-free lookup
 				}
 
 				channelEventFunction = channelEventFunction_;
@@ -548,7 +1037,12 @@ void InputDataSerializer::threadRun()
 				{
 					const ScopedLock scopedLock(lock_);
 
-					sampleQueue_.emplace(channelId, std::move(sample));
+					// after a seek, reading starts at the earliest stream position of all channels, so that other channels may provide samples before the seek timestamp
+
+					if (seekIteration == seekIteration_ && (seekIteration_ == 0u || sample->playbackTimestamp() >= seekPlaybackTimestamp_))
+					{
+						sampleQueue_.emplace(channelId, std::move(sample));
+					}
 				}
 				else
 				{
@@ -570,6 +1064,10 @@ void InputDataSerializer::threadRun()
 
 	const ScopedLock scopedLock(lock_);
 
+	// a stream with index can be restarted by seeking once the end of the stream has been reached
+
+	hasReachedEndOfStream_ = reachedEndOfStream && succeeded_ && state_ < S_STOPPING;
+
 	stream_ = nullptr;
 	state_ = S_STOPPED;
 }
@@ -595,6 +1093,21 @@ bool FileInputDataSerializer::setFilename(const std::string& filename)
 	return true;
 }
 
+bool FileInputDataSerializer::setUseMemoryMapping(const bool useMemoryMapping)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (stream_)
+	{
+		ocean_assert(false && "The input bitstream has already been created!");
+		return false;
+	}
+
+	useMemoryMapping_ = useMemoryMapping;
+
+	return true;
+}
+
 InputDataSerializer::UniqueStream FileInputDataSerializer::createStream() const
 {
 	const ScopedLock scopedLock(lock_);
@@ -605,7 +1118,16 @@ InputDataSerializer::UniqueStream FileInputDataSerializer::createStream() const
 		return nullptr;
 	}
 
-	UniqueStream stream = std::make_unique<FileStream>(filename_);
+	UniqueStream stream;
+
+	if (useMemoryMapping_)
+	{
+		stream = std::make_unique<MemoryMappedFileStream>(filename_);
+	}
+	else
+	{
+		stream = std::make_unique<FileStream>(filename_);
+	}
 
 	if (!stream->isValid())
 	{
@@ -10,6 +10,8 @@
 
 #include "ocean/io/serialization/Serialization.h"
 #include "ocean/io/serialization/DataSerializer.h"
+#include "ocean/io/serialization/MemoryMappedInputStream.h"
+#include "ocean/io/serialization/SampleIndex.h"
 
 #include <functional>
 
@@ -138,6 +140,12 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 
 	public:
 
+		/**
+		 * Destructs the input data serializer.
+		 * The background thread is stopped before any member is released.
+		 */
+		~InputDataSerializer() override;
+
 		/**
 		 * Initializes the input data serializer.
 		 * The serializer will create the input stream and read the header.
@@ -213,6 +221,56 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 		 */
 		[[nodiscard]] UniqueDataSample sample(ChannelId& channelId, const double speed = 1.0);
 
+		/**
+		 * Creates the index of the stream allowing to seek within the stream and to access individual samples randomly.
+		 * The serializer first tries to read the index which has been written at the end of the stream by the OutputDataSerializer.<br>
+		 * If the stream does not contain an index, the index can be reconstructed with one scan over the entire stream.<br>
+		 * All channels of the stream are registered while creating the index (and reported via the channel event function, unless the channel has been parsed already), so that channels() returns all channels with registered factory function.<br>
+		 * The index is created with an individual stream, so that the function can be called at any time after initialize(), e.g., not before the first seek is needed.
+		 * @param allowStreamScan True, to reconstruct the index by scanning the stream if the stream does not contain an index; False, to fail in this case
+		 * @return True, if succeeded
+		 * @see hasIndex(), seek(), randomSample().
+		 */
+		bool createIndex(const bool allowStreamScan = true);
+
+		/**
+		 * Returns whether this serializer holds an index of the stream.
+		 * @return True, if so
+		 * @see createIndex().
+		 */
+		[[nodiscard]] bool hasIndex() const;
+
+		/**
+		 * Returns the index of the stream.
+		 * The index does not change once it has been created.
+		 * @return The index, empty if no index has been created
+		 * @see createIndex().
+		 */
+		[[nodiscard]] const SampleIndex& index() const;
+
+		/**
+		 * Seeks the serializer to a given playback timestamp.
+		 * All pending samples are discarded, afterwards the serializer continues with the first sample (of any channel) with playback timestamp equal to or later than the given timestamp.<br>
+		 * The stream is read from the earliest position of all channels, samples with playback timestamp earlier than the given timestamp are skipped.<br>
+		 * The serializer must hold an index, and must be initialized or started; a serializer which has stopped at the end of the stream is started again.<br>
+		 * For real-time playback, the playback clock is reset so that the sample at the given timestamp is returned immediately.
+		 * @param playbackTimestamp The playback timestamp to seek to, in seconds, with range [0, infinity)
+		 * @return True, if succeeded; False, if no sample exists at or after the given timestamp or if the serializer does not support seeking
+		 * @see createIndex().
+		 */
+		bool seek(const double playbackTimestamp);
+
+		/**
+		 * Reads a specific sample of a channel, independently of the playback.
+		 * The serializer must hold an index, and a factory function must be registered for the channel's sample type.<br>
+		 * The sample is read from a second stream, so that the function can be used while the serializer is playing.
+		 * @param channelId The id of the channel to which the sample belongs
+		 * @param sampleIndex The index of the sample within the channel, with range [0, index().numberSamples(channelId) - 1]
+		 * @return The sample, nullptr if the sample could not be read
+		 * @see createIndex().
+		 */
+		[[nodiscard]] UniqueDataSample randomSample(const ChannelId channelId, const size_t sampleIndex);
+
 		/**
 		 * Returns the channel information for a given channel.
 		 * @param channelId The channel id to query
@@ -241,6 +299,44 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 		 */
 		virtual bool readHeader(InputBitstream& inputBitstream);
 
+		/**
+		 * Registers a channel which has been parsed from the stream.
+		 * The channel is only registered if a factory function exists for the channel's sample type.<br>
+		 * The lock of the serializer must be acquired.
+		 * @param channel The channel to register, must be valid
+		 * @return True, if the channel has been registered; False, if no factory function exists
+		 */
+		bool registerChannel(const Channel& channel);
+
+		/**
+		 * Reads the index which has been written at the end of a stream.
+		 * The position of the input bitstream is undefined afterwards.
+		 * @param inputBitstream The input bitstream from which the index will be read
+		 * @param sampleIndex The resulting index
+		 * @return True, if the stream contains a valid index
+		 */
+		static bool readIndex(InputBitstream& inputBitstream, SampleIndex& sampleIndex);
+
+		/**
+		 * Reconstructs the index of a stream by scanning all records of the stream.
+		 * The input bitstream must be located at the first record, the position of the input bitstream is undefined afterwards.<br>
+		 * A stream without end-of-stream indication is indexed up to the last complete record.
+		 * @param inputBitstream The input bitstream to scan
+		 * @param sampleIndex The resulting index
+		 * @return True, if succeeded
+		 */
+		static bool scanIndex(InputBitstream& inputBitstream, SampleIndex& sampleIndex);
+
+		/**
+		 * Reads a record at a specific stream position.
+		 * @param inputBitstream The input bitstream from which the record will be read
+		 * @param position The position of the record, pointing to the record's channel value
+		 * @param channelValue The resulting channel value of the record
+		 * @param payloadSize The resulting size of the record's payload, in bytes; the input bitstream will be located at the payload afterwards
+		 * @return True, if succeeded
+		 */
+		static bool readRecordHeader(InputBitstream& inputBitstream, const uint64_t position, uint32_t& channelValue, uint32_t& payloadSize);
+
 		/**
 		 * The thread run function.
 		 * @see Thread::threadRun().
@@ -252,6 +348,30 @@ class OCEAN_IO_SERIALIZATION_EXPORT InputDataSerializer : public DataSerializer
 		/// The input stream.
 		UniqueStream stream_;
 
+		/// The index of the stream, empty if no index has been created.
+		SampleIndex sampleIndex_;
+
+		/// The stream position at which the thread continues reading after a seek, uint64_t(-1) if no seek is pending.
+		uint64_t pendingSeekPosition_ = uint64_t(-1);
+
+		/// The counter of seek operations, used to discard samples which have been read before the most recent seek, 0 if no seek has been applied.
+		unsigned int seekIteration_ = 0u;
+
+		/// The playback timestamp of the most recent seek, in seconds, used as offset for the real-time playback and to skip earlier samples.
+		double seekPlaybackTimestamp_ = 0.0;
+
+		/// True, if the thread has stopped because the end of the stream has been reached, so that the serializer can be started again with a seek.
+		bool hasReachedEndOfStream_ = false;
+
+		/// The ids of all channels which have been parsed so far, either by the thread or while creating the index.
+		UnorderedIndexSet32 parsedChannelIds_;
+
+		/// The stream for random sample access, created on demand.
+		UniqueStream randomAccessStream_;
+
+		/// The lock for the random access stream.
+		Lock randomAccessLock_;
+
 		/// The map mapping sample types to factory functions.
 		FactoryFunctionMap factoryFunctionMap_;
 
@@ -319,6 +439,42 @@ class OCEAN_IO_SERIALIZATION_EXPORT FileInputDataSerializer : public InputDataSe
 				InputBitstream inputBitstream_;
 		};
 
+		/**
+		 * This class implements a memory-mapped file stream for file input data serializers.
+		 */
+		class MemoryMappedFileStream : public Stream
+		{
+			public:
+
+				/**
+				 * Creates a new memory-mapped file stream with given filename.
+				 * @param filename The filename of the file to map, must be valid
+				 */
+				inline explicit MemoryMappedFileStream(const std::string& filename);
+
+				/**
+				 * Returns the input bitstream.
+				 * @return The input bitstream
+				 * @see Stream::inputBitstream().
+				 */
+				inline InputBitstream& inputBitstream() override;
+
+				/**
+				 * Returns whether this stream is valid.
+				 * @return True, if so
+				 * @see Stream::isValid().
+				 */
+				inline bool isValid() const override;
+
+			protected:
+
+				/// The memory-mapped stream.
+				MemoryMappedInputStream stream_;
+
+				/// The input bitstream.
+				InputBitstream inputBitstream_;
+		};
+
 	public:
 
 		/**
@@ -328,6 +484,15 @@ class OCEAN_IO_SERIALIZATION_EXPORT FileInputDataSerializer : public InputDataSe
 		 */
 		virtual bool setFilename(const std::string& filename);
 
+		/**
+		 * Sets whether the file will be mapped into memory instead of being read with file stream operations.
+		 * Memory mapping avoids a system call for each read operation and makes seeking and random sample access cheap, which is beneficial when replaying large recordings.<br>
+		 * This function must be called before the serializer is initialized.
+		 * @param useMemoryMapping True, to map the file into memory; False, to read the file with a file stream
+		 * @return True, if succeeded
+		 */
+		bool setUseMemoryMapping(const bool useMemoryMapping);
+
 	protected:
 
 		/**
@@ -341,6 +506,9 @@ class OCEAN_IO_SERIALIZATION_EXPORT FileInputDataSerializer : public InputDataSe
 
 		/// The filename of the file to read.
 		std::string filename_;
+
+		/// True, to map the file into memory.
+		bool useMemoryMapping_ = false;
 };
 
 inline InputDataSerializer::ExtendedChannel::ExtendedChannel(const Channel& channel, const FactoryFunction& factoryFunction) :
@@ -390,6 +558,23 @@ inline bool FileInputDataSerializer::FileStream::isValid() const
 	return stream_.is_open() && !stream_.fail();
 }
 
+inline FileInputDataSerializer::MemoryMappedFileStream::MemoryMappedFileStream(const std::string& filename) :
+	stream_(filename),
+	inputBitstream_(stream_)
+{
+	// nothing to do here
+}
+
+inline InputBitstream& FileInputDataSerializer::MemoryMappedFileStream::inputBitstream()
+{
+	return inputBitstream_;
+}
+
+inline bool FileInputDataSerializer::MemoryMappedFileStream::isValid() const
+{
+	return stream_.isValid() && !stream_.fail();
+}
+
 template <typename T>
 bool InputDataSerializer::registerSample()
 {
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/io/serialization/MemoryMappedInputStream.h"
+
+#include "ocean/base/String.h"
+
+#ifdef _WINDOWS
+	#include <winsock2.h>
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+namespace Serialization
+{
+
+void MemoryMappedInputStream::MemoryStreamBuffer::setMemory(const void* data, const size_t size)
+{
+	ocean_assert(data != nullptr || size == 0);
+
+	// the get area is read-only, std::streambuf simply does not provide a const interface
+
+	char* begin = (char*)(data);
+
+	setg(begin, begin, begin + size);
+}
+
+MemoryMappedInputStream::MemoryStreamBuffer::pos_type MemoryMappedInputStream::MemoryStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode)
+{
+	if ((mode & std::ios_base::in) != std::ios_base::in)
+	{
+		return pos_type(off_type(-1));
+	}
+
+	off_type newPosition = 0;
+
+	switch (direction)
+	{
+		case std::ios_base::beg:
+			newPosition = offset;
+			break;
+
+		case std::ios_base::cur:
+			newPosition = off_type(gptr() - eback()) + offset;
+			break;
+
+		case std::ios_base::end:
+			newPosition = off_type(egptr() - eback()) + offset;
+			break;
+
+		default:
+			return pos_type(off_type(-1));
+	}
+
+	if (newPosition < 0 || newPosition > off_type(egptr() - eback()))
+	{
+		return pos_type(off_type(-1));
+	}
+
+	setg(eback(), eback() + newPosition, egptr());
+
+	return pos_type(newPosition);
+}
+
+MemoryMappedInputStream::MemoryStreamBuffer::pos_type MemoryMappedInputStream::MemoryStreamBuffer::seekpos(pos_type position, std::ios_base::openmode mode)
+{
+	return seekoff(off_type(position), std::ios_base::beg, mode);
+}
+
+MemoryMappedInputStream::MemoryMappedInputStream(const std::string& filename) :
+	std::istream(&streamBuffer_)
+{
+	ocean_assert(!filename.empty());
+
+#if defined(_WINDOWS)
+
+	const HANDLE fileHandle = CreateFileW(String::toWString(filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (fileHandle != INVALID_HANDLE_VALUE)
+	{
+		LARGE_INTEGER fileSize;
+
+		if (GetFileSizeEx(fileHandle, &fileSize) == TRUE)
+		{
+			size_ = size_t(fileSize.QuadPart);
+
+			if (size_ == 0)
+			{
+				isValid_ = true;
+			}
+			else
+			{
+				const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				if (mappingHandle != nullptr)
+				{
+					data_ = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+					if (data_ != nullptr)
+					{
+						handle_ = mappingHandle;
+						isValid_ = true;
+					}
+					else
+					{
+						CloseHandle(mappingHandle);
+					}
+				}
+			}
+		}
+
+		// the mapping keeps a reference to the file
+
+		CloseHandle(fileHandle);
+	}
+
+#else
+
+	const int fileDescriptor = open(filename.c_str(), O_RDONLY);
+
+	if (fileDescriptor >= 0)
+	{
+		struct stat fileStatus;
+
+		if (fstat(fileDescriptor, &fileStatus) == 0)
+		{
+			size_ = size_t(fileStatus.st_size);
+
+			if (size_ == 0)
+			{
+				isValid_ = true;
+			}
+			else
+			{
+				void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+				if (data != MAP_FAILED)
+				{
+					// the recording is mainly read front to back, however seeking is supported as well
+
+					madvise(data, size_, MADV_SEQUENTIAL);
+
+					data_ = data;
+					isValid_ = true;
+				}
+			}
+		}
+
+		// the mapping keeps a reference to the file
+
+		close(fileDescriptor);
+	}
+
+#endif
+
+	if (isValid_)
+	{
+		streamBuffer_.setMemory(data_, size_);
+	}
+	else
+	{
+		size_ = 0;
+		setstate(std::ios_base::failbit);
+	}
+}
+
+MemoryMappedInputStream::~MemoryMappedInputStream()
+{
+	streamBuffer_.setMemory(nullptr, 0);
+
+#if defined(_WINDOWS)
+
+	if (data_ != nullptr)
+	{
+		const BOOL result = UnmapViewOfFile(data_);
+		ocean_assert_and_suppress_unused(result == TRUE, result);
+	}
+
+	if (handle_ != nullptr)
+	{
+		const BOOL result = CloseHandle(handle_);
+		ocean_assert_and_suppress_unused(result == TRUE, result);
+	}
+
+#else
+
+	if (data_ != nullptr)
+	{
+		const int result = munmap(data_, size_);
+		ocean_assert_and_suppress_unused(result == 0, result);
+	}
+
+#endif
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_IO_SERIALIZATION_MEMORY_MAPPED_INPUT_STREAM_H
+#define META_OCEAN_IO_SERIALIZATION_MEMORY_MAPPED_INPUT_STREAM_H
+
+#include "ocean/io/serialization/Serialization.h"
+
+#include <istream>
+#include <streambuf>
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+namespace Serialization
+{
+
+/**
+ * This class implements an input stream reading from a memory-mapped file.
+ * The file is mapped into the address space of the process once, so that reading does not involve any file system call and seeking is free.<br>
+ * The stream is intended for playback of large recordings, e.g., in combination with FileInputDataSerializer::setUseMemoryMapping().
+ * @ingroup ioserialization
+ */
+class OCEAN_IO_SERIALIZATION_EXPORT MemoryMappedInputStream : public std::istream
+{
+	public:
+
+		/**
+		 * This class implements a read-only stream buffer exposing an existing memory block.
+		 * The buffer does not copy or own the memory.
+		 */
+		class OCEAN_IO_SERIALIZATION_EXPORT MemoryStreamBuffer : public std::streambuf
+		{
+			public:
+
+				/**
+				 * Creates a new empty stream buffer.
+				 */
+				MemoryStreamBuffer() = default;
+
+				/**
+				 * Sets the memory block to be exposed.
+				 * @param data The memory block, must be valid if size > 0, must be valid as long as the buffer is used
+				 * @param size The size of the memory block, in bytes, with range [0, infinity)
+				 */
+				void setMemory(const void* data, const size_t size);
+
+			protected:
+
+				/**
+				 * Repositions the read position using relative offsets.
+				 * @param offset The offset to apply, can be positive or negative
+				 * @param direction The reference position (beginning, current, or end)
+				 * @param mode The open mode, must contain std::ios_base::in
+				 * @return The new position, or pos_type(off_type(-1)) on failure
+				 */
+				pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode = std::ios_base::in) override;
+
+				/**
+				 * Repositions the read position to an absolute position.
+				 * @param position The absolute position to seek to
+				 * @param mode The open mode, must contain std::ios_base::in
+				 * @return The new position, or pos_type(off_type(-1)) on failure
+				 */
+				pos_type seekpos(pos_type position, std::ios_base::openmode mode = std::ios_base::in) override;
+		};
+
+	public:
+
+		/**
+		 * Creates a new stream and maps the given file.
+		 * @param filename The name of the file to map, must be valid
+		 */
+		explicit MemoryMappedInputStream(const std::string& filename);
+
+		/**
+		 * Destructs the stream and unmaps the file.
+		 */
+		~MemoryMappedInputStream() override;
+
+		/**
+		 * Returns the mapped memory of the file.
+		 * @return The mapped memory, nullptr if the file could not be mapped or is empty
+		 */
+		inline const void* data() const;
+
+		/**
+		 * Returns the size of the mapped file.
+		 * @return The file's size, in bytes, with range [0, infinity)
+		 */
+		inline size_t size() const;
+
+		/**
+		 * Returns whether the file could be mapped.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		MemoryMappedInputStream(const MemoryMappedInputStream&) = delete;
+
+		/**
+		 * Disabled assign operator.
+		 * @return Reference to this object
+		 */
+		MemoryMappedInputStream& operator=(const MemoryMappedInputStream&) = delete;
+
+	protected:
+
+		/// The stream buffer exposing the mapped memory.
+		MemoryStreamBuffer streamBuffer_;
+
+		/// The mapped memory, nullptr if not mapped.
+		void* data_ = nullptr;
+
+		/// The size of the mapped memory, in bytes.
+		size_t size_ = 0;
+
+		/// True, if the file could be mapped.
+		bool isValid_ = false;
+
+		/// The platform specific handle of the file mapping.
+		void* handle_ = nullptr;
+};
+
+inline const void* MemoryMappedInputStream::data() const
+{
+	return data_;
+}
+
+inline size_t MemoryMappedInputStream::size() const
+{
+	return size_;
+}
+
+inline bool MemoryMappedInputStream::isValid() const
+{
+	return isValid_;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_IO_SERIALIZATION_MEMORY_MAPPED_INPUT_STREAM_H
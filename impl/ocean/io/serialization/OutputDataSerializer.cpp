@@ -117,6 +117,12 @@ DataSerializer::ChannelId OutputDataSerializer::addChannel(const std::string& sa
 		return invalidChannelId();
 	}
 
+	if (nextChannelId_ >= extractChannelId(indexChannelValue()))
+	{
+		ocean_assert(false && "Too many channels!");
+		return invalidChannelId();
+	}
+
 	const ChannelId channelId = nextChannelId_++;
 
 	channelConfigurationMap_.emplace(channelConfiguration, channelId);
@@ -147,6 +153,21 @@ bool OutputDataSerializer::addSample(const ChannelId channelId, UniqueDataSample
 	return true;
 }
 
+bool OutputDataSerializer::setIndexEnabled(const bool enabled)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (state_ >= S_STARTED)
+	{
+		ocean_assert(false && "The serializer has been started already!");
+		return false;
+	}
+
+	indexEnabled_ = enabled;
+
+	return true;
+}
+
 bool OutputDataSerializer::writeHeader(OutputBitstream& outputBitstream)
 {
 	ocean_assert(outputBitstream);
@@ -166,6 +187,34 @@ bool OutputDataSerializer::writeHeader(OutputBitstream& outputBitstream)
 	return true;
 }
 
+bool OutputDataSerializer::writeIndex(OutputBitstream& outputBitstream, const SampleIndex& sampleIndex)
+{
+	const uint64_t recordPosition = outputBitstream.size();
+	ocean_assert(recordPosition != uint64_t(-1));
+
+	VectorOutputStream indexStream(1024 * 1024);
+	OutputBitstream indexBitstream(indexStream);
+
+	if (!sampleIndex.write(indexBitstream)
+			|| !indexBitstream.write<uint64_t>(recordPosition)
+			|| !indexBitstream.write(indexTag(), 8))
+	{
+		return false;
+	}
+
+	const size_t payloadSize = indexBitstream.size();
+
+	if (!NumericT<uint32_t>::isInsideValueRange(payloadSize))
+	{
+		Log::warning() << "OutputDataSerializer: The index is too large and will be skipped";
+		return true;
+	}
+
+	return outputBitstream.write<uint32_t>(indexChannelValue())
+			&& outputBitstream.write<uint32_t>(uint32_t(payloadSize))
+			&& outputBitstream.write(indexStream.data(), payloadSize);
+}
+
 void OutputDataSerializer::threadRun()
 {
 	ocean_assert(stream_);
@@ -187,6 +236,20 @@ void OutputDataSerializer::threadRun()
 
 	UnorderedIndexSet32 activeChannelIds;
 
+	bool indexEnabled = false;
+
+	TemporaryScopedLock temporaryScopedIndexLock(lock_);
+		indexEnabled = indexEnabled_;
+	temporaryScopedIndexLock.release();
+
+	if (indexEnabled && outputBitstream.size() == uint64_t(-1))
+	{
+		Log::debug() << "OutputDataSerializer: The output stream does not provide stream positions, skipping the index";
+		indexEnabled = false;
+	}
+
+	SampleIndex sampleIndex;
+
 	while (!shouldThreadStop())
 	{
 		TemporaryScopedLock temporaryScopedLock(lock_);
@@ -260,6 +323,12 @@ void OutputDataSerializer::threadRun()
 
 			const uint32_t channelValue = makeConfigurationChannelId(channelId);
 
+			if (indexEnabled && !sampleIndex.addConfiguration(channelId, outputBitstream.size()))
+			{
+				ocean_assert(false && "This should never happen!");
+				indexEnabled = false;
+			}
+
 			if (!outputBitstream.write<uint32_t>(channelValue)
 				|| !outputBitstream.write<uint32_t>(uint32_t(payloadSize))
 				|| !outputBitstream.write(sampleStream.data(), payloadSize))
@@ -285,6 +354,12 @@ void OutputDataSerializer::threadRun()
 			break;
 		}
 
+		if (indexEnabled && !sampleIndex.addEntry(channelId, SampleIndex::Entry(outputBitstream.size(), sample->playbackTimestamp(), sample->dataTimestamp())))
+		{
+			ocean_assert(false && "This should never happen!");
+			indexEnabled = false;
+		}
+
 		if (!outputBitstream.write<uint32_t>(uint32_t(channelId))
 				|| !outputBitstream.write<uint32_t>(uint32_t(payloadSize))
 				|| !outputBitstream.write(sampleStream.data(), payloadSize))
@@ -296,6 +371,16 @@ void OutputDataSerializer::threadRun()
 		sampleStream.clear();
 	}
 
+	if (indexEnabled && succeeded_)
+	{
+		// the index is written as a record of a channel which is never assigned, so that readers without index support skip the record
+
+		if (!writeIndex(outputBitstream, sampleIndex))
+		{
+			succeeded_ = false;
+		}
+	}
+
 	// let's write a final invalid channel id to indicate the end of the stream
 
 	if (!outputBitstream.write<uint32_t>(invalidChannelId()))
@@ -10,6 +10,7 @@
 
 #include "ocean/io/serialization/Serialization.h"
 #include "ocean/io/serialization/DataSerializer.h"
+#include "ocean/io/serialization/SampleIndex.h"
 
 namespace Ocean
 {
@@ -83,6 +84,17 @@ class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
 		 */
 		bool addSample(const DataSerializer::ChannelId channelId, UniqueDataSample&& sample);
 
+		/**
+		 * Sets whether the serializer writes an index of all samples at the end of the stream.
+		 * The index allows input serializers to seek within the stream and to access individual samples randomly without scanning the entire stream.<br>
+		 * The index is ignored by readers without index support, by default the index is enabled.<br>
+		 * The index is only written if the underlying stream reports stream positions.
+		 * @param enabled True, to write the index; False, to skip the index
+		 * @return True, if succeeded; False, if the serializer has been started already
+		 * @see InputDataSerializer::createIndex().
+		 */
+		bool setIndexEnabled(const bool enabled);
+
 		/**
 		 * Starts the serializer.
 		 * @return True, if succeeded
@@ -129,6 +141,15 @@ class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
 		 */
 		virtual bool writeHeader(OutputBitstream& outputBitstream);
 
+		/**
+		 * Writes the index record to the output bitstream.
+		 * The record's payload ends with the position of the record and the index tag so that readers can locate the index from the end of the stream.
+		 * @param outputBitstream The output bitstream to which the index will be written
+		 * @param sampleIndex The index to write
+		 * @return True, if succeeded
+		 */
+		static bool writeIndex(OutputBitstream& outputBitstream, const SampleIndex& sampleIndex);
+
 		/**
 		 * The thread run function.
 		 * @see Thread::threadRun().
@@ -140,6 +161,9 @@ class OCEAN_IO_SERIALIZATION_EXPORT OutputDataSerializer : public DataSerializer
 		/// The output stream.
 		UniqueStream stream_;
 
+		/// True, to write an index of all samples at the end of the stream.
+		bool indexEnabled_ = true;
+
 		/// The next channel id to be assigned.
 		ChannelId nextChannelId_ = ChannelId(0);
 
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/io/serialization/SampleIndex.h"
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+namespace Serialization
+{
+
+bool SampleIndex::addConfiguration(const ChannelId channelId, const uint64_t position)
+{
+	ocean_assert(channelId != DataSerializer::invalidChannelId());
+	ocean_assert(position != uint64_t(-1));
+
+	ChannelIndex& channelIndex = channelIndexMap_[channelId];
+
+	if (channelIndex.configurationPosition_ != uint64_t(-1))
+	{
+		return false;
+	}
+
+	channelIndex.configurationPosition_ = position;
+
+	return true;
+}
+
+bool SampleIndex::addEntry(const ChannelId channelId, const Entry& entry)
+{
+	ocean_assert(entry.position_ != uint64_t(-1));
+
+	const ChannelIndexMap::iterator iChannel = channelIndexMap_.find(channelId);
+
+	if (iChannel == channelIndexMap_.cend())
+	{
+		ocean_assert(false && "The channel's configuration must be added first!");
+		return false;
+	}
+
+	Entries& entries = iChannel->second.entries_;
+
+	if (!entries.empty() && entries.back().position_ >= entry.position_)
+	{
+		ocean_assert(false && "Entries must be added in stream order!");
+		return false;
+	}
+
+	entries.emplace_back(entry);
+
+	return true;
+}
+
+std::vector<SampleIndex::ChannelId> SampleIndex::channelIds() const
+{
+	std::vector<ChannelId> result;
+	result.reserve(channelIndexMap_.size());
+
+	for (const ChannelIndexMap::value_type& channelPair : channelIndexMap_)
+	{
+		result.emplace_back(channelPair.first);
+	}
+
+	std::sort(result.begin(), result.end());
+
+	return result;
+}
+
+const SampleIndex::ChannelIndex* SampleIndex::channelIndex(const ChannelId channelId) const
+{
+	const ChannelIndexMap::const_iterator iChannel = channelIndexMap_.find(channelId);
+
+	if (iChannel == channelIndexMap_.cend())
+	{
+		return nullptr;
+	}
+
+	return &iChannel->second;
+}
+
+size_t SampleIndex::numberSamples(const ChannelId channelId) const
+{
+	const ChannelIndex* channel = channelIndex(channelId);
+
+	if (channel == nullptr)
+	{
+		return 0;
+	}
+
+	return channel->entries_.size();
+}
+
+const SampleIndex::Entry* SampleIndex::entry(const ChannelId channelId, const size_t sampleIndex) const
+{
+	const ChannelIndex* channel = channelIndex(channelId);
+
+	if (channel == nullptr || sampleIndex >= channel->entries_.size())
+	{
+		return nullptr;
+	}
+
+	return &channel->entries_[sampleIndex];
+}
+
+size_t SampleIndex::findSampleByPlaybackTimestamp(const ChannelId channelId, const double playbackTimestamp) const
+{
+	const ChannelIndex* channel = channelIndex(channelId);
+
+	if (channel == nullptr)
+	{
+		return 0;
+	}
+
+	// the samples of one channel are created sequentially, so that their playback timestamps are increasing in stream order
+
+	const Entries::const_iterator iEntry = std::lower_bound(channel->entries_.cbegin(), channel->entries_.cend(), playbackTimestamp, [](const Entry& entry, const double value)
+	{
+		return entry.playbackTimestamp_ < value;
+	});
+
+	return size_t(iEntry - channel->entries_.cbegin());
+}
+
+size_t SampleIndex::findSampleByDataTimestamp(const ChannelId channelId, const double dataTimestamp) const
+{
+	const ChannelIndex* channel = channelIndex(channelId);
+
+	if (channel == nullptr)
+	{
+		return 0;
+	}
+
+	const Entries::const_iterator iEntry = std::lower_bound(channel->entries_.cbegin(), channel->entries_.cend(), dataTimestamp, [](const Entry& entry, const double value)
+	{
+		return entry.dataTimestamp_.forceDouble() < value;
+	});
+
+	return size_t(iEntry - channel->entries_.cbegin());
+}
+
+uint64_t SampleIndex::seekPosition(const double playbackTimestamp) const
+{
+	uint64_t position = uint64_t(-1);
+
+	for (const ChannelIndexMap::value_type& channelPair : channelIndexMap_)
+	{
+		const Entries& entries = channelPair.second.entries_;
+
+		const size_t sampleIndex = findSampleByPlaybackTimestamp(channelPair.first, playbackTimestamp);
+
+		if (sampleIndex < entries.size())
+		{
+			position = std::min(position, entries[sampleIndex].position_);
+		}
+	}
+
+	return position;
+}
+
+double SampleIndex::lastPlaybackTimestamp() const
+{
+	double result = NumericD::minValue();
+
+	for (const ChannelIndexMap::value_type& channelPair : channelIndexMap_)
+	{
+		const Entries& entries = channelPair.second.entries_;
+
+		if (!entries.empty())
+		{
+			result = std::max(result, entries.back().playbackTimestamp_);
+		}
+	}
+
+	return result;
+}
+
+bool SampleIndex::read(InputBitstream& inputBitstream)
+{
+	clear();
+
+	uint32_t version = uint32_t(-1);
+	if (!inputBitstream.read<uint32_t>(version) || version != 0u)
+	{
+		return false;
+	}
+
+	uint32_t numberChannels = 0u;
+	if (!inputBitstream.read<uint32_t>(numberChannels))
+	{
+		return false;
+	}
+
+	for (uint32_t nChannel = 0u; nChannel < numberChannels; ++nChannel)
+	{
+		ChannelId channelId = DataSerializer::invalidChannelId();
+		uint64_t configurationPosition = uint64_t(-1);
+		uint64_t numberEntries = 0ull;
+
+		if (!inputBitstream.read<uint32_t>(channelId) || !inputBitstream.read<uint64_t>(configurationPosition) || !inputBitstream.read<uint64_t>(numberEntries))
+		{
+			clear();
+			return false;
+		}
+
+		if (channelId == DataSerializer::invalidChannelId() || configurationPosition == uint64_t(-1) || !addConfiguration(channelId, configurationPosition))
+		{
+			clear();
+			return false;
+		}
+
+		// each entry has at least 17 bytes, so that we can detect corrupted entry numbers before allocating memory
+
+		const uint64_t remainingBytes = inputBitstream.size() - inputBitstream.position();
+
+		if (numberEntries > remainingBytes / 17ull)
+		{
+			clear();
+			return false;
+		}
+
+		Entries& entries = channelIndexMap_[channelId].entries_;
+		entries.reserve(size_t(numberEntries));
+
+		for (uint64_t nEntry = 0ull; nEntry < numberEntries; ++nEntry)
+		{
+			Entry entry;
+
+			if (!inputBitstream.read<uint64_t>(entry.position_) || !inputBitstream.read<double>(entry.playbackTimestamp_) || !DataTimestamp::read(inputBitstream, entry.dataTimestamp_))
+			{
+				clear();
+				return false;
+			}
+
+			if (!entries.empty() && entries.back().position_ >= entry.position_)
+			{
+				clear();
+				return false;
+			}
+
+			entries.emplace_back(entry);
+		}
+	}
+
+	return true;
+}
+
+bool SampleIndex::write(OutputBitstream& outputBitstream) const
+{
+	constexpr uint32_t version = 0u;
+
+	if (!outputBitstream.write<uint32_t>(version) || !outputBitstream.write<uint32_t>(uint32_t(channelIndexMap_.size())))
+	{
+		return false;
+	}
+
+	for (const ChannelId channelId : channelIds())
+	{
+		const ChannelIndex& channel = channelIndexMap_.at(channelId);
+
+		if (!outputBitstream.write<uint32_t>(channelId) || !outputBitstream.write<uint64_t>(channel.configurationPosition_) || !outputBitstream.write<uint64_t>(uint64_t(channel.entries_.size())))
+		{
+			return false;
+		}
+
+		for (const Entry& entry : channel.entries_)
+		{
+			if (!outputBitstream.write<uint64_t>(entry.position_) || !outputBitstream.write<double>(entry.playbackTimestamp_) || !DataTimestamp::write(outputBitstream, entry.dataTimestamp_))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void SampleIndex::clear()
+{
+	channelIndexMap_.clear();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_IO_SERIALIZATION_SAMPLE_INDEX_H
+#define META_OCEAN_IO_SERIALIZATION_SAMPLE_INDEX_H
+
+#include "ocean/io/serialization/Serialization.h"
+#include "ocean/io/serialization/DataSerializer.h"
+#include "ocean/io/serialization/DataTimestamp.h"
+
+#include "ocean/io/Bitstream.h"
+
+#include "ocean/math/Numeric.h"
+
+namespace Ocean
+{
+
+namespace IO
+{
+
+namespace Serialization
+{
+
+/**
+ * This class implements an index of a serialized stream allowing to seek within the stream and to access individual samples randomly.
+ * For each channel, the index holds the stream position of the channel's configuration and the stream positions of all samples together with their playback and data timestamps.<br>
+ * The index is written as footer by the OutputDataSerializer, or can be reconstructed by the InputDataSerializer with one scan of the stream.
+ * @see InputDataSerializer::createIndex(), OutputDataSerializer::setIndexEnabled().
+ * @ingroup ioserialization
+ */
+class OCEAN_IO_SERIALIZATION_EXPORT SampleIndex
+{
+	public:
+
+		/// Definition of a channel id.
+		using ChannelId = DataSerializer::ChannelId;
+
+		/**
+		 * This class holds the location and timestamps of one sample in the stream.
+		 */
+		class Entry
+		{
+			public:
+
+				/**
+				 * Creates a new invalid entry.
+				 */
+				Entry() = default;
+
+				/**
+				 * Creates a new entry.
+				 * @param position The position of the sample in the stream, pointing to the sample's channel value, with range [0, infinity)
+				 * @param playbackTimestamp The playback timestamp of the sample, in seconds
+				 * @param dataTimestamp The data timestamp of the sample, must be valid
+				 */
+				inline Entry(const uint64_t position, const double playbackTimestamp, const DataTimestamp& dataTimestamp);
+
+			public:
+
+				/// The position of the sample in the stream, pointing to the sample's channel value.
+				uint64_t position_ = uint64_t(-1);
+
+				/// The playback timestamp of the sample, in seconds.
+				double playbackTimestamp_ = NumericD::minValue();
+
+				/// The data timestamp of the sample.
+				DataTimestamp dataTimestamp_;
+		};
+
+		/// Definition of a vector holding entries.
+		using Entries = std::vector<Entry>;
+
+		/**
+		 * This class holds the index information of one channel.
+		 */
+		class ChannelIndex
+		{
+			public:
+
+				/// The position of the channel's configuration in the stream, pointing to the configuration's channel value.
+				uint64_t configurationPosition_ = uint64_t(-1);
+
+				/// The entries of all samples of the channel, in stream order.
+				Entries entries_;
+		};
+
+		/// Definition of a map mapping channel ids to channel indices.
+		using ChannelIndexMap = std::unordered_map<ChannelId, ChannelIndex>;
+
+	public:
+
+		/**
+		 * Creates a new empty index.
+		 */
+		SampleIndex() = default;
+
+		/**
+		 * Adds the location of a channel's configuration to this index.
+		 * @param channelId The id of the channel, must be valid
+		 * @param position The position of the configuration in the stream, with range [0, infinity)
+		 * @return True, if succeeded; False, if the channel has been added already
+		 */
+		bool addConfiguration(const ChannelId channelId, const uint64_t position);
+
+		/**
+		 * Adds a sample to this index.
+		 * The configuration of the sample's channel must have been added before.
+		 * @param channelId The id of the channel to which the sample belongs, must be valid
+		 * @param entry The entry of the sample, the position must be larger than the position of all other samples of the channel
+		 * @return True, if succeeded
+		 */
+		bool addEntry(const ChannelId channelId, const Entry& entry);
+
+		/**
+		 * Returns the ids of all channels in this index.
+		 * @return The channel ids, sorted in ascending order
+		 */
+		std::vector<ChannelId> channelIds() const;
+
+		/**
+		 * Returns the index information of a channel.
+		 * @param channelId The id of the channel
+		 * @return The channel's index information, nullptr if the channel is unknown
+		 */
+		const ChannelIndex* channelIndex(const ChannelId channelId) const;
+
+		/**
+		 * Returns the number of samples of a channel.
+		 * @param channelId The id of the channel
+		 * @return The number of samples, 0 if the channel is unknown
+		 */
+		size_t numberSamples(const ChannelId channelId) const;
+
+		/**
+		 * Returns the entry of a specific sample.
+		 * @param channelId The id of the channel
+		 * @param sampleIndex The index of the sample within the channel, with range [0, numberSamples(channelId) - 1]
+		 * @return The sample's entry, nullptr if the channel or sample does not exist
+		 */
+		const Entry* entry(const ChannelId channelId, const size_t sampleIndex) const;
+
+		/**
+		 * Returns the index of the first sample of a channel with a playback timestamp equal to or later than a given timestamp.
+		 * @param channelId The id of the channel
+		 * @param playbackTimestamp The playback timestamp to search for, in seconds
+		 * @return The index of the sample, numberSamples(channelId) if no such sample exists
+		 */
+		size_t findSampleByPlaybackTimestamp(const ChannelId channelId, const double playbackTimestamp) const;
+
+		/**
+		 * Returns the index of the first sample of a channel with a data timestamp equal to or later than a given timestamp.
+		 * Data timestamps holding int64 values are compared after conversion to double values.
+		 * @param channelId The id of the channel
+		 * @param dataTimestamp The data timestamp to search for
+		 * @return The index of the sample, numberSamples(channelId) if no such sample exists
+		 */
+		size_t findSampleByDataTimestamp(const ChannelId channelId, const double dataTimestamp) const;
+
+		/**
+		 * Returns the stream position from which reading needs to start so that no sample of any channel with a playback timestamp equal to or later than a given timestamp is missed.
+		 * The position is the smallest position of all channels, therefore samples with earlier playback timestamps may follow the position and need to be skipped by the reader.
+		 * @param playbackTimestamp The playback timestamp to seek to, in seconds
+		 * @return The stream position, uint64_t(-1) if no sample exists at or after the given timestamp
+		 */
+		uint64_t seekPosition(const double playbackTimestamp) const;
+
+		/**
+		 * Returns the largest playback timestamp of all samples in this index.
+		 * @return The largest playback timestamp, in seconds, NumericD::minValue() if the index does not hold any sample
+		 */
+		double lastPlaybackTimestamp() const;
+
+		/**
+		 * Reads the index from an input bitstream.
+		 * @param inputBitstream The input bitstream from which the index will be read
+		 * @return True, if succeeded
+		 */
+		bool read(InputBitstream& inputBitstream);
+
+		/**
+		 * Writes the index to an output bitstream.
+		 * @param outputBitstream The output bitstream to which the index will be written
+		 * @return True, if succeeded
+		 */
+		bool write(OutputBitstream& outputBitstream) const;
+
+		/**
+		 * Removes all channels and samples from this index.
+		 */
+		void clear();
+
+		/**
+		 * Returns whether this index does not hold any channel.
+		 * @return True, if so
+		 */
+		inline bool isEmpty() const;
+
+	protected:
+
+		/// The map mapping channel ids to channel indices.
+		ChannelIndexMap channelIndexMap_;
+};
+
+inline SampleIndex::Entry::Entry(const uint64_t position, const double playbackTimestamp, const DataTimestamp& dataTimestamp) :
+	position_(position),
+	playbackTimestamp_(playbackTimestamp),
+	dataTimestamp_(dataTimestamp)
+{
+	// nothing to do here
+}
+
+inline bool SampleIndex::isEmpty() const
+{
+	return channelIndexMap_.empty();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_IO_SERIALIZATION_SAMPLE_INDEX_H
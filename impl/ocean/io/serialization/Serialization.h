@@ -33,7 +33,9 @@ namespace Serialization
  * - DataSample: The abstract base class for all data samples, containing timestamps for both recording and playback.<br>
  * - DataTimestamp: A flexible timestamp class supporting both double and int64_t representations.<br>
  * - MediaSerializer: Provides specialized data samples for media content, e.g., DataSampleFrame for Ocean::Frame objects with optional camera models.<br>
- * - VectorOutputStream: A memory-based output stream implementation for in-memory buffering.
+ * - SampleIndex: An index of a serialized stream allowing to seek and to access individual samples randomly.<br>
+ * - VectorOutputStream: A memory-based output stream implementation for in-memory buffering.<br>
+ * - MemoryMappedInputStream: An input stream reading from a memory-mapped file.
  *
  * Typical usage involves creating an output serializer to record data samples into channels, or creating an input serializer to play back previously recorded data with timing control.
  * @}
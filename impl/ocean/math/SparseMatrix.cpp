@@ -608,27 +608,50 @@ void SparseMatrixT<T>::transpose()
 }
 
 template <typename T>
-bool SparseMatrixT<T>::solve(const MatrixT<T>& b, MatrixT<T>& x) const
+bool SparseMatrixT<T>::solve(const MatrixT<T>& b, MatrixT<T>& x, const typename MatrixT<T>::MatrixProperty matrixProperty) const
 {
 	ocean_assert(b.rows() > 0 && b.columns() == 1);
 	ocean_assert(internalMatrix);
 
 	const typename InternalMatrix<T>::Type& sparseMatrix = *static_cast<typename InternalMatrix<T>::Type*>(internalMatrix);
 
-	Eigen::SparseLU<typename InternalMatrix<T>::Type> solver;
-	solver.compute(sparseMatrix);
-
-	if (solver.info() != Eigen::Success)
-		return false;
-
 	Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor> bVector(b.rows());
 	memcpy(bVector.data(), b.data(), sizeof(T) * b.elements());
 
-	const Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor> xVector(solver.solve(bVector));
+	Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor> xVector;
 
-	// check whether the solving failed
-	if (solver.info() != Eigen::Success)
-		return false;
+	if (matrixProperty == MatrixT<T>::MP_SYMMETRIC)
+	{
+		ocean_assert(rows() == columns());
+
+		Eigen::SimplicialLDLT<typename InternalMatrix<T>::Type> solver;
+		solver.compute(sparseMatrix);
+
+		if (solver.info() != Eigen::Success)
+			return false;
+
+		xVector = solver.solve(bVector);
+
+		// check whether the solving failed
+		if (solver.info() != Eigen::Success)
+			return false;
+	}
+	else
+	{
+		ocean_assert(matrixProperty == MatrixT<T>::MP_UNKNOWN);
+
+		Eigen::SparseLU<typename InternalMatrix<T>::Type> solver;
+		solver.compute(sparseMatrix);
+
+		if (solver.info() != Eigen::Success)
+			return false;
+
+		xVector = solver.solve(bVector);
+
+		// check whether the solving failed
+		if (solver.info() != Eigen::Success)
+			return false;
+	}
 
 	x = MatrixT<T>((size_t)xVector.rows(), 1, xVector.data());
 
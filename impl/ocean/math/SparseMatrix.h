@@ -293,11 +293,13 @@ class SparseMatrixT
 		 * Solves the given linear system.
 		 * M * x = b, with M and b known.<br>
 		 * This matrix is M, the given vector is b and the result will be x.<br>
+		 * Symmetric positive (semi-)definite matrices like normal equations (J^T * J) can be solved with a sparse Cholesky (LDL^T) decomposition, which is significantly faster than the standard LU decomposition.
 		 * @param b Vector defining the linear system
 		 * @param x Solution vector receiving the solution if existing
+		 * @param matrixProperty The property of the matrix allowing to improve the solving performance, MP_SYMMETRIC if this matrix is symmetric and positive (semi-)definite, MP_UNKNOWN to apply a standard solving
 		 * @return True, if succeeded
 		 */
-		bool solve(const MatrixT<T>& b, MatrixT<T>& x) const;
+		bool solve(const MatrixT<T>& b, MatrixT<T>& x, const typename MatrixT<T>::MatrixProperty matrixProperty = MatrixT<T>::MP_UNKNOWN) const;
 
 		/**
 		 * Computes the rank of this matrix.
@@ -31,6 +31,8 @@ ImageFileSequence::ImageFileSequence(const std::string& url) :
 ImageFileSequence::~ImageFileSequence()
 {
 	stopThreadExplicitly();
+
+	releasePrefetching();
 }
 
 double ImageFileSequence::duration() const
@@ -128,7 +130,7 @@ bool ImageFileSequence::start()
 			return false;
 		}
 
-		if (!loadImage(nextFile(), Timestamp(true), &nextFrame_))
+		if (!loadSequenceImage(frameIndex_, Timestamp(true), nextFrame_))
 		{
 			return false;
 		}
@@ -180,6 +182,13 @@ bool ImageFileSequence::stop()
 	if (sequenceMode_ == SM_EXPLICIT)
 	{
 		explicitSequenceModeStarted_ = false;
+
+		// the sequence can be started again, e.g., for random access after setPosition()
+
+		startTimestamp_.toInvalid();
+		pauseTimestamp_.toInvalid();
+		stopTimestamp_.toNow();
+
 		return true;
 	}
 
@@ -285,7 +294,7 @@ bool ImageFileSequence::forceNextFrame()
 		nextFile = IO::File(imageFilename(frameIndex_));
 	}
 
-	if (!loadImage(nextFile(), Timestamp(true), &nextFrame_))
+	if (!loadSequenceImage(frameIndex_, Timestamp(true), nextFrame_))
 	{
 		return false;
 	}
@@ -293,6 +302,100 @@ bool ImageFileSequence::forceNextFrame()
 	return deliverNewFrame(std::move(nextFrame_), SharedAnyCamera(camera_));
 }
 
+bool ImageFileSequence::setPrefetching(const PrefetchMode prefetchMode, const unsigned int numberImages, const unsigned int numberThreads)
+{
+	if (prefetchMode != PM_DISABLED && (numberImages == 0u || numberThreads == 0u))
+	{
+		return false;
+	}
+
+	if (prefetchMode != PM_DISABLED && !supportsConcurrentLoading())
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	releasePrefetching();
+
+	if (prefetchMode == PM_DISABLED)
+	{
+		return true;
+	}
+
+	std::unique_ptr<ThreadPool> threadPool = std::make_unique<ThreadPool>();
+
+	if (numberThreads >= 2u && !threadPool->setCapacity(size_t(numberThreads)))
+	{
+		return false;
+	}
+
+	const ScopedLock prefetchScopedLock(prefetchLock_);
+
+	prefetchMode_ = prefetchMode;
+	prefetchImages_ = numberImages;
+	prefetchThreadPool_ = std::move(threadPool);
+
+	return true;
+}
+
+bool ImageFileSequence::prefetchImage(const unsigned int imageIndex)
+{
+	if (imageIndex >= images())
+	{
+		return false;
+	}
+
+	const unsigned int fileIndex = frameStartIndex_ + imageIndex;
+
+	const ScopedLock scopedLock(prefetchLock_);
+
+	if (prefetchMode_ == PM_DISABLED || !prefetchThreadPool_)
+	{
+		return false;
+	}
+
+	if (prefetchedImageMap_.find(fileIndex) != prefetchedImageMap_.cend())
+	{
+		return true;
+	}
+
+	if (prefetchedImageMap_.size() >= size_t(prefetchImages_))
+	{
+		// we release the loaded image which is most distant to the requested image, images still loading cannot be released
+
+		PrefetchedImageMap::iterator iReleaseImage = prefetchedImageMap_.end();
+		unsigned int releaseDistance = 0u;
+
+		for (PrefetchedImageMap::iterator iPrefetchedImage = prefetchedImageMap_.begin(); iPrefetchedImage != prefetchedImageMap_.end(); ++iPrefetchedImage)
+		{
+			const unsigned int distance = iPrefetchedImage->first > fileIndex ? iPrefetchedImage->first - fileIndex : fileIndex - iPrefetchedImage->first;
+
+			if (iPrefetchedImage->second.isLoaded_ && distance >= releaseDistance)
+			{
+				iReleaseImage = iPrefetchedImage;
+				releaseDistance = distance;
+			}
+		}
+
+		if (iReleaseImage == prefetchedImageMap_.end())
+		{
+			return false;
+		}
+
+		prefetchedImageMap_.erase(iReleaseImage);
+	}
+
+	prefetchedImageMap_.emplace(fileIndex, PrefetchedImage());
+
+	std::string filename = imageFilename(fileIndex);
+
+	return prefetchThreadPool_->invoke([this, fileIndex, filename = std::move(filename)]()
+	{
+		loadPrefetchedImage(fileIndex, filename);
+	});
+}
+
 bool ImageFileSequence::isFileSequence(const std::string& filename, bool* isIndividualImage)
 {
 	if (isIndividualImage != nullptr)
@@ -416,7 +519,7 @@ void ImageFileSequence::threadRun()
 
 		if (nextFile.exists())
 		{
-			if (!loadImage(nextFile(), timestamp, &nextFrame_))
+			if (!loadSequenceImage(frameIndex_, timestamp, nextFrame_))
 			{
 				break;
 			}
@@ -425,7 +528,7 @@ void ImageFileSequence::threadRun()
 		{
 			frameIndex_ = frameStartIndex_;
 
-			if (!loadImage(imageFilename(frameIndex_), timestamp, &nextFrame_))
+			if (!loadSequenceImage(frameIndex_, timestamp, nextFrame_))
 			{
 				break;
 			}
@@ -449,6 +552,169 @@ void ImageFileSequence::threadRun()
 	stopTimestamp_.toNow();
 }
 
+bool ImageFileSequence::supportsConcurrentLoading() const
+{
+	return false;
+}
+
+bool ImageFileSequence::loadSequenceImage(const unsigned int fileIndex, const Timestamp timestamp, Frame& frame)
+{
+	frame.release();
+
+	TemporaryScopedLock scopedLock(prefetchLock_);
+
+	const PrefetchMode prefetchMode = prefetchMode_;
+
+	PrefetchedImageMap::iterator iPrefetchedImage = prefetchedImageMap_.find(fileIndex);
+
+	if (iPrefetchedImage != prefetchedImageMap_.end())
+	{
+		// the image is loaded already or currently loading on a prefetching thread
+
+		if (!iPrefetchedImage->second.isLoaded_)
+		{
+			const std::shared_ptr<Signal> loadedSignal = iPrefetchedImage->second.loadedSignal_;
+
+			scopedLock.release();
+
+				loadedSignal->wait();
+
+				// the signal wakes one waiting thread only, so that we pass the signal on to the next waiting thread
+
+				loadedSignal->pulse();
+
+			scopedLock.relock(prefetchLock_);
+
+			// prefetching may have been released in the meantime
+
+			iPrefetchedImage = prefetchedImageMap_.find(fileIndex);
+		}
+
+		if (iPrefetchedImage != prefetchedImageMap_.end() && iPrefetchedImage->second.isLoaded_)
+		{
+			frame = std::move(iPrefetchedImage->second.frame_);
+			prefetchedImageMap_.erase(iPrefetchedImage);
+		}
+	}
+
+	scopedLock.release();
+
+	if (frame.isValid())
+	{
+		frame.setTimestamp(timestamp);
+	}
+	else if (!loadImage(imageFilename(fileIndex), timestamp, &frame))
+	{
+		return false;
+	}
+
+	if (prefetchMode == PM_SEQUENTIAL)
+	{
+		schedulePrefetching(fileIndex + 1u);
+	}
+
+	return true;
+}
+
+void ImageFileSequence::schedulePrefetching(const unsigned int firstFileIndex)
+{
+	const unsigned int endFileIndex = std::min(firstFileIndex + prefetchImages_, frameStartIndex_ + images());
+
+	const ScopedLock scopedLock(prefetchLock_);
+
+	if (!prefetchThreadPool_)
+	{
+		return;
+	}
+
+	// we release all images which are not needed anymore, images still loading are released once loaded
+
+	for (PrefetchedImageMap::iterator iPrefetchedImage = prefetchedImageMap_.begin(); iPrefetchedImage != prefetchedImageMap_.end(); /* noop */)
+	{
+		if (iPrefetchedImage->second.isLoaded_ && (iPrefetchedImage->first < firstFileIndex || iPrefetchedImage->first >= endFileIndex))
+		{
+			iPrefetchedImage = prefetchedImageMap_.erase(iPrefetchedImage);
+		}
+		else
+		{
+			++iPrefetchedImage;
+		}
+	}
+
+	for (unsigned int fileIndex = firstFileIndex; fileIndex < endFileIndex && prefetchedImageMap_.size() < size_t(prefetchImages_); ++fileIndex)
+	{
+		if (prefetchedImageMap_.find(fileIndex) != prefetchedImageMap_.cend())
+		{
+			continue;
+		}
+
+		prefetchedImageMap_.emplace(fileIndex, PrefetchedImage());
+
+		std::string filename = imageFilename(fileIndex);
+
+		prefetchThreadPool_->invoke([this, fileIndex, filename = std::move(filename)]()
+		{
+			loadPrefetchedImage(fileIndex, filename);
+		});
+	}
+}
+
+void ImageFileSequence::loadPrefetchedImage(const unsigned int fileIndex, const std::string& filename)
+{
+	Frame frame;
+
+	// the timestamp will be replaced when the image is delivered
+
+	if (!loadImage(filename, Timestamp(true), &frame))
+	{
+		frame.release();
+	}
+
+	const ScopedLock scopedLock(prefetchLock_);
+
+	const PrefetchedImageMap::iterator iPrefetchedImage = prefetchedImageMap_.find(fileIndex);
+
+	if (iPrefetchedImage != prefetchedImageMap_.end())
+	{
+		iPrefetchedImage->second.frame_ = std::move(frame);
+		iPrefetchedImage->second.isLoaded_ = true;
+
+		iPrefetchedImage->second.loadedSignal_->pulse();
+	}
+}
+
+void ImageFileSequence::releasePrefetching()
+{
+	TemporaryScopedLock scopedLock(prefetchLock_);
+
+		std::unique_ptr<ThreadPool> threadPool = std::move(prefetchThreadPool_);
+
+		prefetchMode_ = PM_DISABLED;
+		prefetchImages_ = 0u;
+
+	scopedLock.release();
+
+	// the pool waits for all active threads, they need the lock of the prefetched images
+
+	threadPool = nullptr;
+
+	scopedLock.relock(prefetchLock_);
+
+		// the pool has dropped all images which have not been started yet, so that we wake threads waiting for these images
+
+		for (const PrefetchedImageMap::value_type& prefetchedImagePair : prefetchedImageMap_)
+		{
+			if (!prefetchedImagePair.second.isLoaded_)
+			{
+				prefetchedImagePair.second.loadedSignal_->pulse();
+			}
+		}
+
+		prefetchedImageMap_.clear();
+
+	scopedLock.release();
+}
+
 bool ImageFileSequence::determineSequence()
 {
 	const IO::File file(url_);
@@ -11,7 +11,9 @@
 #include "ocean/media/Media.h"
 #include "ocean/media/ImageSequence.h"
 
+#include "ocean/base/Signal.h"
 #include "ocean/base/Thread.h"
+#include "ocean/base/ThreadPool.h"
 
 #include "ocean/math/AnyCamera.h"
 
@@ -30,6 +32,45 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 	public virtual ImageSequence,
 	protected Thread
 {
+	public:
+
+		/**
+		 * Definition of individual prefetching modes.
+		 */
+		enum PrefetchMode : uint32_t
+		{
+			/// Prefetching is disabled, each image is loaded when needed.
+			PM_DISABLED = 0u,
+			/// The images following the most recently delivered image are loaded and decoded in advance, for sequential access.
+			PM_SEQUENTIAL,
+			/// Only images explicitly requested via prefetchImage() are loaded and decoded in advance, for random access.
+			PM_EXPLICIT
+		};
+
+	protected:
+
+		/**
+		 * This class holds one image which is loaded in advance.
+		 */
+		class PrefetchedImage
+		{
+			public:
+
+				/// The decoded image, valid once loaded.
+				Frame frame_;
+
+				/// True, if the image has been loaded (successfully or not); False, if the image is still pending.
+				bool isLoaded_ = false;
+
+				/// The signal which is pulsed once the image has been loaded or once prefetching has been released, shared so that a waiting thread can keep the signal alive.
+				std::shared_ptr<Signal> loadedSignal_ = std::make_shared<Signal>();
+		};
+
+		/**
+		 * Definition of a map mapping file indices to prefetched images.
+		 */
+		using PrefetchedImageMap = std::unordered_map<unsigned int, PrefetchedImage>;
+
 	public:
 
 		/**
@@ -137,6 +178,34 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 		 */
 		bool forceNextFrame() override;
 
+		/**
+		 * Configures the prefetching of images.
+		 * With prefetching, images are read and decoded on background threads before they are needed, so that several images are decoded concurrently.<br>
+		 * The number of images held in memory is bounded by the given number of images.<br>
+		 * Prefetching is available for image sequences which support concurrent loading only.
+		 * @param prefetchMode The prefetching mode to be used
+		 * @param numberImages The maximal number of images loaded in advance, with range [1, infinity), ignored if prefetching is disabled
+		 * @param numberThreads The number of threads used to load and decode images, with range [1, infinity), ignored if prefetching is disabled
+		 * @return True, if succeeded
+		 * @see supportsConcurrentLoading().
+		 */
+		bool setPrefetching(const PrefetchMode prefetchMode, const unsigned int numberImages = 8u, const unsigned int numberThreads = 4u);
+
+		/**
+		 * Returns the prefetching mode of this image sequence.
+		 * @return The prefetching mode, PM_DISABLED by default
+		 */
+		inline PrefetchMode prefetchMode() const;
+
+		/**
+		 * Requests an image to be loaded in advance, e.g., because the image will be accessed randomly soon.
+		 * This function is intended for the explicit prefetching mode, if the maximal number of prefetched images is reached the loaded image most distant to the requested image is released.
+		 * @param imageIndex The index of the image to be loaded, with range [0, images())
+		 * @return True, if the image has been loaded already or will be loaded
+		 * @see setPrefetching().
+		 */
+		bool prefetchImage(const unsigned int imageIndex);
+
 		/**
 		 * Returns whether a given filename is the start of an image file sequence.
 		 * The function checks whether the file exists, whether the filename ends with a numeric index pattern, and whether a subsequent image file exists at the next index.
@@ -187,6 +256,44 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 		 */
 		virtual bool loadImage(const std::string& filename, const Timestamp timestamp, Frame* frame = nullptr) = 0;
 
+		/**
+		 * Returns whether loadImage() can be called concurrently from several threads when a frame is provided.
+		 * Derived classes supporting concurrent loading can use prefetching.
+		 * @return True, if so; False by default
+		 * @see setPrefetching().
+		 */
+		virtual bool supportsConcurrentLoading() const;
+
+		/**
+		 * Loads a specific image of the sequence, either from the prefetched images or directly.
+		 * In the sequential prefetching mode, the loading of the subsequent images is scheduled afterwards.
+		 * @param fileIndex The index of the image as used in the filename
+		 * @param timestamp The timestamp to be used for the frame
+		 * @param frame The resulting frame
+		 * @return True, if succeeded
+		 */
+		bool loadSequenceImage(const unsigned int fileIndex, const Timestamp timestamp, Frame& frame);
+
+		/**
+		 * Schedules images to be loaded in advance.
+		 * Prefetched images which are not within the new range are released, the lock of the prefetched images must not be locked.
+		 * @param firstFileIndex The index of the first image to be loaded in advance, as used in the filename
+		 */
+		void schedulePrefetching(const unsigned int firstFileIndex);
+
+		/**
+		 * Loads an image in advance, this function is executed by the prefetching threads.
+		 * @param fileIndex The index of the image as used in the filename
+		 * @param filename The filename of the image
+		 */
+		void loadPrefetchedImage(const unsigned int fileIndex, const std::string& filename);
+
+		/**
+		 * Stops prefetching and releases all prefetched images.
+		 * Derived classes must call this function in their destructor, as the prefetching threads call loadImage().
+		 */
+		void releasePrefetching();
+
 	protected:
 
 		/// Start timestamp.
@@ -209,8 +316,30 @@ class OCEAN_MEDIA_EXPORT ImageFileSequence :
 
 		/// The camera profile for all images.
 		SharedAnyCamera camera_;
+
+		/// The prefetching mode.
+		PrefetchMode prefetchMode_ = PM_DISABLED;
+
+		/// The maximal number of images loaded in advance.
+		unsigned int prefetchImages_ = 0u;
+
+		/// The threads loading images in advance, nullptr if prefetching is disabled.
+		std::unique_ptr<ThreadPool> prefetchThreadPool_;
+
+		/// The images loaded in advance or currently loading.
+		PrefetchedImageMap prefetchedImageMap_;
+
+		/// The lock for the prefetched images.
+		mutable Lock prefetchLock_;
 };
 
+inline ImageFileSequence::PrefetchMode ImageFileSequence::prefetchMode() const
+{
+	const ScopedLock scopedLock(prefetchLock_);
+
+	return prefetchMode_;
+}
+
 }
 
 }
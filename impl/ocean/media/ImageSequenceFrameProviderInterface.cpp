@@ -7,6 +7,7 @@
 
 #include "ocean/media/ImageSequenceFrameProviderInterface.h"
 
+#include "ocean/base/Processor.h"
 #include "ocean/base/TaskQueue.h"
 #include "ocean/base/WorkerPool.h"
 
@@ -27,6 +28,15 @@ ImageSequenceFrameProviderInterface::ImageSequenceFrameProviderInterface(const I
 
 		imageSequence_->setPreferredFrameFrequency(FrameMedium::FrameFrequency(0));
 		imageSequence_->setMode(ImageSequence::SM_EXPLICIT);
+
+		// frames are requested randomly, so that we prefetch explicitly requested frames only
+
+		ImageFileSequence* imageFileSequence = dynamic_cast<ImageFileSequence*>(imageSequence_.pointer());
+
+		if (imageFileSequence != nullptr && imageFileSequence->setPrefetching(ImageFileSequence::PM_EXPLICIT, maximalPrefetchedFrames_, max(1u, Processor::get().cores())))
+		{
+			prefetchingImageSequence_ = imageFileSequence;
+		}
 	}
 }
 
@@ -79,6 +89,13 @@ bool ImageSequenceFrameProviderInterface::setPreferredFrameType(const FrameType:
 
 void ImageSequenceFrameProviderInterface::asynchronFrameRequest(const unsigned int index, const bool /*priority*/)
 {
+	if (prefetchingImageSequence_ != nullptr)
+	{
+		// the frame will be decoded concurrently while previous requests are handled
+
+		prefetchingImageSequence_->prefetchImage(index);
+	}
+
 	TemporaryScopedLock temporaryScopedLock(lock_);
 		++pendingAsynchronousRequests_;
 	temporaryScopedLock.release();
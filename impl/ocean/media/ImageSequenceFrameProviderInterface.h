@@ -9,6 +9,7 @@
 #define META_OCEAN_MEDIA_IMAGE_SEQUENCE_FRAME_PROVIDER_INTERFACE_H
 
 #include "ocean/media/Media.h"
+#include "ocean/media/ImageFileSequence.h"
 #include "ocean/media/ImageSequence.h"
 
 #include "ocean/cv/FrameProviderInterface.h"
@@ -21,6 +22,7 @@ namespace Media
 
 /**
  * This class implements a frame provider interface specialization using an image sequence medium object.
+ * Image file sequences supporting concurrent loading are configured for explicit prefetching, so that asynchronously requested frames are decoded concurrently.
  * @see MovieFrameProviderInterface.
  * @ingroup media
  */
@@ -107,9 +109,15 @@ class OCEAN_MEDIA_EXPORT ImageSequenceFrameProviderInterface : public CV::FrameP
 
 	protected:
 
+		/// The maximal number of frames which are decoded in advance.
+		static constexpr unsigned int maximalPrefetchedFrames_ = 32u;
+
 		/// Image sequence used as frame source.
 		ImageSequenceRef imageSequence_;
 
+		/// The image sequence as image file sequence with explicit prefetching, nullptr if prefetching is not used.
+		ImageFileSequence* prefetchingImageSequence_ = nullptr;
+
 		/// The number of pending asynchronous requests.
 		unsigned int pendingAsynchronousRequests_ = 0u;
 
@@ -138,7 +138,7 @@ Frame Image::decodeImage(const void* buffer, const size_t size, const std::strin
 	return result;
 }
 
-bool Image::encodeImage(const Frame& frame, const std::string& imageType, std::vector<unsigned char>& buffer, const bool allowConversion, bool* hasBeenConverted, const Properties& properties)
+bool Image::encodeImage(const Frame& frame, const std::string& imageType, std::vector<unsigned char>& buffer, const bool allowConversion, bool* hasBeenConverted, const Properties& properties, Worker* worker)
 {
 	if (!frame.isValid() || imageType.empty())
 	{
@@ -157,7 +157,7 @@ bool Image::encodeImage(const Frame& frame, const std::string& imageType, std::v
 			quality = int(properties.quality_ * 100.0f);
 		}
 
-		return ImageJpg::encodeImage(frame, buffer, allowConversion, hasBeenConverted, quality);
+		return ImageJpg::encodeImage(frame, buffer, allowConversion, hasBeenConverted, quality, worker);
 	}
 #endif // OCEAN_MEDIA_OIL_SUPPORT_JPG
 
@@ -218,6 +218,7 @@ bool Image::encodeImage(const Frame& frame, const std::string& imageType, std::v
 	}
 
 	OCEAN_SUPPRESS_UNUSED_WARNING(properties);
+	OCEAN_SUPPRESS_UNUSED_WARNING(worker);
 
 	return false;
 }
@@ -267,7 +268,7 @@ Frame Image::readImage(const std::string& filename)
 	return decodeImage(buffer.data(), buffer.size(), filename.substr(fileExtensionPos + 1));
 }
 
-bool Image::writeImage(const Frame& frame, const std::string& filename, const bool allowConversion, bool* hasBeenConverted, const Properties& properties)
+bool Image::writeImage(const Frame& frame, const std::string& filename, const bool allowConversion, bool* hasBeenConverted, const Properties& properties, Worker* worker)
 {
 	const std::string::size_type fileExtensionPos = filename.rfind('.');
 
@@ -277,7 +278,7 @@ bool Image::writeImage(const Frame& frame, const std::string& filename, const bo
 	}
 
 	std::vector<uint8_t> buffer;
-	if (!encodeImage(frame, filename.substr(fileExtensionPos + 1), buffer, allowConversion, hasBeenConverted, properties))
+	if (!encodeImage(frame, filename.substr(fileExtensionPos + 1), buffer, allowConversion, hasBeenConverted, properties, worker))
 	{
 		return false;
 	}
@@ -11,6 +11,7 @@
 #include "ocean/media/openimagelibraries/OpenImageLibraries.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
 
 #include "ocean/media/Image.h"
 
@@ -85,10 +86,11 @@ class OCEAN_MEDIA_OIL_EXPORT Image
 		 * @param allowConversion True, to allow an internal conversion of the frame if does not support the given frame type; False, to prevent a conversion and to stop creating the buffer
 		 * @param hasBeenConverted Optional resulting statement whether the frame had to be converted to a different pixel format before it could be written; True, if so; False, if not
 		 * @param properties The properties to be used when writing the image, must be valid
+		 * @param worker Optional worker object to encode JPEG images in parallel strips, nullptr to encode the image with one thread; other image types ignore the worker
 		 * @return True, if succeeded; False, if the frame could not be written as image e.g., if the frame contained an alpha channel
 		 * @see readImage().
 		 */
-		static bool encodeImage(const Frame& frame, const std::string& imageType, std::vector<uint8_t>& buffer, const bool allowConversion = true, bool* hasBeenConverted = nullptr, const Properties& properties = Properties());
+		static bool encodeImage(const Frame& frame, const std::string& imageType, std::vector<uint8_t>& buffer, const bool allowConversion = true, bool* hasBeenConverted = nullptr, const Properties& properties = Properties(), Worker* worker = nullptr);
 
 		/**
 		 * Reads/loads an image from a specified file.
@@ -105,10 +107,11 @@ class OCEAN_MEDIA_OIL_EXPORT Image
 		 * @param allowConversion True, to allow an internal conversion of the frame if the image format does not support the given frame type; False, to prevent a conversion and to stop writing the file
 		 * @param hasBeenConverted Optional resulting statement whether the frame had to be converted to a different pixel format before it could be written; True, if so; False, if not
 		 * @param properties The properties to be used when writing the image, must be valid
+		 * @param worker Optional worker object to encode JPEG images in parallel strips, nullptr to encode the image with one thread; other image types ignore the worker
 		 * @return True, if succeeded
 		 * @see readImage().
 		 */
-		static bool writeImage(const Frame& frame, const std::string& filename, const bool allowConversion = true, bool* hasBeenConverted = nullptr, const Properties& properties = Properties());
+		static bool writeImage(const Frame& frame, const std::string& filename, const bool allowConversion = true, bool* hasBeenConverted = nullptr, const Properties& properties = Properties(), Worker* worker = nullptr);
 };
 
 }
@@ -157,7 +157,7 @@ Frame ImageJpg::decodeImage(const void* buffer, const size_t size)
 	return result;
 }
 
-bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffer, const bool allowConversion, bool* hasBeenConverted, const int quality)
+bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffer, const bool allowConversion, bool* hasBeenConverted, const int quality, Worker* worker)
 {
 	ocean_assert(frame);
 
@@ -224,10 +224,45 @@ bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffe
 		return false;
 	}
 
+	if (worker != nullptr && jpegPrecision == 8 && outputFrame->height() >= minimalStripRows_ * 2u)
+	{
+		// the restart interval is stored with 16 bits, the MCUs of a grayscale image are 8 pixels wide (the MCUs of color images are 16 pixels wide)
+
+		const unsigned int maximalMcusPerRow = (outputFrame->width() + 7u) / 8u;
+		const unsigned int maximalStripRows = (65535u / maximalMcusPerRow) * 8u / 16u * 16u;
+
+		unsigned int stripRows = (outputFrame->height() + worker->threads() - 1u) / worker->threads();
+		stripRows = std::min(std::max(minimalStripRows_, (stripRows + 15u) / 16u * 16u), maximalStripRows);
+
+		if (stripRows >= 16u && stripRows < outputFrame->height())
+		{
+			const unsigned int numberStrips = (outputFrame->height() + stripRows - 1u) / stripRows;
+
+			std::vector<std::vector<unsigned char>> stripBuffers(numberStrips);
+
+			worker->executeFunction(Worker::Function::createStatic(&ImageJpg::encodeStripsSubset, outputFrame, stripRows, jpegColorSpace, jpegNumberComponents, quality, stripBuffers.data(), 0u, 0u), 0u, numberStrips);
+
+			return concatenateStrips(stripBuffers, outputFrame->height(), buffer);
+		}
+	}
+
+	return encodeRows(*outputFrame, 0u, outputFrame->height(), 0u, jpegColorSpace, jpegNumberComponents, quality, buffer);
+}
+
+bool ImageJpg::encodeRows(const Frame& frame, const unsigned int firstRow, const unsigned int numberRows, const unsigned int restartRows, const int jpegColorSpace, const int jpegNumberComponents, const int quality, std::vector<unsigned char>& buffer)
+{
+	ocean_assert(frame.isValid());
+	ocean_assert(numberRows >= 1u && firstRow + numberRows <= frame.height());
+
 	struct ImageJpgErrorManagerStruct errorManager;
 	struct jpeg_compress_struct compressStruct = {};
 
+	// we need to create the output buffer before the setjump() function, otherwise the buffer will not be released in case of an error
+	unsigned char* outputBuffer = nullptr;
+	unsigned long outputSize = 0ul;
+
 	const ScopedFunctionVoid scopedDestroyCompressStructFunction(std::bind(&jpeg_destroy_compress, &compressStruct));
+	const ScopedFunctionVoid scopedReleaseOutputBufferFunction(std::bind(&ImageJpg::releaseOutputBuffer, &outputBuffer));
 
 	// first, we set our own error manager
 	compressStruct.err = jpeg_std_error(&errorManager.pub);
@@ -241,12 +276,10 @@ bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffe
 	// then, we create a compressor object
 	jpeg_create_compress(&compressStruct);
 
-	unsigned char* outputBuffer = nullptr;
-	unsigned long outputSize = 0ul;
 	jpeg_mem_dest(&compressStruct, &outputBuffer, &outputSize);
 
-	compressStruct.image_width = outputFrame->width();
-	compressStruct.image_height = outputFrame->height();
+	compressStruct.image_width = frame.width();
+	compressStruct.image_height = numberRows;
 	compressStruct.input_components = jpegNumberComponents;
 	compressStruct.in_color_space = J_COLOR_SPACE(jpegColorSpace);
 
@@ -254,15 +287,47 @@ bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffe
 
 	jpeg_set_quality(&compressStruct, quality, boolean(1));
 
+	if (restartRows != 0u)
+	{
+		// the restart interval is defined in MCUs and needs to cover entire MCU rows
+
+		int maximalHorizontalSamplingFactor = 1;
+		int maximalVerticalSamplingFactor = 1;
+
+		for (int n = 0; n < compressStruct.num_components; ++n)
+		{
+			maximalHorizontalSamplingFactor = std::max(maximalHorizontalSamplingFactor, compressStruct.comp_info[n].h_samp_factor);
+			maximalVerticalSamplingFactor = std::max(maximalVerticalSamplingFactor, compressStruct.comp_info[n].v_samp_factor);
+		}
+
+		const unsigned int mcuWidth = (unsigned int)(maximalHorizontalSamplingFactor) * (unsigned int)(DCTSIZE);
+		const unsigned int mcuHeight = compressStruct.num_components == 1 ? (unsigned int)(DCTSIZE) : (unsigned int)(maximalVerticalSamplingFactor) * (unsigned int)(DCTSIZE);
+
+		if (restartRows % mcuHeight != 0u)
+		{
+			return false;
+		}
+
+		const unsigned int mcusPerRow = compressStruct.num_components == 1 ? (frame.width() + DCTSIZE - 1u) / DCTSIZE : (frame.width() + mcuWidth - 1u) / mcuWidth;
+		const unsigned int restartInterval = mcusPerRow * (restartRows / mcuHeight);
+
+		if (restartInterval > 65535u)
+		{
+			return false;
+		}
+
+		compressStruct.restart_interval = restartInterval;
+	}
+
 	jpeg_start_compress(&compressStruct, boolean(1));
 
-	unsigned int yRow = 0u;
+	unsigned int yRow = firstRow;
 
 	while (compressStruct.next_scanline < compressStruct.image_height)
 	{
 		static_assert(std::is_same<JSAMPLE, uint8_t>::value, "Invalid data type!");
 
-		const uint8_t* outputRow = outputFrame->constrow<uint8_t>(yRow);
+		const uint8_t* outputRow = frame.constrow<uint8_t>(yRow);
 
 		jpeg_write_scanlines(&compressStruct, const_cast<uint8_t**>(&outputRow), 1);
 
@@ -274,11 +339,136 @@ bool ImageJpg::encodeImage(const Frame& frame, std::vector<unsigned char>& buffe
 	buffer.resize(outputSize);
 	memcpy(buffer.data(), outputBuffer, outputSize);
 
-	free(outputBuffer);
-
 	return true;
 }
 
+void ImageJpg::encodeStripsSubset(const Frame* frame, const unsigned int stripRows, const int jpegColorSpace, const int jpegNumberComponents, const int quality, std::vector<unsigned char>* stripBuffers, const unsigned int firstStrip, const unsigned int numberStrips)
+{
+	ocean_assert(frame != nullptr && frame->isValid());
+	ocean_assert(stripRows >= 1u && stripBuffers != nullptr);
+
+	for (unsigned int nStrip = firstStrip; nStrip < firstStrip + numberStrips; ++nStrip)
+	{
+		const unsigned int firstRow = nStrip * stripRows;
+		ocean_assert(firstRow < frame->height());
+
+		const unsigned int rows = std::min(stripRows, frame->height() - firstRow);
+
+		if (!encodeRows(*frame, firstRow, rows, stripRows, jpegColorSpace, jpegNumberComponents, quality, stripBuffers[nStrip]))
+		{
+			// an empty buffer indicates a failure
+			stripBuffers[nStrip].clear();
+		}
+	}
+}
+
+bool ImageJpg::concatenateStrips(const std::vector<std::vector<unsigned char>>& stripBuffers, const unsigned int height, std::vector<unsigned char>& buffer)
+{
+	ocean_assert(stripBuffers.size() >= 2);
+	ocean_assert(height >= 1u && height <= 65535u);
+
+	// each strip is a complete JPEG image; all strips have been encoded with identical tables and with a restart interval covering an entire strip
+	// so that the scan of the entire image is the concatenation of the entropy-coded segments of all strips, separated by restart markers
+
+	size_t totalSize = 0;
+	std::vector<size_t> headerSizes(stripBuffers.size(), 0);
+
+	for (size_t nStrip = 0; nStrip < stripBuffers.size(); ++nStrip)
+	{
+		const std::vector<unsigned char>& stripBuffer = stripBuffers[nStrip];
+
+		if (stripBuffer.size() < 4 || stripBuffer[0] != 0xFF || stripBuffer[1] != 0xD8 || stripBuffer[stripBuffer.size() - 2] != 0xFF || stripBuffer[stripBuffer.size() - 1] != 0xD9)
+		{
+			return false;
+		}
+
+		size_t position = 2;
+
+		while (headerSizes[nStrip] == 0)
+		{
+			if (position + 4 > stripBuffer.size() || stripBuffer[position] != 0xFF)
+			{
+				return false;
+			}
+
+			const unsigned char marker = stripBuffer[position + 1];
+			const size_t segmentSize = size_t(stripBuffer[position + 2]) << 8 | size_t(stripBuffer[position + 3]);
+
+			if (segmentSize < 2 || position + 2 + segmentSize > stripBuffer.size() - 2)
+			{
+				return false;
+			}
+
+			position += 2 + segmentSize;
+
+			if (marker == 0xDA)
+			{
+				// start of scan, the entropy-coded segment follows directly
+				headerSizes[nStrip] = position;
+			}
+		}
+
+		totalSize += stripBuffer.size();
+	}
+
+	buffer.clear();
+	buffer.reserve(totalSize);
+
+	for (size_t nStrip = 0; nStrip < stripBuffers.size(); ++nStrip)
+	{
+		const std::vector<unsigned char>& stripBuffer = stripBuffers[nStrip];
+
+		if (nStrip == 0)
+		{
+			buffer.insert(buffer.end(), stripBuffer.cbegin(), stripBuffer.cend() - 2);
+		}
+		else
+		{
+			buffer.emplace_back((unsigned char)(0xFF));
+			buffer.emplace_back((unsigned char)(0xD0 + (nStrip - 1) % 8));
+
+			buffer.insert(buffer.end(), stripBuffer.cbegin() + std::ptrdiff_t(headerSizes[nStrip]), stripBuffer.cend() - 2);
+		}
+	}
+
+	buffer.emplace_back((unsigned char)(0xFF));
+	buffer.emplace_back((unsigned char)(0xD9));
+
+	// finally, we replace the height of the first strip by the height of the entire image
+
+	size_t position = 2;
+
+	while (position + 7 <= headerSizes[0])
+	{
+		const unsigned char marker = buffer[position + 1];
+		const size_t segmentSize = size_t(buffer[position + 2]) << 8 | size_t(buffer[position + 3]);
+
+		if (marker >= 0xC0 && marker <= 0xC2)
+		{
+			buffer[position + 5] = (unsigned char)(height >> 8u);
+			buffer[position + 6] = (unsigned char)(height & 0xFFu);
+
+			return true;
+		}
+
+		position += 2 + segmentSize;
+	}
+
+	ocean_assert(false && "Missing start of frame segment!");
+	return false;
+}
+
+void ImageJpg::releaseOutputBuffer(unsigned char** outputBuffer)
+{
+	ocean_assert(outputBuffer != nullptr);
+
+	if (*outputBuffer != nullptr)
+	{
+		free(*outputBuffer);
+		*outputBuffer = nullptr;
+	}
+}
+
 FrameType::PixelFormat ImageJpg::translatePixelFormat(const int jpegColorSpace, const int jpegPrecision, const int jpegNumberComponents)
 {
 	switch (int64_t(jpegColorSpace) | (int64_t(jpegPrecision) << 32ll))
@@ -11,6 +11,7 @@
 #include "ocean/media/openimagelibraries/OpenImageLibraries.h"
 
 #include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_JPG
 
@@ -41,14 +42,17 @@ class OCEAN_MEDIA_OIL_EXPORT ImageJpg
 
 		/**
 		 * Encode a given frame as JPEG image to a resulting buffer.
+		 * Large frames can be encoded in parallel: the frame is separated into horizontal strips which are encoded concurrently and joined with restart markers afterwards.<br>
+		 * The resulting image is a standard baseline JPEG image with restart interval.
 		 * @param frame The frame to be written, must be valid
 		 * @param buffer The resulting buffer storing the binary information of the JPEG image
 		 * @param allowConversion True, to allow an internal conversion of the frame if JPEG does not support the given frame type; False, to prevent a conversion and to stop creating the buffer
 		 * @param hasBeenConverted Optional resulting statement whether the frame had to be converted to a different pixel format before it could be written; True, if so; False, if not
 		 * @param quality The JPEG compression quality to be used in percent, the higher the value the better the image quality (the larger the binary size), with range [0, 100]
+		 * @param worker Optional worker object to encode large frames in parallel, nullptr to encode the frame on the calling thread
 		 * @return True, if succeeded; False, if the frame could not be written as JPEG image
 		 */
-		static bool encodeImage(const Frame& frame, std::vector<unsigned char>& buffer, const bool allowConversion = true, bool* hasBeenConverted = nullptr, const int quality = 80);
+		static bool encodeImage(const Frame& frame, std::vector<unsigned char>& buffer, const bool allowConversion = true, bool* hasBeenConverted = nullptr, const int quality = 80, Worker* worker = nullptr);
 
 		/**
 		 * Returns whether a given pixel format is supported natively.
@@ -74,6 +78,49 @@ class OCEAN_MEDIA_OIL_EXPORT ImageJpg
 
 	protected:
 
+		/**
+		 * Encodes a block of rows of a frame as individual JPEG image.
+		 * @param frame The frame to be encoded, with pixel format and pixel origin supported natively, must be valid
+		 * @param firstRow The first row to be encoded, with range [0, frame.height() - 1]
+		 * @param numberRows The number of rows to be encoded, with range [1, frame.height() - firstRow]
+		 * @param restartRows The number of rows between two restart markers, must be a multiple of the height of one MCU, 0 to avoid restart markers
+		 * @param jpegColorSpace The color space of the frame defined by jpeglib
+		 * @param jpegNumberComponents The number of components per pixel, with range [1, infinity)
+		 * @param quality The JPEG compression quality to be used in percent, with range [0, 100]
+		 * @param buffer The resulting buffer storing the binary information of the JPEG image
+		 * @return True, if succeeded
+		 */
+		static bool encodeRows(const Frame& frame, const unsigned int firstRow, const unsigned int numberRows, const unsigned int restartRows, const int jpegColorSpace, const int jpegNumberComponents, const int quality, std::vector<unsigned char>& buffer);
+
+		/**
+		 * Encodes a subset of horizontal strips of a frame as individual JPEG images.
+		 * @param frame The frame to be encoded, with pixel format and pixel origin supported natively, must be valid
+		 * @param stripRows The number of rows of each strip (except the last strip), must be a multiple of 16
+		 * @param jpegColorSpace The color space of the frame defined by jpeglib
+		 * @param jpegNumberComponents The number of components per pixel, with range [1, infinity)
+		 * @param quality The JPEG compression quality to be used in percent, with range [0, 100]
+		 * @param stripBuffers The resulting buffers of all strips, an empty buffer if the strip could not be encoded, must be valid
+		 * @param firstStrip The first strip to be encoded
+		 * @param numberStrips The number of strips to be encoded
+		 */
+		static void encodeStripsSubset(const Frame* frame, const unsigned int stripRows, const int jpegColorSpace, const int jpegNumberComponents, const int quality, std::vector<unsigned char>* stripBuffers, const unsigned int firstStrip, const unsigned int numberStrips);
+
+		/**
+		 * Joins individually encoded strips to one JPEG image.
+		 * All strips must have been encoded with identical settings and with a restart interval matching the rows of one strip.
+		 * @param stripBuffers The JPEG images of all strips, at least two
+		 * @param height The height of the entire image in pixel, with range [1, 65535]
+		 * @param buffer The resulting buffer storing the binary information of the joined JPEG image
+		 * @return True, if succeeded
+		 */
+		static bool concatenateStrips(const std::vector<std::vector<unsigned char>>& stripBuffers, const unsigned int height, std::vector<unsigned char>& buffer);
+
+		/**
+		 * Releases the output buffer allocated by jpeglib.
+		 * @param outputBuffer The pointer to the output buffer to be released, must be valid
+		 */
+		static void releaseOutputBuffer(unsigned char** outputBuffer);
+
 		/**
 		 * Translates a JPEG pixel format defined by the color space, the component precision and the number of components.
 		 * @param jpegColorSpace The color space defined by jpeglib
@@ -92,6 +139,11 @@ class OCEAN_MEDIA_OIL_EXPORT ImageJpg
 		 * @return True, if the Ocean-based pixel format has a equivalent JPEG format; False, if the pixel format cannot be represented in JPEG
 		 */
 		static bool translatePixelFormat(const FrameType::PixelFormat pixelFormat, int& jpegColorSpace, int& jpegPrecision, int& jpegNumberComponents);
+
+	protected:
+
+		/// The minimal number of rows of one strip when encoding a frame in parallel, a multiple of 16.
+		static constexpr unsigned int minimalStripRows_ = 128u;
 };
 
 inline bool ImageJpg::isPixelFormatSupported(const FrameType::PixelFormat pixelFormat)
@@ -29,7 +29,12 @@ OILImageRecorder::~OILImageRecorder()
 
 bool OILImageRecorder::saveImage(const Frame& frame, const std::string& filename)
 {
-	return Image::writeImage(frame, filename);
+	return saveImage(frame, filename, nullptr);
+}
+
+bool OILImageRecorder::saveImage(const Frame& frame, const std::string& filename, Worker* worker)
+{
+	return Image::writeImage(frame, filename, true, nullptr, Image::Properties(), worker);
 }
 
 OILImageRecorder::Encoders OILImageRecorder::frameEncoders() const
@@ -10,6 +10,8 @@
 
 #include "ocean/media/openimagelibraries/OpenImageLibraries.h"
 
+#include "ocean/base/Worker.h"
+
 #include "ocean/media/ImageRecorder.h"
 
 namespace Ocean
@@ -39,6 +41,16 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageRecorder : virtual public ImageRecorder
 		 */
 		bool saveImage(const Frame& frame, const std::string& filename) override;
 
+		/**
+		 * Saves a given frame as file while an optional worker is used to encode the image.
+		 * @param frame The frame to be saved, must be valid
+		 * @param filename The name of the file to which the frame will be saved, must contain a valid image extension
+		 * @param worker Optional worker object to encode JPEG images in parallel strips, nullptr to encode the image with one thread
+		 * @return True, if succeeded
+		 * @see Image::writeImage().
+		 */
+		bool saveImage(const Frame& frame, const std::string& filename, Worker* worker);
+
 		/**
 		 * Returns a list of possible frame encoders for this recorder.
 		 * @see FrameRecorder::frameEncoders().
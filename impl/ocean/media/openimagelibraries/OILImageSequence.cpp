@@ -32,7 +32,9 @@ OILImageSequence::OILImageSequence(const std::string& url) :
 
 OILImageSequence::~OILImageSequence()
 {
-	// nothing to do here
+	stopThreadExplicitly();
+
+	releasePrefetching();
 }
 
 MediumRef OILImageSequence::clone() const
@@ -69,6 +71,13 @@ bool OILImageSequence::loadImage(const std::string& filename, const Timestamp ti
 	return deliverNewFrame(std::move(result));
 }
 
+bool OILImageSequence::supportsConcurrentLoading() const
+{
+	// decoding is stateless, images can be decoded on several threads concurrently
+
+	return true;
+}
+
 }
 
 }
@@ -55,6 +55,12 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequence : virtual public ImageFileSequence
 		 * @see ImageSequence::loadImage().
 		 */
 		bool loadImage(const std::string& filename, const Timestamp timestamp, Frame* frame = nullptr) override;
+
+		/**
+		 * Returns whether images can be loaded concurrently.
+		 * @see ImageFileSequence::supportsConcurrentLoading().
+		 */
+		bool supportsConcurrentLoading() const override;
 };
 
 }
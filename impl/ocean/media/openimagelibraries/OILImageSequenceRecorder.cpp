@@ -6,9 +6,12 @@
  */
 
 #include "ocean/media/openimagelibraries/OILImageSequenceRecorder.h"
+#include "ocean/media/openimagelibraries/Image.h"
 
 #include "ocean/base/DateTime.h"
+#include "ocean/base/Processor.h"
 #include "ocean/base/String.h"
+#include "ocean/base/WorkerPool.h"
 
 #include "ocean/io/File.h"
 
@@ -28,7 +31,11 @@ OILImageSequenceRecorder::OILImageSequenceRecorder()
 
 OILImageSequenceRecorder::~OILImageSequenceRecorder()
 {
-	stopThreadExplicitly();
+	// the destructor of the pool drops all functions which have not been started yet, so we have to wait until all images have been saved
+
+	waitForEncodingImages();
+
+	encoderThreadPool_ = nullptr;
 }
 
 OILImageSequenceRecorder::RecorderMode OILImageSequenceRecorder::mode() const
@@ -40,7 +47,7 @@ unsigned int OILImageSequenceRecorder::pendingImages() const
 {
 	const ScopedLock scopedLock(frameQueueLock_);
 
-	return (unsigned int)(frameQueue_.size());
+	return (unsigned int)(pendingParallelImages());
 }
 
 OILImageSequenceRecorder::Encoders OILImageSequenceRecorder::frameEncoders() const
@@ -89,6 +96,39 @@ bool OILImageSequenceRecorder::setStartIndex(const unsigned int index)
 	return ImageSequenceRecorder::setStartIndex(index);
 }
 
+bool OILImageSequenceRecorder::setEncoderThreads(const unsigned int threads)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (isRecording_)
+	{
+		return false;
+	}
+
+	encoderThreads_ = threads;
+
+	return true;
+}
+
+bool OILImageSequenceRecorder::setMaximalPendingImages(const unsigned int images)
+{
+	if (images == 0u)
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (isRecording_)
+	{
+		return false;
+	}
+
+	maximalPendingImages_ = images;
+
+	return true;
+}
+
 bool OILImageSequenceRecorder::addImage(const Frame& frame)
 {
 	if (!frame.isValid())
@@ -101,13 +141,41 @@ bool OILImageSequenceRecorder::addImage(const Frame& frame)
 		return false;
 	}
 
-	const FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA));
+	if (recorderMode_ == RM_PARALLEL)
+	{
+		// the number of pending images is bounded, so we wait until an encoder thread has saved an image
+
+		TemporaryScopedLock scopedLockQueue(frameQueueLock_);
+
+		while (pendingParallelImages() >= size_t(maximalPendingImages_))
+		{
+			scopedLockQueue.release();
+
+			imageSavedSignal_.wait();
+
+			if (!isRecording())
+			{
+				return false;
+			}
+
+			scopedLockQueue.relock(frameQueueLock_);
+		}
+
+		// we reserve the slot of the image before the lock is released
+		++encodingImages_;
+	}
+
+	FrameRef frameRef(new Frame(frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA));
 
 	const ScopedLock scopedLock(lock_);
 
 	if (recorderMode_ == RM_IMMEDIATE)
 	{
-		imageRecorder_.saveImage(*frameRef, addOptionalSuffixToFilename(filename_, frameCounter_ + startIndex_, filenameSuffixed_));
+		saveImageImmediately(*frameRef, frameCounter_);
+	}
+	else if (recorderMode_ == RM_PARALLEL)
+	{
+		invokeEncoderThread(std::move(frameRef), frameCounter_);
 	}
 	else
 	{
@@ -134,17 +202,36 @@ bool OILImageSequenceRecorder::start()
 		return false;
 	}
 
+	// images of a previous recording may still be saved, we have to wait until they have been written before the frame indices can be reset
+
+	waitForEncodingImages();
+
+	TemporaryScopedLock scopedLockQueue(frameQueueLock_);
+
 	frameCounter_ = 0u;
 	while (!frameQueue_.empty())
 	{
 		frameQueue_.pop();
 	}
 
+	scopedLockQueue.release();
+
 	startTimestamp_.toNow();
 
-	if (recorderMode_ == RM_PARALLEL && !isThreadInvokedToStart())
+	if (recorderMode_ == RM_PARALLEL)
 	{
-		startThread();
+		if (!encoderThreadPool_)
+		{
+			encoderThreadPool_ = std::make_unique<ThreadPool>();
+		}
+
+		const unsigned int encoderThreads = encoderThreads_ != 0u ? encoderThreads_ : std::max(1u, Processor::get().cores());
+
+		if (!encoderThreadPool_->setCapacity(size_t(encoderThreads)))
+		{
+			ocean_assert(false && "This should never happen!");
+			return false;
+		}
 	}
 
 	isRecording_ = true;
@@ -161,6 +248,11 @@ bool OILImageSequenceRecorder::stop()
 	}
 
 	isRecording_ = false;
+
+	// the recording is stopped once all pending images have been written
+
+	waitForEncodingImages();
+
 	return true;
 }
 
@@ -178,8 +270,6 @@ bool OILImageSequenceRecorder::forceSaving()
 		return false;
 	}
 
-	ocean_assert(!isThreadActive() || !isThreadInvokedToStart());
-
 	const ScopedLock scopedLockQueue(frameQueueLock_);
 
 	bool result = true;
@@ -190,7 +280,7 @@ bool OILImageSequenceRecorder::forceSaving()
 		const unsigned int frameIndex = frameQueue_.front().second;
 		frameQueue_.pop();
 
-		result = imageRecorder_.saveImage(*frame, addOptionalSuffixToFilename(filename_, frameIndex + startIndex_, filenameSuffixed_)) && result;
+		result = saveImageImmediately(*frame, frameIndex) && result;
 	}
 
 	return result;
@@ -210,6 +300,18 @@ bool OILImageSequenceRecorder::lockBufferToFill(Frame& recorderFrame, const bool
 		return false;
 	}
 
+	if (recorderMode_ == RM_PARALLEL)
+	{
+		// the number of pending images is bounded, the frame is skipped if the encoder threads cannot keep up
+
+		const ScopedLock scopedLockQueue(frameQueueLock_);
+
+		if (pendingParallelImages() >= size_t(maximalPendingImages_))
+		{
+			return false;
+		}
+	}
+
 	if (respectFrameFrequency)
 	{
 		ocean_assert(startTimestamp_.isValid());
@@ -245,7 +347,18 @@ void OILImageSequenceRecorder::unlockBufferToFill()
 
 	if (recorderMode_ == RM_IMMEDIATE)
 	{
-		imageRecorder_.saveImage(frame_, addOptionalSuffixToFilename(filename_, frameCounter_ + startIndex_, filenameSuffixed_));
+		saveImageImmediately(frame_, frameCounter_);
+	}
+	else if (recorderMode_ == RM_PARALLEL)
+	{
+		{
+			// lockBufferToFill() has ensured that a slot is available
+
+			const ScopedLock scopedLockQueue(frameQueueLock_);
+			++encodingImages_;
+		}
+
+		invokeEncoderThread(FrameRef(new Frame(std::move(frame_))), frameCounter_);
 	}
 	else
 	{
@@ -258,34 +371,66 @@ void OILImageSequenceRecorder::unlockBufferToFill()
 	frame_.release();
 }
 
-void OILImageSequenceRecorder::threadRun()
+bool OILImageSequenceRecorder::saveImageImmediately(const Frame& frame, const unsigned int frameIndex)
+{
+	ocean_assert(frame.isValid());
+
+	// large frames are encoded in parallel strips, as the images are saved in the thread of the caller
+
+	return imageRecorder_.saveImage(frame, addOptionalSuffixToFilename(filename_, frameIndex + startIndex_, filenameSuffixed_), WorkerPool::get().conditionalScopedWorker(frame.pixels() >= 1920u * 1080u)());
+}
+
+void OILImageSequenceRecorder::invokeEncoderThread(FrameRef&& frame, const unsigned int frameIndex)
 {
-	while (!shouldThreadStop())
+	ocean_assert(frame);
+	ocean_assert(encoderThreadPool_);
+
+	std::string filename = addOptionalSuffixToFilename(filename_, frameIndex + startIndex_, filenameSuffixed_);
+
+	encoderThreadPool_->invoke([this, frame = std::move(frame), filename = std::move(filename)]()
 	{
-		FrameRef frame;
-		unsigned int frameIndex = (unsigned int)(-1);
+		saveImageInEncoderThread(*frame, filename);
+	});
+}
 
-		TemporaryScopedLock scopedLock(frameQueueLock_);
+void OILImageSequenceRecorder::waitForEncodingImages()
+{
+	TemporaryScopedLock scopedLockQueue(frameQueueLock_);
 
-		if (!frameQueue_.empty())
-		{
-			frame = frameQueue_.front().first;
-			frameIndex = frameQueue_.front().second;
-			frameQueue_.pop();
-		}
+	if (encodingImages_ == 0u)
+	{
+		return;
+	}
 
-		scopedLock.release();
+	while (encodingImages_ != 0u)
+	{
+		scopedLockQueue.release();
+		imageSavedSignal_.wait();
+		scopedLockQueue.relock(frameQueueLock_);
+	}
 
-		if (frame)
-		{
-			ocean_assert(frameIndex != (unsigned int)(-1));
-			imageRecorder_.saveImage(*frame, addOptionalSuffixToFilename(filename_, frameIndex + startIndex_, filenameSuffixed_));
-		}
-		else
-		{
-			sleep(1);
-		}
+	scopedLockQueue.release();
+
+	// the signal is pulsed again, as other threads (e.g., in addImage()) may wait for the signal as well
+
+	imageSavedSignal_.pulse();
+}
+
+void OILImageSequenceRecorder::saveImageInEncoderThread(const Frame& frame, const std::string& filename)
+{
+	// the encoder threads already run in parallel, so that the images are encoded without an additional worker
+
+	if (!imageRecorder_.saveImage(frame, filename, nullptr))
+	{
+		Log::warning() << "Could not save image file \"" << filename << "\"";
 	}
+
+	const ScopedLock scopedLock(frameQueueLock_);
+
+	ocean_assert(encodingImages_ != 0u);
+	--encodingImages_;
+
+	imageSavedSignal_.pulse();
 }
 
 }
@@ -13,7 +13,8 @@
 
 #include "ocean/media/ImageSequenceRecorder.h"
 
-#include "ocean/base/Thread.h"
+#include "ocean/base/Signal.h"
+#include "ocean/base/ThreadPool.h"
 
 #include <queue>
 
@@ -28,11 +29,11 @@ namespace OpenImageLibraries
 
 /**
  * This class implements an OpenImageLibraries image sequence recorder.
+ * In RM_PARALLEL mode, images are encoded and written asynchronously by a pool of encoder threads.<br>
+ * The number of pending images is bounded, see setMaximalPendingImages().
  * @ingroup mediaoil
  */
-class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
-	public ImageSequenceRecorder,
-	public Thread
+class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder : public ImageSequenceRecorder
 {
 	friend class OILLibrary;
 
@@ -75,6 +76,22 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		 */
 		bool setStartIndex(const unsigned int index) override;
 
+		/**
+		 * Sets the number of threads encoding images concurrently in RM_PARALLEL mode.
+		 * The number of threads cannot be changed while the recorder is recording.
+		 * @param threads The number of encoder threads, with range [1, infinity), 0 to use one thread for each CPU core
+		 * @return True, if succeeded
+		 */
+		bool setEncoderThreads(const unsigned int threads);
+
+		/**
+		 * Sets the maximal number of images which are waiting to be encoded or to be written in RM_PARALLEL mode.
+		 * Once the limit is reached, addImage() waits until a pending image has been written and lockBufferToFill() does not provide a buffer.
+		 * @param images The maximal number of pending images, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		bool setMaximalPendingImages(const unsigned int images);
+
 		/**
 		 * Adds a given frame explicity.
 		 * @see ImageSequenceRecorder::addImage().
@@ -130,10 +147,40 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		~OILImageSequenceRecorder() override;
 
 		/**
-		 * Thread run function.
-		 * @see Thread::threadRun().
+		 * Saves one image in the thread of the caller, large JPEG images are encoded with the worker pool.
+		 * @param frame The image to be saved, must be valid
+		 * @param frameIndex The index of the image, without start index
+		 * @return True, if succeeded
+		 */
+		bool saveImageImmediately(const Frame& frame, const unsigned int frameIndex);
+
+		/**
+		 * Hands one image over to the encoder threads.
+		 * The slot of the image must have been reserved in 'encodingImages_' before.
+		 * @param frame The image to be saved, must be valid
+		 * @param frameIndex The index of the image, without start index
+		 */
+		void invokeEncoderThread(FrameRef&& frame, const unsigned int frameIndex);
+
+		/**
+		 * Waits until all images which have been handed over to the encoder threads have been saved.
+		 * The frame queue lock must not be locked by the caller.
+		 */
+		void waitForEncodingImages();
+
+		/**
+		 * Saves one image, this function is executed by the encoder threads.
+		 * @param frame The image to be saved, must be valid
+		 * @param filename The name of the image's file, the extension defines the image type, must be valid
 		 */
-		void threadRun() override;
+		void saveImageInEncoderThread(const Frame& frame, const std::string& filename);
+
+		/**
+		 * Returns the number of pending images in RM_PARALLEL mode.
+		 * The frame queue lock must be locked before calling this function.
+		 * @return The number of images which are queued or saved by the encoder threads
+		 */
+		inline size_t pendingParallelImages() const;
 
 	protected:
 
@@ -155,10 +202,30 @@ class OCEAN_MEDIA_OIL_EXPORT OILImageSequenceRecorder :
 		/// State determining whether the recorder is currently recording.
 		bool isRecording_ = false;
 
+		/// The pool of threads encoding the images in RM_PARALLEL mode.
+		std::unique_ptr<ThreadPool> encoderThreadPool_;
+
+		/// The number of encoder threads, 0 to use one thread for each CPU core.
+		unsigned int encoderThreads_ = 0u;
+
+		/// The maximal number of pending images in RM_PARALLEL mode.
+		unsigned int maximalPendingImages_ = 16u;
+
+		/// The number of images which have been handed over to the encoder threads and which have not yet been saved.
+		unsigned int encodingImages_ = 0u;
+
+		/// The signal which is pulsed whenever an encoder thread has saved an image.
+		Signal imageSavedSignal_;
+
 		/// Frame queue lock.
 		mutable Lock frameQueueLock_;
 };
 
+inline size_t OILImageSequenceRecorder::pendingParallelImages() const
+{
+	return frameQueue_.size() + size_t(encodingImages_);
+}
+
 }
 
 }
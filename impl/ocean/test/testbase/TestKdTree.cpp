@@ -11,6 +11,7 @@
 #include "ocean/base/KdTree.h"
 #include "ocean/base/Timestamp.h"
 #include "ocean/base/Utilities.h"
+#include "ocean/base/WorkerPool.h"
 #include "ocean/math/Numeric.h"
 #include "ocean/math/Random.h"
 
@@ -71,6 +72,42 @@ bool TestKdTree::test(const double testDuration, const TestSelector& selector)
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("nearestneighbors<double>"))
+	{
+		testResult = testNearestNeighbors<double>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("nearestneighbors<float>"))
+	{
+		testResult = testNearestNeighbors<float>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("batchsearch<double>"))
+	{
+		testResult = testBatchSearch<double>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("batchsearch<float>"))
+	{
+		testResult = testBatchSearch<float>(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -98,6 +135,26 @@ TEST(TestKdTree, RadiusSearchInteger_Float)
 	EXPECT_TRUE(TestKdTree::testRadiusSearchInteger<float>(GTEST_TEST_DURATION));
 }
 
+TEST(TestKdTree, NearestNeighbors_Double)
+{
+	EXPECT_TRUE(TestKdTree::testNearestNeighbors<double>(GTEST_TEST_DURATION));
+}
+
+TEST(TestKdTree, NearestNeighbors_Float)
+{
+	EXPECT_TRUE(TestKdTree::testNearestNeighbors<float>(GTEST_TEST_DURATION));
+}
+
+TEST(TestKdTree, BatchSearch_Double)
+{
+	EXPECT_TRUE(TestKdTree::testBatchSearch<double>(GTEST_TEST_DURATION));
+}
+
+TEST(TestKdTree, BatchSearch_Float)
+{
+	EXPECT_TRUE(TestKdTree::testBatchSearch<float>(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 template<typename T>
@@ -657,6 +714,246 @@ bool TestKdTree::testRadiusSearchInteger(const unsigned int number, const unsign
 	return validation.succeeded();
 }
 
+
+template <typename T>
+bool TestKdTree::testNearestNeighbors(const double testDuration)
+{
+	static_assert(std::is_same<float, T>::value || std::is_same<double, T>::value, "T must be float or double");
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "K-nearest neighbors test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int number = RandomI::random(randomGenerator, 1u, 2000u);
+		const unsigned int dimension = RandomI::random(randomGenerator, 1u, 64u);
+		const unsigned int maximalLeafSize = RandomI::random(randomGenerator, 1u, KdTree<T>::maximalLeafSizeLimit_);
+
+		std::vector<T> elements(number * dimension);
+
+		for (T& element : elements)
+		{
+			element = RandomT<T>::scalar(randomGenerator, T(-1.0), T(1.0));
+		}
+
+		// some values are identical
+
+		for (unsigned int n = 0u; n < number / 10u; ++n)
+		{
+			const unsigned int source = RandomI::random(randomGenerator, number - 1u);
+			const unsigned int target = RandomI::random(randomGenerator, number - 1u);
+
+			std::copy(elements.data() + source * dimension, elements.data() + (source + 1u) * dimension, elements.data() + target * dimension);
+		}
+
+		KdTree<T> kdTree(dimension, maximalLeafSize);
+		OCEAN_EXPECT_TRUE(validation, kdTree.insert(elements.data(), number));
+
+		OCEAN_EXPECT_EQUAL(validation, kdTree.size(), size_t(number));
+
+		std::vector<T> value(dimension);
+
+		for (unsigned int nQuery = 0u; nQuery < 20u; ++nQuery)
+		{
+			for (T& element : value)
+			{
+				element = RandomT<T>::scalar(randomGenerator, T(-1.0), T(1.0));
+			}
+
+			const size_t k = size_t(RandomI::random(randomGenerator, 1u, 50u));
+
+			std::vector<const T*> neighbors(k, nullptr);
+			std::vector<T> sqrDistances(k, T(-1));
+
+			const size_t foundNeighbors = kdTree.nearestNeighbors(value.data(), k, neighbors.data(), sqrDistances.data());
+
+			OCEAN_EXPECT_EQUAL(validation, foundNeighbors, std::min(k, size_t(number)));
+
+			std::vector<T> bruteForceSqrDistances;
+			bruteForceSqrDistances.reserve(number);
+
+			for (unsigned int n = 0u; n < number; ++n)
+			{
+				T ssd = 0;
+
+				for (unsigned int d = 0u; d < dimension; ++d)
+				{
+					ssd += sqr(elements[n * dimension + d] - value[d]);
+				}
+
+				bruteForceSqrDistances.emplace_back(ssd);
+			}
+
+			std::sort(bruteForceSqrDistances.begin(), bruteForceSqrDistances.end());
+
+			std::unordered_set<const T*> seenNeighbors;
+
+			for (size_t n = 0; n < std::min(foundNeighbors, k); ++n)
+			{
+				const T* neighbor = neighbors[n];
+
+				if (neighbor < elements.data() || neighbor >= elements.data() + number * dimension || ((neighbor - elements.data()) % dimension) != 0)
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+
+				if (!seenNeighbors.insert(neighbor).second)
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				T ssd = 0;
+
+				for (unsigned int d = 0u; d < dimension; ++d)
+				{
+					ssd += sqr(neighbor[d] - value[d]);
+				}
+
+				// the distances are determined in the same order, so that we can expect identical results
+
+				OCEAN_EXPECT_EQUAL(validation, sqrDistances[n], ssd);
+				OCEAN_EXPECT_EQUAL(validation, sqrDistances[n], bruteForceSqrDistances[n]);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+template <typename T>
+bool TestKdTree::testBatchSearch(const double testDuration)
+{
+	static_assert(std::is_same<float, T>::value || std::is_same<double, T>::value, "T must be float or double");
+	ocean_assert(testDuration > 0.0);
+
+#ifdef OCEAN_DEBUG
+	constexpr unsigned int benchmarkNumber = 10000u;
+	constexpr unsigned int benchmarkQueries = 1000u;
+#else
+	constexpr unsigned int benchmarkNumber = 100000u;
+	constexpr unsigned int benchmarkQueries = 10000u;
+#endif
+
+	constexpr unsigned int benchmarkDimension = 3u;
+
+	Log::info() << "Batch search test, with " << String::insertCharacter(String::toAString(benchmarkNumber), ',', 3, false) << " elements and " << String::insertCharacter(String::toAString(benchmarkQueries), ',', 3, false) << " queries for performance:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSingleCore;
+	HighPerformanceStatistic performanceMultiCore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool benchmarkIteration : {false, true})
+		{
+			const unsigned int number = benchmarkIteration ? benchmarkNumber : RandomI::random(randomGenerator, 1u, 5000u);
+			const unsigned int dimension = benchmarkIteration ? benchmarkDimension : RandomI::random(randomGenerator, 1u, 10u);
+			const unsigned int numberQueries = benchmarkIteration ? benchmarkQueries : RandomI::random(randomGenerator, 1u, 1000u);
+			const size_t k = benchmarkIteration ? size_t(8) : size_t(RandomI::random(randomGenerator, 1u, 20u));
+
+			std::vector<T> elements(number * dimension);
+
+			for (T& element : elements)
+			{
+				element = RandomT<T>::scalar(randomGenerator, T(-1.0), T(1.0));
+			}
+
+			std::vector<T> queries(numberQueries * dimension);
+
+			for (T& element : queries)
+			{
+				element = RandomT<T>::scalar(randomGenerator, T(-1.0), T(1.0));
+			}
+
+			KdTree<T> kdTree(dimension);
+			OCEAN_EXPECT_TRUE(validation, kdTree.insert(elements.data(), number));
+
+			for (const unsigned int workerIteration : {0u, 1u})
+			{
+				Worker* worker = workerIteration == 0u ? nullptr : WorkerPool::get().scopedWorker()();
+
+				HighPerformanceStatistic& performance = worker == nullptr ? performanceSingleCore : performanceMultiCore;
+
+				std::vector<const T*> neighbors(numberQueries * k);
+				std::vector<T> sqrDistances(numberQueries * k);
+
+				performance.startIf(benchmarkIteration);
+					kdTree.nearestNeighbors(queries.data(), numberQueries, k, neighbors.data(), sqrDistances.data(), worker);
+				performance.stopIf(benchmarkIteration);
+
+				const T radius = T(0.01);
+
+				typename KdTree<T>::PointersGroups neighborsGroups;
+				kdTree.radiusSearch(queries.data(), numberQueries, radius, neighborsGroups, worker);
+
+				OCEAN_EXPECT_EQUAL(validation, neighborsGroups.size(), size_t(numberQueries));
+
+				std::vector<const T*> singleNeighbors(std::max(k, size_t(number)));
+				std::vector<T> singleSqrDistances(k);
+
+				for (unsigned int nQuery = 0u; nQuery < numberQueries; ++nQuery)
+				{
+					const T* query = queries.data() + nQuery * dimension;
+
+					const size_t foundNeighbors = kdTree.nearestNeighbors(query, k, singleNeighbors.data(), singleSqrDistances.data());
+
+					for (size_t n = 0; n < k; ++n)
+					{
+						if (n < foundNeighbors)
+						{
+							OCEAN_EXPECT_EQUAL(validation, neighbors[nQuery * k + n], singleNeighbors[n]);
+							OCEAN_EXPECT_EQUAL(validation, sqrDistances[nQuery * k + n], singleSqrDistances[n]);
+						}
+						else
+						{
+							OCEAN_EXPECT_EQUAL(validation, neighbors[nQuery * k + n], (const T*)(nullptr));
+						}
+					}
+
+					if (nQuery < neighborsGroups.size())
+					{
+						const size_t foundRadiusNeighbors = kdTree.radiusSearch(query, radius, singleNeighbors.data(), singleNeighbors.size());
+
+						std::vector<const T*> sortedNeighbors(singleNeighbors.cbegin(), singleNeighbors.cbegin() + foundRadiusNeighbors);
+						std::vector<const T*> sortedGroup(neighborsGroups[nQuery]);
+
+						std::sort(sortedNeighbors.begin(), sortedNeighbors.end());
+						std::sort(sortedGroup.begin(), sortedGroup.end());
+
+						OCEAN_EXPECT_TRUE(validation, sortedNeighbors == sortedGroup);
+					}
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Singlecore performance: " << performanceSingleCore;
+	Log::info() << "Multicore performance: " << performanceMultiCore;
+
+	if (performanceMultiCore.averageMseconds() > 0)
+	{
+		Log::info() << "Multicore boost factor: Average: " << String::toAString(performanceSingleCore.averageMseconds() / performanceMultiCore.averageMseconds(), 2u) << "x";
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 }
 
 }
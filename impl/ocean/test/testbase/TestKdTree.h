@@ -54,6 +54,24 @@ class OCEAN_TEST_BASE_EXPORT TestKdTree
 		template<typename T>
 		static bool testRadiusSearchInteger(const double testDuration);
 
+		/**
+		 * Tests the k-nearest neighbors search function.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T Scalar type used internally (can be `float` or `double`)
+		 */
+		template<typename T>
+		static bool testNearestNeighbors(const double testDuration);
+
+		/**
+		 * Tests the search functions for several values at once.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 * @tparam T Scalar type used internally (can be `float` or `double`)
+		 */
+		template<typename T>
+		static bool testBatchSearch(const double testDuration);
+
 	private:
 
 		/**
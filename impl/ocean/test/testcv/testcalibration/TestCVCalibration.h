@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TESTCVCALIBRATION_H
+#define META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TESTCVCALIBRATION_H
+
+#include "ocean/test/testcv/TestCV.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestCalibration
+{
+
+/**
+ * @ingroup testcv
+ * @defgroup testcvcalibration Ocean Test CV Calibration Library
+ * @{
+ * The Ocean Test CV Calibration Library provides several function to test the performance and validation of the computer vision calibration functionalities.
+ * The library is platform independent.
+ * @}
+ */
+
+/**
+ * @namespace Ocean::Test::TestCV::TestCalibration Namespace of the CV Calibration Test library.<p>
+ * The Namespace Ocean::Test::TestCV::TestCalibration is used in the entire Ocean CV Calibration Test Library.
+ */
+
+// Defines OCEAN_TEST_CV_CALIBRATION_EXPORT for dll export and import.
+#if defined(_WINDOWS) && defined(OCEAN_RUNTIME_SHARED)
+	#ifdef USE_OCEAN_TEST_CV_CALIBRATION_EXPORT
+		#define OCEAN_TEST_CV_CALIBRATION_EXPORT __declspec(dllexport)
+	#else
+		#define OCEAN_TEST_CV_CALIBRATION_EXPORT __declspec(dllimport)
+	#endif
+#else
+	#define OCEAN_TEST_CV_CALIBRATION_EXPORT
+#endif
+
+/**
+ * Tests the entire Computer Vision Calibration library.
+ * @param testDuration Number of seconds for each test, with range (0, infinity)
+ * @param worker The worker object to distribute some computation on as many CPU cores as defined in the worker object
+ * @param testFunctions Optional name of the functions to be tested
+ * @return True, if the entire test succeeded
+ * @ingroup testcvcalibration
+ */
+OCEAN_TEST_CV_CALIBRATION_EXPORT bool testCVCalibration(const double testDuration, Worker& worker, const std::string& testFunctions = std::string());
+
+/**
+ * Tests the entire Computer Vision Calibration library.
+ * This function returns directly as the actual test is invoked in an own thread.<br>
+ * Use this function in intendet for non-console applications like e.g., mobile devices.
+ * @param testDuration Number of seconds for each test, with range (0, infinity)
+ * @param testFunctions Optional name of the functions to be tested
+ * @ingroup testcvcalibration
+ */
+OCEAN_TEST_CV_CALIBRATION_EXPORT void testCVCalibrationAsynchron(const double testDuration, const std::string& testFunctions = std::string());
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TESTCVCALIBRATION_H
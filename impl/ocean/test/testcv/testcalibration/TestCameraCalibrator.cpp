@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/testcalibration/TestCameraCalibrator.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/calibration/CameraCalibrator.h"
+
+#include "ocean/math/Random.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestCalibration
+{
+
+using namespace CV::Calibration;
+
+bool TestCameraCalibrator::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("CameraCalibrator test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("handleimages"))
+	{
+		testResult = testHandleImages(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("removeredundantobservations"))
+	{
+		testResult = testRemoveRedundantObservations(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestCameraCalibrator, HandleImages)
+{
+	Worker worker;
+	EXPECT_TRUE(TestCameraCalibrator::testHandleImages(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestCameraCalibrator, RemoveRedundantObservations)
+{
+	Worker worker;
+	EXPECT_TRUE(TestCameraCalibrator::testRemoveRedundantObservations(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestCameraCalibrator::testHandleImages(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Handle images test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const AnyCameraPinhole anyCamera(PinholeCamera(640u, 480u, Numeric::deg2rad(Scalar(60))));
+
+	size_t renderedBoards = 0;
+	size_t detectedBoards = 0;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the board is larger than the field of view of the camera, as the calibrator expects that not all markers are visible
+
+		CalibrationBoard calibrationBoard;
+		if (!CalibrationBoard::createCalibrationBoard(RandomI::random(randomGenerator, 100u), 9, 13, calibrationBoard))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const MetricCalibrationBoard metricCalibrationBoard(std::move(calibrationBoard), MetricSize(45.0 * 9.2, MetricSize::UT_MILLIMETER), MetricSize(45.0 * 13.2, MetricSize::UT_MILLIMETER));
+
+		// some images do not show the calibration board at all
+
+		const size_t numberImages = size_t(RandomI::random(randomGenerator, 2u, 4u));
+
+		Frames frames(numberImages);
+		std::vector<size_t> imageIds(numberImages);
+
+		for (size_t nImage = 0; nImage < numberImages; ++nImage)
+		{
+			imageIds[nImage] = nImage * 3 + 100;
+
+			if (RandomI::random(randomGenerator, 3u) == 0u)
+			{
+				frames[nImage].set(FrameType(anyCamera.width(), anyCamera.height(), FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), true /*forceOwner*/, true /*forceWritable*/);
+				frames[nImage].setValue(0xFFu);
+			}
+			else
+			{
+				if (!renderBoard(anyCamera, metricCalibrationBoard, randomCameraPose(metricCalibrationBoard, randomGenerator), frames[nImage]))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				++renderedBoards;
+			}
+		}
+
+		CameraCalibrator sequentialCalibrator(metricCalibrationBoard);
+
+		std::vector<CameraCalibrator::ImageResult> sequentialImageResults;
+		sequentialImageResults.reserve(numberImages);
+
+		for (size_t nImage = 0; nImage < numberImages; ++nImage)
+		{
+			sequentialImageResults.emplace_back(sequentialCalibrator.handleImage(imageIds[nImage], frames[nImage]));
+		}
+
+		CameraCalibrator parallelCalibrator(metricCalibrationBoard);
+
+		std::vector<CameraCalibrator::ImageResult> parallelImageResults(numberImages, CameraCalibrator::IR_ERROR);
+		const size_t parallelDetectedImages = parallelCalibrator.handleImages(frames.data(), imageIds.data(), numberImages, parallelImageResults.data(), &worker);
+
+		OCEAN_EXPECT_TRUE(validation, parallelImageResults == sequentialImageResults);
+
+		const size_t sequentialDetectedImages = size_t(std::count(sequentialImageResults.cbegin(), sequentialImageResults.cend(), CameraCalibrator::IR_BOARD_WAS_DETECTED));
+
+		OCEAN_EXPECT_EQUAL(validation, parallelDetectedImages, sequentialDetectedImages);
+
+		detectedBoards += sequentialDetectedImages;
+
+		// the observations must be identical and must be sorted in the order of the images
+
+		const CalibrationBoardObservations& sequentialObservations = sequentialCalibrator.observations();
+		const CalibrationBoardObservations& parallelObservations = parallelCalibrator.observations();
+
+		if (sequentialObservations.size() == parallelObservations.size())
+		{
+			for (size_t nObservation = 0; nObservation < sequentialObservations.size(); ++nObservation)
+			{
+				const CalibrationBoardObservation& sequentialObservation = sequentialObservations[nObservation];
+				const CalibrationBoardObservation& parallelObservation = parallelObservations[nObservation];
+
+				OCEAN_EXPECT_EQUAL(validation, parallelObservation.imageId(), sequentialObservation.imageId());
+
+				if (nObservation >= 1)
+				{
+					OCEAN_EXPECT_LESS(validation, parallelObservations[nObservation - 1].imageId(), parallelObservation.imageId());
+				}
+
+				OCEAN_EXPECT_TRUE(validation, parallelObservation.objectPointIds() == sequentialObservation.objectPointIds());
+
+				if (parallelObservation.imagePoints().size() == sequentialObservation.imagePoints().size())
+				{
+					for (size_t nPoint = 0; nPoint < parallelObservation.imagePoints().size(); ++nPoint)
+					{
+						OCEAN_EXPECT_TRUE(validation, parallelObservation.imagePoints()[nPoint].isEqual(sequentialObservation.imagePoints()[nPoint], Numeric::weakEps()));
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+
+				OCEAN_EXPECT_TRUE(validation, parallelObservation.board_T_camera().isEqual(sequentialObservation.board_T_camera(), Numeric::weakEps()));
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	// the rendered boards must be detected in at least half of the images, otherwise the comparison above would not be meaningful
+
+	OCEAN_EXPECT_GREATER_EQUAL(validation, detectedBoards * 2, renderedBoards);
+
+	Log::info() << "Detected boards: " << detectedBoards << " of " << renderedBoards;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestCameraCalibrator::testRemoveRedundantObservations(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Remove redundant observations test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const AnyCameraPinhole anyCamera(PinholeCamera(640u, 480u, Numeric::deg2rad(Scalar(60))));
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the board is larger than the field of view of the camera, as the calibrator expects that not all markers are visible
+
+		CalibrationBoard calibrationBoard;
+		if (!CalibrationBoard::createCalibrationBoard(RandomI::random(randomGenerator, 100u), 9, 13, calibrationBoard))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const MetricCalibrationBoard metricCalibrationBoard(std::move(calibrationBoard), MetricSize(45.0 * 9.2, MetricSize::UT_MILLIMETER), MetricSize(45.0 * 13.2, MetricSize::UT_MILLIMETER));
+
+		// each image is handled twice, so that some observations do not cover any additional image area
+
+		const size_t numberFrames = size_t(RandomI::random(randomGenerator, 2u, 3u));
+
+		Frames frames(numberFrames * 2);
+		std::vector<size_t> imageIds(numberFrames * 2);
+
+		for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+		{
+			if (!renderBoard(anyCamera, metricCalibrationBoard, randomCameraPose(metricCalibrationBoard, randomGenerator), frames[nFrame]))
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			frames[nFrame + numberFrames] = Frame(frames[nFrame], Frame::ACM_USE_KEEP_LAYOUT);
+		}
+
+		for (size_t nImage = 0; nImage < imageIds.size(); ++nImage)
+		{
+			imageIds[nImage] = nImage;
+		}
+
+		CameraCalibrator calibrator(metricCalibrationBoard);
+		calibrator.handleImages(frames.data(), imageIds.data(), frames.size(), nullptr, &worker);
+
+		const CalibrationBoardObservations observations = calibrator.observations();
+
+		if (observations.empty())
+		{
+			continue;
+		}
+
+		const unsigned int bins = observations.front().occupancyArray().bins();
+
+		Indices32 coverage(bins, 0u);
+
+		for (const CalibrationBoardObservation& observation : observations)
+		{
+			for (unsigned int nBin = 0u; nBin < bins; ++nBin)
+			{
+				if (observation.occupancyArray()[nBin])
+				{
+					++coverage[nBin];
+				}
+			}
+		}
+
+		// if each observation is expected to be needed, nothing can be removed
+
+		{
+			CameraCalibrator copyCalibrator(calibrator);
+
+			OCEAN_EXPECT_EQUAL(validation, copyCalibrator.removeRedundantObservations((unsigned int)(observations.size())), size_t(0));
+			OCEAN_EXPECT_EQUAL(validation, copyCalibrator.observations().size(), observations.size());
+		}
+
+		const unsigned int expectedCoverage = RandomI::random(randomGenerator, 1u, 3u);
+
+		const size_t removedObservations = calibrator.removeRedundantObservations(expectedCoverage);
+
+		const CalibrationBoardObservations& remainingObservations = calibrator.observations();
+
+		OCEAN_EXPECT_EQUAL(validation, remainingObservations.size() + removedObservations, observations.size());
+
+		// the remaining observations keep their order, and each bin is still covered as often as expected, or as often as before
+
+		Indices32 remainingCoverage(bins, 0u);
+
+		size_t nObservation = 0;
+
+		for (const CalibrationBoardObservation& remainingObservation : remainingObservations)
+		{
+			while (nObservation < observations.size() && observations[nObservation].imageId() != remainingObservation.imageId())
+			{
+				++nObservation;
+			}
+
+			OCEAN_EXPECT_LESS(validation, nObservation, observations.size());
+
+			for (unsigned int nBin = 0u; nBin < bins; ++nBin)
+			{
+				if (remainingObservation.occupancyArray()[nBin])
+				{
+					++remainingCoverage[nBin];
+				}
+			}
+		}
+
+		for (unsigned int nBin = 0u; nBin < bins; ++nBin)
+		{
+			OCEAN_EXPECT_GREATER_EQUAL(validation, remainingCoverage[nBin], std::min(coverage[nBin], expectedCoverage));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestCameraCalibrator::renderBoard(const AnyCamera& anyCamera, const MetricCalibrationBoard& metricCalibrationBoard, const HomogenousMatrix4& board_T_camera, Frame& yFrame)
+{
+	ocean_assert(anyCamera.isValid() && metricCalibrationBoard.isValid() && board_T_camera.isValid());
+
+	constexpr uint8_t darkColor = 20u;
+	constexpr uint8_t brightColor = 235u;
+
+	constexpr size_t numberRowsColumns = Marker::numberRowsColumns();
+
+	// the relative dot radius, in relation to the size of a marker point's cell
+	constexpr Scalar dotRadius = Scalar(0.15);
+
+	const size_t xMarkers = metricCalibrationBoard.xMarkers();
+	const size_t yMarkers = metricCalibrationBoard.yMarkers();
+
+	const Scalar xMarkerSize = metricCalibrationBoard.xMetricMarkerSize();
+	const Scalar zMarkerSize = metricCalibrationBoard.zMetricMarkerSize();
+
+	// the sign of each cell, in the unoriented layout of the board
+
+	std::vector<uint8_t> cellSigns(xMarkers * yMarkers * Marker::numberPoints(), 0u);
+
+	for (size_t yMarker = 0; yMarker < yMarkers; ++yMarker)
+	{
+		for (size_t xMarker = 0; xMarker < xMarkers; ++xMarker)
+		{
+			const CalibrationBoard::MarkerCoordinate markerCoordinate((unsigned int)(xMarker), (unsigned int)(yMarker));
+
+			const CalibrationBoard::BoardMarker& boardMarker = metricCalibrationBoard.marker(markerCoordinate);
+			const Vector3 markerCenter = metricCalibrationBoard.markerCenterPosition(markerCoordinate);
+
+			for (size_t indexInMarker = 0; indexInMarker < Marker::numberPoints(); ++indexInMarker)
+			{
+				const Vector3 offset = metricCalibrationBoard.objectPoint(markerCoordinate, indexInMarker) - markerCenter;
+
+				const int xCell = Numeric::round32(offset.x() * Scalar(numberRowsColumns) / xMarkerSize) + 2;
+				const int zCell = Numeric::round32(offset.z() * Scalar(numberRowsColumns) / zMarkerSize) + 2;
+
+				ocean_assert(xCell >= 0 && xCell < int(numberRowsColumns) && zCell >= 0 && zCell < int(numberRowsColumns));
+
+				cellSigns[(yMarker * xMarkers + xMarker) * Marker::numberPoints() + size_t(zCell) * numberRowsColumns + size_t(xCell)] = boardMarker.pointSign<true>(indexInMarker) ? 1u : 0u;
+			}
+		}
+	}
+
+	if (!yFrame.set(FrameType(anyCamera.width(), anyCamera.height(), FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), true /*forceOwner*/, true /*forceWritable*/))
+	{
+		return false;
+	}
+
+	const Vector3 cameraCenter = board_T_camera.translation();
+	const SquareMatrix3 board_R_camera = board_T_camera.rotationMatrix();
+
+	const Scalar xBoardOffset = Scalar(xMarkers) * xMarkerSize * Scalar(0.5);
+	const Scalar zBoardOffset = Scalar(yMarkers) * zMarkerSize * Scalar(0.5);
+
+	// each pixel is composed of 2x2 samples
+
+	constexpr unsigned int samples = 2u;
+
+	for (unsigned int y = 0u; y < yFrame.height(); ++y)
+	{
+		uint8_t* const row = yFrame.row<uint8_t>(y);
+
+		for (unsigned int x = 0u; x < yFrame.width(); ++x)
+		{
+			unsigned int brightSamples = 0u;
+
+			for (unsigned int ySample = 0u; ySample < samples; ++ySample)
+			{
+				for (unsigned int xSample = 0u; xSample < samples; ++xSample)
+				{
+					const Vector2 imagePoint(Scalar(x) + (Scalar(xSample) + Scalar(0.5)) / Scalar(samples) - Scalar(0.5), Scalar(y) + (Scalar(ySample) + Scalar(0.5)) / Scalar(samples) - Scalar(0.5));
+
+					const Vector3 direction = board_R_camera * anyCamera.vector(imagePoint);
+
+					if (Numeric::isEqualEps(direction.y()))
+					{
+						++brightSamples;
+						continue;
+					}
+
+					// intersection of the viewing ray with the board plane (the xz-plane)
+
+					const Scalar factor = -cameraCenter.y() / direction.y();
+
+					if (factor <= Scalar(0))
+					{
+						++brightSamples;
+						continue;
+					}
+
+					const Vector3 boardPoint = cameraCenter + direction * factor;
+
+					const Scalar xMarker = (boardPoint.x() + xBoardOffset) / xMarkerSize;
+					const Scalar zMarker = (boardPoint.z() + zBoardOffset) / zMarkerSize;
+
+					if (xMarker < Scalar(0) || zMarker < Scalar(0) || xMarker >= Scalar(xMarkers) || zMarker >= Scalar(yMarkers))
+					{
+						++brightSamples;
+						continue;
+					}
+
+					const size_t xMarkerIndex = size_t(xMarker);
+					const size_t zMarkerIndex = size_t(zMarker);
+
+					const Scalar xCell = (xMarker - Scalar(xMarkerIndex)) * Scalar(numberRowsColumns);
+					const Scalar zCell = (zMarker - Scalar(zMarkerIndex)) * Scalar(numberRowsColumns);
+
+					const size_t xCellIndex = std::min(size_t(xCell), numberRowsColumns - 1);
+					const size_t zCellIndex = std::min(size_t(zCell), numberRowsColumns - 1);
+
+					const bool positiveSign = cellSigns[(zMarkerIndex * xMarkers + xMarkerIndex) * Marker::numberPoints() + zCellIndex * numberRowsColumns + xCellIndex] != 0u;
+
+					const Scalar xDot = xCell - Scalar(xCellIndex) - Scalar(0.5);
+					const Scalar zDot = zCell - Scalar(zCellIndex) - Scalar(0.5);
+
+					const bool isDot = xDot * xDot + zDot * zDot <= dotRadius * dotRadius;
+
+					// a positive sign is a black dot on white background, a negative sign is a white dot on black background
+
+					if (positiveSign != isDot)
+					{
+						++brightSamples;
+					}
+				}
+			}
+
+			row[x] = uint8_t((darkColor * (samples * samples - brightSamples) + brightColor * brightSamples + samples * samples / 2u) / (samples * samples));
+		}
+	}
+
+	return true;
+}
+
+HomogenousMatrix4 TestCameraCalibrator::randomCameraPose(const MetricCalibrationBoard& metricCalibrationBoard, RandomGenerator& randomGenerator)
+{
+	ocean_assert(metricCalibrationBoard.isValid());
+
+	const Scalar boardWidth = Scalar(metricCalibrationBoard.xMarkers()) * metricCalibrationBoard.xMetricMarkerSize();
+	const Scalar boardHeight = Scalar(metricCalibrationBoard.yMarkers()) * metricCalibrationBoard.zMetricMarkerSize();
+
+	const Vector3 boardTarget(Random::scalar(randomGenerator, -boardWidth, boardWidth) * Scalar(0.15), Scalar(0), Random::scalar(randomGenerator, -boardHeight, boardHeight) * Scalar(0.15));
+
+	// the camera is located above the board (in the positive y-space) and is looking towards the board,
+	// the view is always tilted as the field of view of the camera cannot be determined from a fronto-parallel view
+
+	const Quaternion board_Q_camera = Quaternion(Vector3(0, 1, 0), Random::scalar(randomGenerator, -Numeric::pi(), Numeric::pi())) * Quaternion(Vector3(1, 0, 0), -Numeric::pi_2()) * Quaternion(Vector3(Random::vector2(randomGenerator), 0), Random::scalar(randomGenerator, Numeric::deg2rad(Scalar(20)), Numeric::deg2rad(Scalar(40))));
+
+	const Scalar distance = Random::scalar(randomGenerator, Scalar(0.3), Scalar(0.4));
+
+	return HomogenousMatrix4(boardTarget + board_Q_camera * Vector3(0, 0, distance), board_Q_camera);
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TEST_CAMERA_CALIBRATOR_H
+#define META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TEST_CAMERA_CALIBRATOR_H
+
+#include "ocean/test/testcv/testcalibration/TestCVCalibration.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/calibration/MetricCalibrationBoard.h"
+
+#include "ocean/math/AnyCamera.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestCalibration
+{
+
+/**
+ * This class implements tests for the CameraCalibrator class.
+ * @ingroup testcvcalibration
+ */
+class OCEAN_TEST_CV_CALIBRATION_EXPORT TestCameraCalibrator
+{
+	public:
+
+		/**
+		 * Tests all functions of the camera calibrator.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests that handling a batch of images with a worker results in the same observations as handling the images one after another.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testHandleImages(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the removal of observations which do not improve the image coverage.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the computational load
+		 * @return True, if succeeded
+		 */
+		static bool testRemoveRedundantObservations(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Renders a calibration board with a specific camera pose into a frame with white background.
+		 * @param anyCamera The camera profile to be used, must be valid
+		 * @param metricCalibrationBoard The calibration board to render, must be valid
+		 * @param board_T_camera The pose of the camera with respect to the calibration board, must be valid
+		 * @param yFrame The resulting frame with pixel format FORMAT_Y8, matching the camera size
+		 * @return True, if succeeded
+		 */
+		static bool renderBoard(const AnyCamera& anyCamera, const CV::Calibration::MetricCalibrationBoard& metricCalibrationBoard, const HomogenousMatrix4& board_T_camera, Frame& yFrame);
+
+		/**
+		 * Returns a random camera pose looking at the center area of a calibration board.
+		 * @param metricCalibrationBoard The calibration board to be observed, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting camera pose, with respect to the calibration board
+		 */
+		static HomogenousMatrix4 randomCameraPose(const CV::Calibration::MetricCalibrationBoard& metricCalibrationBoard, RandomGenerator& randomGenerator);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TEST_CAMERA_CALIBRATOR_H
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testcv/testcalibration/TestPointDetector.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/CVUtilities.h"
+
+#include "ocean/cv/calibration/PointDetector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestCalibration
+{
+
+using namespace CV::Calibration;
+
+bool TestPointDetector::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("PointDetector test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("filterresponserowavx2"))
+	{
+		testResult = testFilterResponseRowAVX2(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("pointcandidatesrowavx2"))
+	{
+		testResult = testPointCandidatesRowAVX2(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPointDetector, FilterResponseRowAVX2)
+{
+	EXPECT_TRUE(TestPointDetector::testFilterResponseRowAVX2(GTEST_TEST_DURATION));
+}
+
+TEST(TestPointDetector, PointCandidatesRowAVX2)
+{
+	EXPECT_TRUE(TestPointDetector::testPointCandidatesRowAVX2(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPointDetector::testFilterResponseRowAVX2(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "AVX2 filter response row test:";
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	size_t nonZeroResponses = 0;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int filterSize = RandomI::random(randomGenerator, 1u, 7u) * 2u + 1u;
+		const unsigned int filterSize_2 = filterSize / 2u;
+
+		const PointDetector::BorderShape borderShape = RandomI::boolean(randomGenerator) ? PointDetector::BS_SQUARE : PointDetector::BS_CIRCLE;
+
+		const unsigned int width = randomWidth(filterSize, randomGenerator);
+		const unsigned int height = RandomI::random(randomGenerator, filterSize + 1u, filterSize + 20u);
+
+		const Frame yFrame = createRandomFrame(width, height, randomGenerator);
+
+		PointDetector::PointBorderOffsets pointBorderOffsets;
+
+		if (!pointBorderOffsets.update(filterSize, borderShape, yFrame.width(), yFrame.paddingElements()))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const Indices32& borderOffsets = pointBorderOffsets.offsets();
+
+		// the maximal difference may exceed the range of 8-bit values, the AVX2 implementation clamps the squared differences in 16 bit
+
+		const int32_t minimalDifference = int32_t(RandomI::random(randomGenerator, 1u, 60u));
+		const int32_t maximalDifference = minimalDifference * int32_t(RandomI::random(randomGenerator, 1u, 6u));
+
+		for (unsigned int y = filterSize_2; y < height - filterSize_2; ++y)
+		{
+			// both rows start with different values, so that each element must be written by both implementations
+
+			std::vector<int32_t> responseRowSSE(width, -1);
+			std::vector<int32_t> responseRowAVX2(width, -2);
+
+			PointDetector::createFilterResponseRowSSEDual(yFrame.constrow<uint8_t>(y), responseRowSSE.data(), width, borderOffsets.data(), borderOffsets.size(), filterSize, minimalDifference, maximalDifference);
+			PointDetector::createFilterResponseRowAVX2Dual(yFrame.constrow<uint8_t>(y), responseRowAVX2.data(), width, borderOffsets.data(), borderOffsets.size(), filterSize, minimalDifference, maximalDifference);
+
+			OCEAN_EXPECT_TRUE(validation, responseRowSSE == responseRowAVX2);
+
+			for (const int32_t response : responseRowSSE)
+			{
+				if (response != 0)
+				{
+					++nonZeroResponses;
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	// the random frames must contain points, otherwise the comparison above would not be meaningful
+
+	OCEAN_EXPECT_GREATER(validation, nonZeroResponses, size_t(0));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(testDuration);
+
+	Log::info() << "Skipped, the binary does not contain AVX2 instructions.";
+
+	return true;
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+}
+
+bool TestPointDetector::testPointCandidatesRowAVX2(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "AVX2 point candidates row test:";
+
+#if defined(OCEAN_HARDWARE_AVX_VERSION) && OCEAN_HARDWARE_AVX_VERSION >= 20
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	size_t numberCandidates = 0;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int filterSize = RandomI::random(randomGenerator, 1u, 7u) * 2u + 1u;
+		const unsigned int filterSize_2 = filterSize / 2u;
+
+		const PointDetector::BorderShape borderShape = RandomI::boolean(randomGenerator) ? PointDetector::BS_SQUARE : PointDetector::BS_CIRCLE;
+
+		const unsigned int width = randomWidth(filterSize, randomGenerator);
+		const unsigned int height = RandomI::random(randomGenerator, filterSize + 1u, filterSize + 20u);
+
+		const Frame yFrame = createRandomFrame(width, height, randomGenerator);
+
+		PointDetector::PointBorderOffsets pointBorderOffsets;
+
+		if (!pointBorderOffsets.update(filterSize, borderShape, yFrame.width(), yFrame.paddingElements()))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const Indices32& borderOffsets = pointBorderOffsets.offsets();
+
+		const int32_t minimalDifference = int32_t(RandomI::random(randomGenerator, 1u, 60u));
+		const int32_t maximalDifference = minimalDifference * int32_t(RandomI::random(randomGenerator, 1u, 6u));
+
+		PointDetector::NonMaximumSuppressionVote nonMaximumSuppressionSSE(width, height);
+		PointDetector::NonMaximumSuppressionVote nonMaximumSuppressionAVX2(width, height);
+
+		for (unsigned int y = filterSize_2; y < height - filterSize_2; ++y)
+		{
+			PointDetector::determinePointCandidatesRowSSEDual(y, yFrame.constrow<uint8_t>(y), &nonMaximumSuppressionSSE, borderOffsets.data(), borderOffsets.size(), filterSize, minimalDifference, maximalDifference);
+			PointDetector::determinePointCandidatesRowAVX2Dual(y, yFrame.constrow<uint8_t>(y), &nonMaximumSuppressionAVX2, borderOffsets.data(), borderOffsets.size(), filterSize, minimalDifference, maximalDifference);
+		}
+
+		// the candidates must be identical, including their order within each row
+
+		PointDetector::NonMaximumSuppressionVote::StrengthPositions<unsigned int, int32_t> candidatesSSE;
+		PointDetector::NonMaximumSuppressionVote::StrengthPositions<unsigned int, int32_t> candidatesAVX2;
+
+		nonMaximumSuppressionSSE.candidates(0u, width, 0u, height, candidatesSSE);
+		nonMaximumSuppressionAVX2.candidates(0u, width, 0u, height, candidatesAVX2);
+
+		if (candidatesSSE.size() == candidatesAVX2.size())
+		{
+			for (size_t n = 0; n < candidatesSSE.size(); ++n)
+			{
+				const PointDetector::NonMaximumSuppressionVote::StrengthPosition<unsigned int, int32_t>& candidateSSE = candidatesSSE[n];
+				const PointDetector::NonMaximumSuppressionVote::StrengthPosition<unsigned int, int32_t>& candidateAVX2 = candidatesAVX2[n];
+
+				OCEAN_EXPECT_EQUAL(validation, candidateSSE.x(), candidateAVX2.x());
+				OCEAN_EXPECT_EQUAL(validation, candidateSSE.y(), candidateAVX2.y());
+				OCEAN_EXPECT_EQUAL(validation, candidateSSE.strength(), candidateAVX2.strength());
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		numberCandidates += candidatesSSE.size();
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	// the random frames must contain points, otherwise the comparison above would not be meaningful
+
+	OCEAN_EXPECT_GREATER(validation, numberCandidates, size_t(0));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+
+#else
+
+	OCEAN_SUPPRESS_UNUSED_WARNING(testDuration);
+
+	Log::info() << "Skipped, the binary does not contain AVX2 instructions.";
+
+	return true;
+
+#endif // OCEAN_HARDWARE_AVX_VERSION >= 20
+}
+
+Frame TestPointDetector::createRandomFrame(const unsigned int width, const unsigned int height, RandomGenerator& randomGenerator)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+
+	const unsigned int paddingElements = RandomI::random(randomGenerator, 1u, 100u) * RandomI::random(randomGenerator, 1u);
+
+	Frame yFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), paddingElements);
+
+	if (RandomI::random(randomGenerator, 3u) == 0u)
+	{
+		CV::CVUtilities::randomizeFrame(yFrame, false, &randomGenerator);
+
+		return yFrame;
+	}
+
+	// a noisy background with dark and bright points of up to 3x3 pixels
+
+	CV::CVUtilities::randomizeFrame(yFrame, uint8_t(90), uint8_t(165), false, &randomGenerator);
+
+	const unsigned int numberPoints = std::max(1u, width * height / 20u);
+
+	for (unsigned int nPoint = 0u; nPoint < numberPoints; ++nPoint)
+	{
+		const unsigned int xPoint = RandomI::random(randomGenerator, width - 1u);
+		const unsigned int yPoint = RandomI::random(randomGenerator, height - 1u);
+
+		const unsigned int pointSize = RandomI::random(randomGenerator, 1u, 3u);
+
+		const uint8_t value = RandomI::boolean(randomGenerator) ? uint8_t(RandomI::random(randomGenerator, 0u, 40u)) : uint8_t(RandomI::random(randomGenerator, 215u, 255u));
+
+		for (unsigned int y = yPoint; y < std::min(yPoint + pointSize, height); ++y)
+		{
+			for (unsigned int x = xPoint; x < std::min(xPoint + pointSize, width); ++x)
+			{
+				yFrame.pixel<uint8_t>(x, y)[0] = value;
+			}
+		}
+	}
+
+	return yFrame;
+}
+
+unsigned int TestPointDetector::randomWidth(const unsigned int filterSize, RandomGenerator& randomGenerator)
+{
+	ocean_assert(filterSize >= 3u && filterSize % 2u == 1u);
+
+	const unsigned int minimalWidth = filterSize / 2u * 2u + 16u;
+
+	if (RandomI::random(randomGenerator, 3u) == 0u)
+	{
+		return RandomI::random(randomGenerator, minimalWidth, minimalWidth + 200u);
+	}
+
+	return minimalWidth + RandomI::random(randomGenerator, 1u, 15u);
+}
+
+}
+
+}
+
+}
+
+}
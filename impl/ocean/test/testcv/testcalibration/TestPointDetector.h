@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TEST_POINT_DETECTOR_H
+#define META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TEST_POINT_DETECTOR_H
+
+#include "ocean/test/testcv/testcalibration/TestCVCalibration.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestCV
+{
+
+namespace TestCalibration
+{
+
+/**
+ * This class implements tests for the PointDetector class.
+ * @ingroup testcvcalibration
+ */
+class OCEAN_TEST_CV_CALIBRATION_EXPORT TestPointDetector
+{
+	public:
+
+		/**
+		 * Tests all functions of the point detector.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests that the AVX2 filter response rows are identical to the SSE4.1 filter response rows.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testFilterResponseRowAVX2(const double testDuration);
+
+		/**
+		 * Tests that the AVX2 point candidates of a row are identical to the SSE4.1 point candidates of a row.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPointCandidatesRowAVX2(const double testDuration);
+
+	protected:
+
+		/**
+		 * Returns a random frame with bright and dark points on a noisy background, or a frame with random values only.
+		 * @param width The width of the frame, in pixel, with range [1, infinity)
+		 * @param height The height of the frame, in pixel, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting frame with pixel format FORMAT_Y8 and random padding
+		 */
+		static Frame createRandomFrame(const unsigned int width, const unsigned int height, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns a random width for a frame which is wide enough for the AVX2 implementation.
+		 * Most widths are just above the minimal width so that the last block of a row overlaps with the previous block.
+		 * @param filterSize The size of the filter, in pixel, with range [3, infinity), must be odd
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting width, in pixel, with range [filterSize / 2 * 2 + 16, infinity)
+		 */
+		static unsigned int randomWidth(const unsigned int filterSize, RandomGenerator& randomGenerator);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTCV_TESTCALIBRATION_TEST_POINT_DETECTOR_H
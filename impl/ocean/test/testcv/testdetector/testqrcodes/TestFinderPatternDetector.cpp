@@ -8,6 +8,7 @@
 #include "ocean/test/testcv/testdetector/testqrcodes/TestFinderPatternDetector.h"
 #include "ocean/test/testcv/testdetector/testqrcodes/Utilities.h"
 
+#include "ocean/test/Validation.h"
 #include "ocean/test/ValidationPrecision.h"
 
 #include "ocean/base/RandomI.h"
@@ -48,6 +49,12 @@ bool TestFinderPatternDetector::test(const double testDuration, Worker& worker)
 
 	bool allSucceeded = true;
 
+	allSucceeded = testTransitionCandidates(testDuration) && allSucceeded;
+
+	Log::info() << " ";
+	Log::info() << "-";
+	Log::info() << " ";
+
 	allSucceeded = testDetectFinderPatternSyntheticData(0u, testDuration, worker) && allSucceeded;
 
 	Log::info() << " ";
@@ -84,6 +91,11 @@ bool TestFinderPatternDetector::test(const double testDuration, Worker& worker)
 
 #ifdef OCEAN_USE_GTEST
 
+TEST(TestCVDetectorQRCodesFinderPatternDetector, TransitionCandidates)
+{
+	EXPECT_TRUE(TestFinderPatternDetector::testTransitionCandidates(GTEST_TEST_DURATION));
+}
+
 TEST(TestCVDetectorQRCodesFinderPatternDetector, DetectFinderPatternSyntheticDataFilterSize0)
 {
 	Worker worker;
@@ -110,6 +122,83 @@ TEST(TestCVDetectorQRCodesFinderPatternDetector, TestDetectFinderPatternSyntheti
 
 #endif // OCEAN_USE_GTEST
 
+bool TestFinderPatternDetector::testTransitionCandidates(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test: transition candidates";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 1920u);
+
+		std::vector<uint8_t> yRow(width);
+
+		if (RandomI::boolean(randomGenerator))
+		{
+			for (uint8_t& pixel : yRow)
+			{
+				pixel = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+		}
+		else
+		{
+			// blocks of similar intensities with smooth and sharp edges, similar to a blurred QR code
+
+			unsigned int x = 0u;
+
+			while (x < width)
+			{
+				const unsigned int blockSize = RandomI::random(randomGenerator, 1u, 20u);
+				const uint8_t intensity = uint8_t(RandomI::random(randomGenerator, 255u));
+
+				for (unsigned int n = 0u; n < blockSize && x < width; ++n)
+				{
+					yRow[x++] = uint8_t(minmax(0, int(intensity) + RandomI::random(randomGenerator, -8, 8), 255));
+				}
+			}
+		}
+
+		std::vector<uint8_t> toBlackCandidates(width);
+		std::vector<uint8_t> toWhiteCandidates(width);
+
+		determineTransitionCandidates(yRow.data(), width, toBlackCandidates.data(), toWhiteCandidates.data());
+
+		for (unsigned int start = 1u; start < width; ++start)
+		{
+			unsigned int xBlack = start;
+
+			TransitionHistory historyBlack;
+			while (xBlack < width && isTransitionToBlack(yRow.data() + xBlack, historyBlack) == false)
+			{
+				++xBlack;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, findTransition(toBlackCandidates.data(), width, start), xBlack);
+
+			unsigned int xWhite = start;
+
+			TransitionHistory historyWhite;
+			while (xWhite < width && isTransitionToWhite(yRow.data() + xWhite, historyWhite) == false)
+			{
+				++xWhite;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, findTransition(toWhiteCandidates.data(), width, start), xWhite);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestFinderPatternDetector::testDetectFinderPatternSyntheticData(const unsigned int filterSize, const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -53,6 +53,14 @@ class OCEAN_TEST_CV_DETECTOR_QRCODES_EXPORT TestFinderPatternDetector : protecte
 		 */
 		static bool testDetectFinderPatternSyntheticData(const unsigned int filterSize, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the transition candidates of image rows and the search for transitions based on these candidates.
+		 * The transitions are compared with the transitions of the pixel-wise search.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testTransitionCandidates(const double testDuration);
+
 	protected:
 
 		 /**
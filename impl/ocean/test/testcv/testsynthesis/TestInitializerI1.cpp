@@ -27,6 +27,7 @@
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionI1.h"
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionAreaConstrainedI1.h"
 #include "ocean/cv/synthesis/InitializerCoarserMappingAdaptionSpatialCostMaskI1.h"
+#include "ocean/cv/synthesis/InitializerHomographyMappingAdaptionI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingAreaConstrainedI1.h"
 #include "ocean/cv/synthesis/InitializerRandomMappingI1.h"
 #include "ocean/cv/synthesis/InitializerShrinkingErosionI1.h"
@@ -276,6 +277,15 @@ bool TestInitializerI1::test(const unsigned int width, const unsigned int height
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("homographymappingadaption"))
+	{
+		testResult = testHomographyMappingAdaption(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("randommapping"))
 	{
 		testResult = testRandomMapping(testDuration, worker);
@@ -451,6 +461,13 @@ TEST(TestInitializerI1, CoarserMappingAdaptionSpatialCostMask_4Channels)
 }
 
 
+TEST(TestInitializerI1, HomographyMappingAdaption)
+{
+	Worker worker;
+	EXPECT_TRUE(TestInitializerI1::testHomographyMappingAdaption(GTEST_TEST_DURATION, worker));
+}
+
+
 TEST(TestInitializerI1, RandomMapping)
 {
 	Worker worker;
@@ -1678,6 +1695,102 @@ bool TestInitializerI1::testCoarserMappingAdaptionSpatialCostMask(const unsigned
 	return validation.succeeded();
 }
 
+bool TestInitializerI1::testHomographyMappingAdaption(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing homography mapping adaption:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			const unsigned int testWidth = RandomI::random(randomGenerator, 20u, 500u);
+			const unsigned int testHeight = RandomI::random(randomGenerator, 20u, 500u);
+
+			const unsigned int channels = RandomI::random(randomGenerator, 1u, 4u);
+
+			Frame previousFrame = CV::CVUtilities::randomizedFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+			Frame frame = CV::CVUtilities::randomizedFrame(previousFrame.frameType(), &randomGenerator);
+
+			const Frame previousMask = Utilities::randomizedInpaintingMask(testWidth, testHeight, 0x00u, randomGenerator);
+			const Frame mask = Utilities::randomizedInpaintingMask(testWidth, testHeight, 0x00u, randomGenerator);
+
+			CV::Synthesis::LayerI1 previousLayer(previousFrame, previousMask);
+			OCEAN_EXPECT_TRUE(validation, bool(CV::Synthesis::InitializerRandomMappingI1(previousLayer, randomGenerator).invoke(useWorker)));
+
+			CV::PixelBoundingBox boundingBox;
+			if (RandomI::boolean(randomGenerator))
+			{
+				boundingBox = CV::MaskAnalyzer::detectBoundingBox(mask.constdata<uint8_t>(), mask.width(), mask.height(), 0xFFu, mask.paddingElements());
+				ocean_assert(boundingBox.isValid());
+			}
+
+			CV::Synthesis::LayerI1 layer(frame, mask, boundingBox);
+
+			// we use a translation so that the expected adapted positions can be determined exactly
+
+			const int translationX = RandomI::random(randomGenerator, -5, 5);
+			const int translationY = RandomI::random(randomGenerator, -5, 5);
+
+			const SquareMatrix3 previous_H_current(Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(Scalar(translationX), Scalar(translationY), 1));
+
+			OCEAN_EXPECT_TRUE(validation, bool(CV::Synthesis::InitializerHomographyMappingAdaptionI1(layer, randomGenerator, previousLayer, previous_H_current).invoke(useWorker)));
+
+			for (unsigned int y = 0u; y < mask.height(); ++y)
+			{
+				for (unsigned int x = 0u; x < mask.width(); ++x)
+				{
+					if (mask.constpixel<uint8_t>(x, y)[0] == 0xFFu)
+					{
+						continue;
+					}
+
+					const CV::PixelPosition& sourcePosition = layer.mapping().position(x, y);
+
+					if (!sourcePosition.isValid() || sourcePosition.x() >= mask.width() || sourcePosition.y() >= mask.height())
+					{
+						OCEAN_SET_FAILED(validation);
+						continue;
+					}
+
+					OCEAN_EXPECT_EQUAL(validation, mask.constpixel<uint8_t>(sourcePosition.x(), sourcePosition.y())[0], uint8_t(0xFFu));
+
+					const int previousX = int(x) + translationX;
+					const int previousY = int(y) + translationY;
+
+					if (previousX >= 0 && previousY >= 0 && previousX < int(testWidth) && previousY < int(testHeight) && previousMask.constpixel<uint8_t>((unsigned int)(previousX), (unsigned int)(previousY))[0] != 0xFFu)
+					{
+						const CV::PixelPosition& previousPosition = previousLayer.mapping().position((unsigned int)(previousX), (unsigned int)(previousY));
+
+						const int expectedX = int(previousPosition.x()) - translationX;
+						const int expectedY = int(previousPosition.y()) - translationY;
+
+						if (expectedX >= 0 && expectedY >= 0 && expectedX < int(testWidth) && expectedY < int(testHeight) && mask.constpixel<uint8_t>((unsigned int)(expectedX), (unsigned int)(expectedY))[0] == 0xFFu)
+						{
+							OCEAN_EXPECT_EQUAL(validation, sourcePosition, CV::PixelPosition((unsigned int)(expectedX), (unsigned int)(expectedY)));
+						}
+					}
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestInitializerI1::testRandomMapping(const double testDuration, Worker& worker)
 {
 	ocean_assert(testDuration > 0.0);
@@ -2332,7 +2445,7 @@ bool TestInitializerI1::shrinkPatchMatchingIteration(Frame& frame, Frame& mask,
 		{
 			const CV::PixelPosition& location = mapping.position(x, y);
 
-			ocean_assert(!location.isValid() || location.x() < frame.width() && location.y() < frame.height());
+			ocean_assert(!location.isValid() || (location.x() < frame.width() && location.y() < frame.height()));
 			if (location.isValid() && (location.x() >= frame.width() || location.y() >= frame.height()))
 			{
 				return false;
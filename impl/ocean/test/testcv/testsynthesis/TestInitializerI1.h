@@ -216,6 +216,14 @@ class OCEAN_TEST_CV_SYNTHESIS_EXPORT TestInitializerI1
 		 */
 		static bool testCoarserMappingAdaptionSpatialCostMask(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker);
 
+		/**
+		 * Tests the homography mapping adaption initializer.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to distribute the CPU load
+		 * @return True, if succeeded
+		 */
+		static bool testHomographyMappingAdaption(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the random mapping initializer.
 		 * @param testDuration Number of seconds for each test, with range (0, infinity)
@@ -18,6 +18,7 @@
 #include "ocean/cv/segmentation/MaskAnalyzer.h"
 
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodAreaConstrainedI1.h"
+#include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceCheckerboardI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceSkippingI1.h"
 #include "ocean/cv/synthesis/Optimizer4NeighborhoodHighPerformanceSkippingByCostMaskI1.h"
@@ -81,6 +82,15 @@ bool TestOptimizerI1::test(const unsigned int width, const unsigned int height,
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("highperformance4neighborhoodcheckerboard"))
+	{
+		testResult = testHighPerformance4NeighborhoodCheckerboard(width, height, testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("structuralconstrained4neighborhood"))
 	{
 		testResult = testStructuralConstrained4Neighborhood(width, height, testDuration, worker);
@@ -195,6 +205,31 @@ TEST(TestOptimizerI1, HighPerformance4NeighborhoodSkippingByCostMask_4Channels)
 }
 
 
+TEST(TestOptimizerI1, HighPerformance4NeighborhoodCheckerboard_1Channel)
+{
+	Worker worker;
+	EXPECT_TRUE(TestOptimizerI1::testHighPerformance4NeighborhoodCheckerboard(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 1u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestOptimizerI1, HighPerformance4NeighborhoodCheckerboard_2Channels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestOptimizerI1::testHighPerformance4NeighborhoodCheckerboard(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 2u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestOptimizerI1, HighPerformance4NeighborhoodCheckerboard_3Channels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestOptimizerI1::testHighPerformance4NeighborhoodCheckerboard(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 3u, GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestOptimizerI1, HighPerformance4NeighborhoodCheckerboard_4Channels)
+{
+	Worker worker;
+	EXPECT_TRUE(TestOptimizerI1::testHighPerformance4NeighborhoodCheckerboard(GTEST_TEST_IMAGE_WIDTH, GTEST_TEST_IMAGE_HEIGHT, 4u, GTEST_TEST_DURATION, worker));
+}
+
+
 TEST(TestOptimizerI1, StructuralConstrained4Neighborhood_1Channel)
 {
 	Worker worker;
@@ -1021,6 +1056,263 @@ bool TestOptimizerI1::testHighPerformance4NeighborhoodSkippingByCostMask(const u
 	return validation.succeeded();
 }
 
+bool TestOptimizerI1::testHighPerformance4NeighborhoodCheckerboard(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing high performance 4-neighborhood checkerboard optimizer for " << width << "x" << height << ":";
+
+	bool allSucceeded = true;
+
+	for (const unsigned int channels : {1u, 2u, 3u, 4u})
+	{
+		Log::info() << " ";
+
+		if (!testHighPerformance4NeighborhoodCheckerboard(width, height, channels, testDuration, worker))
+		{
+			allSucceeded = false;
+		}
+	}
+
+	Log::info() << " ";
+
+	if (allSucceeded)
+	{
+		Log::info() << "High performance 4-neighborhood checkerboard optimizer test succeeded.";
+	}
+	else
+	{
+		Log::info() << "High performance 4-neighborhood checkerboard optimizer test FAILED!";
+	}
+
+	return allSucceeded;
+}
+
+bool TestOptimizerI1::testHighPerformance4NeighborhoodCheckerboard(const unsigned int width, const unsigned int height, const unsigned int channels, const double testDuration, Worker& worker)
+{
+	ocean_assert(width >= 1u && height >= 1u);
+	ocean_assert(channels >= 1u);
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "... for " << channels << " channels:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+#ifdef OCEAN_DEBUG
+	constexpr unsigned int maxWorkerIterations = 1u;
+#else
+	const unsigned int maxWorkerIterations = worker ? 2u : 1u;
+#endif
+
+	for (unsigned int workerIteration = 0u; workerIteration < maxWorkerIterations; ++workerIteration)
+	{
+		Worker* useWorker = (workerIteration == 0u) ? nullptr : &worker;
+		HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+		const Timestamp startTimestamp(true);
+
+		do
+		{
+			for (const bool performanceIteration : {true, false})
+			{
+				while (true)
+				{
+					const unsigned int testWidth = performanceIteration ? width : RandomI::random(randomGenerator, 50u, width / 2u) * 2u;
+					const unsigned int testHeight = performanceIteration ? height : RandomI::random(randomGenerator, 50u, height / 2u) * 2u;
+
+					Frame frame = CV::CVUtilities::randomizedFrame(FrameType(testWidth, testHeight, FrameType::genericPixelFormat<uint8_t>(channels), FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+
+					Frame copyFrame(frame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+
+					Frame mask = Utilities::randomizedInpaintingMask(testWidth, testHeight, 0x00u, randomGenerator);
+
+					constexpr unsigned int patchSize = 5u;
+
+					CV::Segmentation::MaskAnalyzer::determineDistancesToBorder8Bit(mask.data<uint8_t>(), mask.width(), mask.height(), mask.paddingElements(), patchSize + 1u, false, CV::PixelBoundingBox(), useWorker);
+
+					CV::Synthesis::LayerI1 layer(frame, mask);
+					CV::Synthesis::MappingI1& mapping = layer.mappingI1();
+
+					bool validTestData = true;
+
+					for (unsigned int y = 0u; validTestData && y < mask.height(); ++y)
+					{
+						const uint8_t* maskRow = mask.constrow<uint8_t>(y);
+
+						for (unsigned int x = 0u; validTestData && x < mask.width(); ++x)
+						{
+							if (maskRow[x] != 0xFFu)
+							{
+								unsigned int sourceX, sourceY;
+
+								for (unsigned int n = 0u; n < 1000u; ++n)
+								{
+									sourceX = RandomI::random(randomGenerator, mask.width() - 1u);
+									sourceY = RandomI::random(randomGenerator, mask.height() - 1u);
+
+									if (mask.constpixel<uint8_t>(sourceX, sourceY)[0] == 0xFF)
+									{
+										break;
+									}
+								}
+
+								if (mask.constpixel<uint8_t>(sourceX, sourceY)[0] != 0xFF)
+								{
+									validTestData = false;
+									break;
+								}
+
+								mapping.setPosition(x, y, CV::PixelPosition(sourceX, sourceY));
+							}
+						}
+					}
+
+					if (!validTestData)
+					{
+						// we were not able to generate valid test data, so we need try over again
+						continue;
+					}
+
+					CV::Synthesis::MappingI1 copyMapping(mapping);
+
+					const unsigned int randomSeed = randomGenerator.seed();
+
+					constexpr unsigned int weightFactor = 5u;
+					constexpr unsigned int borderFactor = 25u;
+					constexpr bool updateFrame = true;
+
+					constexpr unsigned int radii = 5u;
+					constexpr unsigned int iterations = 4u;
+					constexpr unsigned int maxSpatialCost = (unsigned int)(-1);
+					constexpr bool applyInitialMapping = true;
+
+					// the initial cost of the mapping, determined for the frame with applied initial mapping
+
+					Frame initialFrame(copyFrame, Frame::ACM_COPY_KEEP_LAYOUT_COPY_PADDING_DATA);
+					mapping.applyMapping(initialFrame, mask, 0u, initialFrame.width(), 0u, initialFrame.height());
+
+					uint64_t initialCost = 0ull;
+
+					for (unsigned int y = 0u; y < mask.height(); ++y)
+					{
+						for (unsigned int x = 0u; x < mask.width(); ++x)
+						{
+							if (mask.constpixel<uint8_t>(x, y)[0] != 0xFFu)
+							{
+								initialCost += determineCost<borderFactor>(initialFrame, mask, mapping, CV::PixelPosition(x, y), mapping.position(x, y), weightFactor, maxSpatialCost);
+							}
+						}
+					}
+
+					RandomGenerator optimizerGenerator(randomSeed);
+
+					performance.startIf(performanceIteration);
+						CV::Synthesis::Optimizer4NeighborhoodHighPerformanceCheckerboardI1<weightFactor, borderFactor, updateFrame>(layer, optimizerGenerator).invoke(radii, iterations, maxSpatialCost, useWorker, applyInitialMapping);
+					performance.stopIf(performanceIteration);
+
+					if (!CV::CVUtilities::isPaddingMemoryIdentical(frame, copyFrame))
+					{
+						ocean_assert(false && "Invalid padding memory!");
+						return false;
+					}
+
+					uint64_t optimizedCost = 0ull;
+
+					for (unsigned int y = 0u; y < frame.height(); ++y)
+					{
+						const uint8_t* maskRow = mask.constrow<uint8_t>(y);
+
+						for (unsigned int x = 0u; x < frame.width(); ++x)
+						{
+							if (maskRow[x] != 0xFFu)
+							{
+								// each mask pixel must be mapped to a source pixel, the frame pixel must be identical to the source pixel
+
+								const CV::PixelPosition& sourcePosition = mapping.position(x, y);
+
+								if (sourcePosition.x() < frame.width() && sourcePosition.y() < frame.height() && mask.constpixel<uint8_t>(sourcePosition.x(), sourcePosition.y())[0] == 0xFFu)
+								{
+									if (memcmp(frame.constpixel<uint8_t>(x, y), frame.constpixel<uint8_t>(sourcePosition.x(), sourcePosition.y()), sizeof(uint8_t) * frame.channels()) != 0)
+									{
+										OCEAN_SET_FAILED(validation);
+									}
+
+									optimizedCost += determineCost<borderFactor>(frame, mask, mapping, CV::PixelPosition(x, y), sourcePosition, weightFactor, maxSpatialCost);
+								}
+								else
+								{
+									OCEAN_SET_FAILED(validation);
+								}
+							}
+						}
+					}
+
+					// the optimization must improve the random initial mapping
+
+					OCEAN_EXPECT_LESS_EQUAL(validation, optimizedCost, initialCost);
+
+					if (useWorker == nullptr)
+					{
+						// the single-core optimization must be reproducible
+
+						CV::Synthesis::LayerI1 copyLayer(copyFrame, mask);
+						copyLayer.mappingI1() = copyMapping;
+
+						RandomGenerator copyOptimizerGenerator(randomSeed);
+
+						if (CV::Synthesis::Optimizer4NeighborhoodHighPerformanceCheckerboardI1<weightFactor, borderFactor, updateFrame>(copyLayer, copyOptimizerGenerator).invoke(radii, iterations, maxSpatialCost, nullptr, applyInitialMapping))
+						{
+							for (unsigned int y = 0u; y < frame.height(); ++y)
+							{
+								const uint8_t* maskRow = mask.constrow<uint8_t>(y);
+
+								for (unsigned int x = 0u; x < frame.width(); ++x)
+								{
+									if (memcmp(frame.constpixel<uint8_t>(x, y), copyFrame.constpixel<uint8_t>(x, y), sizeof(uint8_t) * frame.channels()) != 0)
+									{
+										OCEAN_SET_FAILED(validation);
+									}
+
+									if (maskRow[x] != 0xFFu)
+									{
+										OCEAN_EXPECT_EQUAL(validation, mapping.position(x, y), copyLayer.mappingI1().position(x, y));
+									}
+								}
+							}
+						}
+						else
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+
+					break;
+				}
+			}
+		}
+		while (!startTimestamp.hasTimePassed(testDuration));
+	}
+
+	Log::info() << "Singlecore performance: Best: " << String::toAString(performanceSinglecore.bestMseconds(), 3u) << "ms, worst: " << String::toAString(performanceSinglecore.worstMseconds(), 3u) << "ms, average: " << String::toAString(performanceSinglecore.averageMseconds(), 3u) << "ms";
+
+	if (performanceMulticore.measurements() != 0u)
+	{
+		Log::info() << "Multicore performance: Best: " << String::toAString(performanceMulticore.bestMseconds(), 3u) << "ms, worst: " << String::toAString(performanceMulticore.worstMseconds(), 3u) << "ms, average: " << String::toAString(performanceMulticore.averageMseconds(), 3u) << "ms";
+		Log::info() << "Multicore boost: Best: " << String::toAString(performanceSinglecore.best() / performanceMulticore.best(), 2u) << "x, worst: " << String::toAString(performanceSinglecore.worst() / performanceMulticore.worst(), 2u) << "x, average: " << String::toAString(performanceSinglecore.average() / performanceMulticore.average(), 2u) << "x";
+	}
+
+	Log::info() << " ";
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestOptimizerI1::testStructuralConstrained4Neighborhood(const unsigned int width, const unsigned int height, const double testDuration, Worker& worker)
 {
 	ocean_assert(width >= 1u && height >= 1u);
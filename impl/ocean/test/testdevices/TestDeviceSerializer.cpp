@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testdevices/TestDeviceSerializer.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+
+#include "ocean/io/Bitstream.h"
+
+#include "ocean/math/Random.h"
+
+#include <sstream>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestDevices
+{
+
+using DeviceSerializer = Devices::Serialization::DeviceSerializer;
+
+bool TestDeviceSerializer::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("DeviceSerializer test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("sensorchunkroundtrip"))
+	{
+		testResult = testSensorChunkRoundTrip(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("sensorchunkcorruptinput"))
+	{
+		testResult = testSensorChunkCorruptInput(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestDeviceSerializer, SensorChunkRoundTrip)
+{
+	EXPECT_TRUE(TestDeviceSerializer::testSensorChunkRoundTrip(GTEST_TEST_DURATION));
+}
+
+TEST(TestDeviceSerializer, SensorChunkCorruptInput)
+{
+	EXPECT_TRUE(TestDeviceSerializer::testSensorChunkCorruptInput(GTEST_TEST_DURATION));
+}
+
+#endif
+
+bool TestDeviceSerializer::testSensorChunkRoundTrip(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing round trip of sensor chunks:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples samples;
+		const std::unique_ptr<DeviceSerializer::DataSampleSensorChunk> chunk = createRandomChunk(randomGenerator, samples);
+
+		OCEAN_EXPECT_TRUE(validation, chunk->isValid());
+		OCEAN_EXPECT_TRUE(validation, DeviceSerializer::DataSampleSensorChunk::isSupportedSampleType(samples.front()->type()));
+
+		std::string buffer;
+		if (!writeSample(*chunk, buffer))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		std::istringstream inputStream(buffer, std::ios::binary);
+		IO::InputBitstream inputBitstream(inputStream);
+
+		DeviceSerializer::DataSampleSensorChunk readChunk;
+
+		if (!readChunk.readSample(inputBitstream))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		OCEAN_EXPECT_TRUE(validation, readChunk.dataTimestamp() == chunk->dataTimestamp());
+
+		const DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples& readSamples = readChunk.samples();
+
+		if (readSamples.size() != samples.size())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		// the decoded samples must be bitwise identical to the original samples (except for the playback timestamps), therefore we compare the serialized samples
+
+		for (size_t nSample = 0; nSample < samples.size(); ++nSample)
+		{
+			ocean_assert(samples[nSample]);
+
+			if (!readSamples[nSample])
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, readSamples[nSample]->type(), samples[nSample]->type());
+
+			std::string expectedSampleBuffer;
+			std::string readSampleBuffer;
+
+			OCEAN_EXPECT_TRUE(validation, writeSample(*samples[nSample], expectedSampleBuffer));
+			OCEAN_EXPECT_TRUE(validation, writeSample(*readSamples[nSample], readSampleBuffer));
+
+			// the playback timestamps of the chunk's samples are determined relative to the playback timestamp of the chunk
+
+			OCEAN_EXPECT_TRUE(validation, NumericD::isEqual(readSamples[nSample]->playbackTimestamp(), samples[nSample]->playbackTimestamp(), 0.000001));
+
+			constexpr size_t playbackTimestampSize = sizeof(double);
+
+			OCEAN_EXPECT_TRUE(validation, readSampleBuffer.size() == expectedSampleBuffer.size() && readSampleBuffer.compare(playbackTimestampSize, std::string::npos, expectedSampleBuffer, playbackTimestampSize, std::string::npos) == 0);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestDeviceSerializer::testSensorChunkCorruptInput(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing sensor chunks with truncated and corrupted input:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples samples;
+		const std::unique_ptr<DeviceSerializer::DataSampleSensorChunk> chunk = createRandomChunk(randomGenerator, samples);
+
+		std::string buffer;
+		if (!writeSample(*chunk, buffer))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		ocean_assert(!buffer.empty());
+
+		{
+			// a truncated chunk must be rejected
+
+			const size_t truncatedSize = size_t(RandomI::random(randomGenerator, (unsigned int)(buffer.size()) - 1u));
+
+			std::istringstream inputStream(buffer.substr(0, truncatedSize), std::ios::binary);
+			IO::InputBitstream inputBitstream(inputStream);
+
+			DeviceSerializer::DataSampleSensorChunk readChunk;
+			OCEAN_EXPECT_FALSE(validation, readChunk.readSample(inputBitstream));
+		}
+
+		{
+			// a corrupted chunk must either be rejected or must result in valid samples of the chunk's sample type
+
+			std::string corruptedBuffer(buffer);
+
+			const unsigned int numberCorruptions = RandomI::random(randomGenerator, 1u, 4u);
+
+			for (unsigned int n = 0u; n < numberCorruptions; ++n)
+			{
+				const size_t index = size_t(RandomI::random(randomGenerator, (unsigned int)(corruptedBuffer.size()) - 1u));
+
+				corruptedBuffer[index] = char(corruptedBuffer[index] ^ char(RandomI::random(randomGenerator, 1u, 255u)));
+			}
+
+			std::istringstream inputStream(corruptedBuffer, std::ios::binary);
+			IO::InputBitstream inputBitstream(inputStream);
+
+			DeviceSerializer::DataSampleSensorChunk readChunk;
+
+			if (readChunk.readSample(inputBitstream))
+			{
+				for (const IO::Serialization::UniqueDataSample& readSample : readChunk.samples())
+				{
+					if (!readSample || !DeviceSerializer::DataSampleSensorChunk::isSupportedSampleType(readSample->type()))
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+
+		{
+			// a chunk followed by random data must be read correctly and must not consume the following data
+
+			std::string extendedBuffer(buffer);
+
+			const unsigned int numberExtraBytes = RandomI::random(randomGenerator, 1u, 64u);
+
+			for (unsigned int n = 0u; n < numberExtraBytes; ++n)
+			{
+				extendedBuffer.push_back(char(RandomI::random(randomGenerator, 255u)));
+			}
+
+			std::istringstream inputStream(extendedBuffer, std::ios::binary);
+			IO::InputBitstream inputBitstream(inputStream);
+
+			DeviceSerializer::DataSampleSensorChunk readChunk;
+			OCEAN_EXPECT_TRUE(validation, readChunk.readSample(inputBitstream));
+
+			OCEAN_EXPECT_EQUAL(validation, readChunk.samples().size(), samples.size());
+			OCEAN_EXPECT_EQUAL(validation, inputBitstream.position(), uint64_t(buffer.size()));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+std::unique_ptr<DeviceSerializer::DataSampleSensorChunk> TestDeviceSerializer::createRandomChunk(RandomGenerator& randomGenerator, DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples& samples)
+{
+	const unsigned int sampleTypeIndex = RandomI::random(randomGenerator, 5u);
+	const size_t numberSamples = size_t(RandomI::random(randomGenerator, 1u, 500u));
+
+	samples.clear();
+	samples.reserve(numberSamples);
+
+	DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples chunkSamples;
+	chunkSamples.reserve(numberSamples);
+
+	Timestamps sampleCreationTimestamps;
+	sampleCreationTimestamps.reserve(numberSamples);
+
+	double timestamp = RandomD::scalar(randomGenerator, 0.0, 10000.0);
+
+	for (size_t nSample = 0; nSample < numberSamples; ++nSample)
+	{
+		// the samples are created twice with identical random values, once for the chunk and once for the comparison
+
+		const unsigned int seed = RandomI::random32(randomGenerator);
+
+		RandomGenerator sampleRandomGenerator(seed);
+		chunkSamples.emplace_back(createRandomSample(sampleTypeIndex, Timestamp(timestamp), sampleRandomGenerator));
+
+		sampleRandomGenerator = RandomGenerator(seed);
+		samples.emplace_back(createRandomSample(sampleTypeIndex, Timestamp(timestamp), sampleRandomGenerator));
+
+		sampleCreationTimestamps.emplace_back(timestamp);
+
+		timestamp += RandomD::scalar(randomGenerator, 0.0001, 0.01);
+	}
+
+	// the playback timestamps are configured as if the samples had been serialized
+
+	const Timestamp serializationStartTimestamp(sampleCreationTimestamps.front() - RandomD::scalar(randomGenerator, 0.0, 100.0));
+
+	for (IO::Serialization::UniqueDataSample& sample : samples)
+	{
+		sample->configurePlaybackTimestamp(serializationStartTimestamp);
+	}
+
+	std::unique_ptr<DeviceSerializer::DataSampleSensorChunk> chunk = std::make_unique<DeviceSerializer::DataSampleSensorChunk>(std::move(chunkSamples), sampleCreationTimestamps);
+	chunk->configurePlaybackTimestamp(serializationStartTimestamp);
+
+	return chunk;
+}
+
+IO::Serialization::UniqueDataSample TestDeviceSerializer::createRandomSample(const unsigned int sampleTypeIndex, const Timestamp& timestamp, RandomGenerator& randomGenerator)
+{
+	ocean_assert(sampleTypeIndex <= 5u);
+	ocean_assert(timestamp.isValid());
+
+	const unsigned int numberMeasurements = RandomI::random(randomGenerator, 0u, 3u);
+
+	Devices::Measurement::ObjectIds objectIds;
+	for (unsigned int n = 0u; n < numberMeasurements; ++n)
+	{
+		objectIds.emplaceBack(RandomI::random32(randomGenerator));
+	}
+
+	const Devices::Tracker::ReferenceSystem referenceSystem = RandomI::boolean(randomGenerator) ? Devices::Tracker::RS_OBJECT_IN_DEVICE : Devices::Tracker::RS_DEVICE_IN_OBJECT;
+
+	switch (sampleTypeIndex)
+	{
+		case 0u:
+		{
+			Devices::OrientationTracker3DOF::OrientationTracker3DOFSample::Orientations orientations;
+			for (unsigned int n = 0u; n < numberMeasurements; ++n)
+			{
+				orientations.emplaceBack(Random::quaternion(randomGenerator));
+			}
+
+			return std::make_unique<DeviceSerializer::DataSampleOrientationTracker3DOF>(Devices::OrientationTracker3DOF::OrientationTracker3DOFSample(timestamp, referenceSystem, objectIds, orientations), timestamp);
+		}
+
+		case 1u:
+		{
+			Devices::AccelerationSensor3DOF::Acceleration3DOFSample::Measurements measurements;
+			for (unsigned int n = 0u; n < numberMeasurements; ++n)
+			{
+				measurements.emplaceBack(Random::vector3(randomGenerator, -20, 20));
+			}
+
+			return std::make_unique<DeviceSerializer::DataSampleAccelerationSensor3DOF>(Devices::AccelerationSensor3DOF::Acceleration3DOFSample(timestamp, objectIds, measurements), timestamp);
+		}
+
+		case 2u:
+		{
+			Devices::GyroSensor3DOF::Gyro3DOFSample::Measurements measurements;
+			for (unsigned int n = 0u; n < numberMeasurements; ++n)
+			{
+				measurements.emplaceBack(Random::vector3(randomGenerator, -10, 10));
+			}
+
+			return std::make_unique<DeviceSerializer::DataSampleGyroSensor3DOF>(Devices::GyroSensor3DOF::Gyro3DOFSample(timestamp, objectIds, measurements), timestamp);
+		}
+
+		case 3u:
+		{
+			Devices::GravityTracker3DOF::GravityTracker3DOFSample::Gravities gravities;
+			for (unsigned int n = 0u; n < numberMeasurements; ++n)
+			{
+				gravities.emplaceBack(Random::vector3(randomGenerator));
+			}
+
+			return std::make_unique<DeviceSerializer::DataSampleGravityTracker3DOF>(Devices::GravityTracker3DOF::GravityTracker3DOFSample(timestamp, referenceSystem, objectIds, gravities), timestamp);
+		}
+
+		case 4u:
+		{
+			Devices::PositionTracker3DOF::PositionTracker3DOFSample::Positions positions;
+			for (unsigned int n = 0u; n < numberMeasurements; ++n)
+			{
+				positions.emplaceBack(Random::vector3(randomGenerator, -100, 100));
+			}
+
+			return std::make_unique<DeviceSerializer::DataSamplePositionTracker3DOF>(Devices::PositionTracker3DOF::PositionTracker3DOFSample(timestamp, referenceSystem, objectIds, positions), timestamp);
+		}
+
+		case 5u:
+		{
+			Devices::Tracker6DOF::Tracker6DOFSample::Orientations orientations;
+			Devices::Tracker6DOF::Tracker6DOFSample::Positions positions;
+			for (unsigned int n = 0u; n < numberMeasurements; ++n)
+			{
+				orientations.emplaceBack(Random::quaternion(randomGenerator));
+				positions.emplaceBack(Random::vector3(randomGenerator, -100, 100));
+			}
+
+			return std::make_unique<DeviceSerializer::DataSampleTracker6DOF>(Devices::Tracker6DOF::Tracker6DOFSample(timestamp, referenceSystem, objectIds, orientations, positions), timestamp);
+		}
+	}
+
+	ocean_assert(false && "Invalid sample type!");
+	return nullptr;
+}
+
+bool TestDeviceSerializer::writeSample(const IO::Serialization::DataSample& sample, std::string& buffer)
+{
+	std::ostringstream outputStream(std::ios::binary);
+	IO::OutputBitstream outputBitstream(outputStream);
+
+	if (!sample.writeSample(outputBitstream))
+	{
+		return false;
+	}
+
+	buffer = outputStream.str();
+
+	return true;
+}
+
+} // namespace TestDevices
+
+} // namespace Test
+
+} // namespace Ocean
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTDEVICES_TEST_DEVICE_SERIALIZER_H
+#define META_OCEAN_TEST_TESTDEVICES_TEST_DEVICE_SERIALIZER_H
+
+#include "ocean/test/testdevices/TestDevices.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/devices/serialization/DeviceSerializer.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestDevices
+{
+
+/**
+ * This class implements tests for the DeviceSerializer class.
+ * @ingroup testdevices
+ */
+class OCEAN_TEST_DEVICES_EXPORT TestDeviceSerializer
+{
+	public:
+
+		/**
+		 * Invokes all tests.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests will be executed
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests writing and reading chunks of sensor samples for all supported sample types.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSensorChunkRoundTrip(const double testDuration);
+
+		/**
+		 * Tests reading chunks of sensor samples from truncated and corrupted input.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSensorChunkCorruptInput(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a random chunk of sensor samples.
+		 * @param randomGenerator The random generator to be used
+		 * @param samples The resulting individual samples which are not part of the chunk, with same content as the samples of the chunk
+		 * @return The resulting chunk
+		 */
+		static std::unique_ptr<Devices::Serialization::DeviceSerializer::DataSampleSensorChunk> createRandomChunk(RandomGenerator& randomGenerator, Devices::Serialization::DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples& samples);
+
+		/**
+		 * Creates a random sensor sample.
+		 * @param sampleTypeIndex The index of the sample type, with range [0, 5]
+		 * @param timestamp The timestamp of the sample, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting sample
+		 */
+		static IO::Serialization::UniqueDataSample createRandomSample(const unsigned int sampleTypeIndex, const Timestamp& timestamp, RandomGenerator& randomGenerator);
+
+		/**
+		 * Writes a sample to a buffer.
+		 * @param sample The sample to write
+		 * @param buffer The resulting buffer
+		 * @return True, if succeeded
+		 */
+		static bool writeSample(const IO::Serialization::DataSample& sample, std::string& buffer);
+};
+
+} // namespace TestDevices
+
+} // namespace Test
+
+} // namespace Ocean
+
+#endif // META_OCEAN_TEST_TESTDEVICES_TEST_DEVICE_SERIALIZER_H
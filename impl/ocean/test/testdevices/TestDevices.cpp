@@ -7,10 +7,12 @@
 
 #include "ocean/test/testdevices/TestDevices.h"
 #include "ocean/test/testdevices/TestAccelerationSensor3DOF.h"
+#include "ocean/test/testdevices/TestDeviceSerializer.h"
 #include "ocean/test/testdevices/TestGPSTracker.h"
 #include "ocean/test/testdevices/TestGravityTracker3DOF.h"
 #include "ocean/test/testdevices/TestOrientationTracker3DOF.h"
 #include "ocean/test/testdevices/TestPositionTracker3DOF.h"
+#include "ocean/test/testdevices/TestSerializerDevicePlayer.h"
 #include "ocean/test/testdevices/TestTracker6DOF.h"
 
 #include "ocean/test/TestResult.h"
@@ -84,6 +86,15 @@ bool testDevices(const double testDuration, Worker& /*worker*/, const std::strin
 		testResult = TestAccelerationSensor3DOF::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("deviceserializer"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestDeviceSerializer::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("gpstracker"))
 	{
 		Log::info() << " ";
@@ -120,6 +131,15 @@ bool testDevices(const double testDuration, Worker& /*worker*/, const std::strin
 		testResult = TestPositionTracker3DOF::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("serializerdeviceplayer"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestSerializerDevicePlayer::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("tracker6dof"))
 	{
 		Log::info() << " ";
@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testdevices/TestSerializerDevicePlayer.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/devices/AccelerationSensor3DOF.h"
+#include "ocean/devices/Manager.h"
+
+#include "ocean/devices/serialization/DeviceSerializer.h"
+#include "ocean/devices/serialization/SerializerDevicePlayer.h"
+
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+#include "ocean/io/serialization/MediaSerializer.h"
+#include "ocean/io/serialization/OutputDataSerializer.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestDevices
+{
+
+bool TestSerializerDevicePlayer::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("SerializerDevicePlayer test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("paralleldecoding"))
+	{
+		testResult = testParallelDecoding(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("sensorchunkplayback"))
+	{
+		testResult = testSensorChunkPlayback(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestSerializerDevicePlayer, ParallelDecoding)
+{
+	EXPECT_TRUE(TestSerializerDevicePlayer::testParallelDecoding(GTEST_TEST_DURATION));
+}
+
+TEST(TestSerializerDevicePlayer, SensorChunkPlayback)
+{
+	EXPECT_TRUE(TestSerializerDevicePlayer::testSensorChunkPlayback(GTEST_TEST_DURATION));
+}
+
+#endif
+
+bool TestSerializerDevicePlayer::testParallelDecoding(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing stop-motion playback with parallel decoding:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const std::string tempFilename = (scopedDirectory + IO::File("test_player.dat"))();
+
+		const size_t numberFrames = size_t(RandomI::random(randomGenerator, 1u, 40u));
+
+		if (!writeFrameRecording(tempFilename, numberFrames))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const bool useParallelDecoding = RandomI::boolean(randomGenerator);
+
+		Devices::Serialization::SerializerDevicePlayer player;
+
+		if (useParallelDecoding)
+		{
+			const unsigned int decodeAheadFrames = RandomI::random(randomGenerator, 2u, 8u);
+			const unsigned int maximalDecodingThreads = RandomI::random(randomGenerator, 1u, 4u);
+
+			OCEAN_EXPECT_TRUE(validation, player.setParallelDecoding(decodeAheadFrames, maximalDecodingThreads, RandomI::boolean(randomGenerator)));
+		}
+
+		if (!player.initialize(tempFilename))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		const Media::FrameMediumRefs frameMediums = player.frameMediums();
+
+		if (frameMediums.size() != 2)
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		OCEAN_EXPECT_TRUE(validation, player.start(Devices::DevicePlayer::SPEED_USE_STOP_MOTION));
+
+		// optionally, we seek to a random frame once some frames have been played so that pending decoded frames are discarded
+
+		const size_t seekAfterFrames = RandomI::boolean(randomGenerator) ? size_t(RandomI::random(randomGenerator, (unsigned int)(numberFrames) - 1u)) : numberFrames;
+		const size_t seekFrameIndex = size_t(RandomI::random(randomGenerator, (unsigned int)(numberFrames) - 1u));
+
+		size_t playedFrames = 0;
+		size_t expectedFrameIndex = 0;
+
+		while (expectedFrameIndex < numberFrames)
+		{
+			if (playedFrames == seekAfterFrames)
+			{
+				OCEAN_EXPECT_TRUE(validation, player.seek(testFrame(seekFrameIndex, 0u).timestamp()));
+				expectedFrameIndex = seekFrameIndex;
+			}
+
+			const Timestamp frameTimestamp = player.playNextFrame();
+
+			if (frameTimestamp != testFrame(expectedFrameIndex, 0u).timestamp())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			// the frames of both channels must match the frames of the played timestamp, the mediums may hold newer frames from before a seek
+
+			for (unsigned int channelIndex = 0u; channelIndex < 2u; ++channelIndex)
+			{
+				const FrameRef frame = frameMediums[channelIndex]->frame(frameTimestamp);
+
+				if (!frame || !frame->isValid() || frame->timestamp() != frameTimestamp)
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				const Frame expectedFrame = testFrame(expectedFrameIndex, channelIndex);
+
+				if (frame->frameType() != expectedFrame.frameType())
+				{
+					OCEAN_SET_FAILED(validation);
+					continue;
+				}
+
+				for (unsigned int y = 0u; y < expectedFrame.height(); ++y)
+				{
+					OCEAN_EXPECT_EQUAL(validation, memcmp(frame->constrow<void>(y), expectedFrame.constrow<void>(y), expectedFrame.planeWidthBytes(0u)), 0);
+				}
+			}
+
+			++playedFrames;
+			++expectedFrameIndex;
+		}
+
+		OCEAN_EXPECT_FALSE(validation, player.playNextFrame().isValid());
+
+		OCEAN_EXPECT_TRUE(validation, player.stop());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSerializerDevicePlayer::testSensorChunkPlayback(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Testing stop-motion playback with chunked sensor samples:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const std::string tempFilename = (scopedDirectory + IO::File("test_player_chunks.dat"))();
+
+		const size_t numberFrames = size_t(RandomI::random(randomGenerator, 1u, 20u));
+		const size_t samplesPerChunk = size_t(RandomI::random(randomGenerator, 1u, 40u));
+
+		Timestamps accelerationTimestamps;
+		if (!writeSensorChunkRecording(tempFilename, numberFrames, samplesPerChunk, accelerationTimestamps))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		Devices::Serialization::SerializerDevicePlayer player;
+
+		if (!player.initialize(tempFilename))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		OCEAN_EXPECT_TRUE(validation, player.start(Devices::DevicePlayer::SPEED_USE_STOP_MOTION));
+
+		for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+		{
+			const Timestamp frameTimestamp = player.playNextFrame();
+
+			if (frameTimestamp != testFrame(nFrame, 0u).timestamp())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			// the most recent acceleration sample must be the last sample recorded before the frame, although its chunk holds newer samples
+
+			size_t expectedSamples = 0;
+
+			while (expectedSamples < accelerationTimestamps.size() && accelerationTimestamps[expectedSamples] <= frameTimestamp)
+			{
+				++expectedSamples;
+			}
+
+			Devices::AccelerationSensor3DOFRef accelerationSensor;
+
+			for (const std::string& deviceName : Devices::Manager::get().devices())
+			{
+				if (deviceName.find("Serialization AccelerationSensor3DOF") == 0)
+				{
+					accelerationSensor = Devices::Manager::get().device(deviceName);
+				}
+			}
+
+			if (expectedSamples == 0)
+			{
+				OCEAN_EXPECT_TRUE(validation, accelerationSensor.isNull() || accelerationSensor->sample().isNull());
+				continue;
+			}
+
+			if (accelerationSensor.isNull())
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			const Devices::AccelerationSensor3DOF::Acceleration3DOFSampleRef sample = accelerationSensor->sample();
+
+			if (sample.isNull() || sample->measurements().size() != 1)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, sample->timestamp(), accelerationTimestamps[expectedSamples - 1]);
+
+			// the measurement holds the index of the acceleration sample
+
+			OCEAN_EXPECT_EQUAL(validation, sample->measurements().front().x(), Scalar(expectedSamples - 1));
+		}
+
+		OCEAN_EXPECT_FALSE(validation, player.playNextFrame().isValid());
+
+		OCEAN_EXPECT_TRUE(validation, player.stop());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSerializerDevicePlayer::writeFrameRecording(const std::string& filename, const size_t numberFrames)
+{
+	ocean_assert(!filename.empty() && numberFrames >= 1);
+
+	IO::Serialization::FileOutputDataSerializer outputSerializer;
+
+	if (!outputSerializer.setFilename(filename))
+	{
+		return false;
+	}
+
+	IO::Serialization::DataSerializer::ChannelId channelIds[2];
+
+	for (unsigned int channelIndex = 0u; channelIndex < 2u; ++channelIndex)
+	{
+		channelIds[channelIndex] = outputSerializer.addChannel(IO::Serialization::MediaSerializer::DataSampleFrame::sampleType(), "FrameMedium,TestFrameMedium" + String::toAString(channelIndex), "frame");
+
+		if (channelIds[channelIndex] == IO::Serialization::DataSerializer::invalidChannelId())
+		{
+			return false;
+		}
+	}
+
+	if (!outputSerializer.start())
+	{
+		return false;
+	}
+
+	// the samples get increasing creation timestamps so that the playback timestamps are strictly increasing
+
+	const Timestamp creationTimestamp(true);
+
+	for (size_t nFrame = 0; nFrame < numberFrames; ++nFrame)
+	{
+		for (unsigned int channelIndex = 0u; channelIndex < 2u; ++channelIndex)
+		{
+			const Timestamp sampleCreationTimestamp = creationTimestamp + double(nFrame * 2 + channelIndex) * 0.001;
+
+			IO::Serialization::UniqueDataSample sample = std::make_unique<IO::Serialization::MediaSerializer::DataSampleFrame>(testFrame(nFrame, channelIndex), "ocn", SharedAnyCamera(), HomogenousMatrixD4(false), sampleCreationTimestamp);
+
+			if (!outputSerializer.addSample(channelIds[channelIndex], std::move(sample)))
+			{
+				return false;
+			}
+		}
+	}
+
+	return outputSerializer.stopAndWait(10.0);
+}
+
+bool TestSerializerDevicePlayer::writeSensorChunkRecording(const std::string& filename, const size_t numberFrames, const size_t samplesPerChunk, Timestamps& accelerationTimestamps)
+{
+	ocean_assert(!filename.empty() && numberFrames >= 1 && samplesPerChunk >= 1);
+
+	IO::Serialization::FileOutputDataSerializer outputSerializer;
+
+	if (!outputSerializer.setFilename(filename))
+	{
+		return false;
+	}
+
+	const IO::Serialization::DataSerializer::ChannelId frameChannelId = outputSerializer.addChannel(IO::Serialization::MediaSerializer::DataSampleFrame::sampleType(), "FrameMedium,TestFrameMedium", "frame");
+
+	const std::string contentType = Devices::Device::translateMajorType(Devices::Device::DEVICE_SENSOR) + "," + Devices::Sensor::translateSensorType(Devices::Sensor::SENSOR_ACCELERATION_3DOF);
+	const IO::Serialization::DataSerializer::ChannelId chunkChannelId = outputSerializer.addChannel(Devices::Serialization::DeviceSerializer::DataSampleSensorChunk::sampleType(), "TestAccelerationSensor", contentType);
+
+	if (frameChannelId == IO::Serialization::DataSerializer::invalidChannelId() || chunkChannelId == IO::Serialization::DataSerializer::invalidChannelId())
+	{
+		return false;
+	}
+
+	if (!outputSerializer.start())
+	{
+		return false;
+	}
+
+	// the samples are created in the same sequence as during a real recording, a chunk is written once its last sample has been created
+
+	const Timestamp creationTimestamp(true);
+
+	const Timestamp firstFrameTimestamp = testFrame(0, 0u).timestamp();
+
+	const size_t numberAccelerationSamples = numberFrames * 10;
+
+	accelerationTimestamps.clear();
+	accelerationTimestamps.reserve(numberAccelerationSamples);
+
+	Devices::Serialization::DeviceSerializer::DataSampleSensorChunk::UniqueDataSamples pendingSamples;
+	Timestamps pendingCreationTimestamps;
+
+	size_t nextFrameIndex = 0;
+
+	for (size_t nSample = 0; nSample < numberAccelerationSamples; ++nSample)
+	{
+		const Timestamp accelerationTimestamp = firstFrameTimestamp + 0.005 + double(nSample) * 0.01;
+		accelerationTimestamps.emplace_back(accelerationTimestamp);
+
+		const Timestamp sampleCreationTimestamp = creationTimestamp + double(accelerationTimestamp - firstFrameTimestamp);
+
+		const Devices::AccelerationSensor3DOF::Acceleration3DOFSample::Measurements measurements(1, Vector3(Scalar(nSample), Scalar(9.81), Scalar(0)));
+		const Devices::AccelerationSensor3DOF::Acceleration3DOFSample accelerationSample(accelerationTimestamp, Devices::Measurement::ObjectIds(1, 0u), measurements);
+
+		pendingSamples.emplace_back(std::make_unique<Devices::Serialization::DeviceSerializer::DataSampleAccelerationSensor3DOF>(accelerationSample, sampleCreationTimestamp));
+		pendingCreationTimestamps.emplace_back(sampleCreationTimestamp);
+
+		if (pendingSamples.size() < samplesPerChunk && nSample + 1 < numberAccelerationSamples)
+		{
+			continue;
+		}
+
+		while (nextFrameIndex < numberFrames && testFrame(nextFrameIndex, 0u).timestamp() < accelerationTimestamp)
+		{
+			const Timestamp frameCreationTimestamp = creationTimestamp + double(testFrame(nextFrameIndex, 0u).timestamp() - firstFrameTimestamp);
+
+			if (!outputSerializer.addSample(frameChannelId, std::make_unique<IO::Serialization::MediaSerializer::DataSampleFrame>(testFrame(nextFrameIndex, 0u), "ocn", SharedAnyCamera(), HomogenousMatrixD4(false), frameCreationTimestamp)))
+			{
+				return false;
+			}
+
+			++nextFrameIndex;
+		}
+
+		IO::Serialization::UniqueDataSample chunkSample = std::make_unique<Devices::Serialization::DeviceSerializer::DataSampleSensorChunk>(std::move(pendingSamples), pendingCreationTimestamps);
+
+		if (!outputSerializer.addSample(chunkChannelId, std::move(chunkSample)))
+		{
+			return false;
+		}
+
+		pendingSamples.clear();
+		pendingCreationTimestamps.clear();
+	}
+
+	while (nextFrameIndex < numberFrames)
+	{
+		const Timestamp frameCreationTimestamp = creationTimestamp + double(testFrame(nextFrameIndex, 0u).timestamp() - firstFrameTimestamp);
+
+		if (!outputSerializer.addSample(frameChannelId, std::make_unique<IO::Serialization::MediaSerializer::DataSampleFrame>(testFrame(nextFrameIndex, 0u), "ocn", SharedAnyCamera(), HomogenousMatrixD4(false), frameCreationTimestamp)))
+		{
+			return false;
+		}
+
+		++nextFrameIndex;
+	}
+
+	return outputSerializer.stopAndWait(10.0);
+}
+
+Frame TestSerializerDevicePlayer::testFrame(const size_t frameIndex, const unsigned int channelIndex)
+{
+	ocean_assert(channelIndex <= 1u);
+
+	const unsigned int width = 64u << channelIndex;
+	const unsigned int height = 48u << channelIndex;
+
+	Frame frame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), Indices32(), Timestamp(1000.0 + double(frameIndex) * 0.1));
+
+	for (unsigned int y = 0u; y < height; ++y)
+	{
+		uint8_t* const row = frame.row<uint8_t>(y);
+
+		for (unsigned int x = 0u; x < width; ++x)
+		{
+			row[x] = uint8_t((frameIndex * 7u + x + y * 3u + channelIndex * 101u) & 0xFFu);
+		}
+	}
+
+	return frame;
+}
+
+} // namespace TestDevices
+
+} // namespace Test
+
+} // namespace Ocean
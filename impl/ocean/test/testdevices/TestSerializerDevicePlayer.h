@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTDEVICES_TEST_SERIALIZER_DEVICE_PLAYER_H
+#define META_OCEAN_TEST_TESTDEVICES_TEST_SERIALIZER_DEVICE_PLAYER_H
+
+#include "ocean/test/testdevices/TestDevices.h"
+
+#include "ocean/base/Frame.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestDevices
+{
+
+/**
+ * This class implements tests for the SerializerDevicePlayer class.
+ * @ingroup testdevices
+ */
+class OCEAN_TEST_DEVICES_EXPORT TestSerializerDevicePlayer
+{
+	public:
+
+		/**
+		 * Invokes all tests.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The selector defining which tests will be executed
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the stop-motion playback with parallel decoding and ensures that the frames are delivered in order.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testParallelDecoding(const double testDuration);
+
+		/**
+		 * Tests the stop-motion playback of a recording with chunked sensor samples and ensures that the samples of a chunk are played based on their own timestamps.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testSensorChunkPlayback(const double testDuration);
+
+	protected:
+
+		/**
+		 * Writes a recording with two frame channels to a file.
+		 * Both channels contain one frame for each frame index, the frames of the second channel are twice as large as the frames of the first channel.
+		 * @param filename The name of the file to write, must be valid
+		 * @param numberFrames The number of frames in each channel, with range [1, infinity)
+		 * @return True, if succeeded
+		 * @see testFrame().
+		 */
+		static bool writeFrameRecording(const std::string& filename, const size_t numberFrames);
+
+		/**
+		 * Writes a recording with one frame channel and one channel with chunked acceleration samples to a file.
+		 * The recording contains ten acceleration samples for each frame, the samples are located between the frames.
+		 * @param filename The name of the file to write, must be valid
+		 * @param numberFrames The number of frames, with range [1, infinity)
+		 * @param samplesPerChunk The number of acceleration samples in each chunk, with range [1, infinity)
+		 * @param accelerationTimestamps The resulting timestamps of all acceleration samples, in chronological order
+		 * @return True, if succeeded
+		 */
+		static bool writeSensorChunkRecording(const std::string& filename, const size_t numberFrames, const size_t samplesPerChunk, Timestamps& accelerationTimestamps);
+
+		/**
+		 * Creates the deterministic test frame for a given frame index and channel.
+		 * @param frameIndex The index of the frame, with range [0, infinity)
+		 * @param channelIndex The index of the channel, with range [0, 1]
+		 * @return The resulting frame
+		 */
+		static Frame testFrame(const size_t frameIndex, const unsigned int channelIndex);
+};
+
+} // namespace TestDevices
+
+} // namespace Test
+
+} // namespace Ocean
+
+#endif // META_OCEAN_TEST_TESTDEVICES_TEST_SERIALIZER_DEVICE_PLAYER_H
@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testgeometry/TestDynamicOctree.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Timestamp.h"
+#include "ocean/base/WorkerPool.h"
+
+#include "ocean/geometry/DynamicOctree.h"
+#include "ocean/geometry/Octree.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestGeometry
+{
+
+bool TestDynamicOctree::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0);
+
+	TestResult testResult("Dynamic octree test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("insertremovemove"))
+	{
+		testResult = testInsertRemoveMove(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("closestpoints"))
+	{
+		testResult = testClosestPoints(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("intersectingleavesforrays"))
+	{
+		testResult = testIntersectingLeavesForRays(testDuration);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestDynamicOctree, InsertRemoveMove)
+{
+	EXPECT_TRUE(TestDynamicOctree::testInsertRemoveMove(GTEST_TEST_DURATION));
+}
+
+TEST(TestDynamicOctree, ClosestPoints)
+{
+	EXPECT_TRUE(TestDynamicOctree::testClosestPoints(GTEST_TEST_DURATION));
+}
+
+TEST(TestDynamicOctree, IntersectingLeavesForRays)
+{
+	EXPECT_TRUE(TestDynamicOctree::testIntersectingLeavesForRays(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestDynamicOctree::testInsertRemoveMove(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+#ifdef OCEAN_DEBUG
+	constexpr unsigned int benchmarkPointNumber = 20000u;
+#else
+	constexpr unsigned int benchmarkPointNumber = 200000u;
+#endif
+
+	constexpr unsigned int benchmarkExtensionNumber = 1000u;
+
+	Log::info() << "Test insert, remove, and move:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceRebuild;
+	HighPerformanceStatistic performanceExtension;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// random operations, verified with a brute force reference
+
+		{
+			const Geometry::DynamicOctree::Parameters parameters(RandomI::random(randomGenerator, 1u, 50u), Random::scalar(randomGenerator, Scalar(0.01), Scalar(100)));
+
+			Geometry::DynamicOctree octree(parameters);
+
+			std::unordered_map<Index32, Vector3> referencePoints;
+
+			const Scalar range = Random::scalar(randomGenerator, Scalar(1), Scalar(1000));
+
+			const unsigned int numberOperations = RandomI::random(randomGenerator, 1u, 5000u);
+
+			for (unsigned int nOperation = 0u; nOperation < numberOperations; ++nOperation)
+			{
+				const unsigned int operation = RandomI::random(randomGenerator, 9u);
+				const Index32 pointId = RandomI::random(randomGenerator, 2000u);
+
+				// some points are located at identical positions
+
+				const Vector3 point = RandomI::random(randomGenerator, 20u) == 0u ? Vector3(1, 2, 3) : Random::vector3(randomGenerator, -range, range);
+
+				const bool referenceHasPoint = referencePoints.find(pointId) != referencePoints.cend();
+
+				if (operation <= 4u)
+				{
+					OCEAN_EXPECT_EQUAL(validation, octree.insertPoint(pointId, point), !referenceHasPoint);
+
+					if (!referenceHasPoint)
+					{
+						referencePoints.emplace(pointId, point);
+					}
+				}
+				else if (operation <= 7u)
+				{
+					OCEAN_EXPECT_EQUAL(validation, octree.removePoint(pointId), referenceHasPoint);
+
+					referencePoints.erase(pointId);
+				}
+				else
+				{
+					OCEAN_EXPECT_EQUAL(validation, octree.movePoint(pointId, point), referenceHasPoint);
+
+					if (referenceHasPoint)
+					{
+						referencePoints[pointId] = point;
+					}
+				}
+
+				OCEAN_EXPECT_EQUAL(validation, octree.size(), referencePoints.size());
+				OCEAN_EXPECT_EQUAL(validation, octree.hasPoint(pointId), referencePoints.find(pointId) != referencePoints.cend());
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, octree.isValid(), !referencePoints.empty());
+
+			for (const std::pair<const Index32, Vector3>& referencePoint : referencePoints)
+			{
+				if (!octree.boundingBox().isInside(referencePoint.second, Numeric::weakEps()))
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			Geometry::DynamicOctree::ReusableData reusableData;
+
+			for (unsigned int nQuery = 0u; nQuery < 50u; ++nQuery)
+			{
+				const Vector3 queryPoint = Random::vector3(randomGenerator, -range, range);
+				const Scalar maximalDistance = Random::scalar(randomGenerator, Scalar(0), range);
+
+				Indices32 pointIds;
+				Vectors3 points;
+				octree.closestPoints(queryPoint, maximalDistance, pointIds, &points, reusableData);
+
+				OCEAN_EXPECT_EQUAL(validation, pointIds.size(), points.size());
+
+				Indices32 referencePointIds;
+
+				for (const std::pair<const Index32, Vector3>& referencePoint : referencePoints)
+				{
+					if (referencePoint.second.sqrDistance(queryPoint) <= Numeric::sqr(maximalDistance))
+					{
+						referencePointIds.emplace_back(referencePoint.first);
+					}
+				}
+
+				for (size_t n = 0; n < std::min(pointIds.size(), points.size()); ++n)
+				{
+					const std::unordered_map<Index32, Vector3>::const_iterator iReference = referencePoints.find(pointIds[n]);
+
+					if (iReference == referencePoints.cend() || iReference->second != points[n])
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+
+				std::sort(pointIds.begin(), pointIds.end());
+				std::sort(referencePointIds.begin(), referencePointIds.end());
+
+				OCEAN_EXPECT_EQUAL(validation, pointIds, referencePointIds);
+			}
+
+			// removing all points must result in an empty octree
+
+			for (const std::pair<const Index32, Vector3>& referencePoint : referencePoints)
+			{
+				OCEAN_EXPECT_TRUE(validation, octree.removePoint(referencePoint.first));
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, octree.size(), size_t(0));
+			OCEAN_EXPECT_EQUAL(validation, octree.numberNodes(), size_t(0));
+			OCEAN_EXPECT_FALSE(validation, octree.isValid());
+		}
+
+		// extending an existing map compared to re-creating a static octree
+
+		{
+			Vectors3 points;
+			points.reserve(benchmarkPointNumber + benchmarkExtensionNumber);
+
+			for (unsigned int n = 0u; n < benchmarkPointNumber + benchmarkExtensionNumber; ++n)
+			{
+				points.emplace_back(Random::vector3(randomGenerator, Scalar(-100), Scalar(100)));
+			}
+
+			Geometry::DynamicOctree octree(points.data(), benchmarkPointNumber);
+
+			performanceExtension.start();
+				for (unsigned int n = benchmarkPointNumber; n < benchmarkPointNumber + benchmarkExtensionNumber; ++n)
+				{
+					octree.insertPoint(Index32(n), points[n]);
+				}
+			performanceExtension.stop();
+
+			performanceRebuild.start();
+				const Geometry::Octree staticOctree(points.data(), points.size());
+			performanceRebuild.stop();
+
+			OCEAN_EXPECT_EQUAL(validation, octree.size(), points.size());
+			OCEAN_EXPECT_TRUE(validation, staticOctree.isValid());
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Adding " << benchmarkExtensionNumber << " points to " << benchmarkPointNumber << " points:";
+	Log::info() << "Re-creating static octree: " << performanceRebuild;
+	Log::info() << "Inserting into dynamic octree: " << performanceExtension;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestDynamicOctree::testClosestPoints(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+#ifdef OCEAN_DEBUG
+	constexpr unsigned int benchmarkTreePointNumber = 20000u;
+	constexpr unsigned int benchmarkQueryPointNumber = 1000u;
+#else
+	constexpr unsigned int benchmarkTreePointNumber = 200000u;
+	constexpr unsigned int benchmarkQueryPointNumber = 10000u;
+#endif
+
+	Log::info() << "Test closestPoints() with " << benchmarkTreePointNumber << " tree points, and " << benchmarkQueryPointNumber << " query points:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceStaticOctree;
+	HighPerformanceStatistic performanceSingleQueries;
+	HighPerformanceStatistic performanceBatchQueries;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool benchmarkIteration : {false, true})
+		{
+			const unsigned int numberTreePoints = benchmarkIteration ? benchmarkTreePointNumber : RandomI::random(randomGenerator, 1u, 20000u);
+			const unsigned int numberQueryPoints = benchmarkIteration ? benchmarkQueryPointNumber : RandomI::random(randomGenerator, 1u, 500u);
+
+			Vectors3 treePoints;
+			treePoints.reserve(numberTreePoints);
+
+			for (unsigned int n = 0u; n < numberTreePoints; ++n)
+			{
+				treePoints.emplace_back(Random::vector3(randomGenerator, Scalar(-1000), Scalar(1000)));
+			}
+
+			Vectors3 queryPoints;
+			queryPoints.reserve(numberQueryPoints);
+
+			for (unsigned int n = 0u; n < numberQueryPoints; ++n)
+			{
+				queryPoints.emplace_back(Random::vector3(randomGenerator, Scalar(-1000), Scalar(1000)));
+			}
+
+			const Scalar maximalDistance = benchmarkIteration ? Scalar(20) : Random::scalar(randomGenerator, Scalar(0.1), Scalar(200));
+
+			const unsigned int maximalPointsPerLeaf = benchmarkIteration ? 40u : RandomI::random(randomGenerator, 1u, 100u);
+
+			const Geometry::Octree staticOctree(treePoints.data(), treePoints.size(), Geometry::Octree::Parameters(maximalPointsPerLeaf, true));
+			const Geometry::DynamicOctree dynamicOctree(treePoints.data(), treePoints.size(), Geometry::DynamicOctree::Parameters(maximalPointsPerLeaf, Scalar(1)));
+
+			OCEAN_EXPECT_EQUAL(validation, dynamicOctree.size(), treePoints.size());
+
+			std::vector<Indices32> staticResults(numberQueryPoints);
+
+			performanceStaticOctree.startIf(benchmarkIteration);
+				Geometry::Octree::ReusableData staticReusableData;
+
+				for (unsigned int n = 0u; n < numberQueryPoints; ++n)
+				{
+					staticOctree.closestPoints(treePoints.data(), queryPoints[n], maximalDistance, staticResults[n], nullptr, staticReusableData);
+				}
+			performanceStaticOctree.stopIf(benchmarkIteration);
+
+			std::vector<Indices32> singleResults(numberQueryPoints);
+
+			performanceSingleQueries.startIf(benchmarkIteration);
+				Geometry::DynamicOctree::ReusableData dynamicReusableData;
+
+				for (unsigned int n = 0u; n < numberQueryPoints; ++n)
+				{
+					dynamicOctree.closestPoints(queryPoints[n], maximalDistance, singleResults[n], nullptr, dynamicReusableData);
+				}
+			performanceSingleQueries.stopIf(benchmarkIteration);
+
+			Worker* worker = RandomI::boolean(randomGenerator) || benchmarkIteration ? WorkerPool::get().scopedWorker()() : nullptr;
+
+			std::vector<Indices32> batchResults;
+
+			performanceBatchQueries.startIf(benchmarkIteration);
+				dynamicOctree.closestPoints(queryPoints.data(), queryPoints.size(), maximalDistance, batchResults, worker);
+			performanceBatchQueries.stopIf(benchmarkIteration);
+
+			OCEAN_EXPECT_EQUAL(validation, batchResults.size(), size_t(numberQueryPoints));
+
+			if (batchResults.size() == size_t(numberQueryPoints))
+			{
+				for (unsigned int n = 0u; n < numberQueryPoints; ++n)
+				{
+					std::sort(staticResults[n].begin(), staticResults[n].end());
+					std::sort(singleResults[n].begin(), singleResults[n].end());
+					std::sort(batchResults[n].begin(), batchResults[n].end());
+
+					OCEAN_EXPECT_EQUAL(validation, singleResults[n], staticResults[n]);
+					OCEAN_EXPECT_EQUAL(validation, batchResults[n], staticResults[n]);
+				}
+			}
+
+			// the leaves must cover all closest points
+
+			Geometry::DynamicOctree::ReusableData reusableData;
+			std::vector<const Indices32*> leaves;
+
+			const unsigned int queryIndex = RandomI::random(randomGenerator, numberQueryPoints - 1u);
+
+			dynamicOctree.closestLeaves(queryPoints[queryIndex], maximalDistance, leaves, reusableData);
+
+			UnorderedIndexSet32 leafPointIds;
+
+			for (const Indices32* leaf : leaves)
+			{
+				leafPointIds.insert(leaf->cbegin(), leaf->cend());
+			}
+
+			for (const Index32& pointId : staticResults[queryIndex])
+			{
+				if (leafPointIds.find(pointId) == leafPointIds.cend())
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Static octree: " << performanceStaticOctree;
+	Log::info() << "Dynamic octree, individual queries: " << performanceSingleQueries;
+	Log::info() << "Dynamic octree, batch query: " << performanceBatchQueries;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestDynamicOctree::testIntersectingLeavesForRays(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Test intersectingLeaves() for rays:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int numberTreePoints = RandomI::random(randomGenerator, 1u, 20000u);
+
+		Geometry::DynamicOctree octree(Geometry::DynamicOctree::Parameters(RandomI::random(randomGenerator, 1u, 100u), Scalar(1)));
+
+		Vectors3 treePoints;
+		treePoints.reserve(numberTreePoints);
+
+		for (unsigned int n = 0u; n < numberTreePoints; ++n)
+		{
+			treePoints.emplace_back(Random::vector3(randomGenerator, Scalar(-1000), Scalar(1000)));
+
+			OCEAN_EXPECT_TRUE(validation, octree.insertPoint(Index32(n), treePoints.back()));
+		}
+
+		Geometry::DynamicOctree::ReusableData reusableData;
+		std::vector<const Indices32*> leaves;
+
+		for (unsigned int nQuery = 0u; nQuery < 100u; ++nQuery)
+		{
+			// each ray starts at a tree point, so that the leaf holding the tree point must be intersected
+
+			const Index32 pointId = RandomI::random(randomGenerator, numberTreePoints - 1u);
+
+			const Line3 queryRay(treePoints[pointId], Random::vector3(randomGenerator));
+
+			const bool useCone = RandomI::boolean(randomGenerator);
+
+			leaves.clear();
+
+			if (useCone)
+			{
+				octree.intersectingLeaves(queryRay, Numeric::tan(Numeric::deg2rad(1)), leaves, reusableData);
+			}
+			else
+			{
+				octree.intersectingLeaves(queryRay, leaves, reusableData);
+			}
+
+			bool foundPoint = false;
+
+			for (const Indices32* leaf : leaves)
+			{
+				if (std::find(leaf->cbegin(), leaf->cend(), pointId) != leaf->cend())
+				{
+					foundPoint = true;
+					break;
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, foundPoint);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTGEOMETRY_TEST_DYNAMIC_OCTREE_H
+#define META_OCEAN_TEST_TESTGEOMETRY_TEST_DYNAMIC_OCTREE_H
+
+#include "ocean/test/testgeometry/TestGeometry.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestGeometry
+{
+
+/**
+ * This class implements tests for the dynamic octree.
+ * @ingroup testgeometry
+ */
+class OCEAN_TEST_GEOMETRY_EXPORT TestDynamicOctree
+{
+	public:
+
+		/**
+		 * Tests all dynamic octree functions.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests inserting, removing, and moving points.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testInsertRemoveMove(const double testDuration);
+
+		/**
+		 * Tests the closestPoints() functions for individual query points and for batches of query points.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testClosestPoints(const double testDuration);
+
+		/**
+		 * Tests the intersectingLeaves() function for rays.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testIntersectingLeavesForRays(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTGEOMETRY_TEST_DYNAMIC_OCTREE_H
@@ -9,6 +9,7 @@
 
 #include "ocean/test/testgeometry/TestAbsoluteTransformation.h"
 #include "ocean/test/testgeometry/TestDelaunay.h"
+#include "ocean/test/testgeometry/TestDynamicOctree.h"
 #include "ocean/test/testgeometry/TestEpipolarGeometry.h"
 #include "ocean/test/testgeometry/TestError.h"
 #include "ocean/test/testgeometry/TestEstimator.h"
@@ -28,6 +29,7 @@
 #include "ocean/test/testgeometry/TestP3P.h"
 #include "ocean/test/testgeometry/TestP4P.h"
 #include "ocean/test/testgeometry/TestPnP.h"
+#include "ocean/test/testgeometry/TestPoseGraphOptimization.h"
 #include "ocean/test/testgeometry/TestRANSAC.h"
 #include "ocean/test/testgeometry/TestSpatialDistribution.h"
 #include "ocean/test/testgeometry/TestStereoscopicGeometry.h"
@@ -274,6 +276,15 @@ bool testGeometry(const double testDuration, Worker& worker, const std::string&
 		testResult = TestNonLinearOptimizationTransformation::test(testDuration, &worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("posegraphoptimization"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestPoseGraphOptimization::test(testDuration, worker, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("epipolargeometry"))
 	{
 		Log::info() << " ";
@@ -319,6 +330,15 @@ bool testGeometry(const double testDuration, Worker& worker, const std::string&
 		testResult = TestOctree::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("dynamicoctree"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestDynamicOctree::test(testDuration, subSelector);
+	}
+
 	if (TestSelector subSelector = selector.shouldRun("stereoscopicgeometry"))
 	{
 		Log::info() << " ";
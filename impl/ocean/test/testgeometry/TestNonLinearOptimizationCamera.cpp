@@ -9,6 +9,7 @@
 #include "ocean/test/testgeometry/Utilities.h"
 
 #include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
 
 #include "ocean/base/HighPerformanceTimer.h"
 #include "ocean/base/Subset.h"
@@ -33,7 +34,7 @@ namespace Test
 namespace TestGeometry
 {
 
-bool TestNonLinearOptimizationCamera::test(const double testDuration, Worker* /*worker*/, const TestSelector& selector)
+bool TestNonLinearOptimizationCamera::test(const double testDuration, Worker* worker, const TestSelector& selector)
 {
 	TestResult testResult("Camera non linear optimization test");
 
@@ -55,6 +56,16 @@ bool TestNonLinearOptimizationCamera::test(const double testDuration, Worker* /*
 		Log::info() << " ";
 	}
 
+	if (worker != nullptr && selector.shouldRun("nonlinearoptimizationcameraposesworker"))
+	{
+		Log::info() << "-";
+		Log::info() << " ";
+
+		testResult = testNonLinearOptimizationCameraPosesWorker(testDuration, *worker);
+
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -153,6 +164,105 @@ bool TestNonLinearOptimizationCamera::testNonLinearOptimizationCameraPoses(const
 	return result;
 }
 
+bool TestNonLinearOptimizationCamera::testNonLinearOptimizationCameraPosesWorker(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Camera profile and camera poses optimization test with worker (Schur complement):";
+
+	constexpr unsigned int width = 640u;
+	constexpr unsigned int height = 480u;
+
+	constexpr unsigned int numberPoses = 30u;
+	constexpr unsigned int numberObjectPoints = 100u;
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	HighPerformanceStatistic performanceSingleCore;
+	HighPerformanceStatistic performanceMultiCore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const SquareMatrix3 intrinsic(Random::scalar(randomGenerator, 500, 600), 0, 0, 0, Random::scalar(randomGenerator, 500, 600), 0, Random::scalar(randomGenerator, 300, 340), Random::scalar(randomGenerator, 220, 260), 1);
+		const PinholeCamera pinholeCamera(intrinsic, width, height, PinholeCamera::DistortionPair(Random::scalar(randomGenerator, Scalar(-0.1), Scalar(0.1)), Random::scalar(randomGenerator, Scalar(-0.1), Scalar(0.1))), PinholeCamera::DistortionPair(Random::scalar(randomGenerator, Scalar(-0.01), Scalar(0.01)), Random::scalar(randomGenerator, Scalar(-0.01), Scalar(0.01))));
+
+		const Vectors3 objectPoints(Utilities::objectPoints(Box3(Vector3(-1, -1, -1), Vector3(1, 1, 1)), numberObjectPoints, &randomGenerator));
+
+		std::vector<Vectors2> imagePointGroups;
+		HomogenousMatrices4 inaccurateWorld_T_cameras;
+
+		for (unsigned int n = 0u; n < numberPoses; ++n)
+		{
+			const Vector3 viewingDirection(Random::vector3(randomGenerator));
+			const HomogenousMatrix4 world_T_camera(Utilities::viewPosition(pinholeCamera, objectPoints, viewingDirection));
+
+			Vectors2 imagePoints(objectPoints.size());
+			pinholeCamera.projectToImage<true>(world_T_camera, objectPoints.data(), objectPoints.size(), true, imagePoints.data());
+
+			for (Vector2& imagePoint : imagePoints)
+			{
+				imagePoint += Random::gaussianNoiseVector2(randomGenerator, Scalar(0.5), Scalar(0.5));
+			}
+
+			imagePointGroups.push_back(std::move(imagePoints));
+
+			const Vector3 inaccurateViewingDirection(SquareMatrix3(Random::euler(randomGenerator, Numeric::deg2rad(2.5))) * viewingDirection);
+			inaccurateWorld_T_cameras.push_back(Utilities::viewPosition(pinholeCamera, objectPoints, inaccurateViewingDirection));
+		}
+
+		const AnyCameraPinhole inaccurateCamera(PinholeCamera(width, height, pinholeCamera.fovX() + Random::scalar(randomGenerator, Numeric::deg2rad(-5), Numeric::deg2rad(5))));
+
+		Scalar finalErrors[2] = {Numeric::maxValue(), Numeric::maxValue()};
+		SharedAnyCamera optimizedCameras[2];
+
+		bool allSucceeded = true;
+
+		for (const bool useWorker : {false, true})
+		{
+			HighPerformanceStatistic& performance = useWorker ? performanceMultiCore : performanceSingleCore;
+
+			const HighPerformanceStatistic::ScopedStatistic scopedStatistic(performance);
+
+			if (!Geometry::NonLinearOptimizationCamera::optimizeCameraPoses(inaccurateCamera, ConstArrayAccessor<HomogenousMatrix4>(inaccurateWorld_T_cameras), ConstElementAccessor<Vectors3>(numberPoses, objectPoints), ConstArrayAccessor<Vectors2>(imagePointGroups), optimizedCameras[useWorker ? 1 : 0], nullptr, 50u, Geometry::NonLinearOptimizationCamera::OS_ALL_PARAMETERS_AT_ONCE, Geometry::Estimator::ET_SQUARE, Scalar(0.001), Scalar(5), true, Scalar(0), nullptr, &finalErrors[useWorker ? 1 : 0], nullptr, useWorker ? &worker : nullptr))
+			{
+				allSucceeded = false;
+			}
+		}
+
+		if (!allSucceeded)
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		// both solvers determine the same normal equations so that the results must be almost identical
+
+		if (Numeric::abs(finalErrors[0] - finalErrors[1]) > std::max(Scalar(0.01), finalErrors[0] * Scalar(0.01)))
+		{
+			scopedIteration.setInaccurate();
+		}
+
+		const Vector2 imagePoint(Scalar(width) * Scalar(0.25), Scalar(height) * Scalar(0.75));
+
+		if (optimizedCameras[0]->projectToImage(optimizedCameras[1]->vector(imagePoint)).distance(imagePoint) > Scalar(0.5))
+		{
+			scopedIteration.setInaccurate();
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance default solver: " << performanceSingleCore;
+	Log::info() << "Performance with worker: " << performanceMultiCore;
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 bool TestNonLinearOptimizationCamera::testNonLinearOptimizationCamera(const unsigned int correspondences, const double testDuration, const Geometry::Estimator::EstimatorType estimatorType, const Scalar standardDeviation, const unsigned int numberOutliers)
 {
 	ocean_assert(correspondences >= 3u && testDuration > 0);
@@ -58,6 +58,14 @@ class OCEAN_TEST_GEOMETRY_EXPORT TestNonLinearOptimizationCamera
 		 */
 		static bool testNonLinearOptimizationCameraPoses(const double testDuration);
 
+		/**
+		 * Tests the non linear optimization function for one camera profile and several poses with a worker, comparing the distributed Schur complement solver with the default solver.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object to be used
+		 * @return True, if succeeded
+		 */
+		static bool testNonLinearOptimizationCameraPosesWorker(const double testDuration, Worker& worker);
+
 		/**
 		 * Tests the non linear optimization function for camera parameters with a defined number of correspondences.
 		 * @param correspondences Number of point correspondences
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testgeometry/TestPoseGraphOptimization.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestGeometry
+{
+
+bool TestPoseGraphOptimization::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("Pose graph optimization test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("optimizeposes"))
+	{
+		testResult = testOptimizePoses(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("optimizesimilarityposes"))
+	{
+		testResult = testOptimizeSimilarityPoses(testDuration, worker);
+
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestPoseGraphOptimization, OptimizePoses)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPoseGraphOptimization::testOptimizePoses(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestPoseGraphOptimization, OptimizeSimilarityPoses)
+{
+	Worker worker;
+	EXPECT_TRUE(TestPoseGraphOptimization::testOptimizeSimilarityPoses(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestPoseGraphOptimization::testOptimizePoses(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	constexpr unsigned int numberPoses = 500u;
+
+	Log::info() << "Optimize 6-DOF poses with " << numberPoses << " poses:";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = 0.95;
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Scalar maximalTranslationError = std::is_same<Scalar, double>::value ? Scalar(0.001) : Scalar(0.05);
+	const Scalar maximalAngleError = Numeric::deg2rad(std::is_same<Scalar, double>::value ? Scalar(0.01) : Scalar(0.5));
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HomogenousMatrices4 world_T_poses;
+		Scalars scales;
+		HomogenousMatrices4 world_T_driftedPoses;
+		Scalars driftedScales;
+		Geometry::PoseGraphOptimization::Edges edges;
+
+		createTrajectory(numberPoses, false, randomGenerator, world_T_poses, scales, world_T_driftedPoses, driftedScales, edges);
+
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			HomogenousMatrices4 world_T_optimizedPoses;
+			Scalar initialError = Numeric::maxValue();
+			Scalar finalError = Numeric::maxValue();
+
+			performance.start();
+				const bool result = Geometry::PoseGraphOptimization::optimizePoses(world_T_driftedPoses, edges, world_T_optimizedPoses, Indices32(1, 0u), 50u, Scalar(0.001), Scalar(5), &initialError, &finalError, useWorker ? &worker : nullptr);
+			performance.stop();
+
+			if (!result || world_T_optimizedPoses.size() != world_T_poses.size())
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			if (finalError >= initialError)
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			for (size_t n = 0; n < world_T_poses.size(); ++n)
+			{
+				const HomogenousMatrix4& world_T_pose = world_T_poses[n];
+				const HomogenousMatrix4& world_T_optimizedPose = world_T_optimizedPoses[n];
+
+				if (world_T_pose.translation().distance(world_T_optimizedPose.translation()) > maximalTranslationError
+						|| world_T_pose.rotation().angle(world_T_optimizedPose.rotation()) > maximalAngleError)
+				{
+					scopedIteration.setInaccurate();
+					break;
+				}
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance single-core: " << performanceSinglecore;
+	Log::info() << "Performance multi-core: " << performanceMulticore;
+	Log::info() << "Multi-core boost factor: " << String::toAString(performanceSinglecore.median() / performanceMulticore.median(), 1u) << "x (median)";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestPoseGraphOptimization::testOptimizeSimilarityPoses(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	constexpr unsigned int numberPoses = 500u;
+
+	Log::info() << "Optimize 7-DOF similarity poses with " << numberPoses << " poses:";
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = 0.95;
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Scalar maximalTranslationError = std::is_same<Scalar, double>::value ? Scalar(0.001) : Scalar(0.05);
+	const Scalar maximalAngleError = Numeric::deg2rad(std::is_same<Scalar, double>::value ? Scalar(0.01) : Scalar(0.5));
+	const Scalar maximalScaleError = std::is_same<Scalar, double>::value ? Scalar(0.0001) : Scalar(0.01);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HomogenousMatrices4 world_T_poses;
+		Scalars scales;
+		HomogenousMatrices4 world_T_driftedPoses;
+		Scalars driftedScales;
+		Geometry::PoseGraphOptimization::Edges edges;
+
+		createTrajectory(numberPoses, true, randomGenerator, world_T_poses, scales, world_T_driftedPoses, driftedScales, edges);
+
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			HomogenousMatrices4 world_T_optimizedPoses;
+			Scalars optimizedScales;
+			Scalar initialError = Numeric::maxValue();
+			Scalar finalError = Numeric::maxValue();
+
+			performance.start();
+				const bool result = Geometry::PoseGraphOptimization::optimizeSimilarityPoses(world_T_driftedPoses, driftedScales, edges, world_T_optimizedPoses, optimizedScales, Indices32(1, 0u), 50u, Scalar(0.001), Scalar(5), &initialError, &finalError, useWorker ? &worker : nullptr);
+			performance.stop();
+
+			if (!result || world_T_optimizedPoses.size() != world_T_poses.size() || optimizedScales.size() != scales.size())
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			if (finalError >= initialError)
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			for (size_t n = 0; n < world_T_poses.size(); ++n)
+			{
+				const HomogenousMatrix4& world_T_pose = world_T_poses[n];
+				const HomogenousMatrix4& world_T_optimizedPose = world_T_optimizedPoses[n];
+
+				if (world_T_pose.translation().distance(world_T_optimizedPose.translation()) > maximalTranslationError
+						|| world_T_pose.rotation().angle(world_T_optimizedPose.rotation()) > maximalAngleError
+						|| Numeric::abs(scales[n] - optimizedScales[n]) > maximalScaleError * scales[n])
+				{
+					scopedIteration.setInaccurate();
+					break;
+				}
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance single-core: " << performanceSinglecore;
+	Log::info() << "Performance multi-core: " << performanceMulticore;
+	Log::info() << "Multi-core boost factor: " << String::toAString(performanceSinglecore.median() / performanceMulticore.median(), 1u) << "x (median)";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestPoseGraphOptimization::createTrajectory(const unsigned int numberPoses, const bool withScaleDrift, RandomGenerator& randomGenerator, HomogenousMatrices4& world_T_poses, Scalars& scales, HomogenousMatrices4& world_T_driftedPoses, Scalars& driftedScales, Geometry::PoseGraphOptimization::Edges& edges)
+{
+	ocean_assert(numberPoses >= 10u);
+
+	constexpr Scalar trajectoryRadius = Scalar(5);
+
+	world_T_poses.clear();
+	scales.clear();
+	edges.clear();
+
+	world_T_poses.reserve(numberPoses);
+	scales.reserve(numberPoses);
+
+	for (unsigned int n = 0u; n < numberPoses; ++n)
+	{
+		const Scalar angle = Numeric::pi2() * Scalar(n) / Scalar(numberPoses);
+
+		const Vector3 translation(Numeric::cos(angle) * trajectoryRadius, Random::scalar(randomGenerator, Scalar(-0.1), Scalar(0.1)), Numeric::sin(angle) * trajectoryRadius);
+		const Quaternion orientation = Quaternion(Vector3(0, 1, 0), -angle) * Quaternion(Random::vector3(randomGenerator), Random::scalar(randomGenerator, Numeric::deg2rad(0), Numeric::deg2rad(5)));
+
+		world_T_poses.emplace_back(translation, orientation);
+
+		// the (monocular) scale is drifting along the trajectory, the first pose defines the gauge
+		scales.emplace_back(withScaleDrift ? Scalar(1) + Scalar(0.5) * Scalar(n) / Scalar(numberPoses) : Scalar(1));
+	}
+
+	const auto createEdge = [&world_T_poses, &scales](const Index32 first, const Index32 second)
+	{
+		const HomogenousMatrix4& world_T_first = world_T_poses[first];
+		const HomogenousMatrix4& world_T_second = world_T_poses[second];
+
+		const SquareMatrix3 first_R_world = world_T_first.rotationMatrix().transposed();
+
+		const Vector3 first_t_second = first_R_world * (world_T_second.translation() - world_T_first.translation()) / scales[first];
+		const HomogenousMatrix4 first_T_second(first_t_second, first_R_world * world_T_second.rotationMatrix());
+
+		return Geometry::PoseGraphOptimization::Edge(first, second, first_T_second, Scalar(1), scales[second] / scales[first]);
+	};
+
+	// odometry edges between neighboring poses
+
+	for (Index32 n = 0u; n + 1u < numberPoses; ++n)
+	{
+		edges.emplace_back(createEdge(n, n + 1u));
+
+		if (n + 2u < numberPoses)
+		{
+			edges.emplace_back(createEdge(n, n + 2u));
+		}
+	}
+
+	// loop closure edges
+
+	edges.emplace_back(createEdge(numberPoses - 1u, 0u));
+	edges.emplace_back(createEdge(numberPoses - 2u, 0u));
+	edges.emplace_back(createEdge(numberPoses - 1u, 1u));
+
+	// the drifted trajectory is determined by concatenating slightly disturbed odometry measurements
+
+	world_T_driftedPoses.clear();
+	driftedScales.clear();
+
+	world_T_driftedPoses.reserve(numberPoses);
+	driftedScales.reserve(numberPoses);
+
+	world_T_driftedPoses.emplace_back(world_T_poses.front());
+	driftedScales.emplace_back(scales.front());
+
+	for (Index32 n = 0u; n + 1u < numberPoses; ++n)
+	{
+		const Geometry::PoseGraphOptimization::Edge edge = createEdge(n, n + 1u);
+
+		const HomogenousMatrix4& world_T_driftedFirst = world_T_driftedPoses.back();
+		const Scalar driftedFirstScale = driftedScales.back();
+
+		const Quaternion rotationNoise(Random::vector3(randomGenerator), Random::scalar(randomGenerator, Numeric::deg2rad(0), Numeric::deg2rad(0.2)));
+		const Vector3 translationNoise = Random::vector3(randomGenerator, Scalar(-0.005), Scalar(0.005));
+
+		const Vector3 world_t_second = world_T_driftedFirst.translation() + world_T_driftedFirst.rotationMatrix() * (edge.first_T_second_.translation() + translationNoise) * driftedFirstScale;
+		const Quaternion world_R_second = world_T_driftedFirst.rotation() * edge.first_T_second_.rotation() * rotationNoise;
+
+		world_T_driftedPoses.emplace_back(world_t_second, world_R_second.normalized());
+		driftedScales.emplace_back(withScaleDrift ? driftedFirstScale * edge.scale_ * Random::scalar(randomGenerator, Scalar(0.99), Scalar(1.01)) : Scalar(1));
+	}
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTGEOMETRY_TEST_POSE_GRAPH_OPTIMIZATION_H
+#define META_OCEAN_TEST_TESTGEOMETRY_TEST_POSE_GRAPH_OPTIMIZATION_H
+
+#include "ocean/test/testgeometry/TestGeometry.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/geometry/PoseGraphOptimization.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestGeometry
+{
+
+/**
+ * This class implements tests for the pose graph optimization.
+ * @ingroup testgeometry
+ */
+class OCEAN_TEST_GEOMETRY_EXPORT TestPoseGraphOptimization
+{
+	public:
+
+		/**
+		 * Tests all pose graph optimization functions.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the optimization of 6-DOF poses with a drifted trajectory and a loop closure.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testOptimizePoses(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the optimization of 7-DOF similarity poses with a trajectory with scale drift and a loop closure.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testOptimizeSimilarityPoses(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a circular ground truth trajectory together with odometry and loop closure edges, and a drifted initial trajectory.
+		 * @param numberPoses The number of poses, with range [10, infinity)
+		 * @param withScaleDrift True, to create individual scales for all poses and a drifting initial scale
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_poses The resulting ground truth poses
+		 * @param scales The resulting ground truth scales, one for each pose
+		 * @param world_T_driftedPoses The resulting drifted initial poses, one for each pose
+		 * @param driftedScales The resulting drifted initial scales, one for each pose
+		 * @param edges The resulting edges, all matching with the ground truth poses
+		 */
+		static void createTrajectory(const unsigned int numberPoses, const bool withScaleDrift, RandomGenerator& randomGenerator, HomogenousMatrices4& world_T_poses, Scalars& scales, HomogenousMatrices4& world_T_driftedPoses, Scalars& driftedScales, Geometry::PoseGraphOptimization::Edges& edges);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTGEOMETRY_TEST_POSE_GRAPH_OPTIMIZATION_H
@@ -19,6 +19,8 @@
 #include "ocean/io/serialization/DataSample.h"
 #include "ocean/io/serialization/OutputDataSerializer.h"
 
+#include <map>
+
 namespace Ocean
 {
 
@@ -141,6 +143,51 @@ bool TestInputDataSerializer::test(const double testDuration, const TestSelector
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("index"))
+	{
+		testResult = testIndex(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("seek"))
+	{
+		testResult = testSeek(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("seekafterendofstream"))
+	{
+		testResult = testSeekAfterEndOfStream(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("seekdelayedchannel"))
+	{
+		testResult = testSeekDelayedChannel(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("memorymapping"))
+	{
+		testResult = testMemoryMapping(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -163,6 +210,31 @@ TEST(InputDataSerializer, Sample)
 	EXPECT_TRUE(TestInputDataSerializer::testSample(GTEST_TEST_DURATION));
 }
 
+TEST(InputDataSerializer, Index)
+{
+	EXPECT_TRUE(TestInputDataSerializer::testIndex(GTEST_TEST_DURATION));
+}
+
+TEST(InputDataSerializer, Seek)
+{
+	EXPECT_TRUE(TestInputDataSerializer::testSeek(GTEST_TEST_DURATION));
+}
+
+TEST(InputDataSerializer, SeekAfterEndOfStream)
+{
+	EXPECT_TRUE(TestInputDataSerializer::testSeekAfterEndOfStream(GTEST_TEST_DURATION));
+}
+
+TEST(InputDataSerializer, SeekDelayedChannel)
+{
+	EXPECT_TRUE(TestInputDataSerializer::testSeekDelayedChannel(GTEST_TEST_DURATION));
+}
+
+TEST(InputDataSerializer, MemoryMapping)
+{
+	EXPECT_TRUE(TestInputDataSerializer::testMemoryMapping(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestInputDataSerializer::testFactoryFunction()
@@ -418,6 +490,659 @@ bool TestInputDataSerializer::testSample(const double testDuration)
 	return validation.succeeded();
 }
 
+bool TestInputDataSerializer::testIndex(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Index test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::Serialization::InputDataSerializer::FactoryFunction factoryFunction = [](const std::string&)
+	{
+		return std::make_unique<SimpleTestDataSampleInput>();
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string tempFilename = (scopedDirectory + IO::File("test_index.dat"))();
+
+		const size_t numberSamples = size_t(RandomI::random(randomGenerator, 1u, 50u));
+		const bool writeIndex = RandomI::boolean(randomGenerator);
+
+		OCEAN_EXPECT_TRUE(validation, writeTestStream(tempFilename, numberSamples, writeIndex));
+
+		{
+			// a stream without index cannot be indexed without scanning the stream
+
+			IO::Serialization::FileInputDataSerializer serializer;
+			OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+			OCEAN_EXPECT_TRUE(validation, serializer.initialize());
+
+			OCEAN_EXPECT_EQUAL(validation, serializer.createIndex(false /*allowStreamScan*/), writeIndex);
+		}
+
+		IO::Serialization::FileInputDataSerializer serializer;
+		OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+		OCEAN_EXPECT_TRUE(validation, serializer.registerFactoryFunction("SimpleTestDataSampleInput", factoryFunction));
+
+		size_t channelEvents = 0;
+		OCEAN_EXPECT_TRUE(validation, serializer.registerChannelEventFunction([&channelEvents](const IO::Serialization::DataSerializer::Channel&) { ++channelEvents; }));
+
+		OCEAN_EXPECT_TRUE(validation, serializer.initialize());
+		OCEAN_EXPECT_FALSE(validation, serializer.hasIndex());
+
+		OCEAN_EXPECT_TRUE(validation, serializer.createIndex());
+		OCEAN_EXPECT_TRUE(validation, serializer.hasIndex());
+
+		OCEAN_EXPECT_EQUAL(validation, channelEvents, size_t(2));
+		OCEAN_EXPECT_EQUAL(validation, serializer.channels().size(), size_t(2));
+
+		const IO::Serialization::SampleIndex& sampleIndex = serializer.index();
+
+		const std::vector<IO::Serialization::DataSerializer::ChannelId> channelIds = sampleIndex.channelIds();
+		OCEAN_EXPECT_EQUAL(validation, channelIds.size(), size_t(2));
+
+		for (const IO::Serialization::DataSerializer::ChannelId channelId : channelIds)
+		{
+			OCEAN_EXPECT_EQUAL(validation, sampleIndex.numberSamples(channelId), numberSamples);
+
+			for (size_t nSample = 0; nSample < sampleIndex.numberSamples(channelId); ++nSample)
+			{
+				const IO::Serialization::SampleIndex::Entry* entry = sampleIndex.entry(channelId, nSample);
+				OCEAN_EXPECT_TRUE(validation, entry != nullptr);
+
+				if (entry != nullptr)
+				{
+					OCEAN_EXPECT_EQUAL(validation, entry->dataTimestamp_.asDouble(), double(nSample));
+
+					OCEAN_EXPECT_EQUAL(validation, sampleIndex.findSampleByDataTimestamp(channelId, double(nSample)), nSample);
+					OCEAN_EXPECT_EQUAL(validation, sampleIndex.findSampleByPlaybackTimestamp(channelId, entry->playbackTimestamp_), nSample);
+				}
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, sampleIndex.findSampleByDataTimestamp(channelId, double(numberSamples)), numberSamples);
+		}
+
+		// random access, in random order
+
+		for (size_t nIteration = 0; nIteration < numberSamples; ++nIteration)
+		{
+			const IO::Serialization::DataSerializer::ChannelId channelId = RandomI::random(randomGenerator, channelIds);
+			const size_t sampleIndexInChannel = size_t(RandomI::random(randomGenerator, (unsigned int)(numberSamples) - 1u));
+
+			const IO::Serialization::UniqueDataSample sample = serializer.randomSample(channelId, sampleIndexInChannel);
+			OCEAN_EXPECT_TRUE(validation, sample != nullptr);
+
+			const SimpleTestDataSampleInput* testSample = dynamic_cast<const SimpleTestDataSampleInput*>(sample.get());
+			OCEAN_EXPECT_TRUE(validation, testSample != nullptr);
+
+			if (testSample != nullptr)
+			{
+				const std::string expectedPayload = "Channel_" + String::toAString(channelId) + "_Sample_" + String::toAString(sampleIndexInChannel);
+
+				OCEAN_EXPECT_EQUAL(validation, testSample->payload(), expectedPayload);
+				OCEAN_EXPECT_EQUAL(validation, testSample->dataTimestamp().asDouble(), double(sampleIndexInChannel));
+			}
+		}
+
+		OCEAN_EXPECT_TRUE(validation, serializer.randomSample(channelIds.front(), numberSamples) == nullptr);
+
+		// the playback must not be affected by the index
+
+		OCEAN_EXPECT_TRUE(validation, serializer.start());
+
+		size_t receivedSamples = 0;
+
+		while (!serializer.hasFinished())
+		{
+			IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+			if (serializer.sample(channelId, 0.0) != nullptr)
+			{
+				++receivedSamples;
+			}
+			else
+			{
+				Thread::sleep(1u);
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, receivedSamples, numberSamples * 2);
+		OCEAN_EXPECT_EQUAL(validation, channelEvents, size_t(2));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestInputDataSerializer::testSeek(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Seek test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::Serialization::InputDataSerializer::FactoryFunction factoryFunction = [](const std::string&)
+	{
+		return std::make_unique<SimpleTestDataSampleInput>();
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string tempFilename = (scopedDirectory + IO::File("test_seek.dat"))();
+
+		const size_t numberSamples = size_t(RandomI::random(randomGenerator, 2u, 50u));
+
+		OCEAN_EXPECT_TRUE(validation, writeTestStream(tempFilename, numberSamples, RandomI::boolean(randomGenerator)));
+
+		IO::Serialization::FileInputDataSerializer serializer;
+		OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+		OCEAN_EXPECT_TRUE(validation, serializer.registerFactoryFunction("SimpleTestDataSampleInput", factoryFunction));
+
+		OCEAN_EXPECT_TRUE(validation, serializer.initialize());
+		OCEAN_EXPECT_TRUE(validation, serializer.createIndex());
+
+		const IO::Serialization::SampleIndex& sampleIndex = serializer.index();
+		const std::vector<IO::Serialization::DataSerializer::ChannelId> channelIds = sampleIndex.channelIds();
+
+		if (channelIds.size() != 2)
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const bool seekBeforeStart = RandomI::boolean(randomGenerator);
+
+		if (!seekBeforeStart)
+		{
+			OCEAN_EXPECT_TRUE(validation, serializer.start());
+		}
+
+		const size_t seekSampleIndex = size_t(RandomI::random(randomGenerator, (unsigned int)(numberSamples) - 1u));
+		const double seekPlaybackTimestamp = sampleIndex.entry(channelIds.front(), seekSampleIndex)->playbackTimestamp_;
+
+		OCEAN_EXPECT_TRUE(validation, serializer.seek(seekPlaybackTimestamp));
+
+		// seeking beyond the last sample is not possible
+		OCEAN_EXPECT_FALSE(validation, serializer.seek(sampleIndex.lastPlaybackTimestamp() + 1.0));
+
+		if (seekBeforeStart)
+		{
+			OCEAN_EXPECT_TRUE(validation, serializer.start());
+		}
+
+		std::vector<size_t> receivedSampleIndices;
+
+		while (!serializer.hasFinished())
+		{
+			IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+			const IO::Serialization::UniqueDataSample sample = serializer.sample(channelId, 0.0);
+
+			if (sample != nullptr)
+			{
+				OCEAN_EXPECT_GREATER_EQUAL(validation, sample->playbackTimestamp(), seekPlaybackTimestamp);
+
+				if (channelId == channelIds.front())
+				{
+					receivedSampleIndices.emplace_back(size_t(sample->dataTimestamp().asDouble()));
+				}
+			}
+			else
+			{
+				Thread::sleep(1u);
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, receivedSampleIndices.size(), numberSamples - seekSampleIndex);
+
+		std::sort(receivedSampleIndices.begin(), receivedSampleIndices.end());
+
+		for (size_t n = 0; n < receivedSampleIndices.size(); ++n)
+		{
+			OCEAN_EXPECT_EQUAL(validation, receivedSampleIndices[n], seekSampleIndex + n);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestInputDataSerializer::testSeekAfterEndOfStream(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Seek after end of stream test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::Serialization::InputDataSerializer::FactoryFunction factoryFunction = [](const std::string&)
+	{
+		return std::make_unique<SimpleTestDataSampleInput>();
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string tempFilename = (scopedDirectory + IO::File("test_seek_after_end_of_stream.dat"))();
+
+		const size_t numberSamples = size_t(RandomI::random(randomGenerator, 2u, 50u));
+
+		OCEAN_EXPECT_TRUE(validation, writeTestStream(tempFilename, numberSamples, RandomI::boolean(randomGenerator)));
+
+		IO::Serialization::FileInputDataSerializer serializer;
+		OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+		OCEAN_EXPECT_TRUE(validation, serializer.registerFactoryFunction("SimpleTestDataSampleInput", factoryFunction));
+
+		size_t channelEvents = 0;
+		OCEAN_EXPECT_TRUE(validation, serializer.registerChannelEventFunction([&channelEvents](const IO::Serialization::DataSerializer::Channel&) { ++channelEvents; }));
+
+		OCEAN_EXPECT_TRUE(validation, serializer.initialize());
+		OCEAN_EXPECT_TRUE(validation, serializer.start());
+
+		const bool createIndexWhilePlaying = RandomI::boolean(randomGenerator);
+
+		if (createIndexWhilePlaying)
+		{
+			// the index can be created while the thread is reading the stream
+
+			OCEAN_EXPECT_TRUE(validation, serializer.createIndex());
+		}
+
+		size_t receivedSamples = 0;
+
+		while (!serializer.hasFinished())
+		{
+			IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+			if (serializer.sample(channelId, 0.0) != nullptr)
+			{
+				++receivedSamples;
+			}
+			else
+			{
+				Thread::sleep(1u);
+			}
+		}
+
+		// the serializer has stopped at the end of the stream
+
+		OCEAN_EXPECT_EQUAL(validation, receivedSamples, numberSamples * 2);
+		OCEAN_EXPECT_TRUE(validation, serializer.hasStopped());
+
+		if (!createIndexWhilePlaying)
+		{
+			OCEAN_EXPECT_TRUE(validation, serializer.createIndex());
+		}
+
+		// each channel must be reported exactly once, regardless whether the channel has been parsed by the thread or while creating the index
+		OCEAN_EXPECT_EQUAL(validation, channelEvents, size_t(2));
+
+		const IO::Serialization::SampleIndex& sampleIndex = serializer.index();
+		const std::vector<IO::Serialization::DataSerializer::ChannelId> channelIds = sampleIndex.channelIds();
+
+		if (channelIds.size() != 2)
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const size_t seekSampleIndex = size_t(RandomI::random(randomGenerator, (unsigned int)(numberSamples) - 1u));
+		const double seekPlaybackTimestamp = sampleIndex.entry(channelIds.front(), seekSampleIndex)->playbackTimestamp_;
+
+		// seeking starts the serializer again
+
+		OCEAN_EXPECT_TRUE(validation, serializer.seek(seekPlaybackTimestamp));
+
+		std::vector<size_t> receivedSampleIndices;
+
+		while (!serializer.hasFinished())
+		{
+			IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+			const IO::Serialization::UniqueDataSample sample = serializer.sample(channelId, 0.0);
+
+			if (sample != nullptr)
+			{
+				if (channelId == channelIds.front())
+				{
+					receivedSampleIndices.emplace_back(size_t(sample->dataTimestamp().asDouble()));
+				}
+			}
+			else
+			{
+				Thread::sleep(1u);
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, receivedSampleIndices.size(), numberSamples - seekSampleIndex);
+
+		for (size_t n = 0; n < receivedSampleIndices.size(); ++n)
+		{
+			OCEAN_EXPECT_EQUAL(validation, receivedSampleIndices[n], seekSampleIndex + n);
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, channelEvents, size_t(2));
+
+		// a serializer which has been stopped explicitly cannot be started again
+
+		OCEAN_EXPECT_TRUE(validation, serializer.seek(seekPlaybackTimestamp));
+		OCEAN_EXPECT_TRUE(validation, serializer.stopAndWait());
+		OCEAN_EXPECT_FALSE(validation, serializer.seek(seekPlaybackTimestamp));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestInputDataSerializer::testSeekDelayedChannel(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Seek with delayed channel test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::Serialization::InputDataSerializer::FactoryFunction factoryFunction = [](const std::string&)
+	{
+		return std::make_unique<SimpleTestDataSampleInput>();
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string tempFilename = (scopedDirectory + IO::File("test_seek_delayed_channel.dat"))();
+
+		const size_t numberSamples = size_t(RandomI::random(randomGenerator, 2u, 50u));
+		const size_t delayedSamples = size_t(RandomI::random(randomGenerator, 1u, 10u));
+
+		OCEAN_EXPECT_TRUE(validation, writeTestStream(tempFilename, numberSamples, RandomI::boolean(randomGenerator), delayedSamples));
+
+		IO::Serialization::FileInputDataSerializer serializer;
+		OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+		OCEAN_EXPECT_TRUE(validation, serializer.registerFactoryFunction("SimpleTestDataSampleInput", factoryFunction));
+
+		OCEAN_EXPECT_TRUE(validation, serializer.initialize());
+		OCEAN_EXPECT_TRUE(validation, serializer.createIndex());
+
+		const IO::Serialization::SampleIndex& sampleIndex = serializer.index();
+		const std::vector<IO::Serialization::DataSerializer::ChannelId> channelIds = sampleIndex.channelIds();
+
+		if (channelIds.size() != 2)
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const bool seekBeforeStart = RandomI::boolean(randomGenerator);
+
+		if (!seekBeforeStart)
+		{
+			OCEAN_EXPECT_TRUE(validation, serializer.start());
+		}
+
+		// we seek to a random sample of a random channel, the stream position of the other channel may be earlier or later
+
+		const IO::Serialization::DataSerializer::ChannelId seekChannelId = RandomI::random(randomGenerator, channelIds);
+		const size_t seekSampleIndex = size_t(RandomI::random(randomGenerator, (unsigned int)(numberSamples) - 1u));
+		const double seekPlaybackTimestamp = sampleIndex.entry(seekChannelId, seekSampleIndex)->playbackTimestamp_;
+
+		OCEAN_EXPECT_TRUE(validation, serializer.seek(seekPlaybackTimestamp));
+
+		if (seekBeforeStart)
+		{
+			OCEAN_EXPECT_TRUE(validation, serializer.start());
+		}
+
+		std::map<IO::Serialization::DataSerializer::ChannelId, std::vector<size_t>> receivedSampleIndicesMap;
+
+		while (!serializer.hasFinished())
+		{
+			IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+			const IO::Serialization::UniqueDataSample sample = serializer.sample(channelId, 0.0);
+
+			if (sample != nullptr)
+			{
+				OCEAN_EXPECT_GREATER_EQUAL(validation, sample->playbackTimestamp(), seekPlaybackTimestamp);
+
+				receivedSampleIndicesMap[channelId].emplace_back(size_t(sample->dataTimestamp().asDouble()));
+			}
+			else
+			{
+				Thread::sleep(1u);
+			}
+		}
+
+		// each channel must continue with its first sample at or after the seek timestamp, without gaps and without earlier samples
+
+		for (const IO::Serialization::DataSerializer::ChannelId channelId : channelIds)
+		{
+			const size_t firstSampleIndex = sampleIndex.findSampleByPlaybackTimestamp(channelId, seekPlaybackTimestamp);
+
+			std::vector<size_t>& receivedSampleIndices = receivedSampleIndicesMap[channelId];
+
+			OCEAN_EXPECT_EQUAL(validation, receivedSampleIndices.size(), numberSamples - firstSampleIndex);
+
+			std::sort(receivedSampleIndices.begin(), receivedSampleIndices.end());
+
+			for (size_t n = 0; n < receivedSampleIndices.size(); ++n)
+			{
+				OCEAN_EXPECT_EQUAL(validation, receivedSampleIndices[n], firstSampleIndex + n);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestInputDataSerializer::testMemoryMapping(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Memory mapping test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const IO::Serialization::InputDataSerializer::FactoryFunction factoryFunction = [](const std::string&)
+	{
+		return std::make_unique<SimpleTestDataSampleInput>();
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string tempFilename = (scopedDirectory + IO::File("test_memory_mapping.dat"))();
+
+		const size_t numberSamples = size_t(RandomI::random(randomGenerator, 1u, 50u));
+
+		OCEAN_EXPECT_TRUE(validation, writeTestStream(tempFilename, numberSamples, RandomI::boolean(randomGenerator)));
+
+		IO::Serialization::FileInputDataSerializer serializer;
+		OCEAN_EXPECT_TRUE(validation, serializer.setFilename(tempFilename));
+		OCEAN_EXPECT_TRUE(validation, serializer.setUseMemoryMapping(true));
+		OCEAN_EXPECT_TRUE(validation, serializer.registerFactoryFunction("SimpleTestDataSampleInput", factoryFunction));
+
+		OCEAN_EXPECT_TRUE(validation, serializer.initialize());
+
+		OCEAN_EXPECT_TRUE(validation, serializer.createIndex());
+
+		const std::vector<IO::Serialization::DataSerializer::ChannelId> channelIds = serializer.index().channelIds();
+		OCEAN_EXPECT_EQUAL(validation, channelIds.size(), size_t(2));
+
+		if (!channelIds.empty())
+		{
+			const size_t sampleIndexInChannel = size_t(RandomI::random(randomGenerator, (unsigned int)(numberSamples) - 1u));
+
+			const IO::Serialization::UniqueDataSample sample = serializer.randomSample(channelIds.back(), sampleIndexInChannel);
+			const SimpleTestDataSampleInput* testSample = dynamic_cast<const SimpleTestDataSampleInput*>(sample.get());
+
+			OCEAN_EXPECT_TRUE(validation, testSample != nullptr);
+
+			if (testSample != nullptr)
+			{
+				OCEAN_EXPECT_EQUAL(validation, testSample->payload(), "Channel_" + String::toAString(channelIds.back()) + "_Sample_" + String::toAString(sampleIndexInChannel));
+			}
+		}
+
+		OCEAN_EXPECT_TRUE(validation, serializer.start());
+
+		std::unordered_map<IO::Serialization::DataSerializer::ChannelId, size_t> nextSampleIndexMap;
+
+		while (!serializer.hasFinished())
+		{
+			IO::Serialization::DataSerializer::ChannelId channelId = IO::Serialization::DataSerializer::invalidChannelId();
+
+			const IO::Serialization::UniqueDataSample sample = serializer.sample(channelId, 0.0);
+
+			if (sample != nullptr)
+			{
+				size_t& nextSampleIndex = nextSampleIndexMap[channelId];
+
+				const SimpleTestDataSampleInput* testSample = dynamic_cast<const SimpleTestDataSampleInput*>(sample.get());
+				OCEAN_EXPECT_TRUE(validation, testSample != nullptr);
+
+				if (testSample != nullptr)
+				{
+					// the samples of each channel must arrive in order and with identical payload
+
+					OCEAN_EXPECT_EQUAL(validation, testSample->payload(), "Channel_" + String::toAString(channelId) + "_Sample_" + String::toAString(nextSampleIndex));
+				}
+
+				++nextSampleIndex;
+			}
+			else
+			{
+				Thread::sleep(1u);
+			}
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, nextSampleIndexMap.size(), size_t(2));
+
+		for (const std::unordered_map<IO::Serialization::DataSerializer::ChannelId, size_t>::value_type& nextSampleIndexPair : nextSampleIndexMap)
+		{
+			OCEAN_EXPECT_EQUAL(validation, nextSampleIndexPair.second, numberSamples);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestInputDataSerializer::writeTestStream(const std::string& filename, const size_t numberSamples, const bool writeIndex, const size_t delayedSamples)
+{
+	ocean_assert(!filename.empty() && numberSamples >= 1);
+
+	IO::Serialization::FileOutputDataSerializer outputSerializer;
+
+	if (!outputSerializer.setFilename(filename) || !outputSerializer.setIndexEnabled(writeIndex))
+	{
+		return false;
+	}
+
+	const IO::Serialization::DataSerializer::ChannelId channelIdA = outputSerializer.addChannel("SimpleTestDataSampleInput", "TestChannelA", "TestContent");
+	const IO::Serialization::DataSerializer::ChannelId channelIdB = outputSerializer.addChannel("SimpleTestDataSampleInput", "TestChannelB", "TestContent");
+
+	if (channelIdA == IO::Serialization::DataSerializer::invalidChannelId() || channelIdB == IO::Serialization::DataSerializer::invalidChannelId())
+	{
+		return false;
+	}
+
+	if (!outputSerializer.start())
+	{
+		return false;
+	}
+
+	// the samples get increasing creation timestamps so that the playback timestamps are strictly increasing within each channel
+	// the samples of the second channel are written together with samples of the first channel which have been created 'delayedSamples' samples later
+
+	const Timestamp creationTimestamp(true);
+
+	for (size_t nSample = 0; nSample < numberSamples; ++nSample)
+	{
+		for (const IO::Serialization::DataSerializer::ChannelId channelId : {channelIdA, channelIdB})
+		{
+			const std::string payload = "Channel_" + String::toAString(channelId) + "_Sample_" + String::toAString(nSample);
+
+			const size_t delay = channelId == channelIdA ? delayedSamples : 0;
+
+			const Timestamp sampleCreationTimestamp = creationTimestamp + double((nSample + delay) * 2 + channelId) * 0.001;
+
+			if (!outputSerializer.addSample(channelId, std::make_unique<SimpleTestDataSampleInput>(IO::Serialization::DataTimestamp(double(nSample)), payload, sampleCreationTimestamp)))
+			{
+				return false;
+			}
+		}
+	}
+
+	return outputSerializer.stopAndWait(10.0);
+}
+
 }
 
 }
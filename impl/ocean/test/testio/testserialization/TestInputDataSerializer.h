@@ -63,6 +63,53 @@ class OCEAN_TEST_IO_SERIALIZATION_EXPORT TestInputDataSerializer
 		 * @return True, if succeeded
 		 */
 		static bool testSample(const double testDuration);
+
+		/**
+		 * Tests the index of a stream, either read from the stream or reconstructed by scanning the stream, and the random sample access.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testIndex(const double testDuration);
+
+		/**
+		 * Tests seeking within a stream.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testSeek(const double testDuration);
+
+		/**
+		 * Tests creating the index while the stream is played and seeking after the end of the stream has been reached.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testSeekAfterEndOfStream(const double testDuration);
+
+		/**
+		 * Tests seeking within a stream in which the samples of one channel are written later than samples of the other channel with later playback timestamps.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testSeekDelayedChannel(const double testDuration);
+
+		/**
+		 * Tests reading a stream from a memory-mapped file.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testMemoryMapping(const double testDuration);
+
+	protected:
+
+		/**
+		 * Writes a stream with two channels and random samples to a file.
+		 * @param filename The name of the file to write, must be valid
+		 * @param numberSamples The number of samples for each channel, with range [1, infinity)
+		 * @param writeIndex True, to write the index at the end of the stream
+		 * @param delayedSamples The number of samples by which the samples of the second channel are written later than their playback timestamps indicate, with range [0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool writeTestStream(const std::string& filename, const size_t numberSamples, const bool writeIndex, const size_t delayedSamples = 0);
 };
 
 }
@@ -21,9 +21,13 @@
 
 #include "ocean/media/BufferImage.h"
 #include "ocean/media/BufferImageRecorder.h"
+#include "ocean/media/ImageFileSequence.h"
 #include "ocean/media/Manager.h"
 
+#include "ocean/io/Directory.h"
+
 #include "ocean/media/openimagelibraries/Image.h"
+#include "ocean/media/openimagelibraries/OILImageSequenceRecorder.h"
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_JPG
 	#include "ocean/media/openimagelibraries/ImageJpg.h"
@@ -88,6 +92,15 @@ bool TestOpenImageLibraries::test(const double testDuration, const TestSelector&
 		Log::info() << "-";
 		Log::info() << " ";
 	}
+
+	if (selector.shouldRun("jpgparallelencoding"))
+	{
+		testResult = testJpgParallelEncoding(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
 #else
 	Log::info() << "Skipping JPG as not supported on this platforms.";
 
@@ -216,6 +229,24 @@ bool TestOpenImageLibraries::test(const double testDuration, const TestSelector&
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("imagesequenceprefetching"))
+	{
+		testResult = testImageSequencePrefetching();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("imagesequencerecorderparallel"))
+	{
+		testResult = testImageSequenceRecorderParallel();
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	if (selector.shouldRun("decodestresstest"))
 	{
 #ifdef OCEAN_DEBUG
@@ -375,6 +406,11 @@ TEST_F(TestOpenImageLibrariesGTestInstance, JpgImageRGB24Recorder)
 	}
 #endif
 
+TEST_F(TestOpenImageLibrariesGTestInstance, JpgParallelEncoding)
+{
+	EXPECT_TRUE(TestOpenImageLibraries::testJpgParallelEncoding(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
@@ -553,6 +589,16 @@ TEST_F(TestOpenImageLibrariesGTestInstance, AnyImageEncodeDecode)
 	EXPECT_TRUE(TestOpenImageLibraries::testAnyImageEncodeDecode(GTEST_TEST_DURATION));
 }
 
+TEST_F(TestOpenImageLibrariesGTestInstance, ImageSequencePrefetching)
+{
+	EXPECT_TRUE(TestOpenImageLibraries::testImageSequencePrefetching());
+}
+
+TEST_F(TestOpenImageLibrariesGTestInstance, ImageSequenceRecorderParallel)
+{
+	EXPECT_TRUE(TestOpenImageLibraries::testImageSequenceRecorderParallel());
+}
+
 
 #ifndef OCEAN_DEBUG
 	TEST_F(TestOpenImageLibrariesGTestInstance, DecodeStressTest)
@@ -932,6 +978,226 @@ bool TestOpenImageLibraries::testAnyImageEncodeDecode(const double testDuration)
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_JPG
 
+bool TestOpenImageLibraries::testImageSequencePrefetching()
+{
+	Log::info() << "Image sequence prefetching test:";
+
+#ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int numberImages = 20u;
+
+	const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+	Frames sourceFrames;
+	sourceFrames.reserve(numberImages);
+
+	for (unsigned int n = 0u; n < numberImages; ++n)
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 64u);
+		const unsigned int height = RandomI::random(randomGenerator, 1u, 64u);
+
+		sourceFrames.emplace_back(CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator));
+
+		const IO::File file = scopedDirectory + IO::File("image_" + String::toAString(n, 3u) + ".png");
+
+		if (!Media::OpenImageLibraries::Image::writeImage(sourceFrames.back(), file(), false))
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+
+	const IO::File firstFile = scopedDirectory + IO::File("image_000.png");
+
+	for (const Media::ImageFileSequence::PrefetchMode prefetchMode : {Media::ImageFileSequence::PM_DISABLED, Media::ImageFileSequence::PM_SEQUENTIAL, Media::ImageFileSequence::PM_EXPLICIT})
+	{
+		const Media::ImageSequenceRef imageSequence = Media::Manager::get().newMedium(firstFile(), Media::Medium::IMAGE_SEQUENCE, true /*useExclusive*/);
+
+		if (imageSequence.isNull())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		Media::ImageFileSequence* imageFileSequence = dynamic_cast<Media::ImageFileSequence*>(imageSequence.pointer());
+
+		if (imageFileSequence == nullptr || !imageFileSequence->setPrefetching(prefetchMode, RandomI::random(randomGenerator, 1u, 8u), RandomI::random(randomGenerator, 1u, 4u)))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, imageFileSequence->prefetchMode(), prefetchMode);
+		OCEAN_EXPECT_EQUAL(validation, imageSequence->images(), numberImages);
+
+		imageSequence->setPreferredFrameFrequency(Media::FrameMedium::FrameFrequency(0));
+		imageSequence->setMode(Media::ImageSequence::SM_EXPLICIT);
+
+		// sequential access
+
+		if (imageSequence->start())
+		{
+			for (unsigned int n = 0u; n < numberImages; ++n)
+			{
+				if (n != 0u && !imageSequence->forceNextFrame())
+				{
+					OCEAN_SET_FAILED(validation);
+					break;
+				}
+
+				const FrameRef frame = imageSequence->frame();
+
+				double minDifference, aveDifference, maxDifference;
+				if (frame.isNull() || frame->frameType() != sourceFrames[n].frameType() || !determineSimilarity(sourceFrames[n], *frame, minDifference, aveDifference, maxDifference) || maxDifference != 0.0)
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			imageSequence->stop();
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// random access, as used by frame provider interfaces
+
+		for (unsigned int iteration = 0u; iteration < numberImages * 2u; ++iteration)
+		{
+			const unsigned int index = RandomI::random(randomGenerator, numberImages - 1u);
+
+			if (prefetchMode == Media::ImageFileSequence::PM_EXPLICIT)
+			{
+				imageFileSequence->prefetchImage(RandomI::random(randomGenerator, numberImages - 1u));
+				imageFileSequence->prefetchImage(index);
+			}
+
+			if (!imageSequence->setPosition(double(index)) || !imageSequence->start())
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			const FrameRef frame = imageSequence->frame();
+
+			double minDifference, aveDifference, maxDifference;
+			if (frame.isNull() || frame->frameType() != sourceFrames[index].frameType() || !determineSimilarity(sourceFrames[index], *frame, minDifference, aveDifference, maxDifference) || maxDifference != 0.0)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+
+			imageSequence->stop();
+		}
+
+		OCEAN_EXPECT_FALSE(validation, imageFileSequence->prefetchImage(numberImages));
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+
+#else
+
+	Log::info() << "Skipping as PNG is not supported on this platform.";
+
+	return true;
+
+#endif // OCEAN_MEDIA_OIL_SUPPORT_PNG
+}
+
+bool TestOpenImageLibraries::testImageSequenceRecorderParallel()
+{
+	Log::info() << "Image sequence recorder with parallel encoding test:";
+
+#ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	constexpr unsigned int numberImages = 30u;
+
+	const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+	const unsigned int startIndex = RandomI::random(randomGenerator, 0u, 10u);
+
+	const Media::ImageSequenceRecorderRef imageSequenceRecorder = Media::Manager::get().newRecorder(Media::Recorder::IMAGE_SEQUENCE_RECORDER);
+
+	Media::OpenImageLibraries::OILImageSequenceRecorder* oilImageSequenceRecorder = dynamic_cast<Media::OpenImageLibraries::OILImageSequenceRecorder*>(imageSequenceRecorder.pointer());
+
+	if (oilImageSequenceRecorder == nullptr)
+	{
+		OCEAN_SET_FAILED(validation);
+
+		Log::info() << "Validation: " << validation;
+		return validation.succeeded();
+	}
+
+	OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->setMode(Media::ImageSequenceRecorder::RM_PARALLEL));
+	OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->setStartIndex(startIndex));
+	OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->setEncoderThreads(RandomI::random(randomGenerator, 1u, 4u)));
+	OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->setMaximalPendingImages(RandomI::random(randomGenerator, 1u, 8u)));
+	OCEAN_EXPECT_FALSE(validation, oilImageSequenceRecorder->setMaximalPendingImages(0u));
+
+	OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->setFilenameSuffixed(false));
+	OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->setFilename((scopedDirectory + IO::File("image_.png"))()));
+
+	Frames sourceFrames;
+	sourceFrames.reserve(numberImages);
+
+	if (oilImageSequenceRecorder->start())
+	{
+		OCEAN_EXPECT_FALSE(validation, oilImageSequenceRecorder->setEncoderThreads(2u));
+
+		for (unsigned int n = 0u; n < numberImages; ++n)
+		{
+			const unsigned int width = RandomI::random(randomGenerator, 1u, 256u);
+			const unsigned int height = RandomI::random(randomGenerator, 1u, 256u);
+
+			sourceFrames.emplace_back(CV::CVUtilities::randomizedFrame(FrameType(width, height, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator));
+
+			OCEAN_EXPECT_TRUE(validation, oilImageSequenceRecorder->addImage(sourceFrames.back()));
+		}
+
+		// stop() returns once all pending images have been written
+
+		oilImageSequenceRecorder->stop();
+
+		OCEAN_EXPECT_EQUAL(validation, oilImageSequenceRecorder->pendingImages(), 0u);
+	}
+	else
+	{
+		OCEAN_SET_FAILED(validation);
+	}
+
+	for (size_t n = 0; n < sourceFrames.size(); ++n)
+	{
+		const IO::File file = scopedDirectory + IO::File("image_" + String::toAString((unsigned int)(n) + startIndex, 5u) + ".png");
+
+		const Frame frame = Media::OpenImageLibraries::Image::readImage(file());
+
+		double minDifference, aveDifference, maxDifference;
+		if (!frame.isValid() || frame.frameType() != sourceFrames[n].frameType() || !determineSimilarity(sourceFrames[n], frame, minDifference, aveDifference, maxDifference) || maxDifference != 0.0)
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+
+#else
+
+	Log::info() << "Skipping as PNG is not supported on this platform.";
+
+	return true;
+
+#endif // OCEAN_MEDIA_OIL_SUPPORT_PNG
+}
+
 bool TestOpenImageLibraries::testJpgImageEncodeDecode(const unsigned int width, const unsigned int height, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const double testDuration)
 {
 	ocean_assert(testDuration > 0.0);
@@ -1099,6 +1365,73 @@ bool TestOpenImageLibraries::testJpgDecodeStressTest()
 	return true;
 }
 
+bool TestOpenImageLibraries::testJpgParallelEncoding(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "JPEG parallel encoding test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	// the strips are encoded with individual threads, so that we need a worker with several threads even on single core devices
+	Worker worker(4u, Worker::TYPE_CUSTOM);
+
+	HighPerformanceStatistic performanceSequential, performanceParallel;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const FrameType::PixelFormat pixelFormat : {FrameType::FORMAT_Y8, FrameType::FORMAT_RGB24, FrameType::FORMAT_YUV24})
+		{
+			const unsigned int width = RandomI::random(randomGenerator, 1u, 1920u);
+			const unsigned int height = RandomI::random(randomGenerator, 256u, 1080u);
+
+			Frame sourceFrame = CV::CVUtilities::randomizedFrame(FrameType(width, height, pixelFormat, FrameType::ORIGIN_UPPER_LEFT), &randomGenerator);
+			CV::FrameFilterGaussian::filter(sourceFrame, 7u, WorkerPool::get().scopedWorker()());
+
+			const int quality = int(RandomI::random(randomGenerator, 50u, 100u));
+
+			std::vector<uint8_t> sequentialBuffer;
+			std::vector<uint8_t> parallelBuffer;
+
+			performanceSequential.start();
+				const bool sequentialSucceeded = Media::OpenImageLibraries::ImageJpg::encodeImage(sourceFrame, sequentialBuffer, false, nullptr, quality);
+			performanceSequential.stop();
+
+			performanceParallel.start();
+				const bool parallelSucceeded = Media::OpenImageLibraries::ImageJpg::encodeImage(sourceFrame, parallelBuffer, false, nullptr, quality, &worker);
+			performanceParallel.stop();
+
+			if (!sequentialSucceeded || !parallelSucceeded)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			const Frame sequentialFrame = Media::OpenImageLibraries::ImageJpg::decodeImage(sequentialBuffer.data(), sequentialBuffer.size());
+			const Frame parallelFrame = Media::OpenImageLibraries::ImageJpg::decodeImage(parallelBuffer.data(), parallelBuffer.size());
+
+			// restart markers reset the entropy coder only, both images must decode to identical pixels
+
+			double minDifference, aveDifference, maxDifference;
+			if (!sequentialFrame.isValid() || !parallelFrame.isValid() || sequentialFrame.frameType() != parallelFrame.frameType() || !determineSimilarity(sequentialFrame, parallelFrame, minDifference, aveDifference, maxDifference) || maxDifference != 0.0)
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Sequential performance: " << performanceSequential;
+	Log::info() << "Parallel performance: " << performanceParallel;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
 #endif // OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
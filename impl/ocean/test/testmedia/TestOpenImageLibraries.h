@@ -90,6 +90,18 @@ class OCEAN_TEST_MEDIA_EXPORT TestOpenImageLibraries
 		 */
 		static bool testAnyImageEncodeDecode(const double testDuration);
 
+		/**
+		 * Tests the image sequence with sequential and explicit prefetching of images.
+		 * @return True, if succeeded
+		 */
+		static bool testImageSequencePrefetching();
+
+		/**
+		 * Tests the image sequence recorder encoding images asynchronously with several encoder threads.
+		 * @return True, if succeeded
+		 */
+		static bool testImageSequenceRecorderParallel();
+
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 		/**
@@ -109,6 +121,13 @@ class OCEAN_TEST_MEDIA_EXPORT TestOpenImageLibraries
 		 */
 		static bool testJpgDecodeStressTest();
 
+		/**
+		 * Tests encoding JPEG images in parallel strips.
+		 * @param testDuration The number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testJpgParallelEncoding(const double testDuration);
+
 #endif // OCEAN_MEDIA_OIL_SUPPORT_JPG
 
 #ifdef OCEAN_MEDIA_OIL_SUPPORT_PNG
@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/TestQRCodeTracker2D.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+#include "ocean/test/ValidationPrecision.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/FrameInterpolatorBilinear.h"
+
+#include "ocean/cv/detector/qrcodes/QRCodeEncoder.h"
+#include "ocean/cv/detector/qrcodes/Utilities.h"
+
+#include "ocean/geometry/Homography.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/tracking/qrcodes/QRCodeTracker2D.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+using QRCode = CV::Detector::QRCodes::QRCode;
+
+bool TestQRCodeTracker2D::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("QRCodeTracker2D test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("trackmovingcode"))
+	{
+		testResult = testTrackMovingCode(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("redecode"))
+	{
+		testResult = testRedecode(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("isalreadytracked"))
+	{
+		testResult = testIsAlreadyTracked(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestQRCodeTracker2D, TrackMovingCode)
+{
+	EXPECT_TRUE(TestQRCodeTracker2D::testTrackMovingCode(GTEST_TEST_DURATION));
+}
+
+TEST(TestQRCodeTracker2D, Redecode)
+{
+	EXPECT_TRUE(TestQRCodeTracker2D::testRedecode(GTEST_TEST_DURATION));
+}
+
+TEST(TestQRCodeTracker2D, IsAlreadyTracked)
+{
+	EXPECT_TRUE(TestQRCodeTracker2D::testIsAlreadyTracked(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestQRCodeTracker2D::testTrackMovingCode(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Track moving code test:";
+
+	using QRCodeTracker2D = Tracking::QRCodes::QRCodeTracker2D;
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator, 50u);
+
+	const AnyCameraPinhole anyCamera(PinholeCamera(640u, 480u, Numeric::deg2rad(Scalar(60))));
+
+	constexpr unsigned int numberFrames = 30u;
+
+	const Vectors3 objectCorners = CV::Detector::QRCodes::Utilities::CoordinateSystem::computeCornersInObjectSpace();
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		QRCode code;
+		if (!createRandomCode(randomGenerator, code))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		// the code moves and rotates in front of the camera
+
+		const Scalar distance = Random::scalar(randomGenerator, Scalar(5), Scalar(7));
+
+		const Vector2 startTranslation = Random::vector2(randomGenerator, Scalar(-0.6), Scalar(0.6), Scalar(-0.4), Scalar(0.4));
+		const Vector2 endTranslation = Random::vector2(randomGenerator, Scalar(-0.6), Scalar(0.6), Scalar(-0.4), Scalar(0.4));
+
+		const Scalar startRoll = Random::scalar(randomGenerator, Numeric::deg2rad(Scalar(-15)), Numeric::deg2rad(Scalar(15)));
+		const Scalar endRoll = Random::scalar(randomGenerator, Numeric::deg2rad(Scalar(-15)), Numeric::deg2rad(Scalar(15)));
+
+		const Quaternion tilt(Random::vector3(randomGenerator), Random::scalar(randomGenerator, Numeric::deg2rad(Scalar(0)), Numeric::deg2rad(Scalar(10))));
+
+		QRCodeTracker2D qrcodeTracker;
+
+		QRCodeTracker2D::ObjectId objectId = QRCodeTracker2D::ObjectId(-1);
+
+		for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			const Scalar factor = Scalar(frameIndex) / Scalar(numberFrames - 1u);
+
+			const Vector2 translation = startTranslation * (Scalar(1) - factor) + endTranslation * factor;
+			const Scalar roll = startRoll * (Scalar(1) - factor) + endRoll * factor;
+
+			const HomogenousMatrix4 code_T_camera(Vector3(translation, distance), tilt * Quaternion(Vector3(0, 0, 1), roll));
+
+			Frame yFrame;
+			if (!renderCode(anyCamera, code, code_T_camera, yFrame))
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			const QRCodeTracker2D::TrackedQRCodesMap& trackedQRCodesMap = qrcodeTracker.trackQRCodes(anyCamera, yFrame);
+
+			if (trackedQRCodesMap.size() != 1)
+			{
+				scopedIteration.setInaccurate();
+				continue;
+			}
+
+			const QRCodeTracker2D::ObjectId trackedObjectId = trackedQRCodesMap.cbegin()->first;
+			const QRCodeTracker2D::TrackedQRCode& trackedCode = trackedQRCodesMap.cbegin()->second;
+
+			// the code must keep its id, also when it is detected again
+
+			if (objectId == QRCodeTracker2D::ObjectId(-1))
+			{
+				objectId = trackedObjectId;
+			}
+			else if (trackedObjectId != objectId)
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			if (!trackedCode.isValid() || !trackedCode.code().isSame(code, /* ignoreModules */ true))
+			{
+				scopedIteration.setInaccurate();
+				continue;
+			}
+
+			// with default parameters, the detection is applied in every 10th frame
+
+			if (frameIndex % 10u == 0u)
+			{
+				if (trackedCode.trackingState() != QRCodeTracker2D::TS_DETECTED)
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+			else if (trackedCode.trackingState() != QRCodeTracker2D::TS_TRACKED && trackedCode.trackingState() != QRCodeTracker2D::TS_REDECODED)
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			// the tracked corners must be close to the ground truth corners
+
+			const Vectors2& imageCorners = trackedCode.imageCorners();
+			ocean_assert(imageCorners.size() == objectCorners.size());
+
+			for (size_t n = 0; n < objectCorners.size(); ++n)
+			{
+				const Vector2 groundTruthImageCorner = anyCamera.projectToImage(code_T_camera, objectCorners[n]);
+
+				if (groundTruthImageCorner.distance(imageCorners[n]) > Scalar(1.5))
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestQRCodeTracker2D::testRedecode(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Redecode test:";
+
+	using QRCodeTracker2D = Tracking::QRCodes::QRCodeTracker2D;
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator, 50u);
+
+	const AnyCameraPinhole anyCamera(PinholeCamera(640u, 480u, Numeric::deg2rad(Scalar(60))));
+
+	constexpr unsigned int numberFrames = 10u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		QRCode code;
+		if (!createRandomCode(randomGenerator, code))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		// the tracker applies the detection in the first frame only, and does never trust the tracking so that the code must be decoded in each frame
+
+		QRCodeTracker2D::Parameters parameters;
+		parameters.detectionCadence_ = 1000u;
+		parameters.minimalTrackedCornersPercent_ = Scalar(1);
+		parameters.maximalProjectionError_ = Numeric::weakEps();
+
+		QRCodeTracker2D qrcodeTracker(parameters);
+
+		const Scalar distance = Random::scalar(randomGenerator, Scalar(5), Scalar(7));
+		const Vector2 startTranslation = Random::vector2(randomGenerator, Scalar(-0.4), Scalar(0.4), Scalar(-0.3), Scalar(0.3));
+		const Vector2 motion = Random::vector2(randomGenerator, Scalar(-0.02), Scalar(0.02));
+
+		for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			const HomogenousMatrix4 code_T_camera(Vector3(startTranslation + motion * Scalar(frameIndex), distance));
+
+			Frame yFrame;
+			if (!renderCode(anyCamera, code, code_T_camera, yFrame))
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			const QRCodeTracker2D::TrackedQRCodesMap& trackedQRCodesMap = qrcodeTracker.trackQRCodes(anyCamera, yFrame);
+
+			if (trackedQRCodesMap.size() == 1 && trackedQRCodesMap.cbegin()->second.code().isSame(code, /* ignoreModules */ true))
+			{
+				const QRCodeTracker2D::TrackingState expectedTrackingState = frameIndex == 0u ? QRCodeTracker2D::TS_DETECTED : QRCodeTracker2D::TS_REDECODED;
+
+				if (trackedQRCodesMap.cbegin()->second.trackingState() != expectedTrackingState)
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+			else
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+
+		// once the code disappears, the code cannot be decoded anymore and must be removed
+
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			Frame yFrame(FrameType(anyCamera.width(), anyCamera.height(), FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+			yFrame.setValue(0xFFu);
+
+			if (!qrcodeTracker.trackQRCodes(anyCamera, yFrame).empty())
+			{
+				scopedIteration.setInaccurate();
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestQRCodeTracker2D::testIsAlreadyTracked(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Is already tracked test:";
+
+	using QRCodeTracker2D = Tracking::QRCodes::QRCodeTracker2D;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const auto squareCorners = [](const Vector2& center, const Scalar size)
+	{
+		const Scalar size_2 = size * Scalar(0.5);
+
+		return Vectors2({center + Vector2(-size_2, -size_2), center + Vector2(-size_2, size_2), center + Vector2(size_2, size_2), center + Vector2(size_2, -size_2)});
+	};
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		QRCode code;
+		QRCode otherCode;
+
+		if (!createRandomCode(randomGenerator, code) || !createRandomCode(randomGenerator, otherCode))
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		if (code.isSame(otherCode, /* ignoreModules */ true))
+		{
+			continue;
+		}
+
+		const Scalar size = Random::scalar(randomGenerator, Scalar(50), Scalar(200));
+
+		const Vector2 firstCenter = Random::vector2(randomGenerator, Scalar(0), Scalar(1000));
+		const Vector2 secondCenter = firstCenter + Random::vector2(randomGenerator, Scalar(-1), Scalar(1)).normalizedOrZero() * size * Scalar(3);
+
+		// the same code is tracked at two locations, a different code is tracked at the first location
+
+		const QRCodeTracker2D::ObjectId firstObjectId = RandomI::random32(randomGenerator);
+		const QRCodeTracker2D::ObjectId secondObjectId = firstObjectId + 1u;
+		const QRCodeTracker2D::ObjectId otherObjectId = firstObjectId + 2u;
+
+		QRCodeTracker2D::TrackedQRCodesMap trackedQRCodesMap;
+		trackedQRCodesMap.emplace(firstObjectId, QRCodeTracker2D::TrackedQRCode(QRCode(code), HomogenousMatrix4(true), true, 128u, squareCorners(firstCenter, size)));
+		trackedQRCodesMap.emplace(secondObjectId, QRCodeTracker2D::TrackedQRCode(QRCode(code), HomogenousMatrix4(true), true, 128u, squareCorners(secondCenter, size)));
+		trackedQRCodesMap.emplace(otherObjectId, QRCodeTracker2D::TrackedQRCode(QRCode(otherCode), HomogenousMatrix4(true), true, 128u, squareCorners(firstCenter, size)));
+
+		// a detection overlapping with a tracked code must reuse the id of the code
+
+		for (const bool useFirstCenter : {true, false})
+		{
+			const Vector2& center = useFirstCenter ? firstCenter : secondCenter;
+			const Vector2 detectedCenter = center + Random::vector2(randomGenerator, Scalar(-1), Scalar(1)).normalizedOrZero() * size * Random::scalar(randomGenerator, Scalar(0), Scalar(0.5));
+
+			QRCodeTracker2D::ObjectId objectId = QRCodeTracker2D::ObjectId(-1);
+			OCEAN_EXPECT_TRUE(validation, QRCodeTracker2D::isAlreadyTracked(trackedQRCodesMap, code, squareCorners(detectedCenter, size * Random::scalar(randomGenerator, Scalar(0.8), Scalar(1.2))), objectId));
+			OCEAN_EXPECT_EQUAL(validation, objectId, useFirstCenter ? firstObjectId : secondObjectId);
+		}
+
+		{
+			QRCodeTracker2D::ObjectId objectId = QRCodeTracker2D::ObjectId(-1);
+			OCEAN_EXPECT_TRUE(validation, QRCodeTracker2D::isAlreadyTracked(trackedQRCodesMap, otherCode, squareCorners(firstCenter, size), objectId));
+			OCEAN_EXPECT_EQUAL(validation, objectId, otherObjectId);
+		}
+
+		// a detection not overlapping with any tracked copy of the code is a new code
+
+		{
+			const Vector2 detectedCenter = firstCenter - (secondCenter - firstCenter);
+
+			QRCodeTracker2D::ObjectId objectId = QRCodeTracker2D::ObjectId(-1);
+			OCEAN_EXPECT_FALSE(validation, QRCodeTracker2D::isAlreadyTracked(trackedQRCodesMap, code, squareCorners(detectedCenter, size), objectId));
+		}
+
+		// the other code is tracked at the first location only
+
+		{
+			QRCodeTracker2D::ObjectId objectId = QRCodeTracker2D::ObjectId(-1);
+			OCEAN_EXPECT_FALSE(validation, QRCodeTracker2D::isAlreadyTracked(trackedQRCodesMap, otherCode, squareCorners(secondCenter, size), objectId));
+		}
+
+		// a code which is not tracked at all is a new code
+
+		{
+			QRCodeTracker2D::ObjectId objectId = QRCodeTracker2D::ObjectId(-1);
+			OCEAN_EXPECT_FALSE(validation, QRCodeTracker2D::isAlreadyTracked(QRCodeTracker2D::TrackedQRCodesMap(), code, squareCorners(firstCenter, size), objectId));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestQRCodeTracker2D::createRandomCode(RandomGenerator& randomGenerator, QRCode& code)
+{
+	constexpr QRCode::ErrorCorrectionCapacity errorCorrectionCapacities[4] =
+	{
+		QRCode::ECC_07,
+		QRCode::ECC_15,
+		QRCode::ECC_25,
+		QRCode::ECC_30
+	};
+
+	// the text is long enough to require a code with version 2 or higher, version-1 codes do not have an alignment pattern and their detected pose is less accurate
+
+	const unsigned int textLength = RandomI::random(randomGenerator, 40u, 60u);
+
+	std::string text(textLength, ' ');
+
+	for (char& character : text)
+	{
+		character = char(RandomI::random(randomGenerator, (unsigned int)('A'), (unsigned int)('Z')));
+	}
+
+	return CV::Detector::QRCodes::QRCodeEncoder::encodeText(text, errorCorrectionCapacities[RandomI::random(randomGenerator, 3u)], code) == CV::Detector::QRCodes::QRCodeEncoder::SC_SUCCESS && code.isValid();
+}
+
+bool TestQRCodeTracker2D::renderCode(const AnyCamera& anyCamera, const QRCode& code, const HomogenousMatrix4& code_T_camera, Frame& yFrame)
+{
+	ocean_assert(anyCamera.isValid() && code.isValid() && code_T_camera.isValid());
+
+	constexpr unsigned int borderModules = 4u;
+	constexpr unsigned int modulePixels = 8u;
+
+	constexpr uint8_t foregroundColor = 20u;
+	constexpr uint8_t backgroundColor = 230u;
+
+	const unsigned int modulesPerSide = code.modulesPerSide();
+
+	const Frame codeFrame = CV::Detector::QRCodes::Utilities::draw(code, (modulesPerSide + 2u * borderModules) * modulePixels, /* allowTrueMultiple */ false, borderModules, nullptr, foregroundColor, backgroundColor);
+
+	if (!codeFrame.isValid())
+	{
+		return false;
+	}
+
+	// the outer corners of the code in the code frame, the center of the first pixel is located at (0, 0)
+
+	const Scalar lowerCodeCorner = Scalar(borderModules * modulePixels) - Scalar(0.5);
+	const Scalar upperCodeCorner = Scalar((borderModules + modulesPerSide) * modulePixels) - Scalar(0.5);
+
+	const Vectors2 codeFrameCorners =
+	{
+		Vector2(lowerCodeCorner, lowerCodeCorner), // top-left
+		Vector2(lowerCodeCorner, upperCodeCorner), // bottom-left
+		Vector2(upperCodeCorner, upperCodeCorner), // bottom-right
+		Vector2(upperCodeCorner, lowerCodeCorner) // top-right
+	};
+
+	const Vectors3 objectCorners = CV::Detector::QRCodes::Utilities::CoordinateSystem::computeCornersInObjectSpace();
+	ocean_assert(objectCorners.size() == codeFrameCorners.size());
+
+	Vectors2 imageCorners;
+	imageCorners.reserve(objectCorners.size());
+
+	for (const Vector3& objectCorner : objectCorners)
+	{
+		imageCorners.emplace_back(anyCamera.projectToImage(code_T_camera, objectCorner));
+	}
+
+	SquareMatrix3 codeFrame_H_image;
+	if (!Geometry::Homography::homographyMatrixSVD(imageCorners.data(), codeFrameCorners.data(), imageCorners.size(), codeFrame_H_image))
+	{
+		return false;
+	}
+
+	yFrame.set(FrameType(anyCamera.width(), anyCamera.height(), FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT), true /*forceOwner*/, true /*forceWritable*/);
+
+	return CV::FrameInterpolatorBilinear::Comfort::homography(codeFrame, yFrame, codeFrame_H_image, &backgroundColor);
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TEST_QRCODE_TRACKER_2D_H
+#define META_OCEAN_TEST_TESTTRACKING_TEST_QRCODE_TRACKER_2D_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/cv/detector/qrcodes/QRCode.h"
+
+#include "ocean/math/AnyCamera.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements tests for the QRCodeTracker2D class.
+ * @ingroup testtracking
+ */
+class OCEAN_TEST_TRACKING_EXPORT TestQRCodeTracker2D
+{
+	public:
+
+		/**
+		 * Starts all tests for the QR code tracker.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests tracking a synthetic moving code, including the re-detection of the code and the accuracy of the tracked corners.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testTrackMovingCode(const double testDuration);
+
+		/**
+		 * Tests that codes are decoded again if the tracking quality is low, and that codes are removed once they cannot be verified anymore.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testRedecode(const double testDuration);
+
+		/**
+		 * Tests the identification of detected codes which are tracked already.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testIsAlreadyTracked(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a random QR code.
+		 * @param randomGenerator The random generator to be used
+		 * @param code The resulting code
+		 * @return True, if succeeded
+		 */
+		static bool createRandomCode(RandomGenerator& randomGenerator, CV::Detector::QRCodes::QRCode& code);
+
+		/**
+		 * Renders a code with a specific camera pose into a frame with uniform background.
+		 * @param anyCamera The camera profile to be used, must be valid
+		 * @param code The code to render, must be valid
+		 * @param code_T_camera The pose of the camera with respect to the code, must be valid
+		 * @param yFrame The resulting frame with pixel format FORMAT_Y8, matching the camera size
+		 * @return True, if succeeded
+		 */
+		static bool renderCode(const AnyCamera& anyCamera, const CV::Detector::QRCodes::QRCode& code, const HomogenousMatrix4& code_T_camera, Frame& yFrame);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TEST_QRCODE_TRACKER_2D_H
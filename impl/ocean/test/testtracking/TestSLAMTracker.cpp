@@ -0,0 +1,560 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/TestSLAMTracker.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/io/Directory.h"
+#include "ocean/io/File.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/tracking/offline/SLAMTracker.h"
+
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+bool TestSLAMTracker::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("SLAMTracker test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("alignsegment"))
+	{
+		testResult = testAlignSegment(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("mergesegment"))
+	{
+		testResult = testMergeSegment(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("checkpoint"))
+	{
+		testResult = testCheckpoint(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestSLAMTracker, AlignSegment)
+{
+	EXPECT_TRUE(TestSLAMTracker::testAlignSegment(GTEST_TEST_DURATION));
+}
+
+TEST(TestSLAMTracker, MergeSegment)
+{
+	EXPECT_TRUE(TestSLAMTracker::testMergeSegment(GTEST_TEST_DURATION));
+}
+
+TEST(TestSLAMTracker, Checkpoint)
+{
+	EXPECT_TRUE(TestSLAMTracker::testCheckpoint(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestSLAMTracker::testAlignSegment(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Align segment test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		// the segment has an own coordinate system with an arbitrary scale, with: worldPoint = world_T_segmentWorld * (segmentWorldPoint * scale)
+
+		const HomogenousMatrix4 world_T_segmentWorld(Random::vector3(randomGenerator, Scalar(-10), Scalar(10)), Random::quaternion(randomGenerator));
+		const Scalar scale = Random::scalar(randomGenerator, Scalar(0.2), Scalar(5));
+
+		const HomogenousMatrix4 segmentWorld_T_world(world_T_segmentWorld.inverted());
+
+		const unsigned int numberSharedObjectPoints = RandomI::random(randomGenerator, 20u, 100u);
+		const unsigned int numberOutliers = RandomI::random(randomGenerator, numberSharedObjectPoints / 10u);
+
+		Tracking::Database database;
+		Tracking::Database segmentDatabase;
+
+		Index32 objectPointId = 0u;
+
+		for (unsigned int n = 0u; n < numberSharedObjectPoints; ++n)
+		{
+			const Vector3 worldObjectPoint = Random::vector3(randomGenerator, Scalar(-5), Scalar(5));
+
+			Vector3 segmentObjectPoint = (segmentWorld_T_world * worldObjectPoint) / scale;
+
+			if (n < numberOutliers)
+			{
+				// a few object points of the segment are inaccurate
+
+				segmentObjectPoint += Random::vector3(randomGenerator, Scalar(1), Scalar(2)) / scale;
+			}
+
+			database.addObjectPoint<false>(objectPointId, worldObjectPoint);
+			segmentDatabase.addObjectPoint<false>(objectPointId, segmentObjectPoint);
+
+			++objectPointId;
+		}
+
+		// object points existing in one of both databases only, or without valid location in the database, must not have an impact
+
+		for (unsigned int n = 0u; n < 20u; ++n)
+		{
+			segmentDatabase.addObjectPoint<false>(objectPointId++, Random::vector3(randomGenerator, Scalar(-100), Scalar(100)));
+			database.addObjectPoint<false>(objectPointId++, Random::vector3(randomGenerator, Scalar(-100), Scalar(100)));
+
+			database.addObjectPoint<false>(objectPointId, Tracking::Database::invalidObjectPoint());
+			segmentDatabase.addObjectPoint<false>(objectPointId, Random::vector3(randomGenerator, Scalar(-100), Scalar(100)));
+			++objectPointId;
+		}
+
+		HomogenousMatrix4 alignedWorld_T_segmentWorld(false);
+		Scalar alignedScale = 0;
+
+		if (Tracking::Offline::SLAMTracker::alignSegment(database, segmentDatabase, alignedWorld_T_segmentWorld, alignedScale))
+		{
+			OCEAN_EXPECT_TRUE(validation, Numeric::isWeakEqual(alignedScale, scale));
+			OCEAN_EXPECT_LESS_EQUAL(validation, alignedWorld_T_segmentWorld.translation().distance(world_T_segmentWorld.translation()), Scalar(0.01));
+			OCEAN_EXPECT_LESS_EQUAL(validation, alignedWorld_T_segmentWorld.rotation().smallestAngle(world_T_segmentWorld.rotation()), Numeric::deg2rad(Scalar(0.1)));
+
+			// the shared object points must be mapped onto each other
+
+			for (Index32 sharedObjectPointId = numberOutliers; sharedObjectPointId < numberSharedObjectPoints; ++sharedObjectPointId)
+			{
+				Vector3 worldObjectPoint;
+				Vector3 segmentObjectPoint;
+
+				if (database.hasObjectPoint<false>(sharedObjectPointId, &worldObjectPoint) && segmentDatabase.hasObjectPoint<false>(sharedObjectPointId, &segmentObjectPoint))
+				{
+					OCEAN_EXPECT_LESS_EQUAL(validation, worldObjectPoint.distance(alignedWorld_T_segmentWorld * (segmentObjectPoint * alignedScale)), Scalar(0.01));
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// a segment with too few shared object points cannot be aligned
+
+		Tracking::Database smallDatabase;
+
+		for (Index32 sharedObjectPointId = 0u; sharedObjectPointId < 9u; ++sharedObjectPointId)
+		{
+			Vector3 worldObjectPoint;
+			if (database.hasObjectPoint<false>(sharedObjectPointId, &worldObjectPoint))
+			{
+				smallDatabase.addObjectPoint<false>(sharedObjectPointId, worldObjectPoint);
+			}
+		}
+
+		OCEAN_EXPECT_FALSE(validation, Tracking::Offline::SLAMTracker::alignSegment(smallDatabase, segmentDatabase, alignedWorld_T_segmentWorld, alignedScale));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSLAMTracker::testMergeSegment(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Merge segment test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const HomogenousMatrix4 world_T_segmentWorld(Random::vector3(randomGenerator, Scalar(-10), Scalar(10)), Random::quaternion(randomGenerator));
+		const Scalar scale = Random::scalar(randomGenerator, Scalar(0.2), Scalar(5));
+
+		const unsigned int numberFrames = RandomI::random(randomGenerator, 20u, 50u);
+
+		const unsigned int segmentLowerFrame = RandomI::random(randomGenerator, 1u, numberFrames / 2u);
+		const unsigned int segmentUpperFrame = RandomI::random(randomGenerator, segmentLowerFrame, numberFrames - 2u);
+
+		Tracking::Database database;
+		Tracking::Database segmentDatabase;
+
+		// the database has valid poses for some frames, the segment has valid poses for all frames (also for frames outside of the segment's range)
+
+		for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+		{
+			const HomogenousMatrix4 world_T_camera = RandomI::boolean(randomGenerator) ? HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-5), Scalar(5)), Random::quaternion(randomGenerator)) : HomogenousMatrix4(false);
+
+			database.addPose<false>(frameIndex, world_T_camera);
+			segmentDatabase.addPose<false>(frameIndex, HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-5), Scalar(5)), Random::quaternion(randomGenerator)));
+		}
+
+		// the database contains object points with valid location, object points without valid location, and misses object points of the segment
+
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 20u, 100u);
+
+		for (Index32 objectPointId = 0u; objectPointId < numberObjectPoints; ++objectPointId)
+		{
+			segmentDatabase.addObjectPoint<false>(objectPointId, Random::vector3(randomGenerator, Scalar(-5), Scalar(5)));
+
+			switch (RandomI::random(randomGenerator, 2u))
+			{
+				case 0u:
+					database.addObjectPoint<false>(objectPointId, Random::vector3(randomGenerator, Scalar(-5), Scalar(5)));
+					break;
+
+				case 1u:
+					database.addObjectPoint<false>(objectPointId, Tracking::Database::invalidObjectPoint());
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		const Tracking::Database originalDatabase(database);
+
+		Tracking::Offline::SLAMTracker::mergeSegment(database, segmentDatabase, segmentLowerFrame, segmentUpperFrame, world_T_segmentWorld, scale);
+
+		for (unsigned int frameIndex = 0u; frameIndex < numberFrames; ++frameIndex)
+		{
+			HomogenousMatrix4 originalWorld_T_camera(false);
+			HomogenousMatrix4 world_T_camera(false);
+			HomogenousMatrix4 segmentWorld_T_camera(false);
+
+			originalDatabase.hasPose<false>(frameIndex, &originalWorld_T_camera);
+			database.hasPose<false>(frameIndex, &world_T_camera);
+			segmentDatabase.hasPose<false>(frameIndex, &segmentWorld_T_camera);
+
+			if (originalWorld_T_camera.isValid() || frameIndex < segmentLowerFrame || frameIndex > segmentUpperFrame)
+			{
+				// valid poses of the database and poses outside of the segment's range are not changed
+
+				OCEAN_EXPECT_EQUAL(validation, world_T_camera.isValid(), originalWorld_T_camera.isValid());
+
+				if (originalWorld_T_camera.isValid())
+				{
+					OCEAN_EXPECT_TRUE(validation, world_T_camera == originalWorld_T_camera);
+				}
+			}
+			else
+			{
+				// the camera pose is transformed into the coordinate system of the database, the camera's orientation is not scaled
+
+				const HomogenousMatrix4 expectedWorld_T_camera(world_T_segmentWorld * (segmentWorld_T_camera.translation() * scale), world_T_segmentWorld.rotation() * segmentWorld_T_camera.rotation());
+
+				OCEAN_EXPECT_TRUE(validation, world_T_camera.isValid());
+				OCEAN_EXPECT_LESS_EQUAL(validation, world_T_camera.translation().distance(expectedWorld_T_camera.translation()), Scalar(0.001));
+				OCEAN_EXPECT_LESS_EQUAL(validation, world_T_camera.rotation().smallestAngle(expectedWorld_T_camera.rotation()), Numeric::deg2rad(Scalar(0.01)));
+			}
+		}
+
+		for (Index32 objectPointId = 0u; objectPointId < numberObjectPoints; ++objectPointId)
+		{
+			Vector3 originalObjectPoint;
+			if (!originalDatabase.hasObjectPoint<false>(objectPointId, &originalObjectPoint))
+			{
+				// object points which do not exist in the database are not added
+
+				OCEAN_EXPECT_FALSE(validation, database.hasObjectPoint<false>(objectPointId));
+				continue;
+			}
+
+			Vector3 objectPoint;
+			OCEAN_EXPECT_TRUE(validation, database.hasObjectPoint<false>(objectPointId, &objectPoint));
+
+			if (originalObjectPoint != Tracking::Database::invalidObjectPoint())
+			{
+				OCEAN_EXPECT_EQUAL(validation, objectPoint, originalObjectPoint);
+			}
+			else
+			{
+				Vector3 segmentObjectPoint;
+				segmentDatabase.hasObjectPoint<false>(objectPointId, &segmentObjectPoint);
+
+				OCEAN_EXPECT_LESS_EQUAL(validation, objectPoint.distance(world_T_segmentWorld * (segmentObjectPoint * scale)), Scalar(0.001));
+			}
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSLAMTracker::testCheckpoint(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Checkpoint test:";
+
+	using SLAMTracker = Tracking::Offline::SLAMTracker;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const IO::ScopedDirectory scopedDirectory(IO::Directory::createTemporaryDirectory());
+
+		if (!scopedDirectory.exists())
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		const std::string filename = (scopedDirectory + IO::File("checkpoint.ocn"))();
+
+		const unsigned int width = RandomI::random(randomGenerator, 320u, 1920u);
+		const unsigned int height = RandomI::random(randomGenerator, 240u, 1080u);
+
+		const PinholeCamera pinholeCamera(width, height, Random::scalar(randomGenerator, Numeric::deg2rad(Scalar(40)), Numeric::deg2rad(Scalar(80))));
+
+		const unsigned int lowerFrameIndex = RandomI::random(randomGenerator, 100u);
+		const unsigned int upperFrameIndex = RandomI::random(randomGenerator, lowerFrameIndex + 10u, lowerFrameIndex + 100u);
+
+		const unsigned int lowerPoseBorder = RandomI::random(randomGenerator, lowerFrameIndex, upperFrameIndex);
+		const unsigned int upperPoseBorder = RandomI::random(randomGenerator, lowerPoseBorder, upperFrameIndex);
+
+		const SLAMTracker::TrackingStage stage = SLAMTracker::TrackingStage(RandomI::random(randomGenerator, (unsigned int)(SLAMTracker::TS_POINT_PATHS), (unsigned int)(SLAMTracker::TS_STABLE_OBJECT_POINTS)));
+		const Tracking::Solver3::CameraMotion cameraMotion = RandomI::random(randomGenerator, 1u) == 0u ? Tracking::Solver3::CM_ROTATIONAL : Tracking::Solver3::CM_TRANSLATIONAL;
+
+		Tracking::Database database;
+
+		for (unsigned int frameIndex = lowerFrameIndex; frameIndex <= upperFrameIndex; ++frameIndex)
+		{
+			if (frameIndex >= lowerPoseBorder && frameIndex <= upperPoseBorder)
+			{
+				database.addPose<false>(frameIndex, HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-1), Scalar(1)), Random::quaternion(randomGenerator)));
+			}
+			else
+			{
+				database.addPose<false>(frameIndex);
+			}
+		}
+
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 1u, 100u);
+
+		for (Index32 objectPointId = 0u; objectPointId < numberObjectPoints; ++objectPointId)
+		{
+			database.addObjectPoint<false>(objectPointId, Random::vector3(randomGenerator, Scalar(-10), Scalar(10)), Random::scalar(randomGenerator, Scalar(0), Scalar(1)));
+
+			const unsigned int lowerObservationFrame = RandomI::random(randomGenerator, lowerFrameIndex, upperFrameIndex);
+			const unsigned int upperObservationFrame = RandomI::random(randomGenerator, lowerObservationFrame, upperFrameIndex);
+
+			for (unsigned int frameIndex = lowerObservationFrame; frameIndex <= upperObservationFrame; ++frameIndex)
+			{
+				const Index32 imagePointId = database.addImagePoint<false>(Random::vector2(randomGenerator, Scalar(0), Scalar(width), Scalar(0), Scalar(height)));
+
+				database.attachImagePointToPose<false>(imagePointId, frameIndex);
+				database.attachImagePointToObjectPoint<false>(imagePointId, objectPointId);
+			}
+		}
+
+		// an existing checkpoint file must be replaced
+
+		OCEAN_EXPECT_TRUE(validation, SLAMTracker::writeCheckpoint(filename, SLAMTracker::TS_POINT_PATHS, lowerFrameIndex, upperFrameIndex, pinholeCamera, Tracking::Database(), Tracking::Solver3::CM_UNKNOWN, lowerFrameIndex, upperFrameIndex));
+		OCEAN_EXPECT_TRUE(validation, SLAMTracker::writeCheckpoint(filename, stage, lowerFrameIndex, upperFrameIndex, pinholeCamera, database, cameraMotion, lowerPoseBorder, upperPoseBorder));
+
+		OCEAN_EXPECT_TRUE(validation, IO::File(filename).exists());
+		OCEAN_EXPECT_FALSE(validation, IO::File(filename + ".tmp").exists());
+
+		SLAMTracker::Checkpoint checkpoint;
+
+		if (SLAMTracker::readCheckpoint(filename, checkpoint))
+		{
+			OCEAN_EXPECT_TRUE(validation, checkpoint.isValid());
+
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.stage_, stage);
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.lowerFrameIndex_, lowerFrameIndex);
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.upperFrameIndex_, upperFrameIndex);
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.cameraMotion_, cameraMotion);
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.lowerPoseBorder_, lowerPoseBorder);
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.upperPoseBorder_, upperPoseBorder);
+
+			OCEAN_EXPECT_TRUE(validation, checkpoint.camera_.isEqual(pinholeCamera, Numeric::weakEps()));
+
+			HomogenousMatrices4 poses;
+			const Indices32 poseIds = database.poseIds<false>(&poses);
+
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.database_.poseNumber<false>(), poseIds.size());
+
+			for (size_t n = 0; n < poseIds.size(); ++n)
+			{
+				HomogenousMatrix4 checkpointPose(false);
+
+				if (checkpoint.database_.hasPose<false>(poseIds[n], &checkpointPose))
+				{
+					OCEAN_EXPECT_EQUAL(validation, poses[n].isValid(), checkpointPose.isValid());
+
+					if (poses[n].isValid())
+					{
+						OCEAN_EXPECT_TRUE(validation, poses[n].isEqual(checkpointPose, Numeric::weakEps()));
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+
+			Vectors3 objectPoints;
+			Scalars priorities;
+			const Indices32 objectPointIds = database.objectPointIds<false>(&objectPoints, &priorities);
+
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.database_.objectPointNumber<false>(), objectPointIds.size());
+
+			for (size_t n = 0; n < objectPointIds.size(); ++n)
+			{
+				Vector3 checkpointObjectPoint;
+
+				if (checkpoint.database_.hasObjectPoint<false>(objectPointIds[n], &checkpointObjectPoint))
+				{
+					OCEAN_EXPECT_TRUE(validation, objectPoints[n].isEqual(checkpointObjectPoint, Numeric::weakEps()));
+					OCEAN_EXPECT_TRUE(validation, Numeric::isWeakEqual(priorities[n], checkpoint.database_.objectPointPriority<false>(objectPointIds[n])));
+
+					Indices32 observationPoseIds;
+					Indices32 observationImagePointIds;
+					Vectors2 observationImagePoints;
+					database.observationsFromObjectPoint<false>(objectPointIds[n], observationPoseIds, observationImagePointIds, &observationImagePoints);
+
+					Indices32 checkpointObservationPoseIds;
+					Indices32 checkpointObservationImagePointIds;
+					Vectors2 checkpointObservationImagePoints;
+					checkpoint.database_.observationsFromObjectPoint<false>(objectPointIds[n], checkpointObservationPoseIds, checkpointObservationImagePointIds, &checkpointObservationImagePoints);
+
+					if (observationPoseIds.size() == checkpointObservationPoseIds.size())
+					{
+						std::unordered_map<Index32, Vector2> checkpointObservationMap;
+
+						for (size_t i = 0; i < checkpointObservationPoseIds.size(); ++i)
+						{
+							checkpointObservationMap.emplace(checkpointObservationPoseIds[i], checkpointObservationImagePoints[i]);
+						}
+
+						for (size_t i = 0; i < observationPoseIds.size(); ++i)
+						{
+							const std::unordered_map<Index32, Vector2>::const_iterator iObservation = checkpointObservationMap.find(observationPoseIds[i]);
+
+							if (iObservation != checkpointObservationMap.cend())
+							{
+								OCEAN_EXPECT_TRUE(validation, observationImagePoints[i].isEqual(iObservation->second, Numeric::weakEps()));
+							}
+							else
+							{
+								OCEAN_SET_FAILED(validation);
+							}
+						}
+					}
+					else
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+				else
+				{
+					OCEAN_SET_FAILED(validation);
+				}
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// a truncated checkpoint file must be rejected without modifying the given checkpoint object
+
+		std::vector<char> buffer;
+
+		{
+			std::ifstream stream(filename.c_str(), std::ios::binary);
+			buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		}
+
+		OCEAN_EXPECT_FALSE(validation, buffer.empty());
+
+		if (!buffer.empty())
+		{
+			const size_t truncatedSize = size_t(RandomI::random(randomGenerator, (unsigned int)(buffer.size() - 1)));
+
+			{
+				std::ofstream stream(filename.c_str(), std::ios::binary | std::ios::trunc);
+				stream.write(buffer.data(), std::streamsize(truncatedSize));
+			}
+
+			SLAMTracker::Checkpoint truncatedCheckpoint;
+			OCEAN_EXPECT_FALSE(validation, SLAMTracker::readCheckpoint(filename, truncatedCheckpoint));
+			OCEAN_EXPECT_FALSE(validation, truncatedCheckpoint.isValid());
+
+			OCEAN_EXPECT_FALSE(validation, SLAMTracker::readCheckpoint(filename, checkpoint));
+			OCEAN_EXPECT_EQUAL(validation, checkpoint.stage_, stage);
+		}
+
+		// a missing checkpoint file must be rejected
+
+		SLAMTracker::Checkpoint missingCheckpoint;
+		OCEAN_EXPECT_FALSE(validation, SLAMTracker::readCheckpoint(filename + ".missing", missingCheckpoint));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
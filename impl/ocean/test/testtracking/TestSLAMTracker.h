@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TEST_SLAM_TRACKER_H
+#define META_OCEAN_TEST_TESTTRACKING_TEST_SLAM_TRACKER_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements tests for the offline SLAMTracker class.
+ * @ingroup testtracking
+ */
+class OCEAN_TEST_TRACKING_EXPORT TestSLAMTracker
+{
+	public:
+
+		/**
+		 * Starts all tests for the offline SLAM tracker class.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the alignment of a segment with a database via shared object points.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testAlignSegment(const double testDuration);
+
+		/**
+		 * Tests merging an aligned segment into a database.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testMergeSegment(const double testDuration);
+
+		/**
+		 * Tests writing and reading checkpoints, including replacing existing checkpoints and reading truncated checkpoint files.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testCheckpoint(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TEST_SLAM_TRACKER_H
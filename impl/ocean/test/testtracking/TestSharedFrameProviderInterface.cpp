@@ -0,0 +1,673 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/TestSharedFrameProviderInterface.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Thread.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/tracking/offline/SharedFrameProviderInterface.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements a frame provider interface creating synthetic frames and counting how often each frame has been decoded.
+ */
+class TestSharedFrameProviderInterface::SyntheticFrameProviderInterface : public CV::FrameProviderInterface
+{
+	public:
+
+		/**
+		 * Creates a new frame provider interface.
+		 * @param width The width of each frame in pixel, with range [1, infinity)
+		 * @param height The height of each frame in pixel, with range [1, infinity)
+		 * @param frameNumber The number of frames, with range [1, infinity)
+		 * @param decodingTime The time each frame needs to be decoded, in milliseconds, with range [0, infinity)
+		 */
+		SyntheticFrameProviderInterface(const unsigned int width, const unsigned int height, const unsigned int frameNumber, const unsigned int decodingTime) :
+			frameType_(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT),
+			decodedFrames_(frameNumber, 0u),
+			decodingTime_(decodingTime)
+		{
+			// nothing to do here
+		}
+
+		/**
+		 * Returns the synthetic frame with a specific index.
+		 * @param frameType The frame type of the frame, must be valid
+		 * @param index The index of the frame
+		 * @return The synthetic frame
+		 */
+		static Frame syntheticFrame(const FrameType& frameType, const unsigned int index)
+		{
+			Frame frame(frameType);
+
+			for (unsigned int y = 0u; y < frame.height(); ++y)
+			{
+				uint8_t* const row = frame.row<uint8_t>(y);
+
+				for (unsigned int x = 0u; x < frame.width(); ++x)
+				{
+					row[x] = uint8_t(index * 7u + x + y * 3u);
+				}
+			}
+
+			return frame;
+		}
+
+		/**
+		 * Returns how often a frame has been decoded.
+		 * @param index The index of the frame, with range [0, frameNumber)
+		 * @return The number of decoding iterations
+		 */
+		unsigned int decodedFrames(const unsigned int index) const
+		{
+			const ScopedLock scopedLock(lock_);
+
+			ocean_assert(index < decodedFrames_.size());
+			return decodedFrames_[index];
+		}
+
+		/**
+		 * Returns the frame type of all frames.
+		 * @return The frame type
+		 */
+		const FrameType& frameType() const
+		{
+			return frameType_;
+		}
+
+		bool isInitialized() override
+		{
+			return true;
+		}
+
+		bool setPreferredFrameType(const FrameType::PixelFormat /*pixelFormat*/, const FrameType::PixelOrigin /*pixelOrigin*/) override
+		{
+			return true;
+		}
+
+		void asynchronFrameRequest(const unsigned int index, const bool /*priority*/ = false) override
+		{
+			const FrameRef frame = synchronFrameRequest(index);
+
+			frameCallbacks_(frame, index);
+		}
+
+		FrameRef synchronFrameRequest(const unsigned int index, const double /*timeout*/ = 10.0, bool* /*abort*/ = nullptr) override
+		{
+			if (index >= decodedFrames_.size())
+			{
+				return FrameRef();
+			}
+
+			if (decodingTime_ != 0u)
+			{
+				Thread::sleep(decodingTime_);
+			}
+
+			{
+				const ScopedLock scopedLock(lock_);
+
+				++decodedFrames_[index];
+			}
+
+			return FrameRef(new Frame(syntheticFrame(frameType_, index)));
+		}
+
+		void asynchronFrameNumberRequest() override
+		{
+			frameNumberCallbacks_((unsigned int)(decodedFrames_.size()));
+		}
+
+		unsigned int synchronFrameNumberRequest(const double /*timeout*/ = 10.0, bool* /*abort*/ = nullptr) override
+		{
+			return (unsigned int)(decodedFrames_.size());
+		}
+
+		void asynchronFrameTypeRequest() override
+		{
+			frameTypeCallbacks_(frameType_);
+		}
+
+		FrameType synchronFrameTypeRequest(const double /*timeout*/ = 10.0, bool* /*abort*/ = nullptr) override
+		{
+			return frameType_;
+		}
+
+	protected:
+
+		/// The frame type of all frames.
+		const FrameType frameType_;
+
+		/// The number of decoding iterations for each frame.
+		Indices32 decodedFrames_;
+
+		/// The time each frame needs to be decoded, in milliseconds.
+		const unsigned int decodingTime_;
+
+		/// The lock of this interface.
+		mutable Lock lock_;
+};
+
+bool TestSharedFrameProviderInterface::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("SharedFrameProviderInterface test");
+	Log::info() << " ";
+
+	if (selector.shouldRun("memorybudget"))
+	{
+		testResult = testMemoryBudget(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("pyramidkeys"))
+	{
+		testResult = testPyramidKeys(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("concurrentrequests"))
+	{
+		testResult = testConcurrentRequests(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("pyramidlifetime"))
+	{
+		testResult = testPyramidLifetime(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestSharedFrameProviderInterface, MemoryBudget)
+{
+	EXPECT_TRUE(TestSharedFrameProviderInterface::testMemoryBudget(GTEST_TEST_DURATION));
+}
+
+TEST(TestSharedFrameProviderInterface, PyramidKeys)
+{
+	EXPECT_TRUE(TestSharedFrameProviderInterface::testPyramidKeys(GTEST_TEST_DURATION));
+}
+
+TEST(TestSharedFrameProviderInterface, ConcurrentRequests)
+{
+	EXPECT_TRUE(TestSharedFrameProviderInterface::testConcurrentRequests(GTEST_TEST_DURATION));
+}
+
+TEST(TestSharedFrameProviderInterface, PyramidLifetime)
+{
+	EXPECT_TRUE(TestSharedFrameProviderInterface::testPyramidLifetime(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestSharedFrameProviderInterface::testMemoryBudget(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Memory budget test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 16u, 128u);
+		const unsigned int height = RandomI::random(randomGenerator, 16u, 128u);
+
+		const unsigned int cachedFrames = RandomI::random(randomGenerator, 2u, 10u);
+		const unsigned int frameNumber = cachedFrames * 3u;
+
+		SyntheticFrameProviderInterface* syntheticFrameProviderInterface = new SyntheticFrameProviderInterface(width, height, frameNumber, 0u);
+		const CV::FrameProviderInterfaceRef frameProviderInterface(syntheticFrameProviderInterface);
+
+		const size_t frameMemory = size_t(syntheticFrameProviderInterface->frameType().frameTypeSize());
+
+		Tracking::Offline::SharedFrameProviderInterface sharedFrameProviderInterface(frameProviderInterface, frameMemory * size_t(cachedFrames), 0u);
+
+		// the cache can hold 'cachedFrames' frames
+
+		for (unsigned int index = 0u; index < cachedFrames; ++index)
+		{
+			const FrameRef frame = sharedFrameProviderInterface.synchronFrameRequest(index);
+
+			OCEAN_EXPECT_TRUE(validation, frame && frame->isValid());
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, sharedFrameProviderInterface.memoryUsage(), frameMemory * size_t(cachedFrames));
+
+		// touching a frame makes it the most recently used frame
+
+		const unsigned int touchedIndex = RandomI::random(randomGenerator, cachedFrames - 1u);
+		OCEAN_EXPECT_TRUE(validation, bool(sharedFrameProviderInterface.synchronFrameRequest(touchedIndex)));
+
+		// each further frame must remove the least recently used frame
+
+		const unsigned int additionalFrames = RandomI::random(randomGenerator, 1u, cachedFrames - 1u);
+
+		for (unsigned int n = 0u; n < additionalFrames; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, bool(sharedFrameProviderInterface.synchronFrameRequest(cachedFrames + n)));
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, sharedFrameProviderInterface.memoryUsage(), frameMemory * size_t(cachedFrames));
+		}
+
+		// the removed frames are the first frames in the order of their last usage
+
+		Indices32 leastRecentlyUsedIndices;
+		for (unsigned int index = 0u; index < cachedFrames; ++index)
+		{
+			if (index != touchedIndex)
+			{
+				leastRecentlyUsedIndices.push_back(index);
+			}
+		}
+		leastRecentlyUsedIndices.push_back(touchedIndex);
+
+		uint64_t frameHits = 0ull;
+		uint64_t frameMisses = 0ull;
+		sharedFrameProviderInterface.statistics(&frameHits, &frameMisses, nullptr, nullptr);
+
+		OCEAN_EXPECT_EQUAL(validation, frameHits, uint64_t(1));
+		OCEAN_EXPECT_EQUAL(validation, frameMisses, uint64_t(cachedFrames + additionalFrames));
+
+		// we check the cached frames in reverse order of their last usage so that checking does not remove further frames
+
+		for (size_t n = leastRecentlyUsedIndices.size() - 1; n < leastRecentlyUsedIndices.size(); --n)
+		{
+			const unsigned int index = leastRecentlyUsedIndices[n];
+
+			const bool isCached = n >= size_t(additionalFrames);
+
+			const unsigned int decodedFramesBefore = syntheticFrameProviderInterface->decodedFrames(index);
+			const FrameRef frame = sharedFrameProviderInterface.synchronFrameRequest(index);
+			const unsigned int decodedFramesAfter = syntheticFrameProviderInterface->decodedFrames(index);
+
+			OCEAN_EXPECT_TRUE(validation, frame && frame->isValid());
+
+			if (isCached)
+			{
+				OCEAN_EXPECT_EQUAL(validation, decodedFramesAfter, decodedFramesBefore);
+			}
+			else
+			{
+				OCEAN_EXPECT_EQUAL(validation, decodedFramesAfter, decodedFramesBefore + 1u);
+
+				// re-requesting a removed frame removes another frame, so that we stop here
+				break;
+			}
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, sharedFrameProviderInterface.memoryUsage(), frameMemory * size_t(cachedFrames));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSharedFrameProviderInterface::testPyramidKeys(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Pyramid keys test:";
+
+	using SharedFramePyramid = Tracking::Offline::SharedFrameProviderInterface::SharedFramePyramid;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 32u, 256u);
+		const unsigned int height = RandomI::random(randomGenerator, 32u, 256u);
+
+		const unsigned int frameNumber = 10u;
+
+		SyntheticFrameProviderInterface* syntheticFrameProviderInterface = new SyntheticFrameProviderInterface(width, height, frameNumber, 0u);
+		const CV::FrameProviderInterfaceRef frameProviderInterface(syntheticFrameProviderInterface);
+
+		Tracking::Offline::SharedFrameProviderInterface sharedFrameProviderInterface(frameProviderInterface);
+
+		const unsigned int index = RandomI::random(randomGenerator, frameNumber - 2u);
+
+		const SharedFramePyramid basePyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+		const SharedFramePyramid layersPyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 2u);
+		const SharedFramePyramid downsamplingPyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_14641, 3u);
+		const SharedFramePyramid pixelFormatPyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+		const SharedFramePyramid pixelOriginPyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_LOWER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+		const SharedFramePyramid indexPyramid = sharedFrameProviderInterface.framePyramid(index + 1u, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+
+		const std::vector<SharedFramePyramid> framePyramids = {basePyramid, layersPyramid, downsamplingPyramid, pixelFormatPyramid, pixelOriginPyramid, indexPyramid};
+
+		for (size_t n = 0; n < framePyramids.size(); ++n)
+		{
+			if (framePyramids[n] && framePyramids[n]->isValid())
+			{
+				for (size_t i = n + 1; i < framePyramids.size(); ++i)
+				{
+					OCEAN_EXPECT_NOT_EQUAL(validation, framePyramids[n].get(), framePyramids[i].get());
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		if (basePyramid && layersPyramid && pixelFormatPyramid && pixelOriginPyramid && indexPyramid)
+		{
+			OCEAN_EXPECT_EQUAL(validation, basePyramid->layers(), 3u);
+			OCEAN_EXPECT_EQUAL(validation, layersPyramid->layers(), 2u);
+
+			OCEAN_EXPECT_EQUAL(validation, (*pixelFormatPyramid)[0].pixelFormat(), FrameType::FORMAT_RGB24);
+			OCEAN_EXPECT_EQUAL(validation, (*pixelOriginPyramid)[0].pixelOrigin(), FrameType::ORIGIN_LOWER_LEFT);
+
+			const Frame frame = SyntheticFrameProviderInterface::syntheticFrame(syntheticFrameProviderInterface->frameType(), index);
+			const Frame nextFrame = SyntheticFrameProviderInterface::syntheticFrame(syntheticFrameProviderInterface->frameType(), index + 1u);
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				OCEAN_EXPECT_EQUAL(validation, memcmp((*basePyramid)[0].constrow<uint8_t>(y), frame.constrow<uint8_t>(y), width), 0);
+				OCEAN_EXPECT_EQUAL(validation, memcmp((*indexPyramid)[0].constrow<uint8_t>(y), nextFrame.constrow<uint8_t>(y), width), 0);
+
+				// the lower left pyramid holds the rows in reverse order
+				OCEAN_EXPECT_EQUAL(validation, memcmp((*pixelOriginPyramid)[0].constrow<uint8_t>(height - y - 1u), frame.constrow<uint8_t>(y), width), 0);
+			}
+		}
+
+		// requesting the same pyramid again must return the cached pyramid
+
+		const SharedFramePyramid cachedPyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+		OCEAN_EXPECT_EQUAL(validation, cachedPyramid.get(), basePyramid.get());
+
+		uint64_t pyramidHits = 0ull;
+		uint64_t pyramidMisses = 0ull;
+		sharedFrameProviderInterface.statistics(nullptr, nullptr, &pyramidHits, &pyramidMisses);
+
+		OCEAN_EXPECT_EQUAL(validation, pyramidHits, uint64_t(1));
+		OCEAN_EXPECT_EQUAL(validation, pyramidMisses, uint64_t(framePyramids.size()));
+
+		// all pyramids of the same frame are based on one decoded frame
+
+		OCEAN_EXPECT_EQUAL(validation, syntheticFrameProviderInterface->decodedFrames(index), 1u);
+		OCEAN_EXPECT_EQUAL(validation, syntheticFrameProviderInterface->decodedFrames(index + 1u), 1u);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSharedFrameProviderInterface::testConcurrentRequests(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Concurrent requests test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 32u, 128u);
+		const unsigned int height = RandomI::random(randomGenerator, 32u, 128u);
+
+		const unsigned int frameNumber = RandomI::random(randomGenerator, 5u, 20u);
+		const unsigned int decodingTime = RandomI::random(randomGenerator, 1u, 3u);
+
+		SyntheticFrameProviderInterface* syntheticFrameProviderInterface = new SyntheticFrameProviderInterface(width, height, frameNumber, decodingTime);
+		const CV::FrameProviderInterfaceRef frameProviderInterface(syntheticFrameProviderInterface);
+
+		Tracking::Offline::SharedFrameProviderInterface sharedFrameProviderInterface(frameProviderInterface);
+
+		const unsigned int numberThreads = RandomI::random(randomGenerator, 2u, 6u);
+
+		std::vector<Indices32> threadFrameIndices(numberThreads);
+		std::vector<std::vector<FrameRef>> threadFrames(numberThreads);
+
+		for (Indices32& frameIndices : threadFrameIndices)
+		{
+			// each thread requests all frames in a random order, some threads use the frame pyramids
+
+			for (unsigned int index = 0u; index < frameNumber; ++index)
+			{
+				frameIndices.push_back(index);
+			}
+
+			for (size_t n = 0; n < frameIndices.size(); ++n)
+			{
+				std::swap(frameIndices[n], frameIndices[RandomI::random(randomGenerator, (unsigned int)(frameIndices.size() - 1))]);
+			}
+		}
+
+		const bool usePyramids = RandomI::random(randomGenerator, 1u) == 0u;
+
+		std::vector<std::thread> threads;
+		threads.reserve(numberThreads);
+
+		for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+		{
+			threads.emplace_back([&sharedFrameProviderInterface, &threadFrameIndices, &threadFrames, threadIndex, usePyramids]()
+			{
+				for (const Index32 index : threadFrameIndices[threadIndex])
+				{
+					if (usePyramids && threadIndex % 2u == 1u)
+					{
+						const Tracking::Offline::SharedFrameProviderInterface::SharedFramePyramid framePyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 2u);
+
+						threadFrames[threadIndex].emplace_back(framePyramid ? FrameRef(new Frame((*framePyramid)[0], Frame::ACM_COPY_REMOVE_PADDING_LAYOUT)) : FrameRef());
+					}
+					else
+					{
+						threadFrames[threadIndex].emplace_back(sharedFrameProviderInterface.synchronFrameRequest(index));
+					}
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		// each frame must have been decoded exactly once
+
+		for (unsigned int index = 0u; index < frameNumber; ++index)
+		{
+			OCEAN_EXPECT_EQUAL(validation, syntheticFrameProviderInterface->decodedFrames(index), 1u);
+		}
+
+		for (unsigned int threadIndex = 0u; threadIndex < numberThreads; ++threadIndex)
+		{
+			const Indices32& frameIndices = threadFrameIndices[threadIndex];
+			const std::vector<FrameRef>& frames = threadFrames[threadIndex];
+
+			if (frames.size() == frameIndices.size())
+			{
+				for (size_t n = 0; n < frames.size(); ++n)
+				{
+					if (frames[n] && frames[n]->isValid())
+					{
+						const Frame frame = SyntheticFrameProviderInterface::syntheticFrame(syntheticFrameProviderInterface->frameType(), frameIndices[n]);
+
+						for (unsigned int y = 0u; y < height; ++y)
+						{
+							OCEAN_EXPECT_EQUAL(validation, memcmp(frames[n]->constrow<uint8_t>(y), frame.constrow<uint8_t>(y), width), 0);
+						}
+					}
+					else
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		uint64_t frameMisses = 0ull;
+		sharedFrameProviderInterface.statistics(nullptr, &frameMisses, nullptr, nullptr);
+
+		OCEAN_EXPECT_EQUAL(validation, frameMisses, uint64_t(frameNumber));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestSharedFrameProviderInterface::testPyramidLifetime(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Pyramid lifetime test:";
+
+	using SharedFramePyramid = Tracking::Offline::SharedFrameProviderInterface::SharedFramePyramid;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 32u, 256u);
+		const unsigned int height = RandomI::random(randomGenerator, 32u, 256u);
+
+		const unsigned int frameNumber = 10u;
+
+		SyntheticFrameProviderInterface* syntheticFrameProviderInterface = new SyntheticFrameProviderInterface(width, height, frameNumber, 0u);
+		const CV::FrameProviderInterfaceRef frameProviderInterface(syntheticFrameProviderInterface);
+
+		const size_t frameMemory = size_t(syntheticFrameProviderInterface->frameType().frameTypeSize());
+
+		// the memory budget is large enough for one frame or one pyramid
+
+		Tracking::Offline::SharedFrameProviderInterface sharedFrameProviderInterface(frameProviderInterface, frameMemory * 2, 0u);
+
+		const unsigned int index = RandomI::random(randomGenerator, frameNumber - 1u);
+
+		const SharedFramePyramid framePyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+
+		// requesting further frames removes the pyramid from the cache
+
+		for (unsigned int n = 1u; n < frameNumber; ++n)
+		{
+			OCEAN_EXPECT_TRUE(validation, bool(sharedFrameProviderInterface.synchronFrameRequest((index + n) % frameNumber)));
+		}
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, sharedFrameProviderInterface.memoryUsage(), frameMemory * 2);
+
+		if (framePyramid && framePyramid->isValid() && framePyramid->layers() == 3u)
+		{
+			// the pyramid must still hold the content of the frame
+
+			const Frame frame = SyntheticFrameProviderInterface::syntheticFrame(syntheticFrameProviderInterface->frameType(), index);
+
+			for (unsigned int y = 0u; y < height; ++y)
+			{
+				OCEAN_EXPECT_EQUAL(validation, memcmp((*framePyramid)[0].constrow<uint8_t>(y), frame.constrow<uint8_t>(y), width), 0);
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, (*framePyramid)[1].width(), width / 2u);
+			OCEAN_EXPECT_EQUAL(validation, (*framePyramid)[2].height(), height / 4u);
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		// the pyramid has been removed from the cache, so that a new pyramid is created with identical content
+
+		const SharedFramePyramid newFramePyramid = sharedFrameProviderInterface.framePyramid(index, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, 3u);
+
+		if (framePyramid && newFramePyramid && newFramePyramid->layers() == framePyramid->layers())
+		{
+			OCEAN_EXPECT_NOT_EQUAL(validation, newFramePyramid.get(), framePyramid.get());
+
+			for (unsigned int layerIndex = 0u; layerIndex < framePyramid->layers(); ++layerIndex)
+			{
+				const Frame& layer = (*framePyramid)[layerIndex];
+				const Frame& newLayer = (*newFramePyramid)[layerIndex];
+
+				for (unsigned int y = 0u; y < layer.height(); ++y)
+				{
+					OCEAN_EXPECT_EQUAL(validation, memcmp(newLayer.constrow<uint8_t>(y), layer.constrow<uint8_t>(y), layer.width()), 0);
+				}
+			}
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+
+		uint64_t pyramidHits = 0ull;
+		uint64_t pyramidMisses = 0ull;
+		sharedFrameProviderInterface.statistics(nullptr, nullptr, &pyramidHits, &pyramidMisses);
+
+		OCEAN_EXPECT_EQUAL(validation, pyramidHits, uint64_t(0));
+		OCEAN_EXPECT_EQUAL(validation, pyramidMisses, uint64_t(2));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
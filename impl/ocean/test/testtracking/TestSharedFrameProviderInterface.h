@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TEST_SHARED_FRAME_PROVIDER_INTERFACE_H
+#define META_OCEAN_TEST_TESTTRACKING_TEST_SHARED_FRAME_PROVIDER_INTERFACE_H
+
+#include "ocean/test/testtracking/TestTracking.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+/**
+ * This class implements tests for the SharedFrameProviderInterface class.
+ * @ingroup testtracking
+ */
+class OCEAN_TEST_TRACKING_EXPORT TestSharedFrameProviderInterface
+{
+	protected:
+
+		class SyntheticFrameProviderInterface;
+
+	public:
+
+		/**
+		 * Starts all tests for the shared frame provider interface.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests that the least recently used frames are removed once the memory budget is exceeded.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testMemoryBudget(const double testDuration);
+
+		/**
+		 * Tests that frame pyramids with different pixel formats, downsampling modes, or layers are cached separately.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPyramidKeys(const double testDuration);
+
+		/**
+		 * Tests that concurrent requests for the same frames decode each frame only once.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentRequests(const double testDuration);
+
+		/**
+		 * Tests that frame pyramids stay valid after they have been removed from the cache.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testPyramidLifetime(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TEST_SHARED_FRAME_PROVIDER_INTERFACE_H
@@ -9,9 +9,12 @@
 #include "ocean/test/testtracking/TestDatabase.h"
 #include "ocean/test/testtracking/TestHomographyImageAlignmentDense.h"
 #include "ocean/test/testtracking/TestPatternTracker.h"
+#include "ocean/test/testtracking/TestQRCodeTracker2D.h"
+#include "ocean/test/testtracking/TestSharedFrameProviderInterface.h"
 #include "ocean/test/testtracking/TestSmoothedTransformation.h"
 #include "ocean/test/testtracking/TestUnidirectionalCorrespondences.h"
 #include "ocean/test/testtracking/TestSimilarityTracker.h"
+#include "ocean/test/testtracking/TestSLAMTracker.h"
 #include "ocean/test/testtracking/TestVocabularyTree.h"
 
 #include "ocean/test/TestResult.h"
@@ -138,6 +141,33 @@ bool testTracking(const double testDuration, Worker& worker, const std::string&
 		testResult = TestUnidirectionalCorrespondences::test(testDuration, worker, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("slamtracker"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestSLAMTracker::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("sharedframeproviderinterface"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestSharedFrameProviderInterface::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("qrcodetracker2d"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestQRCodeTracker2D::test(testDuration, subSelector);
+	}
+
 	Log::info() << " ";
 	Log::info() << " ";
 	Log::info() << " ";
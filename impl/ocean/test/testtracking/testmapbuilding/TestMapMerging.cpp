@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapMerging.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/String.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+#include "ocean/test/ValidationPrecision.h"
+
+#include "ocean/tracking/mapbuilding/MapMerging.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+bool TestMapMerging::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("MapMerging test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("closeloopswithimageretrieval"))
+	{
+		testResult = testCloseLoopsWithImageRetrieval(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("optimizeposegraph"))
+	{
+		testResult = testOptimizePoseGraph(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMapMerging, CloseLoopsWithImageRetrieval)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMapMerging::testCloseLoopsWithImageRetrieval(GTEST_TEST_DURATION, worker));
+}
+
+TEST(TestMapMerging, OptimizePoseGraph)
+{
+	Worker worker;
+	EXPECT_TRUE(TestMapMerging::testOptimizePoseGraph(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMapMerging::testCloseLoopsWithImageRetrieval(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Close loops with image retrieval test:";
+
+	constexpr unsigned int posesPerLap = 150u;
+	constexpr unsigned int numberLandmarks = 2000u;
+
+	Log::info() << "... with " << posesPerLap * 2u << " poses and " << numberLandmarks << " landmarks";
+
+	const PinholeCamera pinholeCamera(640u, 480u, Numeric::deg2rad(60));
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = 0.90;
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		for (const bool useWorker : {false, true})
+		{
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			Tracking::Database database;
+			Tracking::MapBuilding::DescriptorHandling::FreakMultiDescriptorMap256 freakMap;
+			std::unordered_map<Index32, Index32> objectPointLandmarks;
+			Vectors3 landmarks;
+
+			createLoopDatabase(pinholeCamera, posesPerLap, numberLandmarks, randomGenerator, database, freakMap, objectPointLandmarks, landmarks);
+
+			std::vector<Indices32> landmarkObjectPointIds(landmarks.size());
+
+			for (const std::pair<const Index32, Index32>& objectPointLandmark : objectPointLandmarks)
+			{
+				landmarkObjectPointIds[objectPointLandmark.second].emplace_back(objectPointLandmark.first);
+			}
+
+			constexpr unsigned int minimalNumberValidCorrespondences = 10u;
+			constexpr unsigned int maximalCandidatesPerPose = 5u;
+			constexpr unsigned int minimalPoseIndexDistance = posesPerLap / 4u;
+
+			performance.start();
+				const size_t mergedGroups = Tracking::MapBuilding::MapMerging::closeLoopsWithImageRetrieval(database, freakMap, pinholeCamera, randomGenerator, minimalNumberValidCorrespondences, maximalCandidatesPerPose, minimalPoseIndexDistance, 50u, 64u, useWorker ? &worker : nullptr, true /*skipBundleAdjustment*/);
+			performance.stop();
+
+			if (mergedGroups == 0)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			// each landmark visible in both laps should have been merged into one object point
+
+			for (Indices32& objectPointIds : landmarkObjectPointIds)
+			{
+				if (objectPointIds.size() != 2)
+				{
+					continue;
+				}
+
+				ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+				std::sort(objectPointIds.begin(), objectPointIds.end());
+
+				if (!database.hasObjectPoint<false>(objectPointIds[0]) || database.hasObjectPoint<false>(objectPointIds[1]))
+				{
+					scopedIteration.setInaccurate();
+				}
+			}
+
+			// object points of different landmarks must never be merged, so that all observations of the remaining object points still fit
+
+			const Indices32 objectPointIds = database.objectPointIds<false>();
+
+			for (const Index32& objectPointId : objectPointIds)
+			{
+				const Vector3& objectPoint = database.objectPoint<false>(objectPointId);
+
+				Indices32 poseIds;
+				Indices32 imagePointIds;
+				Vectors2 imagePoints;
+				database.observationsFromObjectPoint<false>(objectPointId, poseIds, imagePointIds, &imagePoints);
+
+				for (size_t n = 0; n < poseIds.size(); ++n)
+				{
+					const HomogenousMatrix4& world_T_camera = database.pose<false>(poseIds[n]);
+
+					const Vector2 projectedObjectPoint = pinholeCamera.projectToImage<false>(world_T_camera, objectPoint, false);
+
+					if (projectedObjectPoint.sqrDistance(imagePoints[n]) > Scalar(5 * 5))
+					{
+						OCEAN_SET_FAILED(validation);
+					}
+				}
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance single-core: " << performanceSinglecore;
+	Log::info() << "Performance multi-core: " << performanceMulticore;
+	Log::info() << "Multi-core boost factor: " << String::toAString(performanceSinglecore.median() / performanceMulticore.median(), 1u) << "x (median)";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMapMerging::testOptimizePoseGraph(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Optimize pose graph test:";
+
+	constexpr unsigned int posesPerLap = 150u;
+	constexpr unsigned int numberLandmarks = 2000u;
+
+	Log::info() << "... with " << posesPerLap * 2u << " poses and " << numberLandmarks << " landmarks";
+
+	const PinholeCamera pinholeCamera(640u, 480u, Numeric::deg2rad(60));
+
+	RandomGenerator randomGenerator;
+
+	constexpr double successThreshold = 0.95;
+	ValidationPrecision validation(successThreshold, randomGenerator);
+
+	HighPerformanceStatistic performanceSinglecore;
+	HighPerformanceStatistic performanceMulticore;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		Tracking::Database database;
+		Tracking::MapBuilding::DescriptorHandling::FreakMultiDescriptorMap256 freakMap;
+		std::unordered_map<Index32, Index32> objectPointLandmarks;
+		Vectors3 landmarks;
+
+		createLoopDatabase(pinholeCamera, posesPerLap, numberLandmarks, randomGenerator, database, freakMap, objectPointLandmarks, landmarks);
+
+		const unsigned int numberPoses = posesPerLap * 2u;
+
+		HomogenousMatrices4 world_T_groundTruthCameras;
+		world_T_groundTruthCameras.reserve(numberPoses);
+
+		for (Index32 poseId = 0u; poseId < numberPoses; ++poseId)
+		{
+			world_T_groundTruthCameras.emplace_back(database.pose<false>(poseId));
+		}
+
+		// the loop closure edges between both laps are measured with the ground truth poses
+
+		Geometry::PoseGraphOptimization::Edges loopClosureEdges;
+
+		for (Index32 poseId = 0u; poseId < posesPerLap; poseId += 10u)
+		{
+			const Index32 loopPoseId = poseId + posesPerLap;
+
+			loopClosureEdges.emplace_back(poseId, loopPoseId, world_T_groundTruthCameras[poseId].inverted() * world_T_groundTruthCameras[loopPoseId], Scalar(50));
+		}
+
+		// the trajectory and the object points are drifting, object points drift with the first pose in which they are visible
+
+		const Scalar maximalDriftAngle = Numeric::deg2rad(Random::scalar(randomGenerator, Scalar(3), Scalar(10)));
+		const Vector3 maximalDriftTranslation = Random::vector3(randomGenerator, Scalar(-0.5), Scalar(0.5));
+
+		HomogenousMatrices4 drifts;
+		drifts.reserve(numberPoses);
+
+		for (Index32 poseId = 0u; poseId < numberPoses; ++poseId)
+		{
+			const Scalar factor = Scalar(poseId) / Scalar(numberPoses - 1u);
+
+			drifts.emplace_back(maximalDriftTranslation * factor, Rotation(0, 1, 0, maximalDriftAngle * factor));
+		}
+
+		for (const Index32& objectPointId : database.objectPointIds<false>())
+		{
+			Indices32 poseIds;
+			Indices32 imagePointIds;
+			database.observationsFromObjectPoint<false>(objectPointId, poseIds, imagePointIds);
+
+			ocean_assert(!poseIds.empty());
+			const Index32 firstPoseId = *std::min_element(poseIds.cbegin(), poseIds.cend());
+
+			database.setObjectPoint<false>(objectPointId, drifts[firstPoseId] * database.objectPoint<false>(objectPointId));
+		}
+
+		for (Index32 poseId = 0u; poseId < numberPoses; ++poseId)
+		{
+			database.setPose<false>(poseId, drifts[poseId] * world_T_groundTruthCameras[poseId]);
+		}
+
+		// the pose graph optimization cannot determine the absolute drift of the trajectory, but the drift between both laps
+
+		const auto determineLoopError = [&world_T_groundTruthCameras](const Tracking::Database& loopDatabase)
+		{
+			Scalar sumError = Scalar(0);
+
+			for (Index32 poseId = 0u; poseId < posesPerLap; ++poseId)
+			{
+				const HomogenousMatrix4 groundTruthCamera_T_loopCamera = world_T_groundTruthCameras[poseId].inverted() * world_T_groundTruthCameras[poseId + posesPerLap];
+				const HomogenousMatrix4 camera_T_loopCamera = loopDatabase.pose<false>(poseId).inverted() * loopDatabase.pose<false>(poseId + posesPerLap);
+
+				sumError += groundTruthCamera_T_loopCamera.translation().distance(camera_T_loopCamera.translation());
+			}
+
+			return sumError / Scalar(posesPerLap);
+		};
+
+		const Scalar initialLoopError = determineLoopError(database);
+
+		for (const bool useWorker : {false, true})
+		{
+			ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+			HighPerformanceStatistic& performance = useWorker ? performanceMulticore : performanceSinglecore;
+
+			Tracking::Database copyDatabase(database);
+
+			Scalar initialError = Numeric::maxValue();
+			Scalar finalError = Numeric::maxValue();
+
+			performance.start();
+				const bool result = Tracking::MapBuilding::MapMerging::optimizePoseGraph(copyDatabase, loopClosureEdges, 20u, 10u, 20u, useWorker ? &worker : nullptr, &initialError, &finalError);
+			performance.stop();
+
+			if (!result)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			if (finalError >= initialError)
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			// the pose graph optimization must remove most of the drift between both laps
+
+			if (determineLoopError(copyDatabase) > initialLoopError * Scalar(0.1))
+			{
+				scopedIteration.setInaccurate();
+			}
+
+			// the object points must still fit to the optimized poses
+
+			for (const Index32& objectPointId : copyDatabase.objectPointIds<false>())
+			{
+				const Vector3& objectPoint = copyDatabase.objectPoint<false>(objectPointId);
+
+				Indices32 poseIds;
+				Indices32 imagePointIds;
+				Vectors2 imagePoints;
+				copyDatabase.observationsFromObjectPoint<false>(objectPointId, poseIds, imagePointIds, &imagePoints);
+
+				const Index32 firstPoseId = *std::min_element(poseIds.cbegin(), poseIds.cend());
+
+				for (size_t n = 0; n < poseIds.size(); ++n)
+				{
+					if (poseIds[n] == firstPoseId)
+					{
+						const Vector2 projectedObjectPoint = pinholeCamera.projectToImage<false>(copyDatabase.pose<false>(poseIds[n]), objectPoint, false);
+
+						if (projectedObjectPoint.sqrDistance(imagePoints[n]) > Scalar(5 * 5))
+						{
+							OCEAN_SET_FAILED(validation);
+						}
+					}
+				}
+			}
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance single-core: " << performanceSinglecore;
+	Log::info() << "Performance multi-core: " << performanceMulticore;
+	Log::info() << "Multi-core boost factor: " << String::toAString(performanceSinglecore.median() / performanceMulticore.median(), 1u) << "x (median)";
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestMapMerging::createLoopDatabase(const PinholeCamera& pinholeCamera, const unsigned int posesPerLap, const unsigned int numberLandmarks, RandomGenerator& randomGenerator, Tracking::Database& database, Tracking::MapBuilding::DescriptorHandling::FreakMultiDescriptorMap256& freakMap, std::unordered_map<Index32, Index32>& objectPointLandmarks, Vectors3& landmarks)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(posesPerLap >= 10u && numberLandmarks >= 1u);
+
+	using FREAKDescriptor32 = CV::Detector::FREAKDescriptor32;
+
+	constexpr Scalar trajectoryRadius = Scalar(2);
+	constexpr Scalar cylinderRadius = Scalar(10);
+
+	database.clear<false>();
+	freakMap.clear();
+	objectPointLandmarks.clear();
+
+	landmarks.clear();
+	landmarks.reserve(numberLandmarks);
+
+	std::vector<FREAKDescriptor32::SinglelevelDescriptorData> landmarkDescriptors(numberLandmarks);
+
+	for (unsigned int nLandmark = 0u; nLandmark < numberLandmarks; ++nLandmark)
+	{
+		const Scalar angle = Random::scalar(randomGenerator, Scalar(0), Numeric::pi2());
+		const Scalar height = Random::scalar(randomGenerator, Scalar(-3), Scalar(3));
+
+		landmarks.emplace_back(Numeric::cos(angle) * cylinderRadius, height, Numeric::sin(angle) * cylinderRadius);
+
+		for (uint8_t& element : landmarkDescriptors[nLandmark])
+		{
+			element = uint8_t(RandomI::random(randomGenerator, 255u));
+		}
+	}
+
+	for (unsigned int nLap = 0u; nLap < 2u; ++nLap)
+	{
+		// each lap creates own object points for all landmarks, like a tracker without loop closure
+
+		Indices32 lapObjectPointIds(numberLandmarks, Tracking::Database::invalidId);
+
+		for (unsigned int nPose = 0u; nPose < posesPerLap; ++nPose)
+		{
+			const Index32 poseId = nLap * posesPerLap + nPose;
+
+			const Scalar angle = Numeric::pi2() * (Scalar(nPose) + Scalar(nLap) * Scalar(0.5)) / Scalar(posesPerLap);
+
+			// the camera is located on the trajectory circle and looks outwards towards the cylinder
+
+			const Vector3 translation(Numeric::cos(angle) * trajectoryRadius, Random::scalar(randomGenerator, Scalar(-0.05), Scalar(0.05)), Numeric::sin(angle) * trajectoryRadius);
+			const HomogenousMatrix4 world_T_camera(translation, Rotation(0, 1, 0, -(angle + Numeric::pi_2())));
+
+			database.addPose<false>(poseId, world_T_camera);
+
+			const HomogenousMatrix4 flippedCamera_T_world(PinholeCamera::standard2InvertedFlipped(world_T_camera));
+
+			for (unsigned int nLandmark = 0u; nLandmark < numberLandmarks; ++nLandmark)
+			{
+				const Vector3& landmark = landmarks[nLandmark];
+
+				if (!PinholeCamera::isObjectPointInFrontIF(flippedCamera_T_world, landmark))
+				{
+					continue;
+				}
+
+				const Vector2 imagePoint = pinholeCamera.projectToImageIF<false>(flippedCamera_T_world, landmark, false);
+
+				if (!pinholeCamera.isInside(imagePoint, Scalar(5)))
+				{
+					continue;
+				}
+
+				Index32& objectPointId = lapObjectPointIds[nLandmark];
+
+				if (objectPointId == Tracking::Database::invalidId)
+				{
+					const Vector3 objectPoint = nLap == 0u ? landmark : landmark + Random::vector3(randomGenerator, Scalar(-0.01), Scalar(0.01));
+
+					objectPointId = database.addObjectPoint<false>(objectPoint);
+
+					FREAKDescriptor32::MultilevelDescriptorData descriptorData;
+					descriptorData[0] = landmarkDescriptors[nLandmark];
+
+					if (nLap != 0u)
+					{
+						// the descriptor of the second lap is slightly different
+
+						for (unsigned int nBit = 0u; nBit < 8u; ++nBit)
+						{
+							const unsigned int bitIndex = RandomI::random(randomGenerator, (unsigned int)(descriptorData[0].size()) * 8u - 1u);
+
+							descriptorData[0][bitIndex / 8u] ^= uint8_t(1u << (bitIndex % 8u));
+						}
+					}
+
+					freakMap[objectPointId] = Tracking::MapBuilding::DescriptorHandling::FreakMultiDescriptors256(1, FREAKDescriptor32(std::move(descriptorData), 1u, 0.0f));
+
+					objectPointLandmarks.emplace(objectPointId, nLandmark);
+				}
+
+				const Index32 imagePointId = database.addImagePoint<false>(imagePoint + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5)));
+
+				database.attachImagePointToPose<false>(imagePointId, poseId);
+				database.attachImagePointToObjectPoint<false>(imagePointId, objectPointId);
+			}
+		}
+	}
+}
+
+}
+
+}
+
+}
+
+}
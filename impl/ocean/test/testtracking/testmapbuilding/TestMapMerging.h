@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_MAP_MERGING_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_MAP_MERGING_H
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapBuilding.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/math/PinholeCamera.h"
+
+#include "ocean/tracking/Database.h"
+
+#include "ocean/tracking/mapbuilding/DescriptorHandling.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * This class implements MapMerging tests.
+ * @ingroup testtrackingtestmapbuilding
+ */
+class OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT TestMapMerging
+{
+	public:
+
+		/**
+		 * Executes all MapMerging tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the loop closing based on the image retrieval index with a synthetic long trajectory.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testCloseLoopsWithImageRetrieval(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the pose graph optimization of a database with a drifted trajectory and loop closure edges.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testOptimizePoseGraph(const double testDuration, Worker& worker);
+
+	protected:
+
+		/**
+		 * Creates a synthetic database with a camera moving twice along a circle while observing 3D object points on a surrounding cylinder.
+		 * Each landmark receives individual object point ids in both laps, with almost identical descriptors, so that the loops are not yet closed.
+		 * @param pinholeCamera The camera profile to be used, must be valid
+		 * @param posesPerLap The number of poses in each lap, with range [10, infinity)
+		 * @param numberLandmarks The number of landmarks, with range [1, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param database The resulting database
+		 * @param freakMap The resulting descriptors of all object points
+		 * @param objectPointLandmarks The resulting map mapping object point ids to landmark indices
+		 * @param landmarks The resulting locations of the landmarks
+		 */
+		static void createLoopDatabase(const PinholeCamera& pinholeCamera, const unsigned int posesPerLap, const unsigned int numberLandmarks, RandomGenerator& randomGenerator, Tracking::Database& database, Tracking::MapBuilding::DescriptorHandling::FreakMultiDescriptorMap256& freakMap, std::unordered_map<Index32, Index32>& objectPointLandmarks, Vectors3& landmarks);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_MAP_MERGING_H
@@ -0,0 +1,740 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testmapbuilding/TestTiledFeatureMap.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/PinholeCamera.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/mapbuilding/PoseEstimation.h"
+#include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
+#include "ocean/tracking/mapbuilding/UnifiedMatching.h"
+
+#include <list>
+#include <map>
+#include <set>
+#include <tuple>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+using namespace Tracking::MapBuilding;
+
+bool TestTiledFeatureMap::test(const double testDuration, Worker& /*worker*/, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("TiledFeatureMap test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("tileloading"))
+	{
+		testResult = testTileLoading(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("eviction"))
+	{
+		testResult = testEviction(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("activetilespinned"))
+	{
+		testResult = testActiveTilesPinned(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("combinedmatching"))
+	{
+		testResult = testCombinedMatching(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestTiledFeatureMap, TileLoading)
+{
+	EXPECT_TRUE(TestTiledFeatureMap::testTileLoading(GTEST_TEST_DURATION));
+}
+
+TEST(TestTiledFeatureMap, Eviction)
+{
+	EXPECT_TRUE(TestTiledFeatureMap::testEviction(GTEST_TEST_DURATION));
+}
+
+TEST(TestTiledFeatureMap, ActiveTilesPinned)
+{
+	EXPECT_TRUE(TestTiledFeatureMap::testActiveTilesPinned(GTEST_TEST_DURATION));
+}
+
+TEST(TestTiledFeatureMap, CombinedMatching)
+{
+	EXPECT_TRUE(TestTiledFeatureMap::testCombinedMatching(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestTiledFeatureMap::testTileLoading(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Tile loading test:";
+
+	using TileKey = std::tuple<int, int, int>;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Scalar tileSize = Random::scalar(randomGenerator, Scalar(0.5), Scalar(5));
+
+		// each tile either has data, has no data, or fails to load for the first 'numberFailures' requests (e.g., due to temporary I/O errors)
+
+		const unsigned int numberFailures = RandomI::random(randomGenerator, 1u, 3u);
+
+		const auto tileType = [](const TiledFeatureMap::TileIndex& tileIndex)
+		{
+			return (unsigned int)(std::abs(tileIndex.x()) + std::abs(tileIndex.y()) + std::abs(tileIndex.z())) % 3u;
+		};
+
+		std::map<TileKey, unsigned int> loadRequests;
+
+		const TiledFeatureMap::TileLoaderFunction tileLoaderFunction = [&](const TiledFeatureMap::TileIndex& tileIndex, SharedUnifiedFeatureMap& featureMap, size_t& memorySize)
+		{
+			const unsigned int requests = ++loadRequests[TileKey(tileIndex.x(), tileIndex.y(), tileIndex.z())];
+
+			switch (tileType(tileIndex))
+			{
+				case 0u:
+					return TiledFeatureMap::LR_NO_DATA;
+
+				case 1u:
+				{
+					if (requests <= numberFailures)
+					{
+						return TiledFeatureMap::LR_FAILED;
+					}
+
+					break;
+				}
+
+				default:
+					break;
+			}
+
+			featureMap = createTileFeatureMap(tileIndex, tileSize, Indices32{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}, randomGenerator);
+			memorySize = 100;
+
+			return TiledFeatureMap::LR_SUCCEEDED;
+		};
+
+		TiledFeatureMap tiledFeatureMap(tileSize, tileLoaderFunction, 1000000);
+
+		std::map<TileKey, TiledFeatureMap::TileIndex> tileIndices;
+
+		while (tileIndices.size() < 10)
+		{
+			const TiledFeatureMap::TileIndex tileIndex(RandomI::random(randomGenerator, -5, 5), RandomI::random(randomGenerator, -5, 5), RandomI::random(randomGenerator, -5, 5));
+
+			tileIndices.emplace(TileKey(tileIndex.x(), tileIndex.y(), tileIndex.z()), tileIndex);
+		}
+
+		for (unsigned int nRound = 0u; nRound < numberFailures + 3u; ++nRound)
+		{
+			for (const std::pair<const TileKey, TiledFeatureMap::TileIndex>& tileIndexPair : tileIndices)
+			{
+				const TiledFeatureMap::TileIndex& tileIndex = tileIndexPair.second;
+
+				OCEAN_EXPECT_TRUE(validation, tiledFeatureMap.tileIndex(tileCenter(tileIndex, tileSize)) == tileIndex);
+
+				// a small radius around the tile's center covers exactly this tile
+
+				const SharedUnifiedFeatureMaps featureMaps = tiledFeatureMap.updatePosition(tileCenter(tileIndex, tileSize), tileSize * Scalar(0.25));
+
+				switch (tileType(tileIndex))
+				{
+					case 0u:
+						OCEAN_EXPECT_TRUE(validation, featureMaps.empty());
+						OCEAN_EXPECT_EQUAL(validation, loadRequests[tileIndexPair.first], 1u);
+						break;
+
+					case 1u:
+						OCEAN_EXPECT_EQUAL(validation, featureMaps.size(), nRound < numberFailures ? size_t(0) : size_t(1));
+						OCEAN_EXPECT_EQUAL(validation, loadRequests[tileIndexPair.first], std::min(nRound + 1u, numberFailures + 1u));
+						break;
+
+					default:
+						OCEAN_EXPECT_EQUAL(validation, featureMaps.size(), size_t(1));
+						OCEAN_EXPECT_EQUAL(validation, loadRequests[tileIndexPair.first], 1u);
+						break;
+				}
+			}
+		}
+
+		// clearing the map forgets the tiles without data
+
+		tiledFeatureMap.clear();
+
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.loadedTiles(), size_t(0));
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.memoryUsage(), size_t(0));
+
+		for (const std::pair<const TileKey, TiledFeatureMap::TileIndex>& tileIndexPair : tileIndices)
+		{
+			const unsigned int previousRequests = loadRequests[tileIndexPair.first];
+
+			tiledFeatureMap.updatePosition(tileCenter(tileIndexPair.second, tileSize), tileSize * Scalar(0.25));
+
+			OCEAN_EXPECT_EQUAL(validation, loadRequests[tileIndexPair.first], previousRequests + 1u);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTiledFeatureMap::testEviction(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Eviction test:";
+
+	constexpr size_t tileMemorySize = 100;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Scalar tileSize = Random::scalar(randomGenerator, Scalar(0.5), Scalar(5));
+
+		const unsigned int budgetTiles = RandomI::random(randomGenerator, 1u, 5u);
+
+		std::vector<int> loadRequests;
+
+		const TiledFeatureMap::TileLoaderFunction tileLoaderFunction = [&](const TiledFeatureMap::TileIndex& tileIndex, SharedUnifiedFeatureMap& featureMap, size_t& memorySize)
+		{
+			loadRequests.emplace_back(tileIndex.x());
+
+			featureMap = createTileFeatureMap(tileIndex, tileSize, Indices32{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}, randomGenerator);
+			memorySize = tileMemorySize;
+
+			return TiledFeatureMap::LR_SUCCEEDED;
+		};
+
+		TiledFeatureMap tiledFeatureMap(tileSize, tileLoaderFunction, budgetTiles * tileMemorySize);
+
+		// the expected least-recently-used order of the loaded tiles, the most recently used tile at the front
+
+		std::list<int> expectedLruTiles;
+
+		const unsigned int numberUpdates = RandomI::random(randomGenerator, 10u, 50u);
+
+		for (unsigned int nUpdate = 0u; nUpdate < numberUpdates; ++nUpdate)
+		{
+			const int x = RandomI::random(randomGenerator, 0, 7);
+
+			bool expectLoad = true;
+
+			for (std::list<int>::iterator iTile = expectedLruTiles.begin(); iTile != expectedLruTiles.end(); ++iTile)
+			{
+				if (*iTile == x)
+				{
+					expectedLruTiles.erase(iTile);
+					expectLoad = false;
+					break;
+				}
+			}
+
+			expectedLruTiles.emplace_front(x);
+
+			while (expectedLruTiles.size() > budgetTiles)
+			{
+				expectedLruTiles.pop_back();
+			}
+
+			loadRequests.clear();
+
+			const SharedUnifiedFeatureMaps featureMaps = tiledFeatureMap.updatePosition(tileCenter(TiledFeatureMap::TileIndex(x, 0, 0), tileSize), tileSize * Scalar(0.25));
+
+			OCEAN_EXPECT_EQUAL(validation, featureMaps.size(), size_t(1));
+
+			if (expectLoad)
+			{
+				OCEAN_EXPECT_EQUAL(validation, loadRequests.size(), size_t(1));
+				OCEAN_EXPECT_TRUE(validation, loadRequests.size() == 1 && loadRequests.front() == x);
+			}
+			else
+			{
+				OCEAN_EXPECT_TRUE(validation, loadRequests.empty());
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.loadedTiles(), expectedLruTiles.size());
+			OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.memoryUsage(), expectedLruTiles.size() * tileMemorySize);
+			OCEAN_EXPECT_LESS_EQUAL(validation, tiledFeatureMap.memoryUsage(), tiledFeatureMap.memoryBudget());
+		}
+
+		// reducing the budget evicts all but the active tile
+
+		tiledFeatureMap.setMemoryBudget(1);
+
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.loadedTiles(), size_t(1));
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.memoryUsage(), tileMemorySize);
+
+		loadRequests.clear();
+
+		tiledFeatureMap.updatePosition(tileCenter(TiledFeatureMap::TileIndex(expectedLruTiles.front(), 0, 0), tileSize), tileSize * Scalar(0.25));
+
+		OCEAN_EXPECT_TRUE(validation, loadRequests.empty());
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTiledFeatureMap::testActiveTilesPinned(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Active tiles pinned test:";
+
+	using TileKey = std::tuple<int, int, int>;
+
+	constexpr size_t tileMemorySize = 100;
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Scalar tileSize = Random::scalar(randomGenerator, Scalar(0.5), Scalar(5));
+
+		std::map<UnifiedFeatureMap*, TiledFeatureMap::TileIndex> featureMapTileIndices;
+
+		const TiledFeatureMap::TileLoaderFunction tileLoaderFunction = [&](const TiledFeatureMap::TileIndex& tileIndex, SharedUnifiedFeatureMap& featureMap, size_t& memorySize)
+		{
+			featureMap = createTileFeatureMap(tileIndex, tileSize, Indices32{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}, randomGenerator);
+			memorySize = tileMemorySize;
+
+			featureMapTileIndices[featureMap.get()] = tileIndex;
+
+			return TiledFeatureMap::LR_SUCCEEDED;
+		};
+
+		// the memory budget allows only one tile
+
+		TiledFeatureMap tiledFeatureMap(tileSize, tileLoaderFunction, tileMemorySize);
+
+		const TiledFeatureMap::TileIndex centerTileIndex(RandomI::random(randomGenerator, -10, 10), RandomI::random(randomGenerator, -10, 10), RandomI::random(randomGenerator, -10, 10));
+		const Vector3 position = tileCenter(centerTileIndex, tileSize);
+
+		// a radius of one tile around the center of a tile covers all 27 neighboring tiles
+
+		const SharedUnifiedFeatureMaps featureMaps = tiledFeatureMap.updatePosition(position, tileSize);
+
+		OCEAN_EXPECT_EQUAL(validation, featureMaps.size(), size_t(27));
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.loadedTiles(), size_t(27));
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.memoryUsage(), 27 * tileMemorySize);
+
+		std::set<TileKey> tileKeys;
+		Scalar previousSqrDistance = Scalar(0);
+
+		for (const SharedUnifiedFeatureMap& featureMap : featureMaps)
+		{
+			const std::map<UnifiedFeatureMap*, TiledFeatureMap::TileIndex>::const_iterator iTileIndex = featureMapTileIndices.find(featureMap.get());
+
+			if (iTileIndex == featureMapTileIndices.cend())
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			const TiledFeatureMap::TileIndex& tileIndex = iTileIndex->second;
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, std::abs(tileIndex.x() - centerTileIndex.x()), 1);
+			OCEAN_EXPECT_LESS_EQUAL(validation, std::abs(tileIndex.y() - centerTileIndex.y()), 1);
+			OCEAN_EXPECT_LESS_EQUAL(validation, std::abs(tileIndex.z() - centerTileIndex.z()), 1);
+
+			tileKeys.emplace(tileIndex.x(), tileIndex.y(), tileIndex.z());
+
+			// the feature maps are sorted by increasing distance to the position
+
+			const Scalar sqrDistance = tileCenter(tileIndex, tileSize).sqrDistance(position);
+
+			OCEAN_EXPECT_GREATER_EQUAL(validation, sqrDistance + Numeric::weakEps(), previousSqrDistance);
+			previousSqrDistance = sqrDistance;
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, tileKeys.size(), size_t(27));
+		OCEAN_EXPECT_TRUE(validation, !featureMaps.empty() && featureMapTileIndices[featureMaps.front().get()] == centerTileIndex);
+
+		// the active tiles stay in memory, also when the budget is set again
+
+		tiledFeatureMap.setMemoryBudget(tileMemorySize);
+
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.loadedTiles(), size_t(27));
+
+		// once the position moves away, the previously active tiles are evicted
+
+		const TiledFeatureMap::TileIndex farTileIndex(centerTileIndex.x() + 10, centerTileIndex.y(), centerTileIndex.z());
+
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.updatePosition(tileCenter(farTileIndex, tileSize), tileSize * Scalar(0.25)).size(), size_t(1));
+
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.loadedTiles(), size_t(1));
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.memoryUsage(), tileMemorySize);
+		OCEAN_EXPECT_EQUAL(validation, tiledFeatureMap.activeFeatureMaps().size(), size_t(1));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestTiledFeatureMap::testCombinedMatching(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Combined matching test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const AnyCameraPinhole anyCamera(PinholeCamera(640u, 480u, Numeric::deg2rad(70)));
+
+	const UnifiedMatching::DistanceValue maximalDescriptorDistance(256u * 20u / 100u);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Scalar tileSize = Random::scalar(randomGenerator, Scalar(0.5), Scalar(5));
+
+		const TiledFeatureMap::TileIndex tileIndexA(0, 0, 0);
+		const TiledFeatureMap::TileIndex tileIndexB(1, 0, 0);
+
+		// both tiles share the object points close to their border, e.g., because the tiles have been cut from one large map with overlapping borders
+
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 30u, 100u);
+
+		Vectors3 objectPoints;
+		CV::Detector::FREAKDescriptors32 descriptors;
+
+		Vectors3 objectPointsA;
+		Indices32 objectPointIdsA;
+		CV::Detector::FREAKDescriptors32 descriptorsA;
+
+		Vectors3 objectPointsB;
+		Indices32 objectPointIdsB;
+		CV::Detector::FREAKDescriptors32 descriptorsB;
+
+		for (unsigned int nObjectPoint = 0u; nObjectPoint < numberObjectPoints; ++nObjectPoint)
+		{
+			// the object points belong to tile A, to both tiles, or to tile B
+
+			const unsigned int tileMembership = nObjectPoint % 3u;
+
+			const Scalar xMin = tileSize * (tileMembership == 0u ? Scalar(0.5) : (tileMembership == 1u ? Scalar(0.9) : Scalar(1.1)));
+			const Scalar xMax = tileSize * (tileMembership == 0u ? Scalar(0.9) : (tileMembership == 1u ? Scalar(1.1) : Scalar(1.5)));
+
+			objectPoints.emplace_back(Random::scalar(randomGenerator, xMin, xMax), Random::scalar(randomGenerator, Scalar(0.2), Scalar(0.8)) * tileSize, Random::scalar(randomGenerator, Scalar(0), tileSize));
+			descriptors.emplace_back(randomDescriptor(randomGenerator));
+
+			if (tileMembership <= 1u)
+			{
+				objectPointsA.emplace_back(objectPoints.back());
+				objectPointIdsA.emplace_back(nObjectPoint);
+				descriptorsA.emplace_back(descriptors.back());
+			}
+
+			if (tileMembership >= 1u)
+			{
+				objectPointsB.emplace_back(objectPoints.back());
+				objectPointIdsB.emplace_back(nObjectPoint);
+				descriptorsB.emplace_back(descriptors.back());
+			}
+		}
+
+		const SharedUnifiedFeatureMap featureMapA = createFeatureMap(std::move(objectPointsA), std::move(objectPointIdsA), descriptorsA, randomGenerator);
+		const SharedUnifiedFeatureMap featureMapB = createFeatureMap(std::move(objectPointsB), std::move(objectPointIdsB), descriptorsB, randomGenerator);
+
+		const TiledFeatureMap::TileLoaderFunction tileLoaderFunction = [&](const TiledFeatureMap::TileIndex& tileIndex, SharedUnifiedFeatureMap& featureMap, size_t& memorySize)
+		{
+			if (tileIndex == tileIndexA)
+			{
+				featureMap = featureMapA;
+			}
+			else if (tileIndex == tileIndexB)
+			{
+				featureMap = featureMapB;
+			}
+			else
+			{
+				return TiledFeatureMap::LR_NO_DATA;
+			}
+
+			memorySize = 100;
+
+			return TiledFeatureMap::LR_SUCCEEDED;
+		};
+
+		TiledFeatureMap tiledFeatureMap(tileSize, tileLoaderFunction, 1000000);
+
+		// a position in tile A close to the border of tile B
+
+		const Vector3 borderPosition(tileSize * Scalar(0.9), tileSize * Scalar(0.5), tileSize * Scalar(0.5));
+
+		const SharedUnifiedFeatureMaps featureMaps = tiledFeatureMap.updatePosition(borderPosition, tileSize * Scalar(0.25));
+
+		OCEAN_EXPECT_EQUAL(validation, featureMaps.size(), size_t(2));
+
+		if (featureMaps.size() != 2 || featureMaps[0] != featureMapA || featureMaps[1] != featureMapB)
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		// the camera is located above the border of both tiles, looking towards the negative z-axis so that all object points are visible
+
+		const HomogenousMatrix4 world_T_camera(Vector3(tileSize, tileSize * Scalar(0.5), tileSize * Scalar(2.5)));
+
+		Vectors2 imagePoints;
+		imagePoints.reserve(objectPoints.size());
+
+		for (const Vector3& objectPoint : objectPoints)
+		{
+			imagePoints.emplace_back(anyCamera.projectToImage(world_T_camera, objectPoint));
+
+			OCEAN_EXPECT_TRUE(validation, anyCamera.isInside(imagePoints.back()));
+		}
+
+		const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256 imagePointDescriptors = UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256(CV::Detector::FREAKDescriptors32(descriptors));
+
+		SharedUnifiedUnguidedMatchings unifiedUnguidedMatchings;
+		SharedUnifiedGuidedMatchings unifiedGuidedMatchings;
+
+		for (const SharedUnifiedFeatureMap& featureMap : featureMaps)
+		{
+			SharedUnifiedUnguidedMatching unifiedUnguidedMatching;
+			SharedUnifiedGuidedMatching unifiedGuidedMatching;
+
+			if (!featureMap->createMatchingObjects(imagePoints.data(), &imagePointDescriptors, unifiedUnguidedMatching, unifiedGuidedMatching))
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			unifiedUnguidedMatchings.emplace_back(std::move(unifiedUnguidedMatching));
+			unifiedGuidedMatchings.emplace_back(std::move(unifiedGuidedMatching));
+		}
+
+		if (unifiedUnguidedMatchings.size() != 2 || unifiedGuidedMatchings.size() != 2)
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		// the unguided correspondences of all tiles are merged, each correspondence must be correct
+
+		size_t numberIndividualUnguidedMatches = 0;
+
+		for (const SharedUnifiedUnguidedMatching& unifiedUnguidedMatching : unifiedUnguidedMatchings)
+		{
+			Vectors2 matchedImagePoints;
+			Vectors3 matchedObjectPoints;
+			unifiedUnguidedMatching->determineUnguidedMatchings(1u, maximalDescriptorDistance, matchedImagePoints, matchedObjectPoints);
+
+			numberIndividualUnguidedMatches += matchedImagePoints.size();
+		}
+
+		const UnifiedUnguidedMatchingCombined unifiedUnguidedMatchingCombined(imagePoints.data(), imagePoints.size(), SharedUnifiedUnguidedMatchings(unifiedUnguidedMatchings));
+
+		Vectors2 unguidedImagePoints;
+		Vectors3 unguidedObjectPoints;
+		OCEAN_EXPECT_TRUE(validation, unifiedUnguidedMatchingCombined.determineUnguidedMatchings(1u, maximalDescriptorDistance, unguidedImagePoints, unguidedObjectPoints));
+
+		OCEAN_EXPECT_EQUAL(validation, unguidedImagePoints.size(), numberIndividualUnguidedMatches);
+		OCEAN_EXPECT_EQUAL(validation, unguidedObjectPoints.size(), numberIndividualUnguidedMatches);
+
+		for (size_t n = 0; n < unguidedImagePoints.size() && n < unguidedObjectPoints.size(); ++n)
+		{
+			OCEAN_EXPECT_LESS_EQUAL(validation, anyCamera.projectToImage(world_T_camera, unguidedObjectPoints[n]).distance(unguidedImagePoints[n]), Scalar(0.1));
+		}
+
+		// the guided correspondences of all tiles are merged, each image point and each object point is used at most once
+
+		const UnifiedGuidedMatchingCombined unifiedGuidedMatchingCombined(imagePoints.data(), imagePoints.size(), SharedUnifiedGuidedMatchings(unifiedGuidedMatchings));
+
+		Vectors2 guidedImagePoints;
+		Vectors3 guidedObjectPoints;
+		Indices32 guidedImagePointIndices;
+		Indices32 guidedObjectPointIds;
+		unifiedGuidedMatchingCombined.determineGuidedMatchings(anyCamera, world_T_camera, guidedImagePoints, guidedObjectPoints, maximalDescriptorDistance, &guidedImagePointIndices, &guidedObjectPointIds);
+
+		OCEAN_EXPECT_EQUAL(validation, guidedImagePoints.size(), objectPoints.size());
+		OCEAN_EXPECT_EQUAL(validation, guidedObjectPoints.size(), guidedImagePoints.size());
+		OCEAN_EXPECT_EQUAL(validation, guidedImagePointIndices.size(), guidedImagePoints.size());
+		OCEAN_EXPECT_EQUAL(validation, guidedObjectPointIds.size(), guidedImagePoints.size());
+
+		std::set<Index32> usedImagePointIndices;
+		std::set<Index32> usedObjectPointIds;
+
+		for (size_t n = 0; n < guidedImagePointIndices.size() && n < guidedObjectPointIds.size(); ++n)
+		{
+			const Index32 imagePointIndex = guidedImagePointIndices[n];
+			const Index32 objectPointId = guidedObjectPointIds[n];
+
+			OCEAN_EXPECT_TRUE(validation, usedImagePointIndices.emplace(imagePointIndex).second);
+			OCEAN_EXPECT_TRUE(validation, usedObjectPointIds.emplace(objectPointId).second);
+
+			// the image points have been created from the object points with identical ids
+
+			OCEAN_EXPECT_EQUAL(validation, imagePointIndex, objectPointId);
+		}
+
+		// the pose can be determined from the merged correspondences
+
+		HomogenousMatrix4 world_T_estimatedCamera(false);
+		Indices32 poseObjectPointIds;
+
+		if (PoseEstimation::determinePose(anyCamera, unifiedUnguidedMatchingCombined, unifiedGuidedMatchingCombined, randomGenerator, world_T_estimatedCamera, 10u, maximalDescriptorDistance, Scalar(2.5), Scalar(0.15), &poseObjectPointIds))
+		{
+			OCEAN_EXPECT_LESS_EQUAL(validation, world_T_estimatedCamera.translation().distance(world_T_camera.translation()), tileSize * Scalar(0.01));
+
+			// the pose uses object points which are known to tile A only and object points which are known to tile B only
+
+			bool usesTileA = false;
+			bool usesTileB = false;
+
+			for (const Index32 objectPointId : poseObjectPointIds)
+			{
+				usesTileA = usesTileA || objectPointId % 3u == 0u;
+				usesTileB = usesTileB || objectPointId % 3u == 2u;
+			}
+
+			OCEAN_EXPECT_TRUE(validation, usesTileA && usesTileB);
+		}
+		else
+		{
+			OCEAN_SET_FAILED(validation);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+SharedUnifiedFeatureMap TestTiledFeatureMap::createTileFeatureMap(const TiledFeatureMap::TileIndex& tileIndex, const Scalar tileSize, const Indices32& objectPointIds, RandomGenerator& randomGenerator)
+{
+	ocean_assert(tileSize > Numeric::eps());
+	ocean_assert(!objectPointIds.empty());
+
+	const Vector3 lowerCorner = Vector3(Scalar(tileIndex.x()), Scalar(tileIndex.y()), Scalar(tileIndex.z())) * tileSize;
+
+	Vectors3 objectPoints;
+	objectPoints.reserve(objectPointIds.size());
+
+	CV::Detector::FREAKDescriptors32 descriptors;
+	descriptors.reserve(objectPointIds.size());
+
+	for (size_t n = 0; n < objectPointIds.size(); ++n)
+	{
+		objectPoints.emplace_back(lowerCorner + Random::vector3(randomGenerator, Scalar(0), tileSize));
+		descriptors.emplace_back(randomDescriptor(randomGenerator));
+	}
+
+	return createFeatureMap(std::move(objectPoints), objectPointIds, descriptors, randomGenerator);
+}
+
+SharedUnifiedFeatureMap TestTiledFeatureMap::createFeatureMap(Vectors3 objectPoints, Indices32 objectPointIds, const CV::Detector::FREAKDescriptors32& descriptors, RandomGenerator& randomGenerator)
+{
+	ocean_assert(!objectPoints.empty());
+	ocean_assert(objectPoints.size() == objectPointIds.size());
+	ocean_assert(objectPoints.size() == descriptors.size());
+
+	using ImagePointDescriptor = UnifiedDescriptor::FreakMultiDescriptor256;
+	using ObjectPointDescriptor = UnifiedDescriptor::FreakMultiDescriptors256;
+	using ObjectPointVocabularyDescriptor = UnifiedDescriptor::BinaryDescriptor<256u>;
+
+	using FeatureMap = UnifiedFeatureMapT<ImagePointDescriptor, ObjectPointDescriptor, ObjectPointVocabularyDescriptor>;
+
+	UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap descriptorMap;
+
+	for (size_t n = 0; n < objectPointIds.size(); ++n)
+	{
+		descriptorMap.emplace(objectPointIds[n], CV::Detector::FREAKDescriptors32(1, descriptors[n]));
+	}
+
+	return std::make_shared<FeatureMap>(std::move(objectPoints), std::move(objectPointIds), std::make_shared<UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256>(std::move(descriptorMap)), randomGenerator, &FeatureMap::VocabularyForest::TVocabularyTree::determineClustersMeanForBinaryDescriptor<256u>, &UnifiedHelperFreakMultiDescriptor256::extractVocabularyDescriptorsFromMap);
+}
+
+CV::Detector::FREAKDescriptor32 TestTiledFeatureMap::randomDescriptor(RandomGenerator& randomGenerator)
+{
+	CV::Detector::FREAKDescriptor32::MultilevelDescriptorData descriptorData;
+
+	for (uint8_t& element : descriptorData[0])
+	{
+		element = uint8_t(RandomI::random(randomGenerator, 255u));
+	}
+
+	return CV::Detector::FREAKDescriptor32(std::move(descriptorData), 1u, 0.0f);
+}
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_TILED_FEATURE_MAP_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_TILED_FEATURE_MAP_H
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapBuilding.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/detector/FREAKDescriptor.h"
+
+#include "ocean/tracking/mapbuilding/TiledFeatureMap.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * This class implements tests for the tiled feature map.
+ * @ingroup testtrackingtestmapbuilding
+ */
+class OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT TestTiledFeatureMap
+{
+	public:
+
+		/**
+		 * Executes all tiled feature map tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests that tiles without data are requested only once while tiles which failed to load are requested again.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testTileLoading(const double testDuration);
+
+		/**
+		 * Tests the least-recently-used eviction of tiles once the memory budget is exceeded.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testEviction(const double testDuration);
+
+		/**
+		 * Tests that active tiles are never evicted, even if the active tiles exceed the memory budget.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testActiveTilesPinned(const double testDuration);
+
+		/**
+		 * Tests the matching against all active tiles with individual matching objects and merged correspondences.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testCombinedMatching(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a feature map with random object points inside a tile.
+		 * @param tileIndex The index of the tile
+		 * @param tileSize The edge length of the tile, with range (0, infinity)
+		 * @param objectPointIds The ids of the object points to be created, at least one
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting feature map
+		 */
+		static Tracking::MapBuilding::SharedUnifiedFeatureMap createTileFeatureMap(const Tracking::MapBuilding::TiledFeatureMap::TileIndex& tileIndex, const Scalar tileSize, const Indices32& objectPointIds, RandomGenerator& randomGenerator);
+
+		/**
+		 * Creates a feature map with given object points, each object point with one descriptor.
+		 * @param objectPoints The object points of the feature map, at least one
+		 * @param objectPointIds The ids of the object points, one for each object point
+		 * @param descriptors The descriptors of the object points, one for each object point
+		 * @param randomGenerator The random generator to be used
+		 * @return The resulting feature map
+		 */
+		static Tracking::MapBuilding::SharedUnifiedFeatureMap createFeatureMap(Vectors3 objectPoints, Indices32 objectPointIds, const CV::Detector::FREAKDescriptors32& descriptors, RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns a random single-level FREAK descriptor.
+		 * @param randomGenerator The random generator to be used
+		 * @return The random descriptor
+		 */
+		static CV::Detector::FREAKDescriptor32 randomDescriptor(RandomGenerator& randomGenerator);
+
+		/**
+		 * Returns the center of a tile.
+		 * @param tileIndex The index of the tile
+		 * @param tileSize The edge length of the tile, with range (0, infinity)
+		 * @return The center of the tile, in world coordinates
+		 */
+		static inline Vector3 tileCenter(const Tracking::MapBuilding::TiledFeatureMap::TileIndex& tileIndex, const Scalar tileSize);
+};
+
+inline Vector3 TestTiledFeatureMap::tileCenter(const Tracking::MapBuilding::TiledFeatureMap::TileIndex& tileIndex, const Scalar tileSize)
+{
+	return (Vector3(Scalar(tileIndex.x()), Scalar(tileIndex.y()), Scalar(tileIndex.z())) + Vector3(Scalar(0.5), Scalar(0.5), Scalar(0.5))) * tileSize;
+}
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_TILED_FEATURE_MAP_H
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testmapbuilding/TestUnifiedMatching.h"
+
+#include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/RandomGenerator.h"
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/geometry/Octree.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/mapbuilding/UnifiedMatching.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+bool TestUnifiedMatching::test(const double testDuration, Worker& worker, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("UnifiedMatching test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("guidedmatchingprojectiongrid"))
+	{
+		testResult = testGuidedMatchingProjectionGrid(testDuration, worker);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestUnifiedMatching, GuidedMatchingProjectionGrid)
+{
+	Worker worker;
+	EXPECT_TRUE(TestUnifiedMatching::testGuidedMatchingProjectionGrid(GTEST_TEST_DURATION, worker));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestUnifiedMatching::testGuidedMatchingProjectionGrid(const double testDuration, Worker& worker)
+{
+	ocean_assert(testDuration > 0.0);
+
+	using FREAKDescriptor32 = CV::Detector::FREAKDescriptor32;
+	using FREAKDescriptors32 = CV::Detector::FREAKDescriptors32;
+
+	using GuidedMatching = Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256;
+	using GuidedMatchingProjectionGrid = Tracking::MapBuilding::UnifiedGuidedMatchingProjectionGridFreakMultiLevelDescriptor256;
+
+	constexpr unsigned int numberDistractorObjectPoints = 20000u;
+
+	Log::info() << "Guided matching with projection grid test, with " << numberDistractorObjectPoints << " additional object points:";
+
+	const AnyCameraPinhole anyCamera(PinholeCamera(640u, 480u, Numeric::deg2rad(60)));
+
+	// the projected object points are at least 'gridSpacing - 2 * gridJitter' pixels apart, so that each image point has at most one correct candidate within the projection error of 20 pixels
+
+	constexpr unsigned int gridSpacing = 48u;
+	constexpr Scalar gridJitter = Scalar(6);
+
+	const Tracking::MapBuilding::UnifiedMatching::DistanceValue maximalDescriptorDistance(64u);
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	HighPerformanceStatistic performanceOctree;
+	HighPerformanceStatistic performanceProjectionGrid;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const HomogenousMatrix4 world_T_camera(Random::vector3(randomGenerator, Scalar(-5), Scalar(5)), Random::rotation(randomGenerator));
+
+		Vectors3 objectPoints;
+		Indices32 objectPointIds;
+		GuidedMatching::UnorderedDescriptorMap<FREAKDescriptors32> objectPointDescriptorMap;
+
+		Vectors2 imagePoints;
+		std::vector<FREAKDescriptor32> imagePointDescriptors;
+
+		// the ids of the object points which are observed by the image points, one for each image point, -1 for image points without correspondence
+		Indices32 expectedObjectPointIds;
+
+		const auto addObjectPoint = [&](const Vector3& objectPoint) -> FREAKDescriptor32::SinglelevelDescriptorData
+		{
+			const Index32 objectPointId = Index32(objectPoints.size()) * 3u + 7u;
+
+			FREAKDescriptor32::MultilevelDescriptorData descriptorData;
+
+			for (uint8_t& element : descriptorData[0])
+			{
+				element = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			objectPoints.emplace_back(objectPoint);
+			objectPointIds.emplace_back(objectPointId);
+
+			objectPointDescriptorMap.emplace(objectPointId, FREAKDescriptors32(1, FREAKDescriptor32(FREAKDescriptor32::MultilevelDescriptorData(descriptorData), 1u, 0.0f)));
+
+			return descriptorData[0];
+		};
+
+		for (unsigned int y = gridSpacing / 2u; y < anyCamera.height(); y += gridSpacing)
+		{
+			for (unsigned int x = gridSpacing / 2u; x < anyCamera.width(); x += gridSpacing)
+			{
+				const Vector2 gridPoint = Vector2(Scalar(x), Scalar(y)) + Random::vector2(randomGenerator, -gridJitter, gridJitter);
+
+				const Vector3 objectPoint = anyCamera.ray(gridPoint, world_T_camera).point(Random::scalar(randomGenerator, Scalar(1), Scalar(10)));
+
+				FREAKDescriptor32::SinglelevelDescriptorData descriptorData = addObjectPoint(objectPoint);
+
+				if (RandomI::boolean(randomGenerator))
+				{
+					// an object point with an observation
+
+					for (unsigned int nBit = 0u; nBit < 10u; ++nBit)
+					{
+						const unsigned int bitIndex = RandomI::random(randomGenerator, (unsigned int)(descriptorData.size()) * 8u - 1u);
+
+						descriptorData[bitIndex / 8u] ^= uint8_t(1u << (bitIndex % 8u));
+					}
+
+					FREAKDescriptor32::MultilevelDescriptorData imagePointDescriptorData;
+					imagePointDescriptorData[0] = descriptorData;
+
+					imagePoints.emplace_back(anyCamera.projectToImage(world_T_camera, objectPoint) + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5)));
+					imagePointDescriptors.emplace_back(std::move(imagePointDescriptorData), 1u, 0.0f);
+
+					expectedObjectPointIds.emplace_back(objectPointIds.back());
+				}
+
+				if (RandomI::random(randomGenerator, 4u) == 0u)
+				{
+					// an object point behind the camera, projecting to the same image location
+
+					addObjectPoint(world_T_camera.translation() * Scalar(2) - objectPoint);
+				}
+			}
+		}
+
+		for (unsigned int n = 0u; n < 20u; ++n)
+		{
+			// image points without correspondence
+
+			FREAKDescriptor32::MultilevelDescriptorData imagePointDescriptorData;
+
+			for (uint8_t& element : imagePointDescriptorData[0])
+			{
+				element = uint8_t(RandomI::random(randomGenerator, 255u));
+			}
+
+			imagePoints.emplace_back(Random::vector2(randomGenerator, Scalar(5), Scalar(anyCamera.width() - 6u), Scalar(5), Scalar(anyCamera.height() - 6u)));
+			imagePointDescriptors.emplace_back(std::move(imagePointDescriptorData), 1u, 0.0f);
+
+			expectedObjectPointIds.emplace_back(Index32(-1));
+		}
+
+		for (unsigned int n = 0u; n < numberDistractorObjectPoints; ++n)
+		{
+			// distractor object points with random descriptors, mostly not visible in the camera
+
+			addObjectPoint(Random::vector3(randomGenerator, Scalar(-50), Scalar(50)));
+		}
+
+		ocean_assert(imagePoints.size() == imagePointDescriptors.size());
+
+		const Geometry::Octree objectPointOctree(objectPoints.data(), objectPoints.size(), Geometry::Octree::Parameters(40u, true));
+
+		const GuidedMatching guidedMatching(imagePoints.data(), imagePointDescriptors.data(), imagePoints.size(), objectPoints.data(), objectPoints.size(), objectPointOctree, objectPointIds.data(), objectPointDescriptorMap);
+		const GuidedMatchingProjectionGrid guidedMatchingProjectionGrid(imagePoints.data(), imagePointDescriptors.data(), imagePoints.size(), objectPoints.data(), objectPoints.size(), objectPointIds.data(), objectPointDescriptorMap);
+
+		Worker* useWorker = RandomI::boolean(randomGenerator) ? &worker : nullptr;
+
+		Vectors2 octreeImagePoints;
+		Vectors3 octreeObjectPoints;
+		Indices32 octreeImagePointIndices;
+		Indices32 octreeObjectPointIds;
+
+		performanceOctree.start();
+			guidedMatching.determineGuidedMatchings(anyCamera, world_T_camera, octreeImagePoints, octreeObjectPoints, maximalDescriptorDistance, &octreeImagePointIndices, &octreeObjectPointIds, useWorker);
+		performanceOctree.stop();
+
+		Vectors2 gridImagePoints;
+		Vectors3 gridObjectPoints;
+		Indices32 gridImagePointIndices;
+		Indices32 gridObjectPointIds;
+
+		performanceProjectionGrid.start();
+			guidedMatchingProjectionGrid.determineGuidedMatchings(anyCamera, world_T_camera, gridImagePoints, gridObjectPoints, maximalDescriptorDistance, &gridImagePointIndices, &gridObjectPointIds, useWorker);
+		performanceProjectionGrid.stop();
+
+		if (octreeImagePoints.size() != octreeImagePointIndices.size() || octreeObjectPoints.size() != octreeImagePointIndices.size() || octreeObjectPointIds.size() != octreeImagePointIndices.size()
+				|| gridImagePoints.size() != gridImagePointIndices.size() || gridObjectPoints.size() != gridImagePointIndices.size() || gridObjectPointIds.size() != gridImagePointIndices.size())
+		{
+			OCEAN_SET_FAILED(validation);
+			break;
+		}
+
+		// the order of the matches depends on the worker, so we sort the matches by the indices of the image points
+
+		std::vector<Index32> octreeMatchedObjectPointIds(imagePoints.size(), Index32(-1));
+		std::vector<Index32> gridMatchedObjectPointIds(imagePoints.size(), Index32(-1));
+
+		for (size_t n = 0; n < octreeImagePointIndices.size(); ++n)
+		{
+			const Index32 imagePointIndex = octreeImagePointIndices[n];
+
+			OCEAN_EXPECT_LESS(validation, size_t(imagePointIndex), imagePoints.size());
+
+			if (size_t(imagePointIndex) < imagePoints.size())
+			{
+				OCEAN_EXPECT_EQUAL(validation, octreeMatchedObjectPointIds[imagePointIndex], Index32(-1));
+				octreeMatchedObjectPointIds[imagePointIndex] = octreeObjectPointIds[n];
+
+				OCEAN_EXPECT_TRUE(validation, octreeImagePoints[n] == imagePoints[imagePointIndex]);
+			}
+		}
+
+		for (size_t n = 0; n < gridImagePointIndices.size(); ++n)
+		{
+			const Index32 imagePointIndex = gridImagePointIndices[n];
+
+			OCEAN_EXPECT_LESS(validation, size_t(imagePointIndex), imagePoints.size());
+
+			if (size_t(imagePointIndex) < imagePoints.size())
+			{
+				OCEAN_EXPECT_EQUAL(validation, gridMatchedObjectPointIds[imagePointIndex], Index32(-1));
+				gridMatchedObjectPointIds[imagePointIndex] = gridObjectPointIds[n];
+
+				OCEAN_EXPECT_TRUE(validation, gridImagePoints[n] == imagePoints[imagePointIndex]);
+
+				// the object point ids are 'index * 3 + 7'
+				const Index32 objectPointIndex = (gridObjectPointIds[n] - 7u) / 3u;
+
+				OCEAN_EXPECT_TRUE(validation, size_t(objectPointIndex) < objectPoints.size() && gridObjectPoints[n] == objectPoints[objectPointIndex]);
+			}
+		}
+
+		// both matching objects need to determine identical matches, and all matches need to be correct
+
+		OCEAN_EXPECT_EQUAL(validation, gridImagePointIndices.size(), octreeImagePointIndices.size());
+
+		for (size_t nImagePoint = 0; nImagePoint < imagePoints.size(); ++nImagePoint)
+		{
+			OCEAN_EXPECT_EQUAL(validation, gridMatchedObjectPointIds[nImagePoint], octreeMatchedObjectPointIds[nImagePoint]);
+			OCEAN_EXPECT_EQUAL(validation, gridMatchedObjectPointIds[nImagePoint], expectedObjectPointIds[nImagePoint]);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Performance octree: " << performanceOctree;
+	Log::info() << "Performance projection grid: " << performanceProjectionGrid;
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
+
+}
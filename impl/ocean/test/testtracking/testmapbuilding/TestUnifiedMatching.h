@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_UNIFIED_MATCHING_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_UNIFIED_MATCHING_H
+
+#include "ocean/test/testtracking/testmapbuilding/TestMapBuilding.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/Worker.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestMapBuilding
+{
+
+/**
+ * This class implements tests for the unified matching objects.
+ * @ingroup testtrackingtestmapbuilding
+ */
+class OCEAN_TEST_TRACKING_MAPBUILDING_EXPORT TestUnifiedMatching
+{
+	public:
+
+		/**
+		 * Executes all unified matching tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, Worker& worker, const TestSelector& selector);
+
+		/**
+		 * Tests the guided matching based on a projection grid and ensures that the matches are identical to the matches of the octree-based guided matching.
+		 * @param testDuration Number of seconds for each test
+		 * @param worker The worker object
+		 * @return True, if succeeded
+		 */
+		static bool testGuidedMatchingProjectionGrid(const double testDuration, Worker& worker);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTMAPBUILDING_TEST_UNIFIED_MATCHING_H
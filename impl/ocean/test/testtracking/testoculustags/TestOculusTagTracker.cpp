@@ -17,6 +17,10 @@
 
 #include "ocean/cv/CVUtilities.h"
 
+#include "ocean/math/Random.h"
+
+#include "ocean/tracking/oculustags/Utilities.h"
+
 #include "ocean/test/testgeometry/Utilities.h"
 
 using namespace Ocean::Tracking::OculusTags;
@@ -50,6 +54,33 @@ bool TestOculusTagTracker::test(const double testDuration, Worker& worker, const
 		Log::info() << " ";
 	}
 
+	if (selector.shouldRun("detectionscan"))
+	{
+		testResult = testDetectionScan(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("detectquadsregionofinterest"))
+	{
+		testResult = testDetectQuadsRegionOfInterest(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("detectquadsinregion"))
+	{
+		testResult = testDetectQuadsInRegion(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
 	Log::info() << testResult;
 
 	return testResult.succeeded();
@@ -76,6 +107,21 @@ TEST(TestOculusTags, OculusTagTrackerStressTestNegative)
 	EXPECT_TRUE(TestOculusTagTracker::testStressTestNegative(GTEST_TEST_DURATION, worker));
 }
 
+TEST(TestOculusTags, OculusTagTrackerDetectionScan)
+{
+	EXPECT_TRUE(TestOculusTagTracker::testDetectionScan(GTEST_TEST_DURATION));
+}
+
+TEST(TestOculusTags, OculusTagTrackerDetectQuadsRegionOfInterest)
+{
+	EXPECT_TRUE(TestOculusTagTracker::testDetectQuadsRegionOfInterest(GTEST_TEST_DURATION));
+}
+
+TEST(TestOculusTags, OculusTagTrackerDetectQuadsInRegion)
+{
+	EXPECT_TRUE(TestOculusTagTracker::testDetectQuadsInRegion(GTEST_TEST_DURATION));
+}
+
 #endif // OCEAN_USE_GTEST
 
 bool TestOculusTagTracker::testStressTestNegative(const double testDuration, Worker& /*worker*/)
@@ -135,6 +181,318 @@ bool TestOculusTagTracker::testStressTestNegative(const double testDuration, Wor
 	return validation.succeeded();
 }
 
+bool TestOculusTagTracker::testDetectionScan(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Detection scan test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 1u, 2000u);
+		const unsigned int height = RandomI::random(randomGenerator, numberDetectionBands_ + 1u, 2000u);
+
+		std::vector<unsigned int> rowCoverage(height, 0u);
+		std::vector<CV::PixelBoundingBox> bands;
+
+		for (unsigned int scanIndex = 0u; scanIndex < numberDetectionBands_; ++scanIndex)
+		{
+			CV::PixelBoundingBox regionOfInterest;
+			unsigned int layerIndex = (unsigned int)(-1);
+
+			determineDetectionScan(width, height, scanIndex, regionOfInterest, layerIndex);
+
+			// the bands are scanned on the finest layer and cover the entire width of the frame
+
+			OCEAN_EXPECT_EQUAL(validation, layerIndex, 0u);
+
+			if (regionOfInterest.isValid() && regionOfInterest.left() == 0u && regionOfInterest.right() == width - 1u && regionOfInterest.bottom() < height)
+			{
+				for (unsigned int y = regionOfInterest.top(); y <= regionOfInterest.bottom(); ++y)
+				{
+					++rowCoverage[y];
+				}
+
+				bands.emplace_back(regionOfInterest);
+			}
+			else
+			{
+				OCEAN_SET_FAILED(validation);
+			}
+		}
+
+		// each row is covered by at least one band
+
+		for (const unsigned int coverage : rowCoverage)
+		{
+			OCEAN_EXPECT_GREATER(validation, coverage, 0u);
+		}
+
+		// a tag with a height of up to one slice is entirely visible in at least one band, regardless of its vertical location
+
+		const unsigned int sliceHeight = height / (numberDetectionBands_ + 1u);
+		ocean_assert(sliceHeight >= 1u);
+
+		for (unsigned int top = 0u; top + sliceHeight <= height; ++top)
+		{
+			const unsigned int bottom = top + sliceHeight - 1u;
+
+			bool isInsideBand = false;
+
+			for (const CV::PixelBoundingBox& band : bands)
+			{
+				if (band.top() <= top && bottom <= band.bottom())
+				{
+					isInsideBand = true;
+					break;
+				}
+			}
+
+			OCEAN_EXPECT_TRUE(validation, isInsideBand);
+		}
+
+		// the last scan covers the entire frame on the coarser layer
+
+		CV::PixelBoundingBox regionOfInterest;
+		unsigned int layerIndex = (unsigned int)(-1);
+
+		determineDetectionScan(width, height, numberDetectionBands_, regionOfInterest, layerIndex);
+
+		OCEAN_EXPECT_TRUE(validation, regionOfInterest == CV::PixelBoundingBox(0u, 0u, width - 1u, height - 1u));
+		OCEAN_EXPECT_EQUAL(validation, layerIndex, detectionCoarseLayerIndex_);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestOculusTagTracker::testDetectQuadsRegionOfInterest(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Quad detection in region of interest test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Scalar maximalDistance = Scalar(1.5);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 320u, 640u);
+		const unsigned int height = RandomI::random(randomGenerator, 320u, 480u);
+
+		QuadDetector::Quad tagQuad;
+		const Frame yFrame = createFrameWithTag(width, height, randomGenerator, tagQuad);
+
+		const unsigned int tagLeft = (unsigned int)(Numeric::floor(tagQuad[0].x()));
+		const unsigned int tagTop = (unsigned int)(Numeric::floor(tagQuad[0].y()));
+		const unsigned int tagRight = (unsigned int)(Numeric::ceil(tagQuad[2].x()));
+		const unsigned int tagBottom = (unsigned int)(Numeric::ceil(tagQuad[2].y()));
+
+		// the tag must be detected in the entire frame
+
+		const QuadDetector::Quads frameQuads = QuadDetector::detectQuads(yFrame, frameBorder_);
+
+		OCEAN_EXPECT_TRUE(validation, hasMatchingQuad(frameQuads, tagQuad, maximalDistance));
+
+		// the tag must be detected in a region of interest containing the tag, with corners defined in the frame
+
+		{
+			const unsigned int margin = RandomI::random(randomGenerator, 10u, 40u);
+
+			const CV::PixelBoundingBox regionOfInterest(tagLeft > margin ? tagLeft - margin : 0u, tagTop > margin ? tagTop - margin : 0u, std::min(tagRight + margin, width - 1u), std::min(tagBottom + margin, height - 1u));
+
+			const QuadDetector::Quads regionQuads = QuadDetector::detectQuads(yFrame, regionOfInterest, frameBorder_);
+
+			OCEAN_EXPECT_TRUE(validation, hasMatchingQuad(regionQuads, tagQuad, maximalDistance));
+
+			for (const QuadDetector::Quad& regionQuad : regionQuads)
+			{
+				for (const Vector2& corner : regionQuad)
+				{
+					OCEAN_EXPECT_GREATER_EQUAL(validation, corner.x(), Scalar(regionOfInterest.left()) - maximalDistance);
+					OCEAN_EXPECT_GREATER_EQUAL(validation, corner.y(), Scalar(regionOfInterest.top()) - maximalDistance);
+					OCEAN_EXPECT_LESS_EQUAL(validation, corner.x(), Scalar(regionOfInterest.right()) + maximalDistance);
+					OCEAN_EXPECT_LESS_EQUAL(validation, corner.y(), Scalar(regionOfInterest.bottom()) + maximalDistance);
+				}
+			}
+		}
+
+		// the tag must not be detected in a region of interest next to the tag
+
+		{
+			CV::PixelBoundingBox regionOfInterest;
+
+			switch (RandomI::random(randomGenerator, 3u))
+			{
+				case 0u:
+					regionOfInterest = CV::PixelBoundingBox(0u, 0u, tagLeft - 2u, height - 1u);
+					break;
+
+				case 1u:
+					regionOfInterest = CV::PixelBoundingBox(tagRight + 2u, 0u, width - 1u, height - 1u);
+					break;
+
+				case 2u:
+					regionOfInterest = CV::PixelBoundingBox(0u, 0u, width - 1u, tagTop - 2u);
+					break;
+
+				default:
+					regionOfInterest = CV::PixelBoundingBox(0u, tagBottom + 2u, width - 1u, height - 1u);
+					break;
+			}
+
+			const QuadDetector::Quads regionQuads = QuadDetector::detectQuads(yFrame, regionOfInterest, frameBorder_);
+
+			OCEAN_EXPECT_FALSE(validation, hasMatchingQuad(regionQuads, tagQuad, maximalDistance));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestOculusTagTracker::testDetectQuadsInRegion(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Quad detection on pyramid layers test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Scalar maximalDistance = Scalar(1.5);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const unsigned int width = RandomI::random(randomGenerator, 320u, 640u);
+		const unsigned int height = RandomI::random(randomGenerator, 320u, 480u);
+
+		QuadDetector::Quad tagQuad;
+		const Frame yFrame = createFrameWithTag(width, height, randomGenerator, tagQuad);
+
+		const CV::FramePyramid framePyramid = createFramePyramid(yFrame, numberFrameLayers_);
+
+		const CV::PixelBoundingBox regionOfInterest(0u, 0u, width - 1u, height - 1u);
+
+		const QuadDetector::Quads finestLayerQuads = detectQuadsInRegion(framePyramid, regionOfInterest, 0u);
+
+		OCEAN_EXPECT_TRUE(validation, hasMatchingQuad(finestLayerQuads, tagQuad, maximalDistance));
+
+		// the tag is detected on a coarser layer on which the tag has an edge length of at least 24 pixels, the corners must be refined to the accuracy of the finest layer
+
+		const Scalar tagEdgeLength = tagQuad[2].x() - tagQuad[0].x();
+
+		unsigned int maximalLayerIndex = 1u;
+
+		while (maximalLayerIndex + 1u < framePyramid.layers() && tagEdgeLength >= Scalar(24u << (maximalLayerIndex + 1u)))
+		{
+			++maximalLayerIndex;
+		}
+
+		const unsigned int layerIndex = RandomI::random(randomGenerator, 1u, maximalLayerIndex);
+
+		const QuadDetector::Quads coarseLayerQuads = detectQuadsInRegion(framePyramid, regionOfInterest, layerIndex);
+
+		OCEAN_EXPECT_TRUE(validation, hasMatchingQuad(coarseLayerQuads, tagQuad, maximalDistance));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+Frame TestOculusTagTracker::createFrameWithTag(const unsigned int width, const unsigned int height, RandomGenerator& randomGenerator, QuadDetector::Quad& tagQuad)
+{
+	ocean_assert(width >= 320u && height >= 320u);
+
+	// the module size must be large enough for the logo inside the tag
+
+	const unsigned int moduleSize = RandomI::random(randomGenerator, 16u, 20u);
+	const unsigned int tagSize = moduleSize * OculusTag::numberOfModules;
+
+	// the tag image contains a light border with the size of one module around the tag
+
+	const Frame yTagFrame = Tracking::OculusTags::Utilities::generateTagImage(RandomI::random(randomGenerator, 1023u), OculusTag::RT_REFLECTANCE_NORMAL, tagSize, 1u);
+	ocean_assert(yTagFrame.isValid() && yTagFrame.width() == tagSize + moduleSize * 2u);
+
+	Frame yFrame(FrameType(width, height, FrameType::FORMAT_Y8, FrameType::ORIGIN_UPPER_LEFT));
+	yFrame.setValue(0xFFu);
+
+	// the tag is placed with some distance to the frame border
+
+	const unsigned int distance = frameBorder_ + 10u;
+
+	const unsigned int left = RandomI::random(randomGenerator, distance, width - yTagFrame.width() - distance);
+	const unsigned int top = RandomI::random(randomGenerator, distance, height - yTagFrame.height() - distance);
+
+	yFrame.copy(int(left), int(top), yTagFrame);
+
+	const Scalar tagLeft = Scalar(left + moduleSize) - Scalar(0.5);
+	const Scalar tagTop = Scalar(top + moduleSize) - Scalar(0.5);
+
+	tagQuad[0] = Vector2(tagLeft, tagTop);
+	tagQuad[1] = Vector2(tagLeft, tagTop + Scalar(tagSize));
+	tagQuad[2] = Vector2(tagLeft + Scalar(tagSize), tagTop + Scalar(tagSize));
+	tagQuad[3] = Vector2(tagLeft + Scalar(tagSize), tagTop);
+
+	return yFrame;
+}
+
+bool TestOculusTagTracker::hasMatchingQuad(const QuadDetector::Quads& quads, const QuadDetector::Quad& quad, const Scalar maximalDistance)
+{
+	ocean_assert(maximalDistance >= 0);
+
+	const Scalar maximalSqrDistance = Numeric::sqr(maximalDistance);
+
+	for (const QuadDetector::Quad& candidateQuad : quads)
+	{
+		bool allCornersMatch = true;
+
+		for (const Vector2& corner : quad)
+		{
+			bool cornerMatches = false;
+
+			for (const Vector2& candidateCorner : candidateQuad)
+			{
+				if (corner.sqrDistance(candidateCorner) <= maximalSqrDistance)
+				{
+					cornerMatches = true;
+					break;
+				}
+			}
+
+			if (!cornerMatches)
+			{
+				allCornersMatch = false;
+				break;
+			}
+		}
+
+		if (allCornersMatch)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 } // namespace TestTrackingOculusTag
 
 } // namespace TestTracking
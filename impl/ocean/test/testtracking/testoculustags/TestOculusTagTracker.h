@@ -51,6 +51,48 @@ class OCEAN_TEST_TRACKING_OCULUSTAGS_EXPORT TestOculusTagTracker : protected Tra
 		 * @return True, if succeeded
 		 */
 		static bool testStressTestNegative(const double testDuration, Worker& worker);
+
+		/**
+		 * Tests the regions of interest of the amortized full-frame detection.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testDetectionScan(const double testDuration);
+
+		/**
+		 * Tests the quad detection in a region of interest of a frame.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testDetectQuadsRegionOfInterest(const double testDuration);
+
+		/**
+		 * Tests the quad detection on coarser pyramid layers with the refinement of the corners on the finest layer.
+		 * @param testDuration Number of seconds for each test, with range (0, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool testDetectQuadsInRegion(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a frame with uniform background showing one axis-aligned tag.
+		 * @param width The width of the frame, in pixels, range: [320, infinity)
+		 * @param height The height of the frame, in pixels, range: [320, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param tagQuad The resulting four outer corners of the tag, in pixels, with pixel centers at integer coordinates
+		 * @return The resulting frame with pixel format FORMAT_Y8
+		 */
+		static Frame createFrameWithTag(const unsigned int width, const unsigned int height, RandomGenerator& randomGenerator, Tracking::OculusTags::QuadDetector::Quad& tagQuad);
+
+		/**
+		 * Returns whether a set of quads contains a quad with corners close to the corners of a given quad.
+		 * @param quads The quads to check
+		 * @param quad The quad to be found, the order of the corners is not relevant
+		 * @param maximalDistance The maximal distance between corresponding corners, in pixels, range: [0, infinity)
+		 * @return True, if so
+		 */
+		static bool hasMatchingQuad(const Tracking::OculusTags::QuadDetector::Quads& quads, const Tracking::OculusTags::QuadDetector::Quad& quad, const Scalar maximalDistance);
 };
 
 }
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestIMUPreintegrator.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/ExponentialMap.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/slam/IMUPreintegrator.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+using namespace Tracking::SLAM;
+
+namespace
+{
+
+/**
+ * This class implements a synthetic trajectory with constant angular velocity (defined in the sensor) and constant acceleration (defined in world).
+ */
+class SyntheticTrajectory
+{
+	public:
+
+		/**
+		 * Creates a new random trajectory.
+		 * @param randomGenerator The random generator to be used
+		 */
+		explicit SyntheticTrajectory(RandomGenerator& randomGenerator) :
+			world_Q_startSensor_(Random::quaternion(randomGenerator)),
+			worldStartPosition_(Random::vector3(randomGenerator, -5, 5)),
+			worldStartVelocity_(Random::vector3(randomGenerator, -2, 2)),
+			worldAcceleration_(Random::vector3(randomGenerator, -5, 5)),
+			angularVelocity_(Random::vector3(randomGenerator, -2, 2))
+		{
+			// nothing to do here
+		}
+
+		/**
+		 * Returns the pose of the sensor at a specific time.
+		 * @param time The time since the start of the trajectory, in seconds
+		 * @return The sensor pose
+		 */
+		HomogenousMatrix4 world_T_sensor(const double time) const
+		{
+			const Scalar t = Scalar(time);
+
+			return HomogenousMatrix4(worldStartPosition_ + worldStartVelocity_ * t + worldAcceleration_ * (Scalar(0.5) * t * t), world_Q_sensor(time));
+		}
+
+		/**
+		 * Returns the orientation of the sensor at a specific time.
+		 * @param time The time since the start of the trajectory, in seconds
+		 * @return The sensor orientation
+		 */
+		Quaternion world_Q_sensor(const double time) const
+		{
+			return world_Q_startSensor_ * ExponentialMap(angularVelocity_ * Scalar(time)).quaternion();
+		}
+
+		/**
+		 * Returns the velocity of the sensor at a specific time.
+		 * @param time The time since the start of the trajectory, in seconds
+		 * @return The sensor velocity, defined in world
+		 */
+		Vector3 worldVelocity(const double time) const
+		{
+			return worldStartVelocity_ + worldAcceleration_ * Scalar(time);
+		}
+
+		/**
+		 * Returns the acceleration an accelerometer would measure at a specific time.
+		 * @param time The time since the start of the trajectory, in seconds
+		 * @param worldGravity The gravity, defined in world
+		 * @return The measured acceleration, defined in the sensor
+		 */
+		Vector3 measuredAcceleration(const double time, const Vector3& worldGravity) const
+		{
+			return world_Q_sensor(time).inverted() * (worldAcceleration_ - worldGravity);
+		}
+
+	public:
+
+		/// The orientation of the sensor at the start of the trajectory.
+		Quaternion world_Q_startSensor_;
+
+		/// The position of the sensor at the start of the trajectory.
+		Vector3 worldStartPosition_;
+
+		/// The velocity of the sensor at the start of the trajectory.
+		Vector3 worldStartVelocity_;
+
+		/// The constant acceleration of the sensor, defined in world.
+		Vector3 worldAcceleration_;
+
+		/// The constant angular velocity, defined in the sensor.
+		Vector3 angularVelocity_;
+};
+
+/**
+ * Adds gyro and accelerometer samples of a trajectory to a preintegrator.
+ * @param randomGenerator The random generator to be used
+ * @param trajectory The trajectory for which the samples will be created
+ * @param baseTimestamp The timestamp of the start of the trajectory
+ * @param duration The duration for which samples will be created, in seconds
+ * @param worldGravity The gravity, defined in world
+ * @param gyroBias The bias which will be added to all gyro samples
+ * @param accelerationBias The bias which will be added to all accelerometer samples
+ * @param preintegrator The preintegrator receiving the samples
+ */
+void addSamples(RandomGenerator& randomGenerator, const SyntheticTrajectory& trajectory, const double baseTimestamp, const double duration, const Vector3& worldGravity, const Vector3& gyroBias, const Vector3& accelerationBias, IMUPreintegrator& preintegrator)
+{
+	const double gyroInterval = 1.0 / RandomD::scalar(randomGenerator, 200.0, 1000.0);
+	const double accelerationInterval = 1.0 / RandomD::scalar(randomGenerator, 100.0, 500.0);
+
+	for (double time = -RandomD::scalar(randomGenerator, 0.0, gyroInterval); time <= duration + gyroInterval; time += gyroInterval)
+	{
+		preintegrator.addGyroSample(Timestamp(baseTimestamp + time), trajectory.angularVelocity_ + gyroBias);
+	}
+
+	for (double time = -RandomD::scalar(randomGenerator, 0.0, accelerationInterval); time <= duration + accelerationInterval; time += accelerationInterval)
+	{
+		preintegrator.addAccelerationSample(Timestamp(baseTimestamp + time), trajectory.measuredAcceleration(time, worldGravity) + accelerationBias);
+	}
+}
+
+}
+
+bool TestIMUPreintegrator::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("IMUPreintegrator test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("preintegration"))
+	{
+		testResult = testPreintegration(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("removesamples"))
+	{
+		testResult = testRemoveSamples(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestIMUPreintegrator, Preintegration)
+{
+	EXPECT_TRUE(TestIMUPreintegrator::testPreintegration(GTEST_TEST_DURATION));
+}
+
+TEST(TestIMUPreintegrator, RemoveSamples)
+{
+	EXPECT_TRUE(TestIMUPreintegrator::testRemoveSamples(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestIMUPreintegrator::testPreintegration(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Preintegration test:";
+
+	constexpr Scalar maximalPositionError = Scalar(0.001); // 1mm
+	constexpr Scalar maximalVelocityError = Scalar(0.005);
+	const Scalar maximalAngleError = Numeric::deg2rad(Scalar(0.01));
+
+	const Vector3 worldGravity(0, Scalar(-9.81), 0);
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const SyntheticTrajectory trajectory(randomGenerator);
+
+		const double baseTimestamp = RandomD::scalar(randomGenerator, 0.0, 1000.0);
+		const double duration = 0.2;
+
+		const bool useBiases = RandomI::boolean(randomGenerator);
+
+		const Vector3 gyroBias = useBiases ? Random::vector3(randomGenerator, Scalar(-0.05), Scalar(0.05)) : Vector3(0, 0, 0);
+		const Vector3 accelerationBias = useBiases ? Random::vector3(randomGenerator, Scalar(-0.5), Scalar(0.5)) : Vector3(0, 0, 0);
+
+		IMUPreintegrator preintegrator;
+
+		const double startTime = RandomD::scalar(randomGenerator, 0.0, 0.1);
+		const double endTime = startTime + RandomD::scalar(randomGenerator, 0.005, 0.1);
+
+		IMUPreintegrator::Preintegration preintegration;
+
+		// without any sample, the preintegration must fail
+
+		OCEAN_EXPECT_FALSE(validation, preintegrator.preintegrate(Timestamp(baseTimestamp + startTime), Timestamp(baseTimestamp + endTime), preintegration));
+		OCEAN_EXPECT_FALSE(validation, preintegration.isValid());
+
+		addSamples(randomGenerator, trajectory, baseTimestamp, duration, worldGravity, gyroBias, accelerationBias, preintegrator);
+
+		preintegrator.setBiases(gyroBias, accelerationBias);
+
+		// outside of the sample range, the preintegration must fail
+
+		OCEAN_EXPECT_FALSE(validation, preintegrator.preintegrate(Timestamp(baseTimestamp + startTime), Timestamp(baseTimestamp + duration + 1.0), preintegration));
+
+		if (!preintegrator.preintegrate(Timestamp(baseTimestamp + startTime), Timestamp(baseTimestamp + endTime), preintegration))
+		{
+			OCEAN_SET_FAILED(validation);
+			continue;
+		}
+
+		OCEAN_EXPECT_TRUE(validation, preintegration.isValid());
+		OCEAN_EXPECT_TRUE(validation, preintegration.hasAcceleration());
+		OCEAN_EXPECT_TRUE(validation, NumericD::isEqual(preintegration.deltaTime_, endTime - startTime, 0.0001));
+
+		const Quaternion expectedStart_Q_end = trajectory.world_Q_sensor(startTime).inverted() * trajectory.world_Q_sensor(endTime);
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, preintegration.start_Q_end_.smallestAngle(expectedStart_Q_end), maximalAngleError);
+
+		Vector3 worldCurrentVelocity;
+		const HomogenousMatrix4 world_T_predictedSensor = IMUPreintegrator::predictPose(trajectory.world_T_sensor(startTime), trajectory.worldVelocity(startTime), worldGravity, preintegration, &worldCurrentVelocity);
+
+		const HomogenousMatrix4 world_T_sensor = trajectory.world_T_sensor(endTime);
+
+		OCEAN_EXPECT_LESS_EQUAL(validation, world_T_predictedSensor.translation().distance(world_T_sensor.translation()), maximalPositionError);
+		OCEAN_EXPECT_LESS_EQUAL(validation, world_T_predictedSensor.rotation().smallestAngle(world_T_sensor.rotation()), maximalAngleError);
+		OCEAN_EXPECT_LESS_EQUAL(validation, worldCurrentVelocity.distance(trajectory.worldVelocity(endTime)), maximalVelocityError);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestIMUPreintegrator::testRemoveSamples(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Remove samples test:";
+
+	const Vector3 worldGravity(0, Scalar(-9.81), 0);
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const SyntheticTrajectory trajectory(randomGenerator);
+
+		const double baseTimestamp = RandomD::scalar(randomGenerator, 0.0, 1000.0);
+		const double duration = 0.2;
+
+		IMUPreintegrator preintegrator;
+		addSamples(randomGenerator, trajectory, baseTimestamp, duration, worldGravity, Vector3(0, 0, 0), Vector3(0, 0, 0), preintegrator);
+
+		const Timestamp previousTimestamp(baseTimestamp + RandomD::scalar(randomGenerator, 0.05, 0.1));
+		const Timestamp currentTimestamp(double(previousTimestamp) + RandomD::scalar(randomGenerator, 0.005, 0.05));
+
+		IMUPreintegrator::Preintegration preintegration;
+		OCEAN_EXPECT_TRUE(validation, preintegrator.preintegrate(previousTimestamp, currentTimestamp, preintegration));
+
+		preintegrator.removeSamples(previousTimestamp);
+
+		// the interval starting at the timestamp must still be covered, while any earlier interval is not covered anymore
+
+		IMUPreintegrator::Preintegration preintegrationAfterRemoval;
+		OCEAN_EXPECT_TRUE(validation, preintegrator.preintegrate(previousTimestamp, currentTimestamp, preintegrationAfterRemoval));
+
+		OCEAN_EXPECT_TRUE(validation, preintegration.start_Q_end_.isEqual(preintegrationAfterRemoval.start_Q_end_, Numeric::weakEps()));
+		OCEAN_EXPECT_TRUE(validation, preintegration.start_deltaVelocity_.isEqual(preintegrationAfterRemoval.start_deltaVelocity_, Numeric::weakEps()));
+		OCEAN_EXPECT_TRUE(validation, preintegration.start_deltaPosition_.isEqual(preintegrationAfterRemoval.start_deltaPosition_, Numeric::weakEps()));
+
+		OCEAN_EXPECT_FALSE(validation, preintegrator.preintegrate(Timestamp(double(previousTimestamp) - 0.02), currentTimestamp, preintegrationAfterRemoval));
+
+		preintegrator.clear();
+
+		OCEAN_EXPECT_FALSE(validation, preintegrator.preintegrate(previousTimestamp, currentTimestamp, preintegrationAfterRemoval));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
+
+}
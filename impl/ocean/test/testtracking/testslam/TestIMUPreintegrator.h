@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_IMU_PREINTEGRATOR_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_IMU_PREINTEGRATOR_H
+
+#include "ocean/test/testtracking/testslam/TestSLAM.h"
+
+#include "ocean/test/TestSelector.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements IMUPreintegrator tests.
+ * @ingroup testtrackingtestslam
+ */
+class OCEAN_TEST_TRACKING_SLAM_EXPORT TestIMUPreintegrator
+{
+	public:
+
+		/**
+		 * Executes all IMUPreintegrator tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the preintegration and the pose prediction for a synthetic trajectory with constant angular velocity and constant acceleration.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testPreintegration(const double testDuration);
+
+		/**
+		 * Tests the removal of samples which are not necessary anymore.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testRemoveSamples(const double testDuration);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_IMU_PREINTEGRATOR_H
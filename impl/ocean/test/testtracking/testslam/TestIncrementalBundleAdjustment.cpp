@@ -0,0 +1,644 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestIncrementalBundleAdjustment.h"
+
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/geometry/NonLinearOptimization.h"
+
+#include "ocean/math/PinholeCamera.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/slam/TrackerMono.h"
+
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+bool TestIncrementalBundleAdjustment::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("IncrementalBundleAdjustment test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("slidingwindow"))
+	{
+		testResult = testSlidingWindow(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("reset"))
+	{
+		testResult = testReset(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("concurrentmapmodification"))
+	{
+		testResult = testConcurrentMapModification(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestIncrementalBundleAdjustment, SlidingWindow)
+{
+	EXPECT_TRUE(TestIncrementalBundleAdjustment::testSlidingWindow(GTEST_TEST_DURATION));
+}
+
+TEST(TestIncrementalBundleAdjustment, Reset)
+{
+	EXPECT_TRUE(TestIncrementalBundleAdjustment::testReset(GTEST_TEST_DURATION));
+}
+
+TEST(TestIncrementalBundleAdjustment, ConcurrentMapModification)
+{
+	EXPECT_TRUE(TestIncrementalBundleAdjustment::testConcurrentMapModification(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestIncrementalBundleAdjustment::testSlidingWindow(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Sliding window test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const AnyCameraPinhole camera(PinholeCamera(640u, 480u, Numeric::deg2rad(60)));
+
+	constexpr unsigned int numberFrames = 12u;
+	constexpr unsigned int windowSize = 5u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HomogenousMatrices4 world_T_cameras;
+		Vectors3 objectPoints;
+		createScene(camera, numberFrames, randomGenerator, world_T_cameras, objectPoints);
+
+		Tracking::SLAM::IncrementalBundleAdjustment bundleAdjustment;
+
+		std::unordered_map<Index32, HomogenousMatrix4> estimatedWorld_T_cameras;
+		std::unordered_map<Index32, Vector3> estimatedObjectPoints;
+
+		size_t reusedObservations = 0;
+		size_t windowsWithPrior = 0;
+
+		for (unsigned int firstFrameIndex = 0u; firstFrameIndex + windowSize <= numberFrames; ++firstFrameIndex)
+		{
+			Scalar initialError = Numeric::maxValue();
+			Scalar finalError = Numeric::maxValue();
+
+			if (!optimizeWindow(camera, world_T_cameras, objectPoints, firstFrameIndex, windowSize, randomGenerator, bundleAdjustment, estimatedWorld_T_cameras, estimatedObjectPoints, initialError, finalError))
+			{
+				OCEAN_SET_FAILED(validation);
+				break;
+			}
+
+			// the image points are noise-free, so that the optimization must converge to an almost perfect result
+
+			OCEAN_EXPECT_LESS_EQUAL(validation, finalError, initialError + Numeric::weakEps());
+			OCEAN_EXPECT_LESS(validation, finalError, Scalar(0.01));
+
+			OCEAN_EXPECT_EQUAL(validation, bundleAdjustment.keyFrameIndices().size(), size_t(windowSize));
+			OCEAN_EXPECT_EQUAL(validation, bundleAdjustment.keyFrameIndices().front(), Index32(firstFrameIndex));
+
+			if (firstFrameIndex == 0u)
+			{
+				// the first window does not have any marginalized keyframe
+
+				OCEAN_EXPECT_FALSE(validation, bundleAdjustment.hasPrior());
+			}
+			else
+			{
+				if (bundleAdjustment.hasPrior())
+				{
+					++windowsWithPrior;
+				}
+
+				reusedObservations += bundleAdjustment.reusedObservations();
+			}
+		}
+
+		// object points leaving the window are marginalized together with the first keyframe
+
+		OCEAN_EXPECT_GREATER(validation, windowsWithPrior, size_t(0));
+
+		// keyframes and object points which have been part of the previous window come with a valid linearization
+
+		OCEAN_EXPECT_GREATER(validation, reusedObservations, size_t(0));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestIncrementalBundleAdjustment::testReset(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Reset test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const AnyCameraPinhole camera(PinholeCamera(640u, 480u, Numeric::deg2rad(60)));
+
+	constexpr unsigned int numberFrames = 8u;
+	constexpr unsigned int windowSize = 4u;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HomogenousMatrices4 world_T_cameras;
+		Vectors3 objectPoints;
+		createScene(camera, numberFrames, randomGenerator, world_T_cameras, objectPoints);
+
+		Tracking::SLAM::IncrementalBundleAdjustment bundleAdjustment;
+
+		// a new object does not have any window
+
+		OCEAN_EXPECT_TRUE(validation, bundleAdjustment.keyFrameIndices().empty());
+		OCEAN_EXPECT_FALSE(validation, bundleAdjustment.hasPrior());
+
+		std::unordered_map<Index32, HomogenousMatrix4> estimatedWorld_T_cameras;
+		std::unordered_map<Index32, Vector3> estimatedObjectPoints;
+
+		Scalar initialError = Numeric::maxValue();
+		Scalar finalError = Numeric::maxValue();
+
+		// we move the window until the first prior exists
+
+		unsigned int lastFirstFrameIndex = 0u;
+
+		for (unsigned int firstFrameIndex = 0u; firstFrameIndex + windowSize <= numberFrames && !bundleAdjustment.hasPrior(); ++firstFrameIndex)
+		{
+			OCEAN_EXPECT_TRUE(validation, optimizeWindow(camera, world_T_cameras, objectPoints, firstFrameIndex, windowSize, randomGenerator, bundleAdjustment, estimatedWorld_T_cameras, estimatedObjectPoints, initialError, finalError));
+
+			lastFirstFrameIndex = firstFrameIndex;
+		}
+
+		bundleAdjustment.reset();
+
+		OCEAN_EXPECT_TRUE(validation, bundleAdjustment.keyFrameIndices().empty());
+		OCEAN_EXPECT_FALSE(validation, bundleAdjustment.hasPrior());
+
+		for (size_t objectPointId = 0; objectPointId < objectPoints.size(); ++objectPointId)
+		{
+			OCEAN_EXPECT_FALSE(validation, bundleAdjustment.isObjectPointMarginalized(Index32(objectPointId)));
+		}
+
+		// after the reset, the window starts from scratch without any prior and without any cached linearization
+
+		OCEAN_EXPECT_TRUE(validation, optimizeWindow(camera, world_T_cameras, objectPoints, lastFirstFrameIndex, windowSize, randomGenerator, bundleAdjustment, estimatedWorld_T_cameras, estimatedObjectPoints, initialError, finalError));
+
+		OCEAN_EXPECT_FALSE(validation, bundleAdjustment.hasPrior());
+		OCEAN_EXPECT_LESS(validation, finalError, Scalar(0.01));
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestIncrementalBundleAdjustment::testConcurrentMapModification(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Concurrent map modification test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const AnyCameraPinhole camera(PinholeCamera(640u, 480u, Numeric::deg2rad(60)));
+
+	constexpr unsigned int numberFrames = 5u;
+	constexpr size_t numberInaccurateObjectPoints = 20;
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		HomogenousMatrices4 world_T_cameras;
+		Vectors3 objectPoints;
+		createScene(camera, numberFrames, randomGenerator, world_T_cameras, objectPoints);
+
+		Tracking::SLAM::CameraPoses cameraPoses;
+
+		for (unsigned int nFrame = 0u; nFrame < numberFrames; ++nFrame)
+		{
+			cameraPoses.nextFrame();
+			cameraPoses.setPose(Index32(nFrame), std::make_shared<Tracking::SLAM::CameraPose>(world_T_cameras[nFrame], Tracking::SLAM::CameraPose::PQ_MEDIUM), 0u);
+		}
+
+		// the map before the Bundle Adjustment starts, all object points visible in at least two frames with slightly disturbed positions
+
+		Tracking::SLAM::LocalizedObjectPointMap localizedObjectPointMap;
+		Tracking::SLAM::TrackerMono::ObjectPointPositionMap initialObjectPointMap;
+
+		Indices32 objectPointIds;
+
+		for (size_t nObjectPoint = 0; nObjectPoint < objectPoints.size(); ++nObjectPoint)
+		{
+			const Index32 objectPointId = Index32(nObjectPoint);
+
+			// the point track covers all consecutive frames in which the object point is visible, starting with the first one
+
+			Index32 firstFrameIndex = Index32(-1);
+			Vectors2 imagePoints;
+
+			for (unsigned int nFrame = 0u; nFrame < numberFrames; ++nFrame)
+			{
+				const HomogenousMatrix4 flippedCamera_T_world = AnyCamera::standard2InvertedFlipped(world_T_cameras[nFrame]);
+
+				if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoints[nObjectPoint]))
+				{
+					const Vector2 imagePoint = camera.projectToImageIF(flippedCamera_T_world, objectPoints[nObjectPoint]);
+
+					if (camera.isInside(imagePoint))
+					{
+						if (firstFrameIndex == Index32(-1))
+						{
+							firstFrameIndex = Index32(nFrame);
+						}
+
+						imagePoints.push_back(imagePoint);
+						continue;
+					}
+				}
+
+				if (firstFrameIndex != Index32(-1))
+				{
+					break;
+				}
+			}
+
+			if (imagePoints.size() < 2)
+			{
+				continue;
+			}
+
+			const Vector3 position = objectPoints[nObjectPoint] + Random::vector3(randomGenerator, Scalar(-0.02), Scalar(0.02));
+
+			Tracking::SLAM::LocalizedObjectPoint localizedObjectPoint(Tracking::SLAM::PointTrack(firstFrameIndex, std::move(imagePoints)), position, Tracking::SLAM::LocalizedObjectPoint::LP_LOW, false /*isBundleAdjusted*/);
+
+			localizedObjectPointMap.emplace(objectPointId, std::move(localizedObjectPoint));
+			initialObjectPointMap.emplace(objectPointId, position);
+
+			objectPointIds.push_back(objectPointId);
+		}
+
+		// object points which the Bundle Adjustment will determine as inaccurate
+
+		Indices32 inaccurateObjectPointIds;
+
+		for (size_t nInaccurate = 0; nInaccurate < numberInaccurateObjectPoints; ++nInaccurate)
+		{
+			const Index32 objectPointId = Index32(objectPoints.size() + nInaccurate);
+
+			const Vector3 position = Random::vector3(randomGenerator, Scalar(-3), Scalar(3), Scalar(-3), Scalar(3), Scalar(-10), Scalar(-4));
+
+			localizedObjectPointMap.emplace(objectPointId, Tracking::SLAM::LocalizedObjectPoint(Tracking::SLAM::PointTrack(0u, Vectors2(2, Random::vector2(randomGenerator, Scalar(0), Scalar(639), Scalar(0), Scalar(479)))), position, Tracking::SLAM::LocalizedObjectPoint::LP_LOW, false /*isBundleAdjusted*/));
+			initialObjectPointMap.emplace(objectPointId, position);
+
+			inaccurateObjectPointIds.push_back(objectPointId);
+		}
+
+		// the Bundle Adjustment runs in the background on a copy of the map
+
+		Tracking::SLAM::IncrementalBundleAdjustment bundleAdjustment;
+
+		std::unordered_map<Index32, HomogenousMatrix4> estimatedWorld_T_cameras;
+		std::unordered_map<Index32, Vector3> estimatedObjectPoints(initialObjectPointMap.cbegin(), initialObjectPointMap.cend());
+
+		RandomGenerator threadRandomGenerator(randomGenerator);
+
+		bool optimized = false;
+		Scalar initialError = Numeric::maxValue();
+		Scalar finalError = Numeric::maxValue();
+
+		std::thread bundleAdjustmentThread([&]()
+		{
+			optimized = optimizeWindow(camera, world_T_cameras, objectPoints, 0u, numberFrames, threadRandomGenerator, bundleAdjustment, estimatedWorld_T_cameras, estimatedObjectPoints, initialError, finalError);
+		});
+
+		// meanwhile, the map is modified: object points are updated, removed, or removed and localized again
+
+		UnorderedIndexSet32 updatedObjectPointIds;
+		UnorderedIndexSet32 removedObjectPointIds;
+		UnorderedIndexSet32 relocalizedObjectPointIds;
+
+		std::unordered_map<Index32, Vector3> modifiedPositions;
+
+		for (const Index32 objectPointId : objectPointIds)
+		{
+			const unsigned int modification = RandomI::random(randomGenerator, 3u);
+
+			if (modification == 1u)
+			{
+				Tracking::SLAM::LocalizedObjectPoint& localizedObjectPoint = localizedObjectPointMap.find(objectPointId)->second;
+
+				const Vector3 updatedPosition = localizedObjectPoint.position() + Random::vector3(randomGenerator, Scalar(0.05), Scalar(0.1));
+
+				localizedObjectPoint.setPosition(updatedPosition, false /*isBundleAdjusted*/);
+
+				modifiedPositions.emplace(objectPointId, updatedPosition);
+				updatedObjectPointIds.emplace(objectPointId);
+			}
+			else if (modification == 2u)
+			{
+				localizedObjectPointMap.erase(objectPointId);
+
+				removedObjectPointIds.emplace(objectPointId);
+			}
+			else if (modification == 3u)
+			{
+				const Vector3 relocalizedPosition = objectPoints[objectPointId] + Random::vector3(randomGenerator, Scalar(0.05), Scalar(0.1));
+
+				localizedObjectPointMap.erase(objectPointId);
+				localizedObjectPointMap.emplace(objectPointId, Tracking::SLAM::LocalizedObjectPoint(Tracking::SLAM::PointTrack(numberFrames - 2u, Vectors2(2, Vector2(320, 240))), relocalizedPosition, Tracking::SLAM::LocalizedObjectPoint::LP_UNKNOWN, false /*isBundleAdjusted*/));
+
+				modifiedPositions.emplace(objectPointId, relocalizedPosition);
+				relocalizedObjectPointIds.emplace(objectPointId);
+			}
+		}
+
+		UnorderedIndexSet32 updatedInaccurateObjectPointIds;
+
+		for (const Index32 inaccurateObjectPointId : inaccurateObjectPointIds)
+		{
+			if (RandomI::boolean(randomGenerator))
+			{
+				Tracking::SLAM::LocalizedObjectPoint& localizedObjectPoint = localizedObjectPointMap.find(inaccurateObjectPointId)->second;
+
+				localizedObjectPoint.setPosition(localizedObjectPoint.position() + Vector3(Scalar(0), Scalar(0), Scalar(-0.5)), false /*isBundleAdjusted*/);
+
+				updatedInaccurateObjectPointIds.emplace(inaccurateObjectPointId);
+			}
+		}
+
+		bundleAdjustmentThread.join();
+
+		OCEAN_EXPECT_TRUE(validation, optimized);
+
+		if (!optimized)
+		{
+			continue;
+		}
+
+		OCEAN_EXPECT_LESS(validation, finalError, Scalar(0.01));
+
+		Vectors3 optimizedObjectPoints;
+		optimizedObjectPoints.reserve(objectPointIds.size());
+
+		for (const Index32 objectPointId : objectPointIds)
+		{
+			optimizedObjectPoints.push_back(estimatedObjectPoints[objectPointId]);
+		}
+
+		UnorderedIndexSet32 bundleAdjustmentObjectPointIdSet(objectPointIds.cbegin(), objectPointIds.cend());
+
+		const size_t modifiedObjectPoints = Tracking::SLAM::TrackerMono::integrateBundleAdjustedObjectPoints(camera, cameraPoses, objectPointIds, optimizedObjectPoints, initialObjectPointMap, inaccurateObjectPointIds, localizedObjectPointMap, bundleAdjustmentObjectPointIdSet);
+
+		OCEAN_EXPECT_EQUAL(validation, modifiedObjectPoints, updatedObjectPointIds.size() + relocalizedObjectPointIds.size() + updatedInaccurateObjectPointIds.size());
+
+		for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds.size(); ++nObjectPoint)
+		{
+			const Index32 objectPointId = objectPointIds[nObjectPoint];
+
+			const Tracking::SLAM::LocalizedObjectPointMap::const_iterator iObjectPoint = localizedObjectPointMap.find(objectPointId);
+
+			if (removedObjectPointIds.contains(objectPointId))
+			{
+				// a removed object point must not be added again
+
+				OCEAN_EXPECT_TRUE(validation, iObjectPoint == localizedObjectPointMap.cend());
+				OCEAN_EXPECT_FALSE(validation, bundleAdjustmentObjectPointIdSet.contains(objectPointId));
+
+				continue;
+			}
+
+			if (iObjectPoint == localizedObjectPointMap.cend())
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			if (updatedObjectPointIds.contains(objectPointId) || relocalizedObjectPointIds.contains(objectPointId))
+			{
+				// a modified object point keeps the newer state and is not part of the Bundle Adjustment anymore
+
+				OCEAN_EXPECT_EQUAL(validation, iObjectPoint->second.position(), modifiedPositions[objectPointId]);
+				OCEAN_EXPECT_FALSE(validation, iObjectPoint->second.isBundleAdjusted());
+				OCEAN_EXPECT_FALSE(validation, bundleAdjustmentObjectPointIdSet.contains(objectPointId));
+			}
+			else
+			{
+				OCEAN_EXPECT_EQUAL(validation, iObjectPoint->second.position(), optimizedObjectPoints[nObjectPoint]);
+				OCEAN_EXPECT_TRUE(validation, iObjectPoint->second.isBundleAdjusted());
+				OCEAN_EXPECT_TRUE(validation, bundleAdjustmentObjectPointIdSet.contains(objectPointId));
+			}
+		}
+
+		for (const Index32 inaccurateObjectPointId : inaccurateObjectPointIds)
+		{
+			// only inaccurate object points which have not been updated in the meantime are removed
+
+			const bool exists = localizedObjectPointMap.find(inaccurateObjectPointId) != localizedObjectPointMap.cend();
+
+			OCEAN_EXPECT_EQUAL(validation, exists, updatedInaccurateObjectPointIds.contains(inaccurateObjectPointId));
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+void TestIncrementalBundleAdjustment::createScene(const AnyCamera& camera, const unsigned int numberFrames, RandomGenerator& randomGenerator, HomogenousMatrices4& world_T_cameras, Vectors3& objectPoints)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(numberFrames >= 2u);
+
+	world_T_cameras.clear();
+	world_T_cameras.reserve(numberFrames);
+
+	for (unsigned int nFrame = 0u; nFrame < numberFrames; ++nFrame)
+	{
+		const Vector3 translation = Vector3(Scalar(nFrame) * Scalar(0.5), Scalar(0), Scalar(0)) + Random::vector3(randomGenerator, Scalar(-0.05), Scalar(0.05));
+
+		world_T_cameras.emplace_back(translation, Random::euler(randomGenerator, Numeric::deg2rad(5)));
+	}
+
+	constexpr size_t numberObjectPoints = 200;
+
+	objectPoints.clear();
+	objectPoints.reserve(numberObjectPoints);
+
+	while (objectPoints.size() < numberObjectPoints)
+	{
+		// the camera is looking towards the negative z-axis
+
+		const Vector3 objectPoint = Random::vector3(randomGenerator, Scalar(-3), Scalar(9), Scalar(-3), Scalar(3), Scalar(-10), Scalar(-4));
+
+		const HomogenousMatrix4 flippedCamera_T_world = AnyCamera::standard2InvertedFlipped(world_T_cameras[RandomI::random(randomGenerator, numberFrames - 1u)]);
+
+		if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint) && camera.isInside(camera.projectToImageIF(flippedCamera_T_world, objectPoint), Scalar(10)))
+		{
+			objectPoints.push_back(objectPoint);
+		}
+	}
+}
+
+bool TestIncrementalBundleAdjustment::optimizeWindow(const AnyCamera& camera, const HomogenousMatrices4& world_T_cameras, const Vectors3& objectPoints, const unsigned int firstFrameIndex, const unsigned int windowSize, RandomGenerator& randomGenerator, Tracking::SLAM::IncrementalBundleAdjustment& bundleAdjustment, std::unordered_map<Index32, HomogenousMatrix4>& estimatedWorld_T_cameras, std::unordered_map<Index32, Vector3>& estimatedObjectPoints, Scalar& initialError, Scalar& finalError)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(windowSize >= 2u);
+	ocean_assert(firstFrameIndex + windowSize <= world_T_cameras.size());
+
+	Indices32 keyFrameIndices;
+	HomogenousMatrices4 flippedCameras_T_world;
+	HomogenousMatrices4 groundTruthFlippedCameras_T_world;
+
+	for (unsigned int frameIndex = firstFrameIndex; frameIndex < firstFrameIndex + windowSize; ++frameIndex)
+	{
+		keyFrameIndices.push_back(Index32(frameIndex));
+		groundTruthFlippedCameras_T_world.push_back(AnyCamera::standard2InvertedFlipped(world_T_cameras[frameIndex]));
+
+		const std::unordered_map<Index32, HomogenousMatrix4>::const_iterator iPose = estimatedWorld_T_cameras.find(Index32(frameIndex));
+
+		if (iPose != estimatedWorld_T_cameras.cend())
+		{
+			flippedCameras_T_world.push_back(AnyCamera::standard2InvertedFlipped(iPose->second));
+		}
+		else
+		{
+			// a new keyframe, with a slightly disturbed pose
+
+			const HomogenousMatrix4 world_T_noisyCamera(world_T_cameras[frameIndex].translation() + Random::vector3(randomGenerator, Scalar(-0.01), Scalar(0.01)), world_T_cameras[frameIndex].rotation() * Quaternion(Random::euler(randomGenerator, Numeric::deg2rad(Scalar(0.5)))));
+
+			flippedCameras_T_world.push_back(AnyCamera::standard2InvertedFlipped(world_T_noisyCamera));
+		}
+	}
+
+	Indices32 objectPointIds;
+	Vectors3 windowObjectPoints;
+	Geometry::NonLinearOptimization::ObjectPointToPoseIndexImagePointCorrespondenceAccessor correspondenceGroups;
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints.size(); ++nObjectPoint)
+	{
+		const Index32 objectPointId = Index32(nObjectPoint);
+
+		if (bundleAdjustment.isObjectPointMarginalized(objectPointId))
+		{
+			continue;
+		}
+
+		const Vector3& objectPoint = objectPoints[nObjectPoint];
+
+		std::vector<std::pair<Index32, Vector2>> poseIndexImagePointPairs;
+
+		for (size_t nPose = 0; nPose < groundTruthFlippedCameras_T_world.size(); ++nPose)
+		{
+			const HomogenousMatrix4& flippedCamera_T_world = groundTruthFlippedCameras_T_world[nPose];
+
+			if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint))
+			{
+				const Vector2 imagePoint = camera.projectToImageIF(flippedCamera_T_world, objectPoint);
+
+				if (camera.isInside(imagePoint))
+				{
+					poseIndexImagePointPairs.emplace_back(Index32(nPose), imagePoint);
+				}
+			}
+		}
+
+		if (poseIndexImagePointPairs.size() < 2)
+		{
+			continue;
+		}
+
+		const std::unordered_map<Index32, Vector3>::const_iterator iObjectPoint = estimatedObjectPoints.find(objectPointId);
+
+		objectPointIds.push_back(objectPointId);
+		windowObjectPoints.push_back(iObjectPoint != estimatedObjectPoints.cend() ? iObjectPoint->second : objectPoint + Random::vector3(randomGenerator, Scalar(-0.02), Scalar(0.02)));
+
+		correspondenceGroups.addObjectPoint(std::move(poseIndexImagePointPairs));
+	}
+
+	HomogenousMatrices4 optimizedFlippedCameras_T_world;
+	Vectors3 optimizedObjectPoints;
+
+	if (!bundleAdjustment.optimize(camera, keyFrameIndices, flippedCameras_T_world, objectPointIds, windowObjectPoints, correspondenceGroups, optimizedFlippedCameras_T_world, optimizedObjectPoints, nullptr, 20u, Scalar(0.001), Scalar(5), &initialError, &finalError))
+	{
+		return false;
+	}
+
+	if (optimizedFlippedCameras_T_world.size() != keyFrameIndices.size() || optimizedObjectPoints.size() != objectPointIds.size())
+	{
+		return false;
+	}
+
+	for (size_t nPose = 0; nPose < keyFrameIndices.size(); ++nPose)
+	{
+		estimatedWorld_T_cameras[keyFrameIndices[nPose]] = AnyCamera::invertedFlipped2Standard(optimizedFlippedCameras_T_world[nPose]);
+	}
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds.size(); ++nObjectPoint)
+	{
+		estimatedObjectPoints[objectPointIds[nObjectPoint]] = optimizedObjectPoints[nObjectPoint];
+	}
+
+	return true;
+}
+
+}
+
+}
+
+}
+
+}
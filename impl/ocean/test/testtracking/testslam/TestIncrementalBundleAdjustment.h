@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_INCREMENTAL_BUNDLE_ADJUSTMENT_H
+#define META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_INCREMENTAL_BUNDLE_ADJUSTMENT_H
+
+#include "ocean/test/testtracking/testslam/TestSLAM.h"
+
+#include "ocean/test/TestSelector.h"
+
+#include "ocean/base/RandomGenerator.h"
+
+#include "ocean/math/AnyCamera.h"
+
+#include "ocean/tracking/slam/IncrementalBundleAdjustment.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+/**
+ * This class implements IncrementalBundleAdjustment tests.
+ * @ingroup testtrackingtestslam
+ */
+class OCEAN_TEST_TRACKING_SLAM_EXPORT TestIncrementalBundleAdjustment
+{
+	public:
+
+		/**
+		 * Executes all IncrementalBundleAdjustment tests.
+		 * @param testDuration Number of seconds for each test
+		 * @param selector The test selector
+		 * @return True, if succeeded
+		 */
+		static bool test(const double testDuration, const TestSelector& selector);
+
+		/**
+		 * Tests the optimization of a sliding window with a camera moving along a straight line, keyframes leaving the window are marginalized.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testSlidingWindow(const double testDuration);
+
+		/**
+		 * Tests the reset function.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testReset(const double testDuration);
+
+		/**
+		 * Tests the integration of a Bundle Adjustment result into a map which has been modified while the optimization was running.
+		 * @param testDuration Number of seconds for each test
+		 * @return True, if succeeded
+		 */
+		static bool testConcurrentMapModification(const double testDuration);
+
+	protected:
+
+		/**
+		 * Creates a synthetic scene with a camera moving along a straight line while observing random 3D object points in front of the camera.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param numberFrames The number of frames to create, with range [2, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param world_T_cameras The resulting ground truth camera poses, one for each frame
+		 * @param objectPoints The resulting ground truth 3D object points
+		 */
+		static void createScene(const AnyCamera& camera, const unsigned int numberFrames, RandomGenerator& randomGenerator, HomogenousMatrices4& world_T_cameras, Vectors3& objectPoints);
+
+		/**
+		 * Optimizes one window of the synthetic scene, poses and object points not yet known are initialized with noisy ground truth data.
+		 * @param camera The camera profile to be used, must be valid
+		 * @param world_T_cameras The ground truth camera poses, one for each frame
+		 * @param objectPoints The ground truth 3D object points
+		 * @param firstFrameIndex The index of the first frame in the window
+		 * @param windowSize The number of frames in the window, with range [2, infinity)
+		 * @param randomGenerator The random generator to be used
+		 * @param bundleAdjustment The incremental Bundle Adjustment to be used
+		 * @param estimatedWorld_T_cameras The estimated camera poses of the previous windows, will be updated
+		 * @param estimatedObjectPoints The estimated 3D object points of the previous windows, will be updated
+		 * @param initialError The resulting average squared projection error before the optimization
+		 * @param finalError The resulting average squared projection error after the optimization
+		 * @return True, if succeeded
+		 */
+		static bool optimizeWindow(const AnyCamera& camera, const HomogenousMatrices4& world_T_cameras, const Vectors3& objectPoints, const unsigned int firstFrameIndex, const unsigned int windowSize, RandomGenerator& randomGenerator, Tracking::SLAM::IncrementalBundleAdjustment& bundleAdjustment, std::unordered_map<Index32, HomogenousMatrix4>& estimatedWorld_T_cameras, std::unordered_map<Index32, Vector3>& estimatedObjectPoints, Scalar& initialError, Scalar& finalError);
+};
+
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TEST_TESTTRACKING_TESTSLAM_TEST_INCREMENTAL_BUNDLE_ADJUSTMENT_H
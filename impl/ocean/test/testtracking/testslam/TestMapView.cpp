@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestMapView.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/Validation.h"
+
+#include "ocean/tracking/slam/MapView.h"
+
+#include <atomic>
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+using namespace Tracking::SLAM;
+
+bool TestMapView::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("MapView test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("mapview"))
+	{
+		testResult = testMapView(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	if (selector.shouldRun("publisher"))
+	{
+		testResult = testPublisher(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestMapView, MapView)
+{
+	EXPECT_TRUE(TestMapView::testMapView(GTEST_TEST_DURATION));
+}
+
+TEST(TestMapView, Publisher)
+{
+	EXPECT_TRUE(TestMapView::testPublisher(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestMapView::testMapView(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "MapView test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		const Index32 mapVersion = RandomI::random(randomGenerator, 1000u);
+		const unsigned int numberObjectPoints = RandomI::random(randomGenerator, 0u, 100u);
+
+		LocalizedObjectPointMap localizedObjectPointMap;
+
+		for (unsigned int n = 0u; n < numberObjectPoints; ++n)
+		{
+			const Index32 firstFrameIndex = RandomI::random(randomGenerator, 100u);
+			const unsigned int numberObservations = RandomI::random(randomGenerator, 2u, 10u);
+
+			Vectors2 imagePoints;
+			for (unsigned int i = 0u; i < numberObservations; ++i)
+			{
+				imagePoints.emplace_back(Random::vector2(randomGenerator, Scalar(0), Scalar(1000)));
+			}
+
+			const PointTrack pointTrack(firstFrameIndex, Vectors2(imagePoints));
+
+			const Vector3 position = Random::vector3(randomGenerator, -10, 10);
+			const LocalizedObjectPoint::LocalizationPrecision precision = LocalizedObjectPoint::LocalizationPrecision(RandomI::random(randomGenerator, uint32_t(LocalizedObjectPoint::LP_LOW), uint32_t(LocalizedObjectPoint::LP_HIGH)));
+			const bool isBundleAdjusted = RandomI::boolean(randomGenerator);
+
+			localizedObjectPointMap.emplace(n * 3u, LocalizedObjectPoint(pointTrack, position, precision, isBundleAdjusted));
+		}
+
+		const MapView mapView(mapVersion, localizedObjectPointMap);
+
+		OCEAN_EXPECT_EQUAL(validation, mapView.mapVersion(), mapVersion);
+		OCEAN_EXPECT_EQUAL(validation, mapView.size(), localizedObjectPointMap.size());
+
+		for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
+		{
+			const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+
+			const MapView::ObjectPoint* objectPoint = mapView.objectPoint(objectPointPair.first);
+
+			if (objectPoint == nullptr)
+			{
+				OCEAN_SET_FAILED(validation);
+				continue;
+			}
+
+			OCEAN_EXPECT_EQUAL(validation, objectPoint->position_, localizedObjectPoint.position());
+			OCEAN_EXPECT_EQUAL(validation, objectPoint->localizationPrecision_, localizedObjectPoint.localizationPrecision());
+			OCEAN_EXPECT_EQUAL(validation, objectPoint->isBundleAdjusted_, localizedObjectPoint.isBundleAdjusted());
+			OCEAN_EXPECT_EQUAL(validation, objectPoint->lastObservationFrameIndex_, localizedObjectPoint.lastObservation().frameIndex());
+			OCEAN_EXPECT_EQUAL(validation, objectPoint->lastImagePoint_, localizedObjectPoint.lastObservation().imagePoint());
+		}
+
+		if (numberObjectPoints != 0u)
+		{
+			// the ids are multiples of three, so that any other id must not exist
+
+			OCEAN_EXPECT_TRUE(validation, mapView.objectPoint(RandomI::random(randomGenerator, numberObjectPoints - 1u) * 3u + 1u) == nullptr);
+		}
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+bool TestMapView::testPublisher(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "MapViewPublisher test:";
+
+	RandomGenerator randomGenerator;
+	Validation validation(randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		MapViewPublisher publisher;
+
+		OCEAN_EXPECT_TRUE(validation, publisher.latest() != nullptr);
+		OCEAN_EXPECT_EQUAL(validation, publisher.latest()->size(), size_t(0));
+
+		constexpr unsigned int numberReaders = 4u;
+		constexpr Index32 numberVersions = 200u;
+
+		std::atomic<bool> stop(false);
+		std::atomic<unsigned int> failures(0u);
+
+		std::vector<std::thread> readers;
+		readers.reserve(numberReaders);
+
+		for (unsigned int n = 0u; n < numberReaders; ++n)
+		{
+			readers.emplace_back([&publisher, &stop, &failures]()
+			{
+				Index32 previousVersion = 0u;
+
+				while (!stop.load())
+				{
+					const SharedMapView mapView = publisher.latest();
+
+					if (mapView == nullptr)
+					{
+						++failures;
+						continue;
+					}
+
+					// each view contains as many points as its version, and versions never decrease for a reader
+
+					if (mapView->mapVersion() < previousVersion || mapView->size() != size_t(mapView->mapVersion()))
+					{
+						++failures;
+					}
+
+					for (const MapView::ObjectPointMap::value_type& objectPointPair : mapView->objectPointMap())
+					{
+						if (objectPointPair.second.position_.x() != Scalar(mapView->mapVersion()))
+						{
+							++failures;
+						}
+					}
+
+					previousVersion = mapView->mapVersion();
+				}
+			});
+		}
+
+		for (Index32 mapVersion = 1u; mapVersion <= numberVersions; ++mapVersion)
+		{
+			LocalizedObjectPointMap localizedObjectPointMap;
+
+			for (Index32 n = 0u; n < mapVersion; ++n)
+			{
+				localizedObjectPointMap.emplace(n, LocalizedObjectPoint(PointTrack(0u, Vectors2(2, Vector2(0, 0))), Vector3(Scalar(mapVersion), 0, 0), LocalizedObjectPoint::LP_MEDIUM, false));
+			}
+
+			publisher.publish(std::make_shared<MapView>(mapVersion, localizedObjectPointMap));
+		}
+
+		stop = true;
+
+		for (std::thread& reader : readers)
+		{
+			reader.join();
+		}
+
+		OCEAN_EXPECT_EQUAL(validation, failures.load(), 0u);
+		OCEAN_EXPECT_EQUAL(validation, publisher.latest()->mapVersion(), numberVersions);
+	}
+	while (!startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
+
+}
@@ -7,7 +7,11 @@
 
 #include "ocean/test/testtracking/testslam/TestSLAM.h"
 #include "ocean/test/testtracking/testslam/TestFramePyramidManager.h"
+#include "ocean/test/testtracking/testslam/TestIncrementalBundleAdjustment.h"
+#include "ocean/test/testtracking/testslam/TestIMUPreintegrator.h"
 #include "ocean/test/testtracking/testslam/TestLocalizedObjectPoint.h"
+#include "ocean/test/testtracking/testslam/TestMapView.h"
+#include "ocean/test/testtracking/testslam/TestTrackerRig.h"
 
 #include "ocean/test/TestResult.h"
 #include "ocean/test/TestSelector.h"
@@ -93,6 +97,42 @@ bool testSLAM(const double testDuration, Worker& /*worker*/, const std::string&
 		testResult = TestFramePyramidManager::test(testDuration, subSelector);
 	}
 
+	if (TestSelector subSelector = selector.shouldRun("incrementalbundleadjustment"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestIncrementalBundleAdjustment::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("mapview"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestMapView::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("trackerrig"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestTrackerRig::test(testDuration, subSelector);
+	}
+
+	if (TestSelector subSelector = selector.shouldRun("imupreintegrator"))
+	{
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		Log::info() << " ";
+		testResult = TestIMUPreintegrator::test(testDuration, subSelector);
+	}
+
 	Log::info() << " ";
 	Log::info() << " ";
 	Log::info() << " ";
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/test/testtracking/testslam/TestTrackerRig.h"
+
+#include "ocean/base/RandomI.h"
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/PinholeCamera.h"
+#include "ocean/math/Random.h"
+
+#include "ocean/test/TestResult.h"
+#include "ocean/test/ValidationPrecision.h"
+
+#include "ocean/tracking/slam/TrackerRig.h"
+
+namespace Ocean
+{
+
+namespace Test
+{
+
+namespace TestTracking
+{
+
+namespace TestSLAM
+{
+
+bool TestTrackerRig::test(const double testDuration, const TestSelector& selector)
+{
+	ocean_assert(testDuration > 0.0);
+
+	TestResult testResult("TrackerRig test");
+
+	Log::info() << " ";
+
+	if (selector.shouldRun("optimizedevicepose"))
+	{
+		testResult = testOptimizeDevicePose(testDuration);
+
+		Log::info() << " ";
+		Log::info() << "-";
+		Log::info() << " ";
+	}
+
+	Log::info() << testResult;
+
+	return testResult.succeeded();
+}
+
+#ifdef OCEAN_USE_GTEST
+
+TEST(TestTrackerRig, OptimizeDevicePose)
+{
+	EXPECT_TRUE(TestTrackerRig::testOptimizeDevicePose(GTEST_TEST_DURATION));
+}
+
+#endif // OCEAN_USE_GTEST
+
+bool TestTrackerRig::testOptimizeDevicePose(const double testDuration)
+{
+	ocean_assert(testDuration > 0.0);
+
+	Log::info() << "Optimize device pose test:";
+
+	RandomGenerator randomGenerator;
+	ValidationPrecision validation(0.95, randomGenerator);
+
+	const Timestamp startTimestamp(true);
+
+	do
+	{
+		ValidationPrecision::ScopedIteration scopedIteration(validation);
+
+		const unsigned int numberCameras = RandomI::random(randomGenerator, 1u, 4u);
+
+		SharedAnyCameras cameras;
+		HomogenousMatrices4 device_T_cameras;
+
+		for (unsigned int cameraIndex = 0u; cameraIndex < numberCameras; ++cameraIndex)
+		{
+			const Scalar fovX = Random::scalar(randomGenerator, Numeric::deg2rad(50), Numeric::deg2rad(90));
+
+			cameras.emplace_back(std::make_shared<AnyCameraPinhole>(PinholeCamera(640u, 480u, fovX)));
+
+			// the cameras look into different directions, with a small baseline between each other
+
+			const Quaternion device_Q_camera = Quaternion(Vector3(0, 1, 0), Scalar(cameraIndex) * Numeric::pi_2()) * Quaternion(Random::euler(randomGenerator, Numeric::deg2rad(10)));
+
+			device_T_cameras.emplace_back(Random::vector3(randomGenerator, Scalar(-0.1), Scalar(0.1)), device_Q_camera);
+		}
+
+		const HomogenousMatrix4 world_T_device(Random::vector3(randomGenerator, -1, 1), Random::quaternion(randomGenerator));
+
+		Indices32 cameraIndices;
+		Vectors3 objectPoints;
+		Vectors2 imagePoints;
+		std::vector<bool> outliers;
+
+		for (unsigned int cameraIndex = 0u; cameraIndex < numberCameras; ++cameraIndex)
+		{
+			const AnyCamera& camera = *cameras[cameraIndex];
+
+			const HomogenousMatrix4 world_T_camera = world_T_device * device_T_cameras[cameraIndex];
+
+			const unsigned int numberPoints = RandomI::random(randomGenerator, 20u, 100u);
+
+			for (unsigned int n = 0u; n < numberPoints; ++n)
+			{
+				const Vector2 imagePoint = Random::vector2(randomGenerator, Scalar(10), Scalar(camera.width() - 10u), Scalar(10), Scalar(camera.height() - 10u));
+				const Scalar depth = Random::scalar(randomGenerator, Scalar(0.5), Scalar(5));
+
+				const Vector3 objectPoint = camera.ray(imagePoint, world_T_camera).point(depth);
+
+				const bool outlier = RandomI::random(randomGenerator, 9u) == 0u;
+
+				cameraIndices.emplace_back(cameraIndex);
+				objectPoints.emplace_back(objectPoint);
+				outliers.emplace_back(outlier);
+
+				if (outlier)
+				{
+					imagePoints.emplace_back(Random::vector2(randomGenerator, Scalar(0), Scalar(camera.width()), Scalar(0), Scalar(camera.height())));
+				}
+				else
+				{
+					imagePoints.emplace_back(imagePoint + Random::vector2(randomGenerator, Scalar(-0.5), Scalar(0.5)));
+				}
+			}
+		}
+
+		const HomogenousMatrix4 world_T_roughDevice = world_T_device * HomogenousMatrix4(Random::vector3(randomGenerator, Scalar(-0.03), Scalar(0.03)), Random::euler(randomGenerator, Numeric::deg2rad(3)));
+
+		constexpr Scalar maximalProjectionError = Scalar(3);
+
+		HomogenousMatrix4 world_T_optimizedDevice(false);
+		Indices32 validIndices;
+
+		if (!Tracking::SLAM::TrackerRig::optimizeDevicePose(cameras, device_T_cameras, world_T_roughDevice, cameraIndices, objectPoints, imagePoints, world_T_optimizedDevice, maximalProjectionError, &validIndices))
+		{
+			scopedIteration.setInaccurate();
+			continue;
+		}
+
+		const Scalar translationError = world_T_device.translation().distance(world_T_optimizedDevice.translation());
+		const Scalar rotationError = world_T_device.rotation().smallestAngle(world_T_optimizedDevice.rotation());
+
+		if (translationError > Scalar(0.01) || rotationError > Numeric::deg2rad(Scalar(0.5)))
+		{
+			scopedIteration.setInaccurate();
+		}
+
+		size_t validInliers = 0;
+		size_t inliers = 0;
+
+		for (const Index32 validIndex : validIndices)
+		{
+			if (!outliers[validIndex])
+			{
+				++validInliers;
+			}
+		}
+
+		for (size_t n = 0; n < outliers.size(); ++n)
+		{
+			if (!outliers[n])
+			{
+				++inliers;
+			}
+		}
+
+		if (validInliers * 100 < inliers * 95)
+		{
+			scopedIteration.setInaccurate();
+		}
+	}
+	while (validation.needMoreIterations() || !startTimestamp.hasTimePassed(testDuration));
+
+	Log::info() << "Validation: " << validation;
+
+	return validation.succeeded();
+}
+
+}
+
+}
+
+}
+
+}
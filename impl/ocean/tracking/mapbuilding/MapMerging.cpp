@@ -73,27 +73,9 @@ size_t MapMerging::closeLoops(Database& database, FreakMultiDescriptorMap256& fr
 	ocean_assert(minimalNumberValidCorrespondences >= 1u);
 	ocean_assert(iterationsWithoutImprovements >= 1u);
 
-	UnorderedIndexSet32 objectPoseObjectPointIdSet;
-	UnorderedIndexSet32 imagePoseObjectPointIdSet;
-
-	Vectors3 objectPoints;
-	Indices32 objectPointsObjectPointIds;
-	std::vector<FreakMultiDescriptors256> objectPointFeatures;
-
-	Vectors2 imagePoints;
-	Indices32 imagePointsObjectPointIds;
-	std::vector<FreakMultiDescriptors256> imagePointFeatures;
-
-	Indices32 matchedObjectPointsObjectPointIds;
-	Indices32 matchedImagePointsObjectPointIds;
-	Vectors3 matchedObjectPoints;
-	Vectors2 matchedImagePoints;
-
-	Indices32 validIndices;
-
 	std::set<IndexPair32> correspondingObjectPointIdPairSet;
 
-	const unsigned int ransacIterations = Geometry::RANSAC::iterations(3u, Scalar(0.99), Scalar(0.85));
+	IndexPairs32 correspondingObjectPointIdPairs;
 
 	unsigned int lowerPoseIndex;
 	unsigned int upperPoseIndex;
@@ -111,256 +93,493 @@ size_t MapMerging::closeLoops(Database& database, FreakMultiDescriptorMap256& fr
 		objectPoseIndex += lowerPoseIndex;
 		imagePoseIndex += lowerPoseIndex;
 
-		const Indices32 objectPoseObjectPointIds = database.objectPointIds<false, false>(objectPoseIndex, Tracking::Database::invalidObjectPoint());
-		const Indices32 imagePoseObjectPointIds = database.objectPointIds<false, false>(imagePoseIndex, Tracking::Database::invalidObjectPoint());
+		if (!verifyLoopCandidate(database, freakMap, pinholeCamera, randomGenerator, objectPoseIndex, imagePoseIndex, minimalNumberValidCorrespondences, maximalNumberOverlappingObjectPointInPosePair, maximalDescriptorDistance, correspondingObjectPointIdPairs))
+		{
+			continue;
+		}
 
-		objectPoseObjectPointIdSet.clear(); // re-using the data structure
-		objectPoseObjectPointIdSet.insert(objectPoseObjectPointIds.cbegin(), objectPoseObjectPointIds.cend());
+		const size_t previousNumberCorrespondingObjectPointIdPairs = correspondingObjectPointIdPairSet.size();
 
-		// we ensure that we have only a minor number of overlapping object points in both poses
+		correspondingObjectPointIdPairSet.insert(correspondingObjectPointIdPairs.cbegin(), correspondingObjectPointIdPairs.cend());
 
-		unsigned int numberOverlappingObjectPoints = 0u;
-		for (const Index32& imagePoseObjectPointId : imagePoseObjectPointIds)
+		if (previousNumberCorrespondingObjectPointIdPairs < correspondingObjectPointIdPairSet.size())
 		{
-			if (objectPoseObjectPointIdSet.find(imagePoseObjectPointId) != objectPoseObjectPointIdSet.cend())
-			{
-				++numberOverlappingObjectPoints;
-			}
-		}
+			Log::info() << "Corresponding points: " << correspondingObjectPointIdPairSet.size() << " (" << iteration << ")";
 
-		if (numberOverlappingObjectPoints > maximalNumberOverlappingObjectPointInPosePair)
-		{
-			continue;
+			// we were able to find new correspondences in this iteration, so with the full amount of additional iterations
+			iteration = 0u;
 		}
+	}
+
+	if (correspondingObjectPointIdPairSet.empty())
+	{
+		return 0;
+	}
+
+	return mergeCorrespondingObjectPoints(database, freakMap, pinholeCamera, randomGenerator, correspondingObjectPointIdPairSet);
+}
+
+size_t MapMerging::closeLoopsWithImageRetrieval(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalCandidatesPerPose, const unsigned int minimalPoseIndexDistance, const unsigned int maximalNumberOverlappingObjectPointInPosePair, const unsigned int maximalDescriptorDistance, Worker* worker, const bool skipBundleAdjustment)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(minimalNumberValidCorrespondences >= 1u);
+	ocean_assert(maximalCandidatesPerPose >= 1u);
 
-		// both poses do not have too many overlapping object points
+	// first, we rank all pose pairs with the image retrieval index
 
-		imagePoseObjectPointIdSet.clear(); // re-using the data structure
-		imagePoseObjectPointIdSet.insert(imagePoseObjectPointIds.cbegin(), imagePoseObjectPointIds.cend());
+	const IndexPairs32 candidates = determineLoopCandidates(database, freakMap, randomGenerator, maximalCandidatesPerPose, minimalPoseIndexDistance, worker);
+
+	if (candidates.empty())
+	{
+		return 0;
+	}
 
-		// we extract all object points which are not overlapping
+	// now, we verify all candidates concurrently, the database and the descriptors are not modified during verification
 
-		objectPoints.clear(); // re-using the data structure
-		objectPointsObjectPointIds.clear();
-		objectPointFeatures.clear();
+	std::vector<IndexPairs32> correspondingObjectPointIdPairGroups(candidates.size());
+	HomogenousMatrices4 world_T_loopCameras(candidates.size(), HomogenousMatrix4(false));
 
-		for (const Index32& objectPoseObjectPointId : objectPoseObjectPointIds)
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&verifyLoopCandidatesSubset, (const Database*)(&database), (const FreakMultiDescriptorMap256*)(&freakMap), &pinholeCamera, &randomGenerator, &candidates, minimalNumberValidCorrespondences, maximalNumberOverlappingObjectPointInPosePair, maximalDescriptorDistance, &correspondingObjectPointIdPairGroups, world_T_loopCameras.data(), 0u, 0u), 0u, (unsigned int)(candidates.size()));
+	}
+	else
+	{
+		verifyLoopCandidatesSubset(&database, &freakMap, &pinholeCamera, &randomGenerator, &candidates, minimalNumberValidCorrespondences, maximalNumberOverlappingObjectPointInPosePair, maximalDescriptorDistance, &correspondingObjectPointIdPairGroups, world_T_loopCameras.data(), 0u, (unsigned int)(candidates.size()));
+	}
+
+	// finally, all accepted loop closures are merged at once
+
+	std::set<IndexPair32> correspondingObjectPointIdPairSet;
+
+	Geometry::PoseGraphOptimization::Edges loopClosureEdges;
+
+	for (size_t nCandidate = 0; nCandidate < candidates.size(); ++nCandidate)
+	{
+		const IndexPairs32& correspondingObjectPointIdPairs = correspondingObjectPointIdPairGroups[nCandidate];
+
+		if (!correspondingObjectPointIdPairs.empty())
 		{
-			if (imagePoseObjectPointIdSet.find(objectPoseObjectPointId) == imagePoseObjectPointIdSet.cend())
-			{
-				const FreakMultiDescriptorMap256::const_iterator iFreak = freakMap.find(objectPoseObjectPointId);
-				ocean_assert(iFreak != freakMap.cend());
+			correspondingObjectPointIdPairSet.insert(correspondingObjectPointIdPairs.cbegin(), correspondingObjectPointIdPairs.cend());
 
-				const FreakMultiDescriptors256& freakFeatures = iFreak->second;
+			// the loop camera is the camera of the second pose, located in relation to the object points of the first pose
 
-				objectPointFeatures.emplace_back(freakFeatures);
-				objectPoints.emplace_back(database.objectPoint<false>(objectPoseObjectPointId));
-				objectPointsObjectPointIds.emplace_back(objectPoseObjectPointId);
-			}
+			const IndexPair32& candidate = candidates[nCandidate];
+			ocean_assert(world_T_loopCameras[nCandidate].isValid());
+
+			const HomogenousMatrix4 objectCamera_T_imageCamera = database.pose<false>(candidate.first).inverted() * world_T_loopCameras[nCandidate];
+
+			loopClosureEdges.emplace_back(candidate.first, candidate.second, objectCamera_T_imageCamera, Scalar(correspondingObjectPointIdPairs.size()));
 		}
+	}
 
-		imagePoints.clear(); // re-using the data structure
-		imagePointsObjectPointIds.clear();
-		imagePointFeatures.clear();
+	Log::info() << "Accepted " << loopClosureEdges.size() << " of " << candidates.size() << " loop candidates with " << correspondingObjectPointIdPairSet.size() << " corresponding points";
 
-		for (const Index32& imagePoseObjectPointId : imagePoseObjectPointIds)
-		{
-			if (objectPoseObjectPointIdSet.find(imagePoseObjectPointId) == objectPoseObjectPointIdSet.cend())
-			{
-				const FreakMultiDescriptorMap256::const_iterator iFreak = freakMap.find(imagePoseObjectPointId);
-				ocean_assert(iFreak != freakMap.cend());
+	if (correspondingObjectPointIdPairSet.empty())
+	{
+		return 0;
+	}
 
-				const FreakMultiDescriptors256& freakFeatures = iFreak->second;
+	if (!skipBundleAdjustment)
+	{
+		// the pose graph optimization distributes the loop closure errors along the trajectories, so that the following bundle adjustment starts close to the optimum
 
-				imagePointFeatures.emplace_back(freakFeatures);
+		Scalar initialError = Numeric::maxValue();
+		Scalar finalError = Numeric::maxValue();
 
-				Vector2 imagePoint;
-				if (database.hasObservation<false>(imagePoseIndex, imagePoseObjectPointId, &imagePoint))
-				{
-					imagePoints.emplace_back(imagePoint);
-					imagePointsObjectPointIds.emplace_back(imagePoseObjectPointId);
-				}
-				else
-				{
-					return 1;
-					ocean_assert(false && "This must never happen!");
-				}
-			}
+		if (optimizePoseGraph(database, loopClosureEdges, 20u, 10u, 20u, worker, &initialError, &finalError))
+		{
+			Log::info() << "Finished pose graph optimization with " << loopClosureEdges.size() << " loop closures, with error " << initialError << " -> " << finalError;
 		}
+	}
+
+	return mergeCorrespondingObjectPoints(database, freakMap, pinholeCamera, randomGenerator, correspondingObjectPointIdPairSet, skipBundleAdjustment);
+}
+
+IndexPairs32 MapMerging::determineLoopCandidates(const Database& database, const FreakMultiDescriptorMap256& freakMap, RandomGenerator& randomGenerator, const unsigned int maximalCandidatesPerPose, const unsigned int minimalPoseIndexDistance, Worker* worker)
+{
+	ocean_assert(maximalCandidatesPerPose >= 1u);
+	ocean_assert(minimalPoseIndexDistance >= 1u);
 
-		// now, we determine 2D/3D correspondences between both pose pairs
+	using BinaryDescriptor256 = UnifiedHelperFreakMultiDescriptor256::BinaryDescriptor256;
+	using BinaryVocabularyTree = UnifiedHelperFreakMultiDescriptor256::BinaryVocabularyTree;
 
-		matchedObjectPointsObjectPointIds.clear(); // re-using the data structure
-		matchedImagePointsObjectPointIds.clear();
-		matchedObjectPoints.clear();
-		matchedImagePoints.clear();
+	unsigned int lowerPoseIndex;
+	unsigned int upperPoseIndex;
+	if (!database.poseBorders<false>(lowerPoseIndex, upperPoseIndex) || upperPoseIndex - lowerPoseIndex < minimalPoseIndexDistance)
+	{
+		return IndexPairs32();
+	}
 
-		for (Index32 nImage = 0u; nImage < imagePoints.size(); ++nImage)
+	const unsigned int poseRange = upperPoseIndex - lowerPoseIndex + 1u;
+
+	// we use one descriptor for each object point to train the vocabulary, each leaf of the tree is one visual word
+
+	UnifiedDescriptor::BinaryDescriptors<256u> treeDescriptors;
+	Indices32 treeObjectPointIds;
+
+	treeDescriptors.reserve(freakMap.size());
+	treeObjectPointIds.reserve(freakMap.size());
+
+	for (FreakMultiDescriptorMap256::const_iterator iFreak = freakMap.cbegin(); iFreak != freakMap.cend(); ++iFreak)
+	{
+		if (iFreak->second.empty() || iFreak->second.front().descriptorLevels() == 0u)
 		{
-			const Vector2& imagePoint = imagePoints[nImage];
-			const FreakMultiDescriptors256& imagePointFeature = imagePointFeatures[nImage];
+			continue;
+		}
 
-			Index32 bestIndex = Index32(-1);
-			unsigned int bestDistance = (unsigned int)(-1);
+		const auto& layerDescriptor = iFreak->second.front().data()[0];
+		static_assert(sizeof(layerDescriptor) == sizeof(BinaryDescriptor256), "Invalid size!");
 
-			for (Index32 nObject = 0u; nObject < objectPoints.size(); ++nObject)
-			{
-				const FreakMultiDescriptors256& objectPointFeature = objectPointFeatures[nObject];
+		BinaryDescriptor256 treeDescriptor;
+		memcpy(&treeDescriptor, &layerDescriptor, sizeof(layerDescriptor));
 
-				unsigned int localBestDistance = (unsigned int)(-1);
+		treeDescriptors.emplace_back(treeDescriptor);
+		treeObjectPointIds.emplace_back(iFreak->first);
+	}
 
-				for (const auto& iF : imagePointFeature)
-				{
-					const unsigned int distance = determineFreakDistance(iF, objectPointFeature);
+	if (treeDescriptors.empty())
+	{
+		return IndexPairs32();
+	}
 
-					if (distance < localBestDistance)
-					{
-						localBestDistance = distance;
-					}
-				}
+	const BinaryVocabularyTree::ClustersMeanFunction clustersMeanFunction = &BinaryVocabularyTree::determineClustersMeanForBinaryDescriptor<sizeof(BinaryDescriptor256) * 8>;
+	const BinaryVocabularyTree vocabularyTree(treeDescriptors.data(), treeDescriptors.size(), clustersMeanFunction, BinaryVocabularyTree::Parameters(), worker, &randomGenerator);
 
-				if (localBestDistance < bestDistance)
-				{
-					bestDistance = localBestDistance;
-					bestIndex = nObject;
-				}
-			}
+	// the first descriptor index within a leaf is a unique identifier of the leaf, we map this identifier to a compact word index
 
-			if (bestDistance <= maximalDescriptorDistance)
-			{
-				const Vector3& objectPoint = objectPoints[bestIndex];
+	std::unordered_map<Index32, Index32> leafWordMap;
+	std::unordered_map<Index32, Index32> objectPointWordMap;
+	objectPointWordMap.reserve(treeObjectPointIds.size());
+
+	for (size_t n = 0; n < treeDescriptors.size(); ++n)
+	{
+		const Indices32& leaf = vocabularyTree.determineBestLeaf(treeDescriptors[n]);
+		ocean_assert(!leaf.empty());
+
+		const Index32 word = leafWordMap.emplace(leaf.front(), Index32(leafWordMap.size())).first->second;
+
+		objectPointWordMap.emplace(treeObjectPointIds[n], word);
+	}
+
+	const size_t numberWords = leafWordMap.size();
+
+	// we determine the term frequency of all visual words for each pose
+
+	std::vector<WordWeightPairs> poseWords(poseRange);
+	Indices32 wordPoseFrequencies(numberWords, 0u);
+
+	std::unordered_map<Index32, unsigned int> wordCounters;
 
-				matchedImagePoints.emplace_back(imagePoint);
-				matchedObjectPoints.emplace_back(objectPoint);
+	for (unsigned int poseIndex = lowerPoseIndex; poseIndex <= upperPoseIndex; ++poseIndex)
+	{
+		const Indices32 objectPointIds = database.objectPointIds<false, false>(poseIndex, Database::invalidObjectPoint());
+
+		wordCounters.clear();
 
-				matchedObjectPointsObjectPointIds.emplace_back(objectPointsObjectPointIds[bestIndex]);
-				matchedImagePointsObjectPointIds.emplace_back(imagePointsObjectPointIds[nImage]);
+		for (const Index32& objectPointId : objectPointIds)
+		{
+			const std::unordered_map<Index32, Index32>::const_iterator iWord = objectPointWordMap.find(objectPointId);
+
+			if (iWord != objectPointWordMap.cend())
+			{
+				++wordCounters[iWord->second];
 			}
 		}
 
-		if (matchedObjectPoints.size() <= minimalNumberValidCorrespondences)
+		WordWeightPairs& words = poseWords[poseIndex - lowerPoseIndex];
+		words.reserve(wordCounters.size());
+
+		for (const std::pair<const Index32, unsigned int>& wordCounter : wordCounters)
 		{
-			continue;
+			words.emplace_back(wordCounter.first, Scalar(wordCounter.second));
+			++wordPoseFrequencies[wordCounter.first];
 		}
+	}
 
-		const size_t previousNumberCorrespondingObjectPointIdPairs = correspondingObjectPointIdPairSet.size();
+	// we apply the inverse document frequency, normalize each histogram, and create the inverted index
+
+	std::vector<PoseWeightPairs> invertedIndex(numberWords);
 
-		HomogenousMatrix4 world_T_camera;
-		validIndices.clear();
-		if (Geometry::RANSAC::p3p(AnyCameraPinhole(pinholeCamera), ConstArrayAccessor<Vector3>(matchedObjectPoints), ConstArrayAccessor<Vector2>(matchedImagePoints), randomGenerator, world_T_camera, minimalNumberValidCorrespondences, true, ransacIterations, Scalar(3 * 3), &validIndices))
+	for (unsigned int poseOffset = 0u; poseOffset < poseRange; ++poseOffset)
+	{
+		WordWeightPairs& words = poseWords[poseOffset];
+
+		Scalar sqrLength = Scalar(0);
+
+		for (WordWeightPair& word : words)
 		{
-			ocean_assert(validIndices.size() >= minimalNumberValidCorrespondences);
+			ocean_assert(wordPoseFrequencies[word.first] >= 1u);
 
-			for (const Index32& validIndex : validIndices)
-			{
-				Index32 objectPointObjectPointId = matchedObjectPointsObjectPointIds[validIndex];
-				Index32 imagePointImagePointId = matchedImagePointsObjectPointIds[validIndex];
+			word.second *= Numeric::log(Scalar(poseRange) / Scalar(wordPoseFrequencies[word.first]));
+			sqrLength += Numeric::sqr(word.second);
+		}
 
-				// sorting the ids to ensure that we do not store the same pair twice
-				Ocean::Utilities::sortLowestToFront2(objectPointObjectPointId, imagePointImagePointId);
+		if (Numeric::isEqualEps(sqrLength))
+		{
+			words.clear();
+			continue;
+		}
 
-				correspondingObjectPointIdPairSet.emplace(objectPointObjectPointId, imagePointImagePointId);
-			}
+		const Scalar normalization = Scalar(1) / Numeric::sqrt(sqrLength);
+
+		for (WordWeightPair& word : words)
+		{
+			word.second *= normalization;
+
+			invertedIndex[word.first].emplace_back(lowerPoseIndex + poseOffset, word.second);
 		}
+	}
 
-		if (previousNumberCorrespondingObjectPointIdPairs < correspondingObjectPointIdPairSet.size())
+	// now, we query the index with each pose
+
+	std::vector<Indices32> poseCandidates(poseRange);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&determineLoopCandidatesSubset, (const std::vector<WordWeightPairs>*)(&poseWords), (const std::vector<PoseWeightPairs>*)(&invertedIndex), Index32(lowerPoseIndex), maximalCandidatesPerPose, minimalPoseIndexDistance, &poseCandidates, 0u, 0u), 0u, poseRange);
+	}
+	else
+	{
+		determineLoopCandidatesSubset(&poseWords, &invertedIndex, Index32(lowerPoseIndex), maximalCandidatesPerPose, minimalPoseIndexDistance, &poseCandidates, 0u, poseRange);
+	}
+
+	std::set<IndexPair32> candidateSet;
+
+	for (unsigned int poseOffset = 0u; poseOffset < poseRange; ++poseOffset)
+	{
+		const Index32 poseIndex = lowerPoseIndex + poseOffset;
+
+		for (const Index32& candidatePoseIndex : poseCandidates[poseOffset])
 		{
-			Log::info() << "Corresponding points: " << correspondingObjectPointIdPairSet.size() << " (" << iteration << ")";
+			candidateSet.emplace(std::min(poseIndex, candidatePoseIndex), std::max(poseIndex, candidatePoseIndex));
+		}
+	}
 
-			// we were able to find new correspondences in this iteration, so with the full amount of additional iterations
-			iteration = 0u;
+	return IndexPairs32(candidateSet.cbegin(), candidateSet.cend());
+}
+
+bool MapMerging::optimizePoseGraph(Database& database, const Geometry::PoseGraphOptimization::Edges& loopClosureEdges, const unsigned int minimalCovisibleObjectPoints, const unsigned int maximalEdgesPerPose, const unsigned int iterations, Worker* worker, Scalar* initialError, Scalar* finalError)
+{
+	ocean_assert(minimalCovisibleObjectPoints >= 1u && maximalEdgesPerPose >= 1u);
+	ocean_assert(iterations >= 1u);
+
+	HomogenousMatrices4 world_T_allPoses;
+	const Indices32 allPoseIds = database.poseIds<false>(&world_T_allPoses);
+
+	// we use all valid poses, sorted by their ids so that the pose with lowest id defines the gauge
+
+	std::vector<std::pair<Index32, HomogenousMatrix4>> idPosePairs;
+	idPosePairs.reserve(allPoseIds.size());
+
+	for (size_t n = 0; n < allPoseIds.size(); ++n)
+	{
+		if (world_T_allPoses[n].isValid())
+		{
+			idPosePairs.emplace_back(allPoseIds[n], world_T_allPoses[n]);
 		}
 	}
 
-	if (correspondingObjectPointIdPairSet.empty())
+	if (idPosePairs.size() < 2)
 	{
-		return 0;
+		return false;
 	}
 
-	// now we have to consolidate all point pairs into sets of points all corresponding to each other
+	std::sort(idPosePairs.begin(), idPosePairs.end(), [](const std::pair<Index32, HomogenousMatrix4>& a, const std::pair<Index32, HomogenousMatrix4>& b) { return a.first < b.first; });
 
-	std::vector<IndexSet32> correspondingFeaturePointIdGroups;
+	Indices32 poseIds;
+	HomogenousMatrices4 world_T_poses;
 
-	for (const IndexPair32& correspondingObjectPointIdPair : correspondingObjectPointIdPairSet)
+	poseIds.reserve(idPosePairs.size());
+	world_T_poses.reserve(idPosePairs.size());
+
+	std::unordered_map<Index32, Index32> poseIdToIndexMap;
+	poseIdToIndexMap.reserve(idPosePairs.size());
+
+	for (const std::pair<Index32, HomogenousMatrix4>& idPosePair : idPosePairs)
 	{
-		IndexSet32 correspondencesSet;
-		correspondencesSet.emplace(correspondingObjectPointIdPair.first);
-		correspondencesSet.emplace(correspondingObjectPointIdPair.second);
+		poseIdToIndexMap.emplace(idPosePair.first, Index32(poseIds.size()));
 
-		correspondingFeaturePointIdGroups.emplace_back(std::move(correspondencesSet));
+		poseIds.emplace_back(idPosePair.first);
+		world_T_poses.emplace_back(idPosePair.second);
 	}
 
-	bool groupHasBeenModified = true;
-	while (groupHasBeenModified)
+	Geometry::PoseGraphOptimization::Edges edges = determineCovisibilityEdges(database, poseIds, minimalCovisibleObjectPoints, maximalEdgesPerPose);
+
+	for (const Geometry::PoseGraphOptimization::Edge& loopClosureEdge : loopClosureEdges)
 	{
-		groupHasBeenModified = false;
+		const std::unordered_map<Index32, Index32>::const_iterator iFirst = poseIdToIndexMap.find(loopClosureEdge.firstPoseIndex_);
+		const std::unordered_map<Index32, Index32>::const_iterator iSecond = poseIdToIndexMap.find(loopClosureEdge.secondPoseIndex_);
 
-		for (size_t nOuter = 0; !groupHasBeenModified && nOuter + 1 < correspondingFeaturePointIdGroups.size(); ++nOuter)
+		if (iFirst == poseIdToIndexMap.cend() || iSecond == poseIdToIndexMap.cend())
 		{
-			for (size_t nInner = nOuter + 1; !groupHasBeenModified && nInner < correspondingFeaturePointIdGroups.size(); ++nInner)
-			{
-				if (Subset::hasIntersectingElement(correspondingFeaturePointIdGroups[nOuter], correspondingFeaturePointIdGroups[nInner]))
-				{
-					correspondingFeaturePointIdGroups[nOuter].insert(correspondingFeaturePointIdGroups[nInner].begin(), correspondingFeaturePointIdGroups[nInner].end());
+			ocean_assert(false && "Invalid loop closure edge!");
+			continue;
+		}
 
-					correspondingFeaturePointIdGroups[nInner] = std::move(correspondingFeaturePointIdGroups.back());
-					correspondingFeaturePointIdGroups.pop_back();
+		edges.emplace_back(iFirst->second, iSecond->second, loopClosureEdge.first_T_second_, loopClosureEdge.weight_);
+	}
 
-					groupHasBeenModified = true;
-				}
+	if (edges.empty())
+	{
+		return false;
+	}
+
+	HomogenousMatrices4 world_T_optimizedPoses;
+	if (!Geometry::PoseGraphOptimization::optimizePoses(world_T_poses, edges, world_T_optimizedPoses, Indices32(1, 0u), iterations, Scalar(0.001), Scalar(5), initialError, finalError, worker))
+	{
+		return false;
+	}
+
+	ocean_assert(world_T_optimizedPoses.size() == world_T_poses.size());
+
+	// each object point is moved with the pose with lowest id in which the object point is visible
+
+	HomogenousMatrices4 optimizedWorld_T_worlds;
+	optimizedWorld_T_worlds.reserve(world_T_poses.size());
+
+	for (size_t n = 0; n < world_T_poses.size(); ++n)
+	{
+		optimizedWorld_T_worlds.emplace_back(world_T_optimizedPoses[n] * world_T_poses[n].inverted());
+	}
+
+	Indices32 observationPoseIds;
+	Indices32 observationImagePointIds;
+
+	for (const Index32& objectPointId : database.objectPointIds<false>())
+	{
+		const Vector3& objectPoint = database.objectPoint<false>(objectPointId);
+
+		if (objectPoint == Database::invalidObjectPoint())
+		{
+			continue;
+		}
+
+		observationPoseIds.clear();
+		observationImagePointIds.clear();
+		database.observationsFromObjectPoint<false>(objectPointId, observationPoseIds, observationImagePointIds);
+
+		Index32 referencePoseIndex = Index32(-1);
+
+		for (const Index32& observationPoseId : observationPoseIds)
+		{
+			const std::unordered_map<Index32, Index32>::const_iterator iPose = poseIdToIndexMap.find(observationPoseId);
+
+			if (iPose != poseIdToIndexMap.cend() && iPose->second < referencePoseIndex)
+			{
+				referencePoseIndex = iPose->second;
 			}
 		}
+
+		if (referencePoseIndex != Index32(-1))
+		{
+			database.setObjectPoint<false>(objectPointId, optimizedWorld_T_worlds[referencePoseIndex] * objectPoint);
+		}
 	}
 
-	ocean_assert(correspondingFeaturePointIdGroups.size() >= 1);
+	database.setPoses<false>(poseIds.data(), world_T_optimizedPoses.data(), poseIds.size());
 
-	for (const IndexSet32& correspondingFeaturePointIdGroup : correspondingFeaturePointIdGroups)
+	return true;
+}
+
+Geometry::PoseGraphOptimization::Edges MapMerging::determineCovisibilityEdges(const Database& database, const Indices32& poseIds, const unsigned int minimalCovisibleObjectPoints, const unsigned int maximalEdgesPerPose)
+{
+	ocean_assert(minimalCovisibleObjectPoints >= 1u && maximalEdgesPerPose >= 1u);
+
+	std::unordered_map<Index32, Index32> poseIdToIndexMap;
+	poseIdToIndexMap.reserve(poseIds.size());
+
+	for (size_t n = 0; n < poseIds.size(); ++n)
 	{
-		const IndexSet32::const_iterator iBegin = correspondingFeaturePointIdGroup.begin();
-		IndexSet32::const_iterator iNext = iBegin;
-		++iNext;
+		poseIdToIndexMap.emplace(poseIds[n], Index32(n));
+	}
 
-		const Index32 firstObjectPointId = *iBegin;
+	// we count the covisible object points for all pairs of poses, with lower pose index first
 
-		ocean_assert(freakMap.find(firstObjectPointId) != freakMap.cend());
-		FreakMultiDescriptors256& firstObjectPointFreakFeatures = freakMap.find(firstObjectPointId)->second;
+	std::unordered_map<uint64_t, unsigned int> covisibilityMap;
 
-		while (iNext != correspondingFeaturePointIdGroup.end())
+	Indices32 observationPoseIds;
+	Indices32 observationImagePointIds;
+	Indices32 observationPoseIndices;
+
+	for (const Index32& objectPointId : database.objectPointIds<false>())
+	{
+		observationPoseIds.clear();
+		observationImagePointIds.clear();
+		database.observationsFromObjectPoint<false>(objectPointId, observationPoseIds, observationImagePointIds);
+
+		observationPoseIndices.clear();
+
+		for (const Index32& observationPoseId : observationPoseIds)
 		{
-			const Index32 nextObjectPointId = *iNext;
+			const std::unordered_map<Index32, Index32>::const_iterator iPose = poseIdToIndexMap.find(observationPoseId);
 
-			ocean_assert(database.hasObjectPoint<false>(firstObjectPointId) && database.hasObjectPoint<false>(nextObjectPointId));
+			if (iPose != poseIdToIndexMap.cend())
+			{
+				observationPoseIndices.emplace_back(iPose->second);
+			}
+		}
 
-			if (database.hasObjectPoint<false>(firstObjectPointId) && database.hasObjectPoint<false>(nextObjectPointId))
+		std::sort(observationPoseIndices.begin(), observationPoseIndices.end());
+
+		for (size_t nOuter = 0; nOuter < observationPoseIndices.size(); ++nOuter)
+		{
+			for (size_t nInner = nOuter + 1; nInner < observationPoseIndices.size(); ++nInner)
 			{
-				Scalar firstObjectPointPriority;
-				Scalar nextObjectPointPriority;
-				const Vector3 newObjectPointLocation = (database.objectPoint<false>(firstObjectPointId, firstObjectPointPriority) + database.objectPoint<false>(nextObjectPointId, nextObjectPointPriority)) * Scalar(0.5);
+				++covisibilityMap[uint64_t(observationPoseIndices[nOuter]) << 32u | uint64_t(observationPoseIndices[nInner])];
+			}
+		}
+	}
 
-				const Scalar newObjectPointPriority = (firstObjectPointPriority + nextObjectPointPriority) * Scalar(0.5);
+	// each pose keeps the edges with most covisible object points, an edge is used if it is kept by at least one of both poses
 
-				database.mergeObjectPoints<false>(firstObjectPointId, nextObjectPointId, newObjectPointLocation, newObjectPointPriority);
+	using CountPair = std::pair<unsigned int, Index32>;
+	std::vector<std::vector<CountPair>> poseNeighbors(poseIds.size());
 
-				FreakMultiDescriptorMap256::iterator iFreakNext = freakMap.find(nextObjectPointId);
-				ocean_assert(iFreakNext != freakMap.cend());
+	for (const std::pair<const uint64_t, unsigned int>& covisibility : covisibilityMap)
+	{
+		if (covisibility.second >= minimalCovisibleObjectPoints)
+		{
+			const Index32 firstPoseIndex = Index32(covisibility.first >> 32u);
+			const Index32 secondPoseIndex = Index32(covisibility.first & 0xFFFFFFFFull);
 
-				const FreakMultiDescriptors256& nextObjectPointFreakFeatures = iFreakNext->second;
+			poseNeighbors[firstPoseIndex].emplace_back(covisibility.second, secondPoseIndex);
+			poseNeighbors[secondPoseIndex].emplace_back(covisibility.second, firstPoseIndex);
+		}
+	}
 
-				firstObjectPointFreakFeatures.insert(firstObjectPointFreakFeatures.cend(), nextObjectPointFreakFeatures.cbegin(), nextObjectPointFreakFeatures.cend()); // **TODO only different freak features
+	std::set<IndexPair32> edgePoseIndexPairs;
 
-				freakMap.erase(iFreakNext);
-			}
+	for (Index32 poseIndex = 0u; poseIndex < Index32(poseNeighbors.size()); ++poseIndex)
+	{
+		std::vector<CountPair>& neighbors = poseNeighbors[poseIndex];
 
-			++iNext;
+		const size_t numberNeighbors = std::min(neighbors.size(), size_t(maximalEdgesPerPose));
+
+		std::partial_sort(neighbors.begin(), neighbors.begin() + numberNeighbors, neighbors.end(), [](const CountPair& a, const CountPair& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+		for (size_t n = 0; n < numberNeighbors; ++n)
+		{
+			edgePoseIndexPairs.emplace(std::min(poseIndex, neighbors[n].second), std::max(poseIndex, neighbors[n].second));
 		}
 	}
 
-	Solver3::removeObjectPointsNotInFrontOfCamera(database);
+	Geometry::PoseGraphOptimization::Edges edges;
+	edges.reserve(edgePoseIndexPairs.size());
 
-	const bool bundleResult = bundleAdjustment(database, pinholeCamera, randomGenerator, 10u);
-	ocean_assert_and_suppress_unused(bundleResult, bundleResult);
+	for (const IndexPair32& edgePoseIndexPair : edgePoseIndexPairs)
+	{
+		const HomogenousMatrix4& world_T_first = database.pose<false>(poseIds[edgePoseIndexPair.first]);
+		const HomogenousMatrix4& world_T_second = database.pose<false>(poseIds[edgePoseIndexPair.second]);
 
-	return correspondingFeaturePointIdGroups.size();
+		ocean_assert(world_T_first.isValid() && world_T_second.isValid());
+
+		const unsigned int covisibleObjectPoints = covisibilityMap[uint64_t(edgePoseIndexPair.first) << 32u | uint64_t(edgePoseIndexPair.second)];
+
+		edges.emplace_back(edgePoseIndexPair.first, edgePoseIndexPair.second, world_T_first.inverted() * world_T_second, Scalar(covisibleObjectPoints));
+	}
+
+	return edges;
 }
 
 size_t MapMerging::mergeObjectPoints(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const Scalar maximalProjectionError, const unsigned int maximalDescriptorDistance, const unsigned int iterationsWithoutImprovements)
@@ -606,37 +825,61 @@ size_t MapMerging::mergeObjectPoints(Database& database, FreakMultiDescriptorMap
 
 	// now we have to consolidate all point pairs into sets of points all corresponding to each other
 
-	std::vector<IndexSet32> correspondingFeaturePointIdGroups;
+	// we determine the connected components of all pairs with a union-find structure, each object point id points to its parent id
+
+	std::unordered_map<Index32, Index32> parentMap;
+	parentMap.reserve(correspondingObjectPointIdPairSet.size() * 2);
+
+	const auto findRoot = [&parentMap](Index32 objectPointId)
+	{
+		Index32 rootId = objectPointId;
+
+		while (parentMap[rootId] != rootId)
+		{
+			rootId = parentMap[rootId];
+		}
+
+		// path compression
+
+		while (parentMap[objectPointId] != rootId)
+		{
+			const Index32 nextId = parentMap[objectPointId];
+			parentMap[objectPointId] = rootId;
+			objectPointId = nextId;
+		}
+
+		return rootId;
+	};
 
 	for (const IndexPair32& correspondingObjectPointIdPair : correspondingObjectPointIdPairSet)
 	{
-		IndexSet32 correspondencesSet;
-		correspondencesSet.emplace(correspondingObjectPointIdPair.first);
-		correspondencesSet.emplace(correspondingObjectPointIdPair.second);
+		parentMap.emplace(correspondingObjectPointIdPair.first, correspondingObjectPointIdPair.first);
+		parentMap.emplace(correspondingObjectPointIdPair.second, correspondingObjectPointIdPair.second);
 
-		correspondingFeaturePointIdGroups.emplace_back(std::move(correspondencesSet));
+		const Index32 firstRootId = findRoot(correspondingObjectPointIdPair.first);
+		const Index32 secondRootId = findRoot(correspondingObjectPointIdPair.second);
+
+		if (firstRootId != secondRootId)
+		{
+			parentMap[std::max(firstRootId, secondRootId)] = std::min(firstRootId, secondRootId);
+		}
 	}
 
-	bool groupHasBeenModified = true;
-	while (groupHasBeenModified)
-	{
-		groupHasBeenModified = false;
+	std::unordered_map<Index32, size_t> rootGroupMap;
+	std::vector<IndexSet32> correspondingFeaturePointIdGroups;
 
-		for (size_t nOuter = 0; !groupHasBeenModified && nOuter + 1 < correspondingFeaturePointIdGroups.size(); ++nOuter)
-		{
-			for (size_t nInner = nOuter + 1; !groupHasBeenModified && nInner < correspondingFeaturePointIdGroups.size(); ++nInner)
-			{
-				if (Subset::hasIntersectingElement(correspondingFeaturePointIdGroups[nOuter], correspondingFeaturePointIdGroups[nInner]))
-				{
-					correspondingFeaturePointIdGroups[nOuter].insert(correspondingFeaturePointIdGroups[nInner].begin(), correspondingFeaturePointIdGroups[nInner].end());
+	for (std::unordered_map<Index32, Index32>::const_iterator iParent = parentMap.cbegin(); iParent != parentMap.cend(); ++iParent)
+	{
+		const Index32 rootId = findRoot(iParent->first);
 
-					correspondingFeaturePointIdGroups[nInner] = std::move(correspondingFeaturePointIdGroups.back());
-					correspondingFeaturePointIdGroups.pop_back();
+		const std::unordered_map<Index32, size_t>::const_iterator iGroup = rootGroupMap.emplace(rootId, correspondingFeaturePointIdGroups.size()).first;
 
-					groupHasBeenModified = true;
-				}
-			}
+		if (iGroup->second == correspondingFeaturePointIdGroups.size())
+		{
+			correspondingFeaturePointIdGroups.emplace_back();
 		}
+
+		correspondingFeaturePointIdGroups[iGroup->second].emplace(iParent->first);
 	}
 
 	ocean_assert(correspondingFeaturePointIdGroups.size() >= 1);
@@ -1198,6 +1441,346 @@ bool MapMerging::mergeMaps(const PinholeCamera& sourceCamera, const Database& so
 	return true;
 }
 
+bool MapMerging::verifyLoopCandidate(const Database& database, const FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const Index32 objectPoseIndex, const Index32 imagePoseIndex, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalNumberOverlappingObjectPointInPosePair, const unsigned int maximalDescriptorDistance, IndexPairs32& correspondingObjectPointIdPairs, HomogenousMatrix4* world_T_loopCamera)
+{
+	ocean_assert(pinholeCamera.isValid());
+
+	correspondingObjectPointIdPairs.clear();
+
+	const Indices32 objectPoseObjectPointIds = database.objectPointIds<false, false>(objectPoseIndex, Tracking::Database::invalidObjectPoint());
+	const Indices32 imagePoseObjectPointIds = database.objectPointIds<false, false>(imagePoseIndex, Tracking::Database::invalidObjectPoint());
+
+	const UnorderedIndexSet32 objectPoseObjectPointIdSet(objectPoseObjectPointIds.cbegin(), objectPoseObjectPointIds.cend());
+
+	// we ensure that we have only a minor number of overlapping object points in both poses
+
+	unsigned int numberOverlappingObjectPoints = 0u;
+	for (const Index32& imagePoseObjectPointId : imagePoseObjectPointIds)
+	{
+		if (objectPoseObjectPointIdSet.find(imagePoseObjectPointId) != objectPoseObjectPointIdSet.cend())
+		{
+			++numberOverlappingObjectPoints;
+		}
+	}
+
+	if (numberOverlappingObjectPoints > maximalNumberOverlappingObjectPointInPosePair)
+	{
+		return false;
+	}
+
+	// both poses do not have too many overlapping object points
+
+	const UnorderedIndexSet32 imagePoseObjectPointIdSet(imagePoseObjectPointIds.cbegin(), imagePoseObjectPointIds.cend());
+
+	// we extract all object points which are not overlapping
+
+	Vectors3 objectPoints;
+	Indices32 objectPointsObjectPointIds;
+	std::vector<const FreakMultiDescriptors256*> objectPointFeatures;
+
+	for (const Index32& objectPoseObjectPointId : objectPoseObjectPointIds)
+	{
+		if (imagePoseObjectPointIdSet.find(objectPoseObjectPointId) == imagePoseObjectPointIdSet.cend())
+		{
+			const FreakMultiDescriptorMap256::const_iterator iFreak = freakMap.find(objectPoseObjectPointId);
+			ocean_assert(iFreak != freakMap.cend());
+
+			if (iFreak != freakMap.cend())
+			{
+				objectPointFeatures.emplace_back(&iFreak->second);
+				objectPoints.emplace_back(database.objectPoint<false>(objectPoseObjectPointId));
+				objectPointsObjectPointIds.emplace_back(objectPoseObjectPointId);
+			}
+		}
+	}
+
+	Vectors2 imagePoints;
+	Indices32 imagePointsObjectPointIds;
+	std::vector<const FreakMultiDescriptors256*> imagePointFeatures;
+
+	for (const Index32& imagePoseObjectPointId : imagePoseObjectPointIds)
+	{
+		if (objectPoseObjectPointIdSet.find(imagePoseObjectPointId) == objectPoseObjectPointIdSet.cend())
+		{
+			const FreakMultiDescriptorMap256::const_iterator iFreak = freakMap.find(imagePoseObjectPointId);
+			ocean_assert(iFreak != freakMap.cend());
+
+			Vector2 imagePoint;
+			if (iFreak != freakMap.cend() && database.hasObservation<false>(imagePoseIndex, imagePoseObjectPointId, &imagePoint))
+			{
+				imagePointFeatures.emplace_back(&iFreak->second);
+				imagePoints.emplace_back(imagePoint);
+				imagePointsObjectPointIds.emplace_back(imagePoseObjectPointId);
+			}
+			else
+			{
+				ocean_assert(false && "This must never happen!");
+				return false;
+			}
+		}
+	}
+
+	// now, we determine 2D/3D correspondences between both pose pairs
+
+	Indices32 matchedObjectPointsObjectPointIds;
+	Indices32 matchedImagePointsObjectPointIds;
+	Vectors3 matchedObjectPoints;
+	Vectors2 matchedImagePoints;
+
+	for (Index32 nImage = 0u; nImage < imagePoints.size(); ++nImage)
+	{
+		const Vector2& imagePoint = imagePoints[nImage];
+		const FreakMultiDescriptors256& imagePointFeature = *imagePointFeatures[nImage];
+
+		Index32 bestIndex = Index32(-1);
+		unsigned int bestDistance = (unsigned int)(-1);
+
+		for (Index32 nObject = 0u; nObject < objectPoints.size(); ++nObject)
+		{
+			const FreakMultiDescriptors256& objectPointFeature = *objectPointFeatures[nObject];
+
+			unsigned int localBestDistance = (unsigned int)(-1);
+
+			for (const auto& iF : imagePointFeature)
+			{
+				const unsigned int distance = determineFreakDistance(iF, objectPointFeature);
+
+				if (distance < localBestDistance)
+				{
+					localBestDistance = distance;
+				}
+			}
+
+			if (localBestDistance < bestDistance)
+			{
+				bestDistance = localBestDistance;
+				bestIndex = nObject;
+			}
+		}
+
+		if (bestDistance <= maximalDescriptorDistance)
+		{
+			const Vector3& objectPoint = objectPoints[bestIndex];
+
+			matchedImagePoints.emplace_back(imagePoint);
+			matchedObjectPoints.emplace_back(objectPoint);
+
+			matchedObjectPointsObjectPointIds.emplace_back(objectPointsObjectPointIds[bestIndex]);
+			matchedImagePointsObjectPointIds.emplace_back(imagePointsObjectPointIds[nImage]);
+		}
+	}
+
+	if (matchedObjectPoints.size() <= minimalNumberValidCorrespondences)
+	{
+		return false;
+	}
+
+	const unsigned int ransacIterations = Geometry::RANSAC::iterations(3u, Scalar(0.99), Scalar(0.85));
+
+	HomogenousMatrix4 world_T_camera;
+	Indices32 validIndices;
+	if (!Geometry::RANSAC::p3p(AnyCameraPinhole(pinholeCamera), ConstArrayAccessor<Vector3>(matchedObjectPoints), ConstArrayAccessor<Vector2>(matchedImagePoints), randomGenerator, world_T_camera, minimalNumberValidCorrespondences, true, ransacIterations, Scalar(3 * 3), &validIndices))
+	{
+		return false;
+	}
+
+	ocean_assert(validIndices.size() >= minimalNumberValidCorrespondences);
+
+	if (world_T_loopCamera != nullptr)
+	{
+		*world_T_loopCamera = world_T_camera;
+	}
+
+	correspondingObjectPointIdPairs.reserve(validIndices.size());
+
+	for (const Index32& validIndex : validIndices)
+	{
+		Index32 objectPointObjectPointId = matchedObjectPointsObjectPointIds[validIndex];
+		Index32 imagePointImagePointId = matchedImagePointsObjectPointIds[validIndex];
+
+		// sorting the ids to ensure that we do not store the same pair twice
+		Ocean::Utilities::sortLowestToFront2(objectPointObjectPointId, imagePointImagePointId);
+
+		correspondingObjectPointIdPairs.emplace_back(objectPointObjectPointId, imagePointImagePointId);
+	}
+
+	return true;
+}
+
+size_t MapMerging::mergeCorrespondingObjectPoints(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const std::set<IndexPair32>& correspondingObjectPointIdPairSet, const bool skipBundleAdjustment)
+{
+	ocean_assert(!correspondingObjectPointIdPairSet.empty());
+
+	// now we have to consolidate all point pairs into sets of points all corresponding to each other
+
+	std::vector<IndexSet32> correspondingFeaturePointIdGroups;
+
+	for (const IndexPair32& correspondingObjectPointIdPair : correspondingObjectPointIdPairSet)
+	{
+		IndexSet32 correspondencesSet;
+		correspondencesSet.emplace(correspondingObjectPointIdPair.first);
+		correspondencesSet.emplace(correspondingObjectPointIdPair.second);
+
+		correspondingFeaturePointIdGroups.emplace_back(std::move(correspondencesSet));
+	}
+
+	bool groupHasBeenModified = true;
+	while (groupHasBeenModified)
+	{
+		groupHasBeenModified = false;
+
+		for (size_t nOuter = 0; !groupHasBeenModified && nOuter + 1 < correspondingFeaturePointIdGroups.size(); ++nOuter)
+		{
+			for (size_t nInner = nOuter + 1; !groupHasBeenModified && nInner < correspondingFeaturePointIdGroups.size(); ++nInner)
+			{
+				if (Subset::hasIntersectingElement(correspondingFeaturePointIdGroups[nOuter], correspondingFeaturePointIdGroups[nInner]))
+				{
+					correspondingFeaturePointIdGroups[nOuter].insert(correspondingFeaturePointIdGroups[nInner].begin(), correspondingFeaturePointIdGroups[nInner].end());
+
+					correspondingFeaturePointIdGroups[nInner] = std::move(correspondingFeaturePointIdGroups.back());
+					correspondingFeaturePointIdGroups.pop_back();
+
+					groupHasBeenModified = true;
+				}
+			}
+		}
+	}
+
+	ocean_assert(correspondingFeaturePointIdGroups.size() >= 1);
+
+	for (const IndexSet32& correspondingFeaturePointIdGroup : correspondingFeaturePointIdGroups)
+	{
+		const IndexSet32::const_iterator iBegin = correspondingFeaturePointIdGroup.begin();
+		IndexSet32::const_iterator iNext = iBegin;
+		++iNext;
+
+		const Index32 firstObjectPointId = *iBegin;
+
+		ocean_assert(freakMap.find(firstObjectPointId) != freakMap.cend());
+		FreakMultiDescriptors256& firstObjectPointFreakFeatures = freakMap.find(firstObjectPointId)->second;
+
+		while (iNext != correspondingFeaturePointIdGroup.end())
+		{
+			const Index32 nextObjectPointId = *iNext;
+
+			ocean_assert(database.hasObjectPoint<false>(firstObjectPointId) && database.hasObjectPoint<false>(nextObjectPointId));
+
+			if (database.hasObjectPoint<false>(firstObjectPointId) && database.hasObjectPoint<false>(nextObjectPointId))
+			{
+				Scalar firstObjectPointPriority;
+				Scalar nextObjectPointPriority;
+				const Vector3 newObjectPointLocation = (database.objectPoint<false>(firstObjectPointId, firstObjectPointPriority) + database.objectPoint<false>(nextObjectPointId, nextObjectPointPriority)) * Scalar(0.5);
+
+				const Scalar newObjectPointPriority = (firstObjectPointPriority + nextObjectPointPriority) * Scalar(0.5);
+
+				database.mergeObjectPoints<false>(firstObjectPointId, nextObjectPointId, newObjectPointLocation, newObjectPointPriority);
+
+				FreakMultiDescriptorMap256::iterator iFreakNext = freakMap.find(nextObjectPointId);
+				ocean_assert(iFreakNext != freakMap.cend());
+
+				const FreakMultiDescriptors256& nextObjectPointFreakFeatures = iFreakNext->second;
+
+				firstObjectPointFreakFeatures.insert(firstObjectPointFreakFeatures.cend(), nextObjectPointFreakFeatures.cbegin(), nextObjectPointFreakFeatures.cend()); // **TODO only different freak features
+
+				freakMap.erase(iFreakNext);
+			}
+
+			++iNext;
+		}
+	}
+
+	Solver3::removeObjectPointsNotInFrontOfCamera(database);
+
+	if (!skipBundleAdjustment)
+	{
+		const bool bundleResult = bundleAdjustment(database, pinholeCamera, randomGenerator, 10u);
+		ocean_assert_and_suppress_unused(bundleResult, bundleResult);
+	}
+
+	return correspondingFeaturePointIdGroups.size();
+}
+
+void MapMerging::determineLoopCandidatesSubset(const std::vector<WordWeightPairs>* poseWords, const std::vector<PoseWeightPairs>* invertedIndex, const Index32 lowerPoseIndex, const unsigned int maximalCandidatesPerPose, const unsigned int minimalPoseIndexDistance, std::vector<Indices32>* candidates, const unsigned int firstPose, const unsigned int numberPoses)
+{
+	ocean_assert(poseWords != nullptr && invertedIndex != nullptr && candidates != nullptr);
+	ocean_assert(poseWords->size() == candidates->size());
+	ocean_assert(firstPose + numberPoses <= poseWords->size());
+
+	Scalars scores(poseWords->size(), Scalar(0));
+	Indices32 touchedPoseOffsets;
+
+	using ScorePair = std::pair<Scalar, Index32>;
+	std::vector<ScorePair> scorePairs;
+
+	for (unsigned int poseOffset = firstPose; poseOffset < firstPose + numberPoses; ++poseOffset)
+	{
+		touchedPoseOffsets.clear();
+
+		for (const WordWeightPair& word : (*poseWords)[poseOffset])
+		{
+			for (const PoseWeightPair& candidatePose : (*invertedIndex)[word.first])
+			{
+				const unsigned int candidatePoseOffset = candidatePose.first - lowerPoseIndex;
+
+				// neighboring poses share most of their object points anyway, so that they cannot close a loop
+
+				if (NumericT<int>::abs(int(candidatePoseOffset) - int(poseOffset)) < int(minimalPoseIndexDistance))
+				{
+					continue;
+				}
+
+				if (scores[candidatePoseOffset] == Scalar(0))
+				{
+					touchedPoseOffsets.emplace_back(candidatePoseOffset);
+				}
+
+				scores[candidatePoseOffset] += word.second * candidatePose.second;
+			}
+		}
+
+		scorePairs.clear();
+		scorePairs.reserve(touchedPoseOffsets.size());
+
+		for (const Index32& touchedPoseOffset : touchedPoseOffsets)
+		{
+			scorePairs.emplace_back(scores[touchedPoseOffset], touchedPoseOffset);
+			scores[touchedPoseOffset] = Scalar(0);
+		}
+
+		const size_t numberCandidates = std::min(scorePairs.size(), size_t(maximalCandidatesPerPose));
+
+		std::partial_sort(scorePairs.begin(), scorePairs.begin() + numberCandidates, scorePairs.end(), [](const ScorePair& a, const ScorePair& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+		Indices32& poseCandidates = (*candidates)[poseOffset];
+		poseCandidates.clear();
+
+		for (size_t n = 0; n < numberCandidates; ++n)
+		{
+			poseCandidates.emplace_back(lowerPoseIndex + scorePairs[n].second);
+		}
+	}
+}
+
+void MapMerging::verifyLoopCandidatesSubset(const Database* database, const FreakMultiDescriptorMap256* freakMap, const PinholeCamera* pinholeCamera, RandomGenerator* randomGenerator, const IndexPairs32* candidates, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalNumberOverlappingObjectPointInPosePair, const unsigned int maximalDescriptorDistance, std::vector<IndexPairs32>* correspondingObjectPointIdPairGroups, HomogenousMatrix4* world_T_loopCameras, const unsigned int firstCandidate, const unsigned int numberCandidates)
+{
+	ocean_assert(database != nullptr && freakMap != nullptr && pinholeCamera != nullptr && randomGenerator != nullptr);
+	ocean_assert(candidates != nullptr && correspondingObjectPointIdPairGroups != nullptr && world_T_loopCameras != nullptr);
+	ocean_assert(candidates->size() == correspondingObjectPointIdPairGroups->size());
+	ocean_assert(firstCandidate + numberCandidates <= candidates->size());
+
+	RandomGenerator localRandomGenerator(*randomGenerator);
+
+	for (unsigned int nCandidate = firstCandidate; nCandidate < firstCandidate + numberCandidates; ++nCandidate)
+	{
+		const IndexPair32& candidate = (*candidates)[nCandidate];
+
+		if (!verifyLoopCandidate(*database, *freakMap, *pinholeCamera, localRandomGenerator, candidate.first, candidate.second, minimalNumberValidCorrespondences, maximalNumberOverlappingObjectPointInPosePair, maximalDescriptorDistance, (*correspondingObjectPointIdPairGroups)[nCandidate], world_T_loopCameras + nCandidate))
+		{
+			(*correspondingObjectPointIdPairGroups)[nCandidate].clear();
+		}
+	}
+}
+
 }
 
 }
@@ -15,6 +15,8 @@
 #include "ocean/base/RandomGenerator.h"
 #include "ocean/base/Worker.h"
 
+#include "ocean/geometry/PoseGraphOptimization.h"
+
 #include "ocean/math/PinholeCamera.h"
 
 #include "ocean/tracking/Database.h"
@@ -60,6 +62,68 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT MapMerging : public DescriptorHandling
 		 */
 		static size_t closeLoops(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalNumberOverlappingObjectPointInPosePair = 50u, const unsigned int maximalDescriptorDistance = 64u, const unsigned int iterationsWithoutImprovements = 100u);
 
+		/**
+		 * Closes the loop(s) in a database based on an image retrieval index and merges all corresponding 3D object points.
+		 * In contrast to closeLoops(), candidate pose pairs are not selected randomly but ranked via a bag-of-words index (see determineLoopCandidates()).<br>
+		 * All candidates are verified in parallel, all accepted loop closures are merged at once and optimized in one final bundle adjustment.
+		 * @param database The database in which the loops will be closed
+		 * @param freakMap The map mapping object points to descriptors
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @param minimalNumberValidCorrespondences The minimal number of valid correspondences between 3D object points and (not associated) 2D image points so that the correspondences are considered to be valid and thus a closed loop, with range [3, infinity)
+		 * @param maximalCandidatesPerPose The maximal number of loop candidates which will be verified for each pose, with range [1, infinity)
+		 * @param minimalPoseIndexDistance The minimal distance between the indices of two poses so that both poses can be a loop candidate, with range [1, infinity)
+		 * @param maximalNumberOverlappingObjectPointInPosePair The maximal number of 3D object points which can be visible in both frames so that both frames are still considered for loop closing, with range [0, infinity)
+		 * @param maximalDescriptorDistance The maximal descriptor distance so that two descriptors are still considered to match, with range [0, infinity)
+		 * @param worker Optional worker to distribute the computation
+		 * @param skipBundleAdjustment True, to skip the final bundle adjustment; False, to distribute the loop closure errors with a pose graph optimization and to optimize the database after merging the object points
+		 * @return The number of merged object point groups
+		 */
+		static size_t closeLoopsWithImageRetrieval(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalCandidatesPerPose = 5u, const unsigned int minimalPoseIndexDistance = 30u, const unsigned int maximalNumberOverlappingObjectPointInPosePair = 50u, const unsigned int maximalDescriptorDistance = 64u, Worker* worker = nullptr, const bool skipBundleAdjustment = false);
+
+		/**
+		 * Determines candidate pose pairs for loop closures based on a bag-of-words image retrieval index.
+		 * A vocabulary tree is trained with one descriptor of each object point, each leaf of the tree defines one visual word.<br>
+		 * Each pose is described by the tf-idf weighted histogram of the visual words of all visible object points, the most similar poses are determined via an inverted index.
+		 * @param database The database holding the poses and object points
+		 * @param freakMap The map mapping object points to descriptors
+		 * @param randomGenerator The random generator to be used
+		 * @param maximalCandidatesPerPose The maximal number of candidates for each pose, with range [1, infinity)
+		 * @param minimalPoseIndexDistance The minimal distance between the indices of two poses so that both poses can be a loop candidate, with range [1, infinity)
+		 * @param worker Optional worker to distribute the computation
+		 * @return The resulting unique candidate pairs of pose indices, with the lower pose index first
+		 */
+		static IndexPairs32 determineLoopCandidates(const Database& database, const FreakMultiDescriptorMap256& freakMap, RandomGenerator& randomGenerator, const unsigned int maximalCandidatesPerPose, const unsigned int minimalPoseIndexDistance, Worker* worker = nullptr);
+
+		/**
+		 * Optimizes all poses of a database with a pose graph optimization and moves all object points accordingly.
+		 * The pose graph is composed of co-visibility edges between poses sharing object points (with the current relative transformations of the database) and of given loop closure edges.<br>
+		 * Each object point is moved rigidly with the pose with lowest id in which the object point is visible.<br>
+		 * The pose with lowest id defines the gauge and is not modified.<br>
+		 * The optimization is a cheap first pass to distribute the error of loop closures before a bundle adjustment.
+		 * @param database The database in which the poses and object points will be optimized
+		 * @param loopClosureEdges The loop closure edges, the pose indices of the edges are the ids of the poses in the database
+		 * @param minimalCovisibleObjectPoints The minimal number of object points two poses must have in common to be connected by an edge, with range [1, infinity)
+		 * @param maximalEdgesPerPose The maximal number of co-visibility edges for each pose, the edges with most covisible object points are used, with range [1, infinity)
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param worker Optional worker to distribute the computation
+		 * @param initialError Optional resulting averaged weighted squared error of the pose graph before the optimization
+		 * @param finalError Optional resulting averaged weighted squared error of the pose graph after the optimization
+		 * @return True, if succeeded
+		 */
+		static bool optimizePoseGraph(Database& database, const Geometry::PoseGraphOptimization::Edges& loopClosureEdges, const unsigned int minimalCovisibleObjectPoints = 20u, const unsigned int maximalEdgesPerPose = 10u, const unsigned int iterations = 20u, Worker* worker = nullptr, Scalar* initialError = nullptr, Scalar* finalError = nullptr);
+
+		/**
+		 * Determines the co-visibility edges between poses of a database.
+		 * Two poses are connected if they have a minimal number of object points in common, the relative transformation of the edge is determined from the current poses, the weight of the edge is the number of covisible object points.
+		 * @param database The database holding the poses and object points
+		 * @param poseIds The ids of the poses to be connected, the resulting edges will use the indices of this vector
+		 * @param minimalCovisibleObjectPoints The minimal number of object points two poses must have in common to be connected by an edge, with range [1, infinity)
+		 * @param maximalEdgesPerPose The maximal number of edges for each pose, the edges with most covisible object points are used, with range [1, infinity)
+		 * @return The resulting edges
+		 */
+		static Geometry::PoseGraphOptimization::Edges determineCovisibilityEdges(const Database& database, const Indices32& poseIds, const unsigned int minimalCovisibleObjectPoints, const unsigned int maximalEdgesPerPose);
+
 		/**
 		 * Merges individual 3D object points in a database.
 		 * Object points with are not visible in the same frame (not known to be visible) will be merged if the projection error of both object points are below a threshold.
@@ -90,6 +154,90 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT MapMerging : public DescriptorHandling
 		 * @return True, if succeeded
 		 */
 		static bool mergeMaps(const PinholeCamera& sourceCamera, const Database& sourceDatabase, const UnifiedDescriptorMap& sourceDescriptorMap, const PinholeCamera& targetCamera, Database& targetDatabase, UnifiedDescriptorMap& targetDescriptorMap, RandomGenerator& randomGenerator, const unsigned int minimalNumberCorrespondingFeaturesPerPose = 50u, const unsigned int minimalNumberCorrespondingPoses = 20u, const unsigned int iterationsWithoutImprovements = 100u, const unsigned int maximalNumberImprovements = (unsigned int)(-1));
+
+	protected:
+
+		/**
+		 * Definition of a pair combining a pose index with a weight.
+		 */
+		using PoseWeightPair = std::pair<Index32, Scalar>;
+
+		/**
+		 * Definition of a vector holding pose weight pairs.
+		 */
+		using PoseWeightPairs = std::vector<PoseWeightPair>;
+
+		/**
+		 * Definition of a pair combining a visual word with a weight.
+		 */
+		using WordWeightPair = std::pair<Index32, Scalar>;
+
+		/**
+		 * Definition of a vector holding word weight pairs.
+		 */
+		using WordWeightPairs = std::vector<WordWeightPair>;
+
+	protected:
+
+		/**
+		 * Verifies whether a loop can be closed between two poses.
+		 * The object points visible in the first pose are matched against the image points visible in the second pose, the matches are verified with RANSAC.
+		 * @param database The database holding the poses and object points
+		 * @param freakMap The map mapping object points to descriptors
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @param objectPoseIndex The index of the pose providing the 3D object points
+		 * @param imagePoseIndex The index of the pose providing the 2D image points
+		 * @param minimalNumberValidCorrespondences The minimal number of valid correspondences, with range [3, infinity)
+		 * @param maximalNumberOverlappingObjectPointInPosePair The maximal number of 3D object points which can be visible in both frames, with range [0, infinity)
+		 * @param maximalDescriptorDistance The maximal descriptor distance so that two descriptors are still considered to match, with range [0, infinity)
+		 * @param correspondingObjectPointIdPairs The resulting pairs of ids of object points which correspond to each other, with lower id first
+		 * @param world_T_loopCamera Optional resulting camera pose of the second pose, determined with the 3D object points of the first pose, nullptr if not of interest
+		 * @return True, if the loop could be verified
+		 */
+		static bool verifyLoopCandidate(const Database& database, const FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const Index32 objectPoseIndex, const Index32 imagePoseIndex, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalNumberOverlappingObjectPointInPosePair, const unsigned int maximalDescriptorDistance, IndexPairs32& correspondingObjectPointIdPairs, HomogenousMatrix4* world_T_loopCamera = nullptr);
+
+		/**
+		 * Merges groups of corresponding object points in a database and optimizes the resulting database.
+		 * @param database The database in which the object points will be merged
+		 * @param freakMap The map mapping object points to descriptors, will be updated accordingly
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param randomGenerator The random generator to be used
+		 * @param correspondingObjectPointIdPairSet The pairs of ids of corresponding object points, with lower id first, must not be empty
+		 * @param skipBundleAdjustment True, to skip the final bundle adjustment
+		 * @return The number of merged object point groups
+		 */
+		static size_t mergeCorrespondingObjectPoints(Database& database, FreakMultiDescriptorMap256& freakMap, const PinholeCamera& pinholeCamera, RandomGenerator& randomGenerator, const std::set<IndexPair32>& correspondingObjectPointIdPairSet, const bool skipBundleAdjustment = false);
+
+		/**
+		 * Determines loop candidates for a subset of poses.
+		 * @param poseWords The tf-idf weighted visual words of all poses, one for each pose
+		 * @param invertedIndex The inverted index mapping visual words to poses
+		 * @param lowerPoseIndex The index of the first pose
+		 * @param maximalCandidatesPerPose The maximal number of candidates for each pose, with range [1, infinity)
+		 * @param minimalPoseIndexDistance The minimal distance between the indices of two poses, with range [1, infinity)
+		 * @param candidates The resulting candidates, one group for each pose
+		 * @param firstPose The first pose to be handled
+		 * @param numberPoses The number of poses to be handled
+		 */
+		static void determineLoopCandidatesSubset(const std::vector<WordWeightPairs>* poseWords, const std::vector<PoseWeightPairs>* invertedIndex, const Index32 lowerPoseIndex, const unsigned int maximalCandidatesPerPose, const unsigned int minimalPoseIndexDistance, std::vector<Indices32>* candidates, const unsigned int firstPose, const unsigned int numberPoses);
+
+		/**
+		 * Verifies a subset of loop candidates.
+		 * @param database The database holding the poses and object points
+		 * @param freakMap The map mapping object points to descriptors
+		 * @param pinholeCamera The pinhole camera profile to be used
+		 * @param randomGenerator The random generator to be used
+		 * @param candidates The candidate pose pairs to be verified
+		 * @param minimalNumberValidCorrespondences The minimal number of valid correspondences, with range [3, infinity)
+		 * @param maximalNumberOverlappingObjectPointInPosePair The maximal number of 3D object points which can be visible in both frames, with range [0, infinity)
+		 * @param maximalDescriptorDistance The maximal descriptor distance so that two descriptors are still considered to match, with range [0, infinity)
+		 * @param correspondingObjectPointIdPairGroups The resulting corresponding object point ids, one group for each candidate
+		 * @param world_T_loopCameras The resulting camera poses of the second poses of the candidates, determined with the 3D object points of the first poses, one for each candidate
+		 * @param firstCandidate The first candidate to be handled
+		 * @param numberCandidates The number of candidates to be handled
+		 */
+		static void verifyLoopCandidatesSubset(const Database* database, const FreakMultiDescriptorMap256* freakMap, const PinholeCamera* pinholeCamera, RandomGenerator* randomGenerator, const IndexPairs32* candidates, const unsigned int minimalNumberValidCorrespondences, const unsigned int maximalNumberOverlappingObjectPointInPosePair, const unsigned int maximalDescriptorDistance, std::vector<IndexPairs32>* correspondingObjectPointIdPairGroups, HomogenousMatrix4* world_T_loopCameras, const unsigned int firstCandidate, const unsigned int numberCandidates);
 };
 
 }
@@ -38,6 +38,35 @@ bool Relocalizer::setFeatureMap(SharedUnifiedFeatureMap featureMap)
 	const ScopedLock scopedLock(lock_);
 
 	featureMap_ = std::move(featureMap);
+	tiledFeatureMap_ = nullptr;
+
+	return true;
+}
+
+bool Relocalizer::setTiledFeatureMap(SharedTiledFeatureMap tiledFeatureMap, const Scalar priorRadius)
+{
+	ocean_assert(priorRadius >= Scalar(0));
+
+	if (!tiledFeatureMap || !tiledFeatureMap->isValid() || priorRadius < Scalar(0))
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	tiledFeatureMap_ = std::move(tiledFeatureMap);
+	tiledFeatureMapPriorRadius_ = priorRadius;
+
+	featureMap_ = nullptr;
+
+	return true;
+}
+
+bool Relocalizer::setPositionPrior(const Vector3& world_positionPrior)
+{
+	const ScopedLock scopedLock(lock_);
+
+	world_positionPrior_ = world_positionPrior;
 
 	return true;
 }
@@ -46,7 +75,17 @@ bool Relocalizer::isValid() const
 {
 	const ScopedLock scopedLock(lock_);
 
-	return imageFeaturePointDetectorFunction_ && featureMap_ && featureMap_->isValid();
+	if (!imageFeaturePointDetectorFunction_)
+	{
+		return false;
+	}
+
+	if (tiledFeatureMap_)
+	{
+		return tiledFeatureMap_->isValid();
+	}
+
+	return featureMap_ && featureMap_->isValid();
 }
 
 bool Relocalizer::detectFreakFeatures(const AnyCamera& camera, const Frame& yFrame, Vectors2& imagePoints, SharedUnifiedDescriptors& imagePointDescriptors)
@@ -102,12 +141,43 @@ Relocalizer& Relocalizer::operator=(Relocalizer&& relocalizer)
 
 		featureMap_ = std::move(relocalizer.featureMap_);
 
+		tiledFeatureMap_ = std::move(relocalizer.tiledFeatureMap_);
+		tiledFeatureMapPriorRadius_ = relocalizer.tiledFeatureMapPriorRadius_;
+		world_positionPrior_ = relocalizer.world_positionPrior_;
+
 		randomGenerator_ = std::move(relocalizer.randomGenerator_);
 	}
 
 	return *this;
 }
 
+SharedUnifiedFeatureMaps Relocalizer::relocalizationFeatureMaps(const HomogenousMatrix4& world_T_roughCamera)
+{
+	if (!tiledFeatureMap_)
+	{
+		if (featureMap_ && featureMap_->isValid())
+		{
+			return SharedUnifiedFeatureMaps(1, featureMap_);
+		}
+
+		return SharedUnifiedFeatureMaps();
+	}
+
+	if (world_T_roughCamera.isValid())
+	{
+		return tiledFeatureMap_->updatePosition(world_T_roughCamera.translation(), tiledFeatureMapPriorRadius_);
+	}
+
+	if (world_positionPrior_ != Vector3::minValue())
+	{
+		return tiledFeatureMap_->updatePosition(world_positionPrior_, tiledFeatureMapPriorRadius_);
+	}
+
+	// without any position prior, we re-use the tiles from the last update
+
+	return tiledFeatureMap_->activeFeatureMaps();
+}
+
 }
 
 }
@@ -9,6 +9,7 @@
 #define META_OCEAN_TRACKING_MAPBUILDING_RELOCALIZER_H
 
 #include "ocean/tracking/mapbuilding/MapBuilding.h"
+#include "ocean/tracking/mapbuilding/TiledFeatureMap.h"
 #include "ocean/tracking/mapbuilding/UnifiedDescriptor.h"
 #include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
 
@@ -62,8 +63,27 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 		 */
 		virtual bool setFeatureMap(SharedUnifiedFeatureMap featureMap);
 
+		/**
+		 * Sets or updates a tiled feature map to be used for relocalization instead of a single feature map.
+		 * The tiles around the rough camera pose (or around the position prior if no rough pose is provided) will be used for relocalization.
+		 * @param tiledFeatureMap The tiled feature map to be set, must be valid
+		 * @param priorRadius The radius around the position prior in which tiles will be used, in world units, with range [0, infinity)
+		 * @return True, if succeeded
+		 * @see setPositionPrior().
+		 */
+		virtual bool setTiledFeatureMap(SharedTiledFeatureMap tiledFeatureMap, const Scalar priorRadius);
+
+		/**
+		 * Sets or updates the position prior which is used when a tiled feature map is used but no rough camera pose is known.
+		 * The position prior can e.g., be a GPS location (see Devices::GPSTracker) which has been converted into the world coordinate system of the map.
+		 * @param world_positionPrior The position prior in world coordinates
+		 * @return True, if succeeded
+		 */
+		virtual bool setPositionPrior(const Vector3& world_positionPrior);
+
 		/**
 		 * Returns the object points of this relocalizer.
+		 * The relocalizer must not use a tiled feature map.
 		 * This function is not thread-safe.
 		 * @return The relocalizer's 3D object points
 		 */
@@ -71,6 +91,7 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 
 		/**
 		 * Returns the ids of the object points of this relocalizer.
+		 * The relocalizer must not use a tiled feature map.
 		 * This function is not thread-safe.
 		 * @return The relocalizer's object point ids
 		 */
@@ -112,6 +133,16 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 		 */
 		Relocalizer& operator=(Relocalizer&& relocalizer);
 
+		/**
+		 * Returns the feature maps which will be used for the next relocalization.
+		 * In case a tiled feature map is used, the tiles around the rough pose or the position prior are returned, closest tiles first.<br>
+		 * The correspondences of all feature maps are merged before the pose is estimated.<br>
+		 * The lock must be acquired by the caller.
+		 * @param world_T_roughCamera Optional rough camera pose to be used as position prior, invalid if unknown
+		 * @return The valid feature maps to be used, empty if no feature map is available
+		 */
+		SharedUnifiedFeatureMaps relocalizationFeatureMaps(const HomogenousMatrix4& world_T_roughCamera);
+
 	protected:
 
 		///  The function which detects and describes feature points in a given image.
@@ -120,6 +151,15 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 		/// The feature map to be used when relocalizing.
 		SharedUnifiedFeatureMap featureMap_;
 
+		/// The tiled feature map to be used when relocalizing, if any.
+		SharedTiledFeatureMap tiledFeatureMap_;
+
+		/// The radius around the position prior in which tiles of the tiled feature map will be used.
+		Scalar tiledFeatureMapPriorRadius_ = Scalar(0);
+
+		/// The position prior in world coordinates, invalid if unknown.
+		Vector3 world_positionPrior_ = Vector3::minValue();
+
 		/// The random generator object to be used.
 		RandomGenerator randomGenerator_;
 
@@ -129,14 +169,14 @@ class OCEAN_TRACKING_MAPBUILDING_EXPORT Relocalizer
 
 inline const Vectors3& Relocalizer::objectPoints() const
 {
-	ocean_assert(isValid());
+	ocean_assert(isValid() && featureMap_);
 
 	return featureMap_->objectPoints();
 }
 
 inline const Indices32& Relocalizer::objectPointIds() const
 {
-	ocean_assert(isValid());
+	ocean_assert(isValid() && featureMap_);
 
 	return featureMap_->objectPointIds();
 }
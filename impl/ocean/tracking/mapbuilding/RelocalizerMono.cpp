@@ -55,9 +55,29 @@ bool RelocalizerMono::relocalize(const AnyCamera& camera, const Frame& yFrame, H
 
 	ocean_assert(imagePointDescriptors && !imagePoints.empty() && imagePoints.size() == imagePointDescriptors->numberDescriptors());
 
-	const SharedUnifiedFeatureMap featureMap(featureMap_);
+	// in case of a tiled feature map, each tile around the rough pose is matched with its own descriptor indices, and the correspondences of all tiles are merged
 
-	if (!featureMap || !featureMap->isValid())
+	const SharedUnifiedFeatureMaps featureMaps(relocalizationFeatureMaps(world_T_roughCamera));
+
+	SharedUnifiedUnguidedMatchings unifiedUnguidedMatchings;
+	SharedUnifiedGuidedMatchings unifiedGuidedMatchings;
+
+	unifiedUnguidedMatchings.reserve(featureMaps.size());
+	unifiedGuidedMatchings.reserve(featureMaps.size());
+
+	for (const SharedUnifiedFeatureMap& featureMap : featureMaps)
+	{
+		SharedUnifiedUnguidedMatching tileUnifiedUnguidedMatching;
+		SharedUnifiedGuidedMatching tileUnifiedGuidedMatching;
+
+		if (featureMap && featureMap->isValid() && featureMap->createMatchingObjects(imagePoints.data(), imagePointDescriptors.get(), tileUnifiedUnguidedMatching, tileUnifiedGuidedMatching))
+		{
+			unifiedUnguidedMatchings.emplace_back(std::move(tileUnifiedUnguidedMatching));
+			unifiedGuidedMatchings.emplace_back(std::move(tileUnifiedGuidedMatching));
+		}
+	}
+
+	if (unifiedUnguidedMatchings.empty())
 	{
 		return false;
 	}
@@ -65,9 +85,15 @@ bool RelocalizerMono::relocalize(const AnyCamera& camera, const Frame& yFrame, H
 	SharedUnifiedUnguidedMatching unifiedUnguidedMatching;
 	SharedUnifiedGuidedMatching unifiedGuidedMatching;
 
-	if (!featureMap->createMatchingObjects(imagePoints.data(), imagePointDescriptors.get(), unifiedUnguidedMatching, unifiedGuidedMatching))
+	if (unifiedUnguidedMatchings.size() == 1)
 	{
-		return false;
+		unifiedUnguidedMatching = std::move(unifiedUnguidedMatchings.front());
+		unifiedGuidedMatching = std::move(unifiedGuidedMatchings.front());
+	}
+	else
+	{
+		unifiedUnguidedMatching = std::make_shared<UnifiedUnguidedMatchingCombined>(imagePoints.data(), imagePoints.size(), std::move(unifiedUnguidedMatchings));
+		unifiedGuidedMatching = std::make_shared<UnifiedGuidedMatchingCombined>(imagePoints.data(), imagePoints.size(), std::move(unifiedGuidedMatchings));
 	}
 
 	constexpr unsigned int binaryDistanceThreshold = 256u * 20u / 100u; // **TODO**
@@ -72,13 +72,6 @@ bool RelocalizerStereo::relocalize(const AnyCamera& cameraA, const AnyCamera& ca
 	ocean_assert(imagePointDescriptorsB && !imagePointsB.empty() && imagePointsB.size() == imagePointDescriptorsB->numberDescriptors());
 	ocean_assert(imagePointDescriptorsA->descriptorType() == imagePointDescriptorsB->descriptorType());
 
-	const SharedUnifiedFeatureMap featureMap(featureMap_);
-
-	if (!featureMap || !featureMap->isValid())
-	{
-		return false;
-	}
-
 	if (imagePointDescriptorsA->descriptorType() != UnifiedDescriptor::DT_FREAK_MULTI_LEVEL_SINGLE_VIEW_256)
 	{
 		ocean_assert(false && "Other descriptors not yet supported!");
@@ -88,34 +81,62 @@ bool RelocalizerStereo::relocalize(const AnyCamera& cameraA, const AnyCamera& ca
 	const CV::Detector::FREAKDescriptor32* freakImagePointDescriptorsA = dynamic_cast<const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256*>(imagePointDescriptorsA.get())->descriptors();
 	const CV::Detector::FREAKDescriptor32* freakImagePointDescriptorsB = dynamic_cast<const UnifiedDescriptorsFreakMultiLevelSingleViewDescriptor256*>(imagePointDescriptorsB.get())->descriptors();
 
-	if (featureMap->descriptorMap().descriptorType() != UnifiedDescriptor::DT_FREAK_MULTI_LEVEL_MULTI_VIEW_256)
-	{
-		ocean_assert(false && "Other descriptors not yet supported!");
-		return false;
-	}
+	// in case of a tiled feature map, each tile around the rough pose is matched with its own descriptor indices, and the correspondences of all tiles are merged
 
-	if (featureMap->objectPointVocabularyDescriptors().descriptorType() != UnifiedDescriptor::binaryDescriptorType<false, false, 256u>())
-	{
-		ocean_assert(false && "Other descriptors not yet supported!");
-		return false;
-	}
+	const SharedUnifiedFeatureMaps featureMaps(relocalizationFeatureMaps(world_T_roughDevice));
 
 	using Descriptor = UnifiedDescriptor::BinaryDescriptor<256u>;
 	using VocabularyForest = Tracking::VocabularyForest<Descriptor, unsigned int, UnifiedDescriptorT<Descriptor>::determineDistance>;
 
-	const UnifiedDescriptorsBinarySingleLevelSingleView<256u>* specializedObjectPointDescriptors = dynamic_cast<const UnifiedDescriptorsBinarySingleLevelSingleView<256u>*>(&featureMap->objectPointVocabularyDescriptors());
-	ocean_assert(specializedObjectPointDescriptors != nullptr);
+	SharedUnifiedUnguidedMatchings unifiedUnguidedMatchingsA;
+	SharedUnifiedUnguidedMatchings unifiedUnguidedMatchingsB;
+	SharedUnifiedGuidedMatchings unifiedGuidedMatchingsA;
+	SharedUnifiedGuidedMatchings unifiedGuidedMatchingsB;
 
-	const VocabularyForest* vocabularyForest = dynamic_cast<const VocabularyForest*>(&featureMap->objectPointDescriptorsForest());
-	ocean_assert(vocabularyForest != nullptr);
+	for (const SharedUnifiedFeatureMap& featureMap : featureMaps)
+	{
+		if (!featureMap || !featureMap->isValid())
+		{
+			continue;
+		}
 
-	const Tracking::MapBuilding::UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap& specializedDescriptorMap = ((Tracking::MapBuilding::UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256&)(featureMap->descriptorMap())).descriptorMap();
+		if (featureMap->descriptorMap().descriptorType() != UnifiedDescriptor::DT_FREAK_MULTI_LEVEL_MULTI_VIEW_256)
+		{
+			ocean_assert(false && "Other descriptors not yet supported!");
+			return false;
+		}
+
+		if (featureMap->objectPointVocabularyDescriptors().descriptorType() != UnifiedDescriptor::binaryDescriptorType<false, false, 256u>())
+		{
+			ocean_assert(false && "Other descriptors not yet supported!");
+			return false;
+		}
+
+		const UnifiedDescriptorsBinarySingleLevelSingleView<256u>* specializedObjectPointDescriptors = dynamic_cast<const UnifiedDescriptorsBinarySingleLevelSingleView<256u>*>(&featureMap->objectPointVocabularyDescriptors());
+		ocean_assert(specializedObjectPointDescriptors != nullptr);
+
+		const VocabularyForest* vocabularyForest = dynamic_cast<const VocabularyForest*>(&featureMap->objectPointDescriptorsForest());
+		ocean_assert(vocabularyForest != nullptr);
+
+		const Tracking::MapBuilding::UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256::DescriptorMap& specializedDescriptorMap = ((Tracking::MapBuilding::UnifiedDescriptorMapFreakMultiLevelMultiViewDescriptor256&)(featureMap->descriptorMap())).descriptorMap();
+
+		unifiedUnguidedMatchingsA.emplace_back(std::make_shared<Tracking::MapBuilding::UnifiedUnguidedMatchingFreakMultiLevelDescriptor256>(imagePointsA.data(), freakImagePointDescriptorsA, imagePointsA.size(), featureMap->objectPoints().data(), specializedObjectPointDescriptors->descriptors(), featureMap->objectPoints().size(), featureMap->objectPointIndices().data(), *vocabularyForest));
+		unifiedGuidedMatchingsA.emplace_back(std::make_shared<Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256>(imagePointsA.data(), freakImagePointDescriptorsA, imagePointsA.size(), featureMap->objectPoints().data(), featureMap->objectPoints().size(), featureMap->objectPointOctree(), featureMap->objectPointIds().data(), specializedDescriptorMap));
+
+		unifiedUnguidedMatchingsB.emplace_back(std::make_shared<Tracking::MapBuilding::UnifiedUnguidedMatchingFreakMultiLevelDescriptor256>(imagePointsB.data(), freakImagePointDescriptorsB, imagePointsB.size(), featureMap->objectPoints().data(), specializedObjectPointDescriptors->descriptors(), featureMap->objectPoints().size(), featureMap->objectPointIndices().data(), *vocabularyForest));
+		unifiedGuidedMatchingsB.emplace_back(std::make_shared<Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256>(imagePointsB.data(), freakImagePointDescriptorsB, imagePointsB.size(), featureMap->objectPoints().data(), featureMap->objectPoints().size(), featureMap->objectPointOctree(), featureMap->objectPointIds().data(), specializedDescriptorMap));
+	}
+
+	if (unifiedUnguidedMatchingsA.empty())
+	{
+		return false;
+	}
 
-	const Tracking::MapBuilding::UnifiedUnguidedMatchingFreakMultiLevelDescriptor256 unifiedUnguidedMatchingA(imagePointsA.data(), freakImagePointDescriptorsA, imagePointsA.size(), featureMap->objectPoints().data(), specializedObjectPointDescriptors->descriptors(), featureMap->objectPoints().size(), featureMap->objectPointIndices().data(), *vocabularyForest);
-	const Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256 unifiedGuidedMatchingA(imagePointsA.data(), freakImagePointDescriptorsA, imagePointsA.size(), featureMap->objectPoints().data(), featureMap->objectPoints().size(), featureMap->objectPointOctree(), featureMap->objectPointIds().data(), specializedDescriptorMap);
+	const UnifiedUnguidedMatchingCombined unifiedUnguidedMatchingA(imagePointsA.data(), imagePointsA.size(), std::move(unifiedUnguidedMatchingsA));
+	const UnifiedGuidedMatchingCombined unifiedGuidedMatchingA(imagePointsA.data(), imagePointsA.size(), std::move(unifiedGuidedMatchingsA));
 
-	const Tracking::MapBuilding::UnifiedUnguidedMatchingFreakMultiLevelDescriptor256 unifiedUnguidedMatchingB(imagePointsB.data(), freakImagePointDescriptorsB, imagePointsB.size(), featureMap->objectPoints().data(), specializedObjectPointDescriptors->descriptors(), featureMap->objectPoints().size(), featureMap->objectPointIndices().data(), *vocabularyForest);
-	const Tracking::MapBuilding::UnifiedGuidedMatchingFreakMultiLevelDescriptor256 unifiedGuidedMatchingB(imagePointsB.data(), freakImagePointDescriptorsB, imagePointsB.size(), featureMap->objectPoints().data(), featureMap->objectPoints().size(), featureMap->objectPointOctree(), featureMap->objectPointIds().data(), specializedDescriptorMap);
+	const UnifiedUnguidedMatchingCombined unifiedUnguidedMatchingB(imagePointsB.data(), imagePointsB.size(), std::move(unifiedUnguidedMatchingsB));
+	const UnifiedGuidedMatchingCombined unifiedGuidedMatchingB(imagePointsB.data(), imagePointsB.size(), std::move(unifiedGuidedMatchingsB));
 
 	Indices32 usedImagePointIndicesA;
 	Indices32 usedImagePointIndicesB;
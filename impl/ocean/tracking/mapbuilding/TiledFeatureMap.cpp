@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/mapbuilding/TiledFeatureMap.h"
+
+#include "ocean/math/Box3.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace MapBuilding
+{
+
+TiledFeatureMap::TiledFeatureMap(const Scalar tileSize, TileLoaderFunction tileLoaderFunction, const size_t memoryBudget) :
+	tileSize_(tileSize),
+	tileLoaderFunction_(std::move(tileLoaderFunction)),
+	memoryBudget_(memoryBudget)
+{
+	ocean_assert(isValid());
+}
+
+SharedUnifiedFeatureMaps TiledFeatureMap::updatePosition(const Vector3& world_position, const Scalar radius)
+{
+	ocean_assert(isValid());
+	ocean_assert(radius >= Scalar(0));
+
+	const ScopedLock scopedLock(lock_);
+
+	if (!isValid())
+	{
+		return SharedUnifiedFeatureMaps();
+	}
+
+	const TileIndex lowerTileIndex = tileIndex(world_position - Vector3(radius, radius, radius));
+	const TileIndex upperTileIndex = tileIndex(world_position + Vector3(radius, radius, radius));
+
+	const Scalar sqrRadius = Numeric::sqr(radius);
+
+	using DistancePair = std::pair<Scalar, TileIndex>;
+	std::vector<DistancePair> candidateTiles;
+
+	for (int z = lowerTileIndex.z(); z <= upperTileIndex.z(); ++z)
+	{
+		for (int y = lowerTileIndex.y(); y <= upperTileIndex.y(); ++y)
+		{
+			for (int x = lowerTileIndex.x(); x <= upperTileIndex.x(); ++x)
+			{
+				const Vector3 lowerCorner = Vector3(Scalar(x), Scalar(y), Scalar(z)) * tileSize_;
+				const Box3 tileBox(lowerCorner, lowerCorner + Vector3(tileSize_, tileSize_, tileSize_));
+
+				// the closest point of the tile must be inside the sphere
+
+				const Vector3 closestPoint(minmax(tileBox.lower().x(), world_position.x(), tileBox.higher().x()), minmax(tileBox.lower().y(), world_position.y(), tileBox.higher().y()), minmax(tileBox.lower().z(), world_position.z(), tileBox.higher().z()));
+
+				if (closestPoint.sqrDistance(world_position) <= sqrRadius)
+				{
+					candidateTiles.emplace_back(tileBox.center().sqrDistance(world_position), TileIndex(x, y, z));
+				}
+			}
+		}
+	}
+
+	std::sort(candidateTiles.begin(), candidateTiles.end(), [](const DistancePair& a, const DistancePair& b) { return a.first < b.first; });
+
+	activeTileIndices_.clear();
+	activeFeatureMaps_.clear();
+
+	for (const DistancePair& candidateTile : candidateTiles)
+	{
+		const TileIndex& candidateTileIndex = candidateTile.second;
+
+		if (emptyTileIndices_.find(candidateTileIndex) != emptyTileIndices_.cend())
+		{
+			continue;
+		}
+
+		TileMap::iterator iTile = tileMap_.find(candidateTileIndex);
+
+		if (iTile != tileMap_.end())
+		{
+			// the tile becomes the most recently used tile
+
+			lruTileIndices_.splice(lruTileIndices_.begin(), lruTileIndices_, iTile->second.lruIterator_);
+		}
+		else
+		{
+			Tile tile;
+			const LoadResult loadResult = tileLoaderFunction_(candidateTileIndex, tile.featureMap_, tile.memorySize_);
+
+			if (loadResult == LR_NO_DATA)
+			{
+				emptyTileIndices_.emplace(candidateTileIndex);
+				continue;
+			}
+
+			if (loadResult != LR_SUCCEEDED || !tile.featureMap_ || !tile.featureMap_->isValid())
+			{
+				// the tile will be requested again with the next position update
+
+				continue;
+			}
+
+			ocean_assert(tile.memorySize_ != 0);
+
+			lruTileIndices_.emplace_front(candidateTileIndex);
+			tile.lruIterator_ = lruTileIndices_.begin();
+
+			memoryUsage_ += tile.memorySize_;
+
+			iTile = tileMap_.emplace(candidateTileIndex, std::move(tile)).first;
+		}
+
+		activeTileIndices_.emplace(candidateTileIndex);
+		activeFeatureMaps_.emplace_back(iTile->second.featureMap_);
+	}
+
+	evictTiles();
+
+	return activeFeatureMaps_;
+}
+
+SharedUnifiedFeatureMaps TiledFeatureMap::activeFeatureMaps() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return activeFeatureMaps_;
+}
+
+void TiledFeatureMap::setMemoryBudget(const size_t memoryBudget)
+{
+	ocean_assert(memoryBudget != 0);
+
+	const ScopedLock scopedLock(lock_);
+
+	memoryBudget_ = memoryBudget;
+
+	evictTiles();
+}
+
+size_t TiledFeatureMap::memoryBudget() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return memoryBudget_;
+}
+
+size_t TiledFeatureMap::memoryUsage() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return memoryUsage_;
+}
+
+size_t TiledFeatureMap::loadedTiles() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	ocean_assert(tileMap_.size() == lruTileIndices_.size());
+
+	return tileMap_.size();
+}
+
+void TiledFeatureMap::clear()
+{
+	const ScopedLock scopedLock(lock_);
+
+	tileMap_.clear();
+	lruTileIndices_.clear();
+	emptyTileIndices_.clear();
+	activeTileIndices_.clear();
+	activeFeatureMaps_.clear();
+
+	memoryUsage_ = 0;
+}
+
+void TiledFeatureMap::evictTiles()
+{
+	std::list<TileIndex>::iterator iLru = lruTileIndices_.end();
+
+	while (memoryUsage_ > memoryBudget_ && iLru != lruTileIndices_.begin())
+	{
+		--iLru;
+
+		if (activeTileIndices_.find(*iLru) != activeTileIndices_.cend())
+		{
+			// active tiles are used for the current position and must stay in memory
+			continue;
+		}
+
+		const TileMap::iterator iTile = tileMap_.find(*iLru);
+		ocean_assert(iTile != tileMap_.end());
+
+		ocean_assert(memoryUsage_ >= iTile->second.memorySize_);
+		memoryUsage_ -= iTile->second.memorySize_;
+
+		tileMap_.erase(iTile);
+		iLru = lruTileIndices_.erase(iLru);
+	}
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_MAPBUILDING_TILED_FEATURE_MAP_H
+#define META_OCEAN_TRACKING_MAPBUILDING_TILED_FEATURE_MAP_H
+
+#include "ocean/tracking/mapbuilding/MapBuilding.h"
+#include "ocean/tracking/mapbuilding/UnifiedFeatureMap.h"
+
+#include "ocean/base/Lock.h"
+
+#include "ocean/math/Vector3.h"
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace MapBuilding
+{
+
+// Forward declaration.
+class TiledFeatureMap;
+
+/**
+ * Definition of a shared pointer holding a TiledFeatureMap object.
+ * @see TiledFeatureMap.
+ * @ingroup trackingmapbuilding
+ */
+using SharedTiledFeatureMap = std::shared_ptr<TiledFeatureMap>;
+
+/**
+ * This class implements a feature map which is spatially partitioned into tiles which are loaded on demand.
+ * The world is partitioned into a regular grid of cubic tiles, each tile is an independent feature map with own descriptor indices (e.g., an own vocabulary forest).<br>
+ * Tiles are loaded via a user-defined loader function whenever they are needed around a position prior, and are kept in a least-recently-used cache.<br>
+ * Once the memory of all loaded tiles exceeds a given budget, the least recently used tiles which are not needed for the current position prior are evicted.<br>
+ * The tiles around the position prior are matched individually and their correspondences are merged before the pose is estimated, so that features close to tile borders can be used together.<br>
+ * Thus, a relocalization service can cover maps which are significantly larger than the available memory.
+ * @ingroup trackingmapbuilding
+ */
+class OCEAN_TRACKING_MAPBUILDING_EXPORT TiledFeatureMap
+{
+	public:
+
+		/**
+		 * Definition of the index of a tile, with integer coordinates along the x-, y-, and z-axis of the world.
+		 */
+		using TileIndex = VectorI3;
+
+		/**
+		 * Definition of a vector holding tile indices.
+		 */
+		using TileIndices = std::vector<TileIndex>;
+
+		/**
+		 * Definition of individual results of a tile loader function.
+		 */
+		enum LoadResult : uint32_t
+		{
+			/// The tile exists and has been loaded.
+			LR_SUCCEEDED = 0u,
+			/// The tile does not contain any data, the tile will not be requested again.
+			LR_NO_DATA,
+			/// The tile could not be loaded e.g., due to a temporary I/O error, the tile will be requested again with the next position update.
+			LR_FAILED
+		};
+
+		/**
+		 * Definition of a function which loads the feature map of a tile.
+		 * The function may be invoked for tiles without any data, in this case the function should return LR_NO_DATA.
+		 * @param tileIndex The index of the tile to be loaded
+		 * @param featureMap The resulting feature map of the tile
+		 * @param memorySize The resulting memory size of the feature map in bytes, with range [1, infinity)
+		 * @return The load result
+		 */
+		using TileLoaderFunction = std::function<LoadResult(const TileIndex& tileIndex, SharedUnifiedFeatureMap& featureMap, size_t& memorySize)>;
+
+	protected:
+
+		/**
+		 * This class implements a hash function for tile indices.
+		 */
+		class TileIndexHash
+		{
+			public:
+
+				/**
+				 * Hash function.
+				 * @param tileIndex The tile index for which the hash will be determined
+				 * @return The hash value
+				 */
+				inline size_t operator()(const TileIndex& tileIndex) const;
+		};
+
+		/**
+		 * This class holds the information of a loaded tile.
+		 */
+		class Tile
+		{
+			public:
+
+				/// The feature map of the tile.
+				SharedUnifiedFeatureMap featureMap_;
+
+				/// The memory size of the tile, in bytes.
+				size_t memorySize_ = 0;
+
+				/// The position of the tile in the least-recently-used list.
+				std::list<TileIndex>::iterator lruIterator_;
+		};
+
+		/**
+		 * Definition of an unordered map mapping tile indices to tiles.
+		 */
+		using TileMap = std::unordered_map<TileIndex, Tile, TileIndexHash>;
+
+		/**
+		 * Definition of an unordered set holding tile indices.
+		 */
+		using TileIndexSet = std::unordered_set<TileIndex, TileIndexHash>;
+
+	public:
+
+		/**
+		 * Creates a new tiled feature map.
+		 * @param tileSize The edge length of each tile in world units, with range (0, infinity)
+		 * @param tileLoaderFunction The function which loads the individual tiles, must be valid
+		 * @param memoryBudget The maximal memory all loaded tiles should use together, in bytes, with range [1, infinity)
+		 */
+		TiledFeatureMap(const Scalar tileSize, TileLoaderFunction tileLoaderFunction, const size_t memoryBudget);
+
+		/**
+		 * Updates the position prior of this map and returns the feature maps of all tiles around the position.
+		 * Tiles which are not yet loaded will be loaded, the least recently used tiles will be evicted if the memory budget is exceeded.
+		 * @param world_position The position prior in world coordinates e.g., a GPS location converted into the world coordinate system
+		 * @param radius The radius around the position prior in which tiles will be used, in world units, with range [0, infinity)
+		 * @return The feature maps of all existing tiles intersecting the sphere around the position prior, sorted by increasing distance between tile center and position prior
+		 */
+		SharedUnifiedFeatureMaps updatePosition(const Vector3& world_position, const Scalar radius);
+
+		/**
+		 * Returns the feature maps of all tiles which have been determined during the last position update.
+		 * @return The active feature maps, sorted by increasing distance to the last position prior
+		 */
+		SharedUnifiedFeatureMaps activeFeatureMaps() const;
+
+		/**
+		 * Sets the memory budget for all loaded tiles.
+		 * @param memoryBudget The memory budget in bytes, with range [1, infinity)
+		 */
+		void setMemoryBudget(const size_t memoryBudget);
+
+		/**
+		 * Returns the memory budget for all loaded tiles.
+		 * @return The memory budget, in bytes
+		 */
+		size_t memoryBudget() const;
+
+		/**
+		 * Returns the memory currently used by all loaded tiles.
+		 * @return The used memory, in bytes
+		 */
+		size_t memoryUsage() const;
+
+		/**
+		 * Returns the number of currently loaded tiles.
+		 * @return The number of loaded tiles
+		 */
+		size_t loadedTiles() const;
+
+		/**
+		 * Returns the edge length of the tiles.
+		 * @return The tile size in world units
+		 */
+		inline Scalar tileSize() const;
+
+		/**
+		 * Returns the index of the tile containing a given position.
+		 * @param world_position The position in world coordinates
+		 * @return The index of the tile
+		 */
+		inline TileIndex tileIndex(const Vector3& world_position) const;
+
+		/**
+		 * Unloads all tiles and forgets all tiles known to be empty.
+		 */
+		void clear();
+
+		/**
+		 * Returns whether this map is valid.
+		 * @return True, if so
+		 */
+		inline bool isValid() const;
+
+	protected:
+
+		/**
+		 * Evicts the least recently used tiles until the memory budget is met, active tiles will not be evicted.
+		 * The lock must be acquired by the caller.
+		 */
+		void evictTiles();
+
+	protected:
+
+		/// The edge length of each tile, in world units.
+		Scalar tileSize_ = Scalar(0);
+
+		/// The function loading individual tiles.
+		TileLoaderFunction tileLoaderFunction_;
+
+		/// The memory budget for all loaded tiles, in bytes.
+		size_t memoryBudget_ = 0;
+
+		/// The memory currently used by all loaded tiles, in bytes.
+		size_t memoryUsage_ = 0;
+
+		/// The currently loaded tiles.
+		TileMap tileMap_;
+
+		/// The indices of all loaded tiles, the most recently used tile at the front.
+		std::list<TileIndex> lruTileIndices_;
+
+		/// The indices of all tiles for which the loader did not provide any data.
+		TileIndexSet emptyTileIndices_;
+
+		/// The indices of the tiles determined during the last position update.
+		TileIndexSet activeTileIndices_;
+
+		/// The feature maps of the tiles determined during the last position update.
+		SharedUnifiedFeatureMaps activeFeatureMaps_;
+
+		/// The map's lock.
+		mutable Lock lock_;
+};
+
+inline size_t TiledFeatureMap::TileIndexHash::operator()(const TileIndex& tileIndex) const
+{
+	size_t seed = std::hash<int>{}(tileIndex.x());
+	seed ^= std::hash<int>{}(tileIndex.y()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	seed ^= std::hash<int>{}(tileIndex.z()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+	return seed;
+}
+
+inline Scalar TiledFeatureMap::tileSize() const
+{
+	return tileSize_;
+}
+
+inline TiledFeatureMap::TileIndex TiledFeatureMap::tileIndex(const Vector3& world_position) const
+{
+	ocean_assert(tileSize_ > Numeric::eps());
+
+	return TileIndex(int(Numeric::floor(world_position.x() / tileSize_)), int(Numeric::floor(world_position.y() / tileSize_)), int(Numeric::floor(world_position.z() / tileSize_)));
+}
+
+inline bool TiledFeatureMap::isValid() const
+{
+	return tileSize_ > Numeric::eps() && bool(tileLoaderFunction_) && memoryBudget_ != 0;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_MAPBUILDING_TILED_FEATURE_MAP_H
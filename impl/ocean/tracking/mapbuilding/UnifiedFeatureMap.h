@@ -37,6 +37,12 @@ class UnifiedFeatureMap;
  */
 using SharedUnifiedFeatureMap = std::shared_ptr<UnifiedFeatureMap>;
 
+/**
+ * Definition of a vector holding UnifiedFeatureMap objects.
+ * @ingroup trackingmapbuilding
+ */
+using SharedUnifiedFeatureMaps = std::vector<SharedUnifiedFeatureMap>;
+
 /**
  * This class implements the base class for a feature map necessary to re-localize with optimized data structures.
  * @ingroup trackingmapbuilding
@@ -20,7 +20,7 @@ namespace MapBuilding
 
 void UnifiedGuidedMatchingFreakMultiDescriptor256Group::determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Worker* worker) const
 {
-	PoseEstimationT::determineGuidedMatchings<ImagePointDescriptorGroup, ObjectPointDescriptor, DescriptorDistance, DescriptorHandling::determineFreakDistance>(anyCamera, world_T_camera, imagePoints_, imagePointDescriptorGroups_, numberImagePoints_, objectPoints_, objectPointOctree_, objectPointIds_, objectPointDescriptorMap_, matchedImagePoints, matchedObjectPoints, maximalDescriptorDistance.binaryDistance(), matchedImagePointIndices, matchedObjectPointIds, worker);
+	PoseEstimationT::determineGuidedMatchings<ImagePointDescriptorGroup, ObjectPointDescriptor, DescriptorDistance, DescriptorHandling::determineFreakDistance>(anyCamera, world_T_camera, imagePoints_, imagePointDescriptorGroups_, numberImagePoints_, objectPoints_, *objectPointOctree_, objectPointIds_, objectPointDescriptorMap_, matchedImagePoints, matchedObjectPoints, maximalDescriptorDistance.binaryDistance(), matchedImagePointIndices, matchedObjectPointIds, worker);
 }
 
 bool UnifiedUnguidedMatchingFreakMultiFeatures256Group::determineUnguidedMatchings(const unsigned int minimalNumberCorrespondences, const DistanceValue& maximalDescriptorDistance, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, Worker* worker) const
@@ -53,6 +53,114 @@ bool UnifiedUnguidedMatchingFreakMultiFeatures256Group::determineUnguidedMatchin
 	return true;
 }
 
+UnifiedGuidedMatchingCombined::UnifiedGuidedMatchingCombined(const Vector2* imagePoints, const size_t numberImagePoints, SharedUnifiedGuidedMatchings unifiedGuidedMatchings) :
+	UnifiedGuidedMatching(imagePoints, numberImagePoints),
+	unifiedGuidedMatchings_(std::move(unifiedGuidedMatchings))
+{
+	ocean_assert(!unifiedGuidedMatchings_.empty());
+
+#ifdef OCEAN_DEBUG
+	for (const SharedUnifiedGuidedMatching& unifiedGuidedMatching : unifiedGuidedMatchings_)
+	{
+		ocean_assert(unifiedGuidedMatching && unifiedGuidedMatching->numberImagePoints() == numberImagePoints_);
+	}
+#endif
+}
+
+void UnifiedGuidedMatchingCombined::determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Worker* worker) const
+{
+	std::vector<uint8_t> matchedImagePointStatements(numberImagePoints_, 0u);
+	UnorderedIndexSet32 matchedObjectPointIdSet;
+
+	Vectors2 localMatchedImagePoints;
+	Vectors3 localMatchedObjectPoints;
+	Indices32 localMatchedImagePointIndices;
+	Indices32 localMatchedObjectPointIds;
+
+	for (const SharedUnifiedGuidedMatching& unifiedGuidedMatching : unifiedGuidedMatchings_)
+	{
+		localMatchedImagePoints.clear();
+		localMatchedObjectPoints.clear();
+		localMatchedImagePointIndices.clear();
+		localMatchedObjectPointIds.clear();
+
+		unifiedGuidedMatching->determineGuidedMatchings(anyCamera, world_T_camera, localMatchedImagePoints, localMatchedObjectPoints, maximalDescriptorDistance, &localMatchedImagePointIndices, &localMatchedObjectPointIds, worker);
+
+		ocean_assert(localMatchedImagePoints.size() == localMatchedObjectPoints.size());
+		ocean_assert(localMatchedImagePoints.size() == localMatchedImagePointIndices.size());
+		ocean_assert(localMatchedImagePoints.size() == localMatchedObjectPointIds.size());
+
+		for (size_t n = 0; n < localMatchedImagePointIndices.size(); ++n)
+		{
+			const Index32 imagePointIndex = localMatchedImagePointIndices[n];
+			ocean_assert(imagePointIndex < numberImagePoints_);
+
+			// an image point keeps the correspondence of the first matching object, an object point contained in several matching objects is matched once
+
+			if (matchedImagePointStatements[imagePointIndex] != 0u || !matchedObjectPointIdSet.emplace(localMatchedObjectPointIds[n]).second)
+			{
+				continue;
+			}
+
+			matchedImagePointStatements[imagePointIndex] = 1u;
+
+			matchedImagePoints.emplace_back(localMatchedImagePoints[n]);
+			matchedObjectPoints.emplace_back(localMatchedObjectPoints[n]);
+
+			if (matchedImagePointIndices != nullptr)
+			{
+				matchedImagePointIndices->emplace_back(imagePointIndex);
+			}
+
+			if (matchedObjectPointIds != nullptr)
+			{
+				matchedObjectPointIds->emplace_back(localMatchedObjectPointIds[n]);
+			}
+		}
+	}
+}
+
+UnifiedUnguidedMatchingCombined::UnifiedUnguidedMatchingCombined(const Vector2* imagePoints, const size_t numberImagePoints, SharedUnifiedUnguidedMatchings unifiedUnguidedMatchings) :
+	UnifiedUnguidedMatching(imagePoints, numberImagePoints),
+	unifiedUnguidedMatchings_(std::move(unifiedUnguidedMatchings))
+{
+	ocean_assert(!unifiedUnguidedMatchings_.empty());
+
+#ifdef OCEAN_DEBUG
+	for (const SharedUnifiedUnguidedMatching& unifiedUnguidedMatching : unifiedUnguidedMatchings_)
+	{
+		ocean_assert(unifiedUnguidedMatching && unifiedUnguidedMatching->numberImagePoints() == numberImagePoints_);
+	}
+#endif
+}
+
+bool UnifiedUnguidedMatchingCombined::determineUnguidedMatchings(const unsigned int minimalNumberCorrespondences, const DistanceValue& maximalDescriptorDistance, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, Worker* worker) const
+{
+	ocean_assert(matchedImagePoints.empty());
+	ocean_assert(matchedObjectPoints.empty());
+
+	Vectors2 localMatchedImagePoints;
+	Vectors3 localMatchedObjectPoints;
+
+	for (const SharedUnifiedUnguidedMatching& unifiedUnguidedMatching : unifiedUnguidedMatchings_)
+	{
+		localMatchedImagePoints.clear();
+		localMatchedObjectPoints.clear();
+
+		// each matching object may provide a few correspondences only, e.g., if the camera observes the border between two tiles
+
+		if (unifiedUnguidedMatching->determineUnguidedMatchings(1u, maximalDescriptorDistance, localMatchedImagePoints, localMatchedObjectPoints, worker))
+		{
+			ocean_assert(localMatchedImagePoints.size() == localMatchedObjectPoints.size());
+
+			matchedImagePoints.insert(matchedImagePoints.cend(), localMatchedImagePoints.cbegin(), localMatchedImagePoints.cend());
+			matchedObjectPoints.insert(matchedObjectPoints.cend(), localMatchedObjectPoints.cbegin(), localMatchedObjectPoints.cend());
+		}
+	}
+
+	return matchedImagePoints.size() >= size_t(minimalNumberCorrespondences);
+}
+
 }
 
 }
@@ -18,6 +18,7 @@
 #include "ocean/base/Worker.h"
 
 #include "ocean/geometry/Octree.h"
+#include "ocean/geometry/SpatialDistribution.h"
 
 #include "ocean/math/AnyCamera.h"
 #include "ocean/math/HomogenousMatrix4.h"
@@ -203,10 +204,18 @@ class UnifiedGuidedMatching : public UnifiedMatching
 		 */
 		inline UnifiedGuidedMatching(const Vector2* imagePoints, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Geometry::Octree& objectPointOctree, const Index32* objectPointIds);
 
+		/**
+		 * Creates a new matching object with 2D image points only, e.g., for a matching object combining other matching objects.
+		 * Does not create a copy of the given input.
+		 * @param imagePoints The 2D image points, can be nullptr if 'numberImagePoints == 0'
+		 * @param numberImagePoints the number of 2D image points, with range [0, infinity)
+		 */
+		inline UnifiedGuidedMatching(const Vector2* imagePoints, const size_t numberImagePoints);
+
 	protected:
 
-		/// The octree holding all 3D object points.
-		const Geometry::Octree& objectPointOctree_;
+		/// The octree holding all 3D object points, nullptr if the matching object does not hold any object points.
+		const Geometry::Octree* objectPointOctree_ = nullptr;
 
 		/// The ids of all 3D object points.
 		const Index32* objectPointIds_ = nullptr;
@@ -219,6 +228,12 @@ class UnifiedGuidedMatching : public UnifiedMatching
  */
 using SharedUnifiedGuidedMatching = std::shared_ptr<UnifiedGuidedMatching>;
 
+/**
+ * Definition of a vector holding UnifiedGuidedMatching objects.
+ * @ingroup trackingmapbuilding
+ */
+using SharedUnifiedGuidedMatchings = std::vector<SharedUnifiedGuidedMatching>;
+
 /**
  * This class implements the base class for all unguided matching objects.
  * @ingroup trackingmapbuilding
@@ -260,6 +275,14 @@ class UnifiedUnguidedMatching : public UnifiedMatching
 		 */
 		inline UnifiedUnguidedMatching(const Vector2* imagePoints, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Index32* objectPointIndices);
 
+		/**
+		 * Creates a new matching object with 2D image points only, e.g., for a matching object combining other matching objects.
+		 * Does not create a copy of the given input.
+		 * @param imagePoints The 2D image points, can be nullptr if 'numberImagePoints == 0'
+		 * @param numberImagePoints the number of 2D image points, with range [0, infinity)
+		 */
+		inline UnifiedUnguidedMatching(const Vector2* imagePoints, const size_t numberImagePoints);
+
 	protected:
 
 		/// The indices of the corresponding 3D object points, one for each object point descriptor, mainly a map mapping descriptor indices to point indices.
@@ -273,6 +296,12 @@ class UnifiedUnguidedMatching : public UnifiedMatching
  */
 using SharedUnifiedUnguidedMatching = std::shared_ptr<UnifiedUnguidedMatching>;
 
+/**
+ * Definition of a vector holding UnifiedUnguidedMatching objects.
+ * @ingroup trackingmapbuilding
+ */
+using SharedUnifiedUnguidedMatchings = std::vector<SharedUnifiedUnguidedMatching>;
+
 /**
  * This class implements the guided matching object for specific features.
  * @tparam TImagePointDescriptor The data type of the image point descriptors, e.g., a single-level or a multi-level descriptor binary/float descriptor
@@ -370,6 +399,131 @@ using UnifiedGuidedMatchingFreakMultiLevelDescriptor256 = UnifiedGuidedMatchingT
 template <uint16_t tElements>
 using UnifiedGuidedMatchingFloatSingleLevelDescriptor = UnifiedGuidedMatchingT<UnifiedDescriptor::FloatDescriptor<tElements>, UnifiedDescriptor::FloatDescriptors<tElements>>;
 
+/**
+ * This class implements a guided matching object for specific features which is based on projected object points.
+ * Instead of intersecting the octree with a viewing ray for each individual image point, all 3D object points are projected into the camera once.<br>
+ * The projected object points are distributed into a 2D grid with bins matching the maximal projection error, so that each image point needs to be compared with the object points located in the neighboring bins only.<br>
+ * The object point descriptors are looked up once per projected object point (and not once per candidate), and all candidates of an image point are compared in one tight loop.<br>
+ * This matching object is beneficial for feature maps with a large number of object points, e.g., 100k and more.
+ * @tparam TImagePointDescriptor The data type of the image point descriptors, e.g., a single-level or a multi-level descriptor binary/float descriptor
+ * @tparam TObjectPointDescriptor The data type of the object point descriptors, e.g., a single-level or multi-level single/multi-view descriptor
+ * @tparam TDistance The data type of the distance between an image point and object point descriptor e.g., unsigned int or float
+ * @see UnifiedGuidedMatchingT.
+ * @ingroup trackingmapbuilding
+ */
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance = typename UnifiedDescriptor::DistanceTyper<TImagePointDescriptor>::Type>
+class UnifiedGuidedMatchingProjectionGridT : public UnifiedGuidedMatchingT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>
+{
+	public:
+
+		/// Definition of the base class.
+		using Base = UnifiedGuidedMatchingT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>;
+
+		/// Definition of a descriptor distance value.
+		using DistanceValue = UnifiedMatching::DistanceValue;
+
+		/// Definition of the distance data type.
+		using DescriptorDistance = typename Base::DescriptorDistance;
+
+		/// Definition of the descriptor for 2D image points.
+		using ImagePointDescriptor = typename Base::ImagePointDescriptor;
+
+		/// Definition of the descriptor for 3D object points.
+		using ObjectPointDescriptor = typename Base::ObjectPointDescriptor;
+
+		/**
+		 * Definition of an unordered map mapping object point ids to descriptors.
+		 */
+		template <typename TDescriptor>
+		using UnorderedDescriptorMap = typename Base::template UnorderedDescriptorMap<TDescriptor>;
+
+		/**
+		 * Definition of a vector holding pointers to object point descriptors.
+		 */
+		using ObjectPointDescriptorPointers = std::vector<const ObjectPointDescriptor*>;
+
+	protected:
+
+		/**
+		 * The maximal projection error between an image point and a projected object point so that both points are considered as candidates, in pixel.
+		 * The value is identical to the projection error applied in PoseEstimationT::determineGuidedMatchings().
+		 */
+		static constexpr Scalar maximalProjectionError_ = Scalar(20);
+
+	public:
+
+		/**
+		 * Creates a new matching object with 3D object points only.
+		 * Does not create a copy of the given input, an octree of the object points is not necessary.
+		 * @param objectPoints The 3D object points, can be nullptr if 'numberObjectPoints == 0'
+		 * @param numberObjectPoints The number of 3D object points, with range [0, infinity)
+		 * @param objectPointIds The ids of all 3D object points, must be valid
+		 * @param objectPointDescriptorMap The map mapping object point ids to their corresponding descriptors
+		 */
+		inline UnifiedGuidedMatchingProjectionGridT(const Vector3* objectPoints, const size_t numberObjectPoints, const Index32* objectPointIds, const UnorderedDescriptorMap<ObjectPointDescriptor>& objectPointDescriptorMap);
+
+		/**
+		 * Creates a new matching object with 2D image points and 3D object points.
+		 * Does not create a copy of the given input, an octree of the object points is not necessary.
+		 * @param imagePoints The 2D image points, can be nullptr if 'numberImagePoints == 0'
+		 * @param imagePointDescriptors The descriptors for the image points, one for each image point, can be nullptr if 'numberImagePoints == 0'
+		 * @param numberImagePoints the number of 2D image points, with range [0, infinity)
+		 * @param objectPoints The 3D object points, can be nullptr if 'numberObjectPoints == 0'
+		 * @param numberObjectPoints The number of 3D object points, with range [0, infinity)
+		 * @param objectPointIds The ids of all 3D object points, must be valid
+		 * @param objectPointDescriptorMap The map mapping object point ids to their corresponding descriptors
+		 */
+		inline UnifiedGuidedMatchingProjectionGridT(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Index32* objectPointIds, const UnorderedDescriptorMap<ObjectPointDescriptor>& objectPointDescriptorMap);
+
+		/**
+		 * Determines the guided matching between 2D and 3D feature points.
+		 * @see UnifiedGuidedMatching::determineGuidedMatchings().
+		 */
+		void determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices = nullptr, Indices32* matchedObjectPointIds = nullptr, Worker* worker = nullptr) const override;
+
+	protected:
+
+		/**
+		 * Projects a subset of all 3D object points into the camera.
+		 * @param anyCamera The camera profile defining the projection, must be valid
+		 * @param flippedCamera_T_world The inverted and flipped camera pose, must be valid
+		 * @param projectedObjectPoints The resulting projected object points, one for each object point
+		 * @param validObjectPoints The resulting validity statements, one for each object point, 1 if the object point is located in front of the camera and projects close to the camera's image area
+		 * @param firstObjectPoint The first object point to be handled
+		 * @param numberObjectPoints The number of object points to be handled
+		 */
+		void projectObjectPointsSubset(const AnyCamera* anyCamera, const HomogenousMatrix4* flippedCamera_T_world, Vector2* projectedObjectPoints, uint8_t* validObjectPoints, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints) const;
+
+		/**
+		 * Determines the guided matching for a subset of all image points.
+		 * @param projectedObjectPoints The projected object points located in the grid
+		 * @param projectedObjectPointIndices The indices of the object points, one for each projected object point
+		 * @param projectedObjectPointDescriptors The descriptors of the object points, one for each projected object point
+		 * @param distributionArray The grid holding the indices of the projected object points
+		 * @param matchedImagePoints The resulting matched 2D image points
+		 * @param matchedObjectPoints The resulting matched 3D object points
+		 * @param matchedImagePointIndices Optional resulting indices of the matched 2D image points, nullptr if not of interest
+		 * @param matchedObjectPointIds Optional resulting ids of the matched 3D object points, nullptr if not of interest
+		 * @param maximalDescriptorDistance The maximal descriptor distance so that two descriptors count as match
+		 * @param lock The lock object in case this function is executed across multiple threads, nullptr if executed in one thread
+		 * @param firstImagePoint The first image point to be handled
+		 * @param numberImagePoints The number of image points to be handled
+		 */
+		void determineGuidedMatchingsSubset(const Vector2* projectedObjectPoints, const Index32* projectedObjectPointIndices, const ObjectPointDescriptor* const* projectedObjectPointDescriptors, const Geometry::SpatialDistribution::DistributionArray* distributionArray, Vectors2* matchedImagePoints, Vectors3* matchedObjectPoints, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, const DescriptorDistance maximalDescriptorDistance, Lock* lock, const unsigned int firstImagePoint, const unsigned int numberImagePoints) const;
+
+		/**
+		 * Returns an empty octree which is handed to the base class, as the projection grid does not use an octree.
+		 * @return The empty octree
+		 */
+		static inline const Geometry::Octree& emptyOctree();
+};
+
+/**
+ * Definition of a UnifiedGuidedMatchingProjectionGridT object for FREAK descriptors with 256 bits.
+ * @ingroup trackingmapbuilding
+ */
+using UnifiedGuidedMatchingProjectionGridFreakMultiLevelDescriptor256 = UnifiedGuidedMatchingProjectionGridT<CV::Detector::FREAKDescriptor32, CV::Detector::FREAKDescriptors32>;
+
 /**
  * This class implements the unguided matching object for FREAK Multi features with 32 bytes or 256 bits.
  * @tparam TImagePointDescriptor The data type of the image point descriptors, e.g., a single-level or a multi-level descriptor binary/float descriptor
@@ -636,6 +790,66 @@ class UnifiedUnguidedMatchingFreakMultiFeatures256Group : public UnifiedUnguided
 		const BinaryVocabularyForest& forestObjectPointDescriptors_;
 };
 
+/**
+ * This class implements a guided matching object combining several guided matching objects for the same image points, e.g., one matching object for each tile of a tiled feature map.
+ * The correspondences of all matching objects are merged, the matching objects are applied in the given order and an image point or object point which has been matched already is not matched again.
+ * @ingroup trackingmapbuilding
+ */
+class UnifiedGuidedMatchingCombined : public UnifiedGuidedMatching
+{
+	public:
+
+		/**
+		 * Creates a new matching object combining several guided matching objects.
+		 * Does not create a copy of the given image points.
+		 * @param imagePoints The 2D image points of all matching objects, can be nullptr if 'numberImagePoints == 0'
+		 * @param numberImagePoints the number of 2D image points, with range [0, infinity)
+		 * @param unifiedGuidedMatchings The matching objects to combine, all based on the given image points, at least one
+		 */
+		UnifiedGuidedMatchingCombined(const Vector2* imagePoints, const size_t numberImagePoints, SharedUnifiedGuidedMatchings unifiedGuidedMatchings);
+
+		/**
+		 * Determines the guided matching between 2D and 3D feature points.
+		 * @see UnifiedGuidedMatching::determineGuidedMatchings().
+		 */
+		void determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices = nullptr, Indices32* matchedObjectPointIds = nullptr, Worker* worker = nullptr) const override;
+
+	protected:
+
+		/// The matching objects which are combined.
+		SharedUnifiedGuidedMatchings unifiedGuidedMatchings_;
+};
+
+/**
+ * This class implements an unguided matching object combining several unguided matching objects for the same image points, e.g., one matching object for each tile of a tiled feature map.
+ * The correspondences of all matching objects are merged so that the minimal number of correspondences can be reached even if each matching object provides a few correspondences only.
+ * @ingroup trackingmapbuilding
+ */
+class UnifiedUnguidedMatchingCombined : public UnifiedUnguidedMatching
+{
+	public:
+
+		/**
+		 * Creates a new matching object combining several unguided matching objects.
+		 * Does not create a copy of the given image points.
+		 * @param imagePoints The 2D image points of all matching objects, can be nullptr if 'numberImagePoints == 0'
+		 * @param numberImagePoints the number of 2D image points, with range [0, infinity)
+		 * @param unifiedUnguidedMatchings The matching objects to combine, all based on the given image points, at least one
+		 */
+		UnifiedUnguidedMatchingCombined(const Vector2* imagePoints, const size_t numberImagePoints, SharedUnifiedUnguidedMatchings unifiedUnguidedMatchings);
+
+		/**
+		 * Determines the unguided matching between 2D and 3D feature points.
+		 * @see UnifiedUnguidedMatching::determineUnguidedMatchings().
+		 */
+		bool determineUnguidedMatchings(const unsigned int minimalNumberCorrespondences, const DistanceValue& maximalDescriptorDistance, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, Worker* worker = nullptr) const override;
+
+	protected:
+
+		/// The matching objects which are combined.
+		SharedUnifiedUnguidedMatchings unifiedUnguidedMatchings_;
+};
+
 inline UnifiedMatching::DistanceValue::DistanceValue(const unsigned int binaryDistance) :
 	binaryDistance_(binaryDistance)
 {
@@ -710,7 +924,7 @@ inline size_t UnifiedMatching::numberImagePoints() const
 
 inline UnifiedGuidedMatching::UnifiedGuidedMatching(const Vector3* objectPoints, const size_t numberObjectPoints, const Geometry::Octree& objectPointOctree, const Index32* objectPointIds) :
 	UnifiedMatching(objectPoints, numberObjectPoints),
-	objectPointOctree_(objectPointOctree),
+	objectPointOctree_(&objectPointOctree),
 	objectPointIds_(objectPointIds)
 {
 	// nothing to do here
@@ -718,12 +932,18 @@ inline UnifiedGuidedMatching::UnifiedGuidedMatching(const Vector3* objectPoints,
 
 inline UnifiedGuidedMatching::UnifiedGuidedMatching(const Vector2* imagePoints, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Geometry::Octree& objectPointOctree, const Index32* objectPointIds) :
 	UnifiedMatching(imagePoints, numberImagePoints, objectPoints, numberObjectPoints),
-	objectPointOctree_(objectPointOctree),
+	objectPointOctree_(&objectPointOctree),
 	objectPointIds_(objectPointIds)
 {
 	// nothing to do here
 }
 
+inline UnifiedGuidedMatching::UnifiedGuidedMatching(const Vector2* imagePoints, const size_t numberImagePoints) :
+	UnifiedMatching(imagePoints, numberImagePoints, nullptr, 0)
+{
+	// nothing to do here
+}
+
 inline UnifiedUnguidedMatching::UnifiedUnguidedMatching(const Vector3* objectPoints, const size_t numberObjectPoints, const Index32* objectPointIndices) :
 	UnifiedMatching(objectPoints, numberObjectPoints),
 	objectPointIndices_(objectPointIndices)
@@ -738,6 +958,12 @@ inline UnifiedUnguidedMatching::UnifiedUnguidedMatching(const Vector2* imagePoin
 	// nothing to do here
 }
 
+inline UnifiedUnguidedMatching::UnifiedUnguidedMatching(const Vector2* imagePoints, const size_t numberImagePoints) :
+	UnifiedMatching(imagePoints, numberImagePoints, nullptr, 0)
+{
+	// nothing to do here
+}
+
 template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
 inline UnifiedGuidedMatchingT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::UnifiedGuidedMatchingT(const Vector3* objectPoints, const size_t numberObjectPoints, const Geometry::Octree& objectPointOctree, const Index32* objectPointIds, const UnorderedDescriptorMap<ObjectPointDescriptor>& objectPointDescriptorMap) :
 	UnifiedGuidedMatching(objectPoints, numberObjectPoints, objectPointOctree, objectPointIds),
@@ -774,7 +1000,236 @@ inline void UnifiedGuidedMatchingT<TImagePointDescriptor, TObjectPointDescriptor
 template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
 void UnifiedGuidedMatchingT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Worker* worker) const
 {
-	PoseEstimationT::determineGuidedMatchings<ImagePointDescriptor, ObjectPointDescriptor, DescriptorDistance, UnifiedDescriptorT<TImagePointDescriptor>::determineDistance>(anyCamera, world_T_camera, imagePoints_, imagePointDescriptors_, numberImagePoints_, objectPoints_, objectPointOctree_, objectPointIds_, objectPointDescriptorMap_, matchedImagePoints, matchedObjectPoints, maximalDescriptorDistance.distance<TDistance>(), matchedImagePointIndices, matchedObjectPointIds, worker);
+	PoseEstimationT::determineGuidedMatchings<ImagePointDescriptor, ObjectPointDescriptor, DescriptorDistance, UnifiedDescriptorT<TImagePointDescriptor>::determineDistance>(anyCamera, world_T_camera, imagePoints_, imagePointDescriptors_, numberImagePoints_, objectPoints_, *objectPointOctree_, objectPointIds_, objectPointDescriptorMap_, matchedImagePoints, matchedObjectPoints, maximalDescriptorDistance.distance<TDistance>(), matchedImagePointIndices, matchedObjectPointIds, worker);
+}
+
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
+inline UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::UnifiedGuidedMatchingProjectionGridT(const Vector3* objectPoints, const size_t numberObjectPoints, const Index32* objectPointIds, const UnorderedDescriptorMap<ObjectPointDescriptor>& objectPointDescriptorMap) :
+	Base(objectPoints, numberObjectPoints, emptyOctree(), objectPointIds, objectPointDescriptorMap)
+{
+	// nothing to do here
+}
+
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
+inline UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::UnifiedGuidedMatchingProjectionGridT(const Vector2* imagePoints, const ImagePointDescriptor* imagePointDescriptors, const size_t numberImagePoints, const Vector3* objectPoints, const size_t numberObjectPoints, const Index32* objectPointIds, const UnorderedDescriptorMap<ObjectPointDescriptor>& objectPointDescriptorMap) :
+	Base(imagePoints, imagePointDescriptors, numberImagePoints, objectPoints, numberObjectPoints, emptyOctree(), objectPointIds, objectPointDescriptorMap)
+{
+	// nothing to do here
+}
+
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
+void UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::determineGuidedMatchings(const AnyCamera& anyCamera, const HomogenousMatrix4& world_T_camera, Vectors2& matchedImagePoints, Vectors3& matchedObjectPoints, const DistanceValue& maximalDescriptorDistance, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, Worker* worker) const
+{
+	ocean_assert(anyCamera.isValid() && world_T_camera.isValid());
+
+	ocean_assert(matchedImagePoints.empty());
+	ocean_assert(matchedObjectPoints.empty());
+
+	if (matchedObjectPointIds != nullptr)
+	{
+		matchedObjectPointIds->clear();
+	}
+
+	if (matchedImagePointIndices != nullptr)
+	{
+		matchedImagePointIndices->clear();
+	}
+
+	if (this->imagePoints_ == nullptr || this->imagePointDescriptors_ == nullptr || this->numberImagePoints_ == 0 || this->numberObjectPoints_ == 0)
+	{
+		return;
+	}
+
+	ocean_assert(this->objectPoints_ != nullptr && this->objectPointIds_ != nullptr);
+
+	const HomogenousMatrix4 flippedCamera_T_world(Camera::standard2InvertedFlipped(world_T_camera));
+
+	// first, we project all object points once
+
+	Vectors2 projectedObjectPoints(this->numberObjectPoints_);
+	std::vector<uint8_t> validObjectPoints(this->numberObjectPoints_);
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::projectObjectPointsSubset, &anyCamera, &flippedCamera_T_world, projectedObjectPoints.data(), validObjectPoints.data(), 0u, 0u), 0u, (unsigned int)(this->numberObjectPoints_), 4u, 5u, 1000u);
+	}
+	else
+	{
+		projectObjectPointsSubset(&anyCamera, &flippedCamera_T_world, projectedObjectPoints.data(), validObjectPoints.data(), 0u, (unsigned int)(this->numberObjectPoints_));
+	}
+
+	// now, we gather the visible object points and look up their descriptors
+
+	Vectors2 visibleObjectPoints;
+	Indices32 visibleObjectPointIndices;
+	ObjectPointDescriptorPointers visibleObjectPointDescriptors;
+
+	visibleObjectPoints.reserve(this->numberObjectPoints_);
+	visibleObjectPointIndices.reserve(this->numberObjectPoints_);
+	visibleObjectPointDescriptors.reserve(this->numberObjectPoints_);
+
+	for (size_t nObjectPoint = 0; nObjectPoint < this->numberObjectPoints_; ++nObjectPoint)
+	{
+		if (validObjectPoints[nObjectPoint] != 0u)
+		{
+			const typename UnorderedDescriptorMap<ObjectPointDescriptor>::const_iterator iObjectPointDescriptor = this->objectPointDescriptorMap_.find(this->objectPointIds_[nObjectPoint]);
+			ocean_assert(iObjectPointDescriptor != this->objectPointDescriptorMap_.cend());
+
+			if (iObjectPointDescriptor != this->objectPointDescriptorMap_.cend())
+			{
+				visibleObjectPoints.emplace_back(projectedObjectPoints[nObjectPoint]);
+				visibleObjectPointIndices.emplace_back(Index32(nObjectPoint));
+				visibleObjectPointDescriptors.emplace_back(&iObjectPointDescriptor->second);
+			}
+		}
+	}
+
+	if (visibleObjectPoints.empty())
+	{
+		return;
+	}
+
+	// the size of each bin matches the maximal projection error, so that the 3x3 neighborhood of a bin covers all candidates of an image point
+
+	const Scalar gridWidth = Scalar(anyCamera.width()) + maximalProjectionError_ * Scalar(2);
+	const Scalar gridHeight = Scalar(anyCamera.height()) + maximalProjectionError_ * Scalar(2);
+
+	const unsigned int horizontalBins = std::max(1u, (unsigned int)(gridWidth / maximalProjectionError_));
+	const unsigned int verticalBins = std::max(1u, (unsigned int)(gridHeight / maximalProjectionError_));
+
+	const Geometry::SpatialDistribution::DistributionArray distributionArray(Geometry::SpatialDistribution::distributeToArray(visibleObjectPoints.data(), visibleObjectPoints.size(), -maximalProjectionError_, -maximalProjectionError_, gridWidth, gridHeight, horizontalBins, verticalBins));
+
+	const DescriptorDistance maximalDistance = maximalDescriptorDistance.distance<TDistance>();
+
+	const Vector2* const visibleObjectPointsData = visibleObjectPoints.data();
+	const Index32* const visibleObjectPointIndicesData = visibleObjectPointIndices.data();
+	const ObjectPointDescriptor* const* const visibleObjectPointDescriptorsData = visibleObjectPointDescriptors.data();
+
+	if (worker != nullptr)
+	{
+		Lock lock;
+		worker->executeFunction(Worker::Function::create(*this, &UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::determineGuidedMatchingsSubset, visibleObjectPointsData, visibleObjectPointIndicesData, visibleObjectPointDescriptorsData, &distributionArray, &matchedImagePoints, &matchedObjectPoints, matchedImagePointIndices, matchedObjectPointIds, maximalDistance, &lock, 0u, 0u), 0u, (unsigned int)(this->numberImagePoints_));
+	}
+	else
+	{
+		determineGuidedMatchingsSubset(visibleObjectPointsData, visibleObjectPointIndicesData, visibleObjectPointDescriptorsData, &distributionArray, &matchedImagePoints, &matchedObjectPoints, matchedImagePointIndices, matchedObjectPointIds, maximalDistance, nullptr, 0u, (unsigned int)(this->numberImagePoints_));
+	}
+}
+
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
+void UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::projectObjectPointsSubset(const AnyCamera* anyCamera, const HomogenousMatrix4* flippedCamera_T_world, Vector2* projectedObjectPoints, uint8_t* validObjectPoints, const unsigned int firstObjectPoint, const unsigned int numberObjectPoints) const
+{
+	ocean_assert(anyCamera != nullptr && anyCamera->isValid());
+	ocean_assert(flippedCamera_T_world != nullptr && flippedCamera_T_world->isValid());
+	ocean_assert(projectedObjectPoints != nullptr && validObjectPoints != nullptr);
+	ocean_assert(firstObjectPoint + numberObjectPoints <= this->numberObjectPoints_);
+
+	anyCamera->projectToImageIF(*flippedCamera_T_world, this->objectPoints_ + firstObjectPoint, size_t(numberObjectPoints), projectedObjectPoints + firstObjectPoint);
+
+	for (unsigned int nObjectPoint = firstObjectPoint; nObjectPoint < firstObjectPoint + numberObjectPoints; ++nObjectPoint)
+	{
+		validObjectPoints[nObjectPoint] = (Camera::isObjectPointInFrontIF(*flippedCamera_T_world, this->objectPoints_[nObjectPoint]) && anyCamera->isInside(projectedObjectPoints[nObjectPoint], -maximalProjectionError_)) ? 1u : 0u;
+	}
+}
+
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
+void UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::determineGuidedMatchingsSubset(const Vector2* projectedObjectPoints, const Index32* projectedObjectPointIndices, const ObjectPointDescriptor* const* projectedObjectPointDescriptors, const Geometry::SpatialDistribution::DistributionArray* distributionArray, Vectors2* matchedImagePoints, Vectors3* matchedObjectPoints, Indices32* matchedImagePointIndices, Indices32* matchedObjectPointIds, const DescriptorDistance maximalDescriptorDistance, Lock* lock, const unsigned int firstImagePoint, const unsigned int numberImagePoints) const
+{
+	ocean_assert(projectedObjectPoints != nullptr && projectedObjectPointIndices != nullptr && projectedObjectPointDescriptors != nullptr);
+	ocean_assert(distributionArray != nullptr && distributionArray->isValid());
+	ocean_assert(matchedImagePoints != nullptr && matchedObjectPoints != nullptr);
+
+	Vectors2 localMatchedImagePoints;
+	Vectors3 localMatchedObjectPoints;
+	Indices32 localMatchedImagePointIndices;
+	Indices32 localMatchedObjectPointIds;
+
+	localMatchedImagePoints.reserve(numberImagePoints);
+	localMatchedObjectPoints.reserve(numberImagePoints);
+	localMatchedImagePointIndices.reserve(numberImagePoints);
+	localMatchedObjectPointIds.reserve(numberImagePoints);
+
+	constexpr Scalar sqrMaximalProjectionError = maximalProjectionError_ * maximalProjectionError_;
+
+	Indices32 candidates;
+	candidates.reserve(64);
+
+	for (unsigned int nImagePoint = firstImagePoint; nImagePoint < firstImagePoint + numberImagePoints; ++nImagePoint)
+	{
+		const Vector2& imagePoint = this->imagePoints_[nImagePoint];
+		const ImagePointDescriptor& imagePointDescriptor = this->imagePointDescriptors_[nImagePoint];
+
+		const int xBinCenter = distributionArray->clampedHorizontalBin(imagePoint.x());
+		const int yBinCenter = distributionArray->clampedVerticalBin(imagePoint.y());
+
+		// first, we gather all candidates, afterwards we determine the descriptor distances in one loop
+
+		candidates.clear();
+
+		for (int yBin = std::max(0, yBinCenter - 1); yBin <= std::min(yBinCenter + 1, int(distributionArray->verticalBins()) - 1); ++yBin)
+		{
+			for (int xBin = std::max(0, xBinCenter - 1); xBin <= std::min(xBinCenter + 1, int(distributionArray->horizontalBins()) - 1); ++xBin)
+			{
+				for (const Index32& projectedIndex : (*distributionArray)(xBin, yBin))
+				{
+					if (projectedObjectPoints[projectedIndex].sqrDistance(imagePoint) <= sqrMaximalProjectionError)
+					{
+						candidates.emplace_back(projectedIndex);
+					}
+				}
+			}
+		}
+
+		TDistance bestDistance = NumericT<TDistance>::maxValue();
+		Index32 bestProjectedIndex = Index32(-1);
+
+		for (const Index32& projectedIndex : candidates)
+		{
+			const TDistance distance = UnifiedDescriptorT<TImagePointDescriptor>::determineDistance(imagePointDescriptor, *projectedObjectPointDescriptors[projectedIndex]);
+
+			if (distance < bestDistance)
+			{
+				bestDistance = distance;
+				bestProjectedIndex = projectedIndex;
+			}
+		}
+
+		if (bestDistance <= maximalDescriptorDistance)
+		{
+			ocean_assert(bestProjectedIndex != Index32(-1));
+
+			const Index32 objectPointIndex = projectedObjectPointIndices[bestProjectedIndex];
+
+			localMatchedImagePoints.emplace_back(imagePoint);
+			localMatchedObjectPoints.emplace_back(this->objectPoints_[objectPointIndex]);
+
+			localMatchedImagePointIndices.emplace_back(nImagePoint);
+			localMatchedObjectPointIds.emplace_back(this->objectPointIds_[objectPointIndex]);
+		}
+	}
+
+	const OptionalScopedLock scopedLock(lock);
+
+	matchedImagePoints->insert(matchedImagePoints->cend(), localMatchedImagePoints.cbegin(), localMatchedImagePoints.cend());
+	matchedObjectPoints->insert(matchedObjectPoints->cend(), localMatchedObjectPoints.cbegin(), localMatchedObjectPoints.cend());
+
+	if (matchedImagePointIndices != nullptr)
+	{
+		matchedImagePointIndices->insert(matchedImagePointIndices->cend(), localMatchedImagePointIndices.cbegin(), localMatchedImagePointIndices.cend());
+	}
+
+	if (matchedObjectPointIds != nullptr)
+	{
+		matchedObjectPointIds->insert(matchedObjectPointIds->cend(), localMatchedObjectPointIds.cbegin(), localMatchedObjectPointIds.cend());
+	}
+}
+
+template <typename TImagePointDescriptor, typename TObjectPointDescriptor, typename TDistance>
+inline const Geometry::Octree& UnifiedGuidedMatchingProjectionGridT<TImagePointDescriptor, TObjectPointDescriptor, TDistance>::emptyOctree()
+{
+	static const Geometry::Octree octree{};
+
+	return octree;
 }
 
 template <typename TImagePointDescriptor, typename TObjectPointVocabularyDescriptor, typename TDistance>
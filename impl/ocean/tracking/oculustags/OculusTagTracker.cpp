@@ -16,6 +16,8 @@
 #include "ocean/geometry/NonLinearOptimizationTransformation.h"
 #include "ocean/geometry/RANSAC.h"
 
+#include "ocean/math/Box2.h"
+
 #include "ocean/tracking/oculustags/OculusTagDebugElements.h"
 #include "ocean/tracking/oculustags/Utilities.h"
 
@@ -127,7 +129,8 @@ bool OculusTagTracker::TagObservationHistory::optimizePose(const AnyCamera& anyC
 }
 
 OculusTagTracker::OculusTagTracker() :
-	frameCounter_(0u)
+	frameCounter_(0u),
+	detectionScanIndex_(0u)
 {
 	// Nothing else todo
 }
@@ -147,6 +150,7 @@ OculusTagTracker& OculusTagTracker::operator=(OculusTagTracker&& otherTracker)
 	if (this != &otherTracker)
 	{
 		frameCounter_ = otherTracker.frameCounter_;
+		detectionScanIndex_ = otherTracker.detectionScanIndex_;
 		trackedTagMap_ = std::move(otherTracker.trackedTagMap_);
 
 		previous_world_T_device_ = otherTracker.previous_world_T_device_;
@@ -168,6 +172,8 @@ bool OculusTagTracker::trackTagsStereo(const AnyCamera& anyCameraA, const AnyCam
 	static_assert(numberRequiredObservationForStatic_ != 0u, "Minimum number of required observation must be in range: [1, infinity)");
 	static_assert(numberMaxAllowedObservations_ != 0u, "Maximum number of observations per tag must be in range: [1, infinity)");
 	static_assert(detectionCadence_ != 0u, "Detection refresh interval must be in range: [1, infinity)");
+	static_assert(numberDetectionBands_ != 0u, "Number of detection bands must be in range: [1, infinity)");
+	static_assert(maximalRegionOfInterestLayers_ != 0u && maximalRegionOfInterestLayers_ <= numberFrameLayers_, "Number of region of interest layers must be in range: [1, numberFrameLayers_]");
 	static_assert(maxAllowedProjectionError_ >= 0, "Maximum projection error for tag observation must be in range: [0, infinity)");
 	static_assert(numberFrameLayers_ != 0u, "Number of frame pyramid layers must be in range: [1, infinity)");
 
@@ -211,10 +217,8 @@ bool OculusTagTracker::trackTagsStereo(const AnyCamera& anyCameraA, const AnyCam
 		TrackedTag& trackedTag = trackedTagIter.second;
 		ocean_assert(trackedTagIter.first == trackedTag.tag_.tagID());
 
-		if (trackedTag.trackingState_ != TS_TRACKING && trackedTag.trackingState_ != TS_NEW_DETECTION)
-		{
-			continue;
-		}
+		// Tags which are not tracked anymore cannot be tracked from the previous frame, but they can still be re-detected around their predicted location
+		const bool wasTagTracked = trackedTag.trackingState_ == TS_TRACKING || trackedTag.trackingState_ == TS_NEW_DETECTION;
 
 		bool isTagTracked[2] = { false, false };
 
@@ -241,7 +245,9 @@ bool OculusTagTracker::trackTagsStereo(const AnyCamera& anyCameraA, const AnyCam
 
 			Vectors2& trackedCorners = trackedCornerGroups[cameraIndex];
 
-			if (!tagObservationHistory.empty() && isTagVisible(*anyCamera, trackedTag.tag_.world_T_tag().inverted() * world_T_device * device_T_camera, trackedTag.tag_.tagSize(), frameBorder_))
+			bool hasQuad = false;
+
+			if (wasTagTracked && !tagObservationHistory.empty() && isTagVisible(*anyCamera, trackedTag.tag_.world_T_tag().inverted() * world_T_device * device_T_camera, trackedTag.tag_.tagSize(), frameBorder_))
 			{
 				const Vectors2& trackingImagePoints = tagObservationHistory.latestTrackingImagePoints();
 				const Vectors3& trackingObjectPoints = tagObservationHistory.latestTrackingObjectPoints();
@@ -267,21 +273,30 @@ bool OculusTagTracker::trackTagsStereo(const AnyCamera& anyCameraA, const AnyCam
 
 					if (haveInitialQuad)
 					{
-						if (readTag(*anyCamera, yFrame, initialQuad, world_T_device, device_T_camera, trackedTag.tag_.tagSize(), tag, quad, TagSizeMap()))
-						{
-							TagObservationHistory newTagObservationHistory;
-							if (addTagObservationAndOptimize(*anyCamera, yFrame, world_T_device, device_T_camera, tag, quad, newTagObservationHistory))
-							{
-								const size_t removedObservations = tagObservationHistory.removeObservations(*anyCamera, tag.world_T_tag().inverted(), maxAllowedProjectionError_);
-								OCEAN_SUPPRESS_UNUSED_WARNING(removedObservations);
+						hasQuad = readTag(*anyCamera, yFrame, initialQuad, world_T_device, device_T_camera, trackedTag.tag_.tagSize(), tag, quad, TagSizeMap());
+					}
+				}
+			}
+
+			if (!hasQuad)
+			{
+				// The tag could not be tracked from the previous frame, so we try to detect it in a small region around its predicted location
 
-								tagObservationHistory.append(newTagObservationHistory);
+				hasQuad = detectTagInRegion(*anyCamera, framePyramid, world_T_device, device_T_camera, trackedTag.tag_, tag, quad);
+			}
 
-								isTagTracked[cameraIndex] = true;
-								ocean_assert(tagObservationHistory.size() != 0);
-							}
-						}
-					}
+			if (hasQuad)
+			{
+				TagObservationHistory newTagObservationHistory;
+				if (addTagObservationAndOptimize(*anyCamera, yFrame, world_T_device, device_T_camera, tag, quad, newTagObservationHistory))
+				{
+					const size_t removedObservations = tagObservationHistory.removeObservations(*anyCamera, tag.world_T_tag().inverted(), maxAllowedProjectionError_);
+					OCEAN_SUPPRESS_UNUSED_WARNING(removedObservations);
+
+					tagObservationHistory.append(newTagObservationHistory);
+
+					isTagTracked[cameraIndex] = true;
+					ocean_assert(tagObservationHistory.size() != 0);
 				}
 			}
 		}
@@ -326,11 +341,37 @@ bool OculusTagTracker::trackTagsStereo(const AnyCamera& anyCameraA, const AnyCam
 	}
 
 
-	// Detection
+	// Detection, while tags are visible the full-frame detection is amortized over several frames so that each detection iteration scans only a part of the frames,
+	// as long as no tag is visible each frame is scanned entirely on the finest layer so that new tags are acquired without additional latency
+
+	constexpr unsigned int numberDetectionScans = numberDetectionBands_ + 1u;
+	constexpr unsigned int detectionScanCadence = std::max(1u, detectionCadence_ / numberDetectionScans);
 
-	if (visibleTagsIndices.empty() || frameCounter_ % detectionCadence_ == 0u)
+	const bool scanEntireFrame = visibleTagsIndices.empty();
+
+	if (scanEntireFrame || frameCounter_ % detectionScanCadence == 0u)
 	{
-		TrackedTags detectedTags = detectTagsStereo(anyCameras, yFrames, world_T_device, device_T_cameras);
+		QuadDetector::Quads candidateQuadGroups[2];
+
+		for (size_t cameraIndex = 0; cameraIndex < 2; ++cameraIndex)
+		{
+			CV::PixelBoundingBox regionOfInterest(0u, 0u, yFrames[cameraIndex].width() - 1u, yFrames[cameraIndex].height() - 1u);
+			unsigned int layerIndex = 0u;
+
+			if (!scanEntireFrame)
+			{
+				determineDetectionScan(yFrames[cameraIndex].width(), yFrames[cameraIndex].height(), detectionScanIndex_, regionOfInterest, layerIndex);
+			}
+
+			candidateQuadGroups[cameraIndex] = detectQuadsInRegion(framePyramids[cameraIndex], regionOfInterest, std::min(layerIndex, framePyramids[cameraIndex].layers() - 1u));
+		}
+
+		if (!scanEntireFrame)
+		{
+			detectionScanIndex_ = (detectionScanIndex_ + 1u) % numberDetectionScans;
+		}
+
+		TrackedTags detectedTags = detectTagsStereo(anyCameras, yFrames, candidateQuadGroups, world_T_device, device_T_cameras);
 
 		for (size_t t = 0; t < detectedTags.size(); ++t)
 		{
@@ -541,11 +582,21 @@ OculusTags OculusTagTracker::detectTagsMono(const AnyCamera& anyCamera, const Fr
 	ocean_assert(device_T_camera.isNull() == false);
 	ocean_assert(defaultTagSize > 0);
 
+	return readTags(anyCamera, yFrame, QuadDetector::detectQuads(yFrame, frameBorder_), world_T_device, device_T_camera, defaultTagSize, tagSizeMap, tagObservationHistories);
+}
+
+OculusTags OculusTagTracker::readTags(const AnyCamera& anyCamera, const Frame& yFrame, const QuadDetector::Quads& candidateQuads, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar defaultTagSize, const TagSizeMap& tagSizeMap, TagObservationHistories* tagObservationHistories)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, 1u>()));
+	ocean_assert(yFrame.width() == anyCamera.width() && yFrame.height() == anyCamera.height());
+	ocean_assert(world_T_device.isNull() == false);
+	ocean_assert(device_T_camera.isNull() == false);
+	ocean_assert(defaultTagSize > 0);
+
 	OculusTags tags;
 	TagObservationHistories localTagObservationHistories;
 
-	const QuadDetector::Quads candidateQuads = QuadDetector::detectQuads(yFrame, frameBorder_);
-
 	for (const QuadDetector::Quad& candidateQuad : candidateQuads)
 	{
 		QuadDetector::Quad quad;
@@ -909,11 +960,12 @@ bool OculusTagTracker::trackTagCornersTemporally(const AnyCamera& anyCamera, con
 	return CV::Advanced::AdvancedMotionZeroMeanSSD::trackPointsSubPixelMirroredBorder<1u, 7u>(previousFramePyramid, framePyramid, previousImagePoints, predictedImagePoints, imagePoints, /* coarsestLayerRadius */ 2u);
 }
 
-OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames,  const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras)
+OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames, const QuadDetector::Quads* candidateQuadGroups, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras)
 {
 	ocean_assert(anyCameras.size() >= 2);
 	ocean_assert(anyCameras.size() == yFrames.size());
 	ocean_assert(anyCameras.size() == device_T_cameras.size());
+	ocean_assert(candidateQuadGroups != nullptr);
 
 #ifdef OCEAN_DEBUG
 	for (size_t iCamera = 0; iCamera < 2; ++iCamera)
@@ -937,7 +989,7 @@ OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAny
 	OculusTags tagGroups[2];
 	for (size_t cameraIndex : {0, 1})
 	{
-		tagGroups[cameraIndex] = OculusTagTracker::detectTagsMono(*anyCameras[cameraIndex], yFrames[cameraIndex], world_T_device, device_T_cameras[cameraIndex], dummyTagSize, TagSizeMap(), &observationHistoryGroups[cameraIndex]);
+		tagGroups[cameraIndex] = OculusTagTracker::readTags(*anyCameras[cameraIndex], yFrames[cameraIndex], candidateQuadGroups[cameraIndex], world_T_device, device_T_cameras[cameraIndex], dummyTagSize, TagSizeMap(), &observationHistoryGroups[cameraIndex]);
 		ocean_assert(tagGroups[cameraIndex].size() == observationHistoryGroups[cameraIndex].size());
 	};
 
@@ -1090,6 +1142,190 @@ OculusTagTracker::TrackedTags OculusTagTracker::detectTagsStereo(const SharedAny
 	return newTags;
 }
 
+bool OculusTagTracker::detectTagInRegion(const AnyCamera& anyCamera, const CV::FramePyramid& framePyramid, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const OculusTag& predictedTag, OculusTag& tag, QuadDetector::Quad& quad)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(framePyramid.isValid());
+	ocean_assert(framePyramid.finestWidth() == anyCamera.width() && framePyramid.finestHeight() == anyCamera.height());
+	ocean_assert(world_T_device.isValid() && device_T_camera.isValid());
+	ocean_assert(predictedTag.isValid());
+
+	const Frame& yFrame = framePyramid.finestLayer();
+
+	// Predict the location of the tag in the current frame, the tag must be entirely visible
+
+	const HomogenousMatrix4 flippedCamera_T_tag = AnyCamera::standard2InvertedFlipped(predictedTag.world_T_tag().inverted() * world_T_device * device_T_camera);
+
+	const Vectors3 tagObjectCorners = getTagObjectPoints(TPG_CORNERS_0_TO_3, predictedTag.tagSize());
+	ocean_assert(tagObjectCorners.size() == 4);
+
+	Vectors2 predictedImageCorners;
+	predictedImageCorners.reserve(tagObjectCorners.size());
+
+	for (const Vector3& tagObjectCorner : tagObjectCorners)
+	{
+		const Vector3 flippedCameraObjectCorner = flippedCamera_T_tag * tagObjectCorner;
+
+		if (flippedCameraObjectCorner.z() <= Numeric::eps())
+		{
+			return false;
+		}
+
+		predictedImageCorners.emplace_back(anyCamera.projectToImageIF(flippedCameraObjectCorner));
+
+		if (anyCamera.isInside(predictedImageCorners.back(), Scalar(frameBorder_)) == false)
+		{
+			return false;
+		}
+	}
+
+	Scalar minimalEdgeLength = Numeric::maxValue();
+	Box2 predictedBoundingBox;
+
+	for (size_t i = 0; i < predictedImageCorners.size(); ++i)
+	{
+		minimalEdgeLength = std::min(minimalEdgeLength, predictedImageCorners[i].distance(predictedImageCorners[(i + 1) % predictedImageCorners.size()]));
+		predictedBoundingBox += predictedImageCorners[i];
+	}
+
+	if (minimalEdgeLength < Scalar(OculusTag::numberOfModules))
+	{
+		return false;
+	}
+
+	// The region of interest covers the predicted location with a margin for the motion of the tag
+
+	const Scalar margin = std::max(minimalEdgeLength * regionOfInterestMarginFactor_, Scalar(OculusTag::numberOfModules));
+
+	const unsigned int left = (unsigned int)(std::max(0, int(Numeric::floor(predictedBoundingBox.lower().x() - margin))));
+	const unsigned int top = (unsigned int)(std::max(0, int(Numeric::floor(predictedBoundingBox.lower().y() - margin))));
+	const unsigned int right = (unsigned int)(std::min(int(yFrame.width()) - 1, int(Numeric::ceil(predictedBoundingBox.higher().x() + margin))));
+	const unsigned int bottom = (unsigned int)(std::min(int(yFrame.height()) - 1, int(Numeric::ceil(predictedBoundingBox.higher().y() + margin))));
+
+	const CV::PixelBoundingBox regionOfInterest(left, top, right, bottom);
+	ocean_assert(regionOfInterest.isValid());
+
+	// The coarsest pyramid layer on which the tag is still large enough is used for the detection
+
+	const unsigned int maximalLayers = std::min(framePyramid.layers(), maximalRegionOfInterestLayers_);
+
+	unsigned int layerIndex = 0u;
+
+	while (layerIndex + 1u < maximalLayers && minimalEdgeLength >= minimalRegionOfInterestTagEdgeLength_ * Scalar(1u << (layerIndex + 1u)))
+	{
+		++layerIndex;
+	}
+
+	const QuadDetector::Quads candidateQuads = detectQuadsInRegion(framePyramid, regionOfInterest, layerIndex);
+
+	for (const QuadDetector::Quad& candidateQuad : candidateQuads)
+	{
+		OculusTag candidateTag;
+		QuadDetector::Quad orientedQuad;
+
+		if (readTag(anyCamera, yFrame, candidateQuad, world_T_device, device_T_camera, predictedTag.tagSize(), candidateTag, orientedQuad, TagSizeMap()))
+		{
+			if (candidateTag.tagID() == predictedTag.tagID() && candidateTag.reflectanceType() == predictedTag.reflectanceType())
+			{
+				tag = std::move(candidateTag);
+				quad = orientedQuad;
+
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+QuadDetector::Quads OculusTagTracker::detectQuadsInRegion(const CV::FramePyramid& framePyramid, const CV::PixelBoundingBox& regionOfInterest, const unsigned int layerIndex)
+{
+	ocean_assert(framePyramid.isValid());
+	ocean_assert(regionOfInterest.isValid());
+	ocean_assert(layerIndex < framePyramid.layers());
+
+	const Frame& yLayerFrame = framePyramid.layer(layerIndex);
+
+	const unsigned int layerFactor = 1u << layerIndex;
+
+	// The frame border is defined in the finest layer
+	const uint32_t layerFrameBorder = (frameBorder_ + layerFactor - 1u) / layerFactor;
+
+	if (yLayerFrame.width() <= 2u * layerFrameBorder || yLayerFrame.height() <= 2u * layerFrameBorder)
+	{
+		return QuadDetector::Quads();
+	}
+
+	QuadDetector::Quads quads = QuadDetector::detectQuads(yLayerFrame, regionOfInterest / layerFactor, layerFrameBorder);
+
+	if (layerIndex == 0u)
+	{
+		return quads;
+	}
+
+	// The corners of quads detected on a coarser layer are propagated to the finest layer, on each layer the corners are refined
+
+	QuadDetector::Quads refinedQuads;
+	refinedQuads.reserve(quads.size());
+
+	for (const QuadDetector::Quad& quad : quads)
+	{
+		QuadDetector::Quad refinedQuad = quad;
+		bool refinementSucceeded = true;
+
+		for (int finerLayerIndex = int(layerIndex) - 1; refinementSucceeded && finerLayerIndex >= 0; --finerLayerIndex)
+		{
+			const Frame& yFinerLayerFrame = framePyramid.layer((unsigned int)(finerLayerIndex));
+
+			for (Vector2& corner : refinedQuad)
+			{
+				corner = corner * Scalar(2) + Vector2(Scalar(0.5), Scalar(0.5));
+
+				if (Utilities::refineCorner(yFinerLayerFrame, corner, 3u) == false)
+				{
+					refinementSucceeded = false;
+					break;
+				}
+			}
+		}
+
+		if (refinementSucceeded)
+		{
+			refinedQuads.emplace_back(refinedQuad);
+		}
+	}
+
+	return refinedQuads;
+}
+
+void OculusTagTracker::determineDetectionScan(const unsigned int width, const unsigned int height, const unsigned int scanIndex, CV::PixelBoundingBox& regionOfInterest, unsigned int& layerIndex)
+{
+	ocean_assert(width >= 1u && height >= numberDetectionBands_ + 1u);
+	ocean_assert(scanIndex <= numberDetectionBands_);
+
+	if (scanIndex >= numberDetectionBands_)
+	{
+		// The last scan covers the entire frame on a coarser layer
+
+		regionOfInterest = CV::PixelBoundingBox(0u, 0u, width - 1u, height - 1u);
+		layerIndex = detectionCoarseLayerIndex_;
+
+		return;
+	}
+
+	// Each band covers two consecutive slices so that neighboring bands overlap by one slice, tags with a height of up to one slice are entirely visible in at least one band
+
+	const unsigned int sliceHeight = height / (numberDetectionBands_ + 1u);
+	ocean_assert(sliceHeight >= 1u);
+
+	const unsigned int top = scanIndex * sliceHeight;
+	const unsigned int bottom = scanIndex + 1u == numberDetectionBands_ ? height - 1u : top + 2u * sliceHeight - 1u;
+	ocean_assert(top <= bottom && bottom < height);
+
+	regionOfInterest = CV::PixelBoundingBox(0u, top, width - 1u, bottom);
+	layerIndex = 0u;
+}
+
 bool OculusTagTracker::readTag(const AnyCamera& anyCamera, const Frame& yFrame, const QuadDetector::Quad& unorientedQuad, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar tagSize, OculusTag& tag, QuadDetector::Quad& quad, const TagSizeMap& tagSizeMap)
 {
 	ocean_assert(anyCamera.isValid());
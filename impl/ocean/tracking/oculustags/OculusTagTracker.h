@@ -14,6 +14,7 @@
 #include "ocean/base/Frame.h"
 
 #include "ocean/cv/FramePyramid.h"
+#include "ocean/cv/PixelBoundingBox.h"
 
 #include "ocean/math/AnyCamera.h"
 
@@ -497,11 +498,63 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		 * Detects Oculus Tags in stereo images.
 		 * @param anyCameras The camera models that correspond to the input images, must have two valid elements
 		 * @param yFrames The 8-bit grayscale images in which the tags will be detected, must have two valid elements
+		 * @param candidateQuadGroups The candidate quads that have been detected in each of the two images, must have two elements
 		 * @param world_T_device The world pose of the device, must be valid
 		 * @param device_T_cameras The device poses of the all cameras, must have two valid elements
 		 * @return The detected tags.
 		 */
-		static TrackedTags detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras);
+		static TrackedTags detectTagsStereo(const SharedAnyCameras& anyCameras, const Frames& yFrames, const QuadDetector::Quads* candidateQuadGroups, const HomogenousMatrix4& world_T_device, const HomogenousMatrices4& device_T_cameras);
+
+		/**
+		 * Reads tags from a set of candidate quads in a grayscale frame
+		 * @param anyCamera The camera with which the input image has been recorded, must be valid
+		 * @param yFrame The input image from which the tags will be read, must be valid
+		 * @param candidateQuads The candidate quads that have been detected in the input image
+		 * @param world_T_device The transformation that converts device points to world points, must be valid
+		 * @param device_T_camera The transformation that converts points camera to device points, must be valid
+		 * @param defaultTagSize The edge length of all detected tags that are not specified in `tagSizeMap`, range: (0, infinity)
+		 * @param tagSizeMap Optional mapping of tag IDs to specific tag sizes, range of tag IDs (key): [0, 1024), range of tag sizes (value): (0, infinity)
+		 * @param tagObservationHistories Optional return value holding the tag observations (2D-3D point correspondences)
+		 * @return The detected tags
+		 * @see detectTagsMono().
+		 */
+		static OculusTags readTags(const AnyCamera& anyCamera, const Frame& yFrame, const QuadDetector::Quads& candidateQuads, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const Scalar defaultTagSize, const TagSizeMap& tagSizeMap = TagSizeMap(), TagObservationHistories* tagObservationHistories = nullptr);
+
+		/**
+		 * Detects a known tag in a small region of interest around its predicted image location
+		 * The region of interest is determined by projecting the tag with its latest known pose into the camera; the quads are detected on the coarsest pyramid layer on which the tag is still large enough and the corners are refined on the finest layer.
+		 * @param anyCamera The camera with which the input image has been recorded, must be valid
+		 * @param framePyramid The frame pyramid of the input image, must be valid
+		 * @param world_T_device The transformation that converts device points to world points, must be valid
+		 * @param device_T_camera The transformation that converts points in the camera to device points, must be valid
+		 * @param predictedTag The known tag with its predicted pose, must be valid
+		 * @param tag The tag instance initialized with the information from the tag in the image, only valid if this function returns `true`
+		 * @param quad The four outer corners of the tag in counter-clockwise order starting with the top-left corner, only valid if this function returns `true`
+		 * @return True, if the known tag has been detected inside the region of interest, otherwise false
+		 */
+		static bool detectTagInRegion(const AnyCamera& anyCamera, const CV::FramePyramid& framePyramid, const HomogenousMatrix4& world_T_device, const HomogenousMatrix4& device_T_camera, const OculusTag& predictedTag, OculusTag& tag, QuadDetector::Quad& quad);
+
+		/**
+		 * Detects quads in a region of interest on a specific layer of a frame pyramid
+		 * Quads detected on a coarser layer are mapped to the finest layer and their corners are refined on the finest layer.
+		 * @param framePyramid The frame pyramid in which the quads will be detected, must be valid
+		 * @param regionOfInterest The region of interest in which the quads will be detected, defined in the finest pyramid layer, must be valid
+		 * @param layerIndex The index of the pyramid layer on which the quads will be detected, range: [0, framePyramid.layers())
+		 * @return The detected quads, with coordinates defined in the finest pyramid layer
+		 */
+		static QuadDetector::Quads detectQuadsInRegion(const CV::FramePyramid& framePyramid, const CV::PixelBoundingBox& regionOfInterest, const unsigned int layerIndex);
+
+		/**
+		 * Determines the region of interest and the pyramid layer of one scan of the amortized full-frame detection
+		 * The full-frame detection is split into `numberDetectionBands_` overlapping horizontal bands on the finest pyramid layer, followed by one scan of the entire frame on a coarser pyramid layer for tags which are too large to fit into a band.<br>
+		 * Horizontal bands are used as the tags of stereo cameras with (almost) horizontal baseline are visible in the same band in both images.
+		 * @param width The width of the finest pyramid layer, in pixels, range: [1, infinity)
+		 * @param height The height of the finest pyramid layer, in pixels, range: [numberDetectionBands_ + 1, infinity)
+		 * @param scanIndex The index of the scan, range: [0, numberDetectionBands_]
+		 * @param regionOfInterest The resulting region of interest of the scan, defined in the finest pyramid layer
+		 * @param layerIndex The resulting index of the pyramid layer on which the scan will be applied
+		 */
+		static void determineDetectionScan(const unsigned int width, const unsigned int height, const unsigned int scanIndex, CV::PixelBoundingBox& regionOfInterest, unsigned int& layerIndex);
 
 		/**
 		 * Reads the tag information from an image given the locations of its four outer corners
@@ -622,6 +675,9 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		/// A frame counter
 		uint32_t frameCounter_;
 
+		/// The index of the next scan of the amortized full-frame detection, range: [0, numberDetectionBands_]
+		uint32_t detectionScanIndex_;
+
 		/// A map tags that are (known and) tracked
 		TrackedTagMap trackedTagMap_;
 
@@ -649,9 +705,24 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT OculusTagTracker
 		/// The maximum number of observations per tag that will be stored, range: [1, infinity)
 		static constexpr size_t numberMaxAllowedObservations_ = 15;
 
-		/// The number of frames after which the detector is run to detect new tags, range: [1, infinity)
+		/// The number of frames after which the entire frame has been scanned for new tags while tags are visible, without visible tags each frame is scanned entirely, range: [1, infinity)
 		static constexpr unsigned int detectionCadence_ = 15u;
 
+		/// The number of horizontal bands in which the full-frame detection is split, one band is scanned per detection iteration, range: [1, infinity)
+		static constexpr unsigned int numberDetectionBands_ = 3u;
+
+		/// The index of the pyramid layer on which the entire frame is scanned for large tags, range: [0, numberFrameLayers_)
+		static constexpr unsigned int detectionCoarseLayerIndex_ = 1u;
+
+		/// The maximal number of pyramid layers which are used to re-detect known tags in their region of interest, range: [1, numberFrameLayers_]
+		static constexpr unsigned int maximalRegionOfInterestLayers_ = 3u;
+
+		/// The minimal edge length a known tag must have on a pyramid layer so that the layer is used for the re-detection (ensuring modules with six pixels at least), in pixels, range: [OculusTag::numberOfModules, infinity)
+		static constexpr Scalar minimalRegionOfInterestTagEdgeLength_ = Scalar(6u * OculusTag::numberOfModules);
+
+		/// The margin around the predicted location of a known tag which defines the region of interest, as a fraction of the tag's edge length in the image, range: [0, infinity)
+		static constexpr Scalar regionOfInterestMarginFactor_ = Scalar(0.5);
+
 		/// The maximum projection error in pixels, range: [0, infinit)
 		static constexpr Scalar maxAllowedProjectionError_ = Scalar(0.5);
 
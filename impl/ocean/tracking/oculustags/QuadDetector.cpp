@@ -115,6 +115,43 @@ QuadDetector::Quads QuadDetector::detectQuads(const Frame& yFrame, const uint32_
 	return quads;
 }
 
+QuadDetector::Quads QuadDetector::detectQuads(const Frame& yFrame, const CV::PixelBoundingBox& regionOfInterest, const uint32_t frameBorder)
+{
+	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, 1u>()));
+	ocean_assert(yFrame.width() >= 2u * frameBorder && yFrame.height() >= 2u * frameBorder);
+	ocean_assert(regionOfInterest.isValid());
+
+	if (yFrame.width() <= 2u * frameBorder || yFrame.height() <= 2u * frameBorder)
+	{
+		return Quads();
+	}
+
+	const CV::PixelBoundingBox clippedRegion = regionOfInterest && CV::PixelBoundingBox(frameBorder, frameBorder, yFrame.width() - frameBorder - 1u, yFrame.height() - frameBorder - 1u);
+
+	// A tag needs at least one pixel per module, smaller regions cannot contain any tag
+
+	if (!clippedRegion.isValid() || clippedRegion.width() < OculusTag::numberOfModules || clippedRegion.height() < OculusTag::numberOfModules)
+	{
+		return Quads();
+	}
+
+	const Frame ySubFrame = yFrame.subFrame(clippedRegion.left(), clippedRegion.top(), clippedRegion.width(), clippedRegion.height(), Frame::CM_USE_KEEP_LAYOUT);
+
+	Quads quads = detectQuads(ySubFrame, 0u);
+
+	const Vector2 offset(Scalar(clippedRegion.left()), Scalar(clippedRegion.top()));
+
+	for (Quad& quad : quads)
+	{
+		for (Vector2& corner : quad)
+		{
+			corner += offset;
+		}
+	}
+
+	return quads;
+}
+
 QuadDetector::Quads QuadDetector::extractQuads(const Frame& yFrame, const CV::Detector::ShapeDetector::LShapes& lShapes, const FiniteLines2& finiteLines, const Scalar angleThreshold, const uint32_t frameBorder)
 {
 	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::genericPixelFormat<FrameType::DT_UNSIGNED_INTEGER_8, 1u>()));
@@ -12,6 +12,8 @@
 
 #include "ocean/base/Frame.h"
 
+#include "ocean/cv/PixelBoundingBox.h"
+
 #include "ocean/cv/detector/ShapeDetector.h"
 
 #include "ocean/math/Vector2.h"
@@ -53,6 +55,16 @@ class OCEAN_TRACKING_OCULUSTAGS_EXPORT QuadDetector
 		 */
 		static Quads detectQuads(const Frame& yFrame, const uint32_t frameBorder = 0u);
 
+		/**
+		 * Detects boundary patterns (possible candidates) within a region of interest and filters them
+		 * Only the image content inside the region of interest is processed, boundary patterns which are not entirely inside the region will not be detected.
+		 * @param yFrame The image in which boundary patterns will be searched, must be valid
+		 * @param regionOfInterest The region of interest in which boundary patterns will be searched, will be clipped to the image area inside the frame border, must be valid
+		 * @param frameBorder Defines a perimeter inside the image along the image border in which nothing will be processed (in pixels), range: [0, min(yFrame.width(), yFrame.height())/2)
+		 * @return A vector of detected boundary patterns, with coordinates defined in `yFrame`
+		 */
+		static Quads detectQuads(const Frame& yFrame, const CV::PixelBoundingBox& regionOfInterest, const uint32_t frameBorder = 0u);
+
 	protected:
 
 		/**
@@ -229,6 +229,9 @@ bool FrameTracker::FramePyramidTrackerComponent::onStartDecreasing()
 	previousFramePyramid_.clear();
 	currentFramePyramid_.clear();
 
+	previousSharedFramePyramid_ = nullptr;
+	currentSharedFramePyramid_ = nullptr;
+
 	return true;
 }
 
@@ -236,6 +239,7 @@ bool FrameTracker::FramePyramidTrackerComponent::onSetupIteration(const unsigned
 {
 	// swap the frame pyramid from the previous iteration
 	std::swap(previousFramePyramid_, currentFramePyramid_);
+	std::swap(previousSharedFramePyramid_, currentSharedFramePyramid_);
 
 	const FrameRef frame(parent_.frameProviderInterface_->synchronFrameRequest(index, 10.0, &parent_.shouldStop_));
 
@@ -247,6 +251,27 @@ bool FrameTracker::FramePyramidTrackerComponent::onSetupIteration(const unsigned
 
 	const FrameType::PixelFormat targetPixelFormat = FrameType::formatRemoveAlphaChannel(FrameType::genericSinglePlanePixelFormat(frame->pixelFormat()));
 
+	SharedFrameProviderInterface* sharedFrameProviderInterface = dynamic_cast<SharedFrameProviderInterface*>(&*parent_.frameProviderInterface_);
+
+	if (sharedFrameProviderInterface != nullptr)
+	{
+		// the pyramid may be used by other trackers as well, so that we use the memory of the pyramid without copying it
+
+		SharedFrameProviderInterface::SharedFramePyramid sharedFramePyramid = sharedFrameProviderInterface->framePyramid(index, targetPixelFormat, FrameType::ORIGIN_UPPER_LEFT, CV::FramePyramid::DM_FILTER_11, framePyramidLayers_, WorkerPool::get().scopedWorker()(), 10.0, &parent_.shouldStop_);
+
+		if (!sharedFramePyramid)
+		{
+			return false;
+		}
+
+		currentFramePyramid_ = CV::FramePyramid(*sharedFramePyramid, false /*copyData*/);
+		currentSharedFramePyramid_ = std::move(sharedFramePyramid);
+
+		return true;
+	}
+
+	currentSharedFramePyramid_ = nullptr;
+
 	Frame currentFrame;
 	if (!CV::FrameConverter::Comfort::convert(*frame, targetPixelFormat, FrameType::ORIGIN_UPPER_LEFT, currentFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, WorkerPool::get().scopedWorker()()))
 	{
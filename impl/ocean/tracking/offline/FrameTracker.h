@@ -10,6 +10,7 @@
 
 #include "ocean/tracking/offline/Offline.h"
 #include "ocean/tracking/offline/OfflineTracker.h"
+#include "ocean/tracking/offline/SharedFrameProviderInterface.h"
 
 #include "ocean/base/SmartObjectRef.h"
 
@@ -235,6 +236,12 @@ class OCEAN_TRACKING_OFFLINE_EXPORT FrameTracker : virtual public OfflineTracker
 				/// Frame pyramid that has been created for the current component iteration.
 				CV::FramePyramid currentFramePyramid_;
 
+				/// The cached pyramid which is used by the previous frame pyramid, if the frame provider interface is a SharedFrameProviderInterface.
+				SharedFrameProviderInterface::SharedFramePyramid previousSharedFramePyramid_;
+
+				/// The cached pyramid which is used by the current frame pyramid, if the frame provider interface is a SharedFrameProviderInterface.
+				SharedFrameProviderInterface::SharedFramePyramid currentSharedFramePyramid_;
+
 				/// Number of pyramid layers that should be created in each pyramid.
 				unsigned int framePyramidLayers_ = (unsigned int)(-1);
 		};
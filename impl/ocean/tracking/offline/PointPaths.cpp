@@ -208,6 +208,8 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 	}
 
 	CV::FramePyramid currentFramePyramid;
+	SharedFrameProviderInterface::SharedFramePyramid currentSharedFramePyramid;
+	SharedFrameProviderInterface::SharedFramePyramid previousSharedFramePyramid;
 	CV::FramePyramid previousFramePyramid(startFramePyramid, true /*copyData*/);
 	Vectors2 previousFeaturePoints(startFrameFeaturePoints);
 	Strengths previousFeatureStrengths(startFrameFeatureStrengths);
@@ -231,12 +233,13 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			frameProviderInterface.frameCacheRequest(frameIndex + 1u, 9);
 		}
 
-		Frame frame;
-		if (!CV::FrameConverter::Comfort::convert(*frameRef, pixelFormat, pixelOrigin, frame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+		if (!framePyramid(frameProviderInterface, *frameRef, frameIndex, pixelFormat, pixelOrigin, trackingConfiguration.pyramidLayers(), currentFramePyramid, currentSharedFramePyramid, worker))
 		{
 			return false;
 		}
 
+		const Frame& frame = currentFramePyramid.finestLayer();
+
 		const Index32 poseId = frameIndex;
 
 		// we add a new pose (if not existing) for the current frame so that all image points can be added to this pose
@@ -245,10 +248,6 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			database.addPose<false>(poseId);
 		}
 
-		if (!currentFramePyramid.replace(frame, CV::FramePyramid::DM_FILTER_14641, trackingConfiguration.pyramidLayers(), true /*copyFirstLayer*/, worker))
-		{
-			return false;
-		}
 		ocean_assert(previousFramePyramid.isValid());
 
 		// we detect strong feature points in the current frame
@@ -333,6 +332,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 		previousFeatureStrengths = std::move(currentFeatureStrengths);
 
 		std::swap(previousFramePyramid, currentFramePyramid);
+		std::swap(previousSharedFramePyramid, currentSharedFramePyramid);
 
 		if (progress)
 		{
@@ -410,16 +410,11 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			frameProviderInterface.frameCacheRequest(frameIndex - 1u, -9);
 		}
 
-		Frame frame;
-		if (!CV::FrameConverter::Comfort::convert(*frameRef, pixelFormat, pixelOrigin, frame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+		if (!framePyramid(frameProviderInterface, *frameRef, frameIndex, pixelFormat, pixelOrigin, trackingConfiguration.pyramidLayers(), currentFramePyramid, currentSharedFramePyramid, worker))
 		{
 			return false;
 		}
 
-		if (!currentFramePyramid.replace(frame, CV::FramePyramid::DM_FILTER_14641, trackingConfiguration.pyramidLayers(), true /*copyFirstLayer*/, worker))
-		{
-			return false;
-		}
 		ocean_assert(previousFramePyramid);
 
 		Indices32 validTrackedIndices;
@@ -469,6 +464,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 		previousFeaturePoints = database.imagePointsWithObjectPoints<false>(frameIndex, previousObjectPointIds);
 
 		std::swap(previousFramePyramid, currentFramePyramid);
+		std::swap(previousSharedFramePyramid, currentSharedFramePyramid);
 
 		if (progress)
 		{
@@ -480,6 +476,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 	// now we go on with the major backward iteration (which has a minor forward iteration afterwards)
 
 	previousFramePyramid = CV::FramePyramid(startFramePyramid, true /*copyData*/);
+	previousSharedFramePyramid = nullptr;
 
 	Indices32 candidateObjectPointIds;
 	Vectors2 candidateFeaturePoints = database.imagePointsWithObjectPoints<false>(startFrameIndex, candidateObjectPointIds);
@@ -517,12 +514,13 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			frameProviderInterface.frameCacheRequest(frameIndex - 1u, -9);
 		}
 
-		Frame frame;
-		if (!CV::FrameConverter::Comfort::convert(*frameRef, pixelFormat, pixelOrigin, frame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+		if (!framePyramid(frameProviderInterface, *frameRef, frameIndex, pixelFormat, pixelOrigin, trackingConfiguration.pyramidLayers(), currentFramePyramid, currentSharedFramePyramid, worker))
 		{
 			return false;
 		}
 
+		const Frame& frame = currentFramePyramid.finestLayer();
+
 		const Index32 poseId = frameIndex;
 
 		// we add a new pose (if not existing) for the current frame so that all image points can be added to this pose
@@ -531,10 +529,6 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			database.addPose<false>(poseId);
 		}
 
-		if (!currentFramePyramid.replace(frame, CV::FramePyramid::DM_FILTER_14641, trackingConfiguration.pyramidLayers(), true /*copyFirstLayer*/, worker))
-		{
-			return false;
-		}
 		ocean_assert(previousFramePyramid.isValid());
 
 		// we detect strong feature points in the current frame
@@ -619,6 +613,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 		previousFeatureStrengths = std::move(currentFeatureStrengths);
 
 		std::swap(previousFramePyramid, currentFramePyramid);
+		std::swap(previousSharedFramePyramid, currentSharedFramePyramid);
 
 		if (progress)
 		{
@@ -697,16 +692,11 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			frameProviderInterface.frameCacheRequest(frameIndex + 1u, 9);
 		}
 
-		Frame frame;
-		if (!CV::FrameConverter::Comfort::convert(*frameRef, pixelFormat, pixelOrigin, frame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+		if (!framePyramid(frameProviderInterface, *frameRef, frameIndex, pixelFormat, pixelOrigin, trackingConfiguration.pyramidLayers(), currentFramePyramid, currentSharedFramePyramid, worker))
 		{
 			return false;
 		}
 
-		if (!currentFramePyramid.replace(frame, CV::FramePyramid::DM_FILTER_14641, trackingConfiguration.pyramidLayers(), true /*copyFirstLayer*/, worker))
-		{
-			return false;
-		}
 		ocean_assert(previousFramePyramid);
 
 		Indices32 validTrackedIndices;
@@ -756,6 +746,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 		previousFeaturePoints = database.imagePointsWithObjectPoints<false>(frameIndex, previousObjectPointIds);
 
 		std::swap(previousFramePyramid, currentFramePyramid);
+		std::swap(previousSharedFramePyramid, currentSharedFramePyramid);
 
 		if (progress)
 		{
@@ -927,6 +918,8 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 	}
 
 	CV::FramePyramid currentFramePyramid;
+	SharedFrameProviderInterface::SharedFramePyramid currentSharedFramePyramid;
+	SharedFrameProviderInterface::SharedFramePyramid previousSharedFramePyramid;
 	CV::FramePyramid previousFramePyramid(subRegionFramePyramid, true /*copyData*/);
 	Vectors2 previousFeaturePoints(subRegionFeaturePoints);
 	Strengths previousFeatureStrengths(subRegionFeatureStrengths);
@@ -949,8 +942,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			frameProviderInterface.frameCacheRequest(frameIndex + 1u, 9);
 		}
 
-		Frame frame;
-		if (!CV::FrameConverter::Comfort::convert(*frameRef, pixelFormat, pixelOrigin, frame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+		if (!framePyramid(frameProviderInterface, *frameRef, frameIndex, pixelFormat, pixelOrigin, trackingConfiguration.pyramidLayers(), currentFramePyramid, currentSharedFramePyramid, worker))
 		{
 			return false;
 		}
@@ -962,10 +954,6 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			database.addPose<false>(poseId);
 		}
 
-		if (!currentFramePyramid.replace(frame, CV::FramePyramid::DM_FILTER_14641, trackingConfiguration.pyramidLayers(), true /*copyFirstLayer*/, worker))
-		{
-			return false;
-		}
 		ocean_assert(previousFramePyramid.isValid());
 
 		Vectors2 currentFeaturePoints;
@@ -1014,6 +1002,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 		previousFeatureStrengths = std::move(currentFeatureStrengths);
 
 		std::swap(previousFramePyramid, currentFramePyramid);
+		std::swap(previousSharedFramePyramid, currentSharedFramePyramid);
 
 		if (progress)
 		{
@@ -1037,6 +1026,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 	ocean_assert(subRegionFramePyramid.isOwner());
 
 	previousFramePyramid = std::move(subRegionFramePyramid);
+	previousSharedFramePyramid = nullptr;
 	previousFeaturePoints = subRegionFeaturePoints;
 	previousFeatureStrengths = subRegionFeatureStrengths;
 	previousObjectPointIds = subRegionFrameObjectPointIds;
@@ -1056,8 +1046,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			frameProviderInterface.frameCacheRequest(frameIndex - 1u, -9);
 		}
 
-		Frame frame;
-		if (!CV::FrameConverter::Comfort::convert(*frameRef, pixelFormat, pixelOrigin, frame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+		if (!framePyramid(frameProviderInterface, *frameRef, frameIndex, pixelFormat, pixelOrigin, trackingConfiguration.pyramidLayers(), currentFramePyramid, currentSharedFramePyramid, worker))
 		{
 			return false;
 		}
@@ -1069,10 +1058,6 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 			database.addPose<false>(poseId);
 		}
 
-		if (!currentFramePyramid.replace(frame, CV::FramePyramid::DM_FILTER_14641, trackingConfiguration.pyramidLayers(), true /*copyFirstLayer*/, worker))
-		{
-			return false;
-		}
 		ocean_assert(previousFramePyramid);
 
 		Vectors2 currentFeaturePoints;
@@ -1121,6 +1106,7 @@ bool PointPaths::determinePointPaths(CV::FrameProviderInterface& frameProviderIn
 		previousFeatureStrengths = std::move(currentFeatureStrengths);
 
 		std::swap(previousFramePyramid, currentFramePyramid);
+		std::swap(previousSharedFramePyramid, currentSharedFramePyramid);
 
 		if (progress)
 		{
@@ -1865,6 +1851,40 @@ void PointPaths::idealPyramidParameters(const unsigned int width, const unsigned
 	ocean_assert(coarsestLayerRadius <= maximalCoarsestLayerRadius);
 }
 
+bool PointPaths::framePyramid(CV::FrameProviderInterface& frameProviderInterface, const Frame& frame, const unsigned int frameIndex, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const unsigned int layers, CV::FramePyramid& framePyramid, SharedFrameProviderInterface::SharedFramePyramid& sharedFramePyramid, Worker* worker)
+{
+	ocean_assert(frame.isValid());
+	ocean_assert(layers >= 1u);
+
+	SharedFrameProviderInterface* sharedFrameProviderInterface = dynamic_cast<SharedFrameProviderInterface*>(&frameProviderInterface);
+
+	if (sharedFrameProviderInterface != nullptr)
+	{
+		SharedFrameProviderInterface::SharedFramePyramid newSharedFramePyramid = sharedFrameProviderInterface->framePyramid(frameIndex, pixelFormat, pixelOrigin, CV::FramePyramid::DM_FILTER_14641, layers, worker);
+
+		if (!newSharedFramePyramid)
+		{
+			return false;
+		}
+
+		// the pyramid may be used by other trackers as well, so that we use the memory of the pyramid without copying it
+		framePyramid = CV::FramePyramid(*newSharedFramePyramid, false /*copyData*/);
+		sharedFramePyramid = std::move(newSharedFramePyramid);
+
+		return true;
+	}
+
+	sharedFramePyramid = nullptr;
+
+	Frame convertedFrame;
+	if (!CV::FrameConverter::Comfort::convert(frame, pixelFormat, pixelOrigin, convertedFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+	{
+		return false;
+	}
+
+	return framePyramid.replace(convertedFrame, CV::FramePyramid::DM_FILTER_14641, layers, true /*copyFirstLayer*/, worker);
+}
+
 bool PointPaths::trackPoints(const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& currentFramePyramid, const unsigned int coarsestLayerRadius, const Strengths& /*previousFeatureStrengths*/, const TrackingMethod trackingMethod, Vectors2& previousFeaturePoints, Vectors2& currentFeaturePoints, Indices32& validIndices, Worker* worker)
 {
 	if (previousFeaturePoints.empty())
@@ -10,6 +10,7 @@
 
 #include "ocean/tracking/offline/Offline.h"
 #include "ocean/tracking/offline/OfflineTracker.h"
+#include "ocean/tracking/offline/SharedFrameProviderInterface.h"
 
 #include "ocean/cv/FrameProviderInterface.h"
 #include "ocean/cv/FramePyramid.h"
@@ -323,6 +324,21 @@ class OCEAN_TRACKING_OFFLINE_EXPORT PointPaths
 		 * @return True, if succeeded
 		 */
 		static bool trackPoints(const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& currentFramePyramid, const unsigned int coarsestLayerRadius, const Strengths& previousFeatureStrengths, const TrackingMethod trackingMethod, Vectors2& previousFeaturePoints, Vectors2& currentFeaturePoints, Indices32& validIndices, Worker* worker);
+
+		/**
+		 * Creates the frame pyramid of a frame, or uses the cached pyramid if the frame provider interface is a SharedFrameProviderInterface.
+		 * @param frameProviderInterface The frame provider interface which has provided the frame
+		 * @param frame The frame for which the pyramid will be created, must be valid
+		 * @param frameIndex The index of the frame
+		 * @param pixelFormat The pixel format of the pyramid
+		 * @param pixelOrigin The pixel origin of the pyramid
+		 * @param layers The number of pyramid layers, with range [1, infinity)
+		 * @param framePyramid The resulting frame pyramid, may use the memory of 'sharedFramePyramid'
+		 * @param sharedFramePyramid The resulting cached pyramid which must exist as long as 'framePyramid' is used, nullptr if the pyramid is not cached
+		 * @param worker Optional worker object to distribute the computation
+		 * @return True, if succeeded
+		 */
+		static bool framePyramid(CV::FrameProviderInterface& frameProviderInterface, const Frame& frame, const unsigned int frameIndex, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const unsigned int layers, CV::FramePyramid& framePyramid, SharedFrameProviderInterface::SharedFramePyramid& sharedFramePyramid, Worker* worker);
 };
 
 inline PointPaths::TrackingConfiguration::TrackingConfiguration(const TrackingMethod trackingMethod, const unsigned int frameWidth, const unsigned int frameHeight, const unsigned int numberBins, const unsigned int strength, const unsigned int coarsestLayerRadius, const unsigned int pyramidLayers) :
@@ -8,16 +8,21 @@
 #include "ocean/tracking/offline/SLAMTracker.h"
 
 #include "ocean/base/HighPerformanceTimer.h"
+#include "ocean/base/Lock.h"
 #include "ocean/base/Maintenance.h"
+#include "ocean/base/Median.h"
 #include "ocean/base/Scheduler.h"
+#include "ocean/base/String.h"
 #include "ocean/base/WorkerPool.h"
 
 #include "ocean/cv/CVUtilities.h"
 
+#include "ocean/geometry/AbsoluteTransformation.h"
 #include "ocean/geometry/Grid.h"
 #include "ocean/geometry/Homography.h"
 #include "ocean/geometry/Utilities.h"
 
+#include "ocean/io/Bitstream.h"
 #include "ocean/io/Utilities.h"
 
 #include "ocean/math/FiniteLine2.h"
@@ -29,6 +34,14 @@
 #include "ocean/tracking/Solver3.h"
 #include "ocean/tracking/Utilities.h"
 
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WINDOWS
+	#include <winsock2.h>
+	#include <windows.h>
+#endif
+
 namespace Ocean
 {
 
@@ -174,6 +187,95 @@ bool SLAMTracker::setRegionOfInterest(const CV::SubRegion& regionOfInterest, con
 	return true;
 }
 
+bool SLAMTracker::setSegmentParallelization(const unsigned int segmentSize, const unsigned int segmentOverlap)
+{
+	ocean_assert(segmentSize == 0u || (segmentSize >= 50u && segmentOverlap >= 10u && segmentOverlap * 2u <= segmentSize));
+
+	if (segmentSize != 0u && (segmentSize < 50u || segmentOverlap < 10u || segmentOverlap * 2u > segmentSize))
+	{
+		return false;
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	if (running())
+	{
+		return false;
+	}
+
+	segmentSize_ = segmentSize;
+	segmentOverlap_ = segmentOverlap;
+
+	return true;
+}
+
+bool SLAMTracker::setCheckpointPrefix(const std::string& checkpointPrefix)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (running())
+	{
+		return false;
+	}
+
+	checkpointPrefix_ = checkpointPrefix;
+
+	return true;
+}
+
+bool SLAMTracker::setResumeCheckpoint(const std::string& filename)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (running())
+	{
+		return false;
+	}
+
+	if (filename.empty())
+	{
+		resumeCheckpoint_ = Checkpoint();
+		return true;
+	}
+
+	Checkpoint checkpoint;
+	if (!readCheckpoint(filename, checkpoint))
+	{
+		return false;
+	}
+
+	resumeCheckpoint_ = std::move(checkpoint);
+
+	return true;
+}
+
+std::string SLAMTracker::checkpointFilename(const std::string& checkpointPrefix, const TrackingStage stage)
+{
+	ocean_assert(!checkpointPrefix.empty());
+	ocean_assert(stage != TS_NONE);
+
+	switch (stage)
+	{
+		case TS_NONE:
+			break;
+
+		case TS_POINT_PATHS:
+			return checkpointPrefix + "_pointpaths.ockp";
+
+		case TS_INITIAL_OBJECT_POINTS:
+			return checkpointPrefix + "_initialobjectpoints.ockp";
+
+		case TS_CAMERA_OPTIMIZATION:
+			return checkpointPrefix + "_cameraoptimization.ockp";
+
+		case TS_STABLE_OBJECT_POINTS:
+			return checkpointPrefix + "_stableobjectpoints.ockp";
+	}
+
+	ocean_assert(false && "Invalid stage!");
+	return checkpointPrefix + "_invalid.ockp";
+}
+
 bool SLAMTracker::extractPoses(const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, OfflinePoses& offlinePoses, const unsigned int minimalCorrespondences, const Geometry::Estimator::EstimatorType estimator, const Scalar minimalValidCorrespondenceRatio, const Scalar ransacMaximalSqrError, const Scalar maximalRobustError, Scalar* finalAverageError, Worker* worker, bool* abort) const
 {
 	ocean_assert(lowerFrameIndex <= upperFrameIndex);
@@ -524,213 +626,288 @@ bool SLAMTracker::applyFrameTracking(const FrameType& frameType)
 		return true;
 	}
 
-	Log::info() << "Starting point path determination";
+	const bool useRegionOfInterest = soleRegionOfInterestApplication_ || (startFrameIndex_ != (unsigned int)(-1) && regionOfInterest_.size() >= 50  * 50);
 
-	PointPaths::TrackingConfiguration regionOfInterestTrackingConfiguration, frameTrackingConfiguration;
+	TrackingStage resumeStage = TS_NONE;
 
-	localProgress_ = 0;
-	ScopedEventStackLayer scopedProgress(*this, Scalar(0.00), Scalar(0.01));
+	unsigned int lowerPoseBorder = (unsigned int)(-1);
+	unsigned int upperPoseBorder = (unsigned int)(-1);
 
-	const bool useRegionOfInterest = soleRegionOfInterestApplication_ || (startFrameIndex_ != (unsigned int)(-1) && regionOfInterest_.size() >= 50  * 50);
+	Solver3::CameraMotion cameraMotion = Solver3::CM_UNKNOWN;
 
-	if (trackingQuality_ == TQ_AUTOMATIC)
+	if (resumeCheckpoint_.isValid())
 	{
-		if (useRegionOfInterest)
+		if (resumeCheckpoint_.lowerFrameIndex_ == lowerFrameIndex_ && resumeCheckpoint_.upperFrameIndex_ == upperFrameIndex_ && resumeCheckpoint_.camera_.width() == frameType.width() && resumeCheckpoint_.camera_.height() == frameType.height())
 		{
-			ocean_assert(startFrameIndex_ != (unsigned int)(-1));
-			if (!PointPaths::determineAutomaticTrackingConfiguration(*frameProviderInterface_, FrameType::ORIGIN_UPPER_LEFT, motionSpeed_, startFrameIndex_, regionOfInterest_, soleRegionOfInterestApplication_ ? nullptr : &frameTrackingConfiguration, &regionOfInterestTrackingConfiguration, WorkerPool::get().scopedWorker()(), &shouldStop_))
-				return false;
+			Log::info() << "Resuming from checkpoint, skipping all stages up to stage " << int(resumeCheckpoint_.stage_);
+
+			resumeStage = resumeCheckpoint_.stage_;
+
+			camera_ = resumeCheckpoint_.camera_;
+			database_ = std::move(resumeCheckpoint_.database_);
+
+			lowerPoseBorder = resumeCheckpoint_.lowerPoseBorder_;
+			upperPoseBorder = resumeCheckpoint_.upperPoseBorder_;
+
+			if (resumeStage >= TS_STABLE_OBJECT_POINTS)
+			{
+				cameraMotion_ = resumeCheckpoint_.cameraMotion_;
+			}
+			else if (resumeStage >= TS_CAMERA_OPTIMIZATION)
+			{
+				cameraMotion = resumeCheckpoint_.cameraMotion_;
+			}
 		}
 		else
 		{
-			if (!PointPaths::determineAutomaticTrackingConfiguration(*frameProviderInterface_, FrameType::ORIGIN_UPPER_LEFT, motionSpeed_, lowerFrameIndex_, upperFrameIndex_, frameTrackingConfiguration, 5u, WorkerPool::get().scopedWorker()(), &shouldStop_))
-				return false;
+			Log::warning() << "The checkpoint does not match the frame range or the frame dimension of the tracker, the tracker starts from scratch";
 		}
+
+		// the checkpoint is used for one run only
+		resumeCheckpoint_ = Checkpoint();
 	}
-	else
+
+	localProgress_ = 0;
+	ScopedEventStackLayer scopedProgress(*this, Scalar(0.00), Scalar(0.01));
+
+	if (resumeStage < TS_POINT_PATHS)
 	{
-		if (useRegionOfInterest)
+		Log::info() << "Starting point path determination";
+
+		PointPaths::TrackingConfiguration regionOfInterestTrackingConfiguration, frameTrackingConfiguration;
+
+		if (trackingQuality_ == TQ_AUTOMATIC)
 		{
-			ocean_assert(startFrameIndex_ != (unsigned int)(-1));
-			if (!PointPaths::determineTrackingConfiguration(*frameProviderInterface_, regionOfInterest_, trackingQuality_, motionSpeed_, soleRegionOfInterestApplication_ ? nullptr : &frameTrackingConfiguration, &regionOfInterestTrackingConfiguration, &shouldStop_))
-				return false;
+			if (useRegionOfInterest)
+			{
+				ocean_assert(startFrameIndex_ != (unsigned int)(-1));
+				if (!PointPaths::determineAutomaticTrackingConfiguration(*frameProviderInterface_, FrameType::ORIGIN_UPPER_LEFT, motionSpeed_, startFrameIndex_, regionOfInterest_, soleRegionOfInterestApplication_ ? nullptr : &frameTrackingConfiguration, &regionOfInterestTrackingConfiguration, WorkerPool::get().scopedWorker()(), &shouldStop_))
+					return false;
+			}
+			else
+			{
+				if (!PointPaths::determineAutomaticTrackingConfiguration(*frameProviderInterface_, FrameType::ORIGIN_UPPER_LEFT, motionSpeed_, lowerFrameIndex_, upperFrameIndex_, frameTrackingConfiguration, 5u, WorkerPool::get().scopedWorker()(), &shouldStop_))
+					return false;
+			}
 		}
 		else
 		{
-			if (!PointPaths::determineTrackingConfiguration(*frameProviderInterface_, CV::SubRegion(), trackingQuality_, motionSpeed_, &frameTrackingConfiguration, nullptr, &shouldStop_))
-				return false;
+			if (useRegionOfInterest)
+			{
+				ocean_assert(startFrameIndex_ != (unsigned int)(-1));
+				if (!PointPaths::determineTrackingConfiguration(*frameProviderInterface_, regionOfInterest_, trackingQuality_, motionSpeed_, soleRegionOfInterestApplication_ ? nullptr : &frameTrackingConfiguration, &regionOfInterestTrackingConfiguration, &shouldStop_))
+					return false;
+			}
+			else
+			{
+				if (!PointPaths::determineTrackingConfiguration(*frameProviderInterface_, CV::SubRegion(), trackingQuality_, motionSpeed_, &frameTrackingConfiguration, nullptr, &shouldStop_))
+					return false;
+			}
 		}
-	}
 
-	scopedProgress.modify(Scalar(0.75));
-	localProgress_ = 0;
+		scopedProgress.modify(Scalar(0.75));
+		localProgress_ = 0;
 
-	// track the points inside the specified sub-region
-	if (useRegionOfInterest)
-	{
-		ocean_assert(regionOfInterestTrackingConfiguration.isValid());
+		// track the points inside the specified sub-region
+		if (useRegionOfInterest)
+		{
+			ocean_assert(regionOfInterestTrackingConfiguration.isValid());
 
-		const ScopedEventStackLayer internalScopedProgress(*this, 0, soleRegionOfInterestApplication_ ?  1 : Scalar(0.25));
+			const ScopedEventStackLayer internalScopedProgress(*this, 0, soleRegionOfInterestApplication_ ?  1 : Scalar(0.25));
 
-		// we select a border size of 20 pixels at the frame's border/boundary, re-tracked points in this border area count as invalid
-		const unsigned int invalidBorderSize = frameType.width() >= 100u && frameType.height() >= 100u ? 20u : 0u;
+			// we select a border size of 20 pixels at the frame's border/boundary, re-tracked points in this border area count as invalid
+			const unsigned int invalidBorderSize = frameType.width() >= 100u && frameType.height() >= 100u ? 20u : 0u;
 
-		if (soleRegionOfInterestApplication_ && lowerFrameIndex_ != upperFrameIndex_)
-		{
-			// as the tracker relies on the area of interest only, we must ensure that we have enough point paths
-			// thus, we test the current tracker configuration for the first neighboring frames (lower and upper) and weaken the tracker configuration as long as necessary
+			if (soleRegionOfInterestApplication_ && lowerFrameIndex_ != upperFrameIndex_)
+			{
+				// as the tracker relies on the area of interest only, we must ensure that we have enough point paths
+				// thus, we test the current tracker configuration for the first neighboring frames (lower and upper) and weaken the tracker configuration as long as necessary
 
-			Log::info() << "The tracker relies on the area of interest only, so we ensure that we use enough tracking points by weakening the tracker configuration as long as necessary.";
+				Log::info() << "The tracker relies on the area of interest only, so we ensure that we use enough tracking points by weakening the tracker configuration as long as necessary.";
 
-			ocean_assert(startFrameIndex_ != (unsigned int)(-1));
-			const unsigned int lowerTestFrameIndex = max(int(lowerFrameIndex_), int(startFrameIndex_) - 1);
-			const unsigned int upperTestFrameIndex = min(startFrameIndex_ + 1u, upperFrameIndex_);
+				ocean_assert(startFrameIndex_ != (unsigned int)(-1));
+				const unsigned int lowerTestFrameIndex = max(int(lowerFrameIndex_), int(startFrameIndex_) - 1);
+				const unsigned int upperTestFrameIndex = min(startFrameIndex_ + 1u, upperFrameIndex_);
 
-			unsigned int weakeningIterations = 0u;
-			while (weakeningIterations++ < 5u)
-			{
-				Database testDatabase;
-				if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, regionOfInterestTrackingConfiguration, lowerTestFrameIndex, regionOfInterest_, startFrameIndex_, upperTestFrameIndex, invalidBorderSize, true, testDatabase, WorkerPool::get().scopedWorker()(), &shouldStop_))
+				unsigned int weakeningIterations = 0u;
+				while (weakeningIterations++ < 5u)
 				{
-					Log::error() << "determinePointPaths() FAILED!";
-					return false;
-				}
+					Database testDatabase;
+					if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, regionOfInterestTrackingConfiguration, lowerTestFrameIndex, regionOfInterest_, startFrameIndex_, upperTestFrameIndex, invalidBorderSize, true, testDatabase, WorkerPool::get().scopedWorker()(), &shouldStop_))
+					{
+						Log::error() << "determinePointPaths() FAILED!";
+						return false;
+					}
 
-				// we use the maximal number of correspondences and not the minimal number to ensure that a keyframe (with different image content) between the selection frame and one neighboring frame does not create an insane tracker configuration
-				unsigned int maximalPointCorrespondences = 0u;
+					// we use the maximal number of correspondences and not the minimal number to ensure that a keyframe (with different image content) between the selection frame and one neighboring frame does not create an insane tracker configuration
+					unsigned int maximalPointCorrespondences = 0u;
 
-				for (unsigned int n = lowerTestFrameIndex; n <= upperTestFrameIndex; ++n)
-				{
-					const unsigned int correspondences = testDatabase.numberCorrespondences<false, true, false>(startFrameIndex_, Vector3(Numeric::minValue(), Numeric::minValue(), Numeric::minValue()));
+					for (unsigned int n = lowerTestFrameIndex; n <= upperTestFrameIndex; ++n)
+					{
+						const unsigned int correspondences = testDatabase.numberCorrespondences<false, true, false>(startFrameIndex_, Vector3(Numeric::minValue(), Numeric::minValue(), Numeric::minValue()));
 
-					maximalPointCorrespondences = max(maximalPointCorrespondences, correspondences);
-				}
+						maximalPointCorrespondences = max(maximalPointCorrespondences, correspondences);
+					}
 
-				Log::info() << "We tracked " << maximalPointCorrespondences << " points in the region of interest towards one neighboring frame, we are happy with 30.";
+					Log::info() << "We tracked " << maximalPointCorrespondences << " points in the region of interest towards one neighboring frame, we are happy with 30.";
 
-				if (maximalPointCorrespondences >= 30u)
-					break;
+					if (maximalPointCorrespondences >= 30u)
+						break;
 
-				if (!regionOfInterestTrackingConfiguration.weakenConfiguration())
-					break;
+					if (!regionOfInterestTrackingConfiguration.weakenConfiguration())
+						break;
+
+					Log::info() << "We weaken the tracker configuration";
+				}
+			}
 
-				Log::info() << "We weaken the tracker configuration";
+			Log::info() << "Determining point paths in region of interest with " << regionOfInterestTrackingConfiguration.horizontalBinSize() << "x" << regionOfInterestTrackingConfiguration.verticalBinSize() << " bins " << regionOfInterestTrackingConfiguration.strength() << " minimal strength and " << regionOfInterestTrackingConfiguration.trackingMethod() << " as tracking method";
+
+			if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, regionOfInterestTrackingConfiguration, lowerFrameIndex_, regionOfInterest_, startFrameIndex_, upperFrameIndex_, invalidBorderSize, true, database_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
+			{
+				Log::error() << "determinePointPaths() FAILED!";
+				return false;
 			}
 		}
 
-		Log::info() << "Determining point paths in region of interest with " << regionOfInterestTrackingConfiguration.horizontalBinSize() << "x" << regionOfInterestTrackingConfiguration.verticalBinSize() << " bins " << regionOfInterestTrackingConfiguration.strength() << " minimal strength and " << regionOfInterestTrackingConfiguration.trackingMethod() << " as tracking method";
+		localProgress_ = 0;
 
-		if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, regionOfInterestTrackingConfiguration, lowerFrameIndex_, regionOfInterest_, startFrameIndex_, upperFrameIndex_, invalidBorderSize, true, database_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
+		// track the points in the remaining areas
+		if (!soleRegionOfInterestApplication_)
 		{
-			Log::error() << "determinePointPaths() FAILED!";
-			return false;
-		}
-	}
+			ocean_assert(frameTrackingConfiguration.isValid());
 
-	localProgress_ = 0;
+			const ScopedEventStackLayer internalScopedProgress(*this, useRegionOfInterest ? Scalar(0.25) : 0, 1);
 
-	// track the points in the remaining areas
-	if (!soleRegionOfInterestApplication_)
-	{
-		ocean_assert(frameTrackingConfiguration.isValid());
+			// we select a border size of 20 pixels at the frame's border/boundary, re-tracked points in this border area count as invalid
+			const unsigned int invalidBorderSize = frameType.width() >= 100u && frameType.height() >= 100u ? 20u : 0u;
 
-		const ScopedEventStackLayer internalScopedProgress(*this, useRegionOfInterest ? Scalar(0.25) : 0, 1);
+			Log::info() << "Determining point paths in entire area with " << frameTrackingConfiguration.horizontalBinSize() << "x" << frameTrackingConfiguration.verticalBinSize() << " bins " << frameTrackingConfiguration.strength() << " minimal strength and " << frameTrackingConfiguration.trackingMethod() << " as tracking method";
 
-		// we select a border size of 20 pixels at the frame's border/boundary, re-tracked points in this border area count as invalid
-		const unsigned int invalidBorderSize = frameType.width() >= 100u && frameType.height() >= 100u ? 20u : 0u;
+			if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, frameTrackingConfiguration, lowerFrameIndex_, (useRegionOfInterest && startFrameIndex_ != (unsigned int)(-1)) ? startFrameIndex_ : lowerFrameIndex_, upperFrameIndex_, invalidBorderSize, true, database_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
+			{
+				Log::error() << "determinePointPaths() FAILED!";
+				return false;
+			}
+		}
 
-		Log::info() << "Determining point paths in entire area with " << frameTrackingConfiguration.horizontalBinSize() << "x" << frameTrackingConfiguration.verticalBinSize() << " bins " << frameTrackingConfiguration.strength() << " minimal strength and " << frameTrackingConfiguration.trackingMethod() << " as tracking method";
+		Log::info() << "Finished point path determination";
 
-		if (!PointPaths::determinePointPaths(*frameProviderInterface_, FrameType::FORMAT_RGB24, FrameType::ORIGIN_UPPER_LEFT, frameTrackingConfiguration, lowerFrameIndex_, (useRegionOfInterest && startFrameIndex_ != (unsigned int)(-1)) ? startFrameIndex_ : lowerFrameIndex_, upperFrameIndex_, invalidBorderSize, true, database_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_))
-		{
-			Log::error() << "determinePointPaths() FAILED!";
-			return false;
-		}
+		storeCheckpoint(TS_POINT_PATHS, Solver3::CM_INVALID, lowerPoseBorder, upperPoseBorder);
 	}
 
-	Log::info() << "Finished point path determination";
-
 	Log::info() << "Starting SLAM Tracker with a camera with " << Numeric::rad2deg(camera_.fovX()) << "deg field of view:";
 
 	scopedProgress.modify(Scalar(0.80));
 	localProgress_ = 0;
 
-	unsigned int lowerPoseBorder, upperPoseBorder;
-	if (!determineInitialObjectPoints(camera_, database_, randomGenerator, lowerFrameIndex_, startFrameIndex_ != (unsigned int)(-1) ? &startFrameIndex_ : nullptr, upperFrameIndex_, useRegionOfInterest ? regionOfInterest_ : CV::SubRegion(), soleRegionOfInterestApplication_, &lowerPoseBorder, &upperPoseBorder, &shouldStop_, &localProgress_))
+	if (resumeStage < TS_INITIAL_OBJECT_POINTS)
 	{
-		Log::error() << "determineInitialObjectPoints() FAILED!";
-		return false;
-	}
-
-	maintenanceSendEnvironment();
+		if (!determineInitialObjectPoints(camera_, database_, randomGenerator, lowerFrameIndex_, startFrameIndex_ != (unsigned int)(-1) ? &startFrameIndex_ : nullptr, upperFrameIndex_, useRegionOfInterest ? regionOfInterest_ : CV::SubRegion(), soleRegionOfInterestApplication_, &lowerPoseBorder, &upperPoseBorder, &shouldStop_, &localProgress_))
+		{
+			Log::error() << "determineInitialObjectPoints() FAILED!";
+			return false;
+		}
 
-	scopedProgress.modify(Scalar(0.85));
-	localProgress_ = 0;
+		maintenanceSendEnvironment();
 
-	unsigned int maximalValidInitialCorrespondences = 0u;
-	database_.poseWithMostCorrespondences<false, false, true>(lowerFrameIndex_, upperFrameIndex_, nullptr, &maximalValidInitialCorrespondences);
-	ocean_assert(maximalValidInitialCorrespondences != 0u);
+		scopedProgress.modify(Scalar(0.85));
+		localProgress_ = 0;
 
-	// normally 10 would be a good lower boundary; however, in extreme situations we cannot use more than the maximal number of correspondences, but 5 is the absolute minimum
-	const unsigned int correspondenceThresholdLowerBoundary = max(5u, min(10u, maximalValidInitialCorrespondences));
+		unsigned int maximalValidInitialCorrespondences = 0u;
+		database_.poseWithMostCorrespondences<false, false, true>(lowerFrameIndex_, upperFrameIndex_, nullptr, &maximalValidInitialCorrespondences);
+		ocean_assert(maximalValidInitialCorrespondences != 0u);
 
-	ocean_assert(correspondenceThresholdLowerBoundary >= 5u);
-	ocean_assert(maximalValidInitialCorrespondences < 10u || correspondenceThresholdLowerBoundary == 10u);
+		// normally 10 would be a good lower boundary; however, in extreme situations we cannot use more than the maximal number of correspondences, but 5 is the absolute minimum
+		const unsigned int correspondenceThresholdLowerBoundary = max(5u, min(10u, maximalValidInitialCorrespondences));
 
-	if (!extendInitialObjectPoints(camera_, database_, lowerFrameIndex_, upperFrameIndex_, Solver3::RelativeThreshold(correspondenceThresholdLowerBoundary, Scalar(0.3), 25u), &lowerPoseBorder, &upperPoseBorder, &shouldStop_))
-	{
-		Log::error() << "extendInitialObjectPoints() FAILED!";
-		return false;
-	}
+		ocean_assert(correspondenceThresholdLowerBoundary >= 5u);
+		ocean_assert(maximalValidInitialCorrespondences < 10u || correspondenceThresholdLowerBoundary == 10u);
 
-	maintenanceSendEnvironment();
+		if (!extendInitialObjectPoints(camera_, database_, lowerFrameIndex_, upperFrameIndex_, Solver3::RelativeThreshold(correspondenceThresholdLowerBoundary, Scalar(0.3), 25u), &lowerPoseBorder, &upperPoseBorder, &shouldStop_))
+		{
+			Log::error() << "extendInitialObjectPoints() FAILED!";
+			return false;
+		}
 
-	const bool findInitialFieldOfView = cameraOptimizationStrategy_ != PinholeCamera::OS_NONE && cameraFieldOfView_ < 0;
+		maintenanceSendEnvironment();
 
-	PinholeCamera optimizedCamera;
-	Database optimizedDatabase;
-	Solver3::CameraMotion cameraMotion = Solver3::CM_UNKNOWN;
+		storeCheckpoint(TS_INITIAL_OBJECT_POINTS, Solver3::CM_INVALID, lowerPoseBorder, upperPoseBorder);
+	}
+	else
+	{
+		scopedProgress.modify(Scalar(0.85));
+	}
 
 	scopedProgress.modify(Scalar(0.90));
 	localProgress_ = 0;
 
-	Scalar optimizedCameraFinalSqrError;
-	if (optimizeCamera(camera_, database_, lowerFrameIndex_, upperFrameIndex_, findInitialFieldOfView, cameraOptimizationStrategy_, min(25u, frameRangeNumber), optimizedCamera, optimizedDatabase, &cameraMotion, &shouldStop_, &optimizedCameraFinalSqrError))
+	if (resumeStage < TS_CAMERA_OPTIMIZATION)
 	{
-		camera_ = optimizedCamera;
-		database_ = std::move(optimizedDatabase);
+		const bool findInitialFieldOfView = cameraOptimizationStrategy_ != PinholeCamera::OS_NONE && cameraFieldOfView_ < 0;
 
-		maintenanceSendEnvironment();
+		PinholeCamera optimizedCamera;
+		Database optimizedDatabase;
 
-		Log::info() << "Database and camera profile updated with final error: " << optimizedCameraFinalSqrError;
-	}
-	else
-	{
-		if (Solver3::removeSparseObjectPoints(database_, Scalar(1e+7), Scalar(100), Scalar(0.10)))
+		Scalar optimizedCameraFinalSqrError;
+		if (optimizeCamera(camera_, database_, lowerFrameIndex_, upperFrameIndex_, findInitialFieldOfView, cameraOptimizationStrategy_, min(25u, frameRangeNumber), optimizedCamera, optimizedDatabase, &cameraMotion, &shouldStop_, &optimizedCameraFinalSqrError))
 		{
-			Log::info() << "We retry to optimize the profile of the camera as we have modified the database";
+			camera_ = optimizedCamera;
+			database_ = std::move(optimizedDatabase);
 
-			localProgress_ = 0;
+			maintenanceSendEnvironment();
 
-			if (optimizeCamera(camera_, database_, lowerFrameIndex_, upperFrameIndex_, findInitialFieldOfView, cameraOptimizationStrategy_, 25u, optimizedCamera, optimizedDatabase, &cameraMotion, &shouldStop_, &optimizedCameraFinalSqrError))
+			Log::info() << "Database and camera profile updated with final error: " << optimizedCameraFinalSqrError;
+		}
+		else
+		{
+			if (Solver3::removeSparseObjectPoints(database_, Scalar(1e+7), Scalar(100), Scalar(0.10)))
 			{
-				camera_ = optimizedCamera;
-				database_ = std::move(optimizedDatabase);
+				Log::info() << "We retry to optimize the profile of the camera as we have modified the database";
 
-				maintenanceSendEnvironment();
+				localProgress_ = 0;
+
+				if (optimizeCamera(camera_, database_, lowerFrameIndex_, upperFrameIndex_, findInitialFieldOfView, cameraOptimizationStrategy_, 25u, optimizedCamera, optimizedDatabase, &cameraMotion, &shouldStop_, &optimizedCameraFinalSqrError))
+				{
+					camera_ = optimizedCamera;
+					database_ = std::move(optimizedDatabase);
+
+					maintenanceSendEnvironment();
 
-				Log::info() << "Database and camera profile updated with final error: " << optimizedCameraFinalSqrError;
+					Log::info() << "Database and camera profile updated with final error: " << optimizedCameraFinalSqrError;
+				}
 			}
 		}
+
+		storeCheckpoint(TS_CAMERA_OPTIMIZATION, cameraMotion, lowerPoseBorder, upperPoseBorder);
 	}
 
 	scopedProgress.modify(Scalar(0.95));
 	localProgress_ = 0;
 
-	if (!extendStableObjectPoints(camera_, database_, randomGenerator, lowerFrameIndex_, upperFrameIndex_, cameraMotion, Solver3::RelativeThreshold(10u, Scalar(0.4), 25u), &lowerPoseBorder, &upperPoseBorder, &cameraMotion_, &shouldStop_, &localProgress_))
+	if (resumeStage < TS_STABLE_OBJECT_POINTS)
 	{
-		Log::error() << "extendStableObjectPoints() FAILED!";
-		return false;
+		bool segmentsReconstructed = false;
+
+		if (segmentSize_ != 0u && frameRangeNumber >= segmentSize_ * 2u)
+		{
+			segmentsReconstructed = extendStableObjectPointsSegmentParallel(camera_, database_, randomGenerator, lowerFrameIndex_, upperFrameIndex_, segmentSize_, segmentOverlap_, cameraMotion, &lowerPoseBorder, &upperPoseBorder, &cameraMotion_, WorkerPool::get().scopedWorker()(), &shouldStop_, &localProgress_);
+
+			if (!segmentsReconstructed)
+			{
+				Log::warning() << "extendStableObjectPointsSegmentParallel() failed, we continue with the sequential reconstruction";
+
+				localProgress_ = 0;
+			}
+		}
+
+		if (!segmentsReconstructed && !extendStableObjectPoints(camera_, database_, randomGenerator, lowerFrameIndex_, upperFrameIndex_, cameraMotion, Solver3::RelativeThreshold(10u, Scalar(0.4), 25u), &lowerPoseBorder, &upperPoseBorder, &cameraMotion_, &shouldStop_, &localProgress_))
+		{
+			Log::error() << "extendStableObjectPoints() FAILED!";
+			return false;
+		}
+
+		storeCheckpoint(TS_STABLE_OBJECT_POINTS, cameraMotion_, lowerPoseBorder, upperPoseBorder);
 	}
 
 	Index32 validLowerPoseIndex, validUpperPoseIndex;
@@ -1474,6 +1651,180 @@ bool SLAMTracker::extendStableObjectPoints(const PinholeCamera& pinholeCamera, D
 	return true;
 }
 
+bool SLAMTracker::extendStableObjectPointsSegmentParallel(const PinholeCamera& pinholeCamera, Database& database, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int upperFrame, const unsigned int segmentSize, const unsigned int segmentOverlap, const Solver3::CameraMotion cameraMotion, unsigned int* finalLowerValidPoseRange, unsigned int* finalUpperValidPoseRange, Solver3::CameraMotion* finalCameraMotion, Worker* worker, bool* abort, Scalar* progress)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(lowerFrame <= upperFrame);
+	ocean_assert(segmentOverlap >= 10u && segmentOverlap * 2u <= segmentSize);
+
+	const unsigned int frames = upperFrame - lowerFrame + 1u;
+
+	if (segmentOverlap < 10u || segmentOverlap * 2u > segmentSize || segmentSize > frames)
+	{
+		return false;
+	}
+
+	Log::info() << " ";
+	Log::info() << "Extending stable object points and camera poses in parallel segments with " << segmentSize << " frames";
+
+	// the segments are distributed uniformly over the entire frame range, neighboring segments overlap with at least 'segmentOverlap' frames
+
+	const unsigned int segmentStep = segmentSize - segmentOverlap;
+	const unsigned int numberSegments = (frames - segmentSize + segmentStep - 1u) / segmentStep + 1u;
+
+	IndexPairs32 segments;
+	segments.reserve(numberSegments);
+
+	for (unsigned int n = 0u; n < numberSegments; ++n)
+	{
+		const unsigned int segmentLowerFrame = numberSegments == 1u ? lowerFrame : lowerFrame + (unsigned int)((uint64_t(n) * uint64_t(frames - segmentSize)) / uint64_t(numberSegments - 1u));
+
+		segments.emplace_back(segmentLowerFrame, segmentLowerFrame + segmentSize - 1u);
+	}
+
+	ocean_assert(segments.front().first == lowerFrame && segments.back().second == upperFrame);
+
+	std::vector<Database> segmentDatabases(numberSegments);
+	std::vector<Solver3::CameraMotion> segmentCameraMotions(numberSegments, Solver3::CM_INVALID);
+
+	// the random generators of the segments are created up front so that the segments can be reconstructed concurrently without accessing the given random generator
+
+	std::vector<RandomGenerator> segmentRandomGenerators;
+	segmentRandomGenerators.reserve(numberSegments);
+
+	for (unsigned int n = 0u; n < numberSegments; ++n)
+	{
+		segmentRandomGenerators.emplace_back(randomGenerator);
+	}
+
+	// each segment is reconstructed with an own database, the worker reconstructs the segments concurrently
+	// the reconstruction steps of a segment request their own workers from the worker pool, or are executed single-threaded if the pool does not have a free worker
+
+	Lock segmentLock;
+	unsigned int reconstructedSegments = 0u;
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::createStatic(&SLAMTracker::reconstructSegmentsSubset, &pinholeCamera, (const Database*)(&database), segmentRandomGenerators.data(), cameraMotion, (const IndexPairs32*)(&segments), segmentDatabases.data(), segmentCameraMotions.data(), &segmentLock, &reconstructedSegments, abort, progress, 0u, 0u), 0u, numberSegments, 11u, 12u, 1u);
+	}
+	else
+	{
+		reconstructSegmentsSubset(&pinholeCamera, &database, segmentRandomGenerators.data(), cameraMotion, &segments, segmentDatabases.data(), segmentCameraMotions.data(), &segmentLock, &reconstructedSegments, abort, progress, 0u, numberSegments);
+	}
+
+	ocean_assert(reconstructedSegments == numberSegments || (abort != nullptr && *abort));
+
+	if (abort != nullptr && *abort)
+	{
+		return false;
+	}
+
+	// the segments are merged into a copy of the database, each segment needs enough shared object points with the database (or with already merged segments)
+
+	Database mergedDatabase(database);
+
+	// the merged camera motion contains the given camera motion and the motions of all merged segments
+
+	Solver3::CameraMotion mergedCameraMotion = cameraMotion;
+
+	std::vector<unsigned char> mergedSegments(numberSegments, 0u);
+	unsigned int numberMergedSegments = 0u;
+
+	bool mergedAnySegment = true;
+
+	while (mergedAnySegment)
+	{
+		mergedAnySegment = false;
+
+		for (unsigned int n = 0u; n < numberSegments; ++n)
+		{
+			if (mergedSegments[n] != 0u || segmentCameraMotions[n] == Solver3::CM_INVALID)
+			{
+				continue;
+			}
+
+			HomogenousMatrix4 world_T_segmentWorld(false);
+			Scalar scale = 0;
+
+			if (alignSegment(mergedDatabase, segmentDatabases[n], world_T_segmentWorld, scale))
+			{
+				mergeSegment(mergedDatabase, segmentDatabases[n], segments[n].first, segments[n].second, world_T_segmentWorld, scale);
+
+				mergedCameraMotion = Solver3::CameraMotion(mergedCameraMotion | segmentCameraMotions[n]);
+
+				mergedSegments[n] = 1u;
+				++numberMergedSegments;
+
+				mergedAnySegment = true;
+			}
+		}
+	}
+
+	Log::info() << "Merged " << numberMergedSegments << " of " << numberSegments << " segments";
+
+	if (numberMergedSegments == 0u)
+	{
+		return false;
+	}
+
+	if (abort != nullptr && *abort)
+	{
+		return false;
+	}
+
+	setProgress(progress, Scalar(0.85));
+
+	// finally, we refine the entire reconstruction with a bundle adjustment and update the camera poses of all frames
+
+	Vectors3 optimizedObjectPoints;
+	Indices32 optimizedObjectPointIds;
+
+	Scalar initialRobustError = Numeric::maxValue();
+	Scalar finalRobustError = Numeric::maxValue();
+
+	if (Solver3::optimizeObjectPointsWithVariablePoses(mergedDatabase, pinholeCamera, optimizedObjectPoints, optimizedObjectPointIds, nullptr, nullptr, 3u, std::max(20u, numberSegments * 10u), 3u, Geometry::Estimator::ET_SQUARE, 50u, &initialRobustError, &finalRobustError))
+	{
+		Log::info() << "Global refinement of " << optimizedObjectPointIds.size() << " object points with initial error " << initialRobustError << " and final error " << finalRobustError;
+
+		mergedDatabase.setObjectPoints<false>(optimizedObjectPointIds.data(), optimizedObjectPoints.data(), optimizedObjectPointIds.size());
+	}
+
+	setProgress(progress, Scalar(0.95));
+
+	if (!Solver3::updatePoses(mergedDatabase, AnyCameraPinhole(pinholeCamera), mergedCameraMotion, randomGenerator, lowerFrame, upperFrame, 5u, Geometry::Estimator::ET_SQUARE, Scalar(1), Scalar(3.5 * 3.5), Scalar(3.5 * 3.5), nullptr, nullptr, worker, abort))
+	{
+		return false;
+	}
+
+	unsigned int validLowerFrame = (unsigned int)(-1);
+	unsigned int validUpperFrame = (unsigned int)(-1);
+	if (!mergedDatabase.largestValidPoseRange<false>(lowerFrame, upperFrame, validLowerFrame, validUpperFrame))
+	{
+		return false;
+	}
+
+	database = std::move(mergedDatabase);
+
+	if (finalLowerValidPoseRange)
+	{
+		*finalLowerValidPoseRange = validLowerFrame;
+	}
+
+	if (finalUpperValidPoseRange)
+	{
+		*finalUpperValidPoseRange = validUpperFrame;
+	}
+
+	if (finalCameraMotion)
+	{
+		*finalCameraMotion = mergedCameraMotion;
+	}
+
+	setProgress(progress, Scalar(1));
+
+	return true;
+}
+
 bool SLAMTracker::removeInaccurateObjectPoints(const PinholeCamera& pinholeCamera, const Solver3::CameraMotion cameraMotion, Database& database, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int upperFrame, const unsigned int minimalCorrespondences, const Scalar minimalValidCorrespondenceRatio, const Scalar maximalAverageSqrError, const Scalar maximalWorstSqrError, const unsigned int iterations, unsigned int* finalLowerValidPoseRange, unsigned int* finalUpperValidPoseRange, bool* abort)
 {
 	ocean_assert(cameraMotion != Solver3::CM_INVALID);
@@ -3524,6 +3875,206 @@ bool SLAMTracker::extendStableObjectPointsPartiallyTranslational(const PinholeCa
 	return true;
 }
 
+bool SLAMTracker::reconstructSegment(const PinholeCamera& pinholeCamera, const Database& database, RandomGenerator& randomGenerator, const Solver3::CameraMotion cameraMotion, const unsigned int lowerFrame, const unsigned int upperFrame, Database& segmentDatabase, Solver3::CameraMotion& segmentCameraMotion, bool* abort)
+{
+	ocean_assert(pinholeCamera.isValid());
+	ocean_assert(lowerFrame <= upperFrame);
+
+	segmentCameraMotion = Solver3::CM_INVALID;
+
+	// the segment's database holds the topology of the segment's frame range only, without any object point location or camera pose
+
+	for (unsigned int frameIndex = lowerFrame; frameIndex <= upperFrame; ++frameIndex)
+	{
+		segmentDatabase.addPose<false>(frameIndex);
+	}
+
+	const Indices32 objectPointIds = database.objectPointIds<false, false, false>(lowerFrame, upperFrame, Vector3(Numeric::minValue(), Numeric::minValue(), Numeric::minValue()));
+
+	for (const Index32 objectPointId : objectPointIds)
+	{
+		segmentDatabase.addObjectPointFromDatabase(database, objectPointId, SquareMatrix3(true), objectPointId, lowerFrame, upperFrame, true /*forExistingPosesOnly*/);
+	}
+
+	segmentDatabase.setObjectPoints<false>();
+	segmentDatabase.setPoses<false>(HomogenousMatrix4(false));
+
+	unsigned int lowerPoseBorder = (unsigned int)(-1);
+	unsigned int upperPoseBorder = (unsigned int)(-1);
+
+	if (!determineInitialObjectPoints(pinholeCamera, segmentDatabase, randomGenerator, lowerFrame, nullptr, upperFrame, CV::SubRegion(), false, &lowerPoseBorder, &upperPoseBorder, abort))
+	{
+		Log::warning() << "Failed to determine initial object points for segment [" << lowerFrame << ", " << upperFrame << "]";
+		return false;
+	}
+
+	unsigned int maximalValidInitialCorrespondences = 0u;
+	segmentDatabase.poseWithMostCorrespondences<false, false, true>(lowerFrame, upperFrame, nullptr, &maximalValidInitialCorrespondences);
+
+	const unsigned int correspondenceThresholdLowerBoundary = std::max(5u, std::min(10u, maximalValidInitialCorrespondences));
+
+	if (!extendInitialObjectPoints(pinholeCamera, segmentDatabase, lowerFrame, upperFrame, Solver3::RelativeThreshold(correspondenceThresholdLowerBoundary, Scalar(0.3), 25u), &lowerPoseBorder, &upperPoseBorder, abort))
+	{
+		Log::warning() << "Failed to extend initial object points for segment [" << lowerFrame << ", " << upperFrame << "]";
+		return false;
+	}
+
+	if (!extendStableObjectPoints(pinholeCamera, segmentDatabase, randomGenerator, lowerFrame, upperFrame, cameraMotion, Solver3::RelativeThreshold(10u, Scalar(0.4), 25u), &lowerPoseBorder, &upperPoseBorder, &segmentCameraMotion, abort))
+	{
+		Log::warning() << "Failed to extend stable object points for segment [" << lowerFrame << ", " << upperFrame << "]";
+
+		segmentCameraMotion = Solver3::CM_INVALID;
+		return false;
+	}
+
+	return segmentCameraMotion != Solver3::CM_INVALID;
+}
+
+void SLAMTracker::reconstructSegmentsSubset(const PinholeCamera* pinholeCamera, const Database* database, RandomGenerator* segmentRandomGenerators, const Solver3::CameraMotion cameraMotion, const IndexPairs32* segments, Database* segmentDatabases, Solver3::CameraMotion* segmentCameraMotions, Lock* lock, unsigned int* reconstructedSegments, bool* abort, Scalar* progress, const unsigned int firstSegment, const unsigned int numberSegments)
+{
+	ocean_assert(pinholeCamera != nullptr && database != nullptr && segmentRandomGenerators != nullptr && segments != nullptr);
+	ocean_assert(segmentDatabases != nullptr && segmentCameraMotions != nullptr && lock != nullptr && reconstructedSegments != nullptr);
+	ocean_assert(firstSegment + numberSegments <= segments->size());
+
+	for (unsigned int n = firstSegment; n < firstSegment + numberSegments; ++n)
+	{
+		if (abort != nullptr && *abort)
+		{
+			return;
+		}
+
+		const IndexPair32& segment = (*segments)[n];
+
+		if (!reconstructSegment(*pinholeCamera, *database, segmentRandomGenerators[n], cameraMotion, segment.first, segment.second, segmentDatabases[n], segmentCameraMotions[n], abort))
+		{
+			segmentCameraMotions[n] = Solver3::CM_INVALID;
+		}
+
+		const ScopedLock scopedLock(*lock);
+
+		++*reconstructedSegments;
+
+		setProgress(progress, Scalar(0.8) * Scalar(*reconstructedSegments) / Scalar(segments->size()));
+	}
+}
+
+bool SLAMTracker::alignSegment(const Database& database, const Database& segmentDatabase, HomogenousMatrix4& world_T_segmentWorld, Scalar& scale)
+{
+	constexpr size_t minimalSharedObjectPoints = 10;
+
+	Vectors3 segmentObjectPoints;
+	const Indices32 segmentObjectPointIds = segmentDatabase.objectPointIds<false, false>(Database::invalidObjectPoint(), &segmentObjectPoints);
+
+	Vectors3 sharedSegmentObjectPoints;
+	Vectors3 sharedObjectPoints;
+
+	sharedSegmentObjectPoints.reserve(segmentObjectPointIds.size());
+	sharedObjectPoints.reserve(segmentObjectPointIds.size());
+
+	for (size_t n = 0; n < segmentObjectPointIds.size(); ++n)
+	{
+		Vector3 objectPoint;
+		if (database.hasObjectPoint<false>(segmentObjectPointIds[n], &objectPoint) && objectPoint != Database::invalidObjectPoint())
+		{
+			sharedSegmentObjectPoints.push_back(segmentObjectPoints[n]);
+			sharedObjectPoints.push_back(objectPoint);
+		}
+	}
+
+	if (sharedObjectPoints.size() < minimalSharedObjectPoints)
+	{
+		return false;
+	}
+
+	// the segment has an arbitrary scale and may contain some inaccurate object points, so we determine the similarity transformation iteratively and remove object points with large errors
+
+	Scalars sqrErrors(sharedObjectPoints.size());
+
+	for (unsigned int iteration = 0u; iteration < 3u; ++iteration)
+	{
+		if (!Geometry::AbsoluteTransformation::calculateTransformation(sharedSegmentObjectPoints.data(), sharedObjectPoints.data(), sharedObjectPoints.size(), world_T_segmentWorld, Geometry::AbsoluteTransformation::ScaleErrorType::Symmetric, &scale) || scale <= Numeric::eps())
+		{
+			return false;
+		}
+
+		sqrErrors.resize(sharedObjectPoints.size());
+
+		for (size_t n = 0; n < sharedObjectPoints.size(); ++n)
+		{
+			sqrErrors[n] = sharedObjectPoints[n].sqrDistance(world_T_segmentWorld * (sharedSegmentObjectPoints[n] * scale));
+		}
+
+		Scalars sortedSqrErrors(sqrErrors);
+		const Scalar medianSqrError = Median::median(sortedSqrErrors.data(), sortedSqrErrors.size());
+
+		const Scalar maximalSqrError = std::max(medianSqrError * Scalar(9), Numeric::weakEps());
+
+		size_t validIndex = 0;
+
+		for (size_t n = 0; n < sharedObjectPoints.size(); ++n)
+		{
+			if (sqrErrors[n] <= maximalSqrError)
+			{
+				sharedSegmentObjectPoints[validIndex] = sharedSegmentObjectPoints[n];
+				sharedObjectPoints[validIndex] = sharedObjectPoints[n];
+				++validIndex;
+			}
+		}
+
+		if (validIndex < minimalSharedObjectPoints)
+		{
+			return false;
+		}
+
+		if (validIndex == sharedObjectPoints.size())
+		{
+			break;
+		}
+
+		sharedSegmentObjectPoints.resize(validIndex);
+		sharedObjectPoints.resize(validIndex);
+	}
+
+	return world_T_segmentWorld.isValid();
+}
+
+void SLAMTracker::mergeSegment(Database& database, const Database& segmentDatabase, const unsigned int lowerFrame, const unsigned int upperFrame, const HomogenousMatrix4& world_T_segmentWorld, const Scalar scale)
+{
+	ocean_assert(lowerFrame <= upperFrame);
+	ocean_assert(world_T_segmentWorld.isValid() && scale > Numeric::eps());
+
+	const Quaternion world_Q_segmentWorld = world_T_segmentWorld.rotation();
+
+	for (unsigned int frameIndex = lowerFrame; frameIndex <= upperFrame; ++frameIndex)
+	{
+		HomogenousMatrix4 segmentWorld_T_camera(false);
+		if (!segmentDatabase.hasPose<false>(frameIndex, &segmentWorld_T_camera) || !segmentWorld_T_camera.isValid())
+		{
+			continue;
+		}
+
+		HomogenousMatrix4 world_T_camera(false);
+		if (database.hasPose<false>(frameIndex, &world_T_camera) && world_T_camera.isValid())
+		{
+			continue;
+		}
+
+		database.setPose<false>(frameIndex, HomogenousMatrix4(world_T_segmentWorld * (segmentWorld_T_camera.translation() * scale), world_Q_segmentWorld * segmentWorld_T_camera.rotation()));
+	}
+
+	Vectors3 segmentObjectPoints;
+	const Indices32 segmentObjectPointIds = segmentDatabase.objectPointIds<false, false>(Database::invalidObjectPoint(), &segmentObjectPoints);
+
+	for (size_t n = 0; n < segmentObjectPointIds.size(); ++n)
+	{
+		Vector3 objectPoint;
+		if (database.hasObjectPoint<false>(segmentObjectPointIds[n], &objectPoint) && objectPoint == Database::invalidObjectPoint())
+		{
+			database.setObjectPoint<false>(segmentObjectPointIds[n], world_T_segmentWorld * (segmentObjectPoints[n] * scale));
+		}
+	}
+}
+
 void SLAMTracker::extractObjectPointsWithMostObservations(const Indices32& objectPointIds, const Vectors3& objectPoints, const Indices32& objectPointObservations, const size_t subsetSize, Indices32& bestObjectPointIds, Vectors3& bestObjectPoints)
 {
 	ocean_assert(objectPointIds.size() == objectPoints.size());
@@ -3672,6 +4223,141 @@ bool SLAMTracker::adjustPlaneTransformationToRegionOfInterest(const PinholeCamer
 	return true;
 }
 
+void SLAMTracker::storeCheckpoint(const TrackingStage stage, const Solver3::CameraMotion cameraMotion, const unsigned int lowerPoseBorder, const unsigned int upperPoseBorder) const
+{
+	ocean_assert(stage != TS_NONE);
+
+	if (checkpointPrefix_.empty())
+	{
+		return;
+	}
+
+	const std::string filename = checkpointFilename(checkpointPrefix_, stage);
+
+	if (writeCheckpoint(filename, stage, lowerFrameIndex_, upperFrameIndex_, camera_, database_, cameraMotion, lowerPoseBorder, upperPoseBorder))
+	{
+		Log::info() << "Stored checkpoint '" << filename << "'";
+	}
+	else
+	{
+		Log::warning() << "Failed to store the checkpoint '" << filename << "'";
+	}
+}
+
+bool SLAMTracker::writeCheckpoint(const std::string& filename, const TrackingStage stage, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const PinholeCamera& pinholeCamera, const Database& database, const Solver3::CameraMotion cameraMotion, const unsigned int lowerPoseBorder, const unsigned int upperPoseBorder)
+{
+	ocean_assert(!filename.empty());
+	ocean_assert(stage != TS_NONE);
+
+	const std::string temporaryFilename = filename + ".tmp";
+
+	{
+		std::ofstream stream(temporaryFilename.c_str(), std::ios::binary);
+
+		if (!stream.is_open())
+		{
+			return false;
+		}
+
+		IO::OutputBitstream outputStream(stream);
+
+		constexpr unsigned int version = 1u;
+
+		if (!outputStream.write<std::string>("OCN_SLAM_TRACKER_CHECKPOINT") || !outputStream.write<unsigned int>(version))
+		{
+			return false;
+		}
+
+		if (!outputStream.write<unsigned int>((unsigned int)(stage)) || !outputStream.write<unsigned int>(lowerFrameIndex) || !outputStream.write<unsigned int>(upperFrameIndex))
+		{
+			return false;
+		}
+
+		if (!outputStream.write<unsigned int>((unsigned int)(cameraMotion)) || !outputStream.write<unsigned int>(lowerPoseBorder) || !outputStream.write<unsigned int>(upperPoseBorder))
+		{
+			return false;
+		}
+
+		if (!Utilities::writeCamera(pinholeCamera, outputStream) || !Utilities::writeDatabase(database, outputStream))
+		{
+			return false;
+		}
+
+		stream.flush();
+
+		if (!stream.good())
+		{
+			return false;
+		}
+	}
+
+	// the temporary file replaces an existing checkpoint file atomically
+
+#ifdef _WINDOWS
+	return MoveFileExW(String::toWString(temporaryFilename).c_str(), String::toWString(filename).c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == TRUE;
+#else
+	return std::rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+#endif
+}
+
+bool SLAMTracker::readCheckpoint(const std::string& filename, Checkpoint& checkpoint)
+{
+	ocean_assert(!filename.empty());
+
+	std::ifstream stream(filename.c_str(), std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	IO::InputBitstream inputStream(stream);
+
+	std::string tag;
+	if (!inputStream.read<std::string>(tag) || tag != "OCN_SLAM_TRACKER_CHECKPOINT")
+	{
+		return false;
+	}
+
+	unsigned int version = 0u;
+	if (!inputStream.read<unsigned int>(version) || version != 1u)
+	{
+		return false;
+	}
+
+	unsigned int stage = 0u;
+	unsigned int cameraMotion = 0u;
+
+	Checkpoint newCheckpoint;
+
+	if (!inputStream.read<unsigned int>(stage) || !inputStream.read<unsigned int>(newCheckpoint.lowerFrameIndex_) || !inputStream.read<unsigned int>(newCheckpoint.upperFrameIndex_))
+	{
+		return false;
+	}
+
+	if (stage == TS_NONE || stage > TS_STABLE_OBJECT_POINTS || newCheckpoint.lowerFrameIndex_ > newCheckpoint.upperFrameIndex_)
+	{
+		return false;
+	}
+
+	if (!inputStream.read<unsigned int>(cameraMotion) || !inputStream.read<unsigned int>(newCheckpoint.lowerPoseBorder_) || !inputStream.read<unsigned int>(newCheckpoint.upperPoseBorder_))
+	{
+		return false;
+	}
+
+	if (!Utilities::readCamera(inputStream, newCheckpoint.camera_) || !newCheckpoint.camera_.isValid() || !Utilities::readDatabase(inputStream, newCheckpoint.database_))
+	{
+		return false;
+	}
+
+	newCheckpoint.stage_ = TrackingStage(stage);
+	newCheckpoint.cameraMotion_ = Solver3::CameraMotion(cameraMotion);
+
+	checkpoint = std::move(newCheckpoint);
+
+	return true;
+}
+
 void SLAMTracker::maintenanceSendEnvironment()
 {
 	if (Maintenance::get().isActive())
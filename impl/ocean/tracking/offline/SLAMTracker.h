@@ -23,6 +23,9 @@
 namespace Ocean
 {
 
+// Forward declaration for test library.
+namespace Test { namespace TestTracking { class TestSLAMTracker; } }
+
 namespace Tracking
 {
 
@@ -48,6 +51,8 @@ using SLAMTrackerRef = SmartObjectRef<SLAMTracker, OfflineTracker>;
  */
 class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 {
+	friend class Test::TestTracking::TestSLAMTracker;
+
 	public:
 
 		/**
@@ -55,8 +60,66 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		 */
 		using TransformationMap = std::map<unsigned int, HomogenousMatrix4>;
 
+		/**
+		 * Definition of individual stages of the tracking pipeline after which the tracker can store a checkpoint.
+		 * The stages are ordered, a checkpoint of a stage contains the state of the tracker after the stage has finished.
+		 */
+		enum TrackingStage : uint32_t
+		{
+			/// No stage has finished.
+			TS_NONE = 0u,
+			/// The point paths have been determined.
+			TS_POINT_PATHS,
+			/// The initial object points have been determined and extended.
+			TS_INITIAL_OBJECT_POINTS,
+			/// The camera profile has been optimized.
+			TS_CAMERA_OPTIMIZATION,
+			/// The stable object points and camera poses have been determined for the entire frame range.
+			TS_STABLE_OBJECT_POINTS
+		};
+
 	protected:
 
+		/**
+		 * This class holds the state of the tracker after a finished tracking stage.
+		 */
+		class Checkpoint
+		{
+			public:
+
+				/**
+				 * Returns whether this checkpoint holds a state.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			public:
+
+				/// The tracking stage after which the checkpoint has been stored.
+				TrackingStage stage_ = TS_NONE;
+
+				/// The index of the lower frame of the tracker's frame range.
+				unsigned int lowerFrameIndex_ = (unsigned int)(-1);
+
+				/// The index of the upper frame of the tracker's frame range.
+				unsigned int upperFrameIndex_ = (unsigned int)(-1);
+
+				/// The camera profile of the tracker.
+				PinholeCamera camera_;
+
+				/// The database of the tracker.
+				Database database_;
+
+				/// The camera motion which has been determined so far.
+				Solver3::CameraMotion cameraMotion_ = Solver3::CM_INVALID;
+
+				/// The index of the lower frame of the valid pose range.
+				unsigned int lowerPoseBorder_ = (unsigned int)(-1);
+
+				/// The index of the upper frame of the valid pose range.
+				unsigned int upperPoseBorder_ = (unsigned int)(-1);
+		};
+
 		/**
 		 * This class implements a pair of thresholds.
 		 */
@@ -211,6 +274,49 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		 */
 		bool setRegionOfInterest(const CV::SubRegion& regionOfInterest, const bool soleApplication);
 
+		/**
+		 * Enables or disables the segment-parallel reconstruction of this tracker.
+		 * In the segment-parallel reconstruction, the frame range is split into overlapping segments which are reconstructed independently of each other, each segment with an own database.<br>
+		 * Afterwards, the segments are aligned and merged via shared object points, and the entire reconstruction is refined.<br>
+		 * The segment-parallel reconstruction is applied only if the frame range covers at least two segments.<br>
+		 * The mode must be set before the tracker starts.
+		 * @param segmentSize The number of frames in each segment, 0 to disable the segment-parallel reconstruction, with range [50, infinity) or 0
+		 * @param segmentOverlap The number of frames shared by two neighboring segments, with range [10, segmentSize / 2]
+		 * @return True, if succeeded
+		 * @see extendStableObjectPointsSegmentParallel().
+		 */
+		bool setSegmentParallelization(const unsigned int segmentSize, const unsigned int segmentOverlap = 30u);
+
+		/**
+		 * Enables or disables checkpoints for this tracker.
+		 * Whenever a tracking stage has finished, the tracker writes the entire state (camera profile, database, camera motion and valid pose range) to '<checkpointPrefix>_<stage>.ockp'.<br>
+		 * Checkpoints allow to resume the tracker after a crash, or to re-run later stages with modified parameters, see setResumeCheckpoint().<br>
+		 * The checkpoints must be set before the tracker starts.
+		 * @param checkpointPrefix The prefix of the checkpoint files including the path, an empty prefix to disable checkpoints
+		 * @return True, if succeeded
+		 * @see checkpointFilename().
+		 */
+		bool setCheckpointPrefix(const std::string& checkpointPrefix);
+
+		/**
+		 * Sets a checkpoint from which the tracker will resume when started the next time.
+		 * All stages up to (and including) the stage of the checkpoint are skipped, all later stages are applied.<br>
+		 * The checkpoint is ignored if it does not match the frame range or the frame dimension of the tracker.<br>
+		 * The checkpoint must be set before the tracker starts, the checkpoint is used for one run only.
+		 * @param filename The filename of the checkpoint, an empty filename to remove a checkpoint which has been set before
+		 * @return True, if succeeded
+		 * @see setCheckpointPrefix().
+		 */
+		bool setResumeCheckpoint(const std::string& filename);
+
+		/**
+		 * Returns the filename of a checkpoint for a specific tracking stage.
+		 * @param checkpointPrefix The prefix of the checkpoint file including the path, must not be empty
+		 * @param stage The tracking stage of the checkpoint, must not be TS_NONE
+		 * @return The filename of the checkpoint
+		 */
+		static std::string checkpointFilename(const std::string& checkpointPrefix, const TrackingStage stage);
+
 		/**
 		 * Extracts the poses from this tracker for a specified frame range not considering any specific region of interest.
 		 * Beware: The tracker must have finished before calling this function!<br>
@@ -340,6 +446,31 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		 */
 		static bool extendStableObjectPoints(const PinholeCamera& pinholeCamera, Database& database, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int upperFrame, const Solver3::CameraMotion cameraMotion = Solver3::CM_UNKNOWN, const Solver3::RelativeThreshold& correspondenceThreshold = Solver3::RelativeThreshold(10u, Scalar(0.5), 25u), unsigned int* finalLowerValidPoseRange = nullptr, unsigned int* finalUpperValidPoseRange = nullptr, Solver3::CameraMotion* finalCameraMotion = nullptr, bool* abort = nullptr, Scalar* progress = nullptr);
 
+		/**
+		 * This function extends a database with stable 3D object points and camera poses for a large frame range by reconstructing overlapping segments of the frame range independently of each other.
+		 * Each segment is reconstructed with an own database and an own random generator (initial object points, initial extension, and stable extension), the segments are reconstructed concurrently if a worker is provided.<br>
+		 * Afterwards, the segments are aligned with a similarity transformation determined from object points shared with the given database (or with already merged segments).<br>
+		 * Finally, the object points and camera poses of the merged database are refined with a bundle adjustment and the camera poses are updated for the entire frame range.<br>
+		 * Object points and camera poses which are valid in the given database already are not changed by the merging step.
+		 * @param pinholeCamera The pinhole camera profile providing e.g., the dimension of the camera frame and the projection model
+		 * @param database The database providing the image point positions, the topology information and some stable/reliable 3D object point locations and camera pose values, will be modified only if this function succeeds
+		 * @param randomGenerator Random generator object
+		 * @param lowerFrame The index of the lower frame border of the range of camera frames which will be investigated, with range [0, upperFrame]
+		 * @param upperFrame The index of the upper frame border of the range of camera frames which will be investigated, with range [lowerFrame, infinity)
+		 * @param segmentSize The number of frames in each segment, with range [50, upperFrame - lowerFrame + 1]
+		 * @param segmentOverlap The number of frames shared by two neighboring segments, with range [10, segmentSize / 2]
+		 * @param cameraMotion The camera motion (if known) for which stable object points will be extended/added, CM_UNKNOWN if the motion is not known
+		 * @param finalLowerValidPoseRange Optional resulting index of the lower frame within the resulting valid range of camera poses, with range [lowerFrame, upperFrame]
+		 * @param finalUpperValidPoseRange Optional resulting index of the upper frame within the resulting valid range of camera poses, with range [lowerValidPose, upperFrame]
+		 * @param finalCameraMotion Optional resulting motion of the camera, the combination of the given camera motion and the motions of all merged segments
+		 * @param worker Optional worker object to reconstruct the segments concurrently and to distribute the computation of the final pose update
+		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
+		 * @param progress Optional resulting progress with range [0, 1]
+		 * @return True, if at least one segment could be reconstructed and merged
+		 * @see extendStableObjectPoints().
+		 */
+		static bool extendStableObjectPointsSegmentParallel(const PinholeCamera& pinholeCamera, Database& database, RandomGenerator& randomGenerator, const unsigned int lowerFrame, const unsigned int upperFrame, const unsigned int segmentSize, const unsigned int segmentOverlap, const Solver3::CameraMotion cameraMotion = Solver3::CM_UNKNOWN, unsigned int* finalLowerValidPoseRange = nullptr, unsigned int* finalUpperValidPoseRange = nullptr, Solver3::CameraMotion* finalCameraMotion = nullptr, Worker* worker = nullptr, bool* abort = nullptr, Scalar* progress = nullptr);
+
 		/**
 		 * Removes all inaccurate locations of 3D object points from a given database.
 		 * The topology will be left unchanged but the location is invalidated.<br>
@@ -631,6 +762,64 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		 */
 		static bool extendStableObjectPointsPartiallyTranslational(const PinholeCamera& pinholeCamera, Database& database, const unsigned int lowerFrame, const unsigned int upperFrame, const Solver3::RelativeThreshold& correspondenceThreshold = Solver3::RelativeThreshold(10u, Scalar(0.5), 25u), unsigned int* finalLowerValidPoseRange = nullptr, unsigned int* finalUpperValidPoseRange = nullptr, bool* abort = nullptr, Scalar* progress = nullptr);
 
+		/**
+		 * Reconstructs one segment with an own database.
+		 * The segment's database receives the topology of the segment's frame range, afterwards the initial object points are determined and extended, and the stable object points are extended.
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param database The database providing the image point positions and the topology information of the entire frame range
+		 * @param randomGenerator Random generator object
+		 * @param cameraMotion The camera motion (if known), CM_UNKNOWN if the motion is not known
+		 * @param lowerFrame The index of the lower frame of the segment
+		 * @param upperFrame The index of the upper frame of the segment, with range [lowerFrame, infinity)
+		 * @param segmentDatabase The resulting database of the segment, must be empty
+		 * @param segmentCameraMotion The resulting camera motion of the segment, CM_INVALID if the reconstruction failed
+		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
+		 * @return True, if succeeded
+		 */
+		static bool reconstructSegment(const PinholeCamera& pinholeCamera, const Database& database, RandomGenerator& randomGenerator, const Solver3::CameraMotion cameraMotion, const unsigned int lowerFrame, const unsigned int upperFrame, Database& segmentDatabase, Solver3::CameraMotion& segmentCameraMotion, bool* abort);
+
+		/**
+		 * Reconstructs a subset of the segments, each segment with an own database and an own random generator.
+		 * @param pinholeCamera The pinhole camera profile to be used, must be valid
+		 * @param database The database providing the image point positions and the topology information of the entire frame range, must be valid
+		 * @param segmentRandomGenerators The random generators of all segments, one for each segment, must be valid
+		 * @param cameraMotion The camera motion (if known), CM_UNKNOWN if the motion is not known
+		 * @param segments The lower and upper frames of all segments, must be valid
+		 * @param segmentDatabases The resulting databases of all segments, one for each segment, must be valid
+		 * @param segmentCameraMotions The resulting camera motions of all segments, one for each segment, must be valid
+		 * @param lock The lock for the number of reconstructed segments and the progress, must be valid
+		 * @param reconstructedSegments The number of segments which have been handled already, will be increased for each handled segment, must be valid
+		 * @param abort Optional abort statement allowing to stop the execution; True, if the execution has to stop
+		 * @param progress Optional resulting progress with range [0, 0.8]
+		 * @param firstSegment The index of the first segment to be reconstructed
+		 * @param numberSegments The number of segments to be reconstructed
+		 * @see reconstructSegment().
+		 */
+		static void reconstructSegmentsSubset(const PinholeCamera* pinholeCamera, const Database* database, RandomGenerator* segmentRandomGenerators, const Solver3::CameraMotion cameraMotion, const IndexPairs32* segments, Database* segmentDatabases, Solver3::CameraMotion* segmentCameraMotions, Lock* lock, unsigned int* reconstructedSegments, bool* abort, Scalar* progress, const unsigned int firstSegment, const unsigned int numberSegments);
+
+		/**
+		 * Determines the similarity transformation between the coordinate system of a segment and the coordinate system of a database via shared object points.
+		 * The transformation is determined iteratively, shared object points with large alignment errors are removed in each iteration.
+		 * @param database The database providing the reference object points
+		 * @param segmentDatabase The database of the segment
+		 * @param world_T_segmentWorld The resulting transformation between segment and database without scale, with: worldPoint = world_T_segmentWorld * (segmentWorldPoint * scale)
+		 * @param scale The resulting scale between segment and database
+		 * @return True, if enough shared object points exist so that the segment could be aligned
+		 */
+		static bool alignSegment(const Database& database, const Database& segmentDatabase, HomogenousMatrix4& world_T_segmentWorld, Scalar& scale);
+
+		/**
+		 * Merges the camera poses and object points of an aligned segment into a database.
+		 * Camera poses and object points which are valid in the database already are not changed.
+		 * @param database The database receiving the camera poses and object points of the segment
+		 * @param segmentDatabase The database of the segment
+		 * @param lowerFrame The index of the lower frame of the segment
+		 * @param upperFrame The index of the upper frame of the segment, with range [lowerFrame, infinity)
+		 * @param world_T_segmentWorld The transformation between segment and database without scale
+		 * @param scale The scale between segment and database, with range (0, infinity)
+		 */
+		static void mergeSegment(Database& database, const Database& segmentDatabase, const unsigned int lowerFrame, const unsigned int upperFrame, const HomogenousMatrix4& world_T_segmentWorld, const Scalar scale);
+
 		/**
 		 * Extracts a subset of object point ids and object points from a large set of object point ids, object points and their corresponding number of observations so that the subset contains object points with most observations.
 		 * This functions sorts the number of observations so that the object points with most observations (hopefully the most stable object points) can be returned.
@@ -662,6 +851,42 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		 */
 		static bool adjustPlaneTransformationToRegionOfInterest(const PinholeCamera& pinholeCamera, const HomogenousMatrix4& pose, const CV::SubRegion& regionOfInterest, HomogenousMatrix4& planeTransformation);
 
+		/**
+		 * Writes the checkpoint of a finished tracking stage, if checkpoints are enabled.
+		 * The tracker continues in case the checkpoint cannot be written.
+		 * @param stage The tracking stage which has finished, must not be TS_NONE
+		 * @param cameraMotion The camera motion which has been determined so far
+		 * @param lowerPoseBorder The index of the lower frame of the valid pose range
+		 * @param upperPoseBorder The index of the upper frame of the valid pose range
+		 */
+		void storeCheckpoint(const TrackingStage stage, const Solver3::CameraMotion cameraMotion, const unsigned int lowerPoseBorder, const unsigned int upperPoseBorder) const;
+
+		/**
+		 * Writes a checkpoint to a file.
+		 * The checkpoint is written to a temporary file first which atomically replaces the checkpoint file afterwards, so that an existing checkpoint file is not corrupted if the process stops while writing.
+		 * @param filename The filename of the checkpoint, must not be empty
+		 * @param stage The tracking stage after which the checkpoint is stored, must not be TS_NONE
+		 * @param lowerFrameIndex The index of the lower frame of the tracker's frame range
+		 * @param upperFrameIndex The index of the upper frame of the tracker's frame range, with range [lowerFrameIndex, infinity)
+		 * @param pinholeCamera The camera profile to write
+		 * @param database The database to write
+		 * @param cameraMotion The camera motion to write
+		 * @param lowerPoseBorder The index of the lower frame of the valid pose range
+		 * @param upperPoseBorder The index of the upper frame of the valid pose range
+		 * @return True, if succeeded
+		 * @see readCheckpoint().
+		 */
+		static bool writeCheckpoint(const std::string& filename, const TrackingStage stage, const unsigned int lowerFrameIndex, const unsigned int upperFrameIndex, const PinholeCamera& pinholeCamera, const Database& database, const Solver3::CameraMotion cameraMotion, const unsigned int lowerPoseBorder, const unsigned int upperPoseBorder);
+
+		/**
+		 * Reads a checkpoint from a file.
+		 * @param filename The filename of the checkpoint, must not be empty
+		 * @param checkpoint The resulting checkpoint
+		 * @return True, if succeeded
+		 * @see writeCheckpoint().
+		 */
+		static bool readCheckpoint(const std::string& filename, Checkpoint& checkpoint);
+
 		/**
 		 * Sends environment information to the maintenance manager.
 		 */
@@ -696,6 +921,18 @@ class OCEAN_TRACKING_OFFLINE_EXPORT SLAMTracker : public FrameTracker
 		// True, if the tracker uses only the region of interest and not the remaining frame information for tracking
 		bool soleRegionOfInterestApplication_ = false;
 
+		/// The number of frames in each segment of the segment-parallel reconstruction, 0 if the segment-parallel reconstruction is disabled.
+		unsigned int segmentSize_ = 0u;
+
+		/// The number of frames shared by two neighboring segments of the segment-parallel reconstruction.
+		unsigned int segmentOverlap_ = 30u;
+
+		/// The prefix of the checkpoint files of this tracker, an empty prefix if checkpoints are disabled.
+		std::string checkpointPrefix_;
+
+		/// The checkpoint from which the tracker resumes in the next run, an invalid checkpoint to start from scratch.
+		Checkpoint resumeCheckpoint_;
+
 		/// The progress of this tracker for the current sub-task, with range [0, 1], -1 if undefined.
 		Scalar localProgress_ = Scalar(-1);
 
@@ -727,6 +964,11 @@ inline unsigned int SLAMTracker::ReliabilityPair::minimalObservations(const unsi
 	return max(min(tLowerBoundary, overallObservation), (unsigned int)(Scalar(overallObservation) * minimalObservationRatio_));
 }
 
+inline bool SLAMTracker::Checkpoint::isValid() const
+{
+	return stage_ != TS_NONE;
+}
+
 inline const CV::SubRegion& SLAMTracker::regionOfInterest() const
 {
 	return regionOfInterest_;
@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/offline/SharedFrameProviderInterface.h"
+
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/cv/FrameConverter.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace Offline
+{
+
+SharedFrameProviderInterface::SharedFrameProviderInterface(const CV::FrameProviderInterfaceRef& frameProviderInterface, const size_t memoryBudget, const unsigned int prefetchFrames) :
+	frameProviderInterface_(frameProviderInterface),
+	memoryBudget_(memoryBudget),
+	prefetchFrames_(prefetchFrames)
+{
+	ocean_assert(frameProviderInterface_);
+	ocean_assert(memoryBudget_ >= 1);
+
+	if (frameProviderInterface_)
+	{
+		frameProviderInterface_->registerFrameCallback(FrameCallback::create(*this, &SharedFrameProviderInterface::onFrame));
+		frameProviderInterface_->registerFrameNumberCallback(FrameNumberCallback::create(*this, &SharedFrameProviderInterface::onFrameNumber));
+		frameProviderInterface_->registerFrameTypeCallback(FrameTypeCallback::create(*this, &SharedFrameProviderInterface::onFrameType));
+	}
+}
+
+SharedFrameProviderInterface::~SharedFrameProviderInterface()
+{
+	release();
+}
+
+bool SharedFrameProviderInterface::isInitialized()
+{
+	return frameProviderInterface_ && frameProviderInterface_->isInitialized();
+}
+
+bool SharedFrameProviderInterface::setPreferredFrameType(const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin)
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (!frameProviderInterface_)
+	{
+		return false;
+	}
+
+	if (preferredFrameTypeSet_)
+	{
+		// the frames are shared between several trackers, so that the frame type must not change once frames have been cached
+		return true;
+	}
+
+	preferredFrameTypeSet_ = frameProviderInterface_->setPreferredFrameType(pixelFormat, pixelOrigin);
+
+	return preferredFrameTypeSet_;
+}
+
+void SharedFrameProviderInterface::asynchronFrameRequest(const unsigned int index, const bool priority)
+{
+	ocean_assert(frameProviderInterface_);
+
+	FrameRef frame;
+
+	{
+		const ScopedLock scopedLock(lock_);
+
+		frame = cachedFrame(index);
+
+		if (frame)
+		{
+			++frameHits_;
+		}
+	}
+
+	if (frame)
+	{
+		frameCallbacks_(frame, index);
+	}
+	else if (frameProviderInterface_)
+	{
+		frameProviderInterface_->asynchronFrameRequest(index, priority);
+	}
+}
+
+FrameRef SharedFrameProviderInterface::synchronFrameRequest(const unsigned int index, const double timeout, bool* abort)
+{
+	ocean_assert(frameProviderInterface_);
+
+	if (!frameProviderInterface_)
+	{
+		return FrameRef();
+	}
+
+	const Timestamp startTimestamp(true);
+
+	while (true)
+	{
+		SharedPendingFrame pendingFrame;
+
+		{
+			const ScopedLock scopedLock(lock_);
+
+			const FrameRef frame = cachedFrame(index);
+
+			if (frame)
+			{
+				++frameHits_;
+				return frame;
+			}
+
+			const PendingFrameMap::const_iterator iPendingFrame = pendingFrames_.find(index);
+
+			if (iPendingFrame == pendingFrames_.cend())
+			{
+				// nobody else is requesting this frame, so that we request the frame on our own
+
+				pendingFrames_.emplace(index, std::make_shared<PendingFrame>());
+				++frameMisses_;
+
+				break;
+			}
+
+			pendingFrame = iPendingFrame->second;
+		}
+
+		// another tracker is requesting the frame currently, we wait until the request has finished
+
+		while (true)
+		{
+			const double remainingTime = timeout - double(Timestamp(true) - startTimestamp);
+
+			if ((abort != nullptr && *abort) || remainingTime <= 0.0)
+			{
+				return FrameRef();
+			}
+
+			// we wait in small steps only if the request can be aborted
+
+			const unsigned int waitTime = (unsigned int)(std::min(remainingTime * 1000.0 + 1.0, abort != nullptr ? 10.0 : 1000.0));
+
+			if (pendingFrame->signal_.wait(waitTime))
+			{
+				break;
+			}
+		}
+
+		// the signal wakes one waiting tracker only, so that we pass the signal on to the next waiting tracker
+
+		pendingFrame->signal_.pulse();
+	}
+
+	const FrameRef frame = frameProviderInterface_->synchronFrameRequest(index, timeout, abort);
+
+	const ScopedLock scopedLock(lock_);
+
+	if (frame)
+	{
+		addFrame(index, frame);
+	}
+
+	const PendingFrameMap::iterator iPendingFrame = pendingFrames_.find(index);
+	ocean_assert(iPendingFrame != pendingFrames_.end());
+
+	if (iPendingFrame != pendingFrames_.end())
+	{
+		iPendingFrame->second->signal_.pulse();
+
+		pendingFrames_.erase(iPendingFrame);
+	}
+
+	return frame;
+}
+
+void SharedFrameProviderInterface::frameCacheRequest(const unsigned int index, const int range)
+{
+	ocean_assert(frameProviderInterface_);
+
+	if (!frameProviderInterface_ || range == 0 || prefetchFrames_ == 0u)
+	{
+		return;
+	}
+
+	const unsigned int frames = std::min((unsigned int)(std::abs(range)), prefetchFrames_);
+
+	Indices32 missingFrameIndices;
+	missingFrameIndices.reserve(frames);
+
+	{
+		const ScopedLock scopedLock(lock_);
+
+		for (unsigned int n = 0u; n < frames; ++n)
+		{
+			if (range < 0 && n > index)
+			{
+				break;
+			}
+
+			const unsigned int frameIndex = range > 0 ? index + n : index - n;
+
+			if (frameMap_.find(frameIndex) == frameMap_.cend() && pendingFrames_.find(frameIndex) == pendingFrames_.cend())
+			{
+				missingFrameIndices.push_back(frameIndex);
+			}
+		}
+	}
+
+	// the requested frames arrive in onFrame()
+
+	for (const Index32 frameIndex : missingFrameIndices)
+	{
+		frameProviderInterface_->asynchronFrameRequest(frameIndex, false);
+	}
+}
+
+void SharedFrameProviderInterface::asynchronFrameNumberRequest()
+{
+	ocean_assert(frameProviderInterface_);
+
+	if (frameProviderInterface_)
+	{
+		frameProviderInterface_->asynchronFrameNumberRequest();
+	}
+}
+
+unsigned int SharedFrameProviderInterface::synchronFrameNumberRequest(const double timeout, bool* abort)
+{
+	ocean_assert(frameProviderInterface_);
+
+	if (!frameProviderInterface_)
+	{
+		return (unsigned int)(-1);
+	}
+
+	return frameProviderInterface_->synchronFrameNumberRequest(timeout, abort);
+}
+
+void SharedFrameProviderInterface::asynchronFrameTypeRequest()
+{
+	ocean_assert(frameProviderInterface_);
+
+	if (frameProviderInterface_)
+	{
+		frameProviderInterface_->asynchronFrameTypeRequest();
+	}
+}
+
+FrameType SharedFrameProviderInterface::synchronFrameTypeRequest(const double timeout, bool* abort)
+{
+	ocean_assert(frameProviderInterface_);
+
+	if (!frameProviderInterface_)
+	{
+		return FrameType();
+	}
+
+	return frameProviderInterface_->synchronFrameTypeRequest(timeout, abort);
+}
+
+SharedFrameProviderInterface::SharedFramePyramid SharedFrameProviderInterface::framePyramid(const unsigned int index, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const CV::FramePyramid::DownsamplingMode downsamplingMode, const unsigned int layers, Worker* worker, const double timeout, bool* abort)
+{
+	ocean_assert(pixelFormat != FrameType::FORMAT_UNDEFINED && pixelOrigin != FrameType::ORIGIN_INVALID);
+	ocean_assert(layers >= 1u);
+
+	const PyramidKey pyramidKey(index, pixelFormat, pixelOrigin, downsamplingMode, layers);
+
+	{
+		const ScopedLock scopedLock(lock_);
+
+		const PyramidMap::iterator iPyramid = pyramidMap_.find(pyramidKey);
+
+		if (iPyramid != pyramidMap_.cend())
+		{
+			iPyramid->second.lastUsage_ = ++usageCounter_;
+			++pyramidHits_;
+
+			return iPyramid->second.framePyramid_;
+		}
+	}
+
+	const FrameRef frame = synchronFrameRequest(index, timeout, abort);
+
+	if (!frame)
+	{
+		return nullptr;
+	}
+
+	Frame convertedFrame;
+	if (!CV::FrameConverter::Comfort::convert(*frame, pixelFormat, pixelOrigin, convertedFrame, CV::FrameConverter::CP_AVOID_COPY_IF_POSSIBLE, worker))
+	{
+		return nullptr;
+	}
+
+	std::shared_ptr<CV::FramePyramid> newFramePyramid = std::make_shared<CV::FramePyramid>();
+
+	if (!newFramePyramid->replace(convertedFrame, downsamplingMode, layers, true /*copyFirstLayer*/, worker))
+	{
+		return nullptr;
+	}
+
+	size_t pyramidMemory = 0;
+	for (unsigned int layerIndex = 0u; layerIndex < newFramePyramid->layers(); ++layerIndex)
+	{
+		pyramidMemory += size_t((*newFramePyramid)[layerIndex].frameTypeSize());
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	// two trackers may have created the same pyramid concurrently, in this case we keep the first pyramid
+
+	PyramidEntry& pyramidEntry = pyramidMap_[pyramidKey];
+
+	if (pyramidEntry.framePyramid_)
+	{
+		pyramidEntry.lastUsage_ = ++usageCounter_;
+		++pyramidHits_;
+
+		return pyramidEntry.framePyramid_;
+	}
+
+	pyramidEntry.framePyramid_ = std::move(newFramePyramid);
+	pyramidEntry.memory_ = pyramidMemory;
+	pyramidEntry.lastUsage_ = ++usageCounter_;
+
+	memoryUsage_ += pyramidMemory;
+	++pyramidMisses_;
+
+	SharedFramePyramid result = pyramidEntry.framePyramid_;
+
+	applyMemoryBudget();
+
+	return result;
+}
+
+size_t SharedFrameProviderInterface::memoryUsage() const
+{
+	const ScopedLock scopedLock(lock_);
+
+	return memoryUsage_;
+}
+
+void SharedFrameProviderInterface::statistics(uint64_t* frameHits, uint64_t* frameMisses, uint64_t* pyramidHits, uint64_t* pyramidMisses) const
+{
+	const ScopedLock scopedLock(lock_);
+
+	if (frameHits != nullptr)
+	{
+		*frameHits = frameHits_;
+	}
+
+	if (frameMisses != nullptr)
+	{
+		*frameMisses = frameMisses_;
+	}
+
+	if (pyramidHits != nullptr)
+	{
+		*pyramidHits = pyramidHits_;
+	}
+
+	if (pyramidMisses != nullptr)
+	{
+		*pyramidMisses = pyramidMisses_;
+	}
+}
+
+void SharedFrameProviderInterface::release()
+{
+	if (frameProviderInterface_)
+	{
+		frameProviderInterface_->unregisterFrameCallback(FrameCallback::create(*this, &SharedFrameProviderInterface::onFrame));
+		frameProviderInterface_->unregisterFrameNumberCallback(FrameNumberCallback::create(*this, &SharedFrameProviderInterface::onFrameNumber));
+		frameProviderInterface_->unregisterFrameTypeCallback(FrameTypeCallback::create(*this, &SharedFrameProviderInterface::onFrameType));
+	}
+
+	const ScopedLock scopedLock(lock_);
+
+	frameMap_.clear();
+	pyramidMap_.clear();
+
+	memoryUsage_ = 0;
+
+	frameProviderInterface_.release();
+}
+
+FrameRef SharedFrameProviderInterface::cachedFrame(const unsigned int index)
+{
+	const FrameMap::iterator iFrame = frameMap_.find(index);
+
+	if (iFrame == frameMap_.cend())
+	{
+		return FrameRef();
+	}
+
+	iFrame->second.lastUsage_ = ++usageCounter_;
+
+	return iFrame->second.frame_;
+}
+
+void SharedFrameProviderInterface::addFrame(const unsigned int index, const FrameRef& frame)
+{
+	ocean_assert(frame);
+
+	FrameEntry& frameEntry = frameMap_[index];
+
+	if (frameEntry.frame_)
+	{
+		// the frame has been cached already, e.g., by an asynchronous request
+		frameEntry.lastUsage_ = ++usageCounter_;
+		return;
+	}
+
+	frameEntry.frame_ = frame;
+	frameEntry.memory_ = size_t(frame->frameTypeSize());
+	frameEntry.lastUsage_ = ++usageCounter_;
+
+	memoryUsage_ += frameEntry.memory_;
+
+	applyMemoryBudget();
+}
+
+void SharedFrameProviderInterface::applyMemoryBudget()
+{
+	while (memoryUsage_ > memoryBudget_ && (!frameMap_.empty() || !pyramidMap_.empty()))
+	{
+		// we determine the least recently used frame and pyramid
+
+		FrameMap::iterator iOldestFrame = frameMap_.end();
+		for (FrameMap::iterator iFrame = frameMap_.begin(); iFrame != frameMap_.end(); ++iFrame)
+		{
+			if (iOldestFrame == frameMap_.end() || iFrame->second.lastUsage_ < iOldestFrame->second.lastUsage_)
+			{
+				iOldestFrame = iFrame;
+			}
+		}
+
+		PyramidMap::iterator iOldestPyramid = pyramidMap_.end();
+		for (PyramidMap::iterator iPyramid = pyramidMap_.begin(); iPyramid != pyramidMap_.end(); ++iPyramid)
+		{
+			if (iOldestPyramid == pyramidMap_.end() || iPyramid->second.lastUsage_ < iOldestPyramid->second.lastUsage_)
+			{
+				iOldestPyramid = iPyramid;
+			}
+		}
+
+		if (iOldestPyramid == pyramidMap_.end() || (iOldestFrame != frameMap_.end() && iOldestFrame->second.lastUsage_ < iOldestPyramid->second.lastUsage_))
+		{
+			ocean_assert(memoryUsage_ >= iOldestFrame->second.memory_);
+			memoryUsage_ -= iOldestFrame->second.memory_;
+
+			frameMap_.erase(iOldestFrame);
+		}
+		else
+		{
+			ocean_assert(memoryUsage_ >= iOldestPyramid->second.memory_);
+			memoryUsage_ -= iOldestPyramid->second.memory_;
+
+			pyramidMap_.erase(iOldestPyramid);
+		}
+	}
+}
+
+void SharedFrameProviderInterface::onFrame(FrameRef frame, const unsigned int index)
+{
+	if (frame)
+	{
+		const ScopedLock scopedLock(lock_);
+
+		addFrame(index, frame);
+	}
+
+	frameCallbacks_(frame, index);
+}
+
+void SharedFrameProviderInterface::onFrameNumber(const unsigned int frameNumber)
+{
+	frameNumberCallbacks_(frameNumber);
+}
+
+void SharedFrameProviderInterface::onFrameType(const FrameType& frameType)
+{
+	frameTypeCallbacks_(frameType);
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_OFFLINE_SHARED_FRAME_PROVIDER_INTERFACE_H
+#define META_OCEAN_TRACKING_OFFLINE_SHARED_FRAME_PROVIDER_INTERFACE_H
+
+#include "ocean/tracking/offline/Offline.h"
+
+#include "ocean/base/Lock.h"
+#include "ocean/base/Signal.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/FramePyramid.h"
+#include "ocean/cv/FrameProviderInterface.h"
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace Offline
+{
+
+/**
+ * This class implements a frame provider interface which shares decoded frames and frame pyramids between several offline trackers.
+ * The interface wraps an arbitrary frame provider interface (e.g., a Media::MovieFrameProviderInterface) and caches all frames which are delivered by the wrapped interface.<br>
+ * Further, the interface caches frame pyramids so that trackers applying the same pyramid configuration do not need to create the same pyramids several times.<br>
+ * Several trackers can use the same instance concurrently, e.g., a SLAMTracker and a PlanarRectangleTracker processing the same video, so that each frame is decoded only once.<br>
+ * The memory of all cached frames and pyramids is bounded by a memory budget, the least recently used frames and pyramids are removed first.<br>
+ * The preferred frame type of the wrapped interface is defined by the first tracker setting a preferred frame type, all trackers convert frames into their individual pixel formats anyway.
+ * @ingroup trackingoffline
+ */
+class OCEAN_TRACKING_OFFLINE_EXPORT SharedFrameProviderInterface : public CV::FrameProviderInterface
+{
+	public:
+
+		/**
+		 * Definition of a shared pointer holding a cached frame pyramid.
+		 * The pyramid must not be modified, the pyramid stays valid as long as the pointer exists (even if the pyramid has been removed from the cache).
+		 */
+		using SharedFramePyramid = std::shared_ptr<const CV::FramePyramid>;
+
+	protected:
+
+		/**
+		 * This class holds a cached frame.
+		 */
+		class FrameEntry
+		{
+			public:
+
+				/// The cached frame.
+				FrameRef frame_;
+
+				/// The memory of the frame, in bytes.
+				size_t memory_ = 0;
+
+				/// The usage counter at the last access of the frame.
+				uint64_t lastUsage_ = 0ull;
+		};
+
+		/**
+		 * This class holds a cached frame pyramid.
+		 */
+		class PyramidEntry
+		{
+			public:
+
+				/// The cached frame pyramid.
+				SharedFramePyramid framePyramid_;
+
+				/// The memory of the frame pyramid, in bytes.
+				size_t memory_ = 0;
+
+				/// The usage counter at the last access of the frame pyramid.
+				uint64_t lastUsage_ = 0ull;
+		};
+
+		/**
+		 * This class holds the state of a frame which is currently requested from the wrapped interface.
+		 */
+		class PendingFrame
+		{
+			public:
+
+				/// The signal which is pulsed once the request has finished, each waiting tracker pulses the signal again to wake the next waiting tracker.
+				Signal signal_;
+		};
+
+		/**
+		 * Definition of a shared pointer holding a pending frame.
+		 */
+		using SharedPendingFrame = std::shared_ptr<PendingFrame>;
+
+		/**
+		 * Definition of a key of a frame pyramid combining frame index, pixel format, pixel origin, downsampling mode and number of layers.
+		 */
+		using PyramidKey = std::tuple<unsigned int, FrameType::PixelFormat, FrameType::PixelOrigin, CV::FramePyramid::DownsamplingMode, unsigned int>;
+
+		/**
+		 * Definition of an unordered map mapping frame indices to cached frames.
+		 */
+		using FrameMap = std::unordered_map<unsigned int, FrameEntry>;
+
+		/**
+		 * Definition of a map mapping pyramid keys to cached frame pyramids.
+		 */
+		using PyramidMap = std::map<PyramidKey, PyramidEntry>;
+
+		/**
+		 * Definition of an unordered map mapping frame indices to pending frames.
+		 */
+		using PendingFrameMap = std::unordered_map<unsigned int, SharedPendingFrame>;
+
+	public:
+
+		/**
+		 * Creates a new shared frame provider interface.
+		 * @param frameProviderInterface The frame provider interface which provides the frames, must be valid
+		 * @param memoryBudget The maximal memory of all cached frames and frame pyramids, in bytes, with range [1, infinity)
+		 * @param prefetchFrames The number of frames which are requested in advance whenever a frame cache request is invoked, with range [0, infinity)
+		 */
+		explicit SharedFrameProviderInterface(const CV::FrameProviderInterfaceRef& frameProviderInterface, const size_t memoryBudget = size_t(1024) * size_t(1024) * size_t(1024), const unsigned int prefetchFrames = 10u);
+
+		/**
+		 * Destructs this frame provider interface.
+		 */
+		~SharedFrameProviderInterface() override;
+
+		/**
+		 * Returns whether the internal information of this interface has been initialized already and whether request functions can be handled.
+		 * @see CV::FrameProviderInterface::isInitialized().
+		 */
+		bool isInitialized() override;
+
+		/**
+		 * Sets a preferred frame type pixel format and pixel origin for this interface.
+		 * Only the first call is forwarded to the wrapped interface, all following calls succeed without changing the frame type.
+		 * @see CV::FrameProviderInterface::setPreferredFrameType().
+		 */
+		bool setPreferredFrameType(const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin) override;
+
+		/**
+		 * Invokes an asynchronous frame request.
+		 * @see CV::FrameProviderInterface::asynchronFrameRequest().
+		 */
+		void asynchronFrameRequest(const unsigned int index, const bool priority = false) override;
+
+		/**
+		 * Invokes a synchronous frame request.
+		 * If another tracker is requesting the same frame concurrently, this function waits for the frame instead of requesting the frame a second time.
+		 * @see CV::FrameProviderInterface::synchronFrameRequest().
+		 */
+		FrameRef synchronFrameRequest(const unsigned int index, const double timeout = 10.0, bool* abort = nullptr) override;
+
+		/**
+		 * Invokes a suggestion to pre-load or to cache some frames that might be requested soon.
+		 * The interface requests up to 'prefetchFrames' frames which are not cached yet from the wrapped interface.
+		 * @see CV::FrameProviderInterface::frameCacheRequest().
+		 */
+		void frameCacheRequest(const unsigned int index, const int range) override;
+
+		/**
+		 * Invokes an asynchronous frame number request.
+		 * @see CV::FrameProviderInterface::asynchronFrameNumberRequest().
+		 */
+		void asynchronFrameNumberRequest() override;
+
+		/**
+		 * Invokes a synchronous frame number request.
+		 * @see CV::FrameProviderInterface::synchronFrameNumberRequest().
+		 */
+		unsigned int synchronFrameNumberRequest(const double timeout = 10.0, bool* abort = nullptr) override;
+
+		/**
+		 * Invokes an asynchronous frame type request.
+		 * @see CV::FrameProviderInterface::asynchronFrameTypeRequest().
+		 */
+		void asynchronFrameTypeRequest() override;
+
+		/**
+		 * Invokes a synchronous frame type request.
+		 * @see CV::FrameProviderInterface::synchronFrameTypeRequest().
+		 */
+		FrameType synchronFrameTypeRequest(const double timeout = 10.0, bool* abort = nullptr) override;
+
+		/**
+		 * Returns the frame pyramid of a frame, the pyramid is created only if it is not cached already.
+		 * @param index The index of the frame, with range [0, synchronFrameNumberRequest())
+		 * @param pixelFormat The pixel format of the pyramid, must be valid
+		 * @param pixelOrigin The pixel origin of the pyramid, must be valid
+		 * @param downsamplingMode The downsampling mode of the pyramid
+		 * @param layers The number of pyramid layers, with range [1, infinity)
+		 * @param worker Optional worker object to distribute the computation
+		 * @param timeout The time this functions waits at most for the frame, in seconds, with range [0, infinity)
+		 * @param abort Optional abort statement allowing to abort the request at any time
+		 * @return The frame pyramid, nullptr if the frame could not be delivered
+		 */
+		SharedFramePyramid framePyramid(const unsigned int index, const FrameType::PixelFormat pixelFormat, const FrameType::PixelOrigin pixelOrigin, const CV::FramePyramid::DownsamplingMode downsamplingMode, const unsigned int layers, Worker* worker = nullptr, const double timeout = 10.0, bool* abort = nullptr);
+
+		/**
+		 * Returns the memory of all cached frames and frame pyramids.
+		 * @return The memory, in bytes
+		 */
+		size_t memoryUsage() const;
+
+		/**
+		 * Returns the number of frame and pyramid requests which could be served from the cache.
+		 * @param frameHits Optional resulting number of frame requests served from the cache
+		 * @param frameMisses Optional resulting number of frame requests which needed to be forwarded to the wrapped interface
+		 * @param pyramidHits Optional resulting number of pyramid requests served from the cache
+		 * @param pyramidMisses Optional resulting number of pyramid requests which needed a new pyramid
+		 */
+		void statistics(uint64_t* frameHits, uint64_t* frameMisses, uint64_t* pyramidHits, uint64_t* pyramidMisses) const;
+
+		/**
+		 * Releases all associated resources.
+		 * @see CV::FrameProviderInterface::release().
+		 */
+		void release() override;
+
+	protected:
+
+		/**
+		 * Returns a cached frame and updates the usage of the frame.
+		 * The lock must be locked.
+		 * @param index The index of the frame
+		 * @return The cached frame, an invalid frame if the frame is not cached
+		 */
+		FrameRef cachedFrame(const unsigned int index);
+
+		/**
+		 * Adds a frame to the cache and removes least recently used entries if the memory budget is exceeded.
+		 * The lock must be locked.
+		 * @param index The index of the frame
+		 * @param frame The frame to add, must be valid
+		 */
+		void addFrame(const unsigned int index, const FrameRef& frame);
+
+		/**
+		 * Removes least recently used frames and frame pyramids until the memory budget is satisfied.
+		 * The lock must be locked.
+		 */
+		void applyMemoryBudget();
+
+		/**
+		 * Event function for frames arriving from the wrapped interface.
+		 * @param frame The frame which has arrived
+		 * @param index The index of the frame
+		 */
+		void onFrame(FrameRef frame, const unsigned int index);
+
+		/**
+		 * Event function for frame numbers arriving from the wrapped interface.
+		 * @param frameNumber The number of frames
+		 */
+		void onFrameNumber(const unsigned int frameNumber);
+
+		/**
+		 * Event function for frame types arriving from the wrapped interface.
+		 * @param frameType The frame type
+		 */
+		void onFrameType(const FrameType& frameType);
+
+	protected:
+
+		/// The wrapped frame provider interface.
+		CV::FrameProviderInterfaceRef frameProviderInterface_;
+
+		/// The maximal memory of all cached frames and frame pyramids, in bytes.
+		const size_t memoryBudget_;
+
+		/// The number of frames which are requested in advance.
+		const unsigned int prefetchFrames_;
+
+		/// The cached frames.
+		FrameMap frameMap_;
+
+		/// The cached frame pyramids.
+		PyramidMap pyramidMap_;
+
+		/// The frames which are currently requested from the wrapped interface.
+		PendingFrameMap pendingFrames_;
+
+		/// The memory of all cached frames and frame pyramids, in bytes.
+		size_t memoryUsage_ = 0;
+
+		/// The usage counter which is increased with each access.
+		uint64_t usageCounter_ = 0ull;
+
+		/// The number of frame requests served from the cache.
+		uint64_t frameHits_ = 0ull;
+
+		/// The number of frame requests forwarded to the wrapped interface.
+		uint64_t frameMisses_ = 0ull;
+
+		/// The number of pyramid requests served from the cache.
+		uint64_t pyramidHits_ = 0ull;
+
+		/// The number of pyramid requests which needed a new pyramid.
+		uint64_t pyramidMisses_ = 0ull;
+
+		/// True, if the preferred frame type has been set already.
+		bool preferredFrameTypeSet_ = false;
+
+		/// The lock of this interface.
+		mutable Lock lock_;
+};
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_OFFLINE_SHARED_FRAME_PROVIDER_INTERFACE_H
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/qrcodes/QRCodeTracker2D.h"
+
+#include "ocean/base/Subset.h"
+
+#include "ocean/cv/advanced/AdvancedMotion.h"
+
+#include "ocean/cv/detector/qrcodes/QRCodeDecoder.h"
+#include "ocean/cv/detector/qrcodes/Utilities.h"
+
+#include "ocean/geometry/NonLinearOptimizationPose.h"
+
+using namespace Ocean::CV::Detector::QRCodes;
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace QRCodes
+{
+
+QRCodeTracker2D::TrackedQRCode::TrackedQRCode(QRCode&& code, const HomogenousMatrix4& code_T_camera, const bool isNormalReflectance, const unsigned int grayThreshold, Vectors2&& imageCorners) :
+	code_(std::move(code)),
+	code_T_camera_(code_T_camera),
+	imageCorners_(std::move(imageCorners)),
+	isNormalReflectance_(isNormalReflectance),
+	grayThreshold_(grayThreshold),
+	trackingState_(TS_DETECTED)
+{
+	ocean_assert(code_.isValid());
+	ocean_assert(code_T_camera_.isValid());
+	ocean_assert(imageCorners_.size() == 4);
+	ocean_assert(grayThreshold_ <= 255u);
+}
+
+QRCodeTracker2D::QRCodeTracker2D(const Parameters& parameters) :
+	parameters_(parameters)
+{
+	ocean_assert(parameters_.detectionCadence_ >= 1u);
+	ocean_assert(parameters_.trackingNumberFramePyramidLayers_ >= 1u);
+	ocean_assert(parameters_.trackingCoarsestLayerRadius_ >= 2u);
+	ocean_assert(parameters_.minimalTrackedCornersPercent_ >= Scalar(0) && parameters_.minimalTrackedCornersPercent_ <= Scalar(1));
+	ocean_assert(parameters_.maximalProjectionError_ > Scalar(0));
+}
+
+const QRCodeTracker2D::TrackedQRCodesMap& QRCodeTracker2D::trackQRCodes(const AnyCamera& anyCamera, const Frame& yFrame, Worker* worker)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(yFrame.isValid() && FrameType::arePixelFormatsCompatible(yFrame.pixelFormat(), FrameType::FORMAT_Y8));
+	ocean_assert(yFrame.pixelOrigin() == FrameType::ORIGIN_UPPER_LEFT);
+	ocean_assert(anyCamera.width() == yFrame.width() && anyCamera.height() == yFrame.height());
+
+	if (yFrame.width() < 29u || yFrame.height() < 29u)
+	{
+		reset();
+		return trackedQRCodesMap_;
+	}
+
+	if (previousFramePyramid_.isValid() && previousFramePyramid_.finestLayer().frameType() != yFrame.frameType())
+	{
+		// the stream has changed, the previous frame cannot be used for tracking anymore
+		reset();
+	}
+
+	// the first layer is copied as the pyramid will be used as previous pyramid in the next iteration
+
+	const unsigned int pyramidLayers = std::min(parameters_.trackingNumberFramePyramidLayers_, CV::FramePyramid::idealLayers(yFrame.width(), yFrame.height(), 15u));
+
+	if (!framePyramid_.replace8BitPerChannel11(yFrame, std::max(1u, pyramidLayers), /* copyFirstLayer */ true, worker))
+	{
+		ocean_assert(false && "This should never happen!");
+
+		reset();
+		return trackedQRCodesMap_;
+	}
+
+	// Tracking
+
+	if (previousFramePyramid_.isValid())
+	{
+		for (TrackedQRCodesMap::iterator iTrackedCode = trackedQRCodesMap_.begin(); iTrackedCode != trackedQRCodesMap_.end(); /* noop */)
+		{
+			if (trackQRCode(anyCamera, previousFramePyramid_, framePyramid_, parameters_, iTrackedCode->second))
+			{
+				++iTrackedCode;
+			}
+			else
+			{
+				iTrackedCode = trackedQRCodesMap_.erase(iTrackedCode);
+			}
+		}
+	}
+	else
+	{
+		trackedQRCodesMap_.clear();
+	}
+
+	// Detection, with reduced cadence
+
+	ocean_assert(parameters_.detectionCadence_ != 0u);
+
+	if (frameCounter_ % std::max(1u, parameters_.detectionCadence_) == 0u)
+	{
+		Observations observations;
+		CV::Detector::QRCodes::QRCodes codes = detectQRCodes(anyCamera, yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), &observations, worker);
+		ocean_assert(codes.size() == observations.size());
+
+		for (size_t iCode = 0; iCode < codes.size(); ++iCode)
+		{
+			const Observation& observation = observations[iCode];
+			ocean_assert(observation.isValid());
+
+			const FinderPatternTriplet& finderPatterns = observation.finderPatterns();
+
+			const bool isNormalReflectance = finderPatterns[0].isNormalReflectance();
+			const unsigned int grayThreshold = ((finderPatterns[0].grayThreshold() + finderPatterns[1].grayThreshold() + finderPatterns[2].grayThreshold()) * 1024u + 512u) / 3072u;
+
+			Vectors2 imageCorners = computeImageCorners(anyCamera, observation.code_T_camera());
+
+			ObjectId objectId = ObjectId(-1);
+
+			if (isAlreadyTracked(trackedQRCodesMap_, codes[iCode], imageCorners, objectId))
+			{
+				// the detection is more accurate than the tracking, so that we replace the tracked code
+				ocean_assert(trackedQRCodesMap_.find(objectId) != trackedQRCodesMap_.cend());
+				trackedQRCodesMap_[objectId] = TrackedQRCode(std::move(codes[iCode]), observation.code_T_camera(), isNormalReflectance, grayThreshold, std::move(imageCorners));
+			}
+			else
+			{
+				trackedQRCodesMap_.emplace(objectIdCounter_++, TrackedQRCode(std::move(codes[iCode]), observation.code_T_camera(), isNormalReflectance, grayThreshold, std::move(imageCorners)));
+			}
+		}
+	}
+
+	++frameCounter_;
+
+	std::swap(previousFramePyramid_, framePyramid_);
+
+	return trackedQRCodesMap_;
+}
+
+void QRCodeTracker2D::reset()
+{
+	trackedQRCodesMap_.clear();
+
+	previousFramePyramid_.clear();
+	framePyramid_.clear();
+
+	frameCounter_ = 0u;
+}
+
+bool QRCodeTracker2D::trackQRCode(const AnyCamera& anyCamera, const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& framePyramid, const Parameters& parameters, TrackedQRCode& trackedCode)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(previousFramePyramid.isValid() && framePyramid.isValid());
+	ocean_assert(trackedCode.isValid());
+
+	const Vectors3 trackingObjectPoints = createTrackingObjectPoints(trackedCode.code().version());
+
+	Vectors3 objectPoints;
+	Vectors2 previousImagePoints;
+
+	objectPoints.reserve(trackingObjectPoints.size());
+	previousImagePoints.reserve(trackingObjectPoints.size());
+
+	for (const Vector3& trackingObjectPoint : trackingObjectPoints)
+	{
+		const Vector2 previousImagePoint = anyCamera.projectToImage(trackedCode.code_T_camera(), trackingObjectPoint);
+
+		if (anyCamera.isInside(previousImagePoint, /* border */ Scalar(5)))
+		{
+			objectPoints.emplace_back(trackingObjectPoint);
+			previousImagePoints.emplace_back(previousImagePoint);
+		}
+	}
+
+	if (objectPoints.size() < 4)
+	{
+		return false;
+	}
+
+	Vectors2 imagePoints;
+	Indices32 validIndices;
+
+	bool trackingResult = false;
+
+	if (framePyramid.finestLayer().width() <= 640u)
+	{
+		trackingResult = CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 7u>(previousFramePyramid, framePyramid, parameters.trackingCoarsestLayerRadius_, previousImagePoints, imagePoints, Scalar(0.9 * 0.9), /* worker */ nullptr, &validIndices);
+	}
+	else
+	{
+		trackingResult = CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 15u>(previousFramePyramid, framePyramid, parameters.trackingCoarsestLayerRadius_, previousImagePoints, imagePoints, Scalar(0.9 * 0.9), /* worker */ nullptr, &validIndices);
+	}
+
+	if (!trackingResult || validIndices.size() < 4)
+	{
+		return false;
+	}
+
+	const Vectors3 validObjectPoints = Subset::subset(objectPoints, validIndices);
+	const Vectors2 validImagePoints = Subset::subset(imagePoints, validIndices);
+
+	HomogenousMatrix4 code_T_camera(false);
+
+	if (!Geometry::NonLinearOptimizationPose::optimizePose(anyCamera, trackedCode.code_T_camera(), ConstArrayAccessor<Vector3>(validObjectPoints), ConstArrayAccessor<Vector2>(validImagePoints), code_T_camera, /* iterations */ 10u, Geometry::Estimator::ET_HUBER, Scalar(0.001), Scalar(10)))
+	{
+		return false;
+	}
+
+	ocean_assert(code_T_camera.isValid());
+
+	Scalar sqrProjectionError = Scalar(0);
+
+	for (size_t n = 0; n < validObjectPoints.size(); ++n)
+	{
+		sqrProjectionError += anyCamera.projectToImage(code_T_camera, validObjectPoints[n]).sqrDistance(validImagePoints[n]);
+	}
+
+	sqrProjectionError /= Scalar(validObjectPoints.size());
+
+	const bool isTrackingReliable = Scalar(validIndices.size()) >= Scalar(trackingObjectPoints.size()) * parameters.minimalTrackedCornersPercent_ && sqrProjectionError <= Numeric::sqr(parameters.maximalProjectionError_);
+
+	if (isTrackingReliable)
+	{
+		trackedCode.code_T_camera_ = code_T_camera;
+		trackedCode.imageCorners_ = computeImageCorners(anyCamera, code_T_camera);
+		trackedCode.trackingState_ = TS_TRACKED;
+
+		return true;
+	}
+
+	// the tracking quality has dropped, so we verify the tracked pose by decoding the code again
+
+	const Frame& frame = framePyramid.finestLayer();
+
+	std::vector<uint8_t> modules;
+	if (!extractModulesFromImage(anyCamera, frame.constdata<uint8_t>(), frame.width(), frame.height(), frame.paddingElements(), trackedCode.code().version(), code_T_camera, trackedCode.isNormalReflectance_, trackedCode.grayThreshold_, modules))
+	{
+		return false;
+	}
+
+	QRCode code;
+	if (!QRCodeDecoder::decodeQRCode(modules, code) || !code.isSame(trackedCode.code(), /* ignoreModules */ true))
+	{
+		return false;
+	}
+
+	trackedCode.code_ = std::move(code);
+	trackedCode.code_T_camera_ = code_T_camera;
+	trackedCode.imageCorners_ = computeImageCorners(anyCamera, code_T_camera);
+	trackedCode.trackingState_ = TS_REDECODED;
+
+	return true;
+}
+
+Vectors3 QRCodeTracker2D::createTrackingObjectPoints(const unsigned int version)
+{
+	ocean_assert(version >= 1u && version <= 40u);
+
+	const unsigned int modulesPerSide = QRCode::modulesPerSide(version);
+	ocean_assert(modulesPerSide >= 21u);
+
+	const CV::Detector::QRCodes::Utilities::CoordinateSystem coordinateSystem(version);
+
+	// the outer corners of the finder patterns have a high contrast as they are adjacent to the quiet zone and the separators
+
+	const Scalar codeSpaceCoordinates[4] = {Scalar(0), Scalar(7), Scalar(modulesPerSide - 7u), Scalar(modulesPerSide)};
+
+	const unsigned int finderPatternOffsets[3][2] =
+	{
+		{0u, 0u}, // top-left
+		{0u, 2u}, // bottom-left
+		{2u, 0u}, // top-right
+	};
+
+	Vectors3 objectPoints;
+	objectPoints.reserve(12);
+
+	for (const unsigned int* finderPatternOffset : finderPatternOffsets)
+	{
+		for (unsigned int yCorner = 0u; yCorner < 2u; ++yCorner)
+		{
+			for (unsigned int xCorner = 0u; xCorner < 2u; ++xCorner)
+			{
+				const Scalar x = coordinateSystem.convertCodeSpaceToObjectSpaceX(codeSpaceCoordinates[finderPatternOffset[0] + xCorner]);
+				const Scalar y = coordinateSystem.convertCodeSpaceToObjectSpaceY(codeSpaceCoordinates[finderPatternOffset[1] + yCorner]);
+
+				objectPoints.emplace_back(x, y, Scalar(0));
+			}
+		}
+	}
+
+	return objectPoints;
+}
+
+Vectors2 QRCodeTracker2D::computeImageCorners(const AnyCamera& anyCamera, const HomogenousMatrix4& code_T_camera)
+{
+	ocean_assert(anyCamera.isValid());
+	ocean_assert(code_T_camera.isValid());
+
+	const Vectors3 objectCorners = CV::Detector::QRCodes::Utilities::CoordinateSystem::computeCornersInObjectSpace();
+	ocean_assert(objectCorners.size() == 4);
+
+	Vectors2 imageCorners;
+	imageCorners.reserve(objectCorners.size());
+
+	for (const Vector3& objectCorner : objectCorners)
+	{
+		imageCorners.emplace_back(anyCamera.projectToImage(code_T_camera, objectCorner));
+	}
+
+	return imageCorners;
+}
+
+bool QRCodeTracker2D::isAlreadyTracked(const TrackedQRCodesMap& trackedQRCodesMap, const QRCode& code, const Vectors2& imageCorners, ObjectId& objectId)
+{
+	ocean_assert(code.isValid());
+	ocean_assert(imageCorners.size() == 4);
+
+	const Vector2 imageCenter = (imageCorners[0] + imageCorners[1] + imageCorners[2] + imageCorners[3]) * Scalar(0.25);
+
+	Scalar bestSqrDistance = Numeric::maxValue();
+
+	for (TrackedQRCodesMap::const_iterator iTrackedCode = trackedQRCodesMap.cbegin(); iTrackedCode != trackedQRCodesMap.cend(); ++iTrackedCode)
+	{
+		const TrackedQRCode& trackedCode = iTrackedCode->second;
+		ocean_assert(trackedCode.isValid());
+
+		if (!trackedCode.code().isSame(code, /* ignoreModules */ true))
+		{
+			continue;
+		}
+
+		const Vectors2& trackedImageCorners = trackedCode.imageCorners();
+
+		const Vector2 trackedImageCenter = (trackedImageCorners[0] + trackedImageCorners[1] + trackedImageCorners[2] + trackedImageCorners[3]) * Scalar(0.25);
+
+		// identical codes must overlap, i.e., the distance between both centers must be smaller than half of the diagonal of the tracked code
+
+		const Scalar maxSqrDistance = trackedImageCorners[0].sqrDistance(trackedImageCorners[2]) * Scalar(0.25);
+		const Scalar sqrDistance = trackedImageCenter.sqrDistance(imageCenter);
+
+		if (sqrDistance <= maxSqrDistance && sqrDistance < bestSqrDistance)
+		{
+			bestSqrDistance = sqrDistance;
+			objectId = iTrackedCode->first;
+		}
+	}
+
+	return bestSqrDistance != Numeric::maxValue();
+}
+
+} // namespace QRCodes
+
+} // namespace Tracking
+
+} // namespace Ocean
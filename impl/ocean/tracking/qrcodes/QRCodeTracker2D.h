@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "ocean/tracking/qrcodes/QRCodes.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/FramePyramid.h"
+
+#include "ocean/cv/detector/qrcodes/QRCodeDetector2D.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+
+#include <unordered_map>
+
+namespace Ocean
+{
+
+// Forward declaration for test library.
+namespace Test { namespace TestTracking { class TestQRCodeTracker2D; } }
+
+namespace Tracking
+{
+
+namespace QRCodes
+{
+
+/**
+ * This class implements a frame-to-frame tracker for QR codes in a single camera stream without any device pose.
+ * Once a code has been detected, the corners of its three finder patterns are tracked from frame to frame and the pose of the code is refined with the tracked corners.<br>
+ * A code is decoded again only if the tracking quality drops (e.g., if too many corners could not be tracked or the projection error becomes too large), while the expensive full-frame detection is applied with a reduced cadence only.<br>
+ * Thus, the tracker can be used as a replacement for `CV::Detector::QRCodes::QRCodeDetector2D::detectQRCodes()` in continuous scanning scenarios.
+ * @see CV::Detector::QRCodes::QRCodeDetector2D, QRCodeTracker3D.
+ * @ingroup trackingqrcodes
+ */
+class OCEAN_TRACKING_QRCODES_EXPORT QRCodeTracker2D : public CV::Detector::QRCodes::QRCodeDetector2D
+{
+	friend class Test::TestTracking::TestQRCodeTracker2D;
+
+	public:
+
+		/**
+		 * Definition of tracking states.
+		 */
+		enum TrackingState : uint32_t
+		{
+			/// Unknown/invalid tracking state.
+			TS_UNKNOWN_STATE = 0u,
+			/// The code has been detected in the current frame.
+			TS_DETECTED,
+			/// The code has been tracked from the previous frame to the current frame.
+			TS_TRACKED,
+			/// The code has been tracked from the previous frame to the current frame and has been decoded again due to a low tracking quality.
+			TS_REDECODED
+		};
+
+		/// The unique ID of each tracked code.
+		using ObjectId = uint32_t;
+
+		/**
+		 * Definition of parameters that control the tracker.
+		 */
+		struct Parameters
+		{
+			/// The number of frames after which the full-frame detection will be run, 1 to apply the detection in every frame, range: [1, infinity)
+			unsigned int detectionCadence_ = 10u;
+
+			/// The number of layers of the image pyramid that are used for the frame-to-frame tracking of points, range: [1, infinity)
+			unsigned int trackingNumberFramePyramidLayers_ = 4u;
+
+			/// The search radius on the coarsest pyramid layer for the frame-to-frame tracking of points, in pixels, range: [2, infinity)
+			unsigned int trackingCoarsestLayerRadius_ = 4u;
+
+			/// The minimal percentage of tracked corners so that the tracking is trusted without decoding the code again, range: [0, 1]
+			Scalar minimalTrackedCornersPercent_ = Scalar(0.75);
+
+			/// The maximal average projection error of the tracked corners so that the tracking is trusted without decoding the code again, in pixels, range: (0, infinity)
+			Scalar maximalProjectionError_ = Scalar(1.5);
+		};
+
+		/**
+		 * This class holds a tracked code.
+		 */
+		class TrackedQRCode
+		{
+			friend class QRCodeTracker2D;
+
+			public:
+
+				/**
+				 * Creates an invalid tracked code.
+				 */
+				TrackedQRCode() = default;
+
+				/**
+				 * Creates a new tracked code.
+				 * @param code The code which is tracked, must be valid
+				 * @param code_T_camera The pose of the camera with respect to the code, as provided by `QRCodeDetector2D::Observation::code_T_camera()`, must be valid
+				 * @param isNormalReflectance True, if the code has normal reflectance (dark modules on bright background); False, if the reflectance is inverted
+				 * @param grayThreshold The gray value separating foreground and background modules, range: [0, 255]
+				 * @param imageCorners The four corners of the code in the camera image, in the order top-left, bottom-left, bottom-right, top-right, must have four elements
+				 */
+				TrackedQRCode(CV::Detector::QRCodes::QRCode&& code, const HomogenousMatrix4& code_T_camera, const bool isNormalReflectance, const unsigned int grayThreshold, Vectors2&& imageCorners);
+
+				/**
+				 * Returns the tracked code.
+				 * @return The code
+				 */
+				inline const CV::Detector::QRCodes::QRCode& code() const;
+
+				/**
+				 * Returns the current pose of the camera with respect to the code.
+				 * @return The camera pose, with the same definition as `QRCodeDetector2D::Observation::code_T_camera()`
+				 */
+				inline const HomogenousMatrix4& code_T_camera() const;
+
+				/**
+				 * Returns the four corners of the code in the current camera image.
+				 * @return The image corners, in the order top-left, bottom-left, bottom-right, top-right
+				 */
+				inline const Vectors2& imageCorners() const;
+
+				/**
+				 * Returns the tracking state of the code in the current frame.
+				 * @return The tracking state
+				 */
+				inline TrackingState trackingState() const;
+
+				/**
+				 * Returns whether this tracked code is valid.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+			protected:
+
+				/// The tracked code.
+				CV::Detector::QRCodes::QRCode code_;
+
+				/// The pose of the camera with respect to the code.
+				HomogenousMatrix4 code_T_camera_ = HomogenousMatrix4(false);
+
+				/// The four corners of the code in the camera image.
+				Vectors2 imageCorners_;
+
+				/// True, if the code has normal reflectance.
+				bool isNormalReflectance_ = true;
+
+				/// The gray value separating foreground and background modules.
+				unsigned int grayThreshold_ = 0u;
+
+				/// The tracking state of the code in the current frame.
+				TrackingState trackingState_ = TS_UNKNOWN_STATE;
+		};
+
+		/// Definition of a map mapping object ids to tracked codes.
+		using TrackedQRCodesMap = std::unordered_map<ObjectId, TrackedQRCode>;
+
+	public:
+
+		/**
+		 * Creates a new tracker with default parameters.
+		 */
+		QRCodeTracker2D() = default;
+
+		/**
+		 * Creates a new tracker.
+		 * @param parameters The parameters that will be used for tracking, must be valid
+		 */
+		explicit QRCodeTracker2D(const Parameters& parameters);
+
+		/**
+		 * Tracks QR codes in a new 8-bit grayscale frame of the camera stream.
+		 * Codes which cannot be tracked or verified anymore are removed from the map of tracked codes, new codes are added whenever the full-frame detection is applied.
+		 * @param anyCamera The camera profile that produced the input frame, must be valid and must be identical for all frames of the stream
+		 * @param yFrame The frame in which QR codes will be tracked, must be valid, must match the camera size, must have its origin in the upper left corner, and must have a pixel format that is compatible with Y8
+		 * @param worker Optional worker object to distribute the computation
+		 * @return The map containing all currently tracked QR codes
+		 */
+		const TrackedQRCodesMap& trackQRCodes(const AnyCamera& anyCamera, const Frame& yFrame, Worker* worker = nullptr);
+
+		/**
+		 * Returns the map containing all currently tracked QR codes.
+		 * @return The map of tracked codes
+		 */
+		inline const TrackedQRCodesMap& trackedQRCodes() const;
+
+		/**
+		 * Resets the tracker, all tracked codes will be removed.
+		 */
+		void reset();
+
+	protected:
+
+		/**
+		 * Tracks a single code from the previous frame to the current frame.
+		 * In case the tracking quality is low, the code will be decoded again to verify the tracking result.
+		 * @param anyCamera The camera profile that produced both frames, must be valid
+		 * @param previousFramePyramid The frame pyramid of the previous frame, must be valid
+		 * @param framePyramid The frame pyramid of the current frame, with same frame type as the previous pyramid, must be valid
+		 * @param parameters The parameters of the tracker
+		 * @param trackedCode The code to be tracked, will be updated if the tracking succeeds
+		 * @return True, if the code could be tracked (and verified if necessary); False, if the code is lost
+		 */
+		static bool trackQRCode(const AnyCamera& anyCamera, const CV::FramePyramid& previousFramePyramid, const CV::FramePyramid& framePyramid, const Parameters& parameters, TrackedQRCode& trackedCode);
+
+		/**
+		 * Returns the object points of the outer corners of all three finder patterns of a code, which are used for tracking.
+		 * The object points are defined in the normalized coordinate system of the code, with range [-1, 1].
+		 * @param version The version of the code, range: [1, 40]
+		 * @return The 12 object points
+		 */
+		static Vectors3 createTrackingObjectPoints(const unsigned int version);
+
+		/**
+		 * Determines the four corners of a code in the camera image.
+		 * @param anyCamera The camera profile, must be valid
+		 * @param code_T_camera The pose of the camera with respect to the code, must be valid
+		 * @return The four image corners, in the order top-left, bottom-left, bottom-right, top-right
+		 */
+		static Vectors2 computeImageCorners(const AnyCamera& anyCamera, const HomogenousMatrix4& code_T_camera);
+
+		/**
+		 * Checks whether a detected code is already tracked.
+		 * @param trackedQRCodesMap The map of currently tracked codes
+		 * @param code The detected code, must be valid
+		 * @param imageCorners The image corners of the detected code, must have four elements
+		 * @param objectId The resulting object id of the tracked code, if any
+		 * @return True, if the code is already tracked
+		 */
+		static bool isAlreadyTracked(const TrackedQRCodesMap& trackedQRCodesMap, const CV::Detector::QRCodes::QRCode& code, const Vectors2& imageCorners, ObjectId& objectId);
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		QRCodeTracker2D(const QRCodeTracker2D&) = delete;
+
+		/**
+		 * Disabled assign operator.
+		 * @return The reference to this object
+		 */
+		QRCodeTracker2D& operator=(const QRCodeTracker2D&) = delete;
+
+	protected:
+
+		/// The tracking parameters.
+		Parameters parameters_;
+
+		/// The map of all currently tracked codes.
+		TrackedQRCodesMap trackedQRCodesMap_;
+
+		/// The counter that is used for the assignment of ids to new codes.
+		ObjectId objectIdCounter_ = 0u;
+
+		/// The counter for frames that have been processed.
+		unsigned int frameCounter_ = 0u;
+
+		/// The frame pyramid of the previous frame.
+		CV::FramePyramid previousFramePyramid_;
+
+		/// The frame pyramid of the current frame, an intermediate object to avoid memory reallocations.
+		CV::FramePyramid framePyramid_;
+};
+
+inline const CV::Detector::QRCodes::QRCode& QRCodeTracker2D::TrackedQRCode::code() const
+{
+	return code_;
+}
+
+inline const HomogenousMatrix4& QRCodeTracker2D::TrackedQRCode::code_T_camera() const
+{
+	return code_T_camera_;
+}
+
+inline const Vectors2& QRCodeTracker2D::TrackedQRCode::imageCorners() const
+{
+	return imageCorners_;
+}
+
+inline QRCodeTracker2D::TrackingState QRCodeTracker2D::TrackedQRCode::trackingState() const
+{
+	return trackingState_;
+}
+
+inline bool QRCodeTracker2D::TrackedQRCode::isValid() const
+{
+	return code_.isValid() && code_T_camera_.isValid() && imageCorners_.size() == 4 && trackingState_ != TS_UNKNOWN_STATE;
+}
+
+inline const QRCodeTracker2D::TrackedQRCodesMap& QRCodeTracker2D::trackedQRCodes() const
+{
+	return trackedQRCodesMap_;
+}
+
+} // namespace QRCodes
+
+} // namespace Tracking
+
+} // namespace Ocean
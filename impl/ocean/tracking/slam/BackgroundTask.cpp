@@ -113,6 +113,13 @@ BackgroundTask::WaitResult BackgroundTask::wait()
 	return waitResult;
 }
 
+bool BackgroundTask::isExecuting() const
+{
+	const std::lock_guard lock(mutex_);
+
+	return taskExecute_;
+}
+
 void BackgroundTask::release()
 {
 	std::unique_lock lock(mutex_);
@@ -117,6 +117,14 @@ class OCEAN_TRACKING_SLAM_EXPORT BackgroundTask
 		 */
 		WaitResult wait();
 
+		/**
+		 * Returns whether the task has been initiated with execute() and has not yet been processed.
+		 * In case this function returns False, a following wait() call will return immediately.
+		 * @return True, if the task is currently scheduled or executing; False, otherwise
+		 * @see execute(), wait()
+		 */
+		bool isExecuting() const;
+
 		/**
 		 * Explicitly releases the background task and stops the background thread.
 		 * This function blocks until the background thread has fully terminated.
@@ -181,7 +189,7 @@ class OCEAN_TRACKING_SLAM_EXPORT BackgroundTask
 		std::condition_variable taskProcessedCondition_;
 
 		/// The mutex protecting the internal state.
-		std::mutex mutex_;
+		mutable std::mutex mutex_;
 
 		/// True, if the background task has been released or not yet initialized; False, if active.
 		bool released_ = true;
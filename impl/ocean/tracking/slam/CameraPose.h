@@ -35,6 +35,13 @@ class CameraPose;
  */
 using SharedCameraPose = std::shared_ptr<CameraPose>;
 
+/**
+ * Definition of a vector holding shared camera poses.
+ * @see SharedCameraPose
+ * @ingroup trackingslam
+ */
+using SharedCameraPoses = std::vector<SharedCameraPose>;
+
 /**
  * This class holds the camera pose of a camera in relation to the world.
  * The pose includes both the standard camera-to-world transformation and the flipped camera-to-world transformation.<br>
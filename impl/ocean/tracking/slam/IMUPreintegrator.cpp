@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/IMUPreintegrator.h"
+
+#include "ocean/math/ExponentialMap.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+void IMUPreintegrator::addGyroSample(const Timestamp& timestamp, const Vector3& angularVelocity)
+{
+	ocean_assert(timestamp.isValid());
+
+	const WriteLock writeLock(mutex_);
+
+	gyroSamples_[double(timestamp)] = angularVelocity;
+}
+
+void IMUPreintegrator::addAccelerationSample(const Timestamp& timestamp, const Vector3& acceleration)
+{
+	ocean_assert(timestamp.isValid());
+
+	const WriteLock writeLock(mutex_);
+
+	accelerationSamples_[double(timestamp)] = acceleration;
+}
+
+void IMUPreintegrator::setBiases(const Vector3& gyroBias, const Vector3& accelerationBias)
+{
+	const WriteLock writeLock(mutex_);
+
+	gyroBias_ = gyroBias;
+	accelerationBias_ = accelerationBias;
+}
+
+bool IMUPreintegrator::preintegrate(const Timestamp& startTimestamp, const Timestamp& endTimestamp, Preintegration& preintegration) const
+{
+	ocean_assert(startTimestamp.isValid() && endTimestamp.isValid());
+	ocean_assert(startTimestamp <= endTimestamp);
+
+	preintegration = Preintegration();
+
+	if (!startTimestamp.isValid() || !endTimestamp.isValid() || endTimestamp < startTimestamp)
+	{
+		return false;
+	}
+
+	const double start = double(startTimestamp);
+	const double end = double(endTimestamp);
+
+	const ReadLock readLock(mutex_);
+
+	if (!coversInterval(gyroSamples_, start, end))
+	{
+		return false;
+	}
+
+	const bool useAcceleration = coversInterval(accelerationSamples_, start, end);
+
+	// the integration steps are defined by the timestamps of all samples of both sensors inside the interval
+
+	std::vector<double> timestamps;
+	timestamps.reserve(32);
+
+	timestamps.push_back(start);
+
+	for (SampleMap::const_iterator iSample = gyroSamples_.upper_bound(start); iSample != gyroSamples_.cend() && iSample->first < end; ++iSample)
+	{
+		timestamps.push_back(iSample->first);
+	}
+
+	if (useAcceleration)
+	{
+		for (SampleMap::const_iterator iSample = accelerationSamples_.upper_bound(start); iSample != accelerationSamples_.cend() && iSample->first < end; ++iSample)
+		{
+			timestamps.push_back(iSample->first);
+		}
+
+		std::sort(timestamps.begin(), timestamps.end());
+	}
+
+	timestamps.push_back(end);
+
+	Quaternion start_Q_step(true);
+	Vector3 start_deltaVelocity(0, 0, 0);
+	Vector3 start_deltaPosition(0, 0, 0);
+
+	for (size_t n = 1; n < timestamps.size(); ++n)
+	{
+		const double stepDuration = timestamps[n] - timestamps[n - 1];
+
+		if (stepDuration <= 0.0)
+		{
+			continue;
+		}
+
+		const double midTimestamp = (timestamps[n - 1] + timestamps[n]) * 0.5;
+		const Scalar dt = Scalar(stepDuration);
+
+		const Vector3 angularVelocity = interpolateSample(gyroSamples_, midTimestamp) - gyroBias_;
+
+		if (useAcceleration)
+		{
+			// we use the orientation in the middle of the step to rotate the acceleration into the start coordinate system (midpoint integration)
+
+			const Quaternion start_Q_midStep = start_Q_step * ExponentialMap(angularVelocity * (dt * Scalar(0.5))).quaternion();
+
+			const Vector3 start_acceleration = start_Q_midStep * (interpolateSample(accelerationSamples_, midTimestamp) - accelerationBias_);
+
+			start_deltaPosition += start_deltaVelocity * dt + start_acceleration * (Scalar(0.5) * dt * dt);
+			start_deltaVelocity += start_acceleration * dt;
+		}
+
+		start_Q_step = start_Q_step * ExponentialMap(angularVelocity * dt).quaternion();
+		start_Q_step.normalize();
+	}
+
+	preintegration.deltaTime_ = end - start;
+	preintegration.start_Q_end_ = start_Q_step;
+	preintegration.start_deltaVelocity_ = start_deltaVelocity;
+	preintegration.start_deltaPosition_ = start_deltaPosition;
+	preintegration.hasAcceleration_ = useAcceleration;
+
+	return true;
+}
+
+void IMUPreintegrator::removeSamples(const Timestamp& timestamp)
+{
+	ocean_assert(timestamp.isValid());
+
+	const WriteLock writeLock(mutex_);
+
+	removeSamples(gyroSamples_, double(timestamp));
+	removeSamples(accelerationSamples_, double(timestamp));
+}
+
+void IMUPreintegrator::clear()
+{
+	const WriteLock writeLock(mutex_);
+
+	gyroSamples_.clear();
+	accelerationSamples_.clear();
+}
+
+HomogenousMatrix4 IMUPreintegrator::predictPose(const HomogenousMatrix4& world_T_previousSensor, const Vector3& worldPreviousVelocity, const Vector3& worldGravity, const Preintegration& preintegration, Vector3* worldCurrentVelocity)
+{
+	ocean_assert(world_T_previousSensor.isValid());
+	ocean_assert(preintegration.hasAcceleration());
+
+	const Scalar dt = Scalar(preintegration.deltaTime_);
+
+	const Quaternion world_Q_previousSensor = world_T_previousSensor.rotation();
+
+	const Vector3 worldPreviousPosition = world_T_previousSensor.translation();
+
+	const Vector3 worldCurrentPosition = worldPreviousPosition + worldPreviousVelocity * dt + worldGravity * (Scalar(0.5) * dt * dt) + world_Q_previousSensor * preintegration.start_deltaPosition_;
+
+	if (worldCurrentVelocity != nullptr)
+	{
+		*worldCurrentVelocity = worldPreviousVelocity + worldGravity * dt + world_Q_previousSensor * preintegration.start_deltaVelocity_;
+	}
+
+	return HomogenousMatrix4(worldCurrentPosition, world_Q_previousSensor * preintegration.start_Q_end_);
+}
+
+Vector3 IMUPreintegrator::interpolateSample(const SampleMap& sampleMap, const double timestamp)
+{
+	ocean_assert(!sampleMap.empty());
+
+	const SampleMap::const_iterator iUpper = sampleMap.lower_bound(timestamp);
+
+	if (iUpper == sampleMap.cend())
+	{
+		return sampleMap.crbegin()->second;
+	}
+
+	if (iUpper == sampleMap.cbegin() || iUpper->first == timestamp)
+	{
+		return iUpper->second;
+	}
+
+	const SampleMap::const_iterator iLower = std::prev(iUpper);
+
+	const double interval = iUpper->first - iLower->first;
+	ocean_assert(interval > 0.0);
+
+	const Scalar factor = Scalar((timestamp - iLower->first) / interval);
+	ocean_assert(factor >= Scalar(0) && factor <= Scalar(1));
+
+	return iLower->second * (Scalar(1) - factor) + iUpper->second * factor;
+}
+
+bool IMUPreintegrator::coversInterval(const SampleMap& sampleMap, const double startTimestamp, const double endTimestamp)
+{
+	if (sampleMap.empty())
+	{
+		return false;
+	}
+
+	return sampleMap.cbegin()->first <= startTimestamp && sampleMap.crbegin()->first >= endTimestamp;
+}
+
+void IMUPreintegrator::removeSamples(SampleMap& sampleMap, const double timestamp)
+{
+	SampleMap::iterator iUpper = sampleMap.upper_bound(timestamp);
+
+	if (iUpper == sampleMap.begin())
+	{
+		return;
+	}
+
+	// we keep the latest sample at or before the timestamp
+
+	sampleMap.erase(sampleMap.begin(), std::prev(iUpper));
+}
+
+}
+
+}
+
+}
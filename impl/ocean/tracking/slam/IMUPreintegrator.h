@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_IMU_PREINTEGRATOR_H
+#define META_OCEAN_TRACKING_SLAM_IMU_PREINTEGRATOR_H
+
+#include "ocean/tracking/slam/SLAM.h"
+#include "ocean/tracking/slam/Mutex.h"
+
+#include "ocean/base/Timestamp.h"
+
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/Quaternion.h"
+#include "ocean/math/Vector3.h"
+
+#include <map>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+/**
+ * This class implements the preintegration of inertial measurements (gyroscope and accelerometer samples) between two frames.
+ * The samples are expected to be defined in the coordinate system of the sensor which is tracked (e.g., the camera), and to use the same time domain as the frames.<br>
+ * Samples are typically provided by a 3DOF gyro sensor and a 3DOF acceleration sensor, e.g., from Devices::GyroSensor3DOF and Devices::AccelerationSensor3DOF, transformed into the coordinate system of the sensor.<br>
+ * The preintegration determines the relative rotation, the relative velocity, and the relative position between two timestamps independently of the absolute pose and velocity of the sensor.<br>
+ * The object is thread-safe, samples can be added from any thread.
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT IMUPreintegrator
+{
+	public:
+
+		/**
+		 * This class holds the result of a preintegration between two timestamps.
+		 */
+		class Preintegration
+		{
+			public:
+
+				/**
+				 * Returns whether this preintegration holds a valid relative rotation.
+				 * @return True, if so
+				 */
+				inline bool isValid() const;
+
+				/**
+				 * Returns whether this preintegration holds a valid relative velocity and position (which is the case if acceleration samples have been available).
+				 * @return True, if so
+				 */
+				inline bool hasAcceleration() const;
+
+			public:
+
+				/// The time between the start and the end timestamp, in seconds, with range [0, infinity), -1 if invalid.
+				double deltaTime_ = -1.0;
+
+				/// The rotation between the sensor at the end timestamp and the sensor at the start timestamp.
+				Quaternion start_Q_end_ = Quaternion(false);
+
+				/// The change of velocity, defined in the coordinate system of the sensor at the start timestamp, without the contribution of gravity, in meter per second.
+				Vector3 start_deltaVelocity_ = Vector3(0, 0, 0);
+
+				/// The change of position, defined in the coordinate system of the sensor at the start timestamp, without the contribution of gravity and initial velocity, in meter.
+				Vector3 start_deltaPosition_ = Vector3(0, 0, 0);
+
+				/// True, if acceleration samples have been used for the preintegration.
+				bool hasAcceleration_ = false;
+		};
+
+	protected:
+
+		/**
+		 * Definition of an ordered map mapping timestamps (in seconds) to sample values.
+		 */
+		using SampleMap = std::map<double, Vector3>;
+
+	public:
+
+		/**
+		 * Creates a new preintegrator object without any samples.
+		 */
+		IMUPreintegrator() = default;
+
+		/**
+		 * Adds a new gyroscope sample.
+		 * @param timestamp The timestamp of the sample, must be valid
+		 * @param angularVelocity The angular velocity, defined in the coordinate system of the sensor, in radian per second
+		 */
+		void addGyroSample(const Timestamp& timestamp, const Vector3& angularVelocity);
+
+		/**
+		 * Adds a new accelerometer sample.
+		 * @param timestamp The timestamp of the sample, must be valid
+		 * @param acceleration The measured acceleration (the specific force, containing the reaction to gravity), defined in the coordinate system of the sensor, in meter per square second
+		 */
+		void addAccelerationSample(const Timestamp& timestamp, const Vector3& acceleration);
+
+		/**
+		 * Sets the biases of the gyroscope and the accelerometer which will be subtracted from all samples.
+		 * @param gyroBias The bias of the gyroscope, in radian per second
+		 * @param accelerationBias The bias of the accelerometer, in meter per square second
+		 */
+		void setBiases(const Vector3& gyroBias, const Vector3& accelerationBias);
+
+		/**
+		 * Preintegrates all samples between two timestamps.
+		 * The gyroscope samples must cover the entire time interval, acceleration samples are optional.
+		 * @param startTimestamp The start timestamp of the preintegration, must be valid
+		 * @param endTimestamp The end timestamp of the preintegration, with range [startTimestamp, infinity)
+		 * @param preintegration The resulting preintegration
+		 * @return True, if succeeded; False, if the samples do not cover the time interval
+		 */
+		bool preintegrate(const Timestamp& startTimestamp, const Timestamp& endTimestamp, Preintegration& preintegration) const;
+
+		/**
+		 * Removes all samples which are not necessary anymore to preintegrate time intervals starting at a given timestamp.
+		 * The latest sample before the timestamp is kept so that the samples can still be interpolated at the timestamp.
+		 * @param timestamp The timestamp before which samples can be removed, must be valid
+		 */
+		void removeSamples(const Timestamp& timestamp);
+
+		/**
+		 * Removes all samples.
+		 */
+		void clear();
+
+		/**
+		 * Predicts the pose and velocity of the sensor at the end of a preintegration.
+		 * The prediction is metric, so that the pose and velocity must be defined in a metric world coordinate system.
+		 * @param world_T_previousSensor The pose of the sensor at the start of the preintegration, must be valid
+		 * @param worldPreviousVelocity The velocity of the sensor at the start of the preintegration, defined in world, in meter per second
+		 * @param worldGravity The gravity acceleration, defined in world, e.g., (0, -9.81, 0), in meter per square second
+		 * @param preintegration The preintegration between previous and current sensor, must contain acceleration
+		 * @param worldCurrentVelocity Optional resulting velocity of the sensor at the end of the preintegration, defined in world
+		 * @return The predicted pose of the sensor at the end of the preintegration
+		 */
+		static HomogenousMatrix4 predictPose(const HomogenousMatrix4& world_T_previousSensor, const Vector3& worldPreviousVelocity, const Vector3& worldGravity, const Preintegration& preintegration, Vector3* worldCurrentVelocity = nullptr);
+
+	protected:
+
+		/**
+		 * Returns the linearly interpolated sample value at a given timestamp.
+		 * @param sampleMap The samples to interpolate, must not be empty
+		 * @param timestamp The timestamp at which the value will be determined, in seconds
+		 * @return The interpolated value, the closest sample value if the timestamp is outside the sample range
+		 */
+		static Vector3 interpolateSample(const SampleMap& sampleMap, const double timestamp);
+
+		/**
+		 * Returns whether samples cover a specific time interval.
+		 * @param sampleMap The samples to check
+		 * @param startTimestamp The start timestamp of the interval, in seconds
+		 * @param endTimestamp The end timestamp of the interval, in seconds
+		 * @return True, if so
+		 */
+		static bool coversInterval(const SampleMap& sampleMap, const double startTimestamp, const double endTimestamp);
+
+		/**
+		 * Removes all samples which are not necessary to interpolate values at or after a given timestamp.
+		 * @param sampleMap The samples from which samples will be removed
+		 * @param timestamp The timestamp before which samples can be removed, in seconds
+		 */
+		static void removeSamples(SampleMap& sampleMap, const double timestamp);
+
+	protected:
+
+		/// The gyroscope samples.
+		SampleMap gyroSamples_;
+
+		/// The accelerometer samples.
+		SampleMap accelerationSamples_;
+
+		/// The bias of the gyroscope.
+		Vector3 gyroBias_ = Vector3(0, 0, 0);
+
+		/// The bias of the accelerometer.
+		Vector3 accelerationBias_ = Vector3(0, 0, 0);
+
+		/// The mutex of this object.
+		mutable Mutex mutex_;
+};
+
+inline bool IMUPreintegrator::Preintegration::isValid() const
+{
+	return deltaTime_ >= 0.0 && start_Q_end_.isValid();
+}
+
+inline bool IMUPreintegrator::Preintegration::hasAcceleration() const
+{
+	return isValid() && hasAcceleration_;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_IMU_PREINTEGRATOR_H
@@ -0,0 +1,1110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/IncrementalBundleAdjustment.h"
+
+#include "ocean/geometry/AbsoluteTransformation.h"
+#include "ocean/geometry/Jacobian.h"
+
+#include "ocean/math/ExponentialMap.h"
+#include "ocean/math/Rotation.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+IncrementalBundleAdjustment::IncrementalBundleAdjustment(const Scalar relinearizationThreshold) :
+	relinearizationThreshold_(relinearizationThreshold)
+{
+	ocean_assert(relinearizationThreshold_ >= Scalar(0));
+}
+
+bool IncrementalBundleAdjustment::optimize(const AnyCamera& camera, const Indices32& keyFrameIndices, const HomogenousMatrices4& flippedCameras_T_world, const Indices32& objectPointIds, const Vectors3& objectPoints, const Geometry::NonLinearOptimization::ObjectPointGroupsAccessor& correspondenceGroups, HomogenousMatrices4& optimizedFlippedCameras_T_world, Vectors3& optimizedObjectPoints, const Geometry::GravityConstraints* gravityConstraints, const unsigned int iterations, const Scalar lambda, const Scalar lambdaFactor, Scalar* initialError, Scalar* finalError)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(keyFrameIndices.size() >= 2);
+	ocean_assert(keyFrameIndices.size() == flippedCameras_T_world.size());
+	ocean_assert(objectPointIds.size() == objectPoints.size());
+	ocean_assert(objectPointIds.size() == correspondenceGroups.groups());
+	ocean_assert(iterations >= 1u);
+	ocean_assert(lambda > Scalar(0) && lambdaFactor > Scalar(1));
+
+	if (!camera.isValid() || keyFrameIndices.size() < 2 || keyFrameIndices.size() != flippedCameras_T_world.size() || objectPointIds.size() < 5 || objectPointIds.size() != objectPoints.size() || objectPointIds.size() != correspondenceGroups.groups())
+	{
+		return false;
+	}
+
+	if (gravityConstraints != nullptr && gravityConstraints->numberCameras() != keyFrameIndices.size())
+	{
+		ocean_assert(false && "Invalid gravity constraints!");
+		return false;
+	}
+
+	linearizedObservations_ = 0;
+	reusedObservations_ = 0;
+
+	const UnorderedIndexSet32 keyFrameIndexSet(keyFrameIndices.cbegin(), keyFrameIndices.cend());
+	const UnorderedIndexSet32 objectPointIdSet(objectPointIds.cbegin(), objectPointIds.cend());
+
+	ocean_assert(keyFrameIndexSet.size() == keyFrameIndices.size());
+	ocean_assert(objectPointIdSet.size() == objectPointIds.size());
+
+	// first, we marginalize all keyframes which are leaving the window, based on the state of the previous optimization
+
+	marginalizeKeyFrames(camera, keyFrameIndexSet, objectPointIdSet);
+
+	updateWindow(keyFrameIndices, flippedCameras_T_world, objectPointIds, objectPoints, correspondenceGroups, gravityConstraints);
+
+	size_t numberObservations = 0;
+
+	for (const ObjectPoint& objectPoint : objectPoints_)
+	{
+		numberObservations += objectPoint.observations_.size();
+	}
+
+	ocean_assert(numberObservations != 0);
+
+	Poses flippedCameras_P_world = keyFramePoses();
+	Vectors3 positions = objectPointPositions();
+
+	Scalar sqrProjectionError = Numeric::maxValue();
+	Scalar bestError = determineError(camera, flippedCameras_P_world, positions, &sqrProjectionError);
+
+	if (bestError == Numeric::maxValue())
+	{
+		// at least one object point is located behind a camera
+		return false;
+	}
+
+	if (initialError != nullptr)
+	{
+		*initialError = sqrProjectionError / Scalar(numberObservations);
+	}
+
+	constexpr Scalar maxLambda = Scalar(1e8);
+
+	Scalar currentLambda = lambda;
+
+	LinearSystem linearSystem;
+	bool needsLinearSystem = true;
+
+	Matrix deltaPoses;
+	Vectors3 deltaPoints;
+
+	Poses candidateFlippedCameras_P_world(flippedCameras_P_world.size());
+	Vectors3 candidatePositions(positions.size());
+
+	for (unsigned int iteration = 0u; iteration < iterations; ++iteration)
+	{
+		if (needsLinearSystem)
+		{
+			determineLinearSystem(camera, linearSystem, false /*forceLinearization*/);
+			needsLinearSystem = false;
+		}
+
+		if (!solve(linearSystem, currentLambda, deltaPoses, deltaPoints))
+		{
+			if (currentLambda > maxLambda)
+			{
+				break;
+			}
+
+			currentLambda *= lambdaFactor;
+			continue;
+		}
+
+		// we apply the deltas by: new = old - deltas
+
+		for (size_t nPose = 0; nPose < flippedCameras_P_world.size(); ++nPose)
+		{
+			const Scalar* delta = deltaPoses.data() + nPose * 6;
+
+			candidateFlippedCameras_P_world[nPose] = flippedCameras_P_world[nPose] - Pose(delta[3], delta[4], delta[5], delta[0], delta[1], delta[2]);
+		}
+
+		for (size_t nPoint = 0; nPoint < positions.size(); ++nPoint)
+		{
+			candidatePositions[nPoint] = positions[nPoint] - deltaPoints[nPoint];
+		}
+
+		Scalar candidateSqrProjectionError = Numeric::maxValue();
+		const Scalar candidateError = determineError(camera, candidateFlippedCameras_P_world, candidatePositions, &candidateSqrProjectionError);
+
+		if (candidateError >= bestError)
+		{
+			if (currentLambda > maxLambda)
+			{
+				// no further improvement can be applied
+				break;
+			}
+
+			currentLambda *= lambdaFactor;
+			continue;
+		}
+
+		bestError = candidateError;
+		sqrProjectionError = candidateSqrProjectionError;
+
+		std::swap(flippedCameras_P_world, candidateFlippedCameras_P_world);
+		std::swap(positions, candidatePositions);
+
+		for (size_t nPose = 0; nPose < keyFrames_.size(); ++nPose)
+		{
+			keyFrames_[nPose].flippedCamera_P_world_ = flippedCameras_P_world[nPose];
+		}
+
+		for (size_t nPoint = 0; nPoint < objectPoints_.size(); ++nPoint)
+		{
+			objectPoints_[nPoint].position_ = positions[nPoint];
+		}
+
+		needsLinearSystem = true;
+
+		if (currentLambda > Numeric::eps())
+		{
+			currentLambda /= lambdaFactor;
+		}
+
+		if (Numeric::isEqualEps(deltaPoses.norm() / Scalar(deltaPoses.elements())))
+		{
+			// the optimization has converged
+			break;
+		}
+	}
+
+	// the monocular Bundle Adjustment cannot observe the gauge, so we align the result with the provided poses
+
+	HomogenousMatrices4 world_T_originalCameras(keyFrames_.size());
+	HomogenousMatrices4 world_T_optimizedCameras(keyFrames_.size());
+
+	for (size_t nPose = 0; nPose < keyFrames_.size(); ++nPose)
+	{
+		world_T_originalCameras[nPose] = AnyCamera::invertedFlipped2Standard(flippedCameras_T_world[nPose]);
+		world_T_optimizedCameras[nPose] = AnyCamera::invertedFlipped2Standard(keyFrames_[nPose].flippedCamera_P_world_.transformation());
+	}
+
+	HomogenousMatrix4 original_T_optimized(false);
+	Scalar scale = Scalar(1);
+
+	if (Geometry::AbsoluteTransformation::calculateTransformation(world_T_optimizedCameras.data(), world_T_originalCameras.data(), world_T_originalCameras.size(), original_T_optimized, Geometry::AbsoluteTransformation::ScaleErrorType::Symmetric, &scale))
+	{
+		// we apply the similarity transformation manually to keep the camera rotations orthonormal
+
+		const SquareMatrix3 transformRotation = original_T_optimized.rotationMatrix();
+		ocean_assert(transformRotation.isOrthonormal());
+		const Vector3 transformTranslation = original_T_optimized.translation();
+
+		for (size_t nPose = 0; nPose < keyFrames_.size(); ++nPose)
+		{
+			const HomogenousMatrix4& world_T_optimizedCamera = world_T_optimizedCameras[nPose];
+
+			const HomogenousMatrix4 world_T_camera((transformRotation * world_T_optimizedCamera.translation()) * scale + transformTranslation, transformRotation * world_T_optimizedCamera.rotationMatrix());
+
+			keyFrames_[nPose].flippedCamera_P_world_ = Pose(AnyCamera::standard2InvertedFlipped(world_T_camera));
+		}
+
+		// the linearization point of the prior is moved into the same coordinate system, otherwise the prior would pull the window back into the previous gauge
+
+		for (Pose& priorFlippedCamera_P_world : priorFlippedCameras_P_world_)
+		{
+			const HomogenousMatrix4 world_T_priorCamera = AnyCamera::invertedFlipped2Standard(priorFlippedCamera_P_world.transformation());
+
+			const HomogenousMatrix4 world_T_camera((transformRotation * world_T_priorCamera.translation()) * scale + transformTranslation, transformRotation * world_T_priorCamera.rotationMatrix());
+
+			priorFlippedCamera_P_world = Pose(AnyCamera::standard2InvertedFlipped(world_T_camera));
+		}
+
+		Scalar sumDistances = Scalar(0);
+
+		for (ObjectPoint& objectPoint : objectPoints_)
+		{
+			objectPoint.position_ = (transformRotation * objectPoint.position_) * scale + transformTranslation;
+
+			sumDistances += objectPoint.position_.distance(world_T_originalCameras.front().translation());
+		}
+
+		// the projections are invariant to the similarity transformation but the Jacobians are not,
+		// so we have to discard the cached linearizations in case the alignment is not negligible
+
+		const Scalar averageDistance = sumDistances / Scalar(objectPoints_.size());
+
+		const bool negligibleAlignment = Rotation(transformRotation).angle() <= Numeric::deg2rad(Scalar(0.01)) && Numeric::isEqual(scale, Scalar(1), Scalar(0.0001)) && transformTranslation.length() <= averageDistance * Scalar(0.0001);
+
+		if (!negligibleAlignment)
+		{
+			for (ObjectPoint& objectPoint : objectPoints_)
+			{
+				for (Observation& observation : objectPoint.observations_)
+				{
+					observation.linearizedProjection_ = Vector2::minValue();
+				}
+			}
+		}
+	}
+
+	optimizedFlippedCameras_T_world.resize(keyFrames_.size());
+
+	for (size_t nPose = 0; nPose < keyFrames_.size(); ++nPose)
+	{
+		optimizedFlippedCameras_T_world[nPose] = keyFrames_[nPose].flippedCamera_P_world_.transformation();
+	}
+
+	optimizedObjectPoints = objectPointPositions();
+
+	if (finalError != nullptr)
+	{
+		*finalError = sqrProjectionError / Scalar(numberObservations);
+	}
+
+	return true;
+}
+
+void IncrementalBundleAdjustment::reset()
+{
+	keyFrameIndices_.clear();
+	keyFrames_.clear();
+
+	objectPointIds_.clear();
+	objectPoints_.clear();
+
+	priorFrameIndices_.clear();
+	priorPoseIndices_.clear();
+	priorFlippedCameras_P_world_.clear();
+	priorHessian_ = Matrix();
+	priorGradient_ = Matrix();
+
+	marginalizedObjectPointIds_.clear();
+
+	linearizedObservations_ = 0;
+	reusedObservations_ = 0;
+}
+
+void IncrementalBundleAdjustment::marginalizeKeyFrames(const AnyCamera& camera, const UnorderedIndexSet32& newKeyFrameIndexSet, const UnorderedIndexSet32& newObjectPointIdSet)
+{
+	ocean_assert(camera.isValid());
+
+	Indices32 keptPoseIndices;
+	Indices32 removedPoseIndices;
+
+	std::vector<uint8_t> removedPoseStatements(keyFrameIndices_.size(), 0u);
+
+	for (size_t nPose = 0; nPose < keyFrameIndices_.size(); ++nPose)
+	{
+		if (newKeyFrameIndexSet.find(keyFrameIndices_[nPose]) != newKeyFrameIndexSet.cend())
+		{
+			keptPoseIndices.push_back(Index32(nPose));
+		}
+		else
+		{
+			removedPoseIndices.push_back(Index32(nPose));
+			removedPoseStatements[nPose] = 1u;
+		}
+	}
+
+	if (removedPoseIndices.empty())
+	{
+		return;
+	}
+
+	if (keptPoseIndices.empty())
+	{
+		// the new window does not have anything in common with the current window, so the information cannot be preserved
+
+		priorFrameIndices_.clear();
+		priorPoseIndices_.clear();
+		priorFlippedCameras_P_world_.clear();
+		priorHessian_ = Matrix();
+		priorGradient_ = Matrix();
+
+		return;
+	}
+
+	const Poses flippedCameras_P_world = keyFramePoses();
+
+	HomogenousMatrices4 flippedCameras_T_world;
+	SquareMatrices3 rodriguesDerivatives;
+	determineTransformations(flippedCameras_P_world, flippedCameras_T_world, rodriguesDerivatives);
+
+	const size_t poseDimension = keyFrames_.size() * 6;
+
+	Matrix matrixA(poseDimension, poseDimension, false);
+	Matrix gradientPoses(poseDimension, 1, false);
+
+	StaticMatrices6x3 matricesB;
+
+	// we marginalize all object points which are observed in the removed keyframes and which are leaving the window,
+	// observations of object points staying in the window are dropped
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints_.size(); ++nObjectPoint)
+	{
+		const Index32 objectPointId = objectPointIds_[nObjectPoint];
+
+		if (newObjectPointIdSet.find(objectPointId) != newObjectPointIdSet.cend())
+		{
+			continue;
+		}
+
+		ObjectPoint& objectPoint = objectPoints_[nObjectPoint];
+
+		bool observedInRemovedPose = false;
+
+		for (const Observation& observation : objectPoint.observations_)
+		{
+			if (removedPoseStatements[observation.poseIndex_] != 0u)
+			{
+				observedInRemovedPose = true;
+				break;
+			}
+		}
+
+		if (!observedInRemovedPose)
+		{
+			continue;
+		}
+
+		SquareMatrix3 matrixD(false);
+		Vector3 gradientPoint(0, 0, 0);
+
+		matricesB.resize(objectPoint.observations_.size());
+
+		for (size_t nObservation = 0; nObservation < objectPoint.observations_.size(); ++nObservation)
+		{
+			Observation& observation = objectPoint.observations_[nObservation];
+
+			const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world[observation.poseIndex_];
+
+			const Vector2 projection = camera.projectToImageIF(flippedCamera_T_world, objectPoint.position_);
+
+			// the marginalization needs exact Jacobians at the current state
+
+			linearizeObservation(camera, flippedCamera_T_world, rodriguesDerivatives.data() + observation.poseIndex_ * 3, objectPoint.position_, projection, observation);
+
+			addObservation(observation, projection - observation.imagePoint_, matrixA, gradientPoses, matricesB[nObservation], matrixD, gradientPoint);
+		}
+
+		// a tiny regularization ensures that also object points with degenerated observations can be marginalized
+
+		const Scalar regularization = std::max(matrixD.trace() * Scalar(1e-9), Numeric::eps());
+
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			matrixD(n, n) += regularization;
+		}
+
+		SquareMatrix3 invertedMatrixD;
+		if (matrixD.invert(invertedMatrixD))
+		{
+			schurComplementObjectPoint(objectPoint.observations_, matricesB.data(), invertedMatrixD, gradientPoint, matrixA, gradientPoses);
+
+			marginalizedObjectPointIds_.emplace(objectPointId);
+		}
+	}
+
+	for (const Index32 removedPoseIndex : removedPoseIndices)
+	{
+		if (keyFrames_[removedPoseIndex].gravityWeight_ > Scalar(0))
+		{
+			addGravityConstraint(keyFrames_[removedPoseIndex], flippedCameras_T_world[removedPoseIndex], rodriguesDerivatives.data() + removedPoseIndex * 3, removedPoseIndex, matrixA, gradientPoses);
+		}
+	}
+
+	if (hasPrior())
+	{
+		addPrior(priorPoseIndices_, flippedCameras_P_world, matrixA, gradientPoses);
+	}
+
+	// now we apply the Schur complement on the removed keyframes
+
+	const size_t keptDimension = keptPoseIndices.size() * 6;
+	const size_t removedDimension = removedPoseIndices.size() * 6;
+
+	Matrix matrixKK(keptDimension, keptDimension);
+	Matrix matrixKR(keptDimension, removedDimension);
+	Matrix matrixRR(removedDimension, removedDimension);
+	Matrix gradientK(keptDimension, 1);
+	Matrix gradientR(removedDimension, 1);
+
+	const auto parameterIndex = [](const Indices32& poseIndices, const size_t index)
+	{
+		return size_t(poseIndices[index / 6]) * 6 + index % 6;
+	};
+
+	for (size_t row = 0; row < keptDimension; ++row)
+	{
+		const size_t sourceRow = parameterIndex(keptPoseIndices, row);
+
+		for (size_t column = 0; column < keptDimension; ++column)
+		{
+			matrixKK(row, column) = matrixA(sourceRow, parameterIndex(keptPoseIndices, column));
+		}
+
+		for (size_t column = 0; column < removedDimension; ++column)
+		{
+			matrixKR(row, column) = matrixA(sourceRow, parameterIndex(removedPoseIndices, column));
+		}
+
+		gradientK(row, 0) = gradientPoses(sourceRow, 0);
+	}
+
+	Scalar traceRR = Scalar(0);
+
+	for (size_t row = 0; row < removedDimension; ++row)
+	{
+		const size_t sourceRow = parameterIndex(removedPoseIndices, row);
+
+		for (size_t column = 0; column < removedDimension; ++column)
+		{
+			matrixRR(row, column) = matrixA(sourceRow, parameterIndex(removedPoseIndices, column));
+		}
+
+		gradientR(row, 0) = gradientPoses(sourceRow, 0);
+
+		traceRR += matrixRR(row, row);
+	}
+
+	if (traceRR <= Numeric::eps())
+	{
+		// the removed keyframes do not carry any information which could be preserved
+
+		if (hasPrior())
+		{
+			Indices32 priorFrameIndices;
+			Indices32 priorPoseIndices;
+			Poses priorFlippedCameras_P_world;
+
+			for (const Index32 keptPoseIndex : keptPoseIndices)
+			{
+				priorFrameIndices.push_back(keyFrameIndices_[keptPoseIndex]);
+				priorPoseIndices.push_back(keptPoseIndex);
+				priorFlippedCameras_P_world.push_back(flippedCameras_P_world[keptPoseIndex]);
+			}
+
+			priorFrameIndices_ = std::move(priorFrameIndices);
+			priorPoseIndices_ = std::move(priorPoseIndices);
+			priorFlippedCameras_P_world_ = std::move(priorFlippedCameras_P_world);
+			priorHessian_ = std::move(matrixKK);
+			priorGradient_ = std::move(gradientK);
+		}
+
+		return;
+	}
+
+	// the removed keyframes may be observed by a few object points only, so we use the pseudo inverse to handle rank deficient blocks
+
+	const Matrix invertedMatrixRR = matrixRR.pseudoInverted(Numeric::weakEps());
+
+	const Matrix matrixKRInvertedRR = matrixKR * invertedMatrixRR;
+
+	Matrix priorHessian = matrixKK - matrixKRInvertedRR * matrixKR.transposed();
+	Matrix priorGradient = gradientK - matrixKRInvertedRR * gradientR;
+
+	for (size_t row = 0; row < keptDimension; ++row)
+	{
+		for (size_t column = row + 1; column < keptDimension; ++column)
+		{
+			const Scalar value = (priorHessian(row, column) + priorHessian(column, row)) * Scalar(0.5);
+
+			priorHessian(row, column) = value;
+			priorHessian(column, row) = value;
+		}
+	}
+
+	priorFrameIndices_.clear();
+	priorPoseIndices_.clear();
+	priorFlippedCameras_P_world_.clear();
+
+	for (const Index32 keptPoseIndex : keptPoseIndices)
+	{
+		priorFrameIndices_.push_back(keyFrameIndices_[keptPoseIndex]);
+		priorPoseIndices_.push_back(keptPoseIndex);
+		priorFlippedCameras_P_world_.push_back(flippedCameras_P_world[keptPoseIndex]);
+	}
+
+	priorHessian_ = std::move(priorHessian);
+	priorGradient_ = std::move(priorGradient);
+}
+
+void IncrementalBundleAdjustment::updateWindow(const Indices32& keyFrameIndices, const HomogenousMatrices4& flippedCameras_T_world, const Indices32& objectPointIds, const Vectors3& objectPoints, const Geometry::NonLinearOptimization::ObjectPointGroupsAccessor& correspondenceGroups, const Geometry::GravityConstraints* gravityConstraints)
+{
+	ocean_assert(keyFrameIndices.size() == flippedCameras_T_world.size());
+	ocean_assert(objectPointIds.size() == objectPoints.size());
+	ocean_assert(objectPointIds.size() == correspondenceGroups.groups());
+
+	std::unordered_map<Index32, Index32> previousObjectPointIndexMap;
+	previousObjectPointIndexMap.reserve(objectPointIds_.size());
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds_.size(); ++nObjectPoint)
+	{
+		previousObjectPointIndexMap.emplace(objectPointIds_[nObjectPoint], Index32(nObjectPoint));
+	}
+
+	Indices32 observationsPerKeyFrame(keyFrameIndices.size(), 0u);
+
+	ObjectPoints newObjectPoints(objectPointIds.size());
+
+	Index32 poseIndex = Index32(-1);
+	Vector2 imagePoint;
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds.size(); ++nObjectPoint)
+	{
+		ocean_assert(!isObjectPointMarginalized(objectPointIds[nObjectPoint]));
+
+		ObjectPoint& newObjectPoint = newObjectPoints[nObjectPoint];
+		newObjectPoint.position_ = objectPoints[nObjectPoint];
+
+		const ObjectPoint* previousObjectPoint = nullptr;
+
+		const std::unordered_map<Index32, Index32>::const_iterator iPrevious = previousObjectPointIndexMap.find(objectPointIds[nObjectPoint]);
+
+		if (iPrevious != previousObjectPointIndexMap.cend())
+		{
+			previousObjectPoint = &objectPoints_[iPrevious->second];
+		}
+
+		const size_t numberObservations = correspondenceGroups.groupElements(nObjectPoint);
+		newObjectPoint.observations_.reserve(numberObservations);
+
+		for (size_t nObservation = 0; nObservation < numberObservations; ++nObservation)
+		{
+			correspondenceGroups.element(nObjectPoint, nObservation, poseIndex, imagePoint);
+
+			ocean_assert(poseIndex < keyFrameIndices.size());
+			const Index32 frameIndex = keyFrameIndices[poseIndex];
+
+			++observationsPerKeyFrame[poseIndex];
+
+			bool reused = false;
+
+			if (previousObjectPoint != nullptr)
+			{
+				// we re-use the cached linearization of identical observations
+
+				for (const Observation& previousObservation : previousObjectPoint->observations_)
+				{
+					if (previousObservation.frameIndex_ == frameIndex && previousObservation.imagePoint_ == imagePoint)
+					{
+						newObjectPoint.observations_.push_back(previousObservation);
+						newObjectPoint.observations_.back().poseIndex_ = poseIndex;
+
+						reused = true;
+						break;
+					}
+				}
+			}
+
+			if (!reused)
+			{
+				newObjectPoint.observations_.emplace_back(frameIndex, poseIndex, imagePoint);
+			}
+		}
+	}
+
+	objectPoints_ = std::move(newObjectPoints);
+	objectPointIds_ = objectPointIds;
+
+	keyFrames_.resize(keyFrameIndices.size());
+
+	for (size_t nPose = 0; nPose < keyFrameIndices.size(); ++nPose)
+	{
+		KeyFrame& keyFrame = keyFrames_[nPose];
+
+		keyFrame.flippedCamera_P_world_ = Pose(flippedCameras_T_world[nPose]);
+
+		if (gravityConstraints != nullptr)
+		{
+			constexpr Scalar fixedFactor = Scalar(1000); // fixed factor to balance projection error and gravity error, same as in NonLinearOptimizationObjectPoint
+
+			keyFrame.cameraGravityInFlippedCamera_ = gravityConstraints->cameraGravityInFlippedCamera(nPose);
+			keyFrame.worldGravityInWorld_ = gravityConstraints->worldGravityInWorld();
+			keyFrame.gravityWeight_ = Numeric::sqrt(Scalar(observationsPerKeyFrame[nPose] * 2u)) * fixedFactor * gravityConstraints->weightFactor();
+		}
+		else
+		{
+			keyFrame.cameraGravityInFlippedCamera_ = Vector3(0, 0, 0);
+			keyFrame.worldGravityInWorld_ = Vector3(0, 0, 0);
+			keyFrame.gravityWeight_ = Scalar(0);
+		}
+	}
+
+	keyFrameIndices_ = keyFrameIndices;
+
+	priorPoseIndices_.clear();
+
+	if (!priorFrameIndices_.empty())
+	{
+		std::unordered_map<Index32, Index32> poseIndexMap;
+		poseIndexMap.reserve(keyFrameIndices_.size());
+
+		for (size_t nPose = 0; nPose < keyFrameIndices_.size(); ++nPose)
+		{
+			poseIndexMap.emplace(keyFrameIndices_[nPose], Index32(nPose));
+		}
+
+		for (const Index32 priorFrameIndex : priorFrameIndices_)
+		{
+			const std::unordered_map<Index32, Index32>::const_iterator iPose = poseIndexMap.find(priorFrameIndex);
+
+			if (iPose == poseIndexMap.cend())
+			{
+				ocean_assert(false && "All keyframes of the prior must be part of the window!");
+
+				priorFrameIndices_.clear();
+				priorPoseIndices_.clear();
+				priorFlippedCameras_P_world_.clear();
+				priorHessian_ = Matrix();
+				priorGradient_ = Matrix();
+
+				break;
+			}
+
+			priorPoseIndices_.push_back(iPose->second);
+		}
+	}
+}
+
+void IncrementalBundleAdjustment::determineLinearSystem(const AnyCamera& camera, LinearSystem& linearSystem, const bool forceLinearization)
+{
+	ocean_assert(camera.isValid());
+
+	const Poses flippedCameras_P_world = keyFramePoses();
+
+	HomogenousMatrices4 flippedCameras_T_world;
+	SquareMatrices3 rodriguesDerivatives;
+	determineTransformations(flippedCameras_P_world, flippedCameras_T_world, rodriguesDerivatives);
+
+	const size_t poseDimension = keyFrames_.size() * 6;
+
+	linearSystem.matrixA_ = Matrix(poseDimension, poseDimension, false);
+	linearSystem.gradientPoses_ = Matrix(poseDimension, 1, false);
+
+	linearSystem.matrixD_.resize(objectPoints_.size());
+	linearSystem.gradientPoints_.resize(objectPoints_.size());
+	linearSystem.matrixB_.clear();
+
+	const Scalar sqrRelinearizationThreshold = Numeric::sqr(relinearizationThreshold_);
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints_.size(); ++nObjectPoint)
+	{
+		ObjectPoint& objectPoint = objectPoints_[nObjectPoint];
+
+		SquareMatrix3& matrixD = linearSystem.matrixD_[nObjectPoint];
+		matrixD.toNull();
+
+		Vector3& gradientPoint = linearSystem.gradientPoints_[nObjectPoint];
+		gradientPoint = Vector3(0, 0, 0);
+
+		for (Observation& observation : objectPoint.observations_)
+		{
+			const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world[observation.poseIndex_];
+
+			const Vector2 projection = camera.projectToImageIF(flippedCamera_T_world, objectPoint.position_);
+
+			if (forceLinearization || !observation.isLinearized() || observation.linearizedProjection_.sqrDistance(projection) > sqrRelinearizationThreshold)
+			{
+				linearizeObservation(camera, flippedCamera_T_world, rodriguesDerivatives.data() + observation.poseIndex_ * 3, objectPoint.position_, projection, observation);
+
+				++linearizedObservations_;
+			}
+			else
+			{
+				++reusedObservations_;
+			}
+
+			linearSystem.matrixB_.emplace_back();
+
+			addObservation(observation, projection - observation.imagePoint_, linearSystem.matrixA_, linearSystem.gradientPoses_, linearSystem.matrixB_.back(), matrixD, gradientPoint);
+		}
+	}
+
+	for (size_t nPose = 0; nPose < keyFrames_.size(); ++nPose)
+	{
+		if (keyFrames_[nPose].gravityWeight_ > Scalar(0))
+		{
+			addGravityConstraint(keyFrames_[nPose], flippedCameras_T_world[nPose], rodriguesDerivatives.data() + nPose * 3, nPose, linearSystem.matrixA_, linearSystem.gradientPoses_);
+		}
+	}
+
+	if (hasPrior())
+	{
+		addPrior(priorPoseIndices_, flippedCameras_P_world, linearSystem.matrixA_, linearSystem.gradientPoses_);
+	}
+}
+
+bool IncrementalBundleAdjustment::solve(const LinearSystem& linearSystem, const Scalar lambda, Matrix& deltaPoses, Vectors3& deltaPoints) const
+{
+	ocean_assert(lambda >= Scalar(0));
+	ocean_assert(linearSystem.matrixD_.size() == objectPoints_.size());
+
+	Matrix matrixS(linearSystem.matrixA_);
+	Matrix gradientS(linearSystem.gradientPoses_);
+
+	for (size_t n = 0; n < matrixS.rows(); ++n)
+	{
+		matrixS(n, n) *= Scalar(1) + lambda;
+	}
+
+	SquareMatrices3 invertedMatricesD(objectPoints_.size());
+
+	size_t observationIndex = 0;
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints_.size(); ++nObjectPoint)
+	{
+		SquareMatrix3 matrixD(linearSystem.matrixD_[nObjectPoint]);
+
+		for (unsigned int n = 0u; n < 3u; ++n)
+		{
+			matrixD(n, n) *= Scalar(1) + lambda;
+		}
+
+		if (!matrixD.invert(invertedMatricesD[nObjectPoint]))
+		{
+			return false;
+		}
+
+		const Observations& observations = objectPoints_[nObjectPoint].observations_;
+
+		schurComplementObjectPoint(observations, linearSystem.matrixB_.data() + observationIndex, invertedMatricesD[nObjectPoint], linearSystem.gradientPoints_[nObjectPoint], matrixS, gradientS);
+
+		observationIndex += observations.size();
+	}
+
+	ocean_assert(observationIndex == linearSystem.matrixB_.size());
+
+	if (!matrixS.solve(gradientS, deltaPoses, Matrix::MP_SYMMETRIC))
+	{
+		return false;
+	}
+
+	// now we determine the deltas of the object points by back substitution: deltaPoint = D^-1 * (gradientPoint - B^T * deltaPoses)
+
+	deltaPoints.resize(objectPoints_.size());
+
+	observationIndex = 0;
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints_.size(); ++nObjectPoint)
+	{
+		Vector3 value(linearSystem.gradientPoints_[nObjectPoint]);
+
+		for (const Observation& observation : objectPoints_[nObjectPoint].observations_)
+		{
+			const StaticMatrix6x3& matrixB = linearSystem.matrixB_[observationIndex++];
+			const Scalar* deltaPose = deltaPoses.data() + observation.poseIndex_ * 6;
+
+			for (unsigned int column = 0u; column < 3u; ++column)
+			{
+				for (unsigned int row = 0u; row < 6u; ++row)
+				{
+					value[column] -= matrixB(row, column) * deltaPose[row];
+				}
+			}
+		}
+
+		deltaPoints[nObjectPoint] = invertedMatricesD[nObjectPoint] * value;
+	}
+
+	return true;
+}
+
+Scalar IncrementalBundleAdjustment::determineError(const AnyCamera& camera, const Poses& flippedCameras_P_world, const Vectors3& objectPoints, Scalar* sqrProjectionError) const
+{
+	ocean_assert(flippedCameras_P_world.size() == keyFrames_.size());
+	ocean_assert(objectPoints.size() == objectPoints_.size());
+
+	HomogenousMatrices4 flippedCameras_T_world(flippedCameras_P_world.size());
+
+	for (size_t nPose = 0; nPose < flippedCameras_P_world.size(); ++nPose)
+	{
+		flippedCameras_T_world[nPose] = flippedCameras_P_world[nPose].transformation();
+	}
+
+	Scalar sqrError = Scalar(0);
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPoints_.size(); ++nObjectPoint)
+	{
+		const Vector3& objectPoint = objectPoints[nObjectPoint];
+
+		for (const Observation& observation : objectPoints_[nObjectPoint].observations_)
+		{
+			const HomogenousMatrix4& flippedCamera_T_world = flippedCameras_T_world[observation.poseIndex_];
+
+			if (!AnyCamera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint))
+			{
+				return Numeric::maxValue();
+			}
+
+			sqrError += camera.projectToImageIF(flippedCamera_T_world, objectPoint).sqrDistance(observation.imagePoint_);
+		}
+	}
+
+	if (sqrProjectionError != nullptr)
+	{
+		*sqrProjectionError = sqrError;
+	}
+
+	Scalar error = sqrError;
+
+	for (size_t nPose = 0; nPose < keyFrames_.size(); ++nPose)
+	{
+		const KeyFrame& keyFrame = keyFrames_[nPose];
+
+		if (keyFrame.gravityWeight_ > Scalar(0))
+		{
+			const Vector3 gravityError = flippedCameras_T_world[nPose].rotationMatrix() * keyFrame.worldGravityInWorld_ - keyFrame.cameraGravityInFlippedCamera_;
+
+			error += gravityError.sqr() * Numeric::sqr(keyFrame.gravityWeight_);
+		}
+	}
+
+	if (hasPrior())
+	{
+		error += priorError(flippedCameras_P_world);
+	}
+
+	return error;
+}
+
+void IncrementalBundleAdjustment::addGravityConstraint(const KeyFrame& keyFrame, const HomogenousMatrix4& flippedCamera_T_world, const SquareMatrix3* rodriguesDerivatives, const size_t poseIndex, Matrix& matrixA, Matrix& gradientPoses)
+{
+	ocean_assert(keyFrame.gravityWeight_ > Scalar(0));
+	ocean_assert(rodriguesDerivatives != nullptr);
+
+	const Scalar weight = keyFrame.gravityWeight_;
+
+	const Vector3 weightedError = (flippedCamera_T_world.rotationMatrix() * keyFrame.worldGravityInWorld_ - keyFrame.cameraGravityInFlippedCamera_) * weight;
+
+	// the gravity error Jacobian with respect to rotation is: d(R * g_world) / dwi = Rwi * g_world
+
+	const Vector3 jacobians[3] =
+	{
+		(rodriguesDerivatives[0] * keyFrame.worldGravityInWorld_) * weight,
+		(rodriguesDerivatives[1] * keyFrame.worldGravityInWorld_) * weight,
+		(rodriguesDerivatives[2] * keyFrame.worldGravityInWorld_) * weight
+	};
+
+	const size_t offset = poseIndex * 6;
+
+	for (unsigned int row = 0u; row < 3u; ++row)
+	{
+		for (unsigned int column = 0u; column < 3u; ++column)
+		{
+			matrixA(offset + row, offset + column) += jacobians[row] * jacobians[column];
+		}
+
+		gradientPoses(offset + row, 0) += jacobians[row] * weightedError;
+	}
+}
+
+void IncrementalBundleAdjustment::addPrior(const Indices32& poseIndices, const Poses& flippedCameras_P_world, Matrix& matrixA, Matrix& gradientPoses) const
+{
+	ocean_assert(poseIndices.size() == priorFlippedCameras_P_world_.size());
+	ocean_assert(priorHessian_.rows() == poseIndices.size() * 6);
+
+	const size_t priorDimension = poseIndices.size() * 6;
+
+	Scalars differences(priorDimension);
+
+	for (size_t nPose = 0; nPose < poseIndices.size(); ++nPose)
+	{
+		ocean_assert(poseIndices[nPose] < flippedCameras_P_world.size());
+
+		poseDifference(flippedCameras_P_world[poseIndices[nPose]], priorFlippedCameras_P_world_[nPose], differences.data() + nPose * 6);
+	}
+
+	// the gradient of the prior is: g(x) = g0 + H0 * (x - x0)
+
+	for (size_t row = 0; row < priorDimension; ++row)
+	{
+		const size_t targetRow = size_t(poseIndices[row / 6]) * 6 + row % 6;
+
+		Scalar gradient = priorGradient_(row, 0);
+
+		for (size_t column = 0; column < priorDimension; ++column)
+		{
+			const Scalar value = priorHessian_(row, column);
+
+			matrixA(targetRow, size_t(poseIndices[column / 6]) * 6 + column % 6) += value;
+
+			gradient += value * differences[column];
+		}
+
+		gradientPoses(targetRow, 0) += gradient;
+	}
+}
+
+Scalar IncrementalBundleAdjustment::priorError(const Poses& flippedCameras_P_world) const
+{
+	ocean_assert(priorPoseIndices_.size() == priorFlippedCameras_P_world_.size());
+
+	const size_t priorDimension = priorPoseIndices_.size() * 6;
+
+	Scalars differences(priorDimension);
+
+	for (size_t nPose = 0; nPose < priorPoseIndices_.size(); ++nPose)
+	{
+		poseDifference(flippedCameras_P_world[priorPoseIndices_[nPose]], priorFlippedCameras_P_world_[nPose], differences.data() + nPose * 6);
+	}
+
+	// the prior's energy is: 2 * g0^T * (x - x0) + (x - x0)^T * H0 * (x - x0), matching the scale of the squared projection errors
+
+	Scalar error = Scalar(0);
+
+	for (size_t row = 0; row < priorDimension; ++row)
+	{
+		Scalar value = Scalar(0);
+
+		for (size_t column = 0; column < priorDimension; ++column)
+		{
+			value += priorHessian_(row, column) * differences[column];
+		}
+
+		error += (priorGradient_(row, 0) * Scalar(2) + value) * differences[row];
+	}
+
+	return error;
+}
+
+void IncrementalBundleAdjustment::addObservation(const Observation& observation, const Vector2& error, Matrix& matrixA, Matrix& gradientPoses, StaticMatrix6x3& matrixB, SquareMatrix3& matrixD, Vector3& gradientPoint)
+{
+	ocean_assert(observation.isLinearized());
+
+	const Scalar* const poseJacobianX = observation.poseJacobian_;
+	const Scalar* const poseJacobianY = observation.poseJacobian_ + 6;
+
+	const Scalar* const pointJacobianX = observation.pointJacobian_;
+	const Scalar* const pointJacobianY = observation.pointJacobian_ + 3;
+
+	const size_t offset = size_t(observation.poseIndex_) * 6;
+
+	for (size_t row = 0; row < 6; ++row)
+	{
+		for (size_t column = 0; column < 6; ++column)
+		{
+			matrixA(offset + row, offset + column) += poseJacobianX[row] * poseJacobianX[column] + poseJacobianY[row] * poseJacobianY[column];
+		}
+
+		for (size_t column = 0; column < 3; ++column)
+		{
+			matrixB(row, column) = poseJacobianX[row] * pointJacobianX[column] + poseJacobianY[row] * pointJacobianY[column];
+		}
+
+		gradientPoses(offset + row, 0) += poseJacobianX[row] * error[0] + poseJacobianY[row] * error[1];
+	}
+
+	for (unsigned int row = 0u; row < 3u; ++row)
+	{
+		for (unsigned int column = 0u; column < 3u; ++column)
+		{
+			matrixD(row, column) += pointJacobianX[row] * pointJacobianX[column] + pointJacobianY[row] * pointJacobianY[column];
+		}
+
+		gradientPoint[row] += pointJacobianX[row] * error[0] + pointJacobianY[row] * error[1];
+	}
+}
+
+void IncrementalBundleAdjustment::schurComplementObjectPoint(const Observations& observations, const StaticMatrix6x3* matricesB, const SquareMatrix3& invertedMatrixD, const Vector3& gradientPoint, Matrix& matrixS, Matrix& gradientPoses)
+{
+	ocean_assert(matricesB != nullptr);
+
+	// S -= B_a * D^-1 * B_b^T, for all pairs of observations (a, b)
+	// g -= B_a * D^-1 * g_point
+
+	const Vector3 invertedDGradientPoint = invertedMatrixD * gradientPoint;
+
+	for (size_t nOuter = 0; nOuter < observations.size(); ++nOuter)
+	{
+		const StaticMatrix6x3& outerMatrixB = matricesB[nOuter];
+		const size_t outerOffset = size_t(observations[nOuter].poseIndex_) * 6;
+
+		Scalar matrixE[6][3]; // B_a * D^-1
+
+		for (unsigned int row = 0u; row < 6u; ++row)
+		{
+			for (unsigned int column = 0u; column < 3u; ++column)
+			{
+				matrixE[row][column] = outerMatrixB(row, 0) * invertedMatrixD(0, column) + outerMatrixB(row, 1) * invertedMatrixD(1, column) + outerMatrixB(row, 2) * invertedMatrixD(2, column);
+			}
+
+			gradientPoses(outerOffset + row, 0) -= outerMatrixB(row, 0) * invertedDGradientPoint[0] + outerMatrixB(row, 1) * invertedDGradientPoint[1] + outerMatrixB(row, 2) * invertedDGradientPoint[2];
+		}
+
+		for (size_t nInner = 0; nInner < observations.size(); ++nInner)
+		{
+			const StaticMatrix6x3& innerMatrixB = matricesB[nInner];
+			const size_t innerOffset = size_t(observations[nInner].poseIndex_) * 6;
+
+			for (unsigned int row = 0u; row < 6u; ++row)
+			{
+				for (unsigned int column = 0u; column < 6u; ++column)
+				{
+					matrixS(outerOffset + row, innerOffset + column) -= matrixE[row][0] * innerMatrixB(column, 0) + matrixE[row][1] * innerMatrixB(column, 1) + matrixE[row][2] * innerMatrixB(column, 2);
+				}
+			}
+		}
+	}
+}
+
+void IncrementalBundleAdjustment::determineTransformations(const Poses& flippedCameras_P_world, HomogenousMatrices4& flippedCameras_T_world, SquareMatrices3& rodriguesDerivatives)
+{
+	flippedCameras_T_world.resize(flippedCameras_P_world.size());
+	rodriguesDerivatives.resize(flippedCameras_P_world.size() * 3);
+
+	for (size_t nPose = 0; nPose < flippedCameras_P_world.size(); ++nPose)
+	{
+		const Pose& flippedCamera_P_world = flippedCameras_P_world[nPose];
+
+		flippedCameras_T_world[nPose] = flippedCamera_P_world.transformation();
+
+		Geometry::Jacobian::calculateRotationRodriguesDerivative(ExponentialMap(flippedCamera_P_world.rx(), flippedCamera_P_world.ry(), flippedCamera_P_world.rz()), rodriguesDerivatives[nPose * 3 + 0], rodriguesDerivatives[nPose * 3 + 1], rodriguesDerivatives[nPose * 3 + 2]);
+	}
+}
+
+void IncrementalBundleAdjustment::linearizeObservation(const AnyCamera& camera, const HomogenousMatrix4& flippedCamera_T_world, const SquareMatrix3* rodriguesDerivatives, const Vector3& objectPoint, const Vector2& projection, Observation& observation)
+{
+	ocean_assert(rodriguesDerivatives != nullptr);
+
+	Geometry::Jacobian::calculatePoseJacobianRodrigues2x6IF(camera, flippedCamera_T_world, objectPoint, rodriguesDerivatives[0], rodriguesDerivatives[1], rodriguesDerivatives[2], observation.poseJacobian_, observation.poseJacobian_ + 6);
+	Geometry::Jacobian::calculatePointJacobian2x3IF(camera, flippedCamera_T_world, objectPoint, observation.pointJacobian_, observation.pointJacobian_ + 3);
+
+	observation.linearizedProjection_ = projection;
+}
+
+Poses IncrementalBundleAdjustment::keyFramePoses() const
+{
+	Poses flippedCameras_P_world;
+	flippedCameras_P_world.reserve(keyFrames_.size());
+
+	for (const KeyFrame& keyFrame : keyFrames_)
+	{
+		flippedCameras_P_world.push_back(keyFrame.flippedCamera_P_world_);
+	}
+
+	return flippedCameras_P_world;
+}
+
+Vectors3 IncrementalBundleAdjustment::objectPointPositions() const
+{
+	Vectors3 positions;
+	positions.reserve(objectPoints_.size());
+
+	for (const ObjectPoint& objectPoint : objectPoints_)
+	{
+		positions.push_back(objectPoint.position_);
+	}
+
+	return positions;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,480 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_INCREMENTAL_BUNDLE_ADJUSTMENT_H
+#define META_OCEAN_TRACKING_SLAM_INCREMENTAL_BUNDLE_ADJUSTMENT_H
+
+#include "ocean/tracking/slam/SLAM.h"
+
+#include "ocean/geometry/GravityConstraints.h"
+#include "ocean/geometry/NonLinearOptimization.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/Matrix.h"
+#include "ocean/math/Pose.h"
+#include "ocean/math/SquareMatrix3.h"
+#include "ocean/math/StaticMatrix.h"
+#include "ocean/math/Vector2.h"
+#include "ocean/math/Vector3.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+/**
+ * This class implements an incremental sliding-window Bundle Adjustment for keyframe poses and 3D object points.
+ * Instead of solving each keyframe window from scratch, the object keeps the state of the previous window between two invocations of optimize():
+ * <pre>
+ * - The Jacobians of all observations are cached, an observation is re-linearized only if the projection of its 3D object point moved more than a threshold since the last linearization.
+ * - Keyframes leaving the window are marginalized into a prior on the remaining keyframe poses (Schur complement), together with all 3D object points leaving the window with them.
+ * - Observations of 3D object points which stay in the window but which have been made in marginalized keyframes are dropped, so that no information is used twice.
+ * </pre>
+ * Camera poses are parameterized as inverted and flipped 6-DOF poses (Rodrigues rotation and translation), 3D object points with 3-DOF.<br>
+ * The linear equation of each iteration is reduced to the keyframe poses with a Schur complement on the 3D object points.<br>
+ * The object is not thread-safe, it is intended to be used by one background thread only.
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT IncrementalBundleAdjustment
+{
+	protected:
+
+		/**
+		 * Definition of a 6x3 matrix holding the pose/point block of the Hessian of one observation.
+		 */
+		using StaticMatrix6x3 = StaticMatrix<Scalar, 6, 3>;
+
+		/**
+		 * Definition of a vector holding 6x3 matrices.
+		 */
+		using StaticMatrices6x3 = std::vector<StaticMatrix6x3>;
+
+		/**
+		 * This class holds the relevant information of one keyframe in the window.
+		 */
+		class KeyFrame
+		{
+			public:
+
+				/// The inverted and flipped pose of the keyframe, with default camera pointing towards the positive z-space with y-axis downwards.
+				Pose flippedCamera_P_world_;
+
+				/// The gravity vector of the keyframe defined in the flipped camera coordinate system, a null vector if unknown.
+				Vector3 cameraGravityInFlippedCamera_ = Vector3(0, 0, 0);
+
+				/// The gravity vector defined in world, a null vector if unknown.
+				Vector3 worldGravityInWorld_ = Vector3(0, 0, 0);
+
+				/// The weight of the gravity constraint, 0 if the keyframe does not have a gravity constraint.
+				Scalar gravityWeight_ = Scalar(0);
+		};
+
+		/**
+		 * Definition of a vector holding keyframes.
+		 */
+		using KeyFrames = std::vector<KeyFrame>;
+
+		/**
+		 * This class holds one observation of a 3D object point together with the cached linearization.
+		 */
+		class Observation
+		{
+			public:
+
+				/**
+				 * Creates a new observation which has not been linearized yet.
+				 * @param frameIndex The index of the keyframe in which the observation has been made
+				 * @param poseIndex The index of the keyframe within the current window
+				 * @param imagePoint The 2D image point of the observation
+				 */
+				inline Observation(const Index32 frameIndex, const Index32 poseIndex, const Vector2& imagePoint);
+
+				/**
+				 * Returns whether this observation holds a valid linearization.
+				 * @return True, if so
+				 */
+				inline bool isLinearized() const;
+
+			public:
+
+				/// The index of the keyframe in which the observation has been made.
+				Index32 frameIndex_ = Index32(-1);
+
+				/// The index of the keyframe within the current window.
+				Index32 poseIndex_ = Index32(-1);
+
+				/// The 2D image point of the observation.
+				Vector2 imagePoint_;
+
+				/// The projected 3D object point at the moment the Jacobians have been determined, Vector2::minValue() if not yet linearized.
+				Vector2 linearizedProjection_ = Vector2::minValue();
+
+				/// The 2x6 Jacobian of the projection with respect to the pose, row aligned.
+				Scalar poseJacobian_[12];
+
+				/// The 2x3 Jacobian of the projection with respect to the 3D object point, row aligned.
+				Scalar pointJacobian_[6];
+		};
+
+		/**
+		 * Definition of a vector holding observations.
+		 */
+		using Observations = std::vector<Observation>;
+
+		/**
+		 * This class holds one 3D object point in the window together with its observations.
+		 */
+		class ObjectPoint
+		{
+			public:
+
+				/// The location of the 3D object point, defined in world.
+				Vector3 position_ = Vector3(Numeric::minValue(), Numeric::minValue(), Numeric::minValue());
+
+				/// The observations of the 3D object point in the keyframes of the window.
+				Observations observations_;
+		};
+
+		/**
+		 * Definition of a vector holding 3D object points.
+		 */
+		using ObjectPoints = std::vector<ObjectPoint>;
+
+		/**
+		 * This class holds the normal equation of the window for the current linearization.
+		 */
+		class LinearSystem
+		{
+			public:
+
+				/// The upper left block of the Hessian for all keyframe poses, with size (6 * keyframes)x(6 * keyframes).
+				Matrix matrixA_;
+
+				/// The pose/point blocks of the Hessian, one for each observation, in the order of the object points and their observations.
+				StaticMatrices6x3 matrixB_;
+
+				/// The 3x3 blocks of the Hessian for the 3D object points, one for each object point.
+				SquareMatrices3 matrixD_;
+
+				/// The gradient for all keyframe poses, with size (6 * keyframes)x1.
+				Matrix gradientPoses_;
+
+				/// The gradient for all 3D object points, one for each object point.
+				Vectors3 gradientPoints_;
+		};
+
+	public:
+
+		/**
+		 * Creates a new Bundle Adjustment object with empty window.
+		 * @param relinearizationThreshold The maximal distance the projection of an observation can move until the observation is re-linearized, in pixel, with range [0, infinity)
+		 */
+		explicit IncrementalBundleAdjustment(const Scalar relinearizationThreshold = Scalar(0.25));
+
+		/**
+		 * Optimizes the poses of keyframes and the locations of 3D object points, in a window which has been derived from the window of the previous call.
+		 * Keyframes of the previous window which are not part of the new window are marginalized before the optimization starts.<br>
+		 * The resulting poses and object points are aligned with the provided poses (by a similarity transformation), as the monocular Bundle Adjustment cannot observe the gauge.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param keyFrameIndices The indices of the keyframes in the new window, at least two
+		 * @param flippedCameras_T_world The current inverted and flipped poses of the keyframes, one for each keyframe index
+		 * @param objectPointIds The ids of the 3D object points in the new window, at least 5, must not contain marginalized object points
+		 * @param objectPoints The current locations of the 3D object points, one for each object point id
+		 * @param correspondenceGroups The observations of the 3D object points, one group for each object point, with pose indices defined in relation to the keyframe indices
+		 * @param optimizedFlippedCameras_T_world The resulting optimized poses of the keyframes
+		 * @param optimizedObjectPoints The resulting optimized locations of the 3D object points
+		 * @param gravityConstraints Optional gravity constraints, one for each keyframe, nullptr to optimize without gravity
+		 * @param iterations The number of optimization iterations, with range [1, infinity)
+		 * @param lambda The initial Levenberg-Marquardt damping value, with range (0, infinity)
+		 * @param lambdaFactor The Levenberg-Marquardt adjustment factor, with range (1, infinity)
+		 * @param initialError Optional resulting average squared projection error before the optimization
+		 * @param finalError Optional resulting average squared projection error after the optimization
+		 * @return True, if succeeded
+		 * @see isObjectPointMarginalized().
+		 */
+		bool optimize(const AnyCamera& camera, const Indices32& keyFrameIndices, const HomogenousMatrices4& flippedCameras_T_world, const Indices32& objectPointIds, const Vectors3& objectPoints, const Geometry::NonLinearOptimization::ObjectPointGroupsAccessor& correspondenceGroups, HomogenousMatrices4& optimizedFlippedCameras_T_world, Vectors3& optimizedObjectPoints, const Geometry::GravityConstraints* gravityConstraints = nullptr, const unsigned int iterations = 20u, const Scalar lambda = Scalar(0.001), const Scalar lambdaFactor = Scalar(5), Scalar* initialError = nullptr, Scalar* finalError = nullptr);
+
+		/**
+		 * Returns whether a 3D object point has been marginalized already.
+		 * The information of marginalized object points is part of the prior, so that marginalized object points must not be part of any further optimization.
+		 * @param objectPointId The id of the object point to check
+		 * @return True, if so
+		 */
+		inline bool isObjectPointMarginalized(const Index32 objectPointId) const;
+
+		/**
+		 * Returns the indices of the keyframes in the current window.
+		 * @return The window's keyframe indices
+		 */
+		inline const Indices32& keyFrameIndices() const;
+
+		/**
+		 * Returns whether the window holds a prior from marginalized keyframes.
+		 * @return True, if so
+		 */
+		inline bool hasPrior() const;
+
+		/**
+		 * Returns the number of observations which have been (re-)linearized during the last call of optimize().
+		 * @return The number of linearized observations, summed over all iterations
+		 */
+		inline size_t linearizedObservations() const;
+
+		/**
+		 * Returns the number of observations for which cached Jacobians have been re-used during the last call of optimize().
+		 * @return The number of re-used observations, summed over all iterations
+		 */
+		inline size_t reusedObservations() const;
+
+		/**
+		 * Resets the window, the prior and all marginalized object points.
+		 */
+		void reset();
+
+	protected:
+
+		/**
+		 * Marginalizes all keyframes of the current window which are not part of the new window.
+		 * Object points observed in the marginalized keyframes and not part of the new window are marginalized as well.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param newKeyFrameIndexSet The indices of the keyframes in the new window
+		 * @param newObjectPointIdSet The ids of the object points in the new window
+		 */
+		void marginalizeKeyFrames(const AnyCamera& camera, const UnorderedIndexSet32& newKeyFrameIndexSet, const UnorderedIndexSet32& newObjectPointIdSet);
+
+		/**
+		 * Updates the window with new keyframes and object points, cached linearizations of unchanged observations are kept.
+		 * @param keyFrameIndices The indices of the keyframes in the new window
+		 * @param flippedCameras_T_world The current poses of the keyframes
+		 * @param objectPointIds The ids of the object points in the new window
+		 * @param objectPoints The current locations of the object points
+		 * @param correspondenceGroups The observations of the object points
+		 * @param gravityConstraints Optional gravity constraints, one for each keyframe, nullptr otherwise
+		 */
+		void updateWindow(const Indices32& keyFrameIndices, const HomogenousMatrices4& flippedCameras_T_world, const Indices32& objectPointIds, const Vectors3& objectPoints, const Geometry::NonLinearOptimization::ObjectPointGroupsAccessor& correspondenceGroups, const Geometry::GravityConstraints* gravityConstraints);
+
+		/**
+		 * Determines the normal equation of the current window, observations are re-linearized when necessary.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param linearSystem The resulting linear system
+		 * @param forceLinearization True, to re-linearize all observations; False, to re-use cached Jacobians when possible
+		 */
+		void determineLinearSystem(const AnyCamera& camera, LinearSystem& linearSystem, const bool forceLinearization);
+
+		/**
+		 * Solves the damped normal equation with a Schur complement on the 3D object points.
+		 * @param linearSystem The linear system to solve
+		 * @param lambda The Levenberg-Marquardt damping value, with range [0, infinity)
+		 * @param deltaPoses The resulting deltas of the keyframe poses, with size (6 * keyframes)x1
+		 * @param deltaPoints The resulting deltas of the 3D object points, one for each object point
+		 * @return True, if succeeded
+		 */
+		bool solve(const LinearSystem& linearSystem, const Scalar lambda, Matrix& deltaPoses, Vectors3& deltaPoints) const;
+
+		/**
+		 * Determines the error of a candidate model.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param flippedCameras_P_world The candidate poses of the keyframes
+		 * @param objectPoints The candidate locations of the 3D object points
+		 * @param sqrProjectionError Optional resulting sum of squared projection errors
+		 * @return The overall error including the projection errors, the gravity errors, and the prior, Numeric::maxValue() if a 3D object point is located behind a camera
+		 */
+		Scalar determineError(const AnyCamera& camera, const Poses& flippedCameras_P_world, const Vectors3& objectPoints, Scalar* sqrProjectionError = nullptr) const;
+
+		/**
+		 * Adds the gravity constraint of one keyframe to a normal equation.
+		 * @param keyFrame The keyframe with gravity constraint
+		 * @param flippedCamera_T_world The transformation of the keyframe's pose
+		 * @param rodriguesDerivatives The three Rodrigues derivatives of the keyframe's rotation, must be valid
+		 * @param poseIndex The index of the keyframe in the normal equation
+		 * @param matrixA The Hessian of the poses to which the constraint will be added
+		 * @param gradientPoses The gradient of the poses to which the constraint will be added
+		 */
+		static void addGravityConstraint(const KeyFrame& keyFrame, const HomogenousMatrix4& flippedCamera_T_world, const SquareMatrix3* rodriguesDerivatives, const size_t poseIndex, Matrix& matrixA, Matrix& gradientPoses);
+
+		/**
+		 * Adds the prior to a normal equation, the gradient of the prior is evaluated at the given poses.
+		 * @param poseIndices The indices of the prior's keyframes in the normal equation, one for each keyframe of the prior
+		 * @param flippedCameras_P_world The poses of all keyframes in the normal equation
+		 * @param matrixA The Hessian of the poses to which the prior will be added
+		 * @param gradientPoses The gradient of the poses to which the prior will be added
+		 */
+		void addPrior(const Indices32& poseIndices, const Poses& flippedCameras_P_world, Matrix& matrixA, Matrix& gradientPoses) const;
+
+		/**
+		 * Determines the energy of the prior for given poses.
+		 * @param flippedCameras_P_world The poses of all keyframes in the current window
+		 * @return The energy of the prior, scaled to the squared projection errors
+		 */
+		Scalar priorError(const Poses& flippedCameras_P_world) const;
+
+		/**
+		 * Adds one linearized observation to a normal equation.
+		 * @param observation The linearized observation
+		 * @param error The projection error of the observation (projection minus image point)
+		 * @param matrixA The Hessian of the poses to which the observation will be added
+		 * @param gradientPoses The gradient of the poses to which the observation will be added
+		 * @param matrixB The resulting pose/point block of the observation
+		 * @param matrixD The Hessian block of the object point to which the observation will be added
+		 * @param gradientPoint The gradient of the object point to which the observation will be added
+		 */
+		static void addObservation(const Observation& observation, const Vector2& error, Matrix& matrixA, Matrix& gradientPoses, StaticMatrix6x3& matrixB, SquareMatrix3& matrixD, Vector3& gradientPoint);
+
+		/**
+		 * Applies the Schur complement of one 3D object point to the pose part of a normal equation.
+		 * @param observations The observations of the object point
+		 * @param matricesB The pose/point blocks of the observations, one for each observation
+		 * @param invertedMatrixD The inverted Hessian block of the object point
+		 * @param gradientPoint The gradient of the object point
+		 * @param matrixS The Hessian of the poses which will be reduced
+		 * @param gradientPoses The gradient of the poses which will be reduced
+		 */
+		static void schurComplementObjectPoint(const Observations& observations, const StaticMatrix6x3* matricesB, const SquareMatrix3& invertedMatrixD, const Vector3& gradientPoint, Matrix& matrixS, Matrix& gradientPoses);
+
+		/**
+		 * Determines the transformations and Rodrigues derivatives of keyframe poses.
+		 * @param flippedCameras_P_world The poses of the keyframes
+		 * @param flippedCameras_T_world The resulting transformations, one for each pose
+		 * @param rodriguesDerivatives The resulting Rodrigues derivatives, three for each pose
+		 */
+		static void determineTransformations(const Poses& flippedCameras_P_world, HomogenousMatrices4& flippedCameras_T_world, SquareMatrices3& rodriguesDerivatives);
+
+		/**
+		 * Determines the difference between a pose and a linearization pose in the parameter order of the Jacobian (rotation first).
+		 * @param flippedCamera_P_world The pose
+		 * @param linearizationFlippedCamera_P_world The linearization pose
+		 * @param difference The resulting 6 differences, must be valid
+		 */
+		static inline void poseDifference(const Pose& flippedCamera_P_world, const Pose& linearizationFlippedCamera_P_world, Scalar* difference);
+
+		/**
+		 * Linearizes one observation.
+		 * @param camera The camera profile defining the projection, must be valid
+		 * @param flippedCamera_T_world The pose of the observation's keyframe
+		 * @param rodriguesDerivatives The three Rodrigues derivatives of the keyframe's rotation, must be valid
+		 * @param objectPoint The location of the 3D object point
+		 * @param projection The projection of the 3D object point into the keyframe
+		 * @param observation The observation to linearize
+		 */
+		static void linearizeObservation(const AnyCamera& camera, const HomogenousMatrix4& flippedCamera_T_world, const SquareMatrix3* rodriguesDerivatives, const Vector3& objectPoint, const Vector2& projection, Observation& observation);
+
+		/**
+		 * Returns the current poses of all keyframes in the window.
+		 * @return The keyframe poses, one for each keyframe
+		 */
+		Poses keyFramePoses() const;
+
+		/**
+		 * Returns the current locations of all 3D object points in the window.
+		 * @return The object point locations, one for each object point
+		 */
+		Vectors3 objectPointPositions() const;
+
+	protected:
+
+		/// The indices of the keyframes in the current window.
+		Indices32 keyFrameIndices_;
+
+		/// The keyframes of the current window, one for each keyframe index.
+		KeyFrames keyFrames_;
+
+		/// The ids of the 3D object points in the current window.
+		Indices32 objectPointIds_;
+
+		/// The 3D object points of the current window, one for each object point id.
+		ObjectPoints objectPoints_;
+
+		/// The indices of the keyframes covered by the prior, empty if no prior exists.
+		Indices32 priorFrameIndices_;
+
+		/// The indices of the prior's keyframes within the current window, one for each keyframe of the prior.
+		Indices32 priorPoseIndices_;
+
+		/// The poses at which the prior has been linearized, one for each keyframe of the prior.
+		Poses priorFlippedCameras_P_world_;
+
+		/// The Hessian of the prior, with size (6 * priorKeyFrames)x(6 * priorKeyFrames).
+		Matrix priorHessian_;
+
+		/// The gradient of the prior at the linearization poses, with size (6 * priorKeyFrames)x1.
+		Matrix priorGradient_;
+
+		/// The ids of all 3D object points which have been marginalized.
+		UnorderedIndexSet32 marginalizedObjectPointIds_;
+
+		/// The maximal distance the projection of an observation can move until the observation is re-linearized, in pixel.
+		Scalar relinearizationThreshold_ = Scalar(0.25);
+
+		/// The number of observations which have been linearized during the last optimization.
+		size_t linearizedObservations_ = 0;
+
+		/// The number of observations with re-used Jacobians during the last optimization.
+		size_t reusedObservations_ = 0;
+};
+
+inline IncrementalBundleAdjustment::Observation::Observation(const Index32 frameIndex, const Index32 poseIndex, const Vector2& imagePoint) :
+	frameIndex_(frameIndex),
+	poseIndex_(poseIndex),
+	imagePoint_(imagePoint)
+{
+	// nothing to do here
+}
+
+inline bool IncrementalBundleAdjustment::Observation::isLinearized() const
+{
+	return linearizedProjection_ != Vector2::minValue();
+}
+
+inline bool IncrementalBundleAdjustment::isObjectPointMarginalized(const Index32 objectPointId) const
+{
+	return marginalizedObjectPointIds_.find(objectPointId) != marginalizedObjectPointIds_.cend();
+}
+
+inline const Indices32& IncrementalBundleAdjustment::keyFrameIndices() const
+{
+	return keyFrameIndices_;
+}
+
+inline bool IncrementalBundleAdjustment::hasPrior() const
+{
+	return !priorFrameIndices_.empty();
+}
+
+inline size_t IncrementalBundleAdjustment::linearizedObservations() const
+{
+	return linearizedObservations_;
+}
+
+inline size_t IncrementalBundleAdjustment::reusedObservations() const
+{
+	return reusedObservations_;
+}
+
+inline void IncrementalBundleAdjustment::poseDifference(const Pose& flippedCamera_P_world, const Pose& linearizationFlippedCamera_P_world, Scalar* difference)
+{
+	ocean_assert(difference != nullptr);
+
+	difference[0] = flippedCamera_P_world.rx() - linearizationFlippedCamera_P_world.rx();
+	difference[1] = flippedCamera_P_world.ry() - linearizationFlippedCamera_P_world.ry();
+	difference[2] = flippedCamera_P_world.rz() - linearizationFlippedCamera_P_world.rz();
+	difference[3] = flippedCamera_P_world.x() - linearizationFlippedCamera_P_world.x();
+	difference[4] = flippedCamera_P_world.y() - linearizationFlippedCamera_P_world.y();
+	difference[5] = flippedCamera_P_world.z() - linearizationFlippedCamera_P_world.z();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_INCREMENTAL_BUNDLE_ADJUSTMENT_H
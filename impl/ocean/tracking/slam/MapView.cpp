@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/MapView.h"
+
+#include <thread>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+MapView::ObjectPoint::ObjectPoint(const LocalizedObjectPoint& localizedObjectPoint) :
+	position_(localizedObjectPoint.position()),
+	localizationPrecision_(localizedObjectPoint.localizationPrecision()),
+	isBundleAdjusted_(localizedObjectPoint.isBundleAdjusted()),
+	descriptors_(localizedObjectPoint.descriptors())
+{
+	const Observation lastObservation = localizedObjectPoint.lastObservation();
+
+	lastObservationFrameIndex_ = lastObservation.frameIndex();
+	lastImagePoint_ = lastObservation.imagePoint();
+}
+
+MapView::MapView(const Index32 mapVersion, const LocalizedObjectPointMap& localizedObjectPointMap) :
+	mapVersion_(mapVersion)
+{
+	objectPointMap_.reserve(localizedObjectPointMap.size());
+
+	for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap)
+	{
+		objectPointMap_.emplace(objectPointPair.first, ObjectPoint(objectPointPair.second));
+	}
+}
+
+MapViewPublisher::MapViewPublisher()
+{
+	mapViews_[0] = std::make_shared<MapView>();
+	mapViews_[1] = mapViews_[0];
+}
+
+void MapViewPublisher::publish(SharedMapView&& mapView)
+{
+	ocean_assert(mapView);
+	if (!mapView)
+	{
+		return;
+	}
+
+	const std::lock_guard<std::mutex> lock(publishMutex_);
+
+	const unsigned int nextIndex = 1u - latestIndex_.load();
+
+	// the grace period: readers which may still access the previous view need to finish before the buffer can be replaced
+
+	while (readers_[nextIndex].load() != 0u)
+	{
+		std::this_thread::yield();
+	}
+
+	mapViews_[nextIndex] = std::move(mapView);
+
+	latestIndex_.store(nextIndex);
+}
+
+SharedMapView MapViewPublisher::latest() const
+{
+	while (true)
+	{
+		const unsigned int index = latestIndex_.load();
+
+		readers_[index].fetch_add(1u);
+
+		// in case the index has been swapped in the meantime, the buffer may be replaced already, so that we have to try again
+
+		if (latestIndex_.load() == index)
+		{
+			SharedMapView mapView = mapViews_[index];
+
+			readers_[index].fetch_sub(1u);
+
+			return mapView;
+		}
+
+		readers_[index].fetch_sub(1u);
+	}
+}
+
+}
+
+}
+
+}
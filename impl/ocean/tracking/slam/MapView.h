@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_MAP_VIEW_H
+#define META_OCEAN_TRACKING_SLAM_MAP_VIEW_H
+
+#include "ocean/tracking/slam/SLAM.h"
+#include "ocean/tracking/slam/LocalizedObjectPoint.h"
+
+#include "ocean/cv/detector/FREAKDescriptor.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+// Forward declaration.
+class MapView;
+
+/**
+ * Definition of a shared pointer holding an immutable MapView object.
+ * @see MapView
+ * @ingroup trackingslam
+ */
+using SharedMapView = std::shared_ptr<const MapView>;
+
+/**
+ * This class implements an immutable snapshot of all localized object points of a map.
+ * The snapshot is created by the thread maintaining the map and can be accessed by any other thread without any lock, as the object never changes after creation.
+ * @see MapViewPublisher
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT MapView
+{
+	public:
+
+		/**
+		 * This class holds the snapshot of one localized object point.
+		 */
+		class ObjectPoint
+		{
+			public:
+
+				/**
+				 * Creates a new snapshot of a localized object point.
+				 * @param localizedObjectPoint The localized object point from which the snapshot will be created
+				 */
+				explicit ObjectPoint(const LocalizedObjectPoint& localizedObjectPoint);
+
+			public:
+
+				/// The 3D position of the object point.
+				Vector3 position_;
+
+				/// The localization precision of the object point.
+				LocalizedObjectPoint::LocalizationPrecision localizationPrecision_ = LocalizedObjectPoint::LP_INVALID;
+
+				/// True, if the object point has been optimized during a Bundle Adjustment.
+				bool isBundleAdjusted_ = false;
+
+				/// The index of the frame in which the object point has been observed the last time at the moment the snapshot was created.
+				Index32 lastObservationFrameIndex_ = Index32(-1);
+
+				/// The image point of the last observation.
+				Vector2 lastImagePoint_;
+
+				/// The descriptors of the object point.
+				CV::Detector::FREAKDescriptors32 descriptors_;
+		};
+
+		/**
+		 * Definition of an unordered map mapping object point ids to snapshots of localized object points.
+		 */
+		using ObjectPointMap = std::unordered_map<Index32, ObjectPoint>;
+
+	public:
+
+		/**
+		 * Creates a new empty view.
+		 */
+		MapView() = default;
+
+		/**
+		 * Creates a new view for a given map.
+		 * The caller must ensure that the map is not modified while the view is created.
+		 * @param mapVersion The version of the map
+		 * @param localizedObjectPointMap The localized object points of the map
+		 */
+		MapView(const Index32 mapVersion, const LocalizedObjectPointMap& localizedObjectPointMap);
+
+		/**
+		 * Returns the version of the map from which this view has been created.
+		 * @return The map version
+		 */
+		inline Index32 mapVersion() const;
+
+		/**
+		 * Returns all object points of this view.
+		 * @return The view's object points
+		 */
+		inline const ObjectPointMap& objectPointMap() const;
+
+		/**
+		 * Returns the snapshot of a specific object point.
+		 * @param objectPointId The id of the object point
+		 * @return The object point's snapshot, nullptr if the view does not contain the object point
+		 */
+		inline const ObjectPoint* objectPoint(const Index32 objectPointId) const;
+
+		/**
+		 * Returns the number of object points in this view.
+		 * @return The view's number of object points
+		 */
+		inline size_t size() const;
+
+	protected:
+
+		/// The version of the map from which this view has been created.
+		Index32 mapVersion_ = 0u;
+
+		/// The snapshots of all localized object points.
+		ObjectPointMap objectPointMap_;
+};
+
+/**
+ * This class implements a read-copy-update publisher for map views.
+ * The maintaining thread creates a new view and publishes the view with an atomic index swap between two buffers.<br>
+ * Readers access the latest view without any lock, they never wait for a publishing thread.<br>
+ * Publishing threads wait until all readers of the buffer to be replaced have finished (the grace period of the previous view).
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT MapViewPublisher
+{
+	public:
+
+		/**
+		 * Creates a new publisher holding an empty view.
+		 */
+		MapViewPublisher();
+
+		/**
+		 * Publishes a new view which replaces the latest view.
+		 * @param mapView The view to publish, must be valid
+		 */
+		void publish(SharedMapView&& mapView);
+
+		/**
+		 * Returns the latest view, this function does not block.
+		 * @return The latest published view, always valid
+		 */
+		SharedMapView latest() const;
+
+	protected:
+
+		/**
+		 * Disabled copy constructor.
+		 */
+		MapViewPublisher(const MapViewPublisher&) = delete;
+
+		/**
+		 * Disabled copy operator.
+		 * @return Reference to this object
+		 */
+		MapViewPublisher& operator=(const MapViewPublisher&) = delete;
+
+	protected:
+
+		/// The two buffers holding the latest and the previous view.
+		SharedMapView mapViews_[2];
+
+		/// The index of the buffer holding the latest view, with range [0, 1].
+		std::atomic<unsigned int> latestIndex_ = 0u;
+
+		/// The number of readers currently accessing the individual buffers.
+		mutable std::atomic<unsigned int> readers_[2] = {0u, 0u};
+
+		/// The lock serializing publishing threads.
+		std::mutex publishMutex_;
+};
+
+inline Index32 MapView::mapVersion() const
+{
+	return mapVersion_;
+}
+
+inline const MapView::ObjectPointMap& MapView::objectPointMap() const
+{
+	return objectPointMap_;
+}
+
+inline const MapView::ObjectPoint* MapView::objectPoint(const Index32 objectPointId) const
+{
+	const ObjectPointMap::const_iterator iObjectPoint = objectPointMap_.find(objectPointId);
+
+	if (iObjectPoint == objectPointMap_.cend())
+	{
+		return nullptr;
+	}
+
+	return &iObjectPoint->second;
+}
+
+inline size_t MapView::size() const
+{
+	return objectPointMap_.size();
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_MAP_VIEW_H
@@ -92,6 +92,14 @@ void TrackerMono::ObjectPointOptimization::collectObjectPoints(const LocalizedOb
 	}
 }
 
+void TrackerMono::ObjectPointOptimization::initialObjectPoints(ObjectPointPositionMap& objectPointPositionMap) const
+{
+	for (const OptimizationObjectMap::value_type& optimizationObjectPair : optimizationObjectMap_)
+	{
+		objectPointPositionMap.emplace(optimizationObjectPair.first, optimizationObjectPair.second.objectPoint_);
+	}
+}
+
 void TrackerMono::ObjectPointOptimization::optimizeObjectPointsIF(const AnyCamera& camera, const HomogenousMatrices4& optimizedFlippedCameras_T_world, const Geometry::Estimator::EstimatorType estimatorType, const Scalar maximalProjectionError, UnorderedIndexSet32& currentBundleAdjustmentObjectPointIdSet, Indices32& currentObjectPointIds, Vectors3& currentObjectPointPositions, Indices32& inaccurateObjectPointIds)
 {
 	HomogenousMatrices4 subsetFlippedCameras_T_world;
@@ -191,6 +199,7 @@ std::string TrackerMono::PerformanceStatistics::toString() const
 	result += "\nDetermine initial object points: " + determineInitialObjectPoints_.toString();
 	result += "\nRecognize object points: " + relocalize_.toString();
 	result += "\nOptimize bad object points: " + optimizeBadObjectPoints_.toString();
+	result += "\n\nBackground task (bundle adjustment):";
 	result += "\nOptimize poses and object points: " + bundleAdjustment_.toString();
 
 	return result;
@@ -307,6 +316,7 @@ TrackerMono::TrackerMono()
 	harrisThreshold_ = configuration_.harrisThresholdMean();
 
 	postHandleFrameTask_.setTask(std::bind(&TrackerMono::postHandleFrame, this));
+	bundleAdjustmentTask_.setTask(std::bind(&TrackerMono::executeBundleAdjustment, this));
 }
 
 TrackerMono::~TrackerMono()
@@ -314,6 +324,8 @@ TrackerMono::~TrackerMono()
 	postHandleFrameTask_.release();
 
 	stopThreadExplicitly();
+
+	bundleAdjustmentTask_.release();
 }
 
 bool TrackerMono::configure(const Configuration& configuration)
@@ -460,13 +472,32 @@ bool TrackerMono::handleFrame(const AnyCamera& camera, Frame&& yFrame, Homogenou
 	previousPyramid_ = std::move(currentPyramid_);
 	currentPyramid_ = std::move(tempCurrentPyramid);
 
+	const Timestamp currentFrameTimestamp = currentPyramid_->finestLayer().timestamp();
+
 	Quaternion previousCamera_Q_currentCamera(false);
+	bool rotationFromPreintegration = false;
+
 	if (anyWorld_Q_previousCamera_.isValid() && anyWorld_Q_camera.isValid())
 	{
 		previousCamera_Q_currentCamera = anyWorld_Q_previousCamera_.inverted() * anyWorld_Q_camera;
 	}
+	else if (previousPyramid_)
+	{
+		// without external orientation, we use the preintegrated gyro samples between the previous and the current frame (if available)
+
+		IMUPreintegrator::Preintegration preintegration;
+		if (imuPreintegrator_.preintegrate(previousPyramid_->finestLayer().timestamp(), currentFrameTimestamp, preintegration))
+		{
+			previousCamera_Q_currentCamera = preintegration.start_Q_end_;
+			rotationFromPreintegration = true;
+		}
+	}
+
+	// the samples before the current frame are not needed anymore, regardless whether they have been used (the preintegrator keeps the latest sample before the timestamp)
 
-	SharedCameraPose cameraPose = trackImagePointsAndDeterminePose(camera, currentFrameIndex, randomGenerator_, previousCamera_Q_currentCamera);
+	imuPreintegrator_.removeSamples(currentFrameTimestamp);
+
+	SharedCameraPose cameraPose = trackImagePointsAndDeterminePose(camera, currentFrameIndex, randomGenerator_, previousCamera_Q_currentCamera, rotationFromPreintegration);
 
 	if (cameraPose)
 	{
@@ -517,25 +548,19 @@ bool TrackerMono::handleFrame(const AnyCamera& camera, Frame&& yFrame, Homogenou
 		debugData_.posePreciseObjectPointIds_ = std::move(poseCorrespondences_.preciseObjectPointIds_);
 		debugData_.poseNotPreciseObjectPointIds_ = std::move(poseCorrespondences_.impreciseObjectPointIds_);
 
-		const ReadLock readLock(mutex_);
+		// the latest map view can be accessed without any lock, so that the frame thread does not need to wait for the background thread
 
-		// TOOD we should store the information in the pose/tracking correspondences to avoid a read lock in the handleFrame() function
+		const SharedMapView mapView = mapViewPublisher_.latest();
+		ocean_assert(mapView);
 
 		for (DebugData::PointMap::value_type& pointPair : debugData_.pointMap_)
 		{
 			const Index32 objectPointId = pointPair.first;
 			DebugData::Point& point = pointPair.second;
 
-			LocalizedObjectPointMap::const_iterator iLocalizedObjectPoint = localizedObjectPointMap_.find(objectPointId);
+			const MapView::ObjectPoint* objectPoint = mapView->objectPoint(objectPointId);
 
-			if (iLocalizedObjectPoint != localizedObjectPointMap_.cend())
-			{
-				point.isBundleAdjusted_ = iLocalizedObjectPoint->second.isBundleAdjusted();
-			}
-			else
-			{
-				point.isBundleAdjusted_ = false;
-			}
+			point.isBundleAdjusted_ = objectPoint != nullptr && objectPoint->isBundleAdjusted_;
 		}
 
 		*debugData = debugData_;
@@ -578,7 +603,7 @@ bool TrackerMono::needsFrameStatistics(const Index32 frameIndex, FrameStatistics
 	return true;
 }
 
-SharedCameraPose TrackerMono::trackImagePointsAndDeterminePose(const AnyCamera& camera, const Index32 currentFrameIndex, RandomGenerator& randomGenerator, const Quaternion& previousCamera_Q_currentCamera)
+SharedCameraPose TrackerMono::trackImagePointsAndDeterminePose(const AnyCamera& camera, const Index32 currentFrameIndex, RandomGenerator& randomGenerator, const Quaternion& previousCamera_Q_currentCamera, const bool predictTranslation)
 {
 	ocean_assert(camera.isValid());
 
@@ -624,8 +649,28 @@ SharedCameraPose TrackerMono::trackImagePointsAndDeterminePose(const AnyCamera&
 		Log::warning() << "TrackerMono: Frame interval outside of expected frame interval: " << String::toAString(double(currentPyramid.finestLayer().timestamp() - previousPyramid.finestLayer().timestamp()) * 1000.0, 1u) << "ms";
 	}
 
+	const double frameInterval = double(currentPyramid.finestLayer().timestamp() - previousPyramid.finestLayer().timestamp());
+
+	Vector3 previousCamera_t_currentCamera(0, 0, 0);
+
+	if (predictTranslation && world_T_previousCamera.isValid() && previous_Q_current.isValid() && previousFrameIndex >= 1u && previousFrameInterval_ > 0.0)
+	{
+		// the rotation is known from the IMU samples, the translation is predicted with a constant velocity model (the map does not have a metric scale)
+
+		const SharedCameraPose secondPreviousCameraPose = cameraPoses_.pose(previousFrameIndex - 1u);
+
+		if (secondPreviousCameraPose && secondPreviousCameraPose->mapVersion() == trackingCorrespondences_.mapVersion())
+		{
+			const Vector3 worldTranslation = world_T_previousCamera.translation() - secondPreviousCameraPose->world_T_camera().translation();
+
+			previousCamera_t_currentCamera = world_T_previousCamera.rotation().inverted() * worldTranslation * Scalar(frameInterval / previousFrameInterval_);
+		}
+	}
+
+	previousFrameInterval_ = frameInterval;
+
 	performanceStatistics_.start(performanceStatistics_.trackImagePoints_);
-		trackingCorrespondences_.trackImagePoints(currentFrameIndex, camera, world_T_previousCamera, previousPyramid, currentPyramid, trackingParameters_, previous_Q_current, minimalFrontPrecision_);
+		trackingCorrespondences_.trackImagePoints(currentFrameIndex, camera, world_T_previousCamera, previousPyramid, currentPyramid, trackingParameters_, previous_Q_current, minimalFrontPrecision_, previousCamera_t_currentCamera);
 	performanceStatistics_.stop(performanceStatistics_.trackImagePoints_);
 
 	if constexpr (loggingEnabled_)
@@ -827,6 +872,11 @@ void TrackerMono::postHandleFrame()
 		occupancyArray_.removePoints();
 	}
 
+	// the observations of the current frame will be gathered while the tracking results are processed and while new image points are detected
+
+	currentObservationPointIds_.clear();
+	currentObservationImagePoints_.clear();
+
 	// add new observations to the unlocalized or localized object points maps, update the occupancy array
 	processTrackingResults(currentFrameIndex, trackingCorrespondences_);
 
@@ -854,15 +904,18 @@ void TrackerMono::postHandleFrame()
 
 	detectNewImagePoints(*camera_, currentFrameIndex, *currentPyramid_, tryMatchCornersToLocalizedObjectPoints);
 
-	ReadLock readLock(mutex_, "TrackerMono::postHandleFrame(), update correspondences");
-		trackingCorrespondences_.update(currentFrameIndex, mapVersion_, localizedObjectPointMap_, pointTrackMap_, minimalFrontPrecision_);
-	readLock.unlock();
+	// the correspondences for the next frame are based on the latest map view, so that the map does not need to be locked while the background thread may modify the map
+
+	const SharedMapView mapView = mapViewPublisher_.latest();
+	ocean_assert(mapView);
+
+	trackingCorrespondences_.update(currentFrameIndex, *mapView, currentObservationPointIds_, currentObservationImagePoints_, minimalFrontPrecision_);
 
 	if constexpr (SLAMDebugElements::allowDebugging_)
 	{
 		if (SLAMDebugElements::get().isElementActive(SLAMDebugElements::EI_OBJECT_POINTS) || SLAMDebugElements::get().isElementActive(SLAMDebugElements::EI_IMAGE_POINTS))
 		{
-			readLock = ReadLock(mutex_, "TrackerMono::postHandleFrame(), debug elements");
+			const ReadLock readLock(mutex_, "TrackerMono::postHandleFrame(), debug elements");
 
 			if (currentCameraPose)
 			{
@@ -893,6 +946,10 @@ void TrackerMono::resetLocalizedObjectPoints()
 	bundleAdjustmentKeyFrameIndices_.clear();
 	bundleAdjustmentSqrBaseline_ = Numeric::minValue();
 	bundleAdjustmentObjectPointIdSet_.clear();
+
+	// the incremental Bundle Adjustment is owned by the Bundle Adjustment task, which will reset its window with the next execution
+
+	++mapResetCounter_;
 }
 
 void TrackerMono::threadRun()
@@ -949,15 +1006,26 @@ void TrackerMono::threadRun()
 
 					if (relocalize(*camera_, latestFrameIndex, *latestFramePyramid))
 					{
+						publishMapView();
+
 						// let's skip any additional post processing steps for this frame
 						continue;
 					}
 				}
 			}
 
-			// let's try to execute a Bundle Adjustment
+			// let's try to execute a Bundle Adjustment, the Bundle Adjustment runs in an own background task so that the following steps do not need to wait for the optimization
+
+			if (!bundleAdjustmentTask_.isExecuting())
+			{
+				// the previous execution has been processed already, so that wait() returns immediately
 
-			bundleAdjustment(*camera_, latestFrameIndex);
+				bundleAdjustmentTask_.wait();
+
+				bundleAdjustmentFrameIndex_ = latestFrameIndex;
+
+				bundleAdjustmentTask_.execute();
+			}
 
 			// let's try to create new localized 3D object points from unlocalized point tracks
 
@@ -967,6 +1035,10 @@ void TrackerMono::threadRun()
 
 			describeObjectPoints(*camera_, latestFrameIndex, *latestFramePyramid);
 		}
+
+		// finally, we publish a new view of the map which has been modified in this iteration
+
+		publishMapView();
 	}
 
 	Log::debug() << "TrackerMono background thread stopped";
@@ -1249,6 +1321,32 @@ void TrackerMono::updateInaccurateObjectPoints(const AnyCamera& camera, const In
 	}
 }
 
+void TrackerMono::publishMapView()
+{
+	const std::lock_guard<std::mutex> lock(publishMapViewMutex_);
+
+	SharedMapView mapView;
+
+	{
+		const ReadLock readLock(mutex_, "TrackerMono::publishMapView()");
+
+		mapView = std::make_shared<MapView>(mapVersion_, localizedObjectPointMap_);
+	}
+
+	mapViewPublisher_.publish(std::move(mapView));
+}
+
+void TrackerMono::executeBundleAdjustment()
+{
+	ocean_assert(camera_ && camera_->isValid());
+
+	bundleAdjustment(*camera_, bundleAdjustmentFrameIndex_);
+
+	// the optimized map is published immediately, so that the tracking can use the new map version with the next frame
+
+	publishMapView();
+}
+
 void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 currentFrameIndex)
 {
 	ocean_assert(camera.isValid());
@@ -1258,12 +1356,21 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 	ReadLock readLock(mutex_, "TrackerMono::bundleAdjustment()");
 
 		const Index32 necessaryMapVersion = mapVersion_;
+		const Index32 necessaryMapResetCounter = mapResetCounter_;
 
 		if (localizedObjectPointMap_.empty())
 		{
 			return;
 		}
 
+		if (incrementalBundleAdjustmentMapResetCounter_ != necessaryMapResetCounter)
+		{
+			// the map has been reset since the last Bundle Adjustment, so the window of the incremental Bundle Adjustment is outdated
+
+			incrementalBundleAdjustment_.reset();
+			incrementalBundleAdjustmentMapResetCounter_ = necessaryMapResetCounter;
+		}
+
 		const SharedCameraPose currentCameraPose = cameraPoses_.pose(currentFrameIndex);
 
 		if (!currentCameraPose)
@@ -1338,6 +1445,15 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 
 			const Vector3& position = localizedObjectPoint.position();
 
+			if (incrementalBundleAdjustment_.isObjectPointMarginalized(objectPointId))
+			{
+				// the information of this object point is already part of the prior of the incremental Bundle Adjustment,
+				// so the point will be optimized for fixed poses together with all other object points not used during Bundle Adjustment
+
+				bundleAdjustmentObjectPointIdSet.erase(objectPointId);
+				continue;
+			}
+
 			bool useForBundleAdjustment = true;
 
 			if (bundleAdjustmentObjectPointIdSet.contains(objectPointId))
@@ -1409,6 +1525,18 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 		return;
 	}
 
+	// the positions of all involved object points when the Bundle Adjustment starts, allowing to identify object points which are modified by other background steps in the meantime
+
+	ObjectPointPositionMap initialObjectPointMap;
+	initialObjectPointMap.reserve(objectPointIds.size());
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds.size(); ++nObjectPoint)
+	{
+		initialObjectPointMap.emplace(objectPointIds[nObjectPoint], objectPoints[nObjectPoint]);
+	}
+
+	objectPointOptimization.initialObjectPoints(initialObjectPointMap);
+
 	if constexpr (loggingEnabled_)
 	{
 		Log::info() << "    Background: Starting bundle adjustment result: Frame index " << currentFrameIndex;
@@ -1433,22 +1561,21 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 		gravityConstraints = Geometry::GravityConstraints(std::move(cameraGravities), configuration_.worldGravity_, Scalar(configuration_.gravityWeightFactor_), configuration_.gravityMaximalAngle_);
 	}
 
-	HomogenousMatrices4 optimizedFlippedCameras_T_world(flippedCameras_T_world.size());
-	Vectors3 optimizedObjectPoints(objectPoints.size());
-
-	NonconstArrayAccessor<HomogenousMatrix4> accessorOptimizedPoses(optimizedFlippedCameras_T_world);
-	NonconstArrayAccessor<Vector3> accessorOptimizedObjectPoints(optimizedObjectPoints);
+	HomogenousMatrices4 optimizedFlippedCameras_T_world;
+	Vectors3 optimizedObjectPoints;
 
 	Scalar initialError = Numeric::maxValue();
 	Scalar finalError = Numeric::maxValue();
 
-	constexpr bool applyAbsolutePoseAlignment = true;
-
 	constexpr Geometry::Estimator::EstimatorType estimatorType = Geometry::Estimator::ET_SQUARE;
 
-	if (!Geometry::NonLinearOptimizationObjectPoint::optimizeObjectPointsAndPosesIF(camera, ConstArrayAccessor<HomogenousMatrix4>(flippedCameras_T_world), ConstArrayAccessor<Vector3>(objectPoints), correspondenceGroups, &accessorOptimizedPoses, &accessorOptimizedObjectPoints, 20u, estimatorType, Scalar(0.001), Scalar(5), true /*onlyFrontObjectPoints*/, &initialError, &finalError, nullptr, gravityConstraints.isValid() ? &gravityConstraints : nullptr, applyAbsolutePoseAlignment))
+	// the incremental Bundle Adjustment keeps the linearization of the previous window, marginalizes key-frames leaving the window, and aligns the result with the given poses
+
+	if (!incrementalBundleAdjustment_.optimize(camera, keyFrameIndices, flippedCameras_T_world, objectPointIds, objectPoints, correspondenceGroups, optimizedFlippedCameras_T_world, optimizedObjectPoints, gravityConstraints.isValid() ? &gravityConstraints : nullptr, 20u, Scalar(0.001), Scalar(5), &initialError, &finalError))
 	{
 		Log::warning() << "Failed to run Bundle Adjustment";
+
+		incrementalBundleAdjustment_.reset();
 		return;
 	}
 
@@ -1477,6 +1604,7 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 		}
 
 		Log::info() << "    Background: Bundle adjustment result: Frame index " << currentFrameIndex << ", using " << flippedCameras_T_world.size() << " cameras and " << objectPoints.size() << " object points: " << initialError << " -> " << finalError << gravityConstraintsString;
+		Log::info() << "    Background: Bundle adjustment linearized " << incrementalBundleAdjustment_.linearizedObservations() << " observations, re-used " << incrementalBundleAdjustment_.reusedObservations() << (incrementalBundleAdjustment_.hasPrior() ? ", with prior" : ", without prior");
 
 		Indices32 sortedFrameIndices(keyFrameIndices);
 		std::sort(sortedFrameIndices.begin(), sortedFrameIndices.end());
@@ -1569,9 +1697,31 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 	ocean_assert(!sqrBaselines.empty());
 	const Scalar medianSqrBaseline = Median::percentile(sqrBaselines.data(), sqrBaselines.size(), 1.0);
 
+	// the camera poses are created before the map is locked, so that the write lock is held as short as possible
+
+	ocean_assert(keyFrameIndices.size() == optimizedFlippedCameras_T_world.size());
+	ocean_assert(keyFrameIndices.size() == world_T_optimizedCameras.size());
+
+	SharedCameraPoses optimizedCameraPoses;
+	optimizedCameraPoses.reserve(keyFrameIndices.size());
+
+	for (size_t nKeyFrame = 0; nKeyFrame < keyFrameIndices.size(); ++nKeyFrame)
+	{
+		optimizedCameraPoses.emplace_back(std::make_shared<CameraPose>(world_T_optimizedCameras[nKeyFrame], optimizedFlippedCameras_T_world[nKeyFrame], CameraPose::PQ_HIGH));
+	}
+
 	{
 		const WriteLock writeLock(mutex_, "TrackerMono::bundleAdjustment()");
 
+		if (mapResetCounter_ != necessaryMapResetCounter || mapVersion_ != necessaryMapVersion)
+		{
+			// the map has been reset or re-initialized while the Bundle Adjustment was running, so the result is outdated
+			// (this check must happen before checking for a pending initialization, otherwise a freshly initialized map could be removed)
+
+			incrementalBundleAdjustment_.reset();
+			return;
+		}
+
 		if (taskDetermineInitialObjectPoints_)
 		{
 			resetLocalizedObjectPoints();
@@ -1582,55 +1732,35 @@ void TrackerMono::bundleAdjustment(const AnyCamera& camera, const Index32 curren
 
 		++mapVersion_;
 
-		ocean_assert(keyFrameIndices.size() == optimizedFlippedCameras_T_world.size());
-		ocean_assert(keyFrameIndices.size() == world_T_optimizedCameras.size());
-
 		for (size_t nKeyFrame = 0; nKeyFrame < keyFrameIndices.size(); ++nKeyFrame)
 		{
 			const Index32& frameIndex = keyFrameIndices[nKeyFrame];
 
-			const HomogenousMatrix4& optimizedFlippedCamera_T_world = optimizedFlippedCameras_T_world[nKeyFrame];
-			const HomogenousMatrix4& world_T_optimizedCamera = world_T_optimizedCameras[nKeyFrame];
-
 			ocean_assert(cameraPoses_.hasPose(frameIndex));
 
-			cameraPoses_.setPose(frameIndex, std::make_shared<CameraPose>(world_T_optimizedCamera, optimizedFlippedCamera_T_world, CameraPose::PQ_HIGH), mapVersion_);
+			cameraPoses_.setPose(frameIndex, std::move(optimizedCameraPoses[nKeyFrame]), mapVersion_);
 		}
 
-		ocean_assert(objectPointIds.size() == optimizedObjectPoints.size());
-		for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds.size(); ++nObjectPoint)
-		{
-			const Index32& objectPointId = objectPointIds[nObjectPoint];
-			const Vector3& optimizedObjectPoint = optimizedObjectPoints[nObjectPoint];
+		// object points which have been modified by other background steps in the meantime keep their newer state
 
-			const LocalizedObjectPointMap::iterator iObjectPoint = localizedObjectPointMap_.find(objectPointId);
+		const size_t modifiedObjectPoints = integrateBundleAdjustedObjectPoints(camera, cameraPoses_, objectPointIds, optimizedObjectPoints, initialObjectPointMap, inaccurateObjectPointIds, localizedObjectPointMap_, newBundleAdjustmentObjectPointIdSet);
 
-			if (iObjectPoint != localizedObjectPointMap_.cend())
-			{
-				LocalizedObjectPoint& localizedObjectPoint = iObjectPoint->second;
-
-				localizedObjectPoint.setPosition(optimizedObjectPoint, true /*isBundleAdjusted*/);
-
-				localizedObjectPoint.updateLocalizedObjectPointUncertainty(camera, cameraPoses_);
-			}
-		}
-
-		// now let's remove all object points which have been determined as inaccurate during Bundle Adjustment
-
-		if (!inaccurateObjectPointIds.empty())
+		if constexpr (loggingEnabled_)
 		{
-			for (const Index32 inaccurateObjectPointId : inaccurateObjectPointIds)
+			if (!inaccurateObjectPointIds.empty())
 			{
-				Log::debug() << "    Background: Bundle adjustment removed inaccurate object point " << inaccurateObjectPointId;
-
-				localizedObjectPointMap_.erase(inaccurateObjectPointId);
+				Log::info() << "    Background: Bundle adjustment removed up to " << inaccurateObjectPointIds.size() << " inaccurate 3D object points";
 			}
 
-			if constexpr (loggingEnabled_)
+			if (modifiedObjectPoints != 0)
 			{
-				Log::info() << "    Background: Bundle adjustment removed " << inaccurateObjectPointIds.size() << " inaccurate 3D object points";
+				Log::info() << "    Background: Bundle adjustment skipped " << modifiedObjectPoints << " 3D object points modified while the optimization was running";
 			}
 		}
+		else
+		{
+			OCEAN_SUPPRESS_UNUSED_WARNING(modifiedObjectPoints);
+		}
 
 		bundleAdjustmentObjectPointIdSet_ = std::move(newBundleAdjustmentObjectPointIdSet);
 
@@ -2331,6 +2461,9 @@ void TrackerMono::processTrackingResults(const Index32 currentFrameIndex, const
 					ocean_assert_and_suppress_unused(pointTrack.lastImagePoint().sqrDistance(previousImagePoint) <= Numeric::sqr(5), previousImagePoint); // due to re-localization a previous point may be slightly off
 
 					pointTrack.addObservation(currentFrameIndex, currentImagePoint);
+
+					currentObservationPointIds_.push_back(objectPointId);
+					currentObservationImagePoints_.push_back(currentImagePoint);
 				}
 				else
 				{
@@ -2358,6 +2491,9 @@ void TrackerMono::processTrackingResults(const Index32 currentFrameIndex, const
 #endif // OCEAN_DEBUG
 
 					localizedObjectPoint.addObservation(currentFrameIndex, currentImagePoint);
+
+					currentObservationPointIds_.push_back(objectPointId);
+					currentObservationImagePoints_.push_back(currentImagePoint);
 				}
 				else
 				{
@@ -2439,6 +2575,9 @@ bool TrackerMono::detectNewImagePoints(const AnyCamera& camera, const Index32 cu
 
 				pointTrackMap_.emplace(newUnlocalizedObjectPointId, PointTrack(currentFrameIndex, corner.observation()));
 
+				currentObservationPointIds_.push_back(newUnlocalizedObjectPointId);
+				currentObservationImagePoints_.push_back(corner.observation());
+
 				++newImagePointsCounter;
 			}
 		}
@@ -2500,53 +2639,55 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 
 	const Scalar maximalProjectionError = configuration_.maximalProjectionError_;
 
-	ReadLock readLock(mutex_, "TrackerMono::matchCornersToLocalizedObjectPoints(), pre description");
+	// the candidates are determined based on the latest map view, so that the map does not need to be locked
 
-		for (LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap_)
+	const SharedMapView mapView = mapViewPublisher_.latest();
+	ocean_assert(mapView);
+
+	const UnorderedIndexSet32 currentObservationPointIdSet(currentObservationPointIds_.cbegin(), currentObservationPointIds_.cend());
+
+	for (const MapView::ObjectPointMap::value_type& objectPointPair : mapView->objectPointMap())
+	{
+		const Index32& objectPointId = objectPointPair.first;
+		const MapView::ObjectPoint& objectPoint = objectPointPair.second;
+
+		if (objectPoint.localizationPrecision_ < LocalizedObjectPoint::LP_LOW)
 		{
-			const Index32& objectPointId = objectPointPair.first;
-			LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+			// not even a low precision, no reason to try matching the object point
+			continue;
+		}
 
-			if (localizedObjectPoint.localizationPrecision() < LocalizedObjectPoint::LP_LOW)
-			{
-				// not even a low precision, no reason to try matching the object point
-				continue;
-			}
+		if (currentObservationPointIdSet.contains(objectPointId) || objectPoint.lastObservationFrameIndex_ == currentFrameIndex)
+		{
+			// the localized object point is already/still visible
+			continue;
+		}
 
-			ocean_assert(localizedObjectPoint.lastObservationFrameIndex() <= currentFrameIndex);
-			if (localizedObjectPoint.lastObservationFrameIndex() == currentFrameIndex)
-			{
-				// the localized object point is already/still visible
-				continue;
-			}
+		if (objectPoint.descriptors_.empty())
+		{
+			// the localized object point has not been described yet
+			continue;
+		}
 
-			if (localizedObjectPoint.descriptors().empty())
-			{
-				// the localized object point has not been described yet
-				continue;
-			}
+		ocean_assert(objectPoint.position_ != Vector3::minValue());
 
-			ocean_assert(localizedObjectPoint.position() != Vector3::minValue());
+		if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, objectPoint.position_))
+		{
+			const Vector2 projectedObjectPoint = camera.projectToImageIF(flippedCamera_T_world, objectPoint.position_);
 
-			if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, localizedObjectPoint.position()))
+			for (size_t cornerIndex = 0; cornerIndex < corners.size(); ++cornerIndex)
 			{
-				const Vector2 projectedObjectPoint = camera.projectToImageIF(flippedCamera_T_world, localizedObjectPoint.position());
+				const CV::Detector::HarrisCorner& corner = corners[cornerIndex];
 
-				for (size_t cornerIndex = 0; cornerIndex < corners.size(); ++cornerIndex)
+				if (projectedObjectPoint.sqrDistance(corner.observation()) < Numeric::sqr(maximalProjectionError))
 				{
-					const CV::Detector::HarrisCorner& corner = corners[cornerIndex];
+					// TODO add check whether 3D point can actually be visible (normal of point)
 
-					if (projectedObjectPoint.sqrDistance(corner.observation()) < Numeric::sqr(maximalProjectionError))
-					{
-						// TODO add check whether 3D point can actually be visible (normal of point)
-
-						cornerIndexToObjectPointsMap[Index32(cornerIndex)].push_back(objectPointId);
-					}
+					cornerIndexToObjectPointsMap[Index32(cornerIndex)].push_back(objectPointId);
 				}
 			}
 		}
-
-	readLock.unlock();
+	}
 
 	if (cornerIndexToObjectPointsMap.empty())
 	{
@@ -2572,63 +2713,55 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 	CV::Detector::FREAKDescriptors32 freakDescriptors(imagePoints.size());
 	CV::Detector::FREAKDescriptor32::computeDescriptors(camera.clone(), yFramePyramid, imagePoints.data(), imagePoints.size(), 0u /*pyramidLevel*/, freakDescriptors.data());
 
-	readLock = ReadLock(mutex_, "TrackerMono::matchCornersToLocalizedObjectPoints() post description");
+	// now, let's try to find valid matches between the existing object points and the described points
 
-		// now, let's try to find valid matches between the existing object points and the described points
+	size_t nIndex = 0;
+	for (const CornerIndexToObjectPointIdsMap::value_type& pair : cornerIndexToObjectPointsMap)
+	{
+		const CV::Detector::FREAKDescriptor32& freakDescriptor = freakDescriptors[nIndex];
+		++nIndex;
 
-		size_t nIndex = 0;
-		for (const CornerIndexToObjectPointIdsMap::value_type& pair : cornerIndexToObjectPointsMap)
+		if (!freakDescriptor.isValid())
 		{
-			const CV::Detector::FREAKDescriptor32& freakDescriptor = freakDescriptors[nIndex];
-			++nIndex;
+			continue;
+		}
 
-			if (!freakDescriptor.isValid())
-			{
-				continue;
-			}
+		const Index32& cornerIndex = pair.first;
+		const Indices32& localizedObjectPointIds = pair.second;
+		ocean_assert(!localizedObjectPointIds.empty());
 
-			const Index32& cornerIndex = pair.first;
-			const Indices32& localizedObjectPointIds = pair.second;
-			ocean_assert(!localizedObjectPointIds.empty());
+		unsigned int bestDistance = (unsigned int)(-1);
+		Index32 bestLocalizedObjectPointId = Index32(-1);
 
-			unsigned int bestDistance = (unsigned int)(-1);
-			Index32 bestLocalizedObjectPointId = Index32(-1);
+		for (const Index32& localizedObjectPointId : localizedObjectPointIds)
+		{
+			const MapView::ObjectPoint* objectPoint = mapView->objectPoint(localizedObjectPointId);
+
+			ocean_assert(objectPoint != nullptr);
+			ocean_assert(objectPoint->descriptors_.size() >= 1);
 
-			for (const Index32& localizedObjectPointId : localizedObjectPointIds)
+			for (const CV::Detector::FREAKDescriptor32& objectPointDescriptor : objectPoint->descriptors_)
 			{
-				LocalizedObjectPointMap::iterator iObjectPoint = localizedObjectPointMap_.find(localizedObjectPointId);
+				const unsigned int distance = freakDescriptor.distance(objectPointDescriptor);
 
-				ocean_assert(iObjectPoint != localizedObjectPointMap_.cend());
-				if (iObjectPoint != localizedObjectPointMap_.cend())
+				if (distance < bestDistance)
 				{
-					const LocalizedObjectPoint& localizedObjectPoint = iObjectPoint->second;
-					ocean_assert(localizedObjectPoint.descriptors().size() >= 1);
-
-					for (const CV::Detector::FREAKDescriptor32& objectPointDescriptor : localizedObjectPoint.descriptors())
-					{
-						const unsigned int distance = freakDescriptor.distance(objectPointDescriptor);
-
-						if (distance < bestDistance)
-						{
-							bestDistance = distance;
-							bestLocalizedObjectPointId = localizedObjectPointId;
-						}
-					}
+					bestDistance = distance;
+					bestLocalizedObjectPointId = localizedObjectPointId;
 				}
 			}
+		}
 
-			if (bestDistance < descriptorThreshold())
-			{
-				ocean_assert(bestLocalizedObjectPointId != Index32(-1));
+		if (bestDistance < descriptorThreshold())
+		{
+			ocean_assert(bestLocalizedObjectPointId != Index32(-1));
 
-				if (!matchedObjectPointIdToCornerIndexMap.emplace(bestLocalizedObjectPointId, cornerIndex).second)
-				{
-					Log::debug() << "Object point " << bestLocalizedObjectPointId << " already matched to new image point";
-				}
+			if (!matchedObjectPointIdToCornerIndexMap.emplace(bestLocalizedObjectPointId, cornerIndex).second)
+			{
+				Log::debug() << "Object point " << bestLocalizedObjectPointId << " already matched to new image point";
 			}
 		}
-
-	readLock.unlock();
+	}
 
 	ocean_assert(nIndex == cornerIndexToObjectPointsMap.size());
 
@@ -2645,11 +2778,19 @@ void TrackerMono::matchCornersToLocalizedObjectPoints(const AnyCamera& camera, c
 			{
 				LocalizedObjectPoint& localizedObjectPoint = iObjectPoint->second;
 
+				if (localizedObjectPoint.lastObservationFrameIndex() == currentFrameIndex)
+				{
+					// the object point has been observed in the meantime, e.g., during re-localization in the background thread
+					continue;
+				}
+
 				const Vector2& imagePoint = corners[cornerIndex].observation();
 
-				ocean_assert(localizedObjectPoint.lastObservationFrameIndex() != currentFrameIndex);
 				localizedObjectPoint.addObservation(currentFrameIndex, imagePoint);
 
+				currentObservationPointIds_.push_back(objectPointId);
+				currentObservationImagePoints_.push_back(imagePoint);
+
 				matchedCornerIndices.push_back(cornerIndex);
 			}
 		}
@@ -2896,6 +3037,9 @@ void TrackerMono::matchLocalizedObjectPointsToCorners(const AnyCamera& camera, c
 			ocean_assert(localizedObjectPoint.lastObservationFrameIndex() != currentFrameIndex);
 			localizedObjectPoint.addObservation(currentFrameIndex, imagePoint);
 
+			currentObservationPointIds_.push_back(objectPointId);
+			currentObservationImagePoints_.push_back(imagePoint);
+
 			++debugCounter;
 
 			occupancyArray_.addPoint(imagePoint);
@@ -2907,6 +3051,74 @@ void TrackerMono::matchLocalizedObjectPointsToCorners(const AnyCamera& camera, c
 	writeLock.unlock();
 }
 
+size_t TrackerMono::integrateBundleAdjustedObjectPoints(const AnyCamera& camera, const CameraPoses& cameraPoses, const Indices32& objectPointIds, const Vectors3& optimizedObjectPoints, const ObjectPointPositionMap& initialObjectPoints, const Indices32& inaccurateObjectPointIds, LocalizedObjectPointMap& localizedObjectPointMap, UnorderedIndexSet32& bundleAdjustmentObjectPointIdSet)
+{
+	ocean_assert(camera.isValid());
+	ocean_assert(objectPointIds.size() == optimizedObjectPoints.size());
+
+	size_t modifiedObjectPoints = 0;
+
+	for (size_t nObjectPoint = 0; nObjectPoint < objectPointIds.size(); ++nObjectPoint)
+	{
+		const Index32& objectPointId = objectPointIds[nObjectPoint];
+
+		const LocalizedObjectPointMap::iterator iObjectPoint = localizedObjectPointMap.find(objectPointId);
+
+		if (iObjectPoint == localizedObjectPointMap.end())
+		{
+			// the object point has been removed in the meantime
+
+			bundleAdjustmentObjectPointIdSet.erase(objectPointId);
+			continue;
+		}
+
+		LocalizedObjectPoint& localizedObjectPoint = iObjectPoint->second;
+
+		const ObjectPointPositionMap::const_iterator iInitialObjectPoint = initialObjectPoints.find(objectPointId);
+		ocean_assert(iInitialObjectPoint != initialObjectPoints.cend());
+
+		if (iInitialObjectPoint == initialObjectPoints.cend() || localizedObjectPoint.position() != iInitialObjectPoint->second)
+		{
+			// the object point has been updated or re-localized in the meantime, so the optimized position is outdated
+
+			bundleAdjustmentObjectPointIdSet.erase(objectPointId);
+			++modifiedObjectPoints;
+			continue;
+		}
+
+		localizedObjectPoint.setPosition(optimizedObjectPoints[nObjectPoint], true /*isBundleAdjusted*/);
+
+		localizedObjectPoint.updateLocalizedObjectPointUncertainty(camera, cameraPoses);
+	}
+
+	for (const Index32 inaccurateObjectPointId : inaccurateObjectPointIds)
+	{
+		const LocalizedObjectPointMap::const_iterator iObjectPoint = localizedObjectPointMap.find(inaccurateObjectPointId);
+
+		if (iObjectPoint == localizedObjectPointMap.cend())
+		{
+			continue;
+		}
+
+		const ObjectPointPositionMap::const_iterator iInitialObjectPoint = initialObjectPoints.find(inaccurateObjectPointId);
+		ocean_assert(iInitialObjectPoint != initialObjectPoints.cend());
+
+		if (iInitialObjectPoint == initialObjectPoints.cend() || iObjectPoint->second.position() != iInitialObjectPoint->second)
+		{
+			// the object point has been updated in the meantime, so it may not be inaccurate anymore
+
+			++modifiedObjectPoints;
+			continue;
+		}
+
+		Log::debug() << "    Background: Bundle adjustment removed inaccurate object point " << inaccurateObjectPointId;
+
+		localizedObjectPointMap.erase(iObjectPoint);
+	}
+
+	return modifiedObjectPoints;
+}
+
 bool TrackerMono::isBundleAdjustmentNeeded(const AnyCamera& camera, const CameraPose& currentCameraPose, const Index32 currentFrameIndex, const Scalar maximalProjectionError, const unsigned int necessaryMapVersion) const
 {
 #ifdef OCEAN_DEBUG
@@ -15,7 +15,10 @@
 #include "ocean/tracking/slam/CameraPoses.h"
 #include "ocean/tracking/slam/FramePyramidManager.h"
 #include "ocean/tracking/slam/Gravities.h"
+#include "ocean/tracking/slam/IMUPreintegrator.h"
+#include "ocean/tracking/slam/IncrementalBundleAdjustment.h"
 #include "ocean/tracking/slam/LocalizedObjectPoint.h"
+#include "ocean/tracking/slam/MapView.h"
 #include "ocean/tracking/slam/Mutex.h"
 #include "ocean/tracking/slam/OccupancyArray.h"
 #include "ocean/tracking/slam/PointTrack.h"
@@ -99,6 +102,9 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// Definition of a vector holding frame statistics.
 		using FramesStatistics = std::vector<FrameStatistics>;
 
+		/// Definition of an unordered map mapping object point ids to object point positions.
+		using ObjectPointPositionMap = std::unordered_map<Index32, Vector3>;
+
 	protected:
 
 		/**
@@ -148,6 +154,12 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 				 */
 				void collectObjectPoints(const LocalizedObjectPointMap& localizedObjectPointMap, const UnorderedIndexSet32& previousBundleAdjustmentObjectPointIdSet);
 
+				/**
+				 * Adds the positions the collected object points had when they were collected.
+				 * @param objectPointPositionMap The map to which the positions will be added
+				 */
+				void initialObjectPoints(ObjectPointPositionMap& objectPointPositionMap) const;
+
 				/**
 				 * Optimizes the collected object points using non-linear optimization with fixed camera poses.
 				 * Object points visible in at least two keyframes are optimized. Successfully optimized points (with projection error below threshold) are added to the output vectors; others are marked as inaccurate.
@@ -414,9 +426,10 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 * @param yFrame The current grayscale frame (FORMAT_Y8), will be moved, must be valid with matching dimensions
 		 * @param world_T_camera The resulting camera pose transforming camera to world coordinates, invalid if pose could not be determined
 		 * @param cameraGravity Optional gravity vector in camera coordinates (unit vector), can be null if unavailable
-		 * @param anyWorld_Q_camera Optional orientation from an external source (e.g., IMU), can be invalid if unavailable
+		 * @param anyWorld_Q_camera Optional orientation from an external source (e.g., IMU), can be invalid if unavailable; if invalid, the tracker uses the preintegrated gyro samples of imuPreintegrator() instead
 		 * @param debugData Optional pointer to receive debug data for visualization/analysis, nullptr to skip
 		 * @return True if the frame was processed successfully; false on error
+		 * @see imuPreintegrator().
 		 */
 		bool handleFrame(const AnyCamera& camera, Frame&& yFrame, HomogenousMatrix4& world_T_camera, const Vector3& cameraGravity = Vector3(0, 0, 0), const Quaternion& anyWorld_Q_camera = Quaternion(false), DebugData* debugData = nullptr);
 
@@ -426,6 +439,14 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 */
 		inline Index32 frameIndex() const;
 
+		/**
+		 * Returns the preintegrator for inertial measurements which are used to predict the camera motion between two frames.
+		 * Gyro and accelerometer samples can be added from any thread, the samples must be defined in the coordinate system of the camera and must use the time domain of the frames.
+		 * Samples before the latest frame are removed with every handled frame, also if an external orientation is provided.
+		 * @return The tracker's IMU preintegrator
+		 */
+		inline IMUPreintegrator& imuPreintegrator();
+
 		/**
 		 * Returns a string with performance statistics for the tracker.
 		 * Call only after the tracker has finished.
@@ -440,6 +461,21 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 */
 		FramesStatistics framesStatistics() const;
 
+		/**
+		 * Integrates the 3D object points optimized during a Bundle Adjustment into the map of localized object points.
+		 * The Bundle Adjustment runs concurrently to the remaining background steps, therefore object points which have been modified, removed, or re-localized while the Bundle Adjustment was running keep their current state.
+		 * @param camera The camera profile which has been used during the Bundle Adjustment, must be valid
+		 * @param cameraPoses The camera poses already holding the poses optimized during the Bundle Adjustment
+		 * @param objectPointIds The ids of all optimized object points
+		 * @param optimizedObjectPoints The optimized object points, one for each object point id
+		 * @param initialObjectPoints The positions the object points had when the Bundle Adjustment started, must contain all optimized and all inaccurate object points
+		 * @param inaccurateObjectPointIds The ids of the object points which have been determined as inaccurate during the Bundle Adjustment and which will be removed
+		 * @param localizedObjectPointMap The map of localized object points to be updated
+		 * @param bundleAdjustmentObjectPointIdSet The ids of the object points known to be precise after the Bundle Adjustment, object points modified in the meantime will be removed from this set
+		 * @return The number of optimized or inaccurate object points which have been modified in the meantime and thus kept their current state
+		 */
+		static size_t integrateBundleAdjustedObjectPoints(const AnyCamera& camera, const CameraPoses& cameraPoses, const Indices32& objectPointIds, const Vectors3& optimizedObjectPoints, const ObjectPointPositionMap& initialObjectPoints, const Indices32& inaccurateObjectPointIds, LocalizedObjectPointMap& localizedObjectPointMap, UnorderedIndexSet32& bundleAdjustmentObjectPointIdSet);
+
 	protected:
 
 		/**
@@ -458,9 +494,10 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		 * @param currentFrameIndex The index of the current frame, with range [1, infinity)
 		 * @param randomGenerator A random generator for the RANSAC-based pose estimation
 		 * @param previousCamera_Q_currentCamera The rotation from the current camera frame to the previous camera frame (e.g., from IMU), can be invalid if not available
+		 * @param predictTranslation True, to predict the translation between previous and current camera with a constant velocity model; False, to predict the rotation only
 		 * @return The shared camera pose if pose estimation succeeded, nullptr otherwise
 		 */
-		SharedCameraPose trackImagePointsAndDeterminePose(const AnyCamera& camera, const Index32 currentFrameIndex, RandomGenerator& randomGenerator, const Quaternion& previousCamera_Q_currentCamera);
+		SharedCameraPose trackImagePointsAndDeterminePose(const AnyCamera& camera, const Index32 currentFrameIndex, RandomGenerator& randomGenerator, const Quaternion& previousCamera_Q_currentCamera, const bool predictTranslation);
 
 		/**
 		 * Resets all localized 3D object points and related state during re-initialization.
@@ -561,7 +598,24 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/**
 		 * Background function:
 		 *
+		 * Creates a new view of the current map and publishes the view so that the tracking can access the map without any lock.
+		 * The function is called by the background thread and by the Bundle Adjustment task.
+		 */
+		void publishMapView();
+
+		/**
+		 * Bundle Adjustment task function:
+		 *
+		 * Executes the Bundle Adjustment for the frame index which has been set before the task was executed.
+		 * @see bundleAdjustment().
+		 */
+		void executeBundleAdjustment();
+
+		/**
+		 * Bundle Adjustment task function:
+		 *
 		 * Performs bundle adjustment optimization on camera poses and 3D object points.
+		 * The optimization is incremental, the linearization of the previous execution is re-used and key-frames leaving the window are marginalized.
 		 * @param camera The camera model used for projection, must be valid
 		 * @param currentFrameIndex The index of the current frame
 		 */
@@ -717,6 +771,12 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The orientation of the previous camera in an external/arbitrary world coordinate system (e.g., from IMU), used to compute frame-to-frame rotation.
 		Quaternion anyWorld_Q_previousCamera_ = Quaternion(false);
 
+		/// The preintegrator of gyro and accelerometer samples, used if no external orientation is provided.
+		IMUPreintegrator imuPreintegrator_;
+
+		/// The time between the previous frame and the frame before the previous frame, in seconds, -1 if unknown.
+		double previousFrameInterval_ = -1.0;
+
 		/// Frame-to-frame tracking correspondences.
 		TrackingCorrespondences trackingCorrespondences_;
 
@@ -747,6 +807,15 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The ids of object points which have been used during the previous Bundle Adjustment.
 		UnorderedIndexSet32 bundleAdjustmentObjectPointIdSet_;
 
+		/// The incremental Bundle Adjustment keeping the linearized system between individual executions, used by the Bundle Adjustment task only.
+		IncrementalBundleAdjustment incrementalBundleAdjustment_;
+
+		/// The map reset counter for which the incremental Bundle Adjustment has been used the last time, used by the Bundle Adjustment task only.
+		Index32 incrementalBundleAdjustmentMapResetCounter_ = 0u;
+
+		/// The index of the frame for which the Bundle Adjustment task will be executed.
+		Index32 bundleAdjustmentFrameIndex_ = Index32(-1);
+
 		/// The performance statistics for this tracker.
 		PerformanceStatistics performanceStatistics_;
 
@@ -756,6 +825,9 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The background task which will execute the post processing for the handleFrame() function.
 		BackgroundTask postHandleFrameTask_;
 
+		/// The background task which will execute the Bundle Adjustment asynchronously to the remaining background steps.
+		BackgroundTask bundleAdjustmentTask_;
+
 		/// The rate calculator for measuring the frame processing rate.
 		RateCalculator handleFrameRateCalculator_;
 
@@ -774,6 +846,21 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackerMono :
 		/// The version counter for the map, incremented after each Bundle Adjustment to track pose and object point consistency.
 		Index32 mapVersion_ = 0u;
 
+		/// The counter for resets of the map, incremented whenever all localized object points are removed.
+		Index32 mapResetCounter_ = 0u;
+
+		/// The publisher of the latest map view, allowing the tracking to read the map without any lock.
+		MapViewPublisher mapViewPublisher_;
+
+		/// The lock serializing the creation and publishing of map views, ensuring that a newer view is never replaced by an older view.
+		std::mutex publishMapViewMutex_;
+
+		/// The ids of all points observed in the current frame, gathered in the post processing for the handleFrame() function.
+		Indices32 currentObservationPointIds_;
+
+		/// The image points of all points observed in the current frame, one for each id in currentObservationPointIds_.
+		Vectors2 currentObservationImagePoints_;
+
 		/// The minimal localization precision for projecting object points; points below this threshold use the previous 2D position instead.
 		static constexpr LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision_ = LocalizedObjectPoint::LP_LOW;
 
@@ -849,6 +936,11 @@ inline Index32 TrackerMono::frameIndex() const
 	return cameraPoses_.frameIndex();
 }
 
+inline IMUPreintegrator& TrackerMono::imuPreintegrator()
+{
+	return imuPreintegrator_;
+}
+
 inline Index32 TrackerMono::uniqueObjectPointId()
 {
 	// now thread-safty necessary as the function is only called from one place
@@ -0,0 +1,944 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ocean/tracking/slam/TrackerRig.h"
+
+#include "ocean/base/String.h"
+
+#include "ocean/cv/advanced/AdvancedMotion.h"
+
+#include "ocean/cv/detector/HarrisCornerDetector.h"
+
+#include "ocean/geometry/Estimator.h"
+#include "ocean/geometry/SpatialDistribution.h"
+#include "ocean/geometry/Utilities.h"
+
+#include "ocean/math/Camera.h"
+#include "ocean/math/ExponentialMap.h"
+#include "ocean/math/StaticMatrix.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+TrackerRig::CameraState::CameraState(SharedAnyCamera camera, const HomogenousMatrix4& device_T_camera, const Tracker::Configuration& configuration) :
+	camera_(std::move(camera)),
+	device_T_camera_(device_T_camera),
+	flippedCamera_T_device_(Camera::standard2InvertedFlipped(device_T_camera)),
+	trackingParameters_(camera_->width(), camera_->height(), configuration),
+	harrisThreshold_(configuration.harrisThresholdMean())
+{
+	ocean_assert(camera_ && camera_->isValid());
+	ocean_assert(device_T_camera_.isValid());
+
+	unsigned int horizontalBins = 0u;
+	unsigned int verticalBins = 0u;
+	Geometry::SpatialDistribution::idealBins(camera_->width(), camera_->height(), configuration.numberBins_, horizontalBins, verticalBins);
+
+	ocean_assert(horizontalBins >= 1u && verticalBins >= 1u);
+
+	constexpr unsigned int neighborhoodSize = 3u;
+	constexpr float minCoverageThreshold = 0.8f;
+
+	occupancyArray_ = OccupancyArray(Scalar(0), Scalar(0), camera_->width(), camera_->height(), horizontalBins * neighborhoodSize, verticalBins * neighborhoodSize, neighborhoodSize, minCoverageThreshold);
+}
+
+void TrackerRig::CameraState::clearTracks()
+{
+	objectPointIds_.clear();
+	imagePoints_.clear();
+
+	newImagePoints_.clear();
+	newDeviceDirections_.clear();
+	newDescriptors_.clear();
+}
+
+bool TrackerRig::configure(const Configuration& configuration)
+{
+	if (!configuration.isValid())
+	{
+		return false;
+	}
+
+	if (!cameraStates_.empty())
+	{
+		return false;
+	}
+
+	configuration_ = configuration;
+
+	return true;
+}
+
+bool TrackerRig::handleFrames(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, Frames&& yFrames, HomogenousMatrix4& world_T_device, const Quaternion& anyWorld_Q_device, Worker* worker)
+{
+	ocean_assert(configuration_.isValid());
+	if (!configuration_.isValid())
+	{
+		return false;
+	}
+
+	ocean_assert(cameras.size() >= 2);
+	ocean_assert(cameras.size() == device_T_cameras.size() && cameras.size() == yFrames.size());
+
+	if (cameras.size() < 2 || cameras.size() != device_T_cameras.size() || cameras.size() != yFrames.size())
+	{
+		return false;
+	}
+
+	if (cameraStates_.empty())
+	{
+		// we make a clone of the very first rig, afterwards we assume that the rig never changes
+
+		for (size_t cameraIndex = 0; cameraIndex < cameras.size(); ++cameraIndex)
+		{
+			ocean_assert(cameras[cameraIndex] && cameras[cameraIndex]->isValid());
+			ocean_assert(device_T_cameras[cameraIndex].isValid());
+
+			if (!cameras[cameraIndex] || !cameras[cameraIndex]->isValid() || !device_T_cameras[cameraIndex].isValid())
+			{
+				cameraStates_.clear();
+				return false;
+			}
+		}
+
+		cameraStates_.reserve(cameras.size());
+
+		for (size_t cameraIndex = 0; cameraIndex < cameras.size(); ++cameraIndex)
+		{
+			cameraStates_.emplace_back(cameras[cameraIndex]->clone(), device_T_cameras[cameraIndex], configuration_);
+		}
+
+		trackerState_ = TS_INITIALIZING;
+	}
+
+	ocean_assert(cameraStates_.size() == cameras.size());
+	if (cameraStates_.size() != cameras.size())
+	{
+		return false;
+	}
+
+	for (size_t cameraIndex = 0; cameraIndex < cameras.size(); ++cameraIndex)
+	{
+		const AnyCamera& camera = *cameraStates_[cameraIndex].camera_;
+		Frame& yFrame = yFrames[cameraIndex];
+
+		ocean_assert(cameras[cameraIndex] && camera.isEqual(*cameras[cameraIndex]));
+
+		ocean_assert(yFrame.width() == camera.width() && yFrame.height() == camera.height());
+		if (yFrame.width() != camera.width() || yFrame.height() != camera.height())
+		{
+			return false;
+		}
+
+		ocean_assert(yFrame.isPixelFormatDataLayoutCompatible(FrameType::FORMAT_Y8));
+		if (!yFrame.isPixelFormatDataLayoutCompatible(FrameType::FORMAT_Y8))
+		{
+			return false;
+		}
+
+		yFrame.makeOwner();
+	}
+
+	world_T_device.toNull();
+
+	// first, we predict the pose of the device based on the previous pose and the IMU (if available)
+
+	Quaternion previousDevice_Q_currentDevice(false);
+
+	if (anyWorld_Q_previousDevice_.isValid() && anyWorld_Q_device.isValid())
+	{
+		previousDevice_Q_currentDevice = anyWorld_Q_previousDevice_.inverted() * anyWorld_Q_device;
+	}
+
+	HomogenousMatrix4 world_T_predictedDevice(false);
+
+	if (world_T_previousDevice_.isValid())
+	{
+		if (previousDevice_Q_currentDevice.isValid())
+		{
+			world_T_predictedDevice = world_T_previousDevice_ * HomogenousMatrix4(previousDevice_Q_currentDevice);
+		}
+		else
+		{
+			world_T_predictedDevice = world_T_previousDevice_;
+		}
+	}
+
+	// now, we create the pyramids and track the points of all cameras in parallel, one camera per thread
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &TrackerRig::trackCamerasSubset, (const HomogenousMatrix4*)(&world_T_predictedDevice), (const Quaternion*)(&previousDevice_Q_currentDevice), yFrames.data(), 0u, 0u), 0u, (unsigned int)(cameraStates_.size()));
+	}
+	else
+	{
+		trackCamerasSubset(&world_T_predictedDevice, &previousDevice_Q_currentDevice, yFrames.data(), 0u, (unsigned int)(cameraStates_.size()));
+	}
+
+	// the correspondences of all cameras are fused into one pose of the device
+
+	if (world_T_predictedDevice.isValid())
+	{
+		SharedAnyCameras rigCameras;
+		HomogenousMatrices4 rigDevice_T_cameras;
+
+		rigCameras.reserve(cameraStates_.size());
+		rigDevice_T_cameras.reserve(cameraStates_.size());
+
+		Indices32 cameraIndices;
+		Vectors3 objectPoints;
+		Vectors2 imagePoints;
+
+		for (size_t cameraIndex = 0; cameraIndex < cameraStates_.size(); ++cameraIndex)
+		{
+			const CameraState& cameraState = cameraStates_[cameraIndex];
+
+			rigCameras.emplace_back(cameraState.camera_);
+			rigDevice_T_cameras.emplace_back(cameraState.device_T_camera_);
+
+			ocean_assert(cameraState.objectPointIds_.size() == cameraState.imagePoints_.size());
+
+			for (size_t n = 0; n < cameraState.objectPointIds_.size(); ++n)
+			{
+				const ObjectPointMap::const_iterator iObjectPoint = objectPointMap_.find(cameraState.objectPointIds_[n]);
+				ocean_assert(iObjectPoint != objectPointMap_.cend());
+
+				cameraIndices.emplace_back(Index32(cameraIndex));
+				objectPoints.emplace_back(iObjectPoint->second);
+				imagePoints.emplace_back(cameraState.imagePoints_[n]);
+			}
+		}
+
+		Indices32 validIndices;
+
+		if (objectPoints.size() >= minimalCorrespondences_ && optimizeDevicePose(rigCameras, rigDevice_T_cameras, world_T_predictedDevice, cameraIndices, objectPoints, imagePoints, world_T_device, configuration_.maximalProjectionError_, &validIndices) && validIndices.size() >= minimalCorrespondences_)
+		{
+			// we remove all tracks which do not match with the fused pose
+
+			std::vector<uint8_t> validCorrespondences(objectPoints.size(), 0u);
+
+			for (const Index32 validIndex : validIndices)
+			{
+				validCorrespondences[validIndex] = 1u;
+			}
+
+			size_t correspondenceIndex = 0;
+
+			for (CameraState& cameraState : cameraStates_)
+			{
+				size_t validTracks = 0;
+
+				for (size_t n = 0; n < cameraState.objectPointIds_.size(); ++n)
+				{
+					if (validCorrespondences[correspondenceIndex++] != 0u)
+					{
+						cameraState.objectPointIds_[validTracks] = cameraState.objectPointIds_[n];
+						cameraState.imagePoints_[validTracks] = cameraState.imagePoints_[n];
+
+						++validTracks;
+					}
+				}
+
+				cameraState.objectPointIds_.resize(validTracks);
+				cameraState.imagePoints_.resize(validTracks);
+			}
+
+			ocean_assert(correspondenceIndex == objectPoints.size());
+		}
+		else
+		{
+			Log::debug() << "TrackerRig: Failed to determine the pose of the device, " << validIndices.size() << " valid correspondences";
+
+			world_T_device.toNull();
+
+			reset();
+		}
+	}
+
+	const bool needsInitialization = !world_T_device.isValid();
+
+	if (needsInitialization)
+	{
+		// the rig can initialize from one frame set, the new map starts at the latest valid pose of the device
+
+		world_T_device = world_T_latestValidDevice_;
+	}
+
+	// new corners are detected in parallel, afterwards the corners are matched between cameras and triangulated
+
+	if (worker != nullptr)
+	{
+		worker->executeFunction(Worker::Function::create(*this, &TrackerRig::detectNewCornersSubset, 0u, 0u), 0u, (unsigned int)(cameraStates_.size()));
+	}
+	else
+	{
+		detectNewCornersSubset(0u, (unsigned int)(cameraStates_.size()));
+	}
+
+	const size_t newObjectPoints = triangulateNewObjectPoints(world_T_device);
+
+	if constexpr (loggingEnabled_)
+	{
+		Log::info() << "TrackerRig: Triangulated " << newObjectPoints << " new object points, " << objectPointMap_.size() << " object points in total";
+	}
+	OCEAN_SUPPRESS_UNUSED_WARNING(newObjectPoints);
+
+	if (needsInitialization)
+	{
+		if (objectPointMap_.size() >= minimalCorrespondences_)
+		{
+			trackerState_ = TS_TRACKING;
+		}
+		else
+		{
+			reset();
+
+			world_T_device.toNull();
+
+			trackerState_ = TS_INITIALIZING;
+		}
+	}
+
+	removeUntrackedObjectPoints();
+
+	world_T_previousDevice_ = world_T_device;
+
+	if (world_T_device.isValid())
+	{
+		world_T_latestValidDevice_ = world_T_device;
+	}
+
+	anyWorld_Q_previousDevice_ = anyWorld_Q_device;
+
+	return true;
+}
+
+size_t TrackerRig::trackedObjectPoints(const size_t cameraIndex) const
+{
+	ocean_assert(cameraIndex < cameraStates_.size());
+	if (cameraIndex >= cameraStates_.size())
+	{
+		return 0;
+	}
+
+	return cameraStates_[cameraIndex].objectPointIds_.size();
+}
+
+bool TrackerRig::optimizeDevicePose(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, const HomogenousMatrix4& world_T_roughDevice, const Indices32& cameraIndices, const Vectors3& objectPoints, const Vectors2& imagePoints, HomogenousMatrix4& world_T_device, const Scalar maximalProjectionError, Indices32* validIndices, const unsigned int iterations)
+{
+	ocean_assert(!cameras.empty() && cameras.size() == device_T_cameras.size());
+	ocean_assert(world_T_roughDevice.isValid());
+	ocean_assert(cameraIndices.size() == objectPoints.size() && objectPoints.size() == imagePoints.size());
+	ocean_assert(maximalProjectionError > Scalar(0));
+	ocean_assert(iterations >= 1u);
+
+	if (cameras.empty() || cameras.size() != device_T_cameras.size() || objectPoints.empty() || cameraIndices.size() != objectPoints.size() || objectPoints.size() != imagePoints.size())
+	{
+		return false;
+	}
+
+	HomogenousMatrices4 flippedCameras_T_device;
+	flippedCameras_T_device.reserve(device_T_cameras.size());
+
+	for (const HomogenousMatrix4& device_T_camera : device_T_cameras)
+	{
+		flippedCameras_T_device.emplace_back(Camera::standard2InvertedFlipped(device_T_camera));
+	}
+
+	const Scalar sqrSigma = Numeric::sqr(maximalProjectionError);
+
+	HomogenousMatrix4 device_T_world(world_T_roughDevice.inverted());
+
+	Scalar error = determineRobustError(cameras, flippedCameras_T_device, device_T_world, cameraIndices, objectPoints, imagePoints, sqrSigma);
+
+	Scalar lambda = Scalar(0.001);
+
+	for (unsigned int iteration = 0u; iteration < iterations; ++iteration)
+	{
+		// the device pose is updated with a small transformation from the left: device_T_world' = [R(w) | t] * device_T_world
+		// thus, the Jacobian of a point in device coordinates is [-[p]x | I]
+
+		StaticMatrix<Scalar, 6, 6> jacobianSquared(Scalar(0));
+		StaticMatrix<Scalar, 6, 1> jacobianError(Scalar(0));
+
+		for (size_t n = 0; n < objectPoints.size(); ++n)
+		{
+			const Index32 cameraIndex = cameraIndices[n];
+			ocean_assert(cameraIndex < cameras.size());
+
+			const AnyCamera& camera = *cameras[cameraIndex];
+			const HomogenousMatrix4& flippedCamera_T_device = flippedCameras_T_device[cameraIndex];
+
+			const Vector3 devicePoint = device_T_world * objectPoints[n];
+			const Vector3 flippedCameraPoint = flippedCamera_T_device * devicePoint;
+
+			if (flippedCameraPoint.z() <= Numeric::eps())
+			{
+				continue;
+			}
+
+			const Vector2 residual = camera.projectToImageIF(flippedCameraPoint) - imagePoints[n];
+
+			const Scalar weight = Geometry::Estimator::robustWeightSquare<Geometry::Estimator::ET_HUBER>(residual.sqr(), sqrSigma);
+
+			Scalar jx[3];
+			Scalar jy[3];
+			camera.pointJacobian2x3IF(flippedCameraPoint, jx, jy);
+
+			const SquareMatrix3 flippedCamera_R_device = flippedCamera_T_device.rotationMatrix();
+
+			const Vector3 deviceDerivatives[6] =
+			{
+				Vector3(0, -devicePoint.z(), devicePoint.y()),
+				Vector3(devicePoint.z(), 0, -devicePoint.x()),
+				Vector3(-devicePoint.y(), devicePoint.x(), 0),
+				Vector3(1, 0, 0),
+				Vector3(0, 1, 0),
+				Vector3(0, 0, 1)
+			};
+
+			Scalar jacobianX[6];
+			Scalar jacobianY[6];
+
+			for (unsigned int p = 0u; p < 6u; ++p)
+			{
+				const Vector3 cameraDerivative = flippedCamera_R_device * deviceDerivatives[p];
+
+				jacobianX[p] = jx[0] * cameraDerivative.x() + jx[1] * cameraDerivative.y() + jx[2] * cameraDerivative.z();
+				jacobianY[p] = jy[0] * cameraDerivative.x() + jy[1] * cameraDerivative.y() + jy[2] * cameraDerivative.z();
+			}
+
+			for (unsigned int r = 0u; r < 6u; ++r)
+			{
+				jacobianError[r] += weight * (jacobianX[r] * residual.x() + jacobianY[r] * residual.y());
+
+				for (unsigned int c = 0u; c < 6u; ++c)
+				{
+					jacobianSquared(r, c) += weight * (jacobianX[r] * jacobianX[c] + jacobianY[r] * jacobianY[c]);
+				}
+			}
+		}
+
+		bool improved = false;
+
+		while (lambda <= Scalar(1e6))
+		{
+			StaticMatrix<Scalar, 6, 6> dampedJacobianSquared(jacobianSquared);
+
+			for (unsigned int r = 0u; r < 6u; ++r)
+			{
+				dampedJacobianSquared(r, r) += lambda * jacobianSquared(r, r) + Numeric::eps();
+			}
+
+			StaticMatrix<Scalar, 6, 1> delta;
+			if (!dampedJacobianSquared.solveCholesky(jacobianError, delta))
+			{
+				lambda *= Scalar(10);
+				continue;
+			}
+
+			const HomogenousMatrix4 candidateDevice_T_world = HomogenousMatrix4(Vector3(-delta[3], -delta[4], -delta[5]), ExponentialMap(Vector3(-delta[0], -delta[1], -delta[2])).quaternion()) * device_T_world;
+
+			const Scalar candidateError = determineRobustError(cameras, flippedCameras_T_device, candidateDevice_T_world, cameraIndices, objectPoints, imagePoints, sqrSigma);
+
+			if (candidateError < error)
+			{
+				device_T_world = candidateDevice_T_world;
+				error = candidateError;
+
+				lambda = std::max(lambda * Scalar(0.1), Scalar(1e-6));
+
+				improved = true;
+				break;
+			}
+
+			lambda *= Scalar(10);
+		}
+
+		if (!improved)
+		{
+			break;
+		}
+	}
+
+	world_T_device = device_T_world.inverted();
+
+	if (validIndices != nullptr)
+	{
+		validIndices->clear();
+
+		for (size_t n = 0; n < objectPoints.size(); ++n)
+		{
+			const Index32 cameraIndex = cameraIndices[n];
+
+			const Vector3 flippedCameraPoint = flippedCameras_T_device[cameraIndex] * (device_T_world * objectPoints[n]);
+
+			if (flippedCameraPoint.z() > Numeric::eps() && cameras[cameraIndex]->projectToImageIF(flippedCameraPoint).sqrDistance(imagePoints[n]) <= sqrSigma)
+			{
+				validIndices->emplace_back(Index32(n));
+			}
+		}
+	}
+
+	return true;
+}
+
+void TrackerRig::trackCamerasSubset(const HomogenousMatrix4* world_T_predictedDevice, const Quaternion* previousDevice_Q_currentDevice, Frame* yFrames, const unsigned int firstCamera, const unsigned int numberCameras)
+{
+	ocean_assert(world_T_predictedDevice != nullptr && previousDevice_Q_currentDevice != nullptr && yFrames != nullptr);
+	ocean_assert(firstCamera + numberCameras <= cameraStates_.size());
+
+	for (unsigned int cameraIndex = firstCamera; cameraIndex < firstCamera + numberCameras; ++cameraIndex)
+	{
+		CameraState& cameraState = cameraStates_[cameraIndex];
+
+		const AnyCamera& camera = *cameraState.camera_;
+
+		std::swap(cameraState.previousPyramid_, cameraState.currentPyramid_);
+
+		if (!cameraState.currentPyramid_.replace(CV::FramePyramid::DM_FILTER_11, std::move(yFrames[cameraIndex]), CV::FramePyramid::AS_MANY_LAYERS_AS_POSSIBLE, nullptr))
+		{
+			ocean_assert(false && "This should never happen!");
+
+			cameraState.objectPointIds_.clear();
+			cameraState.imagePoints_.clear();
+
+			continue;
+		}
+
+		if (!cameraState.previousPyramid_.isValid() || cameraState.objectPointIds_.empty())
+		{
+			ocean_assert(cameraState.objectPointIds_.empty());
+			continue;
+		}
+
+		const Scalar border = Scalar(cameraState.trackingParameters_.patchSize_);
+		const Box2 validArea(border, border, Scalar(camera.width()) - border, Scalar(camera.height()) - border);
+
+		Quaternion previousCamera_Q_currentCamera(false);
+
+		if (previousDevice_Q_currentDevice->isValid())
+		{
+			const Quaternion device_Q_camera = cameraState.device_T_camera_.rotation();
+
+			previousCamera_Q_currentCamera = device_Q_camera.inverted() * *previousDevice_Q_currentDevice * device_Q_camera;
+		}
+
+		Vectors2 currentImagePoints;
+		currentImagePoints.reserve(cameraState.imagePoints_.size());
+
+		if (world_T_predictedDevice->isValid())
+		{
+			// all tracked points are localized, so that we can use the projected object points as prediction
+
+			const HomogenousMatrix4 flippedCamera_T_world = cameraState.flippedCamera_T_device_ * world_T_predictedDevice->inverted();
+
+			for (size_t n = 0; n < cameraState.objectPointIds_.size(); ++n)
+			{
+				const Vector2& previousImagePoint = cameraState.imagePoints_[n];
+
+				const ObjectPointMap::const_iterator iObjectPoint = objectPointMap_.find(cameraState.objectPointIds_[n]);
+				ocean_assert(iObjectPoint != objectPointMap_.cend());
+
+				if (Camera::isObjectPointInFrontIF(flippedCamera_T_world, iObjectPoint->second))
+				{
+					const Vector2 predictedImagePoint = camera.projectToImageIF(flippedCamera_T_world, iObjectPoint->second);
+
+					if (validArea.isInside(previousImagePoint) && validArea.isInside(predictedImagePoint))
+					{
+						currentImagePoints.emplace_back(predictedImagePoint);
+						continue;
+					}
+				}
+
+				currentImagePoints.emplace_back(previousImagePoint);
+			}
+		}
+		else
+		{
+			currentImagePoints = cameraState.imagePoints_;
+		}
+
+		const TrackingParameterPair& parameterPair = cameraState.trackingParameters_.parameterPair(*world_T_predictedDevice, previousCamera_Q_currentCamera);
+
+		std::vector<uint8_t> validCorrespondences(currentImagePoints.size(), 0u);
+
+		CV::Advanced::AdvancedMotion::PointCorrespondences pointCorrespondences(cameraState.imagePoints_.data(), currentImagePoints.data(), validCorrespondences.data(), currentImagePoints.size(), parameterPair.layers_, parameterPair.coarsestLayerRadius_);
+
+		bool result = false;
+
+		switch (cameraState.trackingParameters_.patchSize_)
+		{
+			case 7u:
+				result = CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 7u>(cameraState.previousPyramid_, cameraState.currentPyramid_, &pointCorrespondences, 1);
+				break;
+
+			case 31u:
+				result = CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 31u>(cameraState.previousPyramid_, cameraState.currentPyramid_, &pointCorrespondences, 1);
+				break;
+
+			default:
+				ocean_assert(cameraState.trackingParameters_.patchSize_ == 15u);
+				result = CV::Advanced::AdvancedMotionSSD::trackPointsBidirectionalSubPixelMirroredBorder<1u, 15u>(cameraState.previousPyramid_, cameraState.currentPyramid_, &pointCorrespondences, 1);
+				break;
+		}
+
+		ocean_assert(result);
+		if (!result)
+		{
+			cameraState.objectPointIds_.clear();
+			cameraState.imagePoints_.clear();
+
+			continue;
+		}
+
+		size_t validTracks = 0;
+
+		for (size_t n = 0; n < validCorrespondences.size(); ++n)
+		{
+			if (validCorrespondences[n] != 0u)
+			{
+				cameraState.objectPointIds_[validTracks] = cameraState.objectPointIds_[n];
+				cameraState.imagePoints_[validTracks] = currentImagePoints[n];
+
+				++validTracks;
+			}
+		}
+
+		cameraState.objectPointIds_.resize(validTracks);
+		cameraState.imagePoints_.resize(validTracks);
+	}
+}
+
+void TrackerRig::detectNewCornersSubset(const unsigned int firstCamera, const unsigned int numberCameras)
+{
+	ocean_assert(firstCamera + numberCameras <= cameraStates_.size());
+
+	for (unsigned int cameraIndex = firstCamera; cameraIndex < firstCamera + numberCameras; ++cameraIndex)
+	{
+		CameraState& cameraState = cameraStates_[cameraIndex];
+
+		cameraState.newImagePoints_.clear();
+		cameraState.newDeviceDirections_.clear();
+		cameraState.newDescriptors_.clear();
+
+		ocean_assert(cameraState.occupancyArray_.isValid());
+
+		cameraState.occupancyArray_.removePoints();
+
+		for (const Vector2& imagePoint : cameraState.imagePoints_)
+		{
+			cameraState.occupancyArray_.addPoint(imagePoint);
+		}
+
+		if (!cameraState.occupancyArray_.needMorePoints())
+		{
+			continue;
+		}
+
+		// the coverage is determined before new corners are added, as only some of the new corners will become object points
+
+		const size_t coveragePercent = size_t(cameraState.occupancyArray_.coverage() * 100.0f + 0.5f);
+
+		const Frame& yFrame = cameraState.currentPyramid_.finestLayer();
+
+		CV::Detector::HarrisCorners corners;
+		if (!CV::Detector::HarrisCornerDetector::detectCorners(yFrame.constdata<uint8_t>(), yFrame.width(), yFrame.height(), yFrame.paddingElements(), cameraState.harrisThreshold_, false /*frameIsUndistorted*/, corners, true /*determineExactPosition*/))
+		{
+			continue;
+		}
+
+		// we add the strongest corners first
+
+		std::sort(corners.begin(), corners.end());
+
+		for (const CV::Detector::HarrisCorner& corner : corners)
+		{
+			if (cameraState.occupancyArray_.addPointIfEmpty(corner.observation()))
+			{
+				cameraState.newImagePoints_.emplace_back(corner.observation());
+			}
+		}
+
+		if (coveragePercent < 40) // target is 40%
+		{
+			if (cameraState.harrisThreshold_ > configuration_.harrisThresholdMin_)
+			{
+				--cameraState.harrisThreshold_;
+			}
+		}
+		else
+		{
+			if (cameraState.harrisThreshold_ < configuration_.harrisThresholdMax_)
+			{
+				++cameraState.harrisThreshold_;
+			}
+		}
+
+		if (cameraState.newImagePoints_.empty())
+		{
+			continue;
+		}
+
+		cameraState.newDescriptors_.resize(cameraState.newImagePoints_.size());
+		CV::Detector::FREAKDescriptor32::computeDescriptors(cameraState.camera_, cameraState.currentPyramid_, cameraState.newImagePoints_.data(), cameraState.newImagePoints_.size(), 0u /*pyramidLevel*/, cameraState.newDescriptors_.data());
+
+		const SquareMatrix3 device_R_camera = cameraState.device_T_camera_.rotationMatrix();
+
+		cameraState.newDeviceDirections_.reserve(cameraState.newImagePoints_.size());
+
+		for (const Vector2& newImagePoint : cameraState.newImagePoints_)
+		{
+			cameraState.newDeviceDirections_.emplace_back(device_R_camera * cameraState.camera_->vector(newImagePoint, true /*makeUnitVector*/));
+		}
+	}
+}
+
+size_t TrackerRig::triangulateNewObjectPoints(const HomogenousMatrix4& world_T_device)
+{
+	ocean_assert(world_T_device.isValid());
+
+	constexpr unsigned int maximalDescriptorDistance = CV::Detector::FREAKDescriptor32::descriptorMatchingThreshold(35u);
+
+	const Scalar minimalCosTriangulationAngle = Numeric::cos(minimalTriangulationAngle_);
+
+	std::vector<std::vector<uint8_t>> usedCorners(cameraStates_.size());
+
+	for (size_t cameraIndex = 0; cameraIndex < cameraStates_.size(); ++cameraIndex)
+	{
+		usedCorners[cameraIndex].resize(cameraStates_[cameraIndex].newImagePoints_.size(), 0u);
+	}
+
+	size_t newObjectPoints = 0;
+
+	for (size_t cameraIndexA = 0; cameraIndexA < cameraStates_.size(); ++cameraIndexA)
+	{
+		CameraState& cameraStateA = cameraStates_[cameraIndexA];
+
+		for (size_t cameraIndexB = cameraIndexA + 1; cameraIndexB < cameraStates_.size(); ++cameraIndexB)
+		{
+			CameraState& cameraStateB = cameraStates_[cameraIndexB];
+
+			if (cameraStateA.newImagePoints_.empty() || cameraStateB.newImagePoints_.empty())
+			{
+				continue;
+			}
+
+			const Vector3 baseline = cameraStateB.device_T_camera_.translation() - cameraStateA.device_T_camera_.translation();
+
+			if (baseline.isNull())
+			{
+				// without baseline, the cameras cannot triangulate any object point
+				continue;
+			}
+
+			// the maximal angle between a viewing ray and the epipolar plane is defined by the maximal projection error
+
+			const Scalar radianPerPixelA = cameraStateA.camera_->fovX() / Scalar(cameraStateA.camera_->width());
+			const Scalar radianPerPixelB = cameraStateB.camera_->fovX() / Scalar(cameraStateB.camera_->width());
+
+			const Scalar maximalSinEpipolarAngle = Numeric::sin(configuration_.maximalProjectionError_ * std::max(radianPerPixelA, radianPerPixelB));
+
+			std::vector<uint8_t>& usedCornersA = usedCorners[cameraIndexA];
+			std::vector<uint8_t>& usedCornersB = usedCorners[cameraIndexB];
+
+			// we determine the best match for each corner in both directions, only mutual and unique matches are accepted
+
+			constexpr unsigned int invalidDistance = (unsigned int)(-1);
+
+			Indices32 bestIndicesA(cameraStateA.newImagePoints_.size(), Index32(-1));
+			std::vector<unsigned int> bestDistancesA(cameraStateA.newImagePoints_.size(), invalidDistance);
+			std::vector<unsigned int> secondBestDistancesA(cameraStateA.newImagePoints_.size(), invalidDistance);
+
+			Indices32 bestIndicesB(cameraStateB.newImagePoints_.size(), Index32(-1));
+			std::vector<unsigned int> bestDistancesB(cameraStateB.newImagePoints_.size(), invalidDistance);
+			std::vector<unsigned int> secondBestDistancesB(cameraStateB.newImagePoints_.size(), invalidDistance);
+
+			for (size_t a = 0; a < cameraStateA.newImagePoints_.size(); ++a)
+			{
+				if (usedCornersA[a] != 0u || !cameraStateA.newDescriptors_[a].isValid())
+				{
+					continue;
+				}
+
+				Vector3 epipolarNormal = baseline.cross(cameraStateA.newDeviceDirections_[a]);
+
+				if (!epipolarNormal.normalize())
+				{
+					continue;
+				}
+
+				for (size_t b = 0; b < cameraStateB.newImagePoints_.size(); ++b)
+				{
+					if (usedCornersB[b] != 0u || !cameraStateB.newDescriptors_[b].isValid())
+					{
+						continue;
+					}
+
+					if (Numeric::abs(epipolarNormal * cameraStateB.newDeviceDirections_[b]) > maximalSinEpipolarAngle)
+					{
+						continue;
+					}
+
+					const unsigned int distance = CV::Detector::FREAKDescriptor32::calculateDistance(cameraStateA.newDescriptors_[a], cameraStateB.newDescriptors_[b]);
+
+					updateBestMatch(Index32(b), distance, bestIndicesA[a], bestDistancesA[a], secondBestDistancesA[a]);
+					updateBestMatch(Index32(a), distance, bestIndicesB[b], bestDistancesB[b], secondBestDistancesB[b]);
+				}
+			}
+
+			Indices32 cornerIndicesA;
+			Indices32 cornerIndicesB;
+			Vectors2 imagePointsA;
+			Vectors2 imagePointsB;
+
+			for (size_t a = 0; a < cameraStateA.newImagePoints_.size(); ++a)
+			{
+				const Index32 b = bestIndicesA[a];
+
+				if (b == Index32(-1) || bestIndicesB[b] != Index32(a) || bestDistancesA[a] > maximalDescriptorDistance)
+				{
+					continue;
+				}
+
+				// the match must be unique along both epipolar curves
+
+				if (!isUniqueMatch(bestDistancesA[a], secondBestDistancesA[a]) || !isUniqueMatch(bestDistancesB[b], secondBestDistancesB[b]))
+				{
+					continue;
+				}
+
+				cornerIndicesA.emplace_back(Index32(a));
+				cornerIndicesB.emplace_back(b);
+
+				imagePointsA.emplace_back(cameraStateA.newImagePoints_[a]);
+				imagePointsB.emplace_back(cameraStateB.newImagePoints_[b]);
+			}
+
+			if (imagePointsA.empty())
+			{
+				continue;
+			}
+
+			const HomogenousMatrix4 world_T_cameraA = world_T_device * cameraStateA.device_T_camera_;
+			const HomogenousMatrix4 world_T_cameraB = world_T_device * cameraStateB.device_T_camera_;
+
+			Vectors3 objectPoints;
+			Indices32 validIndices;
+			Geometry::Utilities::triangulateObjectPoints(*cameraStateA.camera_, *cameraStateB.camera_, world_T_cameraA, world_T_cameraB, ConstArrayAccessor<Vector2>(imagePointsA), ConstArrayAccessor<Vector2>(imagePointsB), objectPoints, validIndices, true /*onlyFrontPoints*/, Numeric::sqr(configuration_.maximalProjectionError_));
+
+			ocean_assert(objectPoints.size() == validIndices.size());
+
+			for (size_t n = 0; n < validIndices.size(); ++n)
+			{
+				const Index32 validIndex = validIndices[n];
+				const Vector3& objectPoint = objectPoints[n];
+
+				// object points with a too small triangulation angle are not precise enough
+
+				const Vector3 directionA = (objectPoint - world_T_cameraA.translation()).normalizedOrZero();
+				const Vector3 directionB = (objectPoint - world_T_cameraB.translation()).normalizedOrZero();
+
+				if (directionA * directionB > minimalCosTriangulationAngle)
+				{
+					continue;
+				}
+
+				const Index32 objectPointId = objectPointIdCounter_++;
+
+				objectPointMap_.emplace(objectPointId, objectPoint);
+
+				cameraStateA.objectPointIds_.emplace_back(objectPointId);
+				cameraStateA.imagePoints_.emplace_back(imagePointsA[validIndex]);
+
+				cameraStateB.objectPointIds_.emplace_back(objectPointId);
+				cameraStateB.imagePoints_.emplace_back(imagePointsB[validIndex]);
+
+				usedCornersA[cornerIndicesA[validIndex]] = 1u;
+				usedCornersB[cornerIndicesB[validIndex]] = 1u;
+
+				++newObjectPoints;
+			}
+		}
+	}
+
+	return newObjectPoints;
+}
+
+void TrackerRig::removeUntrackedObjectPoints()
+{
+	UnorderedIndexSet32 trackedObjectPointIds;
+	trackedObjectPointIds.reserve(objectPointMap_.size());
+
+	for (const CameraState& cameraState : cameraStates_)
+	{
+		trackedObjectPointIds.insert(cameraState.objectPointIds_.cbegin(), cameraState.objectPointIds_.cend());
+	}
+
+	for (ObjectPointMap::iterator iObjectPoint = objectPointMap_.begin(); iObjectPoint != objectPointMap_.end(); /*noop*/)
+	{
+		if (trackedObjectPointIds.find(iObjectPoint->first) == trackedObjectPointIds.cend())
+		{
+			iObjectPoint = objectPointMap_.erase(iObjectPoint);
+		}
+		else
+		{
+			++iObjectPoint;
+		}
+	}
+}
+
+void TrackerRig::reset()
+{
+	objectPointMap_.clear();
+
+	for (CameraState& cameraState : cameraStates_)
+	{
+		cameraState.clearTracks();
+	}
+}
+
+Scalar TrackerRig::determineRobustError(const SharedAnyCameras& cameras, const HomogenousMatrices4& flippedCameras_T_device, const HomogenousMatrix4& device_T_world, const Indices32& cameraIndices, const Vectors3& objectPoints, const Vectors2& imagePoints, const Scalar sqrSigma)
+{
+	ocean_assert(cameraIndices.size() == objectPoints.size() && objectPoints.size() == imagePoints.size());
+	ocean_assert(sqrSigma > Scalar(0));
+
+	Scalar error = Scalar(0);
+
+	for (size_t n = 0; n < objectPoints.size(); ++n)
+	{
+		const Index32 cameraIndex = cameraIndices[n];
+
+		const Vector3 flippedCameraPoint = flippedCameras_T_device[cameraIndex] * (device_T_world * objectPoints[n]);
+
+		if (flippedCameraPoint.z() <= Numeric::eps())
+		{
+			// points behind the camera are treated like strong outliers
+
+			error += sqrSigma * Scalar(10);
+			continue;
+		}
+
+		const Scalar sqrError = cameras[cameraIndex]->projectToImageIF(flippedCameraPoint).sqrDistance(imagePoints[n]);
+
+		error += sqrError * Geometry::Estimator::robustWeightSquare<Geometry::Estimator::ET_HUBER>(sqrError, sqrSigma);
+	}
+
+	return error;
+}
+
+}
+
+}
+
+}
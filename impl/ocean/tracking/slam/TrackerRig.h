@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef META_OCEAN_TRACKING_SLAM_TRACKER_RIG_H
+#define META_OCEAN_TRACKING_SLAM_TRACKER_RIG_H
+
+#include "ocean/tracking/slam/SLAM.h"
+#include "ocean/tracking/slam/Tracker.h"
+#include "ocean/tracking/slam/OccupancyArray.h"
+
+#include "ocean/base/Frame.h"
+#include "ocean/base/Worker.h"
+
+#include "ocean/cv/FramePyramid.h"
+
+#include "ocean/cv/detector/FREAKDescriptor.h"
+
+#include "ocean/math/AnyCamera.h"
+#include "ocean/math/HomogenousMatrix4.h"
+#include "ocean/math/Quaternion.h"
+
+namespace Ocean
+{
+
+namespace Tracking
+{
+
+namespace SLAM
+{
+
+/**
+ * This class implements a SLAM front-end for a rig of several synchronized cameras (e.g., a stereo pair or a rig with up to four cameras).
+ * All cameras of a frame set are processed in parallel: each camera has its own frame pyramid, frame-to-frame point tracking, and corner detection.<br>
+ * The tracked correspondences of all cameras are fused into one pose of the rig's device, and new 3D object points are triangulated immediately from the baselines between the cameras.<br>
+ * Therefore, the tracker does not need any monocular initialization and provides metric poses (as long as the transformations between device and cameras are metric).<br>
+ * The tracker keeps object points only as long as they are tracked in at least one camera, so that the tracker acts as a visual odometry front-end.
+ * @ingroup trackingslam
+ */
+class OCEAN_TRACKING_SLAM_EXPORT TrackerRig : public Tracker
+{
+	public:
+
+		/**
+		 * Definition of an unordered map mapping object point ids to 3D object point locations, defined in world.
+		 */
+		using ObjectPointMap = std::unordered_map<Index32, Vector3>;
+
+	protected:
+
+		/**
+		 * This class holds the state of one camera of the rig.
+		 */
+		class CameraState
+		{
+			public:
+
+				/**
+				 * Creates a new invalid state.
+				 */
+				CameraState() = default;
+
+				/**
+				 * Creates a new state for a camera.
+				 * @param camera The camera profile of the camera, must be valid
+				 * @param device_T_camera The transformation between camera and device, must be valid
+				 * @param configuration The configuration of the tracker, must be valid
+				 */
+				CameraState(SharedAnyCamera camera, const HomogenousMatrix4& device_T_camera, const Tracker::Configuration& configuration);
+
+				/**
+				 * Removes all tracked points from this state.
+				 */
+				void clearTracks();
+
+			public:
+
+				/// The camera profile of the camera.
+				SharedAnyCamera camera_;
+
+				/// The transformation between camera and device.
+				HomogenousMatrix4 device_T_camera_ = HomogenousMatrix4(false);
+
+				/// The transformation between device and flipped camera.
+				HomogenousMatrix4 flippedCamera_T_device_ = HomogenousMatrix4(false);
+
+				/// The tracking parameters of the camera.
+				TrackingParameters trackingParameters_;
+
+				/// The frame pyramid of the previous frame.
+				CV::FramePyramid previousPyramid_;
+
+				/// The frame pyramid of the current frame.
+				CV::FramePyramid currentPyramid_;
+
+				/// The ids of the object points tracked in this camera.
+				Indices32 objectPointIds_;
+
+				/// The image points of the tracked object points, one for each id.
+				Vectors2 imagePoints_;
+
+				/// The occupancy array for the spatial distribution of the tracked points.
+				OccupancyArray occupancyArray_;
+
+				/// The adaptive Harris corner detection threshold of this camera.
+				unsigned int harrisThreshold_ = 0u;
+
+				/// The new corners detected in the current frame which may become new object points.
+				Vectors2 newImagePoints_;
+
+				/// The viewing directions of the new corners, defined in the coordinate system of the device, one for each new corner.
+				Vectors3 newDeviceDirections_;
+
+				/// The descriptors of the new corners, one for each new corner.
+				CV::Detector::FREAKDescriptors32 newDescriptors_;
+		};
+
+		/**
+		 * Definition of a vector holding camera states.
+		 */
+		using CameraStates = std::vector<CameraState>;
+
+	public:
+
+		/**
+		 * Creates a new tracker object.
+		 */
+		TrackerRig() = default;
+
+		/**
+		 * Configures the tracker with the specified settings.
+		 * This function must be called before the first frame set is processed.
+		 * @param configuration The configuration object containing all tracker settings, must be valid
+		 * @return True if configuration was successful
+		 */
+		bool configure(const Configuration& configuration);
+
+		/**
+		 * Processes a new set of synchronized camera frames and determines the pose of the rig's device.
+		 * The cameras and the transformations between cameras and device must not change between frame sets.
+		 * @param cameras The camera profiles of all cameras of the rig, at least two
+		 * @param device_T_cameras The transformations between cameras and device, one for each camera
+		 * @param yFrames The current grayscale frames (FORMAT_Y8), one for each camera, will be moved, must be valid with matching dimensions
+		 * @param world_T_device The resulting pose of the device, invalid if the pose could not be determined
+		 * @param anyWorld_Q_device Optional orientation of the device from an external source (e.g., IMU), can be invalid if unavailable
+		 * @param worker Optional worker object to process the individual cameras in parallel
+		 * @return True if the frame set was processed successfully; false on error
+		 */
+		bool handleFrames(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, Frames&& yFrames, HomogenousMatrix4& world_T_device, const Quaternion& anyWorld_Q_device = Quaternion(false), Worker* worker = nullptr);
+
+		/**
+		 * Returns the current state of the tracker.
+		 * @return The tracker's state
+		 */
+		inline TrackerState trackerState() const;
+
+		/**
+		 * Returns the object points which are currently tracked in at least one camera.
+		 * @return The tracker's object points
+		 */
+		inline const ObjectPointMap& objectPointMap() const;
+
+		/**
+		 * Returns the number of object points which are currently tracked in a specific camera.
+		 * @param cameraIndex The index of the camera, with range [0, numberCameras - 1]
+		 * @return The number of tracked object points
+		 */
+		size_t trackedObjectPoints(const size_t cameraIndex) const;
+
+		/**
+		 * Determines the pose of a device from 2D/3D correspondences observed in several cameras rigidly mounted to the device.
+		 * The pose is optimized with a robust (Huber) Levenberg-Marquardt optimization starting at a rough pose.
+		 * @param cameras The camera profiles of all cameras, at least one
+		 * @param device_T_cameras The transformations between cameras and device, one for each camera
+		 * @param world_T_roughDevice The rough pose of the device, must be valid
+		 * @param cameraIndices The indices of the cameras in which the individual correspondences have been observed, one for each correspondence
+		 * @param objectPoints The 3D object points of the correspondences, defined in world
+		 * @param imagePoints The 2D image points of the correspondences, one for each object point
+		 * @param world_T_device The resulting optimized pose of the device
+		 * @param maximalProjectionError The maximal projection error of valid correspondences, in pixel, with range (0, infinity)
+		 * @param validIndices Optional resulting indices of all correspondences with projection error below the maximal projection error
+		 * @param iterations The maximal number of optimization iterations, with range [1, infinity)
+		 * @return True, if succeeded
+		 */
+		static bool optimizeDevicePose(const SharedAnyCameras& cameras, const HomogenousMatrices4& device_T_cameras, const HomogenousMatrix4& world_T_roughDevice, const Indices32& cameraIndices, const Vectors3& objectPoints, const Vectors2& imagePoints, HomogenousMatrix4& world_T_device, const Scalar maximalProjectionError, Indices32* validIndices = nullptr, const unsigned int iterations = 20u);
+
+	protected:
+
+		/**
+		 * Tracks the points of a subset of all cameras from the previous frame to the current frame.
+		 * @param world_T_predictedDevice The predicted pose of the device in the current frame, invalid if unknown
+		 * @param previousDevice_Q_currentDevice The rotation between current and previous device, invalid if unknown
+		 * @param yFrames The current frames, one for each camera
+		 * @param firstCamera The first camera to be handled
+		 * @param numberCameras The number of cameras to be handled
+		 */
+		void trackCamerasSubset(const HomogenousMatrix4* world_T_predictedDevice, const Quaternion* previousDevice_Q_currentDevice, Frame* yFrames, const unsigned int firstCamera, const unsigned int numberCameras);
+
+		/**
+		 * Detects and describes new corners in a subset of all cameras, corners close to tracked points are skipped.
+		 * @param firstCamera The first camera to be handled
+		 * @param numberCameras The number of cameras to be handled
+		 */
+		void detectNewCornersSubset(const unsigned int firstCamera, const unsigned int numberCameras);
+
+		/**
+		 * Matches the new corners between all pairs of cameras and triangulates new object points from the cameras' baselines.
+		 * @param world_T_device The pose of the device in the current frame, must be valid
+		 * @return The number of new object points
+		 */
+		size_t triangulateNewObjectPoints(const HomogenousMatrix4& world_T_device);
+
+		/**
+		 * Removes all object points which are not tracked in any camera anymore.
+		 */
+		void removeUntrackedObjectPoints();
+
+		/**
+		 * Resets all object points and tracks.
+		 */
+		void reset();
+
+		/**
+		 * Updates the best and the second best match of a corner with a new candidate.
+		 * @param candidateIndex The index of the candidate corner
+		 * @param candidateDistance The descriptor distance between the corner and the candidate
+		 * @param bestIndex The index of the best match so far, will be updated
+		 * @param bestDistance The descriptor distance of the best match so far, will be updated
+		 * @param secondBestDistance The descriptor distance of the second best match so far, will be updated
+		 */
+		static inline void updateBestMatch(const Index32 candidateIndex, const unsigned int candidateDistance, Index32& bestIndex, unsigned int& bestDistance, unsigned int& secondBestDistance);
+
+		/**
+		 * Returns whether the best match of a corner is clearly better than the second best match.
+		 * @param bestDistance The descriptor distance of the best match
+		 * @param secondBestDistance The descriptor distance of the second best match, -1 if no second match exists
+		 * @return True, if so
+		 */
+		static inline bool isUniqueMatch(const unsigned int bestDistance, const unsigned int secondBestDistance);
+
+		/**
+		 * Returns the robust error of a device pose.
+		 * @param cameras The camera profiles of all cameras
+		 * @param flippedCameras_T_device The transformations between device and flipped cameras, one for each camera
+		 * @param device_T_world The inverted pose of the device
+		 * @param cameraIndices The indices of the cameras, one for each correspondence
+		 * @param objectPoints The 3D object points of the correspondences
+		 * @param imagePoints The 2D image points of the correspondences
+		 * @param sqrSigma The squared sigma of the Huber estimator, with range (0, infinity)
+		 * @return The robust error
+		 */
+		static Scalar determineRobustError(const SharedAnyCameras& cameras, const HomogenousMatrices4& flippedCameras_T_device, const HomogenousMatrix4& device_T_world, const Indices32& cameraIndices, const Vectors3& objectPoints, const Vectors2& imagePoints, const Scalar sqrSigma);
+
+	protected:
+
+		/// The current state of the tracker.
+		TrackerState trackerState_ = TS_UNKNOWN;
+
+		/// The configuration of the tracker.
+		Configuration configuration_;
+
+		/// The states of the individual cameras.
+		CameraStates cameraStates_;
+
+		/// The object points tracked in at least one camera.
+		ObjectPointMap objectPointMap_;
+
+		/// The counter for generating unique object point ids.
+		Index32 objectPointIdCounter_ = 0u;
+
+		/// The pose of the device in the previous frame, invalid if unknown.
+		HomogenousMatrix4 world_T_previousDevice_ = HomogenousMatrix4(false);
+
+		/// The most recent valid pose of the device, used as origin when the tracker needs to re-initialize.
+		HomogenousMatrix4 world_T_latestValidDevice_ = HomogenousMatrix4(true);
+
+		/// The orientation of the previous device in an external/arbitrary world coordinate system (e.g., from IMU).
+		Quaternion anyWorld_Q_previousDevice_ = Quaternion(false);
+
+		/// The minimal number of correspondences necessary to determine the pose of the device.
+		static constexpr size_t minimalCorrespondences_ = 15;
+
+		/// The minimal angle between the two viewing rays of a new triangulated object point, in radian.
+		static constexpr Scalar minimalTriangulationAngle_ = Numeric::deg2rad(Scalar(0.5));
+};
+
+inline Tracker::TrackerState TrackerRig::trackerState() const
+{
+	return trackerState_;
+}
+
+inline const TrackerRig::ObjectPointMap& TrackerRig::objectPointMap() const
+{
+	return objectPointMap_;
+}
+
+inline void TrackerRig::updateBestMatch(const Index32 candidateIndex, const unsigned int candidateDistance, Index32& bestIndex, unsigned int& bestDistance, unsigned int& secondBestDistance)
+{
+	if (candidateDistance < bestDistance)
+	{
+		secondBestDistance = bestDistance;
+
+		bestIndex = candidateIndex;
+		bestDistance = candidateDistance;
+	}
+	else if (candidateDistance < secondBestDistance)
+	{
+		secondBestDistance = candidateDistance;
+	}
+}
+
+inline bool TrackerRig::isUniqueMatch(const unsigned int bestDistance, const unsigned int secondBestDistance)
+{
+	if (secondBestDistance == (unsigned int)(-1))
+	{
+		return true;
+	}
+
+	// the best match must be at least 20% better than the second best match
+
+	return uint64_t(bestDistance) * 10ull < uint64_t(secondBestDistance) * 8ull;
+}
+
+}
+
+}
+
+}
+
+#endif // META_OCEAN_TRACKING_SLAM_TRACKER_RIG_H
@@ -38,8 +38,10 @@ TrackingCorrespondences::TrackingCorrespondences()
 	objectPointPrecisions_.reserve(128);
 }
 
-void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Index32 mapVersion, const LocalizedObjectPointMap& localizedObjectPointMap, PointTrackMap& pointTrackMap, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision)
+void TrackingCorrespondences::update(const Index32 previousFrameIndex, const MapView& mapView, const Indices32& observationPointIds, const Vectors2& observationImagePoints, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision)
 {
+	ocean_assert(observationPointIds.size() == observationImagePoints.size());
+
 	previousImagePoints_.clear();
 	currentImagePoints_.clear();
 
@@ -50,22 +52,51 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 	objectPoints_.clear();
 	objectPointPrecisions_.clear();
 
-	for (const LocalizedObjectPointMap::value_type& objectPointPair : localizedObjectPointMap) // TODO iterate only over visible object points
+	pointTrackIndices_.clear();
+
+	for (size_t nObservation = 0; nObservation < observationPointIds.size(); ++nObservation)
+	{
+		const Index32& pointId = observationPointIds[nObservation];
+
+		if (!pointIdSet_.emplace(pointId).second)
+		{
+			ocean_assert(false && "The point has been observed twice!");
+			continue;
+		}
+
+		const MapView::ObjectPoint* objectPoint = mapView.objectPoint(pointId);
+
+		if (objectPoint != nullptr)
+		{
+			previousImagePoints_.push_back(observationImagePoints[nObservation]);
+			pointIds_.push_back(pointId);
+
+			objectPoints_.push_back(objectPoint->position_);
+			objectPointPrecisions_.push_back(objectPoint->localizationPrecision_);
+		}
+		else
+		{
+			// either an unlocalized point track, or an object point which has been localized after the view has been created
+
+			pointTrackIndices_.push_back(Index32(nObservation));
+		}
+	}
+
+	for (const MapView::ObjectPointMap::value_type& objectPointPair : mapView.objectPointMap()) // TODO iterate only over visible object points
 	{
 		const Index32& objectPointId = objectPointPair.first;
-		const LocalizedObjectPoint& localizedObjectPoint = objectPointPair.second;
+		const MapView::ObjectPoint& objectPoint = objectPointPair.second;
 
-		if (localizedObjectPoint.lastObservationFrameIndex() == previousFrameIndex)
+		if (objectPoint.lastObservationFrameIndex_ == previousFrameIndex && !pointIdSet_.contains(objectPointId))
 		{
-			const Observation lastObservation = localizedObjectPoint.lastObservation();
+			// the object point has been observed outside of the frame-to-frame tracking, e.g., during re-localization
 
-			previousImagePoints_.push_back(lastObservation.imagePoint());
+			previousImagePoints_.push_back(objectPoint.lastImagePoint_);
 			pointIds_.push_back(objectPointId);
 
-			objectPoints_.push_back(localizedObjectPoint.position());
-			objectPointPrecisions_.push_back(localizedObjectPoint.localizationPrecision());
+			objectPoints_.push_back(objectPoint.position_);
+			objectPointPrecisions_.push_back(objectPoint.localizationPrecision_);
 
-			ocean_assert(!pointIdSet_.contains(objectPointId));
 			pointIdSet_.insert(objectPointId);
 		}
 	}
@@ -111,35 +142,24 @@ void TrackingCorrespondences::update(const Index32 previousFrameIndex, const Ind
 			ocean_assert(!pointIdSet.contains(pointIds_[n]));
 			pointIdSet.insert(pointIds_[n]);
 		}
-
-		ocean_assert(pointIdSet_.size() == pointIdSet.size());
 	}
 #endif // OCEAN_DEBUG
 
-	for (const PointTrackMap::value_type& pointPair : pointTrackMap)
-	{
-		const Index32& objectPointId = pointPair.first;
-
-		if (!pointIdSet_.contains(objectPointId)) // TODO should not be necessary once point tracks and unlocalized are merged
-		{
-			const PointTrack& pointTrack = pointPair.second;
-			ocean_assert(pointTrack.isValid());
+	// the point tracks follow the localized object points
 
-			ocean_assert(pointTrack.lastFrameIndex() == previousFrameIndex);
-			if (pointTrack.lastFrameIndex() == previousFrameIndex)
-			{
-				previousImagePoints_.push_back(pointTrack.lastImagePoint());
-				pointIds_.push_back(objectPointId);
-			}
-		}
+	for (const Index32 pointTrackIndex : pointTrackIndices_)
+	{
+		previousImagePoints_.push_back(observationImagePoints[pointTrackIndex]);
+		pointIds_.push_back(observationPointIds[pointTrackIndex]);
 	}
 
 	ocean_assert(UnorderedIndexSet32(pointIds_.cbegin(), pointIds_.cend()).size() == pointIds_.size());
+	ocean_assert(pointIdSet_.size() == pointIds_.size());
 
 	ocean_assert(objectPoints_.size() == objectPointPrecisions_.size());
 
 	previousFrameIndex_ = previousFrameIndex;
-	mapVersion_ = mapVersion;
+	mapVersion_ = mapView.mapVersion();
 }
 
 bool TrackingCorrespondences::optimizePreviousCameraPose(const AnyCamera& camera, const HomogenousMatrix4& world_T_previousCamera, const size_t minimalCorrespondences, HomogenousMatrix4& world_T_optimizedPreviousCamera, const Geometry::Estimator::EstimatorType estimatorType, const Geometry::GravityConstraints* gravityConstraints) const
@@ -188,7 +208,7 @@ size_t TrackingCorrespondences::countValidCorrespondences() const
 	return count;
 }
 
-void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex, const AnyCamera& camera, const HomogenousMatrix4& world_T_previousCamera, const CV::FramePyramid& yPreviousFramePyramid, const CV::FramePyramid& yCurrentFramePyramid, const Tracker::TrackingParameters& trackingParameters, const Quaternion& previousCamera_Q_currentCamera, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision)
+void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex, const AnyCamera& camera, const HomogenousMatrix4& world_T_previousCamera, const CV::FramePyramid& yPreviousFramePyramid, const CV::FramePyramid& yCurrentFramePyramid, const Tracker::TrackingParameters& trackingParameters, const Quaternion& previousCamera_Q_currentCamera, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision, const Vector3& previousCamera_t_currentCamera)
 {
 	ocean_assert(currentFrameIndex >= 1u);
 
@@ -242,7 +262,7 @@ void TrackingCorrespondences::trackImagePoints(const Index32 currentFrameIndex,
 			{
 				ocean_assert(objectPoints_.size() == objectPointPrecisions_.size());
 
-				const HomogenousMatrix4 world_T_approximatedCurrentCamera = world_T_previousCamera * HomogenousMatrix4(previousCamera_Q_currentCamera);
+				const HomogenousMatrix4 world_T_approximatedCurrentCamera = world_T_previousCamera * HomogenousMatrix4(previousCamera_t_currentCamera, previousCamera_Q_currentCamera);
 
 				const HomogenousMatrix4 flippedCamera_T_world(Camera::standard2InvertedFlipped(world_T_approximatedCurrentCamera));
 
@@ -10,6 +10,7 @@
 
 #include "ocean/tracking/slam/SLAM.h"
 #include "ocean/tracking/slam/LocalizedObjectPoint.h"
+#include "ocean/tracking/slam/MapView.h"
 #include "ocean/tracking/slam/PointTrack.h"
 #include "ocean/tracking/slam/Tracker.h"
 
@@ -52,14 +53,17 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackingCorrespondences
 
 		/**
 		 * Updates the internal data structures for a new frame.
-		 * This method resets previously stored information and populates the correspondences from the localized object point map and point track map.
+		 * This method resets previously stored information and populates the correspondences from the observations of the previous frame and from a view of the map.<br>
+		 * Observed points which are part of the view are handled as localized object points, all other observed points are handled as point tracks.<br>
+		 * Localized object points of the view which have been observed in the previous frame but which are not part of the given observations (e.g., due to a re-localization) are added as well.<br>
+		 * The function does not access the map itself, so that no lock is necessary.
 		 * @param previousFrameIndex The index of the previous frame, with range [0, infinity)
-		 * @param mapVersion The current map version
-		 * @param localizedObjectPointMap The map of localized object points
-		 * @param pointTrackMap The map of point tracks
+		 * @param mapView The view of the map to be used, the view's map version will be stored
+		 * @param observationPointIds The ids of all points which have been observed in the previous frame
+		 * @param observationImagePoints The image points of all points which have been observed in the previous frame, one for each point id
 		 * @param minimalFrontPrecision The minimal precision for points to be sorted to the front
 		 */
-		void update(const Index32 previousFrameIndex, const Index32 mapVersion, const LocalizedObjectPointMap& localizedObjectPointMap, PointTrackMap& pointTrackMap, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision);
+		void update(const Index32 previousFrameIndex, const MapView& mapView, const Indices32& observationPointIds, const Vectors2& observationImagePoints, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision);
 
 		/**
 		 * Optimizes the previous camera pose using the stored correspondences.
@@ -84,8 +88,9 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackingCorrespondences
 		 * @param trackingParameters The tracking parameters defining pyramid configuration and patch size
 		 * @param previousCamera_Q_currentCamera The rotation from the previous camera to the current camera (from IMU), invalid if unavailable
 		 * @param minimalFrontPrecision The minimal precision for object points to be used for guided tracking predictions
+		 * @param previousCamera_t_currentCamera The predicted translation from the previous camera to the current camera (e.g., from a motion model), defined in the previous camera, zero if unknown
 		 */
-		void trackImagePoints(const Index32 currentFrameIndex, const AnyCamera& camera, const HomogenousMatrix4& world_T_previousCamera, const CV::FramePyramid& yPreviousFramePyramid, const CV::FramePyramid& yCurrentFramePyramid, const Tracker::TrackingParameters& trackingParameters, const Quaternion& previousCamera_Q_currentCamera, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision);
+		void trackImagePoints(const Index32 currentFrameIndex, const AnyCamera& camera, const HomogenousMatrix4& world_T_previousCamera, const CV::FramePyramid& yPreviousFramePyramid, const CV::FramePyramid& yCurrentFramePyramid, const Tracker::TrackingParameters& trackingParameters, const Quaternion& previousCamera_Q_currentCamera, const LocalizedObjectPoint::LocalizationPrecision minimalFrontPrecision, const Vector3& previousCamera_t_currentCamera = Vector3(0, 0, 0));
 
 		/**
 		 * Returns the previous frame index.
@@ -182,6 +187,9 @@ class OCEAN_TRACKING_SLAM_EXPORT TrackingCorrespondences
 		/// The localization precisions for localized correspondences.
 		LocalizedObjectPoint::LocalizationPrecisions objectPointPrecisions_;
 
+		/// Reusable indices of observations belonging to point tracks, used in update().
+		Indices32 pointTrackIndices_;
+
 		// TODO add whether object point has descriptor (to ensure that we can switch from TS_INITIALIZING to TS_TRACKING)
 };
 